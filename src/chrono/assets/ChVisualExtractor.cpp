@@ -0,0 +1,182 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "chrono/assets/ChAssetLevel.h"
+#include "chrono/assets/ChVisualExtractor.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+ChVisualExtractor::ChVisualExtractor(ChSystem* system)
+    : system(system), next_instance_id(0), seen_topology_revision(0), force_rebuild(true) {}
+
+void ChVisualExtractor::RegisterCallback(RegistrationCallback* callback) {
+    callbacks.push_back(callback);
+    // Late subscribers must not miss the instances already in the table.
+    for (auto& instance : instances)
+        callback->OnInstanceAdded(instance);
+}
+
+void ChVisualExtractor::UnregisterCallback(RegistrationCallback* callback) {
+    auto itr = std::find(callbacks.begin(), callbacks.end(), callback);
+    if (itr != callbacks.end())
+        callbacks.erase(itr);
+}
+
+void ChVisualExtractor::Sync() {
+    bool rebuild = force_rebuild || seen_topology_revision != system->GetTopologyRevision();
+
+    if (!rebuild) {
+        // Asset lists and clone counts can change without an item insertion/removal
+        // (e.g. particles added to a ChParticlesClones): compare the cheap per-item
+        // signature against the one of the last rebuild.
+        size_t k = 0;
+        for (auto& body : system->Get_bodylist()) {
+            if (k >= item_signature.size() ||
+                item_signature[k++] != std::make_tuple((ChPhysicsItem*)body.get(), body->GetAssets().size(),
+                                                       body->GetAssetsFrameNclones())) {
+                rebuild = true;
+                break;
+            }
+        }
+        for (auto& item : system->Get_otherphysicslist()) {
+            if (rebuild)
+                break;
+            if (k >= item_signature.size() ||
+                item_signature[k++] != std::make_tuple((ChPhysicsItem*)item.get(), item->GetAssets().size(),
+                                                       item->GetAssetsFrameNclones())) {
+                rebuild = true;
+            }
+        }
+        for (auto& link : system->Get_linklist()) {
+            if (rebuild)
+                break;
+            if (k >= item_signature.size() ||
+                item_signature[k++] != std::make_tuple((ChPhysicsItem*)link.get(), link->GetAssets().size(),
+                                                       link->GetAssetsFrameNclones())) {
+                rebuild = true;
+            }
+        }
+        if (!rebuild && k != item_signature.size())
+            rebuild = true;
+    }
+
+    if (rebuild)
+        Rebuild();
+}
+
+void ChVisualExtractor::Rebuild() {
+    force_rebuild = false;
+    seen_topology_revision = system->GetTopologyRevision();
+
+    instances.clear();
+    item_signature.clear();
+    for (auto& body : system->Get_bodylist()) {
+        item_signature.push_back(
+            std::make_tuple((ChPhysicsItem*)body.get(), body->GetAssets().size(), body->GetAssetsFrameNclones()));
+        AppendItem(body.get());
+    }
+    for (auto& item : system->Get_otherphysicslist()) {
+        item_signature.push_back(
+            std::make_tuple((ChPhysicsItem*)item.get(), item->GetAssets().size(), item->GetAssetsFrameNclones()));
+        AppendItem(item.get());
+    }
+    for (auto& link : system->Get_linklist()) {
+        item_signature.push_back(
+            std::make_tuple((ChPhysicsItem*)link.get(), link->GetAssets().size(), link->GetAssetsFrameNclones()));
+        AppendItem(link.get());
+    }
+
+    transforms.resize(instances.size());
+
+    // Retire the ids of the instances that disappeared.
+    std::unordered_set<unsigned int> live_ids;
+    for (auto& instance : instances)
+        live_ids.insert(instance.id);
+    for (auto itr = instance_ids.begin(); itr != instance_ids.end();) {
+        if (live_ids.count(itr->second) == 0) {
+            for (auto& callback : callbacks)
+                callback->OnInstanceRemoved(itr->second);
+            itr = instance_ids.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
+void ChVisualExtractor::AppendItem(ChPhysicsItem* item) {
+    unsigned int nclones = item->GetAssetsFrameNclones();
+    if (nclones == 0) {
+        AppendAssets(item, 0, item->GetAssets(), ChFrame<>());
+    } else {
+        for (unsigned int clone = 0; clone < nclones; clone++)
+            AppendAssets(item, clone, item->GetAssets(), ChFrame<>());
+    }
+}
+
+void ChVisualExtractor::AppendAssets(ChPhysicsItem* item,
+                                     unsigned int clone,
+                                     const std::vector<std::shared_ptr<ChAsset>>& assets,
+                                     const ChFrame<>& parent_frame) {
+    for (auto& asset : assets) {
+        if (auto level = std::dynamic_pointer_cast<ChAssetLevel>(asset)) {
+            AppendAssets(item, clone, level->GetAssets(), parent_frame * level->GetFrame());
+            continue;
+        }
+        auto vis = std::dynamic_pointer_cast<ChVisualization>(asset);
+        if (!vis)
+            continue;
+
+        Instance instance;
+        InstanceKey key = std::make_tuple(item, clone, asset.get());
+        auto itr = instance_ids.find(key);
+        if (itr != instance_ids.end()) {
+            instance.id = itr->second;
+        } else {
+            instance.id = next_instance_id++;
+            instance_ids[key] = instance.id;
+        }
+        instance.item = item;
+        instance.clone = clone;
+        instance.asset = vis;
+        instance.local_frame = parent_frame * ChFrame<>(vis->Pos, vis->Rot);
+        instances.push_back(instance);
+
+        if (itr == instance_ids.end()) {
+            for (auto& callback : callbacks)
+                callback->OnInstanceAdded(instances.back());
+        }
+    }
+}
+
+void ChVisualExtractor::ExtractTransforms() {
+#pragma omp parallel for
+    for (int i = 0; i < (int)instances.size(); i++) {
+        const Instance& instance = instances[i];
+        ChFrame<> frame_abs = instance.item->GetAssetsFrame(instance.clone) * instance.local_frame;
+        const ChVector<>& pos = frame_abs.GetPos();
+        const ChQuaternion<>& rot = frame_abs.GetRot();
+        Transform& transform = transforms[i];
+        transform.pos[0] = (float)pos.x();
+        transform.pos[1] = (float)pos.y();
+        transform.pos[2] = (float)pos.z();
+        transform.rot[0] = (float)rot.e0();
+        transform.rot[1] = (float)rot.e1();
+        transform.rot[2] = (float)rot.e2();
+        transform.rot[3] = (float)rot.e3();
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHVISUALEXTRACTOR_H
+#define CHVISUALEXTRACTOR_H
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "chrono/assets/ChVisualization.h"
+#include "chrono/core/ChFrame.h"
+
+namespace chrono {
+
+class ChSystem;
+class ChPhysicsItem;
+
+/// Extraction front-end for external renderers.
+/// Flattens the asset hierarchy of all items of a ChSystem into a table of visual
+/// instances, each identified by a stable id: geometry is registered once (through a
+/// callback, when the instance first appears) and per frame only a packed array of
+/// single-precision world transforms is refilled, in one parallel sweep, instead of
+/// re-walking bodies, clones and nested ChAssetLevel frames. The table is rebuilt
+/// only when the system topology, an item's asset list, or a clone count changed.
+/// Bodies, links and other physics items are covered; FEA meshes are not, since their
+/// visualization assets regenerate geometry every frame instead of moving rigidly.
+class ChApi ChVisualExtractor {
+  public:
+    /// Packed world transform of one visual instance, in a renderer-friendly
+    /// single-precision layout (no padding: 7 floats per instance).
+    struct Transform {
+        float pos[3];  ///< absolute position
+        float rot[4];  ///< absolute rotation, as a unit quaternion (e0, e1, e2, e3)
+    };
+
+    /// One visual instance: a visualization asset of one physics item (or of one of its
+    /// clones, for items such as ChParticlesClones that draw the same assets many times).
+    /// Nested ChAssetLevel frames are flattened into local_frame when the table is
+    /// built, so the per-frame sweep composes exactly two frames per instance.
+    struct Instance {
+        unsigned int id;                         ///< stable instance id (never reused)
+        ChPhysicsItem* item;                     ///< owning physics item
+        unsigned int clone;                      ///< clone index (0 for single-frame items)
+        std::shared_ptr<ChVisualization> asset;  ///< the visualization asset
+        ChFrame<> local_frame;                   ///< asset frame relative to the item frame
+    };
+
+    /// Class to be used as a callback interface for the one-time geometry registration.
+    /// The OnInstanceAdded() method of each registered callback object is invoked once
+    /// per instance, when the instance first enters the table; the renderer uploads the
+    /// geometry there, keyed on the instance id, and afterwards only consumes the
+    /// transform array.
+    class ChApi RegistrationCallback {
+      public:
+        virtual ~RegistrationCallback() {}
+
+        /// Called when an instance enters the table (also for all instances already in
+        /// the table at the time the callback is registered).
+        virtual void OnInstanceAdded(const Instance& instance) = 0;
+
+        /// Called when an instance left the table (its item or asset was removed).
+        /// Its id is retired, never reused.
+        virtual void OnInstanceRemoved(unsigned int instance_id) {}
+    };
+
+    ChVisualExtractor(ChSystem* system);
+
+    /// Subscribe a callback object for instance registration. Its OnInstanceAdded() is
+    /// immediately invoked for the instances already in the table, so registration
+    /// order relative to Sync() does not matter. The caller retains ownership.
+    void RegisterCallback(RegistrationCallback* callback);
+
+    /// Unsubscribe a callback object.
+    void UnregisterCallback(RegistrationCallback* callback);
+
+    /// Bring the instance table up to date with the system, invoking the registration
+    /// callbacks for instances that appeared or disappeared. Cheap when nothing
+    /// changed: the rebuild is keyed on the assembly topology revision and on a
+    /// per-item signature of asset list size and clone count. Changes inside an
+    /// existing asset (e.g. an edited ChAssetLevel frame) are not detected; call
+    /// ForceRebuild() after such edits. Call once per rendered frame, before
+    /// ExtractTransforms().
+    void Sync();
+
+    /// Force the next Sync() to rebuild the instance table.
+    void ForceRebuild() { force_rebuild = true; }
+
+    /// Fill the packed transform array with the current absolute transform of every
+    /// instance, in one parallel sweep. Entry k of GetTransforms() corresponds to
+    /// entry k of GetInstances().
+    void ExtractTransforms();
+
+    /// Get the instance table (valid until the next Sync()).
+    const std::vector<Instance>& GetInstances() const { return instances; }
+
+    /// Get the packed transform array filled by ExtractTransforms().
+    const std::vector<Transform>& GetTransforms() const { return transforms; }
+
+  private:
+    /// Key identifying an instance across table rebuilds.
+    typedef std::tuple<ChPhysicsItem*, unsigned int, ChAsset*> InstanceKey;
+
+    /// Rebuild the instance table and notify the registration callbacks.
+    void Rebuild();
+
+    /// Append the visualization assets of one item (all clones) to the table.
+    void AppendItem(ChPhysicsItem* item);
+
+    /// Recursively flatten one asset list, composing nested ChAssetLevel frames.
+    void AppendAssets(ChPhysicsItem* item,
+                      unsigned int clone,
+                      const std::vector<std::shared_ptr<ChAsset>>& assets,
+                      const ChFrame<>& parent_frame);
+
+    ChSystem* system;                                   ///< the inspected system (not owned)
+    std::vector<Instance> instances;                    ///< current instance table
+    std::vector<Transform> transforms;                  ///< packed FP32 transforms, parallel to instances
+    std::map<InstanceKey, unsigned int> instance_ids;   ///< persistent key -> stable id map
+    unsigned int next_instance_id;                      ///< next id to hand out
+    std::vector<RegistrationCallback*> callbacks;       ///< registration subscribers (not owned)
+    unsigned int seen_topology_revision;                ///< topology revision at the last rebuild
+    std::vector<std::tuple<ChPhysicsItem*, size_t, unsigned int>> item_signature;  ///< (item, #assets, #clones)
+    bool force_rebuild;                                 ///< rebuild at the next Sync()?
+};
+
+}  // end namespace chrono
+
+#endif
@@ -37,6 +37,7 @@ class ChApi ChCollisionSystem {
     ChCollisionSystem(unsigned int max_objects = 16000, double scene_size = 500) {
         narrow_callback = 0;
         broad_callback = 0;
+        shape_revision = 0;
     };
 
     virtual ~ChCollisionSystem(){};
@@ -57,6 +58,13 @@ class ChApi ChCollisionSystem {
     /// engine (custom data may be deallocated).
     // virtual void RemoveAll() = 0;
 
+    /// Get the generation counter of the collision shapes held by this engine.
+    /// The counter is incremented by the Add() and Remove() implementations of the
+    /// derived classes, so consumers that cache data derived from the set of shapes
+    /// (broadphase structures, device-side shape tables, ...) can compare it against
+    /// the value seen when the cache was built instead of re-scanning the shapes.
+    unsigned int GetShapeRevision() const { return shape_revision; }
+
     /// Run the collision detection and finds the contacts.
     /// This function will be called at each simulation step.
     virtual void Run() = 0;
@@ -168,6 +176,7 @@ class ChApi ChCollisionSystem {
   protected:
     BroadphaseCallback* broad_callback;    ///< user callback for each near-enough pair of shapes
     NarrowphaseCallback* narrow_callback;  ///< user callback for each collision pair
+    unsigned int shape_revision;           ///< generation counter of the shape set (see GetShapeRevision)
 };
 
 }  // end namespace collision
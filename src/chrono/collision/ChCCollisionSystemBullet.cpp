@@ -1167,7 +1167,39 @@ private:
 ////////////////////////////////////
 
 
+// Broadphase pair filter implementing collision aggregates: a pair whose two objects
+// belong to the same aggregate is rejected before entering the pair cache, unless the
+// aggregate allows self-collision (see ChCollisionSystemBullet::AddAggregate).
+class btAggregateOverlapFilterCallback : public btOverlapFilterCallback {
+  public:
+    btAggregateOverlapFilterCallback(const std::unordered_map<const btCollisionObject*, int>* aggregate_of,
+                                     const std::vector<bool>* self_collide)
+        : m_aggregate_of(aggregate_of), m_self_collide(self_collide) {}
+
+    virtual bool needBroadphaseCollision(btBroadphaseProxy* proxy0, btBroadphaseProxy* proxy1) const {
+        // Default collision family group/mask test.
+        bool collides = (proxy0->m_collisionFilterGroup & proxy1->m_collisionFilterMask) != 0 &&
+                        (proxy1->m_collisionFilterGroup & proxy0->m_collisionFilterMask) != 0;
+        if (!collides)
+            return false;
+        auto it0 = m_aggregate_of->find((const btCollisionObject*)proxy0->m_clientObject);
+        if (it0 == m_aggregate_of->end())
+            return true;
+        auto it1 = m_aggregate_of->find((const btCollisionObject*)proxy1->m_clientObject);
+        if (it1 == m_aggregate_of->end() || it0->second != it1->second)
+            return true;
+        return (*m_self_collide)[it0->second];
+    }
+
+  private:
+    const std::unordered_map<const btCollisionObject*, int>* m_aggregate_of;
+    const std::vector<bool>* m_self_collide;
+};
+
 ChCollisionSystemBullet::ChCollisionSystemBullet(unsigned int max_objects, double scene_size) {
+    aggregate_filter = nullptr;
+    lod_deactivation_delay = 10;
+
     // btDefaultCollisionConstructionInfo conf_info(...); ***TODO***
     bt_collision_configuration = new btDefaultCollisionConfiguration();
 
@@ -1235,6 +1267,8 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
         delete bt_dispatcher;
     if (bt_collision_configuration)
         delete bt_collision_configuration;
+    if (aggregate_filter)
+        delete aggregate_filter;
 }
 
 void ChCollisionSystemBullet::Clear(void) {
@@ -1247,25 +1281,161 @@ void ChCollisionSystemBullet::Clear(void) {
 
 void ChCollisionSystemBullet::Add(ChCollisionModel* model) {
     if (((ChModelBullet*)model)->GetBulletModel()->getCollisionShape()) {
+        ((ChModelBullet*)model)->SetCollisionOrigin(collision_origin);
         model->SyncPosition();
         bt_collision_world->addCollisionObject(((ChModelBullet*)model)->GetBulletModel(),
                                                ((ChModelBullet*)model)->GetFamilyGroup(),
                                                ((ChModelBullet*)model)->GetFamilyMask());
+        if (((ChModelBullet*)model)->HasFineDetail())
+            lod_models.insert((ChModelBullet*)model);
     }
+    shape_revision++;
 }
 
 void ChCollisionSystemBullet::Remove(ChCollisionModel* model) {
     if (((ChModelBullet*)model)->GetBulletModel()->getCollisionShape()) {
         bt_collision_world->removeCollisionObject(((ChModelBullet*)model)->GetBulletModel());
     }
+    aggregate_of.erase(((ChModelBullet*)model)->GetBulletModel());
+    lod_models.erase((ChModelBullet*)model);
+    lod_idle_steps.erase((ChModelBullet*)model);
+    shape_revision++;
+}
+
+void ChCollisionSystemBullet::SetCollisionOrigin(const ChVector<>& origin) {
+    collision_origin = origin;
+
+    // Re-express every collision object relative to the new origin.
+    btCollisionObjectArray& objects = bt_collision_world->getCollisionObjectArray();
+    for (int i = 0; i < objects.size(); i++) {
+        if (ChModelBullet* model = (ChModelBullet*)objects[i]->getUserPointer()) {
+            model->SetCollisionOrigin(collision_origin);
+            model->SyncPosition();
+        }
+    }
+    bt_collision_world->updateAabbs();
 }
 
 void ChCollisionSystemBullet::Run() {
     if (bt_collision_world) {
+        if (!lod_models.empty())
+            UpdateDetailLevels();
         bt_collision_world->performDiscreteCollisionDetection();
     }
 }
 
+void ChCollisionSystemBullet::SetModelDetail(ChModelBullet* model, bool fine) {
+    if (model->IsFineDetailActive() == fine)
+        return;
+
+    btCollisionObject* obj = model->GetBulletModel();
+    // Drop the pairs cached for this object: their narrowphase algorithms and
+    // persistent manifolds refer to the shapes being swapped out. Surviving
+    // overlaps are re-created (on the new shapes) by the broadphase update of
+    // the collision detection that follows.
+    if (btBroadphaseProxy* proxy = obj->getBroadphaseHandle())
+        bt_collision_world->getPairCache()->removeOverlappingPairsContainingProxy(proxy, bt_dispatcher);
+
+    model->SetFineDetailActive(fine);
+    bt_collision_world->updateSingleAabb(obj);
+}
+
+void ChCollisionSystemBullet::UpdateDetailLevels() {
+    // Scan the overlapping pairs left by the previous step (temporal coherence:
+    // thanks to the collision envelope, a broadphase overlap appears while the
+    // bodies are still separated): a model meets its fine level only while it
+    // is near another fine-detail model.
+    btOverlappingPairCache* pair_cache = bt_collision_world->getPairCache();
+    btBroadphasePair* pairs = pair_cache->getOverlappingPairArrayPtr();
+    for (int ip = 0; ip < pair_cache->getNumOverlappingPairs(); ip++) {
+        btCollisionObject* obj0 = (btCollisionObject*)pairs[ip].m_pProxy0->m_clientObject;
+        btCollisionObject* obj1 = (btCollisionObject*)pairs[ip].m_pProxy1->m_clientObject;
+        ChModelBullet* model0 = obj0 ? (ChModelBullet*)obj0->getUserPointer() : nullptr;
+        ChModelBullet* model1 = obj1 ? (ChModelBullet*)obj1->getUserPointer() : nullptr;
+        if (model0 && model1 && model0->HasFineDetail() && model1->HasFineDetail()) {
+            lod_idle_steps[model0] = 0;
+            lod_idle_steps[model1] = 0;
+        }
+    }
+
+    for (auto it = lod_idle_steps.begin(); it != lod_idle_steps.end();) {
+        if (it->second == 0)
+            SetModelDetail(it->first, true);
+        if (it->second > lod_deactivation_delay) {
+            SetModelDetail(it->first, false);
+            it = lod_idle_steps.erase(it);
+        } else {
+            it->second++;
+            ++it;
+        }
+    }
+}
+
+int ChCollisionSystemBullet::BakeStaticScene() {
+    int num_baked = 0;
+    btCollisionObjectArray& objects = bt_collision_world->getCollisionObjectArray();
+    for (int i = 0; i < objects.size(); i++) {
+        btCollisionObject* obj = objects[i];
+        ChModelBullet* model = (ChModelBullet*)obj->getUserPointer();
+        if (!model)
+            continue;
+        ChBody* body = dynamic_cast<ChBody*>(model->GetContactable());
+        if (!body || !body->GetBodyFixed())
+            continue;
+        obj->setCollisionFlags(obj->getCollisionFlags() | btCollisionObject::CF_STATIC_OBJECT);
+        obj->setActivationState(ISLAND_SLEEPING);
+        // Compute the broadphase AABB once, at the baked pose.
+        bt_collision_world->updateSingleAabb(obj);
+        num_baked++;
+    }
+    // Let the per-step AABB update skip the deactivated (baked) objects.
+    bt_collision_world->setForceUpdateAllAabbs(false);
+    return num_baked;
+}
+
+void ChCollisionSystemBullet::UnbakeStaticScene() {
+    btCollisionObjectArray& objects = bt_collision_world->getCollisionObjectArray();
+    for (int i = 0; i < objects.size(); i++) {
+        btCollisionObject* obj = objects[i];
+        if (obj->getActivationState() == ISLAND_SLEEPING) {
+            obj->setCollisionFlags(obj->getCollisionFlags() & ~btCollisionObject::CF_STATIC_OBJECT);
+            obj->setActivationState(ACTIVE_TAG);
+        }
+    }
+    bt_collision_world->setForceUpdateAllAabbs(true);
+}
+
+int ChCollisionSystemBullet::AddAggregate(bool self_collide) {
+    if (!aggregate_filter) {
+        aggregate_filter = new btAggregateOverlapFilterCallback(&aggregate_of, &aggregate_self_collide);
+        bt_collision_world->getPairCache()->setOverlapFilterCallback(aggregate_filter);
+    }
+    aggregate_self_collide.push_back(self_collide);
+    return (int)aggregate_self_collide.size() - 1;
+}
+
+void ChCollisionSystemBullet::AssignToAggregate(ChCollisionModel* model, int aggregate) {
+    btCollisionObject* obj = ((ChModelBullet*)model)->GetBulletModel();
+    aggregate_of[obj] = aggregate;
+    // Drop pairs already cached for this object, so that the filter is re-evaluated.
+    if (btBroadphaseProxy* proxy = obj->getBroadphaseHandle())
+        bt_collision_world->getPairCache()->removeOverlappingPairsContainingProxy(proxy, bt_dispatcher);
+}
+
+void ChCollisionSystemBullet::RemoveFromAggregate(ChCollisionModel* model) {
+    aggregate_of.erase(((ChModelBullet*)model)->GetBulletModel());
+}
+
+void ChCollisionSystemBullet::ClearAggregates() {
+    aggregate_of.clear();
+    aggregate_self_collide.clear();
+    if (aggregate_filter) {
+        bt_collision_world->getPairCache()->setOverlapFilterCallback(nullptr);
+        delete aggregate_filter;
+        aggregate_filter = nullptr;
+    }
+}
+
 void ChCollisionSystemBullet::ResetTimers() {
     bt_collision_world->timer_collision_broad.reset();
     bt_collision_world->timer_collision_narrow.reset();
@@ -1319,8 +1489,11 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
                     btVector3 ptA = pt.getPositionWorldOnA();
                     btVector3 ptB = pt.getPositionWorldOnB();
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+                    // Promote to double and translate back to absolute coordinates
+                    icontact.vpA.Set(ptA.getX() + collision_origin.x(), ptA.getY() + collision_origin.y(),
+                                     ptA.getZ() + collision_origin.z());
+                    icontact.vpB.Set(ptB.getX() + collision_origin.x(), ptB.getY() + collision_origin.y(),
+                                     ptB.getZ() + collision_origin.z());
 
                     icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
                                     -pt.m_normalWorldOnB.getZ());
@@ -1394,8 +1567,10 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
                                      ChRayhitResult& mresult,
                                      short int filter_group,
                                      short int filter_mask) const {
-    btVector3 btfrom((btScalar)from.x(), (btScalar)from.y(), (btScalar)from.z());
-    btVector3 btto((btScalar)to.x(), (btScalar)to.y(), (btScalar)to.z());
+    btVector3 btfrom((btScalar)(from.x() - collision_origin.x()), (btScalar)(from.y() - collision_origin.y()),
+                     (btScalar)(from.z() - collision_origin.z()));
+    btVector3 btto((btScalar)(to.x() - collision_origin.x()), (btScalar)(to.y() - collision_origin.y()),
+                   (btScalar)(to.z() - collision_origin.z()));
 
     btCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
     rayCallback.m_collisionFilterGroup = filter_group;
@@ -1407,8 +1582,9 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
         mresult.hitModel = (ChCollisionModel*)(rayCallback.m_collisionObject->getUserPointer());
         if (mresult.hitModel) {
             mresult.hit = true;
-            mresult.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
-                                     rayCallback.m_hitPointWorld.z());
+            mresult.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x() + collision_origin.x(),
+                                     rayCallback.m_hitPointWorld.y() + collision_origin.y(),
+                                     rayCallback.m_hitPointWorld.z() + collision_origin.z());
             mresult.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
                                       rayCallback.m_hitNormalWorld.z());
             mresult.abs_hitNormal.Normalize();
@@ -1435,8 +1611,10 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
                                      ChRayhitResult& mresult,
                                      short int filter_group,
                                      short int filter_mask) const {
-    btVector3 btfrom((btScalar)from.x(), (btScalar)from.y(), (btScalar)from.z());
-    btVector3 btto((btScalar)to.x(), (btScalar)to.y(), (btScalar)to.z());
+    btVector3 btfrom((btScalar)(from.x() - collision_origin.x()), (btScalar)(from.y() - collision_origin.y()),
+                     (btScalar)(from.z() - collision_origin.z()));
+    btVector3 btto((btScalar)(to.x() - collision_origin.x()), (btScalar)(to.y() - collision_origin.y()),
+                   (btScalar)(to.z() - collision_origin.z()));
 
     btCollisionWorld::AllHitsRayResultCallback rayCallback(btfrom, btto);
     rayCallback.m_collisionFilterGroup = filter_group;
@@ -1463,8 +1641,9 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
     // Return the closest hit on the specified model
     mresult.hit = true;
     mresult.hitModel = static_cast<ChCollisionModel*>(rayCallback.m_collisionObjects[hit]->getUserPointer());
-    mresult.abs_hitPoint.Set(rayCallback.m_hitPointWorld[hit].x(), rayCallback.m_hitPointWorld[hit].y(),
-                             rayCallback.m_hitPointWorld[hit].z());
+    mresult.abs_hitPoint.Set(rayCallback.m_hitPointWorld[hit].x() + collision_origin.x(),
+                             rayCallback.m_hitPointWorld[hit].y() + collision_origin.y(),
+                             rayCallback.m_hitPointWorld[hit].z() + collision_origin.z());
     mresult.abs_hitNormal.Set(rayCallback.m_hitNormalWorld[hit].x(), rayCallback.m_hitNormalWorld[hit].y(),
                               rayCallback.m_hitNormalWorld[hit].z());
     mresult.abs_hitNormal.Normalize();
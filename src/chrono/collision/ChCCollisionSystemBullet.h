@@ -15,6 +15,10 @@
 #ifndef CHC_COLLISIONSYSTEMBULLET_H
 #define CHC_COLLISIONSYSTEMBULLET_H
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "chrono/collision/ChCCollisionSystem.h"
 #include "chrono/collision/bullet/btBulletCollisionCommon.h"
 #include "chrono/core/ChApiCE.h"
@@ -22,6 +26,8 @@
 namespace chrono {
 namespace collision {
 
+class ChModelBullet;
+
 ///
 /// Class for collision engine based on the 'Bullet' library.
 /// Contains either the broadphase and the narrow phase Bullet
@@ -114,11 +120,89 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     // Call it only once, before running the simulation.
     static void SetContactBreakingThreshold(double threshold);
 
+    /// Bake the static environment: the collision models of all fixed bodies are marked
+    /// static in the Bullet world, their broadphase AABB is computed once here, and the
+    /// per-step AABB update then skips them (the dominant per-step cost in scenes with
+    /// many static shapes). Bullet also stops dispatching narrow-phase work to pairs of
+    /// baked objects. Returns the number of baked collision models.
+    /// Call it after the static geometry is in place; if static bodies are later moved,
+    /// un-fixed, or their collision models rebuilt, call UnbakeStaticScene() (or bake
+    /// again) to pick up the changes.
+    int BakeStaticScene();
+
+    /// Undo BakeStaticScene(): reactivate all baked collision models and restore the
+    /// per-step AABB update for every object in the Bullet world.
+    void UnbakeStaticScene();
+
+    /// Create a new collision aggregate and return its id.
+    /// An aggregate groups the collision models of bodies that form one compact
+    /// mechanism (all parts of a machine, a sub-assembly, a spatial cluster). Pairs of
+    /// models belonging to the same aggregate are rejected before they enter the Bullet
+    /// pair cache, unless self_collide is true, so no narrow-phase algorithm is ever
+    /// created for them. In scenes with many compact multi-part mechanisms this removes
+    /// the intra-mechanism proximity pairs that otherwise dominate the broadphase
+    /// output. Member-level testing between different aggregates is unaffected.
+    int AddAggregate(bool self_collide = false);
+
+    /// Assign a collision model to an aggregate created with AddAggregate().
+    /// Pairs already cached for this model are dropped so that the aggregate
+    /// filtering takes effect from the next Run().
+    void AssignToAggregate(ChCollisionModel* model, int aggregate);
+
+    /// Remove a collision model from its aggregate, if it belongs to one.
+    void RemoveFromAggregate(ChCollisionModel* model);
+
+    /// Remove all aggregates and restore the default broadphase pair acceptance
+    /// (collision family masks only).
+    void ClearAggregates();
+
+    /// Set the number of consecutive steps without broadphase proximity after
+    /// which a model switched to its fine level of detail reverts to the coarse
+    /// one (default 10). Models define a fine level with
+    /// ChModelBullet::BeginFineDetail(); this class activates it, per model,
+    /// only while the broadphase reports overlap with another model that also
+    /// has a fine level. The delay is the hysteresis that keeps bodies bouncing
+    /// at a contact interface from thrashing between the two levels.
+    void SetLODDeactivationDelay(int steps) { lod_deactivation_delay = steps; }
+
+    /// Set the origin of the Bullet collision world, in absolute (double precision)
+    /// coordinates. All transforms handed to Bullet are expressed relative to this
+    /// point, and contact points and ray hits are translated back before being
+    /// reported. With Bullet compiled in single precision (the default, see the
+    /// USE_BULLET_DOUBLE build option), this keeps the FP32 collision coordinates
+    /// small even when the simulation runs far from the absolute origin, so the
+    /// bandwidth advantage of the float pipeline does not cost contact point
+    /// accuracy. Rebase near the region of interest at setup, or periodically for
+    /// wide-ranging simulations; rebasing re-syncs every collision model, so do not
+    /// call it at each step. The origin subtraction itself is done in double.
+    void SetCollisionOrigin(const ChVector<>& origin);
+
+    /// Get the origin of the Bullet collision world (default: the absolute origin).
+    const ChVector<>& GetCollisionOrigin() const { return collision_origin; }
+
   private:
+    /// Switch the LOD models between their coarse and fine levels, based on the
+    /// overlapping pairs left in the Bullet pair cache by the previous step.
+    /// Called by Run() before the collision detection proper.
+    void UpdateDetailLevels();
+
+    /// Expose the requested detail level of a model, dropping the cached pairs
+    /// (hence narrowphase algorithms and manifolds) built on the old shapes.
+    void SetModelDetail(ChModelBullet* model, bool fine);
     btCollisionConfiguration* bt_collision_configuration;
     btCollisionDispatcher* bt_dispatcher;
     btBroadphaseInterface* bt_broadphase;
     btCollisionWorld* bt_collision_world;
+
+    std::unordered_map<const btCollisionObject*, int> aggregate_of;  ///< aggregate id of each member object
+    std::vector<bool> aggregate_self_collide;                        ///< per-aggregate self-collision flag
+    btOverlapFilterCallback* aggregate_filter;                       ///< pair filter installed when aggregates exist
+
+    std::unordered_set<ChModelBullet*> lod_models;           ///< models in the world that define a fine level
+    std::unordered_map<ChModelBullet*, int> lod_idle_steps;  ///< fine-active models -> steps without proximity
+    int lod_deactivation_delay;                              ///< idle steps before reverting to coarse
+
+    ChVector<> collision_origin;  ///< absolute origin of the Bullet world (see SetCollisionOrigin)
 };
 
 }  // end namespace collision
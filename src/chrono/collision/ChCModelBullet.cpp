@@ -12,8 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <cstdint>
 #include <memory>
 #include <array>
+#include <unordered_map>
 
 #include "chrono/collision/ChCCollisionSystemBullet.h"
 #include "chrono/collision/ChCCollisionUtils.h"
@@ -39,6 +41,29 @@ namespace collision {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChModelBullet)
 
+bool ChModelBullet::use_shape_cache = false;
+
+// Cache of convex hull shapes shared across collision models, keyed by a hash of the
+// input point cloud and the collision margins (which are baked into the Bullet shape).
+static std::unordered_map<uint64_t, std::shared_ptr<btCollisionShape>> hull_shape_cache;
+
+// FNV-1a hash over a raw byte range; pass the previous value in 'hash' to chain ranges.
+static uint64_t ChHashShapeBytes(const void* data, size_t nbytes, uint64_t hash = 0xcbf29ce484222325ULL) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < nbytes; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+void ChModelBullet::EnableSharedShapeCache(bool val) {
+    use_shape_cache = val;
+}
+
+void ChModelBullet::ClearSharedShapeCache() {
+    hull_shape_cache.clear();
+}
 
 ChModelBullet::ChModelBullet() {
     bt_collision_object = new btCollisionObject;
@@ -46,6 +71,9 @@ ChModelBullet::ChModelBullet() {
     bt_collision_object->setUserPointer((void*)this);
 
     shapes.clear();
+    shapes_fine.clear();
+    building_fine = false;
+    fine_active = false;
 }
 
 ChModelBullet::~ChModelBullet() {
@@ -60,6 +88,10 @@ ChModelBullet::~ChModelBullet() {
 }
 
 int ChModelBullet::ClearModel() {
+    shapes_fine.clear();
+    building_fine = false;
+    fine_active = false;
+
     // delete previously added shapes, if collision shape(s) used by collision object
     if (shapes.size() > 0) {
         // deletes shared pointers, so also deletes shapes if uniquely referenced
@@ -81,6 +113,19 @@ int ChModelBullet::ClearModel() {
 }
 
 int ChModelBullet::BuildModel() {
+    if (building_fine) {
+        // finalize the fine level (currently installed by the Add* calls) ...
+        RebuildChildAabbTree();
+        // ... and make the coarse level the active one again
+        shapes.swap(shapes_fine);
+        building_fine = false;
+        bt_collision_object->setCollisionShape(shapes.empty() ? 0 : shapes[0].get());
+    }
+    fine_active = false;
+
+    // if a compound of sub-shapes was built, rebalance its midphase AABB tree
+    // now that all children are known
+    RebuildChildAabbTree();
 
     // insert again (we assume it was removed by ClearModel!!!)
     if (GetContactable())
@@ -115,26 +160,32 @@ static void ChCoordsToBullet(const ChCoordsys<>& mcoords, btTransform& mtransfor
 }
 
 void ChModelBullet::_injectShape(const ChVector<>& pos, const ChMatrix33<>& rot, btCollisionShape* mshape) {
+    _injectShape(pos, rot, std::shared_ptr<btCollisionShape>(mshape));
+}
+
+void ChModelBullet::_injectShape(const ChVector<>& pos, const ChMatrix33<>& rot, std::shared_ptr<btCollisionShape> mshape) {
     bool centered = (pos.IsNull() && rot.IsIdentity());
-    
+
     // This is needed so later one can access ChModelBullet::GetSafeMargin and ChModelBullet::GetEnvelope
+    // (note: on shapes shared across models via the hull cache the last writer wins, but the
+    // user pointer is only consumed by btCEtriangleShape collisions, which are never shared)
     mshape->setUserPointer(this);
-    
+
     // start_vector = ||    -- description is still empty
     if (shapes.size() == 0) {
         if (centered) {
-            shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
-            bt_collision_object->setCollisionShape(mshape);
+            shapes.push_back(mshape);
+            bt_collision_object->setCollisionShape(mshape.get());
             // end_vector=  | centered shape |
             return;
         } else {
             btCompoundShape* mcompound = new btCompoundShape(true);
             shapes.push_back(std::shared_ptr<btCollisionShape>(mcompound));
-            shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
+            shapes.push_back(mshape);
             bt_collision_object->setCollisionShape(mcompound);
             btTransform mtransform;
             ChPosMatrToBullet(pos, rot, mtransform);
-            mcompound->addChildShape(mtransform, mshape);
+            mcompound->addChildShape(mtransform, mshape.get());
             // vector=  | compound | not centered shape |
             return;
         }
@@ -143,7 +194,7 @@ void ChModelBullet::_injectShape(const ChVector<>& pos, const ChMatrix33<>& rot,
     if (shapes.size() == 1) {
         btTransform mtransform;
         shapes.push_back(shapes[0]);
-        shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
+        shapes.push_back(mshape);
         btCompoundShape* mcompound = new btCompoundShape(true);
         shapes[0] = std::shared_ptr<btCollisionShape>(mcompound);
         bt_collision_object->setCollisionShape(mcompound);
@@ -157,10 +208,10 @@ void ChModelBullet::_injectShape(const ChVector<>& pos, const ChMatrix33<>& rot,
     // vector=  | compound | old | old.. |   ----already working with compounds..
     if (shapes.size() > 1) {
         btTransform mtransform;
-        shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
+        shapes.push_back(mshape);
         ChPosMatrToBullet(pos, rot, mtransform);
         btCollisionShape* mcom = shapes[0].get();
-        ((btCompoundShape*)mcom)->addChildShape(mtransform, mshape);
+        ((btCompoundShape*)mcom)->addChildShape(mtransform, mshape.get());
         // vector=  | compound | old | old.. | new shape | ...
         return;
     }
@@ -400,6 +451,20 @@ bool ChModelBullet::AddConvexHull(const std::vector<ChVector<double> >& pointlis
     // override the inward margin if larger than 0.2 chord:
     this->SetSafeMargin((btScalar)ChMin(this->GetSafeMargin(), approx_chord*0.2));
 
+    // When the shared shape cache is enabled, hash the input point cloud together with
+    // the margins (baked into the Bullet shape below) and reuse an identical hull built
+    // for another model, skipping both the hull computation and the shape allocation.
+    uint64_t hull_key = 0;
+    if (use_shape_cache) {
+        hull_key = ChHashShapeBytes(pointlist.data(), pointlist.size() * sizeof(ChVector<double>));
+        double hull_margins[2] = {this->GetSafeMargin(), this->GetSuggestedFullMargin()};
+        hull_key = ChHashShapeBytes(hull_margins, sizeof(hull_margins), hull_key);
+        auto cached = hull_shape_cache.find(hull_key);
+        if (cached != hull_shape_cache.end()) {
+            _injectShape(pos, rot, cached->second);
+            return true;
+        }
+    }
 
     btConvexHullShape* mshape = new btConvexHullShape;
 
@@ -416,7 +481,13 @@ bool ChModelBullet::AddConvexHull(const std::vector<ChVector<double> >& pointlis
     mshape->setMargin((btScalar) this->GetSuggestedFullMargin());
     mshape->recalcLocalAabb();
 
-    _injectShape(pos, rot, mshape);
+    if (use_shape_cache) {
+        std::shared_ptr<btCollisionShape> shared_shape(mshape);
+        hull_shape_cache[hull_key] = shared_shape;
+        _injectShape(pos, rot, shared_shape);
+    } else {
+        _injectShape(pos, rot, mshape);
+    }
 
     return true;
 }
@@ -752,17 +823,35 @@ void ChModelBullet::SetFamilyMask(short int mask) {
 }
 
 void ChModelBullet::onFamilyChange() {
-    if (!bt_collision_object->getBroadphaseHandle())
+    btBroadphaseProxy* proxy = bt_collision_object->getBroadphaseHandle();
+    if (!proxy)
         return;
 
     this->SyncPosition();
 
-    // Trick to avoid troubles if setting mask or family when model is already overlapping to some other model
     auto mcosys = this->GetPhysicsItem()->GetSystem()->GetCollisionSystem();
-    mcosys->Remove(this);
-
     auto mcs = std::static_pointer_cast<ChCollisionSystemBullet>(mcosys);
-    mcs->GetBulletCollisionWorld()->addCollisionObject(bt_collision_object, family_group, family_mask);
+    btCollisionWorld* bt_world = mcs->GetBulletCollisionWorld();
+
+    // Update the filter data in-place on the existing broadphase proxy, rather
+    // than removing and re-inserting the collision object: this preserves the
+    // broadphase pair cache and the persistent contact manifolds of all the
+    // pairs not involving this model.
+    proxy->m_collisionFilterGroup = family_group;
+    proxy->m_collisionFilterMask = family_mask;
+
+    // Drop only the pairs involving this proxy (they were created under the old
+    // filter data), then force a broadphase update of its leaf so that the pairs
+    // admissible under the new family group/mask are re-created, even if the
+    // model did not move.
+    bt_world->getPairCache()->removeOverlappingPairsContainingProxy(proxy, bt_world->getDispatcher());
+    if (btDbvtBroadphase* dbvt_broadphase = dynamic_cast<btDbvtBroadphase*>(bt_world->getBroadphase())) {
+        btVector3 aabbMin, aabbMax;
+        bt_collision_object->getCollisionShape()->getAabb(bt_collision_object->getWorldTransform(), aabbMin, aabbMax);
+        dbvt_broadphase->setAabbForceUpdate(proxy, aabbMin, aabbMax, bt_world->getDispatcher());
+    } else {
+        bt_world->updateSingleAabb(bt_collision_object);
+    }
 }
 
 void ChModelBullet::GetAABB(ChVector<>& bbmin, ChVector<>& bbmax) const {
@@ -770,8 +859,8 @@ void ChModelBullet::GetAABB(ChVector<>& bbmin, ChVector<>& bbmax) const {
     btVector3 btmax;
     if (bt_collision_object->getCollisionShape())
         bt_collision_object->getCollisionShape()->getAabb(bt_collision_object->getWorldTransform(), btmin, btmax);
-    bbmin.Set(btmin.x(), btmin.y(), btmin.z());
-    bbmax.Set(btmax.x(), btmax.y(), btmax.z());
+    bbmin.Set(btmin.x() + col_origin.x(), btmin.y() + col_origin.y(), btmin.z() + col_origin.z());
+    bbmax.Set(btmax.x() + col_origin.x(), btmax.y() + col_origin.y(), btmax.z() + col_origin.z());
 }
 
 void __recurse_add_newcollshapes(btCollisionShape* ashape,
@@ -794,8 +883,11 @@ void ChModelBullet::SyncPosition()
 {
     ChCoordsys<> mcsys = this->mcontactable->GetCsysForCollisionModel();
 
-    bt_collision_object->getWorldTransform().setOrigin(btVector3(
-        (btScalar)mcsys.pos.x(), (btScalar)mcsys.pos.y(), (btScalar)mcsys.pos.z()));
+    // Rebase on the collision world origin in double, before the (possibly
+    // single precision) btScalar truncation.
+    ChVector<> pos = mcsys.pos - col_origin;
+    bt_collision_object->getWorldTransform().setOrigin(
+        btVector3((btScalar)pos.x(), (btScalar)pos.y(), (btScalar)pos.z()));
     const ChMatrix33<>& rA(mcsys.rot);
     btMatrix3x3 basisA((btScalar)rA(0, 0), (btScalar)rA(0, 1), (btScalar)rA(0, 2), (btScalar)rA(1, 0),
                        (btScalar)rA(1, 1), (btScalar)rA(1, 2), (btScalar)rA(2, 0), (btScalar)rA(2, 1),
@@ -817,6 +909,44 @@ bool ChModelBullet::SetSphereRadius(double coll_radius, double out_envelope) {
     return true;
 }
 
+void ChModelBullet::RebuildChildAabbTree() {
+    btCollisionShape* mshape = bt_collision_object->getCollisionShape();
+    if (!mshape || mshape->getShapeType() != COMPOUND_SHAPE_PROXYTYPE)
+        return;
+
+    btCompoundShape* mcompound = (btCompoundShape*)mshape;
+    mcompound->recalculateLocalAabb();
+
+    if (!mcompound->getDynamicAabbTree()) {
+        mcompound->createAabbTreeFromChildren();
+    } else if (mcompound->getNumChildShapes() > 1) {
+        // Children were inserted one at a time while the model was being built,
+        // which can leave the tree poorly balanced for large compounds; redo the
+        // topology top-down (leaf nodes, hence child bookkeeping, are reused).
+        mcompound->getDynamicAabbTree()->optimizeTopDown();
+    }
+}
+
+void ChModelBullet::BeginFineDetail() {
+    if (shapes.empty() || building_fine)
+        return;
+
+    // Stash the coarse level and let the subsequent Add* calls build the fine
+    // set from scratch (they install their root shape as they go; BuildModel()
+    // swaps the two sets back and re-activates the coarse root).
+    shapes.swap(shapes_fine);
+    bt_collision_object->setCollisionShape(0);
+    building_fine = true;
+}
+
+void ChModelBullet::SetFineDetailActive(bool fine) {
+    if (shapes_fine.empty() || building_fine || fine == fine_active)
+        return;
+
+    bt_collision_object->setCollisionShape(fine ? shapes_fine[0].get() : shapes[0].get());
+    fine_active = fine;
+}
+
 void ChModelBullet::ArchiveOUT(ChArchiveOut& marchive)
 {
     // version number
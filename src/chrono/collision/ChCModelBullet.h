@@ -44,6 +44,25 @@ class ChApi ChModelBullet : public ChCollisionModel {
     // Vector of shared pointers to geometric objects.
     std::vector<std::shared_ptr<btCollisionShape>> shapes;
 
+    // Alternate fine level of detail (see BeginFineDetail); empty for the
+    // common case of a model with a single level of detail.
+    std::vector<std::shared_ptr<btCollisionShape>> shapes_fine;
+
+    // True between BeginFineDetail() and BuildModel(), while the Add* calls
+    // are describing the fine level.
+    bool building_fine;
+
+    // Which of the two shape sets the Bullet collision object currently exposes.
+    bool fine_active;
+
+    // Flag for sharing identical convex hull shapes across models (see EnableSharedShapeCache).
+    static bool use_shape_cache;
+
+    // Absolute origin of the Bullet world this model lives in, assigned by the
+    // collision system (see ChCollisionSystemBullet::SetCollisionOrigin).
+    // SyncPosition() subtracts it, in double, before truncating to btScalar.
+    ChVector<> col_origin;
+
   public:
     ChModelBullet();
     virtual ~ChModelBullet();
@@ -267,6 +286,37 @@ class ChApi ChModelBullet : public ChCollisionModel {
     /// It can also change the outward envelope; the inward margin is automatically the radius of the sphere.
     bool SetSphereRadius(double coll_radius, double out_envelope);
 
+    /// If the collision shape is a compound of sub-shapes, rebalance the dynamic
+    /// AABB tree used by Bullet as midphase over the children, so that narrowphase
+    /// queries traverse a compact tree instead of a degenerate one. This is called
+    /// automatically by BuildModel(); call it again after editing sub-shapes
+    /// (e.g. via updateChildTransform on the underlying btCompoundShape).
+    void RebuildChildAabbTree();
+
+    /// Begin the definition of an alternate fine level of detail.
+    /// Call it between ClearModel() and BuildModel(), after having described the
+    /// default (coarse) geometry: the subsequent Add* calls then describe the fine
+    /// level, and BuildModel() finalizes both levels leaving the coarse one active.
+    /// The collision system switches a model to its fine level only while the
+    /// broadphase reports proximity to another model that also has a fine level
+    /// (with hysteresis, see ChCollisionSystemBullet::SetLODDeactivationDelay), so
+    /// expensive meshes are paid for only at the active contact interfaces. The
+    /// coarse geometry should enclose the fine one: the proximity test runs on
+    /// whichever level is currently active.
+    void BeginFineDetail();
+
+    /// Return true if this model defines a fine level of detail.
+    bool HasFineDetail() const { return !shapes_fine.empty(); }
+
+    /// Return true if the fine level of detail is the one currently exposed
+    /// to collision detection.
+    bool IsFineDetailActive() const { return fine_active; }
+
+    /// Expose the fine (or coarse) level of detail to collision detection.
+    /// Called by the collision system, which also drops the cached contact
+    /// pairs of this model; no-op for models without a fine level.
+    void SetFineDetailActive(bool fine);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -276,8 +326,31 @@ class ChApi ChModelBullet : public ChCollisionModel {
     /// Return the pointer to the Bullet model
     btCollisionObject* GetBulletModel() { return this->bt_collision_object; }
 
+    /// Set the absolute origin of the Bullet world this model lives in. Called by
+    /// ChCollisionSystemBullet; users should call SetCollisionOrigin() on the
+    /// collision system instead, which keeps all models and the reported contact
+    /// points consistent.
+    void SetCollisionOrigin(const ChVector<>& origin) { col_origin = origin; }
+
+    /// Enable/disable the shared convex hull shape cache (disabled by default).
+    /// When enabled, AddConvexHull() hashes the input point cloud (plus the collision
+    /// margins, which are baked into the Bullet shape) and reuses a single
+    /// btConvexHullShape across all collision models that pass an identical hull.
+    /// Since AddTriangleMeshConcaveDecomposed() adds its hulls through AddConvexHull(),
+    /// bodies instancing the same decomposed mesh automatically share both the hull
+    /// computation and the Bullet shapes, instead of duplicating them per body.
+    /// Note that the cache is not protected by locks: build collision models from a
+    /// single thread when this is enabled.
+    static void EnableSharedShapeCache(bool val);
+
+    /// Purge the shared convex hull shape cache. Shapes still referenced by existing
+    /// collision models stay alive (they are shared pointers); only the cache entries
+    /// keeping unused shapes in memory are released.
+    static void ClearSharedShapeCache();
+
   private:
     void _injectShape(const ChVector<>& pos, const ChMatrix33<>& rot, btCollisionShape* mshape);
+    void _injectShape(const ChVector<>& pos, const ChMatrix33<>& rot, std::shared_ptr<btCollisionShape> mshape);
 
     void onFamilyChange();
 
@@ -140,6 +140,12 @@ void ChBezierCurve::setPoints(const std::vector<ChVector<> >& points,
     m_points = points;
     m_inCV = inCV;
     m_outCV = outCV;
+
+    // The sample table, if any, refers to the previous geometry.
+    m_lut_points.clear();
+    m_lut_interval.clear();
+    m_lut_param.clear();
+    m_lut_length.clear();
 }
 
 // Utility function for solving the tridiagonal system for one of the
@@ -400,6 +406,69 @@ ChVector<> ChBezierCurve::calcClosestPoint(const ChVector<>& loc, size_t i, doub
     return Q;
 }
 
+// -----------------------------------------------------------------------------
+// ChBezierCurve::buildSampleTable()
+// ChBezierCurve::findNearestSample()
+//
+// These functions build and query a table of points sampled uniformly in
+// parameter within each interval of the curve, together with the cumulative
+// arc length of the resulting polyline. The table provides fine-grained
+// initial guesses for the Newton iterations in calcClosestPoint.
+// -----------------------------------------------------------------------------
+void ChBezierCurve::buildSampleTable(size_t samplesPerInterval) {
+    assert(samplesPerInterval > 0);
+    size_t numIntervals = getNumPoints() - 1;
+    size_t numSamples = numIntervals * samplesPerInterval + 1;
+
+    m_lut_points.resize(numSamples);
+    m_lut_interval.resize(numSamples);
+    m_lut_param.resize(numSamples);
+    m_lut_length.resize(numSamples);
+
+    size_t is = 0;
+    double length = 0;
+    for (size_t i = 0; i < numIntervals; i++) {
+        for (size_t j = 0; j < samplesPerInterval; j++, is++) {
+            double t = double(j) / samplesPerInterval;
+            ChVector<> p = eval(i, t);
+            if (is > 0)
+                length += (p - m_lut_points[is - 1]).Length();
+            m_lut_points[is] = p;
+            m_lut_interval[is] = i;
+            m_lut_param[is] = t;
+            m_lut_length[is] = length;
+        }
+    }
+
+    // Close the table with the last knot point.
+    ChVector<> p = eval(numIntervals - 1, 1.0);
+    length += (p - m_lut_points[is - 1]).Length();
+    m_lut_points[is] = p;
+    m_lut_interval[is] = numIntervals - 1;
+    m_lut_param[is] = 1;
+    m_lut_length[is] = length;
+}
+
+bool ChBezierCurve::findNearestSample(const ChVector<>& loc, size_t& interval, double& t) const {
+    if (m_lut_points.empty())
+        return false;
+
+    size_t best = 0;
+    double best_dist2 = (loc - m_lut_points[0]).Length2();
+    for (size_t is = 1; is < m_lut_points.size(); is++) {
+        double dist2 = (loc - m_lut_points[is]).Length2();
+        if (dist2 < best_dist2) {
+            best_dist2 = dist2;
+            best = is;
+        }
+    }
+
+    interval = m_lut_interval[best];
+    t = m_lut_param[best];
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 
 void ChBezierCurve::ArchiveOUT(ChArchiveOut& marchive)
@@ -453,6 +522,11 @@ static bool comparePoints(const PointSpec& p1, const PointSpec& p2) {
 }
 
 void ChBezierCurveTracker::reset(const ChVector<>& loc) {
+    // If the curve carries a sample table, use the nearest sample as a
+    // fine-grained initial guess.
+    if (m_path->findNearestSample(loc, m_curInterval, m_curParam))
+        return;
+
     // Walk all curve points and calculate the distance to the specified reset
     // location, then sort them in increasing order.
     std::vector<PointSpec> points;
@@ -588,6 +662,25 @@ int ChBezierCurveTracker::calcClosestPoint(const ChVector<>& loc, ChFrame<>& tnb
     return flag;
 }
 
+// -----------------------------------------------------------------------------
+// ChBezierCurveTracker::calcClosestPoints()
+//
+// Batched version of the closest point calculation: the specified trackers are
+// queried with the corresponding locations in parallel. The queries are
+// independent since each tracker only updates its own hint state.
+// -----------------------------------------------------------------------------
+void ChBezierCurveTracker::calcClosestPoints(const std::vector<ChBezierCurveTracker*>& trackers,
+                                             const std::vector<ChVector<> >& locs,
+                                             std::vector<ChVector<> >& points) {
+    assert(trackers.size() == locs.size());
+    points.resize(locs.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)trackers.size(); i++) {
+        trackers[i]->calcClosestPoint(locs[i], points[i]);
+    }
+}
+
 // -----------------------------------------------------------------------------
 // ChBezierCurveTracker::setIsClosedPath()
 //
@@ -129,6 +129,25 @@ class ChApi ChBezierCurve {
     /// to the closest point.
     ChVector<> calcClosestPoint(const ChVector<>& loc, size_t i, double& t) const;
 
+    /// Build a table of samples along the curve, used to speed up localization.
+    /// The table stores, for samples taken uniformly in parameter within each
+    /// interval, the sample point together with its interval index, curve
+    /// parameter, and cumulative (approximate) arc length. When available, a
+    /// ChBezierCurveTracker uses this table to obtain a fine-grained initial
+    /// guess in reset(), instead of scanning only the knot points.
+    void buildSampleTable(size_t samplesPerInterval = 8);
+
+    /// Find the curve sample closest to the specified location.
+    /// This function scans the sample table (see buildSampleTable) and returns
+    /// the interval index and curve parameter of the nearest sample. It returns
+    /// false if the sample table was not built.
+    bool findNearestSample(const ChVector<>& loc, size_t& interval, double& t) const;
+
+    /// Return the approximate arc length of the curve.
+    /// This is the length of the sampled polyline (see buildSampleTable);
+    /// it returns 0 if the sample table was not built.
+    double getPathLength() const { return m_lut_length.empty() ? 0 : m_lut_length.back(); }
+
     /// Write the knots and control points to the specified file.
     void write(const std::string& filename);
 
@@ -166,6 +185,11 @@ class ChApi ChBezierCurve {
     std::vector<ChVector<> > m_inCV;    ///< set on "incident" control points
     std::vector<ChVector<> > m_outCV;   ///< set of "outgoing" control points
 
+    std::vector<ChVector<> > m_lut_points;  ///< sampled points (see buildSampleTable)
+    std::vector<size_t> m_lut_interval;     ///< interval index of each sample
+    std::vector<double> m_lut_param;        ///< curve parameter of each sample
+    std::vector<double> m_lut_length;       ///< cumulative arc length at each sample
+
     static const size_t m_maxNumIters;  ///< maximum number of Newton iterations
     static const double m_sqrDistTol;   ///< tolerance on squared distance
     static const double m_cosAngleTol;  ///< tolerance for orthogonality test
@@ -214,6 +238,17 @@ class ChApi ChBezierCurveTracker {
     /// In such cases, we return an orthonormal frame with X axis along the tangent.
     int calcClosestPoint(const ChVector<>& loc, ChFrame<>& tnb, double& curvature);
 
+    /// Calculate the closest points for a batch of trackers.
+    /// This function performs the specified tracker queries in parallel and is
+    /// intended for scenarios with many concurrent path followers (each with
+    /// its own tracker). The i-th tracker is queried with the i-th location and
+    /// the corresponding closest point is stored in the i-th output entry; the
+    /// trackers need not refer to the same underlying curve, but must all be
+    /// distinct objects.
+    static void calcClosestPoints(const std::vector<ChBezierCurveTracker*>& trackers,
+                                  const std::vector<ChVector<> >& locs,
+                                  std::vector<ChVector<> >& points);
+
     /// Set if the path is treated as an open loop or a closed loop for tracking
     void setIsClosedPath(bool isClosedPath);
 
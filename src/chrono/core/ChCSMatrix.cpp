@@ -13,6 +13,8 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <iomanip>
 
 #include "chrono/core/ChCSMatrix.h"
@@ -73,6 +75,80 @@ void ChCSMatrix::SetElement(int row_sel, int col_sel, double insval, bool overwr
     values[trail_i] = insval;
 }
 
+void ChCSMatrix::PasteBlock(const ChMatrix<>& block,
+                            const std::vector<int>& rows,
+                            const std::vector<int>& cols,
+                            bool overwrite) {
+    // The row-sweep optimization below assumes row-major storage; fall back to the
+    // generic scalar scatter for CSC matrices.
+    if (!row_major_format) {
+        ChSparseMatrix::PasteBlock(block, rows, cols, overwrite);
+        return;
+    }
+
+    for (auto i = 0; i < (int)rows.size(); ++i) {
+        auto lead_sel = rows[i];
+        if (lead_sel < 0)
+            continue;
+
+        // Position in the destination row from which the search for the next element
+        // resumes; reset whenever the block columns are not in increasing order.
+        int trail_i = leadIndex[lead_sel];
+        int trail_sel_prev = -1;
+
+        for (auto j = 0; j < (int)cols.size(); ++j) {
+            auto trail_sel = cols[j];
+            if (trail_sel < 0)
+                continue;
+
+            double insval = block.GetElement(i, j);
+            if (insval == 0 && !m_lock)
+                continue;
+
+            if (trail_sel <= trail_sel_prev)
+                trail_i = leadIndex[lead_sel];
+            trail_sel_prev = trail_sel;
+
+            for (; trail_i < leadIndex[lead_sel + 1]; ++trail_i) {
+                // not-initialized space: the element can be placed here
+                if (!initialized_element[trail_i]) {
+                    initialized_element[trail_i] = true;
+                    trailIndex[trail_i] = trail_sel;
+                    values[trail_i] = insval;
+                    break;
+                }
+
+                // an element with greater index is already stored: insertion needed
+                if (trailIndex[trail_i] > trail_sel) {
+                    insert(trail_i, lead_sel);
+                    initialized_element[trail_i] = true;
+                    trailIndex[trail_i] = trail_sel;
+                    values[trail_i] = insval;
+                    break;
+                }
+
+                // the requested element already exists
+                if (trailIndex[trail_i] == trail_sel) {
+                    (overwrite) ? values[trail_i] = insval : values[trail_i] += insval;
+                    break;
+                }
+            }
+
+            // 'row full': make space right at the end of the row
+            if (trail_i == leadIndex[lead_sel + 1]) {
+                insert(trail_i, lead_sel);
+                initialized_element[trail_i] = true;
+                trailIndex[trail_i] = trail_sel;
+                values[trail_i] = insval;
+            }
+
+            // the next element of the block row has a greater column index, so the
+            // search can resume right after the element just written
+            ++trail_i;
+        }
+    }
+}
+
 double ChCSMatrix::GetElement(int row_sel, int col_sel) const {
     auto lead_sel = row_major_format ? row_sel : col_sel;
     auto trail_sel = row_major_format ? col_sel : row_sel;
@@ -129,7 +205,7 @@ void ChCSMatrix::Reset(int nrows, int ncols, int nonzeros_hint) {
 
     if (nonzeros_hint == 0 && lead_dim_new == *leading_dimension && trail_dim_new == *trailing_dimension && m_lock &&
         lead_dim_new != 0 && trail_dim_new != 0) {
-        std::fill(values.begin(), values.begin() + leadIndex[*leading_dimension] - 1, 0);
+        std::fill(values.begin(), values.begin() + leadIndex[*leading_dimension], 0);
     } else {
         if (nonzeros_hint == 0)
             nonzeros_hint = GetTrailingIndexLength();
@@ -839,4 +915,500 @@ void ChCSMatrix::ForEachExistentValueThatMeetsRequirement(std::function<void(int
     }
 }
 
+// -----------------------------------------------------------------------------
+// Direct solution of linear systems
+//
+// Same pivoting strategy and error reporting as the ChLinkedListMatrix solvers,
+// but the factors live in contiguous, column-sorted per-row arrays: the fill-in
+// of an elimination step is handled with a single two-pointer merge of the
+// pivot row into the target row, instead of element-wise list insertions.
+// -----------------------------------------------------------------------------
+
+#define PIVOT_ACCEPT_TRESHOLD 0.8
+#define ACCEPT_PIVOT 1e-3
+#define MIN_PIVOT 1e-8
+#define INFINITE_PIVOT 1.e+34
+
+// (internal) Load the factor rows from the CS arrays; only the upper triangular
+// part is loaded if 'upper_only' (as needed by the LDL factorization).
+void ChCSMatrix::fact_load(bool upper_only) {
+    fact_rows.assign(m_num_rows, fact_row_t());
+    for (auto lead_i = 0; lead_i < *leading_dimension; lead_i++) {
+        for (auto trail_i = leadIndex[lead_i]; trail_i < leadIndex[lead_i + 1]; trail_i++) {
+            if (!initialized_element[trail_i] || !values[trail_i])
+                continue;
+            int row_sel = row_major_format ? lead_i : trailIndex[trail_i];
+            int col_sel = row_major_format ? trailIndex[trail_i] : lead_i;
+            if (upper_only && col_sel < row_sel)
+                continue;
+            // in both storage orders the entries of a given row come out with
+            // increasing column index, so the factor rows are already sorted
+            fact_rows[row_sel].push_back(fact_entry_t(col_sel, values[trail_i]));
+        }
+    }
+    fact_upper_only = upper_only;
+    fact_levels_valid = false;
+}
+
+// (internal) Build the level-set schedule of the current factors for the
+// parallel substitutions. The strictly lower triangular part of the factors is
+// first gathered in row form (for the LDL factors, whose rows hold only the
+// upper triangular part, this is a transposition). The level of a row is one
+// more than the highest level among the rows it depends on, so the rows of one
+// level can be processed in any order - and in parallel - once the previous
+// levels are done. The same is done backward for the upper triangular part.
+void ChCSMatrix::fact_build_levels() {
+    // Gather the strictly lower factor entries by row.
+    fact_rows_lower.assign(m_num_rows, fact_row_t());
+    for (int k = 0; k < m_num_rows; k++) {
+        if (fact_upper_only) {
+            // each target row receives its entries with ascending column index
+            // because of the ascending outer loop, so the rows stay sorted
+            for (auto it = fact_rows[k].rbegin(); it != fact_rows[k].rend() && it->first >= k + 1; ++it)
+                fact_rows_lower[it->first].push_back(fact_entry_t(k, it->second));
+        } else {
+            for (auto it = fact_rows[k].begin(); it != fact_rows[k].end() && it->first < k; ++it)
+                fact_rows_lower[k].push_back(*it);
+        }
+    }
+
+    std::vector<int> level(m_num_rows);
+
+    // Forward levels, from the lower triangular dependencies.
+    int num_levels = 0;
+    for (int k = 0; k < m_num_rows; k++) {
+        int lev = 0;
+        for (auto it = fact_rows_lower[k].begin(); it != fact_rows_lower[k].end(); ++it)
+            lev = std::max(lev, level[it->first] + 1);
+        level[k] = lev;
+        num_levels = std::max(num_levels, lev + 1);
+    }
+
+    // Bucket the rows by level with a counting sort (stable, so the schedule
+    // is deterministic for a given factorization).
+    fact_level_ptr_fwd.assign(num_levels + 1, 0);
+    for (int k = 0; k < m_num_rows; k++)
+        fact_level_ptr_fwd[level[k] + 1]++;
+    for (int lev = 0; lev < num_levels; lev++)
+        fact_level_ptr_fwd[lev + 1] += fact_level_ptr_fwd[lev];
+    fact_level_rows_fwd.resize(m_num_rows);
+    std::vector<int> cursor(fact_level_ptr_fwd.begin(), fact_level_ptr_fwd.end() - 1);
+    for (int k = 0; k < m_num_rows; k++)
+        fact_level_rows_fwd[cursor[level[k]]++] = k;
+
+    // Backward levels, from the strictly upper triangular dependencies.
+    num_levels = 0;
+    for (int k = m_num_rows - 1; k >= 0; k--) {
+        int lev = 0;
+        for (auto it = fact_rows[k].rbegin(); it != fact_rows[k].rend() && it->first >= k + 1; ++it)
+            lev = std::max(lev, level[it->first] + 1);
+        level[k] = lev;
+        num_levels = std::max(num_levels, lev + 1);
+    }
+
+    fact_level_ptr_bwd.assign(num_levels + 1, 0);
+    for (int k = 0; k < m_num_rows; k++)
+        fact_level_ptr_bwd[level[k] + 1]++;
+    for (int lev = 0; lev < num_levels; lev++)
+        fact_level_ptr_bwd[lev + 1] += fact_level_ptr_bwd[lev];
+    fact_level_rows_bwd.resize(m_num_rows);
+    cursor.assign(fact_level_ptr_bwd.begin(), fact_level_ptr_bwd.end() - 1);
+    for (int k = 0; k < m_num_rows; k++)
+        fact_level_rows_bwd[cursor[level[k]]++] = k;
+
+    fact_levels_valid = true;
+}
+
+// (internal) Get an element of the factor rows (0 if not stored).
+double ChCSMatrix::fact_get(int row, int col) const {
+    const fact_row_t& frow = fact_rows[row];
+    auto it = std::lower_bound(frow.begin(), frow.end(), col,
+                               [](const fact_entry_t& entry, int col_sel) { return entry.first < col_sel; });
+    return (it != frow.end() && it->first == col) ? it->second : 0;
+}
+
+// (internal) Set an element of the factor rows, inserting it if not stored yet.
+void ChCSMatrix::fact_set(int row, int col, double val) {
+    fact_row_t& frow = fact_rows[row];
+    auto it = std::lower_bound(frow.begin(), frow.end(), col,
+                               [](const fact_entry_t& entry, int col_sel) { return entry.first < col_sel; });
+    if (it != frow.end() && it->first == col)
+        it->second = val;
+    else
+        frow.insert(it, fact_entry_t(col, val));
+}
+
+// (internal) Elimination step: subtract r times the entries of 'pivot_row' with
+// column >= 'from_col' from row 'row_sel', whose leading entries are preserved.
+// Fill-in is handled by merging the two sorted rows in a single sweep.
+void ChCSMatrix::fact_eliminate(int row_sel, int from_col, const fact_row_t& pivot_row, double r) {
+    fact_row_t& frow = fact_rows[row_sel];
+    fact_row_t merged;
+    merged.reserve(frow.size() + pivot_row.size());
+
+    auto it_a = frow.begin();
+    for (; it_a != frow.end() && it_a->first < from_col; ++it_a)
+        merged.push_back(*it_a);
+    auto it_b = std::lower_bound(pivot_row.begin(), pivot_row.end(), from_col,
+                                 [](const fact_entry_t& entry, int col_sel) { return entry.first < col_sel; });
+
+    while (it_a != frow.end() || it_b != pivot_row.end()) {
+        if (it_b == pivot_row.end() || (it_a != frow.end() && it_a->first < it_b->first)) {
+            merged.push_back(*it_a);
+            ++it_a;
+        } else if (it_a == frow.end() || it_b->first < it_a->first) {
+            merged.push_back(fact_entry_t(it_b->first, -r * it_b->second));
+            ++it_b;
+        } else {
+            merged.push_back(fact_entry_t(it_a->first, it_a->second - r * it_b->second));
+            ++it_a;
+            ++it_b;
+        }
+    }
+
+    frow.swap(merged);
+}
+
+// Support function for LU factorization
+int ChCSMatrix::fact_best_pivot_row(int current) const {
+    double temp = 0;
+    int pivotrow = current;
+
+    for (int i = current; i < m_num_rows; i++) {
+        double val = fabs(fact_get(i, current));
+        if (val > temp) {
+            temp = val;
+            pivotrow = i;
+        }
+        if (temp >= PIVOT_ACCEPT_TRESHOLD)
+            break;
+    }
+    return pivotrow;
+}
+
+// Support function for LDL factorization
+int ChCSMatrix::fact_best_pivot_diag(int current) const {
+    double temp = 0;
+    int pivotrow = current;
+
+    for (int i = current; i < m_num_rows; i++) {
+        if (fabs(fact_get(i, i)) > temp) {
+            temp = fabs(fact_get(i, i));
+            pivotrow = i;
+        }
+        if (temp >= PIVOT_ACCEPT_TRESHOLD)
+            break;
+    }
+    return pivotrow;
+}
+
+// Support function for LDL factorization
+// Effect only on upper-left triangle!
+void ChCSMatrix::fact_diag_pivot_symmetric(int rowA, int rowB) {
+    auto swap_entries = [this](int row1, int col1, int row2, int col2) {
+        double val1 = fact_get(row1, col1);
+        double val2 = fact_get(row2, col2);
+        if (val1 == val2)
+            return;
+        fact_set(row1, col1, val2);
+        fact_set(row2, col2, val1);
+    };
+    for (int elrow = 0; elrow < rowA; elrow++)
+        swap_entries(elrow, rowA, elrow, rowB);
+    for (int elcol = rowB + 1; elcol < m_num_cols; elcol++)
+        swap_entries(rowA, elcol, rowB, elcol);
+    for (int elcol = rowA + 1; elcol < rowB; elcol++)
+        swap_entries(rowA, elcol, elcol, rowB);
+    swap_entries(rowA, rowA, rowB, rowB);
+}
+
+// LU factorization
+int ChCSMatrix::Setup_LU() {
+    assert(m_num_rows == m_num_cols);
+
+    int err = 0;
+
+    fact_load(false);
+
+    // initialize pivot index array
+    m_pindices.resize(m_num_rows);
+    for (int ind = 0; ind < m_num_rows; ind++) {
+        m_pindices[ind] = ind;
+    }
+
+    m_determinant = 1;
+
+    for (int k = 1; k < m_num_rows; k++) {
+        double pivot = fact_get(k - 1, k - 1);
+
+        if (fabs(pivot) < ACCEPT_PIVOT) {
+            // pivoting is needed, so swap equations
+            int pivrow = fact_best_pivot_row(k - 1);
+            fact_rows[k - 1].swap(fact_rows[pivrow]);
+            m_determinant *= -1;
+
+            std::swap(m_pindices[k - 1], m_pindices[pivrow]);
+
+            pivot = fact_get(k - 1, k - 1);  // fetch new pivot
+        }
+
+        // was unable to find better pivot: force solution to zero, and go ahead
+        if (fabs(pivot) <= MIN_PIVOT) {
+            pivot = INFINITE_PIVOT;
+            fact_set(k - 1, k - 1, pivot);
+            if (!err) {
+                m_determinant = 0;
+                err = (1 + m_num_rows - k);  // report deficiency
+            }
+        } else {
+            m_determinant *= pivot;
+        }
+
+        for (int i = k; i < m_num_rows; i++) {
+            double leader = fact_get(i, k - 1);
+
+            if (leader) {
+                double r = leader / pivot;            // compute multiplier
+                fact_set(i, k - 1, r);                // store the multiplier in L part!!!
+                fact_eliminate(i, k, fact_rows[k - 1], r);  // update the U part of row i
+            }
+        }
+    }
+
+    double pivot = fact_get(m_num_rows - 1, m_num_rows - 1);
+    if (fabs(pivot) <= MIN_PIVOT) {
+        pivot = INFINITE_PIVOT;
+        fact_set(m_num_rows - 1, m_num_rows - 1, pivot);
+        if (!err) {
+            m_determinant = 0;
+            err = 1;
+        }
+    } else {
+        m_determinant *= pivot;
+    }
+
+    return err;
+}
+
+// Substitution using existing LU factorization
+void ChCSMatrix::Solve_LU(const ChMatrix<>& b, ChMatrix<>& x) const {
+    assert(m_num_rows == b.GetRows());
+    assert(m_num_cols == x.GetRows());
+
+    // BACKWARD substitution - L
+    x.SetElement(0, 0, b.GetElement(m_pindices[0], 0));
+
+    for (int k = 1; k < m_num_rows; k++) {
+        double sum = 0;
+        for (auto it = fact_rows[k].begin(); it != fact_rows[k].end() && it->first < k; ++it) {
+            sum += it->second * x.GetElement(it->first, 0);
+        }
+        x.SetElement(k, 0, b.GetElement(m_pindices[k], 0) - sum);
+    }
+
+    // BACKWARD substitution - U
+    x.SetElement(m_num_rows - 1, 0, x.GetElement(m_num_rows - 1, 0) / fact_get(m_num_rows - 1, m_num_rows - 1));
+
+    for (int k = m_num_rows - 2; k >= 0; k--) {
+        double sum = 0;
+        for (auto it = fact_rows[k].rbegin(); it != fact_rows[k].rend() && it->first >= k + 1; ++it) {
+            sum += it->second * x.GetElement(it->first, 0);
+        }
+        x.SetElement(k, 0, (x.GetElement(k, 0) - sum) / fact_get(k, k));
+    }
+}
+
+// LU Factorization + substitution
+int ChCSMatrix::SolveGeneral(const ChMatrix<>& b, ChMatrix<>& x) {
+    int err = Setup_LU();
+    Solve_LU(b, x);
+    return err;
+}
+
+// Substitution using existing LU factorization, with each level set of rows
+// swept in parallel (rows of one level do not depend on each other).
+void ChCSMatrix::Solve_LU_Parallel(const ChMatrix<>& b, ChMatrix<>& x) {
+    assert(m_num_rows == b.GetRows());
+    assert(m_num_cols == x.GetRows());
+
+    if (!fact_levels_valid)
+        fact_build_levels();
+
+    // FORWARD substitution - L (unit diagonal)
+    for (int lev = 0; lev < (int)fact_level_ptr_fwd.size() - 1; lev++) {
+#pragma omp parallel for
+        for (int p = fact_level_ptr_fwd[lev]; p < fact_level_ptr_fwd[lev + 1]; p++) {
+            int k = fact_level_rows_fwd[p];
+            double sum = 0;
+            for (auto it = fact_rows_lower[k].begin(); it != fact_rows_lower[k].end(); ++it)
+                sum += it->second * x.GetElement(it->first, 0);
+            x.SetElement(k, 0, b.GetElement(m_pindices[k], 0) - sum);
+        }
+    }
+
+    // BACKWARD substitution - U
+    for (int lev = 0; lev < (int)fact_level_ptr_bwd.size() - 1; lev++) {
+#pragma omp parallel for
+        for (int p = fact_level_ptr_bwd[lev]; p < fact_level_ptr_bwd[lev + 1]; p++) {
+            int k = fact_level_rows_bwd[p];
+            double sum = 0;
+            for (auto it = fact_rows[k].rbegin(); it != fact_rows[k].rend() && it->first >= k + 1; ++it)
+                sum += it->second * x.GetElement(it->first, 0);
+            x.SetElement(k, 0, (x.GetElement(k, 0) - sum) / fact_get(k, k));
+        }
+    }
+}
+
+// LDL decomposition (only upper triangular part of A is used)
+int ChCSMatrix::Setup_LDL() {
+    assert(m_num_rows == m_num_cols);
+
+    int err = 0;
+
+    fact_load(true);
+
+    // initialize pivot index array
+    m_pindices.resize(m_num_rows);
+    for (int ind = 0; ind < m_num_rows; ind++) {
+        m_pindices[ind] = ind;
+    }
+
+    m_determinant = 1;
+
+    for (int k = 1; k < m_num_rows; k++) {
+        double pivot = fact_get(k - 1, k - 1);
+
+        if (fabs(pivot) < ACCEPT_PIVOT) {
+            // pivoting is needed, so ...
+            int pivrow = fact_best_pivot_diag(k - 1);
+            fact_diag_pivot_symmetric(k - 1, pivrow);  // swap both column and row (only upper right!)
+            m_determinant *= -1;
+
+            std::swap(m_pindices[k - 1], m_pindices[pivrow]);
+
+            pivot = fact_get(k - 1, k - 1);
+        }
+
+        // was unable to find better pivot: force solution to zero, and go ahead
+        if (fabs(pivot) <= MIN_PIVOT) {
+            pivot = INFINITE_PIVOT;
+            fact_set(k - 1, k - 1, pivot);
+            if (!err) {
+                m_determinant = 0;
+                err = (1 + m_num_rows - k);
+            }
+        } else {
+            m_determinant *= pivot;
+        }
+
+        for (int i = k; i < m_num_rows; i++) {
+            double leader = fact_get(k - 1, i);
+
+            if (leader) {
+                double r = leader / pivot;                  // compute multiplier (mirror look A)
+                fact_eliminate(i, i, fact_rows[k - 1], r);  // only upper right part of row i
+                fact_set(k - 1, i, r);  // now can store the multiplier in L part (mirror look! is up)
+            }
+        }
+    }
+
+    double pivot = fact_get(m_num_rows - 1, m_num_rows - 1);
+    if (fabs(pivot) <= MIN_PIVOT) {
+        pivot = INFINITE_PIVOT;
+        fact_set(m_num_rows - 1, m_num_rows - 1, pivot);
+        if (!err) {
+            m_determinant = 0;
+            err = 1;
+        }
+    } else {
+        m_determinant *= pivot;
+    }
+
+    return err;
+}
+
+// Substitution using existing LDL factorization
+void ChCSMatrix::Solve_LDL(const ChMatrix<>& b, ChMatrix<>& x) const {
+    assert(m_num_rows == b.GetRows());
+    assert(m_num_rows == x.GetRows());
+
+    // BACKWARD substitution - L
+    // Swept by columns of L, i.e. by the stored rows of L', so that each factor
+    // row is traversed contiguously (x(j) is final when its column is processed).
+    for (int k = 0; k < m_num_rows; k++) {
+        x.SetElement(m_pindices[k], 0, b.GetElement(m_pindices[k], 0));
+    }
+    for (int j = 0; j < m_num_rows - 1; j++) {
+        double xval = x.GetElement(m_pindices[j], 0);
+        if (xval) {
+            for (auto it = fact_rows[j].rbegin(); it != fact_rows[j].rend() && it->first >= j + 1; ++it) {
+                x.SetElement(m_pindices[it->first], 0,
+                             x.GetElement(m_pindices[it->first], 0) - it->second * xval);
+            }
+        }
+    }
+
+    // BACKWARD substitution - D
+    for (int k = 0; k < m_num_rows; k++) {
+        x.SetElement(m_pindices[k], 0, x.GetElement(m_pindices[k], 0) / fact_get(k, k));
+    }
+
+    // BACKWARD substitution - L'
+    for (int k = m_num_rows - 2; k >= 0; k--) {
+        double sum = 0;
+        for (auto it = fact_rows[k].rbegin(); it != fact_rows[k].rend() && it->first >= k + 1; ++it) {
+            sum += it->second * x.GetElement(m_pindices[it->first], 0);
+        }
+        x.SetElement(m_pindices[k], 0, x.GetElement(m_pindices[k], 0) - sum);
+    }
+}
+
+// LDL Factorization + substitution
+int ChCSMatrix::SolveSymmetric(const ChMatrix<>& b, ChMatrix<>& x) {
+    int err = Setup_LDL();
+    Solve_LDL(b, x);
+    return err;
+}
+
+// Substitution using existing LDL factorization, with each level set of rows
+// swept in parallel. The forward sweep works on the row form of L built by
+// fact_build_levels() (the stored factor rows hold L', i.e. the columns of L).
+void ChCSMatrix::Solve_LDL_Parallel(const ChMatrix<>& b, ChMatrix<>& x) {
+    assert(m_num_rows == b.GetRows());
+    assert(m_num_rows == x.GetRows());
+
+    if (!fact_levels_valid)
+        fact_build_levels();
+
+    // FORWARD substitution - L (unit diagonal)
+    for (int lev = 0; lev < (int)fact_level_ptr_fwd.size() - 1; lev++) {
+#pragma omp parallel for
+        for (int p = fact_level_ptr_fwd[lev]; p < fact_level_ptr_fwd[lev + 1]; p++) {
+            int k = fact_level_rows_fwd[p];
+            double sum = 0;
+            for (auto it = fact_rows_lower[k].begin(); it != fact_rows_lower[k].end(); ++it)
+                sum += it->second * x.GetElement(m_pindices[it->first], 0);
+            x.SetElement(m_pindices[k], 0, b.GetElement(m_pindices[k], 0) - sum);
+        }
+    }
+
+    // BACKWARD substitution - D
+#pragma omp parallel for
+    for (int k = 0; k < m_num_rows; k++) {
+        x.SetElement(m_pindices[k], 0, x.GetElement(m_pindices[k], 0) / fact_get(k, k));
+    }
+
+    // BACKWARD substitution - L'
+    for (int lev = 0; lev < (int)fact_level_ptr_bwd.size() - 1; lev++) {
+#pragma omp parallel for
+        for (int p = fact_level_ptr_bwd[lev]; p < fact_level_ptr_bwd[lev + 1]; p++) {
+            int k = fact_level_rows_bwd[p];
+            double sum = 0;
+            for (auto it = fact_rows[k].rbegin(); it != fact_rows[k].rend() && it->first >= k + 1; ++it)
+                sum += it->second * x.GetElement(m_pindices[it->first], 0);
+            x.SetElement(m_pindices[k], 0, x.GetElement(m_pindices[k], 0) - sum);
+        }
+    }
+}
+
 }  // end namespace chrono
@@ -142,6 +142,36 @@ class ChApi ChCSMatrix : public ChSparseMatrix {
 
     bool m_lock_broken = false;  ///< true if a modification was made that overrules m_lock
 
+    // Direct factorization working data (see #Setup_LU() and #Setup_LDL()).
+    // The factors are kept apart from the CS arrays, in contiguous per-row vectors,
+    // so the matrix itself is left untouched by the factorization.
+    typedef std::pair<int, double> fact_entry_t;  ///< (column index, value) entry of a factor row
+    typedef std::vector<fact_entry_t> fact_row_t; ///< factor row; kept sorted by column index
+    std::vector<fact_row_t> fact_rows;            ///< rows of the LU|LDL factors
+    std::vector<int> m_pindices;                  ///< pivot permutation of the last factorization
+    double m_determinant = 0;                     ///< determinant computed by the last factorization
+
+    // Level-set schedule of the factor rows, for the parallel substitutions
+    // (see #fact_build_levels()). Built on the first parallel solve after a
+    // factorization and reused by every later solve with the same factors.
+    std::vector<fact_row_t> fact_rows_lower;  ///< strictly lower factor entries, by row (transposed from the upper part for LDL)
+    std::vector<int> fact_level_rows_fwd;     ///< rows ordered by forward-substitution level
+    std::vector<int> fact_level_ptr_fwd;      ///< start of each level in #fact_level_rows_fwd
+    std::vector<int> fact_level_rows_bwd;     ///< rows ordered by backward-substitution level
+    std::vector<int> fact_level_ptr_bwd;      ///< start of each level in #fact_level_rows_bwd
+    bool fact_upper_only = false;             ///< the factor rows hold only the upper triangular part (LDL)
+    bool fact_levels_valid = false;           ///< the schedule matches the current factors
+
+    // (internal) support functions for the direct factorizations
+    void fact_load(bool upper_only);
+    void fact_build_levels();
+    double fact_get(int row, int col) const;
+    void fact_set(int row, int col, double val);
+    void fact_eliminate(int row_sel, int from_col, const fact_row_t& pivot_row, double r);
+    int fact_best_pivot_row(int current) const;
+    int fact_best_pivot_diag(int current) const;
+    void fact_diag_pivot_symmetric(int rowA, int rowB);
+
   protected:
     /// (internal) The \a vector elements will contain equally spaced indexes, going from \a initial_number to \a
     /// final_number.
@@ -188,6 +218,16 @@ class ChApi ChCSMatrix : public ChSparseMatrix {
 
     double GetElement(int row_sel, int col_sel) const override;
 
+    /// Scatter a dense block into \a this matrix (see ChSparseMatrix::PasteBlock()).
+    /// For a row-major matrix, each block row is scattered with a single sweep over the
+    /// destination row: since the block columns are typically in increasing order, the
+    /// search for each element resumes from the position of the previous one, instead of
+    /// rescanning the row from its beginning as the scalar #SetElement() does.
+    void PasteBlock(const ChMatrix<>& block,
+                    const std::vector<int>& rows,
+                    const std::vector<int>& cols,
+                    bool overwrite = true) override;
+
     /// Create the element with index (\a row_sel, \a col_sel) (if it doesn't exist) and return its reference.
     double& Element(int row_sel, int col_sel);
 
@@ -264,6 +304,51 @@ class ChApi ChCSMatrix : public ChSparseMatrix {
     /// -4 - error message: trailIndex has not ascending indexes within the rows (CSR) | columns (CSC)\n
     int VerifyMatrix() const;
 
+    // Direct solution of linear systems.
+    // Same API and pivoting strategy as the ChLinkedListMatrix solvers, but the factorization
+    // works on contiguous, sorted per-row arrays instead of per-element linked lists, so the
+    // sweeps of the elimination and of the substitutions are cache friendly.
+
+    /// Perform the LU factorization of the matrix, with partial (row) pivoting.
+    /// The factors are stored in working arrays and the matrix itself is not modified.
+    /// Return 0 if successful, or the rank deficiency counted from the first forced pivot.
+    int Setup_LU();
+
+    /// Solve the system A*x=b, using the LU factors of a previous call to #Setup_LU().
+    void Solve_LU(const ChMatrix<>& b, ChMatrix<>& x) const;
+
+    /// Solve the general system A*x=b (LU factorization followed by substitution).
+    int SolveGeneral(const ChMatrix<>& b, ChMatrix<>& x);
+
+    /// Perform the LDL factorization of a symmetric matrix, with diagonal pivoting.
+    /// Only the upper triangular part of the matrix is used; the factors are stored in
+    /// working arrays and the matrix itself is not modified.
+    /// Return 0 if successful, or the rank deficiency counted from the first forced pivot.
+    int Setup_LDL();
+
+    /// Solve the symmetric system A*x=b, using the LDL factors of a previous call to #Setup_LDL().
+    void Solve_LDL(const ChMatrix<>& b, ChMatrix<>& x) const;
+
+    /// Solve the symmetric system A*x=b (LDL factorization followed by substitution).
+    int SolveSymmetric(const ChMatrix<>& b, ChMatrix<>& x);
+
+    /// Solve the system A*x=b using the LU factors of a previous call to #Setup_LU(),
+    /// with the forward and backward substitutions run in parallel.
+    /// The factor rows are grouped into level sets - groups whose rows do not depend
+    /// on each other - and each level is swept with an OpenMP loop. The schedule is
+    /// computed on the first call after a factorization and reused by every later
+    /// solve with the same factors, so its cost is paid once per factorization, not
+    /// once per right-hand side. Worthwhile for large systems solved repeatedly
+    /// (e.g. triangular solves of a preconditioner); for small systems prefer #Solve_LU().
+    void Solve_LU_Parallel(const ChMatrix<>& b, ChMatrix<>& x);
+
+    /// Solve the symmetric system A*x=b using the LDL factors of a previous call to
+    /// #Setup_LDL(), with level-scheduled parallel substitutions (see #Solve_LU_Parallel()).
+    void Solve_LDL_Parallel(const ChMatrix<>& b, ChMatrix<>& x);
+
+    /// Get the determinant computed by the last factorization.
+    double GetDeterminant() const { return m_determinant; }
+
     // Import/Export functions
     /// Import data from separated file (a.dat, ia.dat, ja.dat) given the format.
     void ImportFromDatFile(std::string filepath = "", bool row_major_format_on = true);
@@ -23,6 +23,9 @@
 
 #if defined(CHRONO_HAS_SSE) || defined(CHRONO_HAS_AVX)
 #include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #endif
 
 #if defined(CHRONO_HAS_NEON)
@@ -53,6 +56,28 @@ namespace chrono {
 template <class Real = double>
 class ChMatrixDynamic;
 
+#ifdef CHRONO_HAS_AVX
+
+/// Run-time check for AVX support on the host CPU.
+/// The library can be distributed in binary form to machines older than the build
+/// machine, so the vectorized kernels must not be entered on CPUs lacking AVX even
+/// if CHRONO_HAS_AVX was set at configuration time. The result is cached after the
+/// first call.
+inline bool ChCpuHasAVX() {
+#if defined(_MSC_VER)
+    static bool has_avx = []() {
+        int cpu_info[4];
+        __cpuid(cpu_info, 1);
+        return (cpu_info[2] & (1 << 28)) != 0;
+    }();
+#else
+    static bool has_avx = __builtin_cpu_supports("avx") != 0;
+#endif
+    return has_avx;
+}
+
+#endif
+
 ///
 /// ChMatrix:
 ///
@@ -483,6 +508,16 @@ class ChMatrix {
             ElementN(nel) += (Real)matra.ElementN(nel);
     }
 
+    /// Increments this matrix with another matrix A scaled by a factor, as: [this]+=[A]*f
+    /// Fused equivalent of the operator form [this] = [this] + [A]*f, without the
+    /// temporary: one streaming pass over both arrays.
+    template <class RealB>
+    void MatrIncScaled(const ChMatrix<RealB>& matra, Real factor) {
+        assert(matra.GetColumns() == columns && matra.GetRows() == rows);
+        for (int nel = 0; nel < rows * columns; ++nel)
+            ElementN(nel) += (Real)(matra.ElementN(nel) * factor);
+    }
+
     /// Increments this matrix by \p val, as [this]+=val
     void MatrInc(Real val) {
         for (int nel = 0; nel < rows * columns; ++nel)
@@ -545,6 +580,26 @@ class ChMatrix {
         }
     }
 
+    /// Multiplies two matrices, and increments "this" matrix with the result: [this]+=[A]*[B].
+    /// This product-accumulate form avoids the temporary that an expression
+    /// like 'this += A * B' would otherwise allocate.
+    template <class RealB, class RealC>
+    void MatrMultiplyAdd(const ChMatrix<RealB>& matra, const ChMatrix<RealC>& matrb) {
+        assert(matra.GetColumns() == matrb.GetRows());
+        assert(this->rows == matra.GetRows());
+        assert(this->columns == matrb.GetColumns());
+        int col, row, colres;
+        Real sum;
+        for (colres = 0; colres < matrb.GetColumns(); ++colres) {
+            for (row = 0; row < matra.GetRows(); ++row) {
+                sum = 0;
+                for (col = 0; col < matra.GetColumns(); ++col)
+                    sum += (Real)(matra.Element(row, col) * matrb.Element(col, colres));
+                Element(row, colres) += sum;
+            }
+        }
+    }
+
 #ifdef CHRONO_HAS_AVX
     /// Multiplies two matrices, and stores the result in "this" matrix: [this]=[A]*[B].
     /// AVX implementation: The speed up is marginal if size of the matrices are small, e.g. 3*3
@@ -559,18 +614,131 @@ class ChMatrix {
         int B_NCol = matrb.GetColumns();
         const double* A_add = matra.GetAddress();
         const double* B_add = matrb.GetAddress();
-        double* this_Add = this->GetAddress();
+        double* this_Add = (double*)this->GetAddress();
+        int CorrectFAT = ((B_NCol >> 2) << 2);
         for (int rowA = 0; rowA < A_Nrow; rowA++) {
-            for (int colB = 0; colB < B_NCol; colB += 4) {
+            for (int colB = 0; colB < CorrectFAT; colB += 4) {
                 __m256d sum = _mm256_setzero_pd();
                 for (int elem = 0; elem < A_NCol; elem++) {
                     __m256d ymmA = _mm256_broadcast_sd(A_add + A_NCol * rowA + elem);
                     __m256d ymmB = _mm256_loadu_pd(B_add + elem * B_NCol + colB);
+#ifdef CHRONO_HAS_FMA
+                    sum = _mm256_fmadd_pd(ymmA, ymmB, sum);
+#else
                     __m256d prod = _mm256_mul_pd(ymmA, ymmB);
                     sum = _mm256_add_pd(sum, prod);
+#endif
                 }
                 _mm256_storeu_pd(this_Add + rowA * B_NCol + colB, sum);
             }
+            // scalar tail for matrices whose column count is not a multiple of 4
+            for (int colB = CorrectFAT; colB < B_NCol; colB++) {
+                double temp_sum = 0.0;
+                for (int elem = 0; elem < A_NCol; elem++)
+                    temp_sum += matra.Element(rowA, elem) * matrb.Element(elem, colB);
+                this_Add[rowA * B_NCol + colB] = temp_sum;
+            }
+        }
+    }
+
+    /// Fused multiply-add helper for the AVX kernels: returns a*b+c, as a single
+    /// FMA instruction when the build enables it.
+    static __m256d MatrFMA(__m256d a, __m256d b, __m256d c) {
+#ifdef CHRONO_HAS_FMA
+        return _mm256_fmadd_pd(a, b, c);
+#else
+        return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+    }
+
+    /// Multiplies two matrices with register blocking: [this]=[A]*[B].
+    /// BLIS-style micro-kernel: a 4x8 tile of the result stays in eight ymm
+    /// accumulators while the k loop streams four broadcast values of A against an
+    /// 8-wide panel of B, so each B load is reused across four result rows instead
+    /// of one. The outer loop runs over 8-wide column panels, keeping the active
+    /// k-by-8 slice of B L1-resident across all row tiles. Intended for the
+    /// mid-size products of FEA jacobian assembly (roughly 24..120 on a side),
+    /// where the plain row-at-a-time AVX kernel is bound on B bandwidth; below
+    /// that the simpler kernels win, and far above it an L2-blocked BLAS would.
+    void MatrMultiplyBlockedAVX(const ChMatrix<double>& matra, const ChMatrix<double>& matrb) {
+        assert(matra.GetColumns() == matrb.GetRows());
+        assert(this->rows == matra.GetRows());
+        assert(this->columns == matrb.GetColumns());
+        int M = matra.GetRows();
+        int K = matra.GetColumns();
+        int N = matrb.GetColumns();
+        const double* A_add = matra.GetAddress();
+        const double* B_add = matrb.GetAddress();
+        double* this_Add = (double*)this->GetAddress();
+        int N8 = N & ~7;
+        for (int jc = 0; jc < N8; jc += 8) {
+            int ir = 0;
+            for (; ir + 4 <= M; ir += 4) {
+                const double* a0 = A_add + (ir + 0) * K;
+                const double* a1 = A_add + (ir + 1) * K;
+                const double* a2 = A_add + (ir + 2) * K;
+                const double* a3 = A_add + (ir + 3) * K;
+                __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+                __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+                __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+                __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+                const double* bk = B_add + jc;
+                for (int k = 0; k < K; k++, bk += N) {
+                    __m256d b0 = _mm256_loadu_pd(bk);
+                    __m256d b1 = _mm256_loadu_pd(bk + 4);
+                    __m256d a = _mm256_broadcast_sd(a0 + k);
+                    c00 = MatrFMA(a, b0, c00);
+                    c01 = MatrFMA(a, b1, c01);
+                    a = _mm256_broadcast_sd(a1 + k);
+                    c10 = MatrFMA(a, b0, c10);
+                    c11 = MatrFMA(a, b1, c11);
+                    a = _mm256_broadcast_sd(a2 + k);
+                    c20 = MatrFMA(a, b0, c20);
+                    c21 = MatrFMA(a, b1, c21);
+                    a = _mm256_broadcast_sd(a3 + k);
+                    c30 = MatrFMA(a, b0, c30);
+                    c31 = MatrFMA(a, b1, c31);
+                }
+                double* crow = this_Add + ir * N + jc;
+                _mm256_storeu_pd(crow, c00);
+                _mm256_storeu_pd(crow + 4, c01);
+                _mm256_storeu_pd(crow + N, c10);
+                _mm256_storeu_pd(crow + N + 4, c11);
+                _mm256_storeu_pd(crow + 2 * N, c20);
+                _mm256_storeu_pd(crow + 2 * N + 4, c21);
+                _mm256_storeu_pd(crow + 3 * N, c30);
+                _mm256_storeu_pd(crow + 3 * N + 4, c31);
+            }
+            // 1x8 kernel for the up to three leftover rows
+            for (; ir < M; ir++) {
+                const double* arow = A_add + ir * K;
+                __m256d c0 = _mm256_setzero_pd(), c1 = _mm256_setzero_pd();
+                const double* bk = B_add + jc;
+                for (int k = 0; k < K; k++, bk += N) {
+                    __m256d a = _mm256_broadcast_sd(arow + k);
+                    c0 = MatrFMA(a, _mm256_loadu_pd(bk), c0);
+                    c1 = MatrFMA(a, _mm256_loadu_pd(bk + 4), c1);
+                }
+                _mm256_storeu_pd(this_Add + ir * N + jc, c0);
+                _mm256_storeu_pd(this_Add + ir * N + jc + 4, c1);
+            }
+        }
+        // column tail (up to seven columns): 4-wide then scalar, per row
+        for (int row = 0; row < M; row++) {
+            int colB = N8;
+            for (; colB + 4 <= N; colB += 4) {
+                __m256d sum = _mm256_setzero_pd();
+                for (int elem = 0; elem < K; elem++)
+                    sum = MatrFMA(_mm256_broadcast_sd(A_add + row * K + elem),
+                                  _mm256_loadu_pd(B_add + elem * N + colB), sum);
+                _mm256_storeu_pd(this_Add + row * N + colB, sum);
+            }
+            for (; colB < N; colB++) {
+                double temp_sum = 0.0;
+                for (int elem = 0; elem < K; elem++)
+                    temp_sum += matra.Element(row, elem) * matrb.Element(elem, colB);
+                this_Add[row * N + colB] = temp_sum;
+            }
         }
     }
 
@@ -597,8 +765,12 @@ class ChMatrix {
                 for (colB = 0; colB < CorrectFAT; colB += 4) {
                     __m256d ymmA = _mm256_loadu_pd(A_add + rowA * A_NCol + colB);
                     __m256d ymmB = _mm256_loadu_pd(B_add + rowB * B_NCol + colB);
+#ifdef CHRONO_HAS_FMA
+                    sum = _mm256_fmadd_pd(ymmA, ymmB, sum);
+#else
                     __m256d prod = _mm256_mul_pd(ymmA, ymmB);
                     sum = _mm256_add_pd(sum, prod);
+#endif
                 }
                 sum = _mm256_hadd_pd(sum, sum);
                 temp_sum = ((double*)&sum)[0] + ((double*)&sum)[2];
@@ -611,6 +783,131 @@ class ChMatrix {
         }
     }
 
+    /// Multiplies two matrices (the first is considered transposed): [this]=[A]'*[B]
+    /// AVX implementation. Vectorizes along the columns of B, so it behaves like
+    /// MatrMultiplyAVX: the wider B is, the better the speedup. This is the kernel
+    /// underlying the  [B]'*[D]*[B]  products of element stiffness assembly.
+    void MatrTMultiplyAVX(const ChMatrix<double>& matra, const ChMatrix<double>& matrb) {
+        assert(matra.GetRows() == matrb.GetRows());
+        assert(this->rows == matra.GetColumns());
+        assert(this->columns == matrb.GetColumns());
+        int A_Nrow = matra.GetRows();
+        int A_NCol = matra.GetColumns();
+        int B_NCol = matrb.GetColumns();
+        const double* A_add = matra.GetAddress();
+        const double* B_add = matrb.GetAddress();
+        double* this_Add = (double*)this->GetAddress();
+        int CorrectFAT = ((B_NCol >> 2) << 2);
+        for (int rowR = 0; rowR < A_NCol; rowR++) {
+            for (int colB = 0; colB < CorrectFAT; colB += 4) {
+                __m256d sum = _mm256_setzero_pd();
+                for (int elem = 0; elem < A_Nrow; elem++) {
+                    __m256d ymmA = _mm256_broadcast_sd(A_add + A_NCol * elem + rowR);
+                    __m256d ymmB = _mm256_loadu_pd(B_add + elem * B_NCol + colB);
+#ifdef CHRONO_HAS_FMA
+                    sum = _mm256_fmadd_pd(ymmA, ymmB, sum);
+#else
+                    __m256d prod = _mm256_mul_pd(ymmA, ymmB);
+                    sum = _mm256_add_pd(sum, prod);
+#endif
+                }
+                _mm256_storeu_pd(this_Add + rowR * B_NCol + colB, sum);
+            }
+            // scalar tail for matrices whose column count is not a multiple of 4
+            for (int colB = CorrectFAT; colB < B_NCol; colB++) {
+                double temp_sum = 0.0;
+                for (int elem = 0; elem < A_Nrow; elem++)
+                    temp_sum += matra.Element(elem, rowR) * matrb.Element(elem, colB);
+                this_Add[rowR * B_NCol + colB] = temp_sum;
+            }
+        }
+    }
+
+    /// Increments this matrix with another matrix A, as: [this]+=[A]
+    /// AVX implementation, processing four doubles per iteration.
+    void MatrIncAVX(const ChMatrix<double>& matra) {
+        assert(matra.GetColumns() == columns && matra.GetRows() == rows);
+        int nels = rows * columns;
+        const double* A_add = matra.GetAddress();
+        double* this_Add = (double*)this->GetAddress();
+        int CorrectFAT = ((nels >> 2) << 2);
+        int nel;
+        for (nel = 0; nel < CorrectFAT; nel += 4) {
+            __m256d ymmT = _mm256_loadu_pd(this_Add + nel);
+            __m256d ymmA = _mm256_loadu_pd(A_add + nel);
+            _mm256_storeu_pd(this_Add + nel, _mm256_add_pd(ymmT, ymmA));
+        }
+        for (; nel < nels; nel++)
+            this_Add[nel] += A_add[nel];
+    }
+
+    /// Increments this matrix with another matrix A scaled by a factor: [this]+=[A]*f
+    /// AVX implementation: a single fused multiply-add stream over both arrays,
+    /// processing four doubles per iteration.
+    void MatrIncScaledAVX(const ChMatrix<double>& matra, double factor) {
+        assert(matra.GetColumns() == columns && matra.GetRows() == rows);
+        int nels = rows * columns;
+        const double* A_add = matra.GetAddress();
+        double* this_Add = (double*)this->GetAddress();
+        __m256d ymmF = _mm256_set1_pd(factor);
+        int CorrectFAT = ((nels >> 2) << 2);
+        int nel;
+        for (nel = 0; nel < CorrectFAT; nel += 4) {
+            __m256d ymmT = _mm256_loadu_pd(this_Add + nel);
+            __m256d ymmA = _mm256_loadu_pd(A_add + nel);
+#ifdef CHRONO_HAS_FMA
+            ymmT = _mm256_fmadd_pd(ymmA, ymmF, ymmT);
+#else
+            ymmT = _mm256_add_pd(ymmT, _mm256_mul_pd(ymmA, ymmF));
+#endif
+            _mm256_storeu_pd(this_Add + nel, ymmT);
+        }
+        for (; nel < nels; nel++)
+            this_Add[nel] += A_add[nel] * factor;
+    }
+
+    /// Overload for double operands, dispatching at run time to the AVX kernels
+    /// when the host CPU supports them and the product is large enough to benefit.
+    /// Small products (e.g. the ubiquitous 3x3 ones) stay on the scalar path,
+    /// where the vectorization overhead is not paid back; mid-size products (all
+    /// dimensions at least 8, as in FEA element jacobian assembly) take the
+    /// register-blocked kernel, the rest the row-at-a-time one.
+    void MatrMultiply(const ChMatrix<double>& matra, const ChMatrix<double>& matrb) {
+        if (sizeof(Real) == sizeof(double) && ChCpuHasAVX() && matrb.GetColumns() >= 4) {
+            if (matra.GetRows() >= 8 && matra.GetColumns() >= 8 && matrb.GetColumns() >= 8)
+                MatrMultiplyBlockedAVX(matra, matrb);
+            else
+                MatrMultiplyAVX(matra, matrb);
+        } else {
+            MatrMultiply<double, double>(matra, matrb);
+        }
+    }
+
+    /// Overload for double operands, dispatching at run time to the AVX kernel.
+    /// See the MatrMultiply overload for the dispatch policy.
+    void MatrTMultiply(const ChMatrix<double>& matra, const ChMatrix<double>& matrb) {
+        if (sizeof(Real) == sizeof(double) && ChCpuHasAVX() && matrb.GetColumns() >= 4)
+            MatrTMultiplyAVX(matra, matrb);
+        else
+            MatrTMultiply<double, double>(matra, matrb);
+    }
+
+    /// Overload for double operands, dispatching at run time to the AVX kernel.
+    void MatrInc(const ChMatrix<double>& matra) {
+        if (sizeof(Real) == sizeof(double) && ChCpuHasAVX() && rows * columns >= 8)
+            MatrIncAVX(matra);
+        else
+            MatrInc<double>(matra);
+    }
+
+    /// Overload for double operands, dispatching at run time to the AVX kernel.
+    void MatrIncScaled(const ChMatrix<double>& matra, double factor) {
+        if (sizeof(Real) == sizeof(double) && ChCpuHasAVX() && rows * columns >= 8)
+            MatrIncScaledAVX(matra, factor);
+        else
+            MatrIncScaled<double>(matra, (Real)factor);
+    }
+
 #endif
 
 #ifdef CHRONO_HAS_NEON
@@ -687,6 +984,27 @@ class ChMatrix {
         }
     }
 
+    /// Multiplies two matrices (the first is considered transposed) and increments
+    /// "this" matrix with the result: [this]+=[A]'*[B].
+    /// Product-accumulate form for congruence products such as [K]+=[B]'*[E][B],
+    /// which would otherwise allocate a temporary per product.
+    template <class RealB, class RealC>
+    void MatrTMultiplyAdd(const ChMatrix<RealB>& matra, const ChMatrix<RealC>& matrb) {
+        assert(matra.GetRows() == matrb.GetRows());
+        assert(this->rows == matra.GetColumns());
+        assert(this->columns == matrb.GetColumns());
+        int col, row, colres;
+        Real sum;
+        for (colres = 0; colres < matrb.GetColumns(); ++colres) {
+            for (row = 0; row < matra.GetColumns(); ++row) {
+                sum = 0;
+                for (col = 0; col < (matra.GetRows()); ++col)
+                    sum += (Real)(matra.Element(col, row) * matrb.Element(col, colres));
+                Element(row, colres) += sum;
+            }
+        }
+    }
+
     /// Computes dot product between two column-matrices (vectors) with
     /// same size. Returns a scalar value.
     template <class RealB, class RealC>
@@ -71,6 +71,19 @@ class ChMatrixDynamic : public ChMatrix<Real> {
             this->address[i] = (Real)msource.GetAddress()[i];
     }
 
+    /// Move constructor.
+    /// Steals the heap buffer of the source, which is left as an empty 0x0 matrix.
+    /// Lets expressions returning temporaries (e.g. operator+ and operator*)
+    /// hand over their result without an extra allocation and copy.
+    ChMatrixDynamic(ChMatrixDynamic<Real>&& msource) {
+        this->rows = msource.rows;
+        this->columns = msource.columns;
+        this->address = msource.address;
+        msource.rows = 0;
+        msource.columns = 0;
+        msource.address = NULL;
+    }
+
     /// Copy constructor from all types of base matrices
     template <class RealB>
     ChMatrixDynamic(const ChMatrix<RealB>& msource) {
@@ -113,6 +126,28 @@ class ChMatrixDynamic : public ChMatrix<Real> {
         return *this;
     }
 
+    /// Copy assignment operator.
+    /// (Must be spelled out since declaring the move operations suppresses it.)
+    ChMatrixDynamic<Real>& operator=(const ChMatrixDynamic<Real>& matbis) {
+        ChMatrix<Real>::operator=(matbis);
+        return *this;
+    }
+
+    /// Move assignment operator.
+    /// Steals the heap buffer of the source, which is left as an empty 0x0 matrix.
+    ChMatrixDynamic<Real>& operator=(ChMatrixDynamic<Real>&& matbis) {
+        if (this != &matbis) {
+            delete[] this->address;
+            this->rows = matbis.rows;
+            this->columns = matbis.columns;
+            this->address = matbis.address;
+            matbis.rows = 0;
+            matbis.columns = 0;
+            matbis.address = NULL;
+        }
+        return *this;
+    }
+
     /// Negates sign of the matrix.
     /// Performance warning: a new object is created.
     ChMatrixDynamic<Real> operator-() const {
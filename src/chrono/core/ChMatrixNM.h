@@ -156,6 +156,36 @@ class ChMatrixNM : public ChMatrix<Real> {
     // FUNCTIONS
     //
 
+    /// Compile-time number of rows of the preallocated buffer.
+    static constexpr int StaticRows = preall_rows;
+    /// Compile-time number of columns of the preallocated buffer.
+    static constexpr int StaticColumns = preall_columns;
+
+    /// Access a single element, using the compile-time size and the stack
+    /// buffer directly. Unlike Element(), this bypasses the 'address'
+    /// pointer indirection of the base class, so the compiler can keep the
+    /// buffer in registers and vectorize loops over the elements.
+    /// Must not be used after a Resize() to a larger-than-NxM size.
+    inline Real& ElementS(int row, int col) {
+        assert(this->address == buffer);
+        return buffer[preall_columns * row + col];
+    }
+    inline const Real& ElementS(int row, int col) const {
+        assert(this->address == buffer);
+        return buffer[preall_columns * row + col];
+    }
+
+    /// Access the n-th element in the stack buffer, row-major.
+    /// Same remarks as for ElementS().
+    inline Real& ElementSN(int index) {
+        assert(this->address == buffer);
+        return buffer[index];
+    }
+    inline const Real& ElementSN(int index) const {
+        assert(this->address == buffer);
+        return buffer[index];
+    }
+
     /// Resize for this matrix is NOT SUPPORTED ! DO NOTHING!
     virtual inline void Resize(int nrows, int ncols) { assert((nrows == this->rows) && (ncols == this->columns)); }
 };
@@ -0,0 +1,91 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHMATRIXVIEW_H
+#define CHMATRIXVIEW_H
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+///
+/// ChMatrixView
+///
+///  Lightweight non-owning matrix that aliases a contiguous block of memory
+/// owned by someone else: a row range of another matrix, a segment of a long
+/// column vector, or a plain array. Since it derives from ChMatrix, a view is
+/// accepted by every function taking a ChMatrix argument (the Multiply/Add
+/// kernels, the Paste functions, the solver interfaces, ...), so such
+/// operations can read and write the aliased memory in place instead of going
+/// through PasteMatrix/PasteClippedMatrix copies to and from temporaries.
+///  The viewed block must be contiguous: a row range of a (row-major) matrix,
+/// always full-width; note that a single row, as well as any segment of an
+/// Nx1 vector, trivially satisfies this.
+///  The view performs no allocation and no deallocation; it is up to the
+/// caller to guarantee that the viewed memory outlives the view (beware of
+/// resizing the viewed matrix). Copy construction aliases the same memory;
+/// assignment from a matrix copies values into the viewed memory.
+
+template <class Real = double>
+class ChMatrixView : public ChMatrix<Real> {
+  public:
+    //
+    // CONSTRUCTORS
+    //
+
+    /// View over a raw contiguous buffer of 'nrows' x 'ncols' elements,
+    /// stored row by row.
+    ChMatrixView(Real* data, const int nrows, const int ncols) {
+        assert(nrows >= 0 && ncols >= 0);
+        this->address = data;
+        this->rows = nrows;
+        this->columns = ncols;
+    }
+
+    /// View over the full-width row range [start_row, start_row + num_rows)
+    /// of another matrix. For an Nx1 matrix (a vector) this is a segment.
+    ChMatrixView(ChMatrix<Real>& source, const int start_row, const int num_rows) {
+        assert(start_row >= 0 && num_rows >= 0 && start_row + num_rows <= source.GetRows());
+        this->address = source.GetAddress() + start_row * source.GetColumns();
+        this->rows = num_rows;
+        this->columns = source.GetColumns();
+    }
+
+    /// Copy constructor: the new view aliases the same memory.
+    ChMatrixView(const ChMatrixView<Real>& source) {
+        this->address = const_cast<Real*>(source.GetAddress());
+        this->rows = source.GetRows();
+        this->columns = source.GetColumns();
+    }
+
+    //
+    // OPERATORS
+    //
+
+    /// Assignment operator (from generic other matrix): copies the values
+    /// into the viewed memory (sizes must match, a view cannot be resized).
+    ChMatrixView<Real>& operator=(const ChMatrix<Real>& matbis) {
+        ChMatrix<Real>::operator=(matbis);
+        return *this;
+    }
+
+    //
+    // FUNCTIONS
+    //
+
+    /// A view cannot be resized: the requested size must match the viewed block.
+    virtual void Resize(int nrows, int ncols) override { assert(nrows == this->rows && ncols == this->columns); }
+};
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cmath>
+#include <thread>
+
+#include "chrono/core/ChRealtimeScheduler.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+ChRealtimeScheduler::ChRealtimeScheduler(double time_scale)
+    : time_scale(time_scale),
+      spin_window(2e-3),
+      catchup_threshold(0.05),
+      catching_up(false),
+      saved_update_assets(true) {
+    Reset();
+}
+
+void ChRealtimeScheduler::Reset() {
+    start_time = std::chrono::steady_clock::now();
+    sim_elapsed = 0;
+    lag = 0;
+    last_jitter = 0;
+    max_jitter = 0;
+    jitter_abs_sum = 0;
+    num_overruns = 0;
+    num_steps = 0;
+    // note: a pending catch-up state is kept, so that a Reset() issued while
+    // asset updates are suspended still restores them at the next Advance()
+}
+
+double ChRealtimeScheduler::Elapsed() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+}
+
+void ChRealtimeScheduler::WaitUntil(double deadline) {
+    auto target = start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                   std::chrono::duration<double>(deadline));
+
+    // sleep up to the beginning of the spin window, then spin to the deadline
+    auto spin_start = target - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                   std::chrono::duration<double>(spin_window));
+    if (std::chrono::steady_clock::now() < spin_start)
+        std::this_thread::sleep_until(spin_start);
+    while (std::chrono::steady_clock::now() < target) {
+    }
+}
+
+double ChRealtimeScheduler::GetMeanJitter() const {
+    return num_steps ? jitter_abs_sum / num_steps : 0.0;
+}
+
+bool ChRealtimeScheduler::Advance(ChSystem& system, double step) {
+    // Catch-up policy: while behind by more than the threshold, suspend the
+    // visualization-only asset updates of the system; restore the previous
+    // setting as soon as the schedule is caught up.
+    if (catching_up && (lag <= 0 || catchup_threshold <= 0)) {
+        system.SetUpdateAssets(saved_update_assets);
+        catching_up = false;
+    } else if (!catching_up && catchup_threshold > 0 && lag > catchup_threshold) {
+        saved_update_assets = system.GetUpdateAssets();
+        system.SetUpdateAssets(false);
+        catching_up = true;
+    }
+
+    system.DoStepDynamics(step);
+    sim_elapsed += step;
+
+    double deadline = sim_elapsed / time_scale;
+    double now = Elapsed();
+    bool met = now <= deadline;
+
+    if (met) {
+        WaitUntil(deadline);
+        last_jitter = Elapsed() - deadline;  // wake-up error of the hybrid wait
+    } else {
+        last_jitter = now - deadline;  // overrun: release error equals the miss
+        num_overruns++;
+        if (overrun_callback)
+            overrun_callback(now - deadline);
+    }
+
+    lag = Elapsed() - deadline;
+    max_jitter = std::max(max_jitter, std::fabs(last_jitter));
+    jitter_abs_sum += std::fabs(last_jitter);
+    num_steps++;
+
+    return met;
+}
+
+}  // end namespace chrono
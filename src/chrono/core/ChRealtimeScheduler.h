@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHREALTIMESCHEDULER_H
+#define CHREALTIMESCHEDULER_H
+
+#include <chrono>
+#include <functional>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChSystem;  // forward declaration
+
+/// Real-time pacing scheduler for simulation loops.
+/// While ChRealtimeStepTimer only suggests step sizes, this object enforces an
+/// actual wall-clock pace, as needed e.g. in hardware-in-the-loop setups. Each
+/// call to Advance() integrates the system by one step and then waits until
+/// the wall-clock deadline of the accumulated simulated time, sleeping for
+/// most of the wait and spinning only over a short final window so the release
+/// time is accurate without burning a whole core. The scheduler keeps jitter
+/// statistics, reports missed deadlines through an optional callback, and can
+/// catch up after overruns by temporarily skipping the visualization-only
+/// asset updates of the system (see ChSystem::SetUpdateAssets).
+///
+/// Typical usage:
+///   ChRealtimeScheduler realtime;
+///   realtime.Reset();
+///   while (...) {
+///       realtime.Advance(my_system, 0.002);
+///   }
+class ChApi ChRealtimeScheduler {
+  public:
+    /// Create the scheduler. 'time_scale' is the ratio between simulated time
+    /// and real time (1 = real time, 2 = twice faster than real time).
+    ChRealtimeScheduler(double time_scale = 1);
+
+    /// Re-anchor the schedule to the current wall-clock time and zero the
+    /// statistics. Call it right before entering the simulation loop, and
+    /// again after any pause that should not be counted as an overrun.
+    void Reset();
+
+    /// Advance the system by 'step' simulated seconds, then wait until the
+    /// wall-clock deadline of the accumulated simulated time.
+    /// Returns true if the deadline was met, false on an overrun.
+    bool Advance(ChSystem& system, double step);
+
+    /// Set the ratio between simulated time and real time (default 1).
+    void SetTimeScale(double scale) { time_scale = scale; }
+
+    /// Set the final portion of each wait that is spun instead of slept
+    /// (default 2ms). Sleeping releases the core but wakes up with OS
+    /// scheduler granularity; widening the spin window improves the release
+    /// accuracy at the cost of CPU time.
+    void SetSpinWindow(double window) { spin_window = window; }
+
+    /// Set a function called whenever a deadline is missed, with the overrun
+    /// (in seconds) as argument.
+    void SetOverrunCallback(std::function<void(double)> callback) { overrun_callback = callback; }
+
+    /// Set the catch-up threshold (default 0.05s). Once the loop is behind its
+    /// schedule by more than this, the scheduler disables the system's
+    /// visualization asset updates (ChSystem::SetUpdateAssets) until the
+    /// schedule is caught up, then restores the previous setting.
+    /// Set a threshold <= 0 to disable the catch-up policy.
+    void SetCatchupThreshold(double threshold) { catchup_threshold = threshold; }
+
+    /// Lag of the simulation behind its schedule, in seconds (<= 0 if on time).
+    double GetLag() const { return lag; }
+
+    /// Release-time error of the last paced step, in seconds.
+    double GetLastJitter() const { return last_jitter; }
+
+    /// Largest absolute release-time error since the last Reset().
+    double GetMaxJitter() const { return max_jitter; }
+
+    /// Mean absolute release-time error since the last Reset().
+    double GetMeanJitter() const;
+
+    /// Number of missed deadlines since the last Reset().
+    unsigned int GetNumOverruns() const { return num_overruns; }
+
+    /// Number of paced steps since the last Reset().
+    unsigned int GetNumSteps() const { return num_steps; }
+
+  private:
+    /// Wall-clock seconds elapsed since the last Reset().
+    double Elapsed() const;
+
+    /// Hybrid sleep/spin wait until 'deadline' seconds after the last Reset().
+    void WaitUntil(double deadline);
+
+    std::chrono::steady_clock::time_point start_time;  ///< schedule anchor, set by Reset()
+
+    double time_scale;         ///< simulated over real time ratio
+    double spin_window;        ///< tail of each wait that is spun, in seconds
+    double catchup_threshold;  ///< lag that triggers the catch-up policy
+
+    std::function<void(double)> overrun_callback;  ///< called on missed deadlines
+
+    double sim_elapsed;        ///< simulated seconds accumulated since Reset()
+    double lag;                ///< current lag behind the schedule
+    double last_jitter;        ///< release error of the last step
+    double max_jitter;         ///< largest absolute release error
+    double jitter_abs_sum;     ///< running sum of absolute release errors
+    unsigned int num_overruns;
+    unsigned int num_steps;
+
+    bool catching_up;          ///< currently skipping asset updates
+    bool saved_update_assets;  ///< asset-update setting to restore after catch-up
+};
+
+}  // end namespace chrono
+
+#endif
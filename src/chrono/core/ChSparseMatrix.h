@@ -15,6 +15,8 @@
 #ifndef CHSPARSEMATRIX_H
 #define CHSPARSEMATRIX_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChMatrix.h"
 
@@ -146,6 +148,31 @@ public:
                 this->SetElement(insrow + i, inscol + j, matra.GetElement(i + cliprow, j + clipcol), overwrite);
     }
 
+    /// Scatter a dense block into \a this sparse matrix, mapping the i-th row of \a block
+    /// to row \a rows[i] and its j-th column to column \a cols[j] of this matrix.
+    /// A negative index in \a rows or \a cols skips the corresponding row or column of the
+    /// block (e.g. for inactive variables).
+    /// The default implementation scatters one scalar at a time through #SetElement();
+    /// a derived class can exploit its storage scheme to scatter entire block rows at once.
+    /// \param[in] block The dense source block;
+    /// \param[in] rows Row indexes in \a this matrix of the block rows (size = block.GetRows());
+    /// \param[in] cols Column indexes in \a this matrix of the block columns (size = block.GetColumns());
+    /// \param[in] overwrite Tells if the scattered elements will overwrite existing elements or be summed to them.
+    virtual void PasteBlock(const ChMatrix<>& block,
+                            const std::vector<int>& rows,
+                            const std::vector<int>& cols,
+                            bool overwrite = true) {
+        for (auto i = 0; i < (int)rows.size(); ++i) {
+            if (rows[i] < 0)
+                continue;
+            for (auto j = 0; j < (int)cols.size(); ++j) {
+                if (cols[j] < 0)
+                    continue;
+                this->SetElement(rows[i], cols[j], block.GetElement(i, j), overwrite);
+            }
+        }
+    }
+
     /// Return the row|column index array in the CSR|CSC representation of this matrix.
     virtual int* GetCS_LeadingIndexArray() const { return nullptr; }
 
@@ -10,6 +10,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <cstdarg>
 #include <cerrno>
@@ -23,6 +24,31 @@ namespace chrono {
 
 // ChStreamOutAscii
 
+// Fast integer->decimal conversion, in the style of C++17 to_chars: digits are
+// generated backwards in a scratch array and reversed into 'buffer', without
+// any locale or format string machinery. Returns the number of chars written.
+// This is several times cheaper than routing small integers through sprintf,
+// which matters for fine-grained serialization such as ChArchiveOutJSON.
+static size_t to_chars_unsigned(unsigned long long val, char* buffer) {
+    char scratch[20];
+    size_t n = 0;
+    do {
+        scratch[n++] = (char)('0' + (val % 10));
+        val /= 10;
+    } while (val);
+    for (size_t i = 0; i < n; i++)
+        buffer[i] = scratch[n - 1 - i];
+    return n;
+}
+
+static size_t to_chars_signed(long long val, char* buffer) {
+    if (val < 0) {
+        buffer[0] = '-';
+        return 1 + to_chars_unsigned((unsigned long long)(-(val + 1)) + 1, buffer + 1);
+    }
+    return to_chars_unsigned((unsigned long long)val, buffer);
+}
+
 ChStreamOutAscii& ChStreamOutAscii::operator<<(bool bVal) {
     if (bVal)
         Output("1", 1);
@@ -45,39 +71,31 @@ ChStreamOutAscii& ChStreamOutAscii::operator<<(const char* str) {
 }
 
 ChStreamOutAscii& ChStreamOutAscii::operator<<(int unVal) {
-    char buffer[100];
-
-    sprintf(buffer, "%d", unVal);
+    char buffer[24];
 
-    Output(buffer, strlen(buffer));
+    Output(buffer, to_chars_signed(unVal, buffer));
 
     return *this;
 }
 
 ChStreamOutAscii& ChStreamOutAscii::operator<<(unsigned int unVal) {
-    char buffer[100];
+    char buffer[24];
 
-    sprintf(buffer, "%u", unVal);
-
-    Output(buffer, strlen(buffer));
+    Output(buffer, to_chars_unsigned(unVal, buffer));
 
     return *this;
 }
 ChStreamOutAscii& ChStreamOutAscii::operator<<(unsigned long unVal) {
-    char buffer[100];
+    char buffer[24];
 
-    sprintf(buffer, "%lu", unVal);
-
-    Output(buffer, strlen(buffer));
+    Output(buffer, to_chars_unsigned(unVal, buffer));
 
     return *this;
 }
 ChStreamOutAscii& ChStreamOutAscii::operator<<(unsigned long long unVal) {
-    char buffer[100];
+    char buffer[24];
 
-    sprintf(buffer, "%llu", unVal);
-
-    Output(buffer, strlen(buffer));
+    Output(buffer, to_chars_unsigned(unVal, buffer));
 
     return *this;
 }
@@ -115,6 +133,16 @@ ChStreamOutAscii& ChStreamOutAscii::operator <<(unsigned long ulVal)
 ChStreamOutAscii& ChStreamOutAscii::operator<<(double dVal) {
     char buffer[100];
 
+    // Fast path for integral values small enough that the default "%g" prints
+    // them as plain digits (no exponent, no decimals): emit the digits
+    // directly. Zeros and small counters dominate typical state output, so
+    // this skips the sprintf call for most of the stream.
+    if (number_format[0] == '%' && number_format[1] == 'g' && number_format[2] == 0 && dVal > -1e6 && dVal < 1e6 &&
+        dVal == (double)(long long)dVal && !(dVal == 0 && std::signbit(dVal))) {
+        Output(buffer, to_chars_signed((long long)dVal, buffer));
+        return *this;
+    }
+
     sprintf(buffer, number_format, dVal);
 
     Output(buffer, strlen(buffer));
@@ -123,13 +151,7 @@ ChStreamOutAscii& ChStreamOutAscii::operator<<(double dVal) {
 }
 
 ChStreamOutAscii& ChStreamOutAscii::operator<<(float dVal) {
-    char buffer[100];
-
-    sprintf(buffer, number_format, ((double)dVal));
-
-    Output(buffer, strlen(buffer));
-
-    return *this;
+    return *this << (double)dVal;
 }
 
 void ChStreamOutAscii::Format(char* formatString, ...) {
@@ -801,6 +823,49 @@ ChStreamOutAsciiFile::ChStreamOutAsciiFile(const char* filename, std::ios::openm
 ChStreamOutAsciiFile::~ChStreamOutAsciiFile() {
 }
 
+ChStreamOutAsciiBufferedFile::ChStreamOutAsciiBufferedFile(const char* filename,
+                                                           std::ios::openmode mmode,
+                                                           size_t mcapacity)
+    : ChStreamOutAsciiFile(filename, mmode), arena(mcapacity > 0 ? mcapacity : 1), used(0) {}
+
+ChStreamOutAsciiBufferedFile::~ChStreamOutAsciiBufferedFile() {
+    if (used)
+        ChStreamFile::Write(&arena[0], used);
+}
+
+void ChStreamOutAsciiBufferedFile::Flush() {
+    if (used) {
+        ChStreamFile::Write(&arena[0], used);
+        used = 0;
+    }
+    ChStreamFile::Flush();
+}
+
+void ChStreamOutAsciiBufferedFile::Output(const char* data, size_t n) {
+    if (used + n > arena.size()) {
+        if (used) {
+            ChStreamFile::Write(&arena[0], used);
+            used = 0;
+        }
+        // tokens larger than the arena bypass it
+        if (n > arena.size()) {
+            ChStreamFile::Write(data, n);
+            return;
+        }
+    }
+    memcpy(&arena[used], data, n);
+    used += n;
+}
+
+ChStreamOutAsciiBuffer::ChStreamOutAsciiBuffer(size_t mcapacity) : arena(mcapacity > 0 ? mcapacity : 1), used(0) {}
+
+void ChStreamOutAsciiBuffer::Output(const char* data, size_t n) {
+    if (used + n > arena.size())
+        arena.resize(std::max(2 * arena.size(), used + n));
+    memcpy(&arena[used], data, n);
+    used += n;
+}
+
 ChStreamInBinaryFile::ChStreamInBinaryFile(const char* filename)
     : ChStreamFile(filename, std::ios::in | std::ios::binary) {
 }
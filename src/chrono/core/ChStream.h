@@ -795,6 +795,64 @@ class ChApi ChStreamOutAsciiFile : public ChStreamFile, public ChStreamOutAscii
     virtual void Output(const char* data, size_t n) { ChStreamFile::Write(data, n); }
 };
 
+///
+/// This is a specialized class for buffered ASCII output on system's file.
+/// The formatted characters accumulate in a memory arena, allocated once at
+/// construction, and reach the file in arena-sized blocks: when the arena is
+/// full, on Flush(), and at destruction. This removes the per-token stream
+/// call overhead of ChStreamOutAsciiFile, which dominates fine-grained
+/// serialization such as ChArchiveOutJSON writing many small fields.
+///
+
+class ChApi ChStreamOutAsciiBufferedFile : public ChStreamOutAsciiFile {
+  public:
+    ChStreamOutAsciiBufferedFile(const char* filename,
+                                 std::ios::openmode mmode = std::ios::trunc,
+                                 size_t mcapacity = 65536);
+
+    /// Destruction writes the pending arena content to the file.
+    virtual ~ChStreamOutAsciiBufferedFile();
+
+    /// Write the pending arena content to the file and synchronize the file.
+    virtual void Flush();
+
+  private:
+    virtual void Output(const char* data, size_t n);
+
+    std::vector<char> arena;  ///< pending output, allocated once at construction
+    size_t used;              ///< number of pending chars in the arena
+};
+
+///
+/// This is a specialized class for ASCII output into a memory arena, for
+/// consumers that ship the formatted text elsewhere (network telemetry,
+/// in-memory processing) without touching the filesystem. The arena is
+/// allocated once at construction and grows geometrically only if that
+/// initial estimate is exceeded; Rewind() recycles it, so writing the same
+/// record layout step after step does not allocate.
+///
+
+class ChApi ChStreamOutAsciiBuffer : public ChStreamOutAscii {
+  public:
+    ChStreamOutAsciiBuffer(size_t mcapacity = 65536);
+    virtual ~ChStreamOutAsciiBuffer() {}
+
+    /// Pointer to the formatted characters (not zero terminated).
+    const char* GetData() const { return arena.data(); }
+
+    /// Number of formatted characters in the arena.
+    size_t GetSize() const { return used; }
+
+    /// Forget the content, keeping the allocation for the next use.
+    void Rewind() { used = 0; }
+
+  private:
+    virtual void Output(const char* data, size_t n);
+
+    std::vector<char> arena;  ///< the formatted characters
+    size_t used;              ///< number of chars written so far
+};
+
 ///
 /// This is a specialized class for BINARY input on system's file,
 ///
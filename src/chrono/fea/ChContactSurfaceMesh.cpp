@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/collision/ChCModelBullet.h"
+#include "chrono/collision/ChCCollisionSystemBullet.h"
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChSystem.h"
 
@@ -904,12 +905,79 @@ unsigned int ChContactSurfaceMesh::GetNumVertices() const {
     return (unsigned int)(count + count_rot);
 }
 
+void ChContactSurfaceMesh::SetProximityPruning(bool val, double motion_threshold) {
+    prune_enabled = val;
+    prune_threshold = motion_threshold;
+    prune_last_pos.clear();
+
+    if (!val) {
+        // wake all faces so the collision engine refreshes their AABBs again
+        for (unsigned int j = 0; j < vfaces.size(); j++)
+            ((collision::ChModelBullet*)vfaces[j]->GetCollisionModel())->GetBulletModel()->setActivationState(ACTIVE_TAG);
+        for (unsigned int j = 0; j < vfaces_rot.size(); j++)
+            ((collision::ChModelBullet*)vfaces_rot[j]->GetCollisionModel())->GetBulletModel()->setActivationState(ACTIVE_TAG);
+    }
+}
+
 void ChContactSurfaceMesh::SurfaceSyncCollisionModels() {
-    for (unsigned int j = 0; j < vfaces.size(); j++) {
-        this->vfaces[j]->GetCollisionModel()->SyncPosition();
+    if (!prune_enabled) {
+        // Each face only writes its own collision model, so synchronize in parallel
+#pragma omp parallel for schedule(static)
+        for (int j = 0; j < (int)vfaces.size(); j++) {
+            this->vfaces[j]->GetCollisionModel()->SyncPosition();
+        }
+#pragma omp parallel for schedule(static)
+        for (int j = 0; j < (int)vfaces_rot.size(); j++) {
+            this->vfaces_rot[j]->GetCollisionModel()->SyncPosition();
+        }
+        return;
     }
-    for (unsigned int j = 0; j < vfaces_rot.size(); j++) {
-        this->vfaces_rot[j]->GetCollisionModel()->SyncPosition();
+
+    // Motion-threshold pruning: faces whose nodes all stayed within the threshold
+    // since their last synchronization keep their (conservative) broadphase AABB
+    // and are put to sleep, so the collision engine skips their AABB refresh and
+    // the narrowphase of sleeping-vs-sleeping pairs; their persistent contact
+    // manifolds are left untouched. The triangle shapes reference the node
+    // positions directly, so narrowphase against active shapes stays exact.
+    size_t nfaces = vfaces.size() + vfaces_rot.size();
+    if (prune_last_pos.size() != 3 * nfaces) {
+        // (re)built face lists: force a first full synchronization
+        prune_last_pos.assign(3 * nfaces, ChVector<>(1e30, 1e30, 1e30));
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)nfaces; j++) {
+        collision::ChCollisionModel* model;
+        ChVector<> p1, p2, p3;
+        if (j < (int)vfaces.size()) {
+            model = vfaces[j]->GetCollisionModel();
+            p1 = vfaces[j]->GetNode1()->GetPos();
+            p2 = vfaces[j]->GetNode2()->GetPos();
+            p3 = vfaces[j]->GetNode3()->GetPos();
+        } else {
+            const auto& face = vfaces_rot[j - vfaces.size()];
+            model = face->GetCollisionModel();
+            p1 = face->GetNode1()->GetPos();
+            p2 = face->GetNode2()->GetPos();
+            p3 = face->GetNode3()->GetPos();
+        }
+
+        double thr = (prune_threshold > 0) ? prune_threshold : 0.5 * model->GetEnvelope();
+        double thr2 = thr * thr;
+        ChVector<>* cache = &prune_last_pos[3 * j];
+        bool moved = (p1 - cache[0]).Length2() > thr2 || (p2 - cache[1]).Length2() > thr2 ||
+                     (p3 - cache[2]).Length2() > thr2;
+
+        btCollisionObject* mobj = ((collision::ChModelBullet*)model)->GetBulletModel();
+        if (moved) {
+            model->SyncPosition();
+            cache[0] = p1;
+            cache[1] = p2;
+            cache[2] = p3;
+            mobj->setActivationState(ACTIVE_TAG);
+        } else {
+            mobj->setActivationState(ISLAND_SLEEPING);
+        }
     }
 }
 
@@ -922,6 +990,11 @@ void ChContactSurfaceMesh::SurfaceAddCollisionModelsToSystem(ChSystem* msys) {
     for (unsigned int j = 0; j < vfaces_rot.size(); j++) {
         msys->GetCollisionSystem()->Add(this->vfaces_rot[j]->GetCollisionModel());
     }
+    if (prune_enabled) {
+        // AABBs of sleeping faces must survive the collision engine update
+        if (auto bsys = std::dynamic_pointer_cast<collision::ChCollisionSystemBullet>(msys->GetCollisionSystem()))
+            bsys->GetBulletCollisionWorld()->setForceUpdateAllAabbs(false);
+    }
 }
 
 void ChContactSurfaceMesh::SurfaceRemoveCollisionModelsFromSystem(ChSystem* msys) {
@@ -721,6 +721,17 @@ class ChApi ChContactSurfaceMesh : public ChContactSurface {
     /// Get the number of vertices.
     unsigned int GetNumVertices() const;
 
+    /// Enable motion-threshold pruning of the per-face collision bookkeeping.
+    /// When enabled, faces whose nodes all moved less than 'motion_threshold' since
+    /// their last synchronization are put to sleep in the collision engine: their
+    /// broadphase AABB is not refreshed and pairs where both sides are asleep skip
+    /// the narrowphase (existing contact manifolds persist unchanged). This cuts
+    /// most of the per-face bookkeeping when large parts of the mesh are at rest
+    /// or move slowly, ex. the non-contacting side of a rolling tire.
+    /// With motion_threshold = 0, half of the collision envelope of each face is
+    /// used, so the stale AABBs stay conservative; do not exceed the envelope.
+    void SetProximityPruning(bool val, double motion_threshold = 0);
+
     // Functions to interface this with ChPhysicsItem container
     virtual void SurfaceSyncCollisionModels();
     virtual void SurfaceAddCollisionModelsToSystem(ChSystem* msys);
@@ -730,6 +741,10 @@ class ChApi ChContactSurfaceMesh : public ChContactSurface {
     std::vector<std::shared_ptr<ChContactTriangleXYZ> > vfaces;  //  faces that collide
     std::vector<std::shared_ptr<ChContactTriangleXYZROT> >
         vfaces_rot;  //  faces that collide (for nodes with rotation too)
+
+    bool prune_enabled = false;      ///< skip collision bookkeeping of unmoved faces
+    double prune_threshold = 0;      ///< motion threshold (0: half the face envelope)
+    std::vector<ChVector<> > prune_last_pos;  ///< node positions at last face synchronization
 };
 
 /// @} fea_contact
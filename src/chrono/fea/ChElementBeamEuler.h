@@ -215,7 +215,7 @@ class ChApi ChElementBeamEuler : public ChElementBeam,
             // propose Y_w as absolute dir of the Y axis of B node, removing the effect of Bref-to-B rotation if any:
             //    Y_w = [R Bref->w ]*[R Bref->B ]'*{0,1,0}
             ChVector<> myele_wB = nodes[1]->Frame().GetRot().Rotate(q_refrotB.RotateBack(ChVector<>(0, 1, 0)));
-            // Average the two Y directions to have midpoint torsion (ex -30� torsion A and +30� torsion B= 0�)
+            // Average the two Y directions to have midpoint torsion (ex -30� torsion A and +30� torsion B= 0�)
             ChVector<> myele_w = (myele_wA + myele_wB).GetNormalized();
             Aabs.Set_A_Xdir(mXele_w, myele_w);
             q_element_abs_rot = Aabs.Get_A_quaternion();
@@ -411,7 +411,7 @@ class ChApi ChElementBeamEuler : public ChElementBeam,
 
         // In case the section has a shear center displacement:
         if (this->section->Sy || this->section->Sz) {
-            // Do [K]� = [T_s][K]"[T_s]'
+            // Do [K]� = [T_s][K]"[T_s]'
 
             for (int i = 0; i < 12; ++i)
                 this->StiffnessMatrix(3, i) +=
@@ -581,9 +581,11 @@ class ChApi ChElementBeamEuler : public ChElementBeam,
 
             ChMatrixDynamic<> mtemp(12, 12);
 
-            ChMatrixDynamic<> K_m(12, 12);  // [K_m]  = [P]' [H(theta)]'[K_loc] [H(theta] [P]
+            ChMatrixDynamic<> K_tang(12, 12);  // [K_tang] = [K_m] - [K_gr] - [K_gp] + [K_gm]
+
+            // [K_m]  = [P]' [H(theta)]'[K_loc] [H(theta] [P], accumulated directly in [K_tang]
             mtemp.MatrMultiply(HtKH, mP);
-            K_m.MatrTMultiply(mP, mtemp);
+            K_tang.MatrTMultiply(mP, mtemp);
 
             ChMatrixDynamic<> K_gr(12, 12);  // [K_gr] = [F_nm][G]
             K_gr.MatrMultiply(mFnm, mG);
@@ -594,8 +596,6 @@ class ChApi ChElementBeamEuler : public ChElementBeam,
 
             // ...							// [K_gm] = [P]'[L][P]  (simplify: avoid computing this)
 
-            ChMatrixDynamic<> K_tang(12, 12);  // [K_tang] = [K_m] - [K_gr] - [K_gp] + [K_gm]
-            K_tang.MatrInc(K_m);
             K_tang.MatrDec(K_gr);
             K_tang.MatrDec(K_gp);
 
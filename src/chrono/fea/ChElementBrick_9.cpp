@@ -449,22 +449,26 @@ void MyForceBrick9::Evaluate(ChMatrixNM<double, 33, 1>& result, const double x,
             // Add damping strains
             ChMatrixNM<double, 6, 1> DEPS;
             DEPS.Reset();
-            for (int ii = 0; ii < 33; ii++) {
-                DEPS(0, 0) = DEPS(0, 0) + strainD(0, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(1, 0) = DEPS(1, 0) + strainD(1, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(2, 0) = DEPS(2, 0) + strainD(2, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(3, 0) = DEPS(3, 0) + strainD(3, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(4, 0) = DEPS(4, 0) + strainD(4, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(5, 0) = DEPS(5, 0) + strainD(5, ii) * m_element->m_d_dt(ii, 0);
+            // Row-wise dot products: each strainD row is contiguous, so the
+            // inner loop vectorizes (unlike the strided column-wise version).
+            for (int k = 0; k < 6; k++) {
+                double acc = 0;
+#pragma omp simd reduction(+ : acc)
+                for (int ii = 0; ii < 33; ii++) {
+                    acc += strainD(k, ii) * m_element->m_d_dt(ii, 0);
+                }
+                DEPS(k, 0) = acc;
             }
 
             // Add structural damping
             strain += DEPS * m_element->m_Alpha;
 
-            // Internal force calculation
-            ChMatrixNM<double, 33, 6> tempC;
-            tempC.MatrTMultiply(strainD, E_eps);
-            result.MatrMultiply(tempC, strain);
+            // Internal force calculation. Fold the constitutive matrix into the
+            // strain first, so that the 33-row product is applied to a single
+            // column instead of the full 6x6 matrix.
+            ChMatrixNM<double, 6, 1> stress;
+            stress.MatrMultiply(E_eps, strain);
+            result.MatrTMultiply(strainD, stress);
             result.MatrScale(detJ0 * m_element->m_GaussScaling);
         } break;
         case ChElementBrick_9::Hencky: {
@@ -1244,13 +1248,15 @@ void MyForceBrick9::Evaluate(ChMatrixNM<double, 33, 1>& result, const double x,
 
             // Influence of damping
             ChMatrixNM<double, 6, 1> DEPS;
-            for (int ii = 0; ii < 33; ii++) {
-                DEPS(0, 0) = DEPS(0, 0) + strainD(0, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(1, 0) = DEPS(1, 0) + strainD(1, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(2, 0) = DEPS(2, 0) + strainD(2, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(3, 0) = DEPS(3, 0) + strainD(3, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(4, 0) = DEPS(4, 0) + strainD(4, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(5, 0) = DEPS(5, 0) + strainD(5, ii) * m_element->m_d_dt(ii, 0);
+            // Row-wise dot products: each strainD row is contiguous, so the
+            // inner loop vectorizes (unlike the strided column-wise version).
+            for (int k = 0; k < 6; k++) {
+                double acc = 0;
+#pragma omp simd reduction(+ : acc)
+                for (int ii = 0; ii < 33; ii++) {
+                    acc += strainD(k, ii) * m_element->m_d_dt(ii, 0);
+                }
+                DEPS(k, 0) = acc;
             }
 
             // Obtain stress from damping forces
@@ -1495,13 +1501,15 @@ void MyJacobianBrick9::Evaluate(ChMatrixNM<double, 33, 33>& result, const double
 
             // Add damping strains
             ChMatrixNM<double, 6, 1> DEPS;
-            for (int ii = 0; ii < 33; ii++) {
-                DEPS(0, 0) = DEPS(0, 0) + strainD(0, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(1, 0) = DEPS(1, 0) + strainD(1, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(2, 0) = DEPS(2, 0) + strainD(2, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(3, 0) = DEPS(3, 0) + strainD(3, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(4, 0) = DEPS(4, 0) + strainD(4, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(5, 0) = DEPS(5, 0) + strainD(5, ii) * m_element->m_d_dt(ii, 0);
+            // Row-wise dot products: each strainD row is contiguous, so the
+            // inner loop vectorizes (unlike the strided column-wise version).
+            for (int k = 0; k < 6; k++) {
+                double acc = 0;
+#pragma omp simd reduction(+ : acc)
+                for (int ii = 0; ii < 33; ii++) {
+                    acc += strainD(k, ii) * m_element->m_d_dt(ii, 0);
+                }
+                DEPS(k, 0) = acc;
             }
 
             // Add structural damping
@@ -1557,8 +1565,13 @@ void MyJacobianBrick9::Evaluate(ChMatrixNM<double, 33, 33>& result, const double
             // Term from  differentiation of Jacobian of strain w.r.t. coordinates w.r.t. coordinates (that is, twice)
             temp339.MatrTMultiply(Gd, Sigm);
             // Sum contributions to the final Jacobian of internal forces
+#ifdef CHRONO_HAS_AVX
+            m_KTE1.MatrMultiplyAVX(temp336, strainD);
+            m_KTE2.MatrMultiplyAVX(temp339, Gd);
+#else
             m_KTE1.MatrMultiply(temp336, strainD);
             m_KTE2.MatrMultiply(temp339, Gd);
+#endif
 
             result = m_KTE1 * (m_Kfactor + m_Rfactor * m_element->m_Alpha) + m_KTE2 * m_Kfactor;
             result.MatrScale(detJ0 * m_element->m_GaussScaling);
@@ -2460,13 +2473,15 @@ void MyJacobianBrick9::Evaluate(ChMatrixNM<double, 33, 33>& result, const double
 
             // Influence of damping
             ChMatrixNM<double, 6, 1> DEPS;
-            for (int ii = 0; ii < 33; ii++) {
-                DEPS(0, 0) = DEPS(0, 0) + strainD(0, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(1, 0) = DEPS(1, 0) + strainD(1, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(2, 0) = DEPS(2, 0) + strainD(2, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(3, 0) = DEPS(3, 0) + strainD(3, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(4, 0) = DEPS(4, 0) + strainD(4, ii) * m_element->m_d_dt(ii, 0);
-                DEPS(5, 0) = DEPS(5, 0) + strainD(5, ii) * m_element->m_d_dt(ii, 0);
+            // Row-wise dot products: each strainD row is contiguous, so the
+            // inner loop vectorizes (unlike the strided column-wise version).
+            for (int k = 0; k < 6; k++) {
+                double acc = 0;
+#pragma omp simd reduction(+ : acc)
+                for (int ii = 0; ii < 33; ii++) {
+                    acc += strainD(k, ii) * m_element->m_d_dt(ii, 0);
+                }
+                DEPS(k, 0) = acc;
             }
             // Obtain stress from structural damping
             ChMatrixNM<double, 6, 1> Stress_damp;
@@ -2554,8 +2569,13 @@ void MyJacobianBrick9::Evaluate(ChMatrixNM<double, 33, 33>& result, const double
 
             temp339.MatrTMultiply(Gd, Sigm);  // Stress contribution to the Jacobian of internal forces
 
+#ifdef CHRONO_HAS_AVX
+            m_KTE1.MatrMultiplyAVX(temp336, strainD);
+            m_KTE2.MatrMultiplyAVX(temp339, Gd);
+#else
             m_KTE1.MatrMultiply(temp336, strainD);
             m_KTE2.MatrMultiply(temp339, Gd);
+#endif
 
             result = m_KTE1 * (m_Kfactor + m_Rfactor * m_element->m_Alpha) + m_KTE2 * m_Kfactor;
             result.MatrScale(detJ * m_element->m_GaussScaling);
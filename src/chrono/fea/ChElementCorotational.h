@@ -29,9 +29,22 @@ namespace fea {
 class ChApi ChElementCorotational {
   protected:
     ChMatrix33<> A;  // rotation matrix
+    bool A_batched;  // rotation already provided by the mesh batched pass
+
+    /// To be called at the beginning of UpdateRotation() by elements that
+    /// support the batched pass: returns true (and clears the flag) if the
+    /// rotation was already set via SetBatchedRotation(), in which case the
+    /// element must keep it instead of recomputing it.
+    bool UseBatchedRotation() {
+        if (A_batched) {
+            A_batched = false;
+            return true;
+        }
+        return false;
+    }
 
   public:
-    ChElementCorotational() {
+    ChElementCorotational() : A_batched(false) {
         A(0, 0) = 1;
         A(1, 1) = 1;
         A(2, 2) = 1;
@@ -48,6 +61,21 @@ class ChApi ChElementCorotational {
     /// the cumulative rotation matrix A.
     /// CHLDREN CLASSES MUST IMPLEMENT THIS!!!
     virtual void UpdateRotation() = 0;
+
+    /// Fill F with the 3x3 matrix whose polar decomposition yields the element
+    /// rotation, if the element obtains its rotation that way. Elements that
+    /// return true here take part in the batched decomposition performed by
+    /// ChMesh::Update() (see ChPolarDecompositionBatch); the default returns
+    /// false, meaning the rotation is computed by other means.
+    virtual bool ComputeCorotatedFrame(ChMatrix33<>& F) { return false; }
+
+    /// Used by ChMesh to hand the element the rotation produced by the batched
+    /// polar-decomposition pass. The next UpdateRotation() call consumes it
+    /// instead of repeating the decomposition.
+    void SetBatchedRotation(const ChMatrix33<>& mA) {
+        A = mA;
+        A_batched = true;
+    }
 };
 
 /// @} fea_elements
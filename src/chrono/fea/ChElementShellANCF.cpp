@@ -110,11 +110,140 @@ void ChElementShellANCF::SetupInitial(ChSystem* system) {
     // Cache the scaling factor (due to change of integration intervals)
     m_GaussScaling = (m_lenX * m_lenY * m_thickness) / 8;
 
+    // Cache the reference-configuration data at the Gauss points of all layers
+    PrecomputeGQPointData();
+
     // Compute mass matrix and gravitational forces (constant)
     ComputeMassMatrix();
     ComputeGravityForce(system->Get_G_acc());
 }
 
+// Precompute, for each Gauss point of each layer, the quantities that depend only on
+// the reference configuration: shape function (derivative) matrices, the determinant
+// of the initial position vector gradient, the contravariant transformation
+// coefficients, and the EAS transformation matrix. The internal force evaluation
+// (see MyForce) then reduces to the material-law contraction at each point.
+void ChElementShellANCF::PrecomputeGQPointData() {
+    // Roots and weights of the order-2 Gauss quadrature used for internal forces
+    const std::vector<double>& roots = ChQuadrature::GetStaticTables()->Lroots[1];
+    const std::vector<double>& weights = ChQuadrature::GetStaticTables()->Weight[1];
+
+    m_GQdata.resize(m_numLayers);
+
+    for (size_t kl = 0; kl < m_numLayers; kl++) {
+        // Map of the z integration interval of this layer from [GaussZ(kl), GaussZ(kl+1)] to [-1,1]
+        double cz = (m_GaussZ[kl + 1] - m_GaussZ[kl]) / 2;
+        double mz = (m_GaussZ[kl + 1] + m_GaussZ[kl]) / 2;
+
+        double theta = GetLayer(kl).Get_theta();                  // Fiber angle
+        const ChMatrixNM<double, 6, 6>& T0 = GetLayer(kl).Get_T0();  // EAS transformation matrix
+        double detJ0C = GetLayer(kl).Get_detJ0C();  // Determinant of the initial position vector gradient
+                                                    // at the element center
+
+        m_GQdata[kl].clear();
+        m_GQdata[kl].reserve(roots.size() * roots.size() * roots.size());
+
+        for (size_t iz = 0; iz < roots.size(); iz++) {
+            for (size_t iy = 0; iy < roots.size(); iy++) {
+                for (size_t ix = 0; ix < roots.size(); ix++) {
+                    double x = roots[ix];
+                    double y = roots[iy];
+                    double z = cz * roots[iz] + mz;
+
+                    GQPointData pd;
+                    pd.weight = weights[ix] * weights[iy] * weights[iz] * cz;
+
+                    ShapeFunctions(pd.N, x, y, z);
+                    ShapeFunctionANSbilinearShell(pd.S_ANS, x, y);
+
+                    ChMatrixNM<double, 1, 3> Nx_d0;
+                    ChMatrixNM<double, 1, 3> Ny_d0;
+                    ChMatrixNM<double, 1, 3> Nz_d0;
+                    pd.detJ0 = Calc_detJ0(x, y, z, pd.Nx, pd.Ny, pd.Nz, Nx_d0, Ny_d0, Nz_d0);
+
+                    // Transformation : Orthogonal transformation (A and J)
+                    ChVector<double> G1xG2;  // Cross product of first and second column of
+                    double G1dotG1;          // Dot product of first column of position vector gradient
+
+                    G1xG2.x() = Nx_d0[0][1] * Ny_d0[0][2] - Nx_d0[0][2] * Ny_d0[0][1];
+                    G1xG2.y() = Nx_d0[0][2] * Ny_d0[0][0] - Nx_d0[0][0] * Ny_d0[0][2];
+                    G1xG2.z() = Nx_d0[0][0] * Ny_d0[0][1] - Nx_d0[0][1] * Ny_d0[0][0];
+                    G1dotG1 = Nx_d0[0][0] * Nx_d0[0][0] + Nx_d0[0][1] * Nx_d0[0][1] + Nx_d0[0][2] * Nx_d0[0][2];
+
+                    // Tangent Frame
+                    ChVector<double> A1;
+                    ChVector<double> A2;
+                    ChVector<double> A3;
+                    A1.x() = Nx_d0[0][0];
+                    A1.y() = Nx_d0[0][1];
+                    A1.z() = Nx_d0[0][2];
+                    A1 = A1 / sqrt(G1dotG1);
+                    A3 = G1xG2.GetNormalized();
+                    A2.Cross(A3, A1);
+
+                    // Direction for orthotropic material
+                    ChVector<double> AA1;
+                    ChVector<double> AA2;
+                    ChVector<double> AA3;
+                    AA1 = A1 * cos(theta) + A2 * sin(theta);
+                    AA2 = -A1 * sin(theta) + A2 * cos(theta);
+                    AA3 = A3;
+
+                    // Beta
+                    ChMatrixNM<double, 3, 3> j0;
+                    ChVector<double> j01;
+                    ChVector<double> j02;
+                    ChVector<double> j03;
+                    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
+                    j0(0, 0) = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
+                    j0(0, 1) = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
+                    j0(0, 2) = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
+                    j0(1, 0) = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
+                    j0(1, 1) = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
+                    j0(1, 2) = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
+                    j0(2, 0) = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
+                    j0(2, 1) = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
+                    j0(2, 2) = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
+                    j0.MatrDivScale(pd.detJ0);
+
+                    j01[0] = j0(0, 0);
+                    j02[0] = j0(1, 0);
+                    j03[0] = j0(2, 0);
+                    j01[1] = j0(0, 1);
+                    j02[1] = j0(1, 1);
+                    j03[1] = j0(2, 1);
+                    j01[2] = j0(0, 2);
+                    j02[2] = j0(1, 2);
+                    j03[2] = j0(2, 2);
+
+                    // Coefficients of contravariant transformation
+                    pd.beta(0, 0) = Vdot(AA1, j01);
+                    pd.beta(1, 0) = Vdot(AA2, j01);
+                    pd.beta(2, 0) = Vdot(AA3, j01);
+                    pd.beta(3, 0) = Vdot(AA1, j02);
+                    pd.beta(4, 0) = Vdot(AA2, j02);
+                    pd.beta(5, 0) = Vdot(AA3, j02);
+                    pd.beta(6, 0) = Vdot(AA1, j03);
+                    pd.beta(7, 0) = Vdot(AA2, j03);
+                    pd.beta(8, 0) = Vdot(AA3, j03);
+
+                    // Enhanced Assumed Strain transformation matrix
+                    ChMatrixNM<double, 6, 5> M;
+                    Basis_M(M, x, y, z);
+                    pd.G = T0 * M * (detJ0C / pd.detJ0);
+
+                    // Initial-configuration products with the shape function derivatives
+                    pd.d0d0Nx.MatrMultiplyT(m_d0d0T, pd.Nx);
+                    pd.d0d0Ny.MatrMultiplyT(m_d0d0T, pd.Ny);
+                    pd.d0d0Nz.MatrMultiplyT(m_d0d0T, pd.Nz);
+
+                    m_GQdata[kl].push_back(pd);
+                }
+            }
+        }
+    }
+}
+
 // State update.
 void ChElementShellANCF::Update() {
     ChElementGeneric::Update();
@@ -293,7 +422,7 @@ void ChElementShellANCF::ComputeGravityForce(const ChVector<>& g_acc) {
 // shear locking. This implementation also features a composite material implementation
 // that allows for selecting a number of layers over the element thickness; each of which
 // has an independent, user-selected fiber angle (direction for orthotropic constitutive behavior)
-class MyForce : public ChIntegrable3D<ChMatrixNM<double, 54, 1> > {
+class MyForce {
   public:
     MyForce(ChElementShellANCF* element,         // Containing element
             size_t kl,                           // Current layer index
@@ -302,125 +431,37 @@ class MyForce : public ChIntegrable3D<ChMatrixNM<double, 54, 1> > {
         : m_element(element), m_kl(kl), m_alpha_eas(alpha_eas) {}
     ~MyForce() {}
 
+    /// Evaluate (strainD'*strain) at the given Gauss point, include ANS and EAS.
+    /// All reference-configuration quantities are taken from the cached point data
+    /// (precomputed in ChElementShellANCF::PrecomputeGQPointData()).
+    void Evaluate(ChMatrixNM<double, 54, 1>& result, const ChElementShellANCF::GQPointData& pd);
+
   private:
     ChElementShellANCF* m_element;
     size_t m_kl;
     ChMatrixNM<double, 5, 1>* m_alpha_eas;
-
-    /// Evaluate (strainD'*strain)  at point x, include ANS and EAS.
-    virtual void Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const double y, const double z) override;
 };
 
-void MyForce::Evaluate(ChMatrixNM<double, 54, 1>& result, const double x, const double y, const double z) {
-    // Element shape function
-    ChMatrixNM<double, 1, 8> N;
-    m_element->ShapeFunctions(N, x, y, z);
-
-    // Determinant of position vector gradient matrix: Initial configuration
-    ChMatrixNM<double, 1, 8> Nx;
-    ChMatrixNM<double, 1, 8> Ny;
-    ChMatrixNM<double, 1, 8> Nz;
-    ChMatrixNM<double, 1, 3> Nx_d0;
-    ChMatrixNM<double, 1, 3> Ny_d0;
-    ChMatrixNM<double, 1, 3> Nz_d0;
-    double detJ0 = m_element->Calc_detJ0(x, y, z, Nx, Ny, Nz, Nx_d0, Ny_d0, Nz_d0);
-
-    // ANS shape function
-    ChMatrixNM<double, 1, 4> S_ANS;  // Shape function vector for Assumed Natural Strain
-    ChMatrixNM<double, 6, 5> M;      // Shape function vector for Enhanced Assumed Strain
-    m_element->ShapeFunctionANSbilinearShell(S_ANS, x, y);
-    m_element->Basis_M(M, x, y, z);
-
-    // Transformation : Orthogonal transformation (A and J)
-    ChVector<double> G1xG2;  // Cross product of first and second column of
-    double G1dotG1;          // Dot product of first column of position vector gradient
-
-    G1xG2.x() = Nx_d0[0][1] * Ny_d0[0][2] - Nx_d0[0][2] * Ny_d0[0][1];
-    G1xG2.y() = Nx_d0[0][2] * Ny_d0[0][0] - Nx_d0[0][0] * Ny_d0[0][2];
-    G1xG2.z() = Nx_d0[0][0] * Ny_d0[0][1] - Nx_d0[0][1] * Ny_d0[0][0];
-    G1dotG1 = Nx_d0[0][0] * Nx_d0[0][0] + Nx_d0[0][1] * Nx_d0[0][1] + Nx_d0[0][2] * Nx_d0[0][2];
-
-    // Tangent Frame
-    ChVector<double> A1;
-    ChVector<double> A2;
-    ChVector<double> A3;
-    A1.x() = Nx_d0[0][0];
-    A1.y() = Nx_d0[0][1];
-    A1.z() = Nx_d0[0][2];
-    A1 = A1 / sqrt(G1dotG1);
-    A3 = G1xG2.GetNormalized();
-    A2.Cross(A3, A1);
-
-    // Direction for orthotropic material
-    double theta = m_element->GetLayer(m_kl).Get_theta();  // Fiber angle
-    ChVector<double> AA1;
-    ChVector<double> AA2;
-    ChVector<double> AA3;
-    AA1 = A1 * cos(theta) + A2 * sin(theta);
-    AA2 = -A1 * sin(theta) + A2 * cos(theta);
-    AA3 = A3;
-
-    /// Beta
-    ChMatrixNM<double, 3, 3> j0;
-    ChVector<double> j01;
-    ChVector<double> j02;
-    ChVector<double> j03;
-    ChMatrixNM<double, 9, 1> beta;
-    // Calculates inverse of rd0 (j0) (position vector gradient: Initial Configuration)
-    j0(0, 0) = Ny_d0[0][1] * Nz_d0[0][2] - Nz_d0[0][1] * Ny_d0[0][2];
-    j0(0, 1) = Ny_d0[0][2] * Nz_d0[0][0] - Ny_d0[0][0] * Nz_d0[0][2];
-    j0(0, 2) = Ny_d0[0][0] * Nz_d0[0][1] - Nz_d0[0][0] * Ny_d0[0][1];
-    j0(1, 0) = Nz_d0[0][1] * Nx_d0[0][2] - Nx_d0[0][1] * Nz_d0[0][2];
-    j0(1, 1) = Nz_d0[0][2] * Nx_d0[0][0] - Nx_d0[0][2] * Nz_d0[0][0];
-    j0(1, 2) = Nz_d0[0][0] * Nx_d0[0][1] - Nz_d0[0][1] * Nx_d0[0][0];
-    j0(2, 0) = Nx_d0[0][1] * Ny_d0[0][2] - Ny_d0[0][1] * Nx_d0[0][2];
-    j0(2, 1) = Ny_d0[0][0] * Nx_d0[0][2] - Nx_d0[0][0] * Ny_d0[0][2];
-    j0(2, 2) = Nx_d0[0][0] * Ny_d0[0][1] - Ny_d0[0][0] * Nx_d0[0][1];
-    j0.MatrDivScale(detJ0);
-
-    j01[0] = j0(0, 0);
-    j02[0] = j0(1, 0);
-    j03[0] = j0(2, 0);
-    j01[1] = j0(0, 1);
-    j02[1] = j0(1, 1);
-    j03[1] = j0(2, 1);
-    j01[2] = j0(0, 2);
-    j02[2] = j0(1, 2);
-    j03[2] = j0(2, 2);
-
-    // Coefficients of contravariant transformation
-    beta(0, 0) = Vdot(AA1, j01);
-    beta(1, 0) = Vdot(AA2, j01);
-    beta(2, 0) = Vdot(AA3, j01);
-    beta(3, 0) = Vdot(AA1, j02);
-    beta(4, 0) = Vdot(AA2, j02);
-    beta(5, 0) = Vdot(AA3, j02);
-    beta(6, 0) = Vdot(AA1, j03);
-    beta(7, 0) = Vdot(AA2, j03);
-    beta(8, 0) = Vdot(AA3, j03);
-
-    // Transformation matrix, function of fiber angle
-    const ChMatrixNM<double, 6, 6>& T0 = m_element->GetLayer(m_kl).Get_T0();
-    // Determinant of the initial position vector gradient at the element center
-    double detJ0C = m_element->GetLayer(m_kl).Get_detJ0C();
+void MyForce::Evaluate(ChMatrixNM<double, 54, 1>& result, const ChElementShellANCF::GQPointData& pd) {
+    // Cached shape functions and reference-configuration data at this Gauss point
+    const ChMatrixNM<double, 1, 8>& N = pd.N;
+    const ChMatrixNM<double, 1, 8>& Nx = pd.Nx;
+    const ChMatrixNM<double, 1, 8>& Ny = pd.Ny;
+    const ChMatrixNM<double, 1, 4>& S_ANS = pd.S_ANS;
+    const ChMatrixNM<double, 9, 1>& beta = pd.beta;
+    double detJ0 = pd.detJ0;
 
     // Enhanced Assumed Strain
-    ChMatrixNM<double, 6, 5> G = T0 * M * (detJ0C / detJ0);
+    const ChMatrixNM<double, 6, 5>& G = pd.G;
     ChMatrixNM<double, 6, 1> strain_EAS = G * (*m_alpha_eas);
 
     ChMatrixNM<double, 8, 1> ddNx;
     ChMatrixNM<double, 8, 1> ddNy;
-    ChMatrixNM<double, 8, 1> ddNz;
     ddNx.MatrMultiplyT(m_element->m_ddT, Nx);
     ddNy.MatrMultiplyT(m_element->m_ddT, Ny);
-    ddNz.MatrMultiplyT(m_element->m_ddT, Nz);
 
-    ChMatrixNM<double, 8, 1> d0d0Nx;
-    ChMatrixNM<double, 8, 1> d0d0Ny;
-    ChMatrixNM<double, 8, 1> d0d0Nz;
-    d0d0Nx.MatrMultiplyT(m_element->m_d0d0T, Nx);
-    d0d0Ny.MatrMultiplyT(m_element->m_d0d0T, Ny);
-    d0d0Nz.MatrMultiplyT(m_element->m_d0d0T, Nz);
+    const ChMatrixNM<double, 8, 1>& d0d0Nx = pd.d0d0Nx;
+    const ChMatrixNM<double, 8, 1>& d0d0Ny = pd.d0d0Ny;
 
     // Strain component
     ChMatrixNM<double, 6, 1> strain_til;
@@ -607,14 +648,15 @@ void ChElementShellANCF::ComputeInternalForces(ChMatrixDynamic<>& Fi) {
         // Newton loop for EAS
         for (int count = 0; count < m_maxIterationsEAS; count++) {
             ChMatrixNM<double, 54, 1> result;
+            ChMatrixNM<double, 54, 1> val;
             MyForce formula(this, kl, &alphaEAS);
-            ChQuadrature::Integrate3D<ChMatrixNM<double, 54, 1> >(result,   // result of integration
-                                                                  formula,  // integrand formula
-                                                                  -1, 1,    // x limits
-                                                                  -1, 1,    // y limits
-                                                                  m_GaussZ[kl], m_GaussZ[kl + 1],  // z limits
-                                                                  2  // order of integration
-            );
+            // Sum the integrand over the cached Gauss points of this layer
+            result.Reset();
+            for (size_t ip = 0; ip < m_GQdata[kl].size(); ip++) {
+                formula.Evaluate(val, m_GQdata[kl][ip]);
+                val *= m_GQdata[kl][ip].weight;
+                result += val;
+            }
 
             // Extract vectors and matrices from result of integration
             Finternal.PasteClippedMatrix(result, 0, 0, 24, 1, 0, 0);
@@ -229,6 +229,30 @@ class ChApi ChElementShellANCF : public ChElementShell, public ChLoadableUV, pub
     ChMatrixNM<double, 8, 24> m_strainANS_D;               ///< ANS strain derivatives
     std::vector<ChMatrixNM<double, 5, 1> > m_alphaEAS;     ///< EAS parameters (5 per layer)
     std::vector<ChMatrixNM<double, 5, 5> > m_KalphaEAS;    ///< EAS Jacobians (a 5x5 matrix per layer)
+
+    /// Reference-configuration quantities evaluated at one Gauss point of one layer.
+    /// These are constant for a given reference configuration and are precomputed in
+    /// SetupInitial(), so that the internal force evaluation reduces to the material-law
+    /// contraction (see MyForce).
+    struct GQPointData {
+        double weight;                    ///< quadrature weight, including interval scaling
+        double detJ0;                     ///< determinant of initial position vector gradient
+        ChMatrixNM<double, 1, 8> N;       ///< shape functions
+        ChMatrixNM<double, 1, 8> Nx;     ///< shape function derivatives w.r.t. X
+        ChMatrixNM<double, 1, 8> Ny;     ///< shape function derivatives w.r.t. Y
+        ChMatrixNM<double, 1, 8> Nz;     ///< shape function derivatives w.r.t. Z
+        ChMatrixNM<double, 1, 4> S_ANS;  ///< ANS bilinear shape functions
+        ChMatrixNM<double, 9, 1> beta;   ///< coefficients of the contravariant transformation
+        ChMatrixNM<double, 6, 5> G;      ///< EAS transformation matrix T0*M*(detJ0C/detJ0)
+        ChMatrixNM<double, 8, 1> d0d0Nx;  ///< m_d0d0T * Nx'
+        ChMatrixNM<double, 8, 1> d0d0Ny;  ///< m_d0d0T * Ny'
+        ChMatrixNM<double, 8, 1> d0d0Nz;  ///< m_d0d0T * Nz'
+    };
+
+    std::vector<std::vector<GQPointData> > m_GQdata;  ///< cached Gauss point data, per layer
+
+    /// Precompute the reference-configuration Gauss point data of all layers (see GQPointData).
+    void PrecomputeGQPointData();
     static const double m_toleranceEAS;                    ///< tolerance for nonlinear EAS solver (on residual)
     static const int m_maxIterationsEAS;                   ///< maximum number of nonlinear EAS iterations
 
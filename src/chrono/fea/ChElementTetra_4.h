@@ -200,8 +200,8 @@ class ChApi ChElementTetra_4 : public ChElementTetrahedron, public ChLoadableUVW
         ComputeStiffnessMatrix();
     }
 
-    /// compute large rotation of element for corotational approach
-    virtual void UpdateRotation() override {
+    /// compute the matrix F whose polar decomposition gives the element rotation
+    virtual bool ComputeCorotatedFrame(ChMatrix33<>& F) override {
         // P = [ p_0  p_1  p_2  p_3 ]
         //     [ 1    1    1    1   ]
         ChMatrixNM<double, 4, 4> P;
@@ -214,7 +214,6 @@ class ChApi ChElementTetra_4 : public ChElementTetrahedron, public ChLoadableUVW
         P(3, 2) = 1.0;
         P(3, 3) = 1.0;
 
-        ChMatrix33<double> F;
         // F=P*mM (only upper-left 3x3 block!)
         double sum;
         for (int colres = 0; colres < 3; ++colres)
@@ -224,6 +223,16 @@ class ChApi ChElementTetra_4 : public ChElementTetrahedron, public ChLoadableUVW
                     sum += (P(row, col)) * (mM(col, colres));
                 F(row, colres) = sum;
             }
+        return true;
+    }
+
+    /// compute large rotation of element for corotational approach
+    virtual void UpdateRotation() override {
+        if (UseBatchedRotation())
+            return;  // rotation already set by the batched pass in ChMesh::Update()
+
+        ChMatrix33<double> F;
+        ComputeCorotatedFrame(F);
         ChMatrix33<> S;
         double det = ChPolarDecomposition<>::Compute(F, this->A, S, 1E-6);
         if (det < 0)
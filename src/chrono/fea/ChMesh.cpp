@@ -18,12 +18,28 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
-
+#include "chrono/utils/ChProfiler.h"
+
+#include "chrono/fea/ChElementBar.h"
+#include "chrono/fea/ChElementBeamANCF.h"
+#include "chrono/fea/ChElementBeamEuler.h"
+#include "chrono/fea/ChElementBrick.h"
+#include "chrono/fea/ChElementBrick_9.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChElementCorotational.h"
+#include "chrono/fea/ChElementHexa_20.h"
+#include "chrono/fea/ChElementHexa_8.h"
+#include "chrono/fea/ChElementShellANCF.h"
+#include "chrono/fea/ChElementShellANCF_8.h"
+#include "chrono/fea/ChElementShellReissner4.h"
+#include "chrono/fea/ChElementSpring.h"
+#include "chrono/fea/ChElementTetra_10.h"
 #include "chrono/fea/ChElementTetra_4.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
@@ -33,6 +49,89 @@ using namespace std;
 namespace chrono {
 namespace fea {
 
+// -----------------------------------------------------------------------------
+// Static dispatch over homogeneous element runs.
+//
+// DispatchSegment maps the dynamic type of a run of elements (all sharing the
+// same typeid, see ChMesh::BuildElementSegments) to a compile-time element
+// type and invokes the given operation with a typed tag pointer; the operation
+// then iterates the run making qualified (non-virtual) calls, which the
+// compiler can inline and vectorize across elements. Element types not in the
+// list (custom/user elements) report false and keep virtual dispatch.
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Qualified (devirtualized) calls to the per-element hooks. Some element
+// classes declare their overrides private, which a qualified call cannot
+// reach; those fall back to the plain virtual call via the (...) overloads.
+template <typename T>
+auto CallUpdate(T* e, int) -> decltype(e->T::Update(), void()) {
+    e->T::Update();
+}
+template <typename T>
+void CallUpdate(T* e, long) {
+    static_cast<ChElementBase*>(e)->Update();
+}
+
+template <typename T>
+auto CallKRMmatricesLoad(T* e, double Kf, double Rf, double Mf, int)
+    -> decltype(e->T::KRMmatricesLoad(Kf, Rf, Mf), void()) {
+    e->T::KRMmatricesLoad(Kf, Rf, Mf);
+}
+template <typename T>
+void CallKRMmatricesLoad(T* e, double Kf, double Rf, double Mf, long) {
+    static_cast<ChElementBase*>(e)->KRMmatricesLoad(Kf, Rf, Mf);
+}
+
+template <typename T>
+auto CallEleIntLoadResidual_Mv(T* e, ChVectorDynamic<>& R, const ChVectorDynamic<>& w, double c, int)
+    -> decltype(e->T::EleIntLoadResidual_Mv(R, w, c), void()) {
+    e->T::EleIntLoadResidual_Mv(R, w, c);
+}
+template <typename T>
+void CallEleIntLoadResidual_Mv(T* e, ChVectorDynamic<>& R, const ChVectorDynamic<>& w, double c, long) {
+    static_cast<ChElementBase*>(e)->EleIntLoadResidual_Mv(R, w, c);
+}
+
+template <typename Op>
+bool DispatchSegment(const std::type_info& type, Op&& op) {
+    if (type == typeid(ChElementTetra_4)) {
+        op((ChElementTetra_4*)nullptr);
+    } else if (type == typeid(ChElementTetra_10)) {
+        op((ChElementTetra_10*)nullptr);
+    } else if (type == typeid(ChElementHexa_8)) {
+        op((ChElementHexa_8*)nullptr);
+    } else if (type == typeid(ChElementHexa_20)) {
+        op((ChElementHexa_20*)nullptr);
+    } else if (type == typeid(ChElementBrick)) {
+        op((ChElementBrick*)nullptr);
+    } else if (type == typeid(ChElementBrick_9)) {
+        op((ChElementBrick_9*)nullptr);
+    } else if (type == typeid(ChElementShellANCF)) {
+        op((ChElementShellANCF*)nullptr);
+    } else if (type == typeid(ChElementShellANCF_8)) {
+        op((ChElementShellANCF_8*)nullptr);
+    } else if (type == typeid(ChElementShellReissner4)) {
+        op((ChElementShellReissner4*)nullptr);
+    } else if (type == typeid(ChElementBeamEuler)) {
+        op((ChElementBeamEuler*)nullptr);
+    } else if (type == typeid(ChElementBeamANCF)) {
+        op((ChElementBeamANCF*)nullptr);
+    } else if (type == typeid(ChElementCableANCF)) {
+        op((ChElementCableANCF*)nullptr);
+    } else if (type == typeid(ChElementBar)) {
+        op((ChElementBar*)nullptr);
+    } else if (type == typeid(ChElementSpring)) {
+        op((ChElementSpring*)nullptr);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // end unnamed namespace
+
 ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     vnodes = other.vnodes;
     velements = other.velements;
@@ -91,6 +190,19 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
 }
 
+void ChMesh::AddNodes(const std::vector<std::shared_ptr<ChNodeFEAbase>>& nodes) {
+    vnodes.reserve(vnodes.size() + nodes.size());
+    unsigned int index = static_cast<unsigned int>(vnodes.size());
+    for (const auto& node : nodes) {
+        node->SetIndex(++index);
+        vnodes.push_back(node);
+    }
+}
+
+void ChMesh::AddElements(const std::vector<std::shared_ptr<ChElementBase>>& elements) {
+    velements.insert(velements.end(), elements.begin(), elements.end());
+}
+
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
@@ -121,12 +233,17 @@ void ChMesh::Setup() {
     n_dofs = 0;
     n_dofs_w = 0;
 
+    state_nodes.clear();
+    state_nodes.reserve(vnodes.size());
+
     for (unsigned int i = 0; i < vnodes.size(); i++) {
         // Set node offsets in state vectors (based on the offsets of the containing mesh)
         vnodes[i]->NodeSetOffset_x(GetOffset_x() + n_dofs);
         vnodes[i]->NodeSetOffset_w(GetOffset_w() + n_dofs_w);
         // Count the degrees of freedom (consider only nodes that are not fixed)
+        // and cache the node local offsets for the bulk state functions
         if (!vnodes[i]->GetFixed()) {
+            state_nodes.push_back({vnodes[i].get(), n_dofs, n_dofs_w});
             n_dofs += vnodes[i]->Get_ndof_x();
             n_dofs_w += vnodes[i]->Get_ndof_w();
         }
@@ -136,12 +253,72 @@ void ChMesh::Setup() {
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+#ifndef CH_NO_PROFILE
+    // One stable label per mesh instance: the profiler compares name pointers,
+    // so each mesh shows up as its own node in the profile tree.
+    if (profile_name.empty())
+        profile_name = GetNameString().empty() ? "ChMesh::Update" : "ChMesh::Update '" + GetNameString() + "'";
+    CH_PROFILE(profile_name.c_str());
+#endif
+
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
-    for (unsigned int i = 0; i < velements.size(); i++) {
-        //    - update auxiliary stuff, ex. update element's rotation matrices if corotational..
-        velements[i]->Update();
+    // Batched corotational pass: gather, from every corotational element that
+    // exposes it, the 3x3 matrix whose polar decomposition yields the element
+    // rotation, decompose all of them together in SIMD blocks, and hand each
+    // element its rotation. The UpdateRotation() of those elements then just
+    // consumes the precomputed rotation instead of running one scalar
+    // decomposition per element (the dominant cost of corotational updates).
+    coro_elements.clear();
+    coro_F.clear();
+    ChMatrix33<> Fel;
+    for (auto& element : velements) {
+        if (auto celement = dynamic_cast<ChElementCorotational*>(element.get())) {
+            if (celement->ComputeCorotatedFrame(Fel)) {
+                coro_elements.push_back(celement);
+                coro_F.insert(coro_F.end(), Fel.GetAddress(), Fel.GetAddress() + 9);
+            }
+        }
+    }
+    if (!coro_elements.empty()) {
+        int ncoro = (int)coro_elements.size();
+        coro_Q.resize(coro_F.size());
+        coro_det.resize(ncoro);
+        ChPolarDecompositionBatch::Compute(coro_F.data(), coro_Q.data(), coro_det.data(), ncoro);
+        ChMatrix33<> Ael;
+        for (int ic = 0; ic < ncoro; ic++) {
+            // as in the per-element path, flip improper factors back to proper rotations
+            double sign = coro_det[ic] < 0 ? -1.0 : 1.0;
+            for (int k = 0; k < 9; k++)
+                Ael.GetAddress()[k] = sign * coro_Q[9 * ic + k];
+            coro_elements[ic]->SetBatchedRotation(Ael);
+        }
+    }
+
+    // Update the elements in parallel: each element only reads the state of its own
+    // nodes and writes its own auxiliary data, so the updates are independent.
+    // Homogeneous runs of elements are dispatched with the type resolved
+    // statically (qualified call), mixed/unknown runs keep virtual dispatch.
+    if (element_segments_nelements != velements.size())
+        BuildElementSegments();
+    for (const auto& seg : element_segments) {
+        auto* elems = &velements[seg.start];
+        int n = (int)seg.count;
+        bool segmented = DispatchSegment(*seg.type, [&](auto* tag) {
+            using ElemT = typename std::remove_pointer<decltype(tag)>::type;
+#pragma omp parallel for schedule(dynamic, 4)
+            for (int i = 0; i < n; i++) {
+                //    - update auxiliary stuff, ex. update element's rotation matrices if corotational..
+                CallUpdate(static_cast<ElemT*>(elems[i].get()), 0);
+            }
+        });
+        if (!segmented) {
+#pragma omp parallel for schedule(dynamic, 4)
+            for (int i = 0; i < n; i++) {
+                elems[i]->Update();
+            }
+        }
     }
 }
 
@@ -174,14 +351,9 @@ void ChMesh::IntStateGather(const unsigned int off_x,
                             ChStateDelta& v,           
                             double& T)                 
 {
-    unsigned int local_off_x = 0;
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntStateGather(off_x + local_off_x, x, off_v + local_off_v, v, T);
-            local_off_x += vnodes[j]->Get_ndof_x();
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateGather(off_x + state_nodes[j].off_x, x, off_v + state_nodes[j].off_w, v, T);
     }
 
     T = GetChTime();
@@ -193,36 +365,25 @@ void ChMesh::IntStateScatter(const unsigned int off_x,
                              const ChStateDelta& v,     
                              const double T)            
 {
-    unsigned int local_off_x = 0;
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntStateScatter(off_x + local_off_x, x, off_v + local_off_v, v, T);
-            local_off_x += vnodes[j]->Get_ndof_x();
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateScatter(off_x + state_nodes[j].off_x, x, off_v + state_nodes[j].off_w, v, T);
     }
 
     Update(T);
 }
 
 void ChMesh::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
-    unsigned int local_off_a = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntStateGatherAcceleration(off_a + local_off_a, a);
-            local_off_a += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateGatherAcceleration(off_a + state_nodes[j].off_w, a);
     }
 }
 
 void ChMesh::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
-    unsigned int local_off_a = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntStateScatterAcceleration(off_a + local_off_a, a);
-            local_off_a += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateScatterAcceleration(off_a + state_nodes[j].off_w, a);
     }
 }
 
@@ -232,14 +393,10 @@ void ChMesh::IntStateIncrement(const unsigned int off_x,
                                const unsigned int off_v,  
                                const ChStateDelta& Dv)    
 {
-    unsigned int local_off_x = 0;
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntStateIncrement(off_x + local_off_x, x_new, x, off_v + local_off_v, Dv);
-            local_off_x += vnodes[j]->Get_ndof_x();
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateIncrement(off_x + state_nodes[j].off_x, x_new, x, off_v + state_nodes[j].off_w,
+                                                   Dv);
     }
 	for (unsigned int ie = 0; ie < velements.size(); ie++) {
 		velements[ie]->EleDoIntegration();
@@ -251,19 +408,20 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,
                                const double c          
                                ) {
     // applied nodal forces
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntLoadResidual_F(off + local_off_v, R, c);
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntLoadResidual_F(off + state_nodes[j].off_w, R, c);
     }
 
     // internal forces
     timer_internal_forces.start();
+    if (force_backend) {
+        LoadResidualBatched(R, c);
+    } else {
 #pragma omp parallel for schedule(dynamic, 4)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int ie = 0; ie < velements.size(); ie++) {
+            velements[ie]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
@@ -290,6 +448,101 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,
     }
 }
 
+void ChMesh::BuildForceBatches() {
+    force_batches.clear();
+    force_leftover.clear();
+
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        ChElementBase* element = velements[ie].get();
+        if (!force_backend->AcceptsElement(element)) {
+            force_leftover.push_back(element);
+            continue;
+        }
+        // find (or open) the pack with this element's DOF count
+        int ndofs = element->GetNdofs();
+        ChMeshForceBackend::Batch* batch = nullptr;
+        for (auto& existing : force_batches) {
+            if (existing.dofs_per_element == ndofs) {
+                batch = &existing;
+                break;
+            }
+        }
+        if (!batch) {
+            force_batches.push_back(ChMeshForceBackend::Batch());
+            batch = &force_batches.back();
+            batch->dofs_per_element = ndofs;
+        }
+        batch->elements.push_back(element);
+    }
+
+    for (auto& batch : force_batches) {
+        batch.num_elements = (int)batch.elements.size();
+        batch.coords.resize((size_t)batch.num_elements * batch.dofs_per_element);
+        batch.forces.resize((size_t)batch.num_elements * batch.dofs_per_element);
+    }
+
+    force_batches_nelements = velements.size();
+}
+
+void ChMesh::BuildElementSegments() {
+    element_segments.clear();
+    size_t start = 0;
+    while (start < velements.size()) {
+        const std::type_info& type = typeid(*velements[start]);
+        size_t end = start + 1;
+        while (end < velements.size() && typeid(*velements[end]) == type)
+            end++;
+        element_segments.push_back({start, end - start, &type});
+        start = end;
+    }
+    element_segments_nelements = velements.size();
+}
+
+void ChMesh::LoadResidualBatched(ChVectorDynamic<>& R, double c) {
+    if (force_batches_nelements != velements.size())
+        BuildForceBatches();
+
+    for (auto& batch : force_batches) {
+        // Gather the nodal coordinates of the pack, SoA: DOF d of element e at
+        // [d * num_elements + e], so that batched kernels sweep consecutive
+        // elements with unit stride.
+#pragma omp parallel for schedule(static)
+        for (int ie = 0; ie < batch.num_elements; ie++) {
+            ChMatrixDynamic<> mD;
+            batch.elements[ie]->GetStateBlock(mD);
+            for (int id = 0; id < batch.dofs_per_element; id++)
+                batch.coords[(size_t)id * batch.num_elements + ie] = mD(id);
+        }
+
+        // Evaluate the whole pack at once (possibly on an accelerator).
+        force_backend->Evaluate(batch);
+
+        // Stream the forces back into the residual, with the same node-wise
+        // scatter as ChElementGeneric::EleIntLoadResidual_F (the paste into R
+        // is atomic, so the loop can run in parallel even with shared nodes).
+#pragma omp parallel for schedule(static)
+        for (int ie = 0; ie < batch.num_elements; ie++) {
+            ChElementBase* element = batch.elements[ie];
+            ChMatrixDynamic<> mFi(batch.dofs_per_element, 1);
+            for (int id = 0; id < batch.dofs_per_element; id++)
+                mFi(id) = batch.forces[(size_t)id * batch.num_elements + ie] * c;
+            int stride = 0;
+            for (int in = 0; in < element->GetNnodes(); in++) {
+                int nodedofs = element->GetNodeNdofs(in);
+                if (!element->GetNodeN(in)->GetFixed())
+                    R.PasteSumClippedMatrix(mFi, stride, 0, nodedofs, 1, element->GetNodeN(in)->NodeGetOffset_w(), 0);
+                stride += nodedofs;
+            }
+        }
+    }
+
+    // Elements not claimed by the backend keep the per-element path.
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int ie = 0; ie < (int)force_leftover.size(); ie++) {
+        force_leftover[ie]->EleIntLoadResidual_F(R, c);
+    }
+}
+
 void ChMesh::ComputeMassProperties(double& mass,           // ChMesh object mass
                                    ChVector<>& com,        // ChMesh center of gravity
                                    ChMatrix33<>& inertia)  // ChMesh inertia tensor
@@ -317,17 +570,26 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
                                 const double c               ///< a scaling factor
                                 ) {
     // nodal masses
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntLoadResidual_Mv(off + local_off_v, R, w, c);
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntLoadResidual_Mv(off + state_nodes[j].off_w, R, w, c);
     }
 
-    // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
+    // internal masses (statically dispatched over homogeneous element runs)
+    if (element_segments_nelements != velements.size())
+        BuildElementSegments();
+    for (const auto& seg : element_segments) {
+        auto* elems = &velements[seg.start];
+        int n = (int)seg.count;
+        bool segmented = DispatchSegment(*seg.type, [&](auto* tag) {
+            using ElemT = typename std::remove_pointer<decltype(tag)>::type;
+            for (int i = 0; i < n; i++)
+                CallEleIntLoadResidual_Mv(static_cast<ElemT*>(elems[i].get()), R, w, c, 0);
+        });
+        if (!segmented) {
+            for (int i = 0; i < n; i++)
+                elems[i]->EleIntLoadResidual_Mv(R, w, c);
+        }
     }
 }
 
@@ -337,12 +599,9 @@ void ChMesh::IntToDescriptor(const unsigned int off_v,
                              const unsigned int off_L,
                              const ChVectorDynamic<>& L,
                              const ChVectorDynamic<>& Qc) {
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntToDescriptor(off_v + local_off_v, v, R);
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntToDescriptor(off_v + state_nodes[j].off_w, v, R);
     }
 }
 
@@ -350,12 +609,9 @@ void ChMesh::IntFromDescriptor(const unsigned int off_v,
                                ChStateDelta& v,
                                const unsigned int off_L,
                                ChVectorDynamic<>& L) {
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntFromDescriptor(off_v + local_off_v, v);
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+#pragma omp parallel for schedule(static)
+    for (int j = 0; j < (int)state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntFromDescriptor(off_v + state_nodes[j].off_w, v);
     }
 }
 
@@ -368,9 +624,23 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
     timer_KRMload.start();
+    if (element_segments_nelements != velements.size())
+        BuildElementSegments();
+    for (const auto& seg : element_segments) {
+        auto* elems = &velements[seg.start];
+        int n = (int)seg.count;
+        bool segmented = DispatchSegment(*seg.type, [&](auto* tag) {
+            using ElemT = typename std::remove_pointer<decltype(tag)>::type;
+#pragma omp parallel for
+            for (int i = 0; i < n; i++)
+                CallKRMmatricesLoad(static_cast<ElemT*>(elems[i].get()), Kfactor, Rfactor, Mfactor, 0);
+        });
+        if (!segmented) {
 #pragma omp parallel for
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+            for (int i = 0; i < n; i++)
+                elems[i]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        }
+    }
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -17,6 +17,7 @@
 
 #include <cstdlib>
 #include <cmath>
+#include <typeinfo>
 
 #include "chrono/core/ChTimer.h"
 #include "chrono/physics/ChContinuumMaterial.h"
@@ -24,6 +25,7 @@
 #include "chrono/physics/ChMaterialSurfaceNSC.h"
 #include "chrono/fea/ChContactSurface.h"
 #include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChMeshForceBackend.h"
 #include "chrono/fea/ChMeshSurface.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
@@ -31,6 +33,8 @@ namespace chrono {
 
 namespace fea {
 
+class ChElementCorotational;  // forward declaration
+
 /// @addtogroup chrono_fea
 /// @{
 
@@ -56,6 +60,67 @@ class ChApi ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    std::string profile_name;  ///< stable per-mesh label for the profiler (which compares name pointers)
+
+    /// Entry of the cached state bookkeeping table (see #state_nodes).
+    struct StateNodeEntry {
+        ChNodeFEAbase* node;  ///< raw pointer to the (non-fixed) node
+        unsigned int off_x;   ///< local offset of the node in the mesh position state block
+        unsigned int off_w;   ///< local offset of the node in the mesh velocity state block
+    };
+
+    /// Cached table of the non-fixed nodes with their precomputed local state offsets,
+    /// rebuilt by Setup(). The bulk IntState* functions sweep this flat table instead of
+    /// querying each node for its number of DOFs through virtual calls; since all offsets
+    /// are known in advance, the per-node gather/scatter operations are independent and
+    /// the sweeps can run in parallel.
+    std::vector<StateNodeEntry> state_nodes;
+
+    /// Scratch buffers for the batched corotational rotation update in Update():
+    /// elements taking part in the batched pass, their gathered 3x3 frame
+    /// matrices and the resulting orthogonal factors (all row-major, back to
+    /// back). Kept as members to avoid reallocating them every time step.
+    std::vector<ChElementCorotational*> coro_elements;
+    std::vector<double> coro_F;
+    std::vector<double> coro_Q;
+    std::vector<double> coro_det;
+
+    /// Optional backend for batched evaluation of element internal forces and its
+    /// element packs (see SetForceBackend). Packs group the elements accepted by
+    /// the backend per DOF count; elements not accepted stay on the per-element
+    /// path (#force_leftover). Pack membership is rebuilt when the element
+    /// population changes.
+    std::shared_ptr<ChMeshForceBackend> force_backend;
+    std::vector<ChMeshForceBackend::Batch> force_batches;
+    std::vector<ChElementBase*> force_leftover;
+    size_t force_batches_nelements = 0;  ///< element count at the last pack rebuild
+
+    /// Gather the element packs, hand them to the force backend, and stream the
+    /// computed internal forces into R (scaled by c). Called by IntLoadResidual_F()
+    /// when a backend is attached.
+    void LoadResidualBatched(ChVectorDynamic<>& R, double c);
+
+    /// Rebuild the element packs for the current backend and element population.
+    void BuildForceBatches();
+
+    /// Type-segmented view of the element list: maximal runs of consecutive
+    /// elements sharing the same concrete type. The hot per-element loops
+    /// (Update, KRM matrix load, M*v residual) walk these runs and dispatch
+    /// each homogeneous run with the element type resolved statically, so the
+    /// compiler can inline the element kernels across the run instead of
+    /// issuing one virtual call per element (see DispatchSegment in
+    /// ChMesh.cpp). Rebuilt when the element population changes.
+    struct ElementSegment {
+        size_t start;                ///< first element of the run in #velements
+        size_t count;                ///< run length
+        const std::type_info* type;  ///< concrete type shared by the run
+    };
+    std::vector<ElementSegment> element_segments;
+    size_t element_segments_nelements = (size_t)-1;  ///< element count at the last rebuild
+
+    /// Rebuild #element_segments for the current element population.
+    void BuildElementSegments();
+
   public:
     ChMesh()
         : n_dofs(0),
@@ -75,6 +140,25 @@ class ChApi ChMesh : public ChIndexedNodes {
     void ClearNodes();
     void ClearElements();
 
+    /// Preallocate storage for the given total number of nodes.
+    /// Call before adding a large mesh to avoid repeated reallocation.
+    void ReserveNodes(size_t n) { vnodes.reserve(n); }
+
+    /// Preallocate storage for the given total number of elements.
+    void ReserveElements(size_t n) { velements.reserve(n); }
+
+    /// Add a batch of nodes.
+    /// Equivalent to calling AddNode on each entry, but reserves storage for the
+    /// whole batch up front, so large meshes are appended without intermediate
+    /// reallocation of the node array.
+    void AddNodes(const std::vector<std::shared_ptr<ChNodeFEAbase>>& nodes);
+
+    /// Add a batch of elements (see AddNodes).
+    /// For homogeneous meshes, call BuildForceBatches afterwards (or rely on the
+    /// system setup doing so) to get the contiguous per-type element packs used
+    /// by the batched force evaluation.
+    void AddElements(const std::vector<std::shared_ptr<ChElementBase>>& elements);
+
     /// Get the array of nodes of this mesh.
     const std::vector<std::shared_ptr<ChNodeFEAbase>>& GetNodes() const { return vnodes; }
 
@@ -119,6 +203,18 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Attach a backend for batched evaluation of the element internal forces (or detach
+    /// it, passing null). The elements accepted by the backend are grouped into packs of
+    /// uniform DOF count; at each residual evaluation their nodal coordinates are gathered
+    /// into contiguous SoA buffers, the backend evaluates the whole pack at once (e.g. in
+    /// batched device kernels), and the forces are streamed back into the system load
+    /// vector. See ChMeshForceBackend.
+    void SetForceBackend(std::shared_ptr<ChMeshForceBackend> backend) {
+        force_backend = backend;
+        force_batches_nelements = 0;  // force a pack rebuild at the next evaluation
+    }
+    std::shared_ptr<ChMeshForceBackend> GetForceBackend() const { return force_backend; }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
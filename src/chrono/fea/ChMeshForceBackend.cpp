@@ -0,0 +1,29 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/fea/ChMeshForceBackend.h"
+
+namespace chrono {
+namespace fea {
+
+void ChMeshForceBackendRef::Evaluate(Batch& batch) {
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int ie = 0; ie < batch.num_elements; ie++) {
+        ChMatrixDynamic<> Fi(batch.dofs_per_element, 1);
+        batch.elements[ie]->ComputeInternalForces(Fi);
+        for (int id = 0; id < batch.dofs_per_element; id++)
+            batch.forces[id * batch.num_elements + ie] = Fi(id);
+    }
+}
+
+}  // end namespace fea
+}  // end namespace chrono
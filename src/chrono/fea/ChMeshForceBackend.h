@@ -0,0 +1,82 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHMESHFORCEBACKEND_H
+#define CHMESHFORCEBACKEND_H
+
+#include <vector>
+
+#include "chrono/fea/ChElementBase.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_module
+/// @{
+
+/// Interface for backends evaluating the internal forces of batched element packs.
+///
+/// When a backend is attached to a ChMesh (see ChMesh::SetForceBackend), the mesh
+/// groups the elements accepted by the backend into packs of uniform DOF count and,
+/// at each residual evaluation, gathers their nodal coordinates into a contiguous
+/// SoA buffer, hands the pack to the backend, and streams the computed forces back
+/// into the system load vector. The contract is expressed in terms of plain
+/// contiguous buffers precisely so that an accelerator backend (e.g. a CUDA
+/// implementation in a GPU-enabled module) can move a whole pack with a single
+/// host/device transfer per direction and evaluate all elements in batched kernels;
+/// a CPU backend can instead vectorize across elements thanks to the unit-stride
+/// access per DOF.
+///
+/// SoA layout: the value of DOF d of element e is stored at [d * num_elements + e],
+/// in both the coordinate and the force buffer.
+class ChApi ChMeshForceBackend {
+  public:
+    /// A pack of elements with uniform DOF count, with its gathered coordinates
+    /// and computed forces. Buffers are sized by the mesh and kept across steps,
+    /// so steady-state evaluations do not allocate.
+    struct Batch {
+        int num_elements = 0;                  ///< number of elements in the pack
+        int dofs_per_element = 0;              ///< DOFs of each element (e.g. 24 for 4-node ANCF shells)
+        std::vector<ChElementBase*> elements;  ///< the batched elements
+        std::vector<double> coords;            ///< gathered nodal coordinates, SoA (input)
+        std::vector<double> forces;            ///< computed internal forces, SoA (output)
+    };
+
+    virtual ~ChMeshForceBackend() {}
+
+    /// Return true if this backend can evaluate the given element. Elements not
+    /// accepted stay on the default per-element evaluation path of the mesh.
+    virtual bool AcceptsElement(ChElementBase* element) const = 0;
+
+    /// Evaluate the internal forces of all elements of the pack, reading
+    /// batch.coords and filling batch.forces (both already sized by the caller).
+    virtual void Evaluate(Batch& batch) = 0;
+};
+
+/// Reference backend: evaluates each element of the pack with its own
+/// ComputeInternalForces(), in a parallel loop over the pack. It accepts every
+/// element and does not read the gathered coordinates (the elements read their
+/// live nodes), so it is functionally identical to the default path; its purpose
+/// is validating the pack gather/scatter bookkeeping and serving as the CPU
+/// fallback when an accelerator backend is not available.
+class ChApi ChMeshForceBackendRef : public ChMeshForceBackend {
+  public:
+    virtual bool AcceptsElement(ChElementBase* element) const override { return true; }
+    virtual void Evaluate(Batch& batch) override;
+};
+
+/// @} fea_module
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
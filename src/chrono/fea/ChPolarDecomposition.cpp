@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/fea/ChPolarDecomposition.h"
 
 namespace chrono {
@@ -108,5 +111,160 @@ double PolarDecomposition::Compute(const double* M, double* Q, double* S, double
     return (det);
 }
 
+// -----------------------------------------------------------------------------
+// Batched polar decomposition.
+//
+// Same Shoemake iteration as PolarDecomposition::Compute above, restructured
+// into a structure-of-arrays form over blocks of four matrices so that the
+// lane loops vectorize. Every lane evaluates its own norms and gamma scaling;
+// converged lanes are frozen and the block iterates until all lanes are done.
+// -----------------------------------------------------------------------------
+
+void ChPolarDecompositionBatch::Compute(const double* M, double* Q, double* det, int count, double tolerance) {
+    const int bs = block_size;
+    int num_blocks = (count + bs - 1) / bs;
+
+#pragma omp parallel for schedule(static)
+    for (int ib = 0; ib < num_blocks; ib++) {
+        int base = ib * bs;
+        int lanes = std::min(bs, count - base);
+
+        // Load the block in SoA form; as in the scalar version, the iteration
+        // runs on the transposed matrices. Tail lanes are padded with identity
+        // so the full block can iterate unconditionally.
+        double Mk[9][block_size];
+        for (int l = 0; l < bs; l++)
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    Mk[3 * i + j][l] = (l < lanes) ? M[9 * (base + l) + 3 * j + i] : (double)(i == j);
+
+        double M_one[block_size], M_inf[block_size], det_k[block_size];
+        bool frozen[block_size], singular[block_size];
+        for (int l = 0; l < bs; l++) {
+            M_one[l] = 0;
+            M_inf[l] = 0;
+            det_k[l] = 1;
+            frozen[l] = (l >= lanes);
+            singular[l] = false;
+        }
+        for (int i = 0; i < 3; i++)
+            for (int l = 0; l < bs; l++) {
+                double col = fabs(Mk[i + 0][l]) + fabs(Mk[i + 3][l]) + fabs(Mk[i + 6][l]);
+                double row = fabs(Mk[3 * i + 0][l]) + fabs(Mk[3 * i + 1][l]) + fabs(Mk[3 * i + 2][l]);
+                M_one[l] = std::max(M_one[l], col);
+                M_inf[l] = std::max(M_inf[l], row);
+            }
+
+        bool all_done = false;
+        while (!all_done) {
+            double MadjTk[9][block_size];
+
+            // adjugate-transpose rows: (row2 x row3, row3 x row1, row1 x row2)
+#pragma omp simd
+            for (int l = 0; l < bs; l++) {
+                MadjTk[0][l] = Mk[4][l] * Mk[8][l] - Mk[5][l] * Mk[7][l];
+                MadjTk[1][l] = Mk[5][l] * Mk[6][l] - Mk[3][l] * Mk[8][l];
+                MadjTk[2][l] = Mk[3][l] * Mk[7][l] - Mk[4][l] * Mk[6][l];
+                MadjTk[3][l] = Mk[7][l] * Mk[2][l] - Mk[8][l] * Mk[1][l];
+                MadjTk[4][l] = Mk[8][l] * Mk[0][l] - Mk[6][l] * Mk[2][l];
+                MadjTk[5][l] = Mk[6][l] * Mk[1][l] - Mk[7][l] * Mk[0][l];
+                MadjTk[6][l] = Mk[1][l] * Mk[5][l] - Mk[2][l] * Mk[4][l];
+                MadjTk[7][l] = Mk[2][l] * Mk[3][l] - Mk[0][l] * Mk[5][l];
+                MadjTk[8][l] = Mk[0][l] * Mk[4][l] - Mk[1][l] * Mk[3][l];
+            }
+
+            for (int l = 0; l < bs; l++) {
+                if (frozen[l])
+                    continue;
+                det_k[l] = Mk[0][l] * MadjTk[0][l] + Mk[1][l] * MadjTk[1][l] + Mk[2][l] * MadjTk[2][l];
+                if (det_k[l] == 0.0) {
+                    // degenerate matrix: leave it to the scalar path below
+                    singular[l] = true;
+                    frozen[l] = true;
+                }
+            }
+
+            double MadjT_one[block_size], MadjT_inf[block_size];
+            for (int l = 0; l < bs; l++) {
+                MadjT_one[l] = 0;
+                MadjT_inf[l] = 0;
+            }
+            for (int i = 0; i < 3; i++)
+                for (int l = 0; l < bs; l++) {
+                    double col = fabs(MadjTk[i + 0][l]) + fabs(MadjTk[i + 3][l]) + fabs(MadjTk[i + 6][l]);
+                    double row = fabs(MadjTk[3 * i + 0][l]) + fabs(MadjTk[3 * i + 1][l]) + fabs(MadjTk[3 * i + 2][l]);
+                    MadjT_one[l] = std::max(MadjT_one[l], col);
+                    MadjT_inf[l] = std::max(MadjT_inf[l], row);
+                }
+
+            double g1[block_size], g2[block_size];
+            for (int l = 0; l < bs; l++) {
+                if (frozen[l]) {
+                    // frozen lanes keep their factor unchanged: g1=1, g2=0
+                    g1[l] = 1;
+                    g2[l] = 0;
+                    continue;
+                }
+                double gamma =
+                    sqrt(sqrt((MadjT_one[l] * MadjT_inf[l]) / (M_one[l] * M_inf[l])) / fabs(det_k[l]));
+                g1[l] = gamma * 0.5;
+                g2[l] = 0.5 / (gamma * det_k[l]);
+            }
+
+            double E_one[block_size];
+            for (int l = 0; l < bs; l++)
+                E_one[l] = 0;
+            for (int i = 0; i < 3; i++) {
+                double col[block_size];
+                for (int l = 0; l < bs; l++)
+                    col[l] = 0;
+                for (int j = 0; j < 3; j++) {
+#pragma omp simd
+                    for (int l = 0; l < bs; l++) {
+                        double m_new = g1[l] * Mk[3 * j + i][l] + g2[l] * MadjTk[3 * j + i][l];
+                        col[l] += fabs(Mk[3 * j + i][l] - m_new);
+                        Mk[3 * j + i][l] = m_new;
+                    }
+                }
+                for (int l = 0; l < bs; l++)
+                    E_one[l] = std::max(E_one[l], col[l]);
+            }
+
+            all_done = true;
+            for (int i = 0; i < 3; i++)
+                for (int l = 0; l < bs; l++) {
+                    double col = fabs(Mk[i + 0][l]) + fabs(Mk[i + 3][l]) + fabs(Mk[i + 6][l]);
+                    double row = fabs(Mk[3 * i + 0][l]) + fabs(Mk[3 * i + 1][l]) + fabs(Mk[3 * i + 2][l]);
+                    if (i == 0) {
+                        M_one[l] = col;
+                        M_inf[l] = row;
+                    } else {
+                        M_one[l] = std::max(M_one[l], col);
+                        M_inf[l] = std::max(M_inf[l], row);
+                    }
+                }
+            for (int l = 0; l < bs; l++) {
+                if (!frozen[l] && E_one[l] <= M_one[l] * tolerance)
+                    frozen[l] = true;
+                if (!frozen[l])
+                    all_done = false;
+            }
+        }
+
+        // Q = Mk^T, lane by lane
+        for (int l = 0; l < lanes; l++) {
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    Q[9 * (base + l) + 3 * i + j] = Mk[3 * j + i][l];
+            det[base + l] = det_k[l];
+
+            if (singular[l]) {
+                double S[9];
+                det[base + l] = PolarDecomposition::Compute(M + 9 * (base + l), Q + 9 * (base + l), S, tolerance);
+            }
+        }
+    }
+}
+
 }  // end namespace fea
 }  // end namespace chrono
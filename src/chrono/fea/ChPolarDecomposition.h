@@ -87,6 +87,29 @@ class PolarDecomposition {
 
 // -----------------------------------------
 
+/// Batched polar decomposition of many 3x3 matrices.
+/// Runs the same iteration as PolarDecomposition::Compute, but over blocks of
+/// four matrices transposed into a structure-of-arrays layout, so the inner
+/// lane loops vectorize and blocks are distributed over OpenMP threads.
+/// Used by ChMesh to update the rotations of all corotational elements in one
+/// pass (see ChElementCorotational::ComputeCorotatedFrame).
+class ChApi ChPolarDecompositionBatch {
+  public:
+    /// Number of matrices processed together by the SIMD kernel.
+    static const int block_size = 4;
+
+    /// Compute the orthogonal factors of the polar decompositions M_i = Q_i * S_i
+    /// for 'count' row-major 3x3 matrices stored back to back in M.
+    /// On return, Q holds the 'count' orthogonal factors and det[i] has the sign
+    /// of det(Q_i), which can be -1 or +1 (as in PolarDecomposition::Compute).
+    /// The symmetric factors are not computed, since the corotational elements
+    /// do not use them. Matrices with zero determinant are delegated to the
+    /// scalar PolarDecomposition path.
+    static void Compute(const double* M, double* Q, double* det, int count, double tolerance = 1e-6);
+};
+
+// -----------------------------------------
+
 /// Perform a polar decomposition of a 3x3 P matrix in order to retrieve
 /// the orthogonal Q and the symmetric S form, as P=Q*S
 template <class Real = double>
@@ -0,0 +1,413 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cassert>
+#include <unordered_set>
+
+#include "chrono/core/ChLinearAlgebra.h"
+#include "chrono/fea/ChSuperElement.h"
+
+namespace chrono {
+namespace fea {
+
+ChSuperElement::ChSuperElement() : rayleigh_alpha(0), rayleigh_beta(0), n_dofs(0), n_dofs_w(0) {}
+
+// Store the reference placement of a node; 3-DOF nodes get an identity rotation.
+static void StoreReferencePlacement(ChNodeFEAbase* node, ChVector<>& pos, ChQuaternion<>& rot) {
+    if (auto nrot = dynamic_cast<ChNodeFEAxyzrot*>(node)) {
+        pos = nrot->GetPos();
+        rot = nrot->GetRot();
+    } else if (auto nxyz = dynamic_cast<ChNodeFEAxyz*>(node)) {
+        pos = nxyz->GetPos();
+        rot = QUNIT;
+    } else {
+        assert(false);  // unsupported node type
+    }
+}
+
+void ChSuperElement::SetupCondensation(std::shared_ptr<ChMesh> mesh,
+                                       const std::vector<std::shared_ptr<ChNodeFEAbase>>& boundary_nodes) {
+    full_mesh = mesh;
+    b_nodes.clear();
+    i_nodes.clear();
+
+    std::unordered_set<ChNodeFEAbase*> b_set;
+    for (const auto& node : boundary_nodes) {
+        if (!node->GetFixed())
+            b_set.insert(node.get());
+    }
+
+    // Partition the mesh nodes: boundary nodes keep the user-given order, the
+    // remaining non-fixed nodes become internal. Fixed nodes are left out (their
+    // DOFs do not enter the full matrices, exactly as in ChMesh::Setup).
+    for (const auto& node : boundary_nodes) {
+        if (!node->GetFixed())
+            b_nodes.push_back(node);
+    }
+    for (unsigned int i = 0; i < mesh->GetNnodes(); i++) {
+        auto node = std::dynamic_pointer_cast<ChNodeFEAbase>(mesh->GetNode(i));
+        if (node && !node->GetFixed() && b_set.find(node.get()) == b_set.end())
+            i_nodes.push_back(node);
+    }
+
+    // Boundary-first global numbering at velocity level
+    std::unordered_map<ChNodeFEAbase*, int> off_map;
+    int nb = 0;
+    for (const auto& node : b_nodes) {
+        off_map[node.get()] = nb;
+        nb += node->Get_ndof_w();
+    }
+    int ni = 0;
+    for (const auto& node : i_nodes) {
+        off_map[node.get()] = nb + ni;
+        ni += node->Get_ndof_w();
+    }
+    int n_full = nb + ni;
+
+    // Assemble the full stiffness and mass matrices from the element KRM blocks
+    ChMatrixDynamic<> K_full(n_full, n_full);
+    ChMatrixDynamic<> M_full(n_full, n_full);
+    for (unsigned int ie = 0; ie < mesh->GetNelements(); ie++) {
+        auto element = mesh->GetElement(ie);
+        int endofs = element->GetNdofs();
+        ChMatrixDynamic<> HK(endofs, endofs);
+        ChMatrixDynamic<> HM(endofs, endofs);
+        element->ComputeKRMmatricesGlobal(HK, 1, 0, 0);
+        element->ComputeKRMmatricesGlobal(HM, 0, 0, 1);
+
+        int loc_a = 0;
+        for (int na = 0; na < element->GetNnodes(); na++) {
+            int ndof_a = element->GetNodeNdofs(na);
+            auto it_a = off_map.find(element->GetNodeN(na).get());
+            if (it_a != off_map.end()) {
+                int loc_b = 0;
+                for (int nbn = 0; nbn < element->GetNnodes(); nbn++) {
+                    int ndof_b = element->GetNodeNdofs(nbn);
+                    auto it_b = off_map.find(element->GetNodeN(nbn).get());
+                    if (it_b != off_map.end()) {
+                        for (int i = 0; i < ndof_a; i++)
+                            for (int j = 0; j < ndof_b; j++) {
+                                K_full(it_a->second + i, it_b->second + j) += HK(loc_a + i, loc_b + j);
+                                M_full(it_a->second + i, it_b->second + j) += HM(loc_a + i, loc_b + j);
+                            }
+                    }
+                    loc_b += ndof_b;
+                }
+            }
+            loc_a += ndof_a;
+        }
+    }
+
+    // Partition the full matrices
+    ChMatrixDynamic<> Kbb(nb, nb), Kbi(nb, ni), Kib(ni, nb), Kii(ni, ni);
+    ChMatrixDynamic<> Mbb(nb, nb), Mbi(nb, ni), Mib(ni, nb), Mii(ni, ni);
+    Kbb.PasteClippedMatrix(K_full, 0, 0, nb, nb, 0, 0);
+    Kbi.PasteClippedMatrix(K_full, 0, nb, nb, ni, 0, 0);
+    Kib.PasteClippedMatrix(K_full, nb, 0, ni, nb, 0, 0);
+    Kii.PasteClippedMatrix(K_full, nb, nb, ni, ni, 0, 0);
+    Mbb.PasteClippedMatrix(M_full, 0, 0, nb, nb, 0, 0);
+    Mbi.PasteClippedMatrix(M_full, 0, nb, nb, ni, 0, 0);
+    Mib.PasteClippedMatrix(M_full, nb, 0, ni, nb, 0, 0);
+    Mii.PasteClippedMatrix(M_full, nb, nb, ni, ni, 0, 0);
+
+    // Static transformation T_int = -Kii^-1 * Kib, solving one column at a time
+    // with a single LU factorization of Kii
+    T_int.Reset(ni, nb);
+    if (ni > 0) {
+        std::vector<int> pivarray(ni);
+        double det;
+        ChLinearAlgebra::Decompose_LU(Kii, pivarray.data(), &det);
+        ChMatrixDynamic<> B(ni, 1), Xc(ni, 1);
+        for (int c = 0; c < nb; c++) {
+            for (int r = 0; r < ni; r++)
+                B(r, 0) = Kib(r, c);
+            ChLinearAlgebra::Solve_LU(Kii, &B, &Xc, pivarray.data());
+            for (int r = 0; r < ni; r++)
+                T_int(r, c) = -Xc(r, 0);
+        }
+    }
+
+    // K_red = Kbb + Kbi * T        (= Kbb - Kbi * Kii^-1 * Kib)
+    ChMatrixDynamic<> tmp(nb, nb);
+    K_red = Kbb;
+    tmp.MatrMultiply(Kbi, T_int);
+    K_red.MatrInc(tmp);
+
+    // M_red = Mbb + Mbi*T + T'*Mib + T'*Mii*T
+    M_red = Mbb;
+    tmp.MatrMultiply(Mbi, T_int);
+    M_red.MatrInc(tmp);
+    tmp.MatrTMultiply(T_int, Mib);
+    M_red.MatrInc(tmp);
+    ChMatrixDynamic<> MiiT(ni, nb);
+    MiiT.MatrMultiply(Mii, T_int);
+    tmp.MatrTMultiply(T_int, MiiT);
+    M_red.MatrInc(tmp);
+
+    // Store the reference configuration for the linearization
+    b_ref_pos.resize(b_nodes.size());
+    b_ref_rot.resize(b_nodes.size());
+    for (size_t j = 0; j < b_nodes.size(); j++)
+        StoreReferencePlacement(b_nodes[j].get(), b_ref_pos[j], b_ref_rot[j]);
+    i_ref_pos.resize(i_nodes.size());
+    i_ref_rot.resize(i_nodes.size());
+    for (size_t j = 0; j < i_nodes.size(); j++)
+        StoreReferencePlacement(i_nodes[j].get(), i_ref_pos[j], i_ref_rot[j]);
+
+    // The reduced matrices act on the variables of the boundary nodes
+    std::vector<ChVariables*> mvars;
+    for (const auto& node : b_nodes) {
+        if (auto nrot = dynamic_cast<ChNodeFEAxyzrot*>(node.get()))
+            mvars.push_back(&nrot->Variables());
+        else if (auto nxyz = dynamic_cast<ChNodeFEAxyz*>(node.get()))
+            mvars.push_back(&nxyz->Variables());
+        else
+            assert(false);  // unsupported node type
+    }
+    Kmatr.SetVariables(mvars);
+
+    Setup();
+}
+
+void ChSuperElement::ComputeBoundaryDisplacement(ChMatrixDynamic<>& u) const {
+    u.Reset(K_red.GetRows(), 1);
+    int off = 0;
+    for (size_t j = 0; j < b_nodes.size(); j++) {
+        if (auto nrot = dynamic_cast<ChNodeFEAxyzrot*>(b_nodes[j].get())) {
+            ChVector<> du = nrot->GetPos() - b_ref_pos[j];
+            ChVector<> dr = (b_ref_rot[j].GetConjugate() % nrot->GetRot()).Q_to_Rotv();
+            u.PasteVector(du, off, 0);
+            u.PasteVector(dr, off + 3, 0);
+        } else if (auto nxyz = dynamic_cast<ChNodeFEAxyz*>(b_nodes[j].get())) {
+            u.PasteVector(nxyz->GetPos() - b_ref_pos[j], off, 0);
+        }
+        off += b_nodes[j]->Get_ndof_w();
+    }
+}
+
+void ChSuperElement::ComputeBoundaryVelocity(ChMatrixDynamic<>& v) const {
+    v.Reset(K_red.GetRows(), 1);
+    int off = 0;
+    for (size_t j = 0; j < b_nodes.size(); j++) {
+        if (auto nrot = dynamic_cast<ChNodeFEAxyzrot*>(b_nodes[j].get())) {
+            v.PasteVector(nrot->GetPos_dt(), off, 0);
+            v.PasteVector(nrot->GetWvel_loc(), off + 3, 0);
+        } else if (auto nxyz = dynamic_cast<ChNodeFEAxyz*>(b_nodes[j].get())) {
+            v.PasteVector(nxyz->GetPos_dt(), off, 0);
+        }
+        off += b_nodes[j]->Get_ndof_w();
+    }
+}
+
+void ChSuperElement::ReconstructInternalNodes() {
+    if (i_nodes.empty() || T_int.GetColumns() == 0)
+        return;
+
+    ChMatrixDynamic<> u_b;
+    ComputeBoundaryDisplacement(u_b);
+    ChMatrixDynamic<> u_i(T_int.GetRows(), 1);
+    u_i.MatrMultiply(T_int, u_b);
+
+    int off = 0;
+    for (size_t j = 0; j < i_nodes.size(); j++) {
+        if (auto nrot = dynamic_cast<ChNodeFEAxyzrot*>(i_nodes[j].get())) {
+            nrot->SetPos(i_ref_pos[j] + u_i.ClipVector(off, 0));
+            ChQuaternion<> dq;
+            dq.Q_from_Rotv(u_i.ClipVector(off + 3, 0));
+            nrot->SetRot(i_ref_rot[j] % dq);
+        } else if (auto nxyz = dynamic_cast<ChNodeFEAxyz*>(i_nodes[j].get())) {
+            nxyz->SetPos(i_ref_pos[j] + u_i.ClipVector(off, 0));
+        }
+        off += i_nodes[j]->Get_ndof_w();
+    }
+}
+
+void ChSuperElement::Setup() {
+    n_dofs = 0;
+    n_dofs_w = 0;
+
+    state_nodes.clear();
+    state_nodes.reserve(b_nodes.size());
+
+    for (unsigned int i = 0; i < b_nodes.size(); i++) {
+        // Set node offsets in state vectors (based on the offsets of this superelement)
+        b_nodes[i]->NodeSetOffset_x(GetOffset_x() + n_dofs);
+        b_nodes[i]->NodeSetOffset_w(GetOffset_w() + n_dofs_w);
+        if (!b_nodes[i]->GetFixed()) {
+            state_nodes.push_back({b_nodes[i].get(), n_dofs, n_dofs_w});
+            n_dofs += b_nodes[i]->Get_ndof_x();
+            n_dofs_w += b_nodes[i]->Get_ndof_w();
+        }
+    }
+}
+
+void ChSuperElement::Update(double mytime, bool update_assets) {
+    ChPhysicsItem::Update(mytime, update_assets);
+}
+
+void ChSuperElement::SetNoSpeedNoAcceleration() {
+    for (unsigned int i = 0; i < b_nodes.size(); i++)
+        b_nodes[i]->SetNoSpeedNoAcceleration();
+}
+
+//// STATE BOOKKEEPING FUNCTIONS
+
+void ChSuperElement::IntStateGather(const unsigned int off_x,
+                                    ChState& x,
+                                    const unsigned int off_v,
+                                    ChStateDelta& v,
+                                    double& T) {
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateGather(off_x + state_nodes[j].off_x, x, off_v + state_nodes[j].off_w, v, T);
+    }
+
+    T = GetChTime();
+}
+
+void ChSuperElement::IntStateScatter(const unsigned int off_x,
+                                     const ChState& x,
+                                     const unsigned int off_v,
+                                     const ChStateDelta& v,
+                                     const double T) {
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateScatter(off_x + state_nodes[j].off_x, x, off_v + state_nodes[j].off_w, v, T);
+    }
+
+    Update(T);
+}
+
+void ChSuperElement::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateGatherAcceleration(off_a + state_nodes[j].off_w, a);
+    }
+}
+
+void ChSuperElement::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateScatterAcceleration(off_a + state_nodes[j].off_w, a);
+    }
+}
+
+void ChSuperElement::IntStateIncrement(const unsigned int off_x,
+                                       ChState& x_new,
+                                       const ChState& x,
+                                       const unsigned int off_v,
+                                       const ChStateDelta& Dv) {
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntStateIncrement(off_x + state_nodes[j].off_x, x_new, x,
+                                                   off_v + state_nodes[j].off_w, Dv);
+    }
+}
+
+void ChSuperElement::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    // applied nodal forces
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntLoadResidual_F(off + state_nodes[j].off_w, R, c);
+    }
+
+    // elastic (and Rayleigh damping) forces from the condensed matrices:
+    // R -= c * ( K_red * u_b + (alpha*M_red + beta*K_red) * v_b )
+    if (K_red.GetRows() == 0)
+        return;
+
+    ChMatrixDynamic<> u_b;
+    ComputeBoundaryDisplacement(u_b);
+    ChMatrixDynamic<> F(K_red.GetRows(), 1);
+    F.MatrMultiply(K_red, u_b);
+
+    if (rayleigh_alpha != 0 || rayleigh_beta != 0) {
+        ChMatrixDynamic<> v_b;
+        ComputeBoundaryVelocity(v_b);
+        ChMatrixDynamic<> Fd(K_red.GetRows(), 1);
+        Fd.MatrMultiply(M_red, v_b);
+        Fd.MatrScale(rayleigh_alpha);
+        F.MatrInc(Fd);
+        Fd.MatrMultiply(K_red, v_b);
+        Fd.MatrScale(rayleigh_beta);
+        F.MatrInc(Fd);
+    }
+
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        int ndof_w = state_nodes[j].node->Get_ndof_w();
+        for (int i = 0; i < ndof_w; i++)
+            R(off + state_nodes[j].off_w + i) -= c * F(state_nodes[j].off_w + i, 0);
+    }
+}
+
+void ChSuperElement::IntLoadResidual_Mv(const unsigned int off,
+                                        ChVectorDynamic<>& R,
+                                        const ChVectorDynamic<>& w,
+                                        const double c) {
+    // nodal masses
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntLoadResidual_Mv(off + state_nodes[j].off_w, R, w, c);
+    }
+
+    // condensed mass
+    if (M_red.GetRows() != n_dofs_w)
+        return;
+
+    ChMatrixDynamic<> w_b(n_dofs_w, 1);
+    for (int i = 0; i < n_dofs_w; i++)
+        w_b(i, 0) = w(off + i);
+    ChMatrixDynamic<> F(n_dofs_w, 1);
+    F.MatrMultiply(M_red, w_b);
+    for (int i = 0; i < n_dofs_w; i++)
+        R(off + i) += c * F(i, 0);
+}
+
+void ChSuperElement::IntToDescriptor(const unsigned int off_v,
+                                     const ChStateDelta& v,
+                                     const ChVectorDynamic<>& R,
+                                     const unsigned int off_L,
+                                     const ChVectorDynamic<>& L,
+                                     const ChVectorDynamic<>& Qc) {
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntToDescriptor(off_v + state_nodes[j].off_w, v, R);
+    }
+}
+
+void ChSuperElement::IntFromDescriptor(const unsigned int off_v,
+                                       ChStateDelta& v,
+                                       const unsigned int off_L,
+                                       ChVectorDynamic<>& L) {
+    for (size_t j = 0; j < state_nodes.size(); j++) {
+        state_nodes[j].node->NodeIntFromDescriptor(off_v + state_nodes[j].off_w, v);
+    }
+}
+
+//// SOLVER FUNCTIONS
+
+void ChSuperElement::InjectVariables(ChSystemDescriptor& mdescriptor) {
+    for (unsigned int i = 0; i < b_nodes.size(); i++)
+        b_nodes[i]->InjectVariables(mdescriptor);
+}
+
+void ChSuperElement::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
+    if (K_red.GetRows() > 0)
+        mdescriptor.InsertKblock(&Kmatr);
+}
+
+void ChSuperElement::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    ChMatrix<>* K = Kmatr.Get_K();
+    if (!K || K->GetRows() != K_red.GetRows())
+        return;
+
+    double kf = Kfactor + rayleigh_beta * Rfactor;
+    double mf = Mfactor + rayleigh_alpha * Rfactor;
+    for (int i = 0; i < K_red.GetRows(); i++)
+        for (int j = 0; j < K_red.GetColumns(); j++)
+            K->Element(i, j) = K_red(i, j) * kf + M_red(i, j) * mf;
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,190 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSUPERELEMENT_H
+#define CHSUPERELEMENT_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/physics/ChPhysicsItem.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+#include "chrono/fea/ChNodeFEAxyzrot.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup chrono_fea
+/// @{
+
+/// Condensed (reduced-order) representation of a ChMesh as a linear superelement.
+///
+/// At setup time, the full stiffness and mass matrices of the mesh are assembled
+/// from the element KRM blocks and statically condensed (Guyan reduction) onto the
+/// degrees of freedom of a user-selected set of interface ("boundary") nodes:
+///
+///    K_red = Kbb - Kbi * Kii^-1 * Kib,     M_red = T' * M * T
+///
+/// with T the static transformation from boundary to internal coordinates. Only
+/// the boundary DOFs are then exposed to the solver: the superelement injects the
+/// boundary node variables and a single ChKblockGeneric with the reduced matrices,
+/// so a frame with thousands of internal DOFs costs the solver only its few dozen
+/// interface coordinates. Internal node positions can be reconstructed on demand
+/// for output and visualization with ReconstructInternalNodes().
+///
+/// The reduction is linear (small deflections around the configuration at the time
+/// of SetupCondensation) and static: it is exact for static response at the
+/// interface and approximate for dynamics. The condensation keeps internal data
+/// structured so that a fixed-interface modal basis (Craig-Bampton) can augment
+/// the static modes, once an eigenvalue solver is available to compute them.
+///
+/// Usage: add the superelement to the system INSTEAD of the mesh (the mesh must
+/// not be in the system, otherwise its variables and stiffness would be counted
+/// twice). Links and loads can be attached to the boundary nodes as usual.
+class ChApi ChSuperElement : public ChPhysicsItem {
+  public:
+    ChSuperElement();
+    ChSuperElement(const ChSuperElement& other) = delete;
+    ~ChSuperElement() {}
+
+    /// "Virtual" copy constructor (not supported).
+    virtual ChSuperElement* Clone() const override { return nullptr; }
+
+    /// Build the condensation of the given mesh onto the given boundary nodes.
+    /// Assembles the full stiffness and mass matrices from the mesh elements (the
+    /// mesh must already be initialized, i.e. SetupInitial must have run on its
+    /// elements) and computes the reduced matrices. The current configuration is
+    /// taken as the reference for the linearization. Fixed nodes are excluded.
+    void SetupCondensation(std::shared_ptr<ChMesh> mesh,
+                           const std::vector<std::shared_ptr<ChNodeFEAbase>>& boundary_nodes);
+
+    /// Set the Rayleigh damping coefficients used for the reduced damping matrix
+    /// R_red = alpha * M_red + beta * K_red (default: 0, 0).
+    void SetRayleighDamping(double alpha, double beta) {
+        rayleigh_alpha = alpha;
+        rayleigh_beta = beta;
+    }
+
+    /// Get the condensed stiffness matrix (boundary DOFs only).
+    const ChMatrixDynamic<>& GetReducedStiffness() const { return K_red; }
+    /// Get the condensed mass matrix (boundary DOFs only).
+    const ChMatrixDynamic<>& GetReducedMass() const { return M_red; }
+
+    /// Get the number of boundary (interface) nodes.
+    int GetNboundaryNodes() const { return (int)b_nodes.size(); }
+    /// Get the number of internal (condensed) nodes.
+    int GetNinternalNodes() const { return (int)i_nodes.size(); }
+
+    /// Recompute the positions of the internal nodes from the current boundary
+    /// displacements, through the static transformation. Call before output or
+    /// visualization; the internal nodes are not advanced by the solver.
+    void ReconstructInternalNodes();
+
+    //
+    // PHYSICS ITEM INTERFACE
+    //
+
+    virtual int GetDOF() override { return n_dofs; }
+    virtual int GetDOF_w() override { return n_dofs_w; }
+
+    virtual void Setup() override;
+    virtual void Update(double mytime, bool update_assets = true) override;
+
+    virtual void SetNoSpeedNoAcceleration() override;
+
+    // (interfaces for global state vectors, see ChPhysicsItem for comments.)
+    virtual void IntStateGather(const unsigned int off_x,
+                                ChState& x,
+                                const unsigned int off_v,
+                                ChStateDelta& v,
+                                double& T) override;
+    virtual void IntStateScatter(const unsigned int off_x,
+                                 const ChState& x,
+                                 const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const double T) override;
+    virtual void IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) override;
+    virtual void IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) override;
+    virtual void IntStateIncrement(const unsigned int off_x,
+                                   ChState& x_new,
+                                   const ChState& x,
+                                   const unsigned int off_v,
+                                   const ChStateDelta& Dv) override;
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+    virtual void IntLoadResidual_Mv(const unsigned int off,
+                                    ChVectorDynamic<>& R,
+                                    const ChVectorDynamic<>& w,
+                                    const double c) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    // SOLVER FUNCTIONS
+
+    virtual void InjectVariables(ChSystemDescriptor& mdescriptor) override;
+    virtual void InjectKRMmatrices(ChSystemDescriptor& mdescriptor) override;
+    virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) override;
+
+  private:
+    /// Per-node bookkeeping for the boundary nodes.
+    struct NodeEntry {
+        ChNodeFEAbase* node;  ///< the boundary node
+        int off_x;            ///< local offset in the (position-level) superelement state
+        int off_w;            ///< local offset in the (velocity-level) superelement state
+    };
+
+    /// Compute the current boundary displacement u_b (velocity-level size) with
+    /// respect to the reference configuration stored at SetupCondensation time.
+    void ComputeBoundaryDisplacement(ChMatrixDynamic<>& u) const;
+
+    /// Compute the current boundary velocity v_b (velocity-level size).
+    void ComputeBoundaryVelocity(ChMatrixDynamic<>& v) const;
+
+    std::shared_ptr<ChMesh> full_mesh;                        ///< the condensed mesh
+    std::vector<std::shared_ptr<ChNodeFEAbase>> b_nodes;      ///< boundary (interface) nodes
+    std::vector<std::shared_ptr<ChNodeFEAbase>> i_nodes;      ///< internal (condensed) nodes
+
+    std::vector<NodeEntry> state_nodes;  ///< boundary nodes with cached local state offsets
+
+    ChMatrixDynamic<> K_red;  ///< condensed stiffness matrix (nb x nb)
+    ChMatrixDynamic<> M_red;  ///< condensed mass matrix (nb x nb)
+    ChMatrixDynamic<> T_int;  ///< static transformation: u_internal = T_int * u_boundary (ni x nb)
+
+    std::vector<ChVector<>> b_ref_pos;      ///< reference positions of the boundary nodes
+    std::vector<ChQuaternion<>> b_ref_rot;  ///< reference rotations of the boundary nodes (identity for 3-DOF nodes)
+    std::vector<ChVector<>> i_ref_pos;      ///< reference positions of the internal nodes
+    std::vector<ChQuaternion<>> i_ref_rot;  ///< reference rotations of the internal nodes
+
+    ChKblockGeneric Kmatr;  ///< solver block with the reduced matrices, over the boundary variables
+
+    double rayleigh_alpha;  ///< mass-proportional damping coefficient
+    double rayleigh_beta;   ///< stiffness-proportional damping coefficient
+
+    int n_dofs;    ///< number of boundary coordinates at position level
+    int n_dofs_w;  ///< number of boundary coordinates at velocity level
+};
+
+/// @} chrono_fea
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
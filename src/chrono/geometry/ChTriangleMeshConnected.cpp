@@ -39,12 +39,15 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <map>
 #include <unordered_map>
 
 #include "chrono/core/ChLinearAlgebra.h"
+#include "chrono/core/ChTransform.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 
 namespace chrono {
@@ -890,6 +893,93 @@ void ChTriangleMeshConnected::ComputeMassProperties(bool bodyCoords,
 
 using namespace WAVEFRONT;
 
+// -----------------------------------------------------------------------------
+// Sidecar binary cache for Wavefront meshes ('.chbm' blobs)
+
+bool ChTriangleMeshConnected::m_use_binary_cache = false;
+
+static const char chbm_magic[8] = {'C', 'H', 'B', 'M', 'E', 'S', 'H', '1'};
+
+// Current size of a file, 0 if not accessible.
+static uint64_t chbm_file_size(const std::string& name) {
+    std::ifstream file(name.c_str(), std::ios::binary | std::ios::ate);
+    return file.good() ? (uint64_t)file.tellg() : 0;
+}
+
+template <class T>
+static void chbm_write_array(std::ofstream& out, const std::vector<T>& data) {
+    uint64_t count = data.size();
+    out.write((const char*)&count, sizeof(count));
+    if (count)
+        out.write((const char*)data.data(), count * sizeof(T));
+}
+
+template <class T>
+static bool chbm_read_array(std::ifstream& in, std::vector<T>& data, uint64_t max_bytes) {
+    uint64_t count = 0;
+    in.read((char*)&count, sizeof(count));
+    if (!in.good() || count * sizeof(T) > max_bytes)
+        return false;
+    data.resize((size_t)count);
+    if (count)
+        in.read((char*)data.data(), count * sizeof(T));
+    return in.good();
+}
+
+bool ChTriangleMeshConnected::WriteBinaryCache(const std::string& cache_filename,
+                                               const std::string& source_filename) const {
+    std::ofstream out(cache_filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out.good())
+        return false;
+
+    out.write(chbm_magic, sizeof(chbm_magic));
+    uint32_t endian = 0x01020304;
+    out.write((const char*)&endian, sizeof(endian));
+    uint64_t source_size = source_filename.empty() ? 0 : chbm_file_size(source_filename);
+    out.write((const char*)&source_size, sizeof(source_size));
+
+    chbm_write_array(out, m_vertices);
+    chbm_write_array(out, m_normals);
+    chbm_write_array(out, m_UV);
+    chbm_write_array(out, m_face_v_indices);
+    chbm_write_array(out, m_face_n_indices);
+    chbm_write_array(out, m_face_uv_indices);
+
+    return out.good();
+}
+
+bool ChTriangleMeshConnected::LoadBinaryCache(const std::string& cache_filename, const std::string& source_filename) {
+    uint64_t cache_size = chbm_file_size(cache_filename);
+    if (cache_size == 0)
+        return false;
+
+    std::ifstream in(cache_filename.c_str(), std::ios::binary);
+    if (!in.good())
+        return false;
+
+    char magic[8];
+    in.read(magic, sizeof(magic));
+    if (!in.good() || memcmp(magic, chbm_magic, sizeof(magic)) != 0)
+        return false;
+    uint32_t endian = 0;
+    in.read((char*)&endian, sizeof(endian));
+    if (!in.good() || endian != 0x01020304)
+        return false;
+    uint64_t source_size = 0;
+    in.read((char*)&source_size, sizeof(source_size));
+    if (!in.good())
+        return false;
+    // staleness check: the cache must refer to the source file as it is now
+    if (!source_filename.empty() && source_size != chbm_file_size(source_filename))
+        return false;
+
+    return chbm_read_array(in, m_vertices, cache_size) && chbm_read_array(in, m_normals, cache_size) &&
+           chbm_read_array(in, m_UV, cache_size) && chbm_read_array(in, m_face_v_indices, cache_size) &&
+           chbm_read_array(in, m_face_n_indices, cache_size) && chbm_read_array(in, m_face_uv_indices, cache_size);
+}
+
+// -----------------------------------------------------------------------------
+
 void ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_normals, bool load_uv) {
     this->m_vertices.clear();
     this->m_normals.clear();
@@ -902,6 +992,29 @@ void ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_
 
     m_filename = filename;
 
+    std::string cache_filename = filename + ".chbm";
+
+    if (m_use_binary_cache) {
+        if (LoadBinaryCache(cache_filename, filename)) {
+            if (!load_normals) {
+                this->m_normals.clear();
+                this->m_face_n_indices.clear();
+            }
+            if (!load_uv) {
+                this->m_UV.clear();
+                this->m_face_uv_indices.clear();
+            }
+            return;
+        }
+        // cache missing, stale, or corrupt: discard any partial data and parse the .obj
+        this->m_vertices.clear();
+        this->m_normals.clear();
+        this->m_UV.clear();
+        this->m_face_v_indices.clear();
+        this->m_face_n_indices.clear();
+        this->m_face_uv_indices.clear();
+    }
+
     OBJ obj;
 
     obj.LoadMesh(filename.c_str(), &emptybm, true);
@@ -929,6 +1042,12 @@ void ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_
             ChVector<int>(obj.mIndexesTexels[iit], obj.mIndexesTexels[iit + 1], obj.mIndexesTexels[iit + 2]));
     }
 
+    // Refresh the binary cache with the full parsed data (before any selective
+    // clearing below), so the next load skips the text parsing. Failures are
+    // ignored: the cache is an optimization, not a requirement.
+    if (m_use_binary_cache)
+        WriteBinaryCache(cache_filename, filename);
+
     if (!load_normals) {
         this->m_normals.clear();
         this->m_face_n_indices.clear();
@@ -1136,10 +1255,8 @@ ChTriangleMeshConnected ChTriangleMeshConnected::Merge(std::vector<ChTriangleMes
 }
 
 void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33<> rotscale) {
-    for (int i = 0; i < m_vertices.size(); ++i) {
-        m_vertices[i] = rotscale * m_vertices[i];
-        m_vertices[i] += displ;
-    }
+    ChTransformBatch::TransformLocalToParent((int)m_vertices.size(), m_vertices.data(), m_vertices.data(), displ,
+                                             rotscale);
     for (int i = 0; i < m_normals.size(); ++i) {
         m_normals[i] = rotscale * m_normals[i];
         m_normals[i].Normalize();
@@ -1618,7 +1735,7 @@ bool ChTriangleMeshConnected::SplitEdge(
 
 // Performs mesh refinement using Rivara LEPP long-edge bisection algorithm.
 // Based on "Multithread parallelization of Lepp-bisection algorithms"
-//    M.-C. Rivara et al., Applied Numerical Mathematics 62 (2012) 473�488
+//    M.-C. Rivara et al., Applied Numerical Mathematics 62 (2012) 473�488
 
 void ChTriangleMeshConnected::RefineMeshEdges(
     std::vector<int>&
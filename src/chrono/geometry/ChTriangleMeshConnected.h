@@ -41,6 +41,8 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
 
     std::string m_filename;  ///< file string if loading an obj file
 
+    static bool m_use_binary_cache;  ///< use the sidecar binary cache in LoadWavefrontMesh()
+
   public:
     ChTriangleMeshConnected() {}
     ChTriangleMeshConnected(const ChTriangleMeshConnected& source);
@@ -62,6 +64,23 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Load a triangle mesh saved as a Wavefront .obj file
     void LoadWavefrontMesh(std::string filename, bool load_normals = true, bool load_uv = false);
 
+    /// Enable/disable the sidecar binary cache for LoadWavefrontMesh() (default: disabled).
+    /// When enabled, the first load of an .obj file writes a '<filename>.chbm' blob next to
+    /// it (vertices, normals, UVs and index arrays as raw binary), and subsequent loads read
+    /// the blob with bulk reads instead of text-parsing the .obj. A cache whose recorded
+    /// source file size no longer matches the .obj is considered stale and re-generated.
+    static void EnableBinaryCache(bool val) { m_use_binary_cache = val; }
+
+    /// Write the mesh data as a '.chbm' binary cache blob (see EnableBinaryCache).
+    /// If a source filename is given, its current file size is recorded in the header for
+    /// staleness detection. Returns false on I/O failure.
+    bool WriteBinaryCache(const std::string& cache_filename, const std::string& source_filename = "") const;
+
+    /// Load the mesh data from a '.chbm' binary cache blob (see EnableBinaryCache).
+    /// If a source filename is given, the cache is rejected when the recorded source file
+    /// size does not match. Returns false if the cache is missing, stale, or corrupt.
+    bool LoadBinaryCache(const std::string& cache_filename, const std::string& source_filename = "");
+
     /// Write the specified meshes in a Wavefront .obj file
     static void WriteWavefront(const std::string& filename, std::vector<ChTriangleMeshConnected>& meshes);
 
@@ -199,7 +218,7 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// tends to produce triangles with bounded angles even if starting from skewed/skinny
     /// triangles in the coarse mesh.
     /// Based on "Multithread parallelization of Lepp-bisection algorithms"
-    ///    M.-C. Rivara et al., Applied Numerical Mathematics 62 (2012) 473�488
+    ///    M.-C. Rivara et al., Applied Numerical Mathematics 62 (2012) 473�488
 
     void RefineMeshEdges(
         std::vector<int>& marked_tris,     ///< indexes of triangles to refine (also surrounding triangles might be
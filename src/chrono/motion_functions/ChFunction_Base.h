@@ -101,6 +101,15 @@ class ChApi ChFunction {
     /// is known, it may be better to implement a custom method).
     virtual double Get_y_dxdx(double x) const { return ((Get_y_dx(x + BDF_STEP_LOW) - Get_y_dx(x)) / BDF_STEP_LOW); };
 
+    /// Evaluate the function at each of the n positions in x, writing the results into y.
+    /// The base implementation simply loops over Get_y(); functions backed by tabulated
+    /// data may override this to amortize the table lookup over the whole batch (most
+    /// effective when the x values are in ascending order, as when sampling in time).
+    virtual void Get_y_batch(const double* x, double* y, int n) const {
+        for (int i = 0; i < n; i++)
+            y[i] = Get_y(x[i]);
+    }
+
     /// Return the weight of the function (useful for
     /// applications where you need to mix different weighted ChFunctions)
     virtual double Get_weight(double x) const { return 1.0; };
@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <vector>
+
 #include "chrono/motion_functions/ChFunction_Oscilloscope.h"
 
 namespace chrono {
@@ -60,14 +62,14 @@ double ChFunction_Oscilloscope::Get_y(double x) const {
     int i2 = i1 + 1;
     double p1x = start_x + dx * (double)i1;
     double p2x = start_x + dx * (double)i2;
-    double p2y, p1y = 0;
+    double p2y = 0, p1y = 0;
     int count = 0;
     std::list<double>::const_iterator iter = values.begin();
     while (iter != values.end()) {
         if (count == i1) {
-            p2y = *iter;
-            iter++;
             p1y = *iter;
+            iter++;
+            p2y = (iter != values.end()) ? *iter : p1y;
             break;
         }
         count++;
@@ -79,6 +81,32 @@ double ChFunction_Oscilloscope::Get_y(double x) const {
     return y;
 }
 
+void ChFunction_Oscilloscope::Get_y_batch(const double* x, double* y, int n) const {
+    // Copy the list once into a contiguous buffer, so each sample costs an O(1)
+    // indexed lookup instead of a list traversal.
+    std::vector<double> vals(values.begin(), values.end());
+
+    double start_x = this->end_x - this->dx * (this->amount - 1);
+
+    for (int i = 0; i < n; i++) {
+        double xi = x[i];
+        if (xi > end_x || xi < start_x || vals.empty()) {
+            y[i] = 0;
+            continue;
+        }
+        int i1 = (int)floor((xi - start_x) / this->dx);
+        if (i1 >= (int)vals.size() - 1) {
+            y[i] = vals.back();
+            continue;
+        }
+        double p1x = start_x + dx * (double)i1;
+        double p2x = p1x + dx;
+        double p1y = vals[i1];
+        double p2y = vals[i1 + 1];
+        y[i] = ((xi - p1x) * p2y + (p2x - xi) * p1y) / (p2x - p1x);
+    }
+}
+
 void ChFunction_Oscilloscope::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChFunction_Oscilloscope>();
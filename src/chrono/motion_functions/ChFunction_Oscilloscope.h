@@ -49,6 +49,11 @@ class ChApi ChFunction_Oscilloscope : public ChFunction {
 
     virtual double Get_y(double x) const override;
 
+    /// Batched evaluation: the list of values is copied once into a contiguous
+    /// buffer, so each of the n samples is then served by an O(1) indexed lookup
+    /// instead of a list traversal.
+    virtual void Get_y_batch(const double* x, double* y, int n) const override;
+
     /// Add a point at the head (right side of point array).
     /// Note that it is user's responsibility to add points
     /// which are spaced uniformly (by dx) on the X axis!
@@ -25,6 +25,9 @@ CH_FACTORY_REGISTER(ChFunction_Recorder)
 ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other) {
     m_points = other.m_points;
     m_last = m_points.end();
+    m_cache_x = 0;
+    m_cache_y = 0;
+    m_cache_valid = false;
 }
 
 void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
@@ -41,6 +44,8 @@ void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
 }
 
 void ChFunction_Recorder::AddPoint(double mx, double my, double mw) {
+    m_cache_valid = false;
+
     for (auto iter = m_points.rbegin(); iter != m_points.rend(); ++iter) {
         double dist = mx - iter->x;
         if (std::abs(dist) < std::numeric_limits<double>::epsilon()) {
@@ -66,6 +71,20 @@ double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
 }
 
 double ChFunction_Recorder::Get_y(double x) const {
+    // One-entry memo cache: within a time step the same x is often requested several
+    // times (e.g. by different links sharing the function), so reuse the last result.
+    if (m_cache_valid && x == m_cache_x) {
+        return m_cache_y;
+    }
+
+    m_cache_x = x;
+    m_cache_y = ComputeY(x);
+    m_cache_valid = true;
+
+    return m_cache_y;
+}
+
+double ChFunction_Recorder::ComputeY(double x) const {
     if (m_points.empty()) {
         return 0;
     }
@@ -106,6 +125,42 @@ double ChFunction_Recorder::Get_y(double x) const {
     return 0;
 }
 
+void ChFunction_Recorder::Get_y_batch(const double* x, double* y, int n) const {
+    // An ascending batch can be served by a single forward sweep through the list;
+    // otherwise fall back on pointwise evaluation (which is itself hinted by m_last).
+    bool ascending = true;
+    for (int i = 1; i < n; i++) {
+        if (x[i] < x[i - 1]) {
+            ascending = false;
+            break;
+        }
+    }
+
+    if (!ascending || m_points.size() < 2) {
+        for (int i = 0; i < n; i++)
+            y[i] = Get_y(x[i]);
+        return;
+    }
+
+    auto it2 = m_points.begin();
+    auto it1 = it2++;
+
+    for (int i = 0; i < n; i++) {
+        double xi = x[i];
+        if (xi <= m_points.front().x) {
+            y[i] = m_points.front().y;
+        } else if (xi >= m_points.back().x) {
+            y[i] = m_points.back().y;
+        } else {
+            while (xi > it2->x) {
+                it1 = it2;
+                ++it2;
+            }
+            y[i] = Interpolate_y(xi, *it1, *it2);
+        }
+    }
+}
+
 double ChFunction_Recorder::Get_y_dx(double x) const {
     //// TODO:  can we do better?
     return ChFunction::Get_y_dx(x);
@@ -136,6 +191,8 @@ void ChFunction_Recorder::ArchiveIN(ChArchiveIn& marchive) {
     marchive >> CHNVP(tmpvect);
     m_points.clear();
     std::copy(tmpvect.begin(), tmpvect.end(), std::back_inserter(m_points));
+    m_last = m_points.end();
+    m_cache_valid = false;
 }
 
 }  // end namespace chrono
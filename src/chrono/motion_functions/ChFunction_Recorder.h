@@ -53,8 +53,14 @@ class ChApi ChFunction_Recorder : public ChFunction {
     std::list<ChRecPoint> m_points;  ///< the list of points
     mutable std::list<ChRecPoint>::const_iterator m_last;
 
+    mutable double m_cache_x;     ///< argument of the last pointwise evaluation
+    mutable double m_cache_y;     ///< result of the last pointwise evaluation
+    mutable bool m_cache_valid;   ///< tell if the cached evaluation can be reused
+
+    double ComputeY(double x) const;
+
   public:
-    ChFunction_Recorder() : m_last(m_points.end()) {}
+    ChFunction_Recorder() : m_last(m_points.end()), m_cache_x(0), m_cache_y(0), m_cache_valid(false) {}
     ChFunction_Recorder(const ChFunction_Recorder& other);
     ~ChFunction_Recorder() {}
 
@@ -67,11 +73,16 @@ class ChApi ChFunction_Recorder : public ChFunction {
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
 
+    /// Batched evaluation: a single forward sweep through the point list serves an
+    /// entire ascending batch, instead of one hinted search per sample.
+    virtual void Get_y_batch(const double* x, double* y, int n) const override;
+
     void AddPoint(double mx, double my, double mw = 1);
 
     void Reset() {
         m_points.clear();
         m_last = m_points.end();
+        m_cache_valid = false;
     }
 
     const std::list<ChRecPoint>& GetPoints() { return m_points; }
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "chrono/parallel/ChSystemBatch.h"
+
+#include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+ChSystemBatch::ChSystemBatch(ChTaskScheduler* scheduler)
+    : m_scheduler(scheduler ? scheduler : &ChTaskScheduler::GetGlobal()) {}
+
+int ChSystemBatch::AddSystem(std::shared_ptr<ChSystem> system) {
+    m_systems.push_back(system);
+    return (int)m_systems.size() - 1;
+}
+
+void ChSystemBatch::DoStepDynamics(double step_size, int num_substeps) {
+    ChTaskGroup group;
+    for (auto& system : m_systems) {
+        ChSystem* sys = system.get();
+        m_scheduler->Submit(group, [sys, step_size, num_substeps]() {
+            for (int i = 0; i < num_substeps; i++)
+                sys->DoStepDynamics(step_size);
+        });
+    }
+    m_scheduler->Wait(group);
+}
+
+// Content fingerprint of a triangle mesh (FNV-1a hash of the vertex and face arrays).
+static uint64_t MeshFingerprint(geometry::ChTriangleMeshConnected& mesh) {
+    uint64_t h = 14695981039346656037ULL;
+    auto hash_bytes = [&h](const void* data, size_t size) {
+        const unsigned char* bytes = (const unsigned char*)data;
+        for (size_t i = 0; i < size; i++) {
+            h ^= bytes[i];
+            h *= 1099511628211ULL;
+        }
+    };
+    auto& vertices = mesh.getCoordsVertices();
+    auto& faces = mesh.getIndicesVertexes();
+    size_t nv = vertices.size();
+    size_t nf = faces.size();
+    hash_bytes(&nv, sizeof(nv));
+    hash_bytes(&nf, sizeof(nf));
+    if (nv > 0)
+        hash_bytes(vertices.data(), nv * sizeof(vertices[0]));
+    if (nf > 0)
+        hash_bytes(faces.data(), nf * sizeof(faces[0]));
+    return h;
+}
+
+int ChSystemBatch::DeduplicateSharedAssets() {
+    // Canonical mesh instance for each content fingerprint seen so far.
+    std::unordered_map<uint64_t, std::shared_ptr<geometry::ChTriangleMeshConnected>> canonical;
+    int num_replaced = 0;
+
+    for (auto& system : m_systems) {
+        for (auto& body : system->Get_bodylist()) {
+            for (auto& asset : body->GetAssets()) {
+                auto mesh_shape = std::dynamic_pointer_cast<ChTriangleMeshShape>(asset);
+                if (!mesh_shape || !mesh_shape->GetMesh())
+                    continue;
+                auto mesh = mesh_shape->GetMesh();
+                uint64_t fingerprint = MeshFingerprint(*mesh);
+                auto entry = canonical.find(fingerprint);
+                if (entry == canonical.end()) {
+                    canonical[fingerprint] = mesh;
+                } else if (entry->second != mesh) {
+                    mesh_shape->SetMesh(entry->second);
+                    num_replaced++;
+                }
+            }
+        }
+    }
+
+    return num_replaced;
+}
+
+}  // end namespace chrono
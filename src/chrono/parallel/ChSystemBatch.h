@@ -0,0 +1,81 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSYSTEMBATCH_H
+#define CHSYSTEMBATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/parallel/ChTaskScheduler.h"
+
+namespace chrono {
+
+class ChSystem;
+
+/// Batch executor for many small independent ChSystem instances (parameter
+/// sweeps, reinforcement-learning environments, Monte Carlo studies).
+///
+/// The systems are advanced by the persistent work-stealing pool of a
+/// ChTaskScheduler: each macro-step submits one task per system and waits once,
+/// so there is a single synchronization point per macro-step regardless of the
+/// number of systems and substeps. Work stealing keeps the pool busy when the
+/// systems have uneven cost (e.g. different contact counts per environment).
+///
+/// Since the batched systems typically share their static geometry,
+/// DeduplicateSharedAssets() collapses identical ChTriangleMeshConnected
+/// instances referenced by the visualization assets of all batched systems to
+/// one shared copy, cutting the per-system memory footprint.
+///
+/// The executor does not own the scheduler: by default it uses the process-wide
+/// instance from ChTaskScheduler::GetGlobal(), so several batches (and other
+/// scheduler users) share the same worker threads.
+class ChApi ChSystemBatch {
+  public:
+    /// Create a batch executor using the given scheduler
+    /// (default: the process-wide scheduler).
+    explicit ChSystemBatch(ChTaskScheduler* scheduler = nullptr);
+
+    /// Add a system to the batch. Return its index in the batch.
+    int AddSystem(std::shared_ptr<ChSystem> system);
+
+    /// Return the number of systems in the batch.
+    int GetNumSystems() const { return (int)m_systems.size(); }
+
+    /// Access the system with given index.
+    std::shared_ptr<ChSystem> GetSystem(int index) const { return m_systems[index]; }
+
+    /// Advance all systems by num_substeps dynamics steps of the given size.
+    /// One task per system is submitted to the scheduler; each task performs all
+    /// its substeps back to back, and the calling thread participates in the
+    /// execution. Returns after all systems completed the macro-step (the only
+    /// synchronization point).
+    void DoStepDynamics(double step_size, int num_substeps = 1);
+
+    /// Collapse identical triangle meshes referenced by the visualization assets
+    /// of the bodies of all batched systems to one shared instance. Meshes are
+    /// compared by content (vertex and face arrays), so systems built
+    /// independently from the same source data are deduplicated as well.
+    /// Returns the number of replaced mesh instances.
+    /// Call it after the batch is populated; the shared meshes must then be
+    /// treated as read-only.
+    int DeduplicateSharedAssets();
+
+  private:
+    std::vector<std::shared_ptr<ChSystem>> m_systems;  ///< the batched systems
+    ChTaskScheduler* m_scheduler;                      ///< executor pool (not owned)
+};
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,297 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <chrono>
+#include <cstdint>
+
+#include "chrono/parallel/ChTaskScheduler.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+// Chase-Lev work-stealing deque.
+// The owning worker pushes and pops at the bottom; thieves take from the top.
+// Only the owner may call Push/Pop and grow the backing array; retired arrays
+// are kept alive until destruction so that concurrent thieves never read freed
+// memory (the classic Chase-Lev reclamation scheme).
+// -----------------------------------------------------------------------------
+
+class ChTaskScheduler::WorkDeque {
+  public:
+    WorkDeque(int64_t capacity = 64) : m_top(0), m_bottom(0) {
+        m_array.store(new RingArray(capacity), std::memory_order_relaxed);
+    }
+
+    ~WorkDeque() { delete m_array.load(std::memory_order_relaxed); }
+
+    /// Push a task at the bottom (owner only).
+    void Push(Task* task) {
+        int64_t b = m_bottom.load(std::memory_order_relaxed);
+        int64_t t = m_top.load(std::memory_order_acquire);
+        RingArray* a = m_array.load(std::memory_order_relaxed);
+
+        if (b - t >= a->capacity - 1) {
+            a = Grow(a, t, b);
+        }
+
+        a->Put(b, task);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /// Pop a task from the bottom (owner only). Return NULL if empty.
+    Task* Pop() {
+        int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+        RingArray* a = m_array.load(std::memory_order_relaxed);
+        m_bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = m_top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Deque was already empty; restore the invariant.
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return NULL;
+        }
+
+        Task* task = a->Get(b);
+        if (t == b) {
+            // Last element: race against thieves for it.
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                task = NULL;
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    /// Steal a task from the top (any thread). Return NULL on failure.
+    Task* Steal() {
+        int64_t t = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = m_bottom.load(std::memory_order_acquire);
+
+        if (t >= b)
+            return NULL;
+
+        RingArray* a = m_array.load(std::memory_order_acquire);
+        Task* task = a->Get(t);
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return NULL;
+        return task;
+    }
+
+  private:
+    /// Circular array of task pointers, with power-of-two capacity.
+    struct RingArray {
+        int64_t capacity;
+        std::unique_ptr<std::atomic<Task*>[]> slots;
+
+        RingArray(int64_t c) : capacity(c), slots(new std::atomic<Task*>[c]) {}
+
+        Task* Get(int64_t i) const { return slots[i & (capacity - 1)].load(std::memory_order_relaxed); }
+        void Put(int64_t i, Task* task) { slots[i & (capacity - 1)].store(task, std::memory_order_relaxed); }
+    };
+
+    RingArray* Grow(RingArray* a, int64_t t, int64_t b) {
+        RingArray* bigger = new RingArray(2 * a->capacity);
+        for (int64_t i = t; i < b; i++)
+            bigger->Put(i, a->Get(i));
+        m_retired.emplace_back(a);
+        m_array.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+    std::atomic<int64_t> m_top;
+    std::atomic<int64_t> m_bottom;
+    std::atomic<RingArray*> m_array;
+    std::vector<std::unique_ptr<RingArray>> m_retired;  ///< outgrown arrays, kept until destruction
+};
+
+// -----------------------------------------------------------------------------
+
+struct ChTaskScheduler::Worker {
+    WorkDeque deque;
+    std::thread thread;
+};
+
+namespace {
+// Worker identity of the current thread, used to route Submit() to the caller's
+// own deque and to let Wait() help with execution.
+thread_local ChTaskScheduler* tls_scheduler = NULL;
+thread_local int tls_worker_index = -1;
+}  // namespace
+
+ChTaskScheduler::ChTaskScheduler(int num_threads) : m_sleepers(0), m_done(false) {
+    if (num_threads <= 0) {
+        num_threads = (int)std::thread::hardware_concurrency() - 1;
+        if (num_threads < 1)
+            num_threads = 1;
+    }
+
+    for (int i = 0; i < num_threads; i++)
+        m_workers.emplace_back(new Worker);
+
+    // Start the threads only after all deques exist, since workers steal from each other.
+    for (int i = 0; i < num_threads; i++)
+        m_workers[i]->thread = std::thread(&ChTaskScheduler::WorkerLoop, this, i);
+}
+
+ChTaskScheduler::~ChTaskScheduler() {
+    // Drain the injection queue, then stop and join the workers.
+    for (;;) {
+        Task* task;
+        {
+            std::lock_guard<std::mutex> lock(m_injected_mutex);
+            if (m_injected.empty())
+                break;
+            task = m_injected.front();
+            m_injected.pop_front();
+        }
+        ExecuteTask(task);
+    }
+
+    m_done.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_sleep_cond.notify_all();
+    }
+    for (auto& worker : m_workers)
+        worker->thread.join();
+}
+
+void ChTaskScheduler::Submit(ChTaskGroup& group, std::function<void()> task) {
+    group.m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    Task* t = new Task;
+    t->fn = std::move(task);
+    t->group = &group;
+
+    if (tls_scheduler == this && tls_worker_index >= 0) {
+        // Called from one of our workers: push onto its own deque (owner-only operation).
+        m_workers[tls_worker_index]->deque.Push(t);
+    } else {
+        std::lock_guard<std::mutex> lock(m_injected_mutex);
+        m_injected.push_back(t);
+    }
+
+    // Wake a parked worker, if any. Workers that are merely spinning pick the
+    // task up without paying any wakeup latency.
+    if (m_sleepers.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_sleep_cond.notify_one();
+    }
+}
+
+void ChTaskScheduler::Wait(ChTaskGroup& group) {
+    while (!group.IsDone()) {
+        if (!HelpOnce(tls_scheduler == this ? tls_worker_index : -1))
+            std::this_thread::yield();
+    }
+}
+
+void ChTaskScheduler::ParallelFor(int first, int last, int grain, const std::function<void(int, int)>& body) {
+    if (last <= first)
+        return;
+    if (grain < 1)
+        grain = 1;
+
+    // Keep the first chunk for the calling thread; submit the rest.
+    int second_chunk = (last - first > grain) ? first + grain : last;
+
+    ChTaskGroup group;
+    for (int c = second_chunk; c < last; c += grain) {
+        int c_end = (c + grain < last) ? c + grain : last;
+        Submit(group, [&body, c, c_end]() { body(c, c_end); });
+    }
+
+    body(first, second_chunk);
+    Wait(group);
+}
+
+ChTaskScheduler& ChTaskScheduler::GetGlobal() {
+    static ChTaskScheduler scheduler(0);
+    return scheduler;
+}
+
+void ChTaskScheduler::WorkerLoop(int index) {
+    tls_scheduler = this;
+    tls_worker_index = index;
+
+    // Number of failed search rounds before a worker parks itself.
+    const int spin_rounds = 100;
+
+    int failures = 0;
+    while (!m_done.load(std::memory_order_acquire)) {
+        Task* task = FindTask(index);
+        if (task) {
+            failures = 0;
+            ExecuteTask(task);
+            continue;
+        }
+
+        if (++failures < spin_rounds) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Park until new work is submitted.
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_sleepers.fetch_add(1, std::memory_order_release);
+        m_sleep_cond.wait_for(lock, std::chrono::milliseconds(1));
+        m_sleepers.fetch_sub(1, std::memory_order_release);
+        failures = 0;
+    }
+}
+
+ChTaskScheduler::Task* ChTaskScheduler::FindTask(int self_index) {
+    // Own deque first (if we are a worker), then the injection queue, then steal.
+    if (self_index >= 0) {
+        if (Task* task = m_workers[self_index]->deque.Pop())
+            return task;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_injected_mutex);
+        if (!m_injected.empty()) {
+            Task* task = m_injected.front();
+            m_injected.pop_front();
+            return task;
+        }
+    }
+
+    int num = (int)m_workers.size();
+    int start = (self_index >= 0) ? self_index + 1 : 0;
+    for (int k = 0; k < num; k++) {
+        int victim = (start + k) % num;
+        if (victim == self_index)
+            continue;
+        if (Task* task = m_workers[victim]->deque.Steal())
+            return task;
+    }
+
+    return NULL;
+}
+
+void ChTaskScheduler::ExecuteTask(Task* task) {
+    task->fn();
+    task->group->m_pending.fetch_sub(1, std::memory_order_release);
+    delete task;
+}
+
+bool ChTaskScheduler::HelpOnce(int self_index) {
+    if (Task* task = FindTask(self_index)) {
+        ExecuteTask(task);
+        return true;
+    }
+    return false;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHTASKSCHEDULER_H
+#define CHTASKSCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChTaskScheduler;
+
+/// Completion handle for a batch of tasks submitted to a ChTaskScheduler.
+/// A group counts the tasks in flight; ChTaskScheduler::Wait() blocks (helping to
+/// execute pending tasks in the meantime) until the count drops back to zero.
+class ChApi ChTaskGroup {
+  public:
+    ChTaskGroup() : m_pending(0) {}
+
+    /// Return true if all tasks submitted under this group have completed.
+    bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+  private:
+    std::atomic<int> m_pending;  ///< number of submitted tasks not yet completed
+
+    friend class ChTaskScheduler;
+};
+
+/// Work-stealing task scheduler with persistent worker threads.
+///
+/// Unlike the fixed-function pools in ChThreads (one condition-variable wakeup per
+/// dispatch), the workers here stay hot: each worker owns a Chase-Lev deque, pops
+/// its own work from the bottom and steals from the top of the others, spinning
+/// briefly before parking when the system runs dry. Tasks submitted from outside
+/// the pool enter through a shared injection queue.
+///
+/// The scheduler is phase-agnostic: collision, update and solver code can submit
+/// tasks to the same persistent pool instead of forking and joining per phase.
+/// A lazily-created process-wide instance is available through #GetGlobal().
+class ChApi ChTaskScheduler {
+  public:
+    /// Create a scheduler with the given number of worker threads.
+    /// With num_threads = 0, use the hardware concurrency (minus one, since the
+    /// submitting thread participates in execution during Wait and ParallelFor).
+    explicit ChTaskScheduler(int num_threads = 0);
+
+    /// Stop and join all worker threads. Pending tasks are completed first.
+    ~ChTaskScheduler();
+
+    /// Return the number of worker threads (excluding the submitting thread).
+    int GetNumThreads() const { return (int)m_workers.size(); }
+
+    /// Submit a task for asynchronous execution under the given group.
+    /// If called from one of this scheduler's workers, the task goes to that
+    /// worker's own deque; otherwise it goes through the injection queue.
+    void Submit(ChTaskGroup& group, std::function<void()> task);
+
+    /// Wait until all tasks submitted under the given group have completed.
+    /// The calling thread executes pending tasks while it waits.
+    void Wait(ChTaskGroup& group);
+
+    /// Split the iteration range [first, last) into chunks of at most grain
+    /// iterations, execute body(chunk_first, chunk_last) in parallel, and wait.
+    /// The calling thread executes one chunk itself.
+    void ParallelFor(int first, int last, int grain, const std::function<void(int, int)>& body);
+
+    /// Return the process-wide scheduler, created on first use with default size.
+    static ChTaskScheduler& GetGlobal();
+
+  private:
+    /// A unit of work together with the group accounting for it.
+    struct Task {
+        std::function<void()> fn;
+        ChTaskGroup* group;
+    };
+
+    class WorkDeque;  ///< Chase-Lev work-stealing deque of Task pointers
+    struct Worker;    ///< per-thread state: deque + thread handle
+
+    void WorkerLoop(int index);
+    Task* FindTask(int self_index);
+    void ExecuteTask(Task* task);
+    bool HelpOnce(int self_index);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;  ///< persistent worker threads
+
+    std::deque<Task*> m_injected;  ///< tasks submitted from outside the pool
+    std::mutex m_injected_mutex;   ///< protects the injection queue
+
+    std::mutex m_sleep_mutex;              ///< protects parking of idle workers
+    std::condition_variable m_sleep_cond;  ///< idle workers park here
+    std::atomic<int> m_sleepers;           ///< number of parked workers
+    std::atomic<bool> m_done;              ///< set at destruction to stop the workers
+};
+
+}  // end namespace chrono
+
+#endif
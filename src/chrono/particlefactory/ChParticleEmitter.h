@@ -122,8 +122,19 @@ class ChParticleEmitter {
             mcoords_abs = mcoords >> pre_transform.GetCoord(); 
 
             // 3)
-            // Random creation of particle
-            std::shared_ptr<ChBody> mbody = particle_creator->RandomGenerateAndCallbacks(mcoords_abs);
+            // Random creation of particle: reactivate and teleport a pooled
+            // body if available (see SetupParticlePool), else generate a new one
+            std::shared_ptr<ChBody> mbody;
+            bool from_pool = !particle_pool.empty();
+            if (from_pool) {
+                mbody = particle_pool.back();
+                particle_pool.pop_back();
+                mbody->SetCoord(mcoords_abs);
+                mbody->SetBodyFixed(false);
+                mbody->SetCollide(true);  // re-inserts the prebuilt collision model in the collision system
+            } else {
+                mbody = particle_creator->RandomGenerateAndCallbacks(mcoords_abs);
+            }
 
             // 4) 
             // Random velocity and angular speed
@@ -153,7 +164,8 @@ class ChParticleEmitter {
                 mbody->Move(jitter);
             }    
 
-            msystem.AddBatch(mbody);  // the Add() alone woud not be thread safe if called from items inserted in system's lists
+            if (!from_pool)
+                msystem.AddBatch(mbody);  // the Add() alone woud not be thread safe if called from items inserted in system's lists
 
             if (this->creation_callback)
                 this->creation_callback->OnAddBody(mbody, mcoords_abs, *particle_creator.get());
@@ -170,6 +182,41 @@ class ChParticleEmitter {
         }
     }
 
+    /// Pre-construct a pool of n inactive particles, to be reused by EmitParticles.
+    /// The bodies are generated by the particle creator at the parking position,
+    /// deactivated (fixed, collision disabled) and inserted in the system once, with
+    /// their collision models already built; emission then only teleports and
+    /// reactivates them, avoiding per-particle allocation and system insertion
+    /// during bursts. When the pool runs empty, emission falls back to regular
+    /// per-particle creation. Note that the (random) shape of each pooled particle
+    /// is drawn here, not at emission time.
+    void SetupParticlePool(ChSystem& msystem, int n, const ChVector<>& parking_pos = ChVector<>(0, 0, -1e9)) {
+        pool_parking = parking_pos;
+        ChCoordsys<> parking_coords(parking_pos);
+        for (int i = 0; i < n; i++) {
+            std::shared_ptr<ChBody> mbody = particle_creator->RandomGenerateAndCallbacks(parking_coords);
+            mbody->SetBodyFixed(true);
+            mbody->SetCollide(false);
+            msystem.AddBatch(mbody);
+            particle_pool.push_back(mbody);
+        }
+    }
+
+    /// Park an emitted particle back in the pool (ex. when it leaves the domain
+    /// of interest): the body is deactivated and becomes available again to
+    /// EmitParticles. The body must have been emitted from the pool or at least
+    /// belong to the same system.
+    void ReturnParticleToPool(std::shared_ptr<ChBody> mbody) {
+        mbody->SetCollide(false);
+        mbody->SetBodyFixed(true);
+        mbody->SetNoSpeedNoAcceleration();
+        mbody->SetPos(pool_parking);
+        particle_pool.push_back(mbody);
+    }
+
+    /// Get the current number of inactive pooled particles.
+    int GetPoolSize() { return (int)particle_pool.size(); }
+
     /// Pass an object from a ChPostCreationCallback-inherited class if you want to
     /// set additional stuff on each created particle (ex.set some random asset, set some random material, or such)
     void RegisterAddBodyCallback(ChRandomShapeCreator::AddBodyCallback* callback) { this->creation_callback = callback; }
@@ -262,6 +309,9 @@ class ChParticleEmitter {
 
     bool inherit_owner_speed;
     bool jitter_declustering;
+
+    std::vector<std::shared_ptr<ChBody>> particle_pool;  ///< inactive pre-constructed particles (see SetupParticlePool)
+    ChVector<> pool_parking;                             ///< where inactive pooled particles are parked
 };
 
 }  // end of namespace particlefactory
@@ -0,0 +1,431 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cassert>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "chrono/physics/ChArticulatedChain.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+// Spatial (Plucker) algebra helpers.
+// All spatial quantities are expressed at the world origin, in world axes, so
+// that no coordinate transforms are needed between bodies: motion vectors are
+// (omega, velocity of the body-fixed point currently at the origin), force
+// vectors are (torque about the origin, force).
+// -----------------------------------------------------------------------------
+
+namespace {
+
+struct SpVec {
+    ChVector<> ang;
+    ChVector<> lin;
+    SpVec() : ang(0), lin(0) {}
+    SpVec(const ChVector<>& a, const ChVector<>& l) : ang(a), lin(l) {}
+    SpVec operator+(const SpVec& o) const { return SpVec(ang + o.ang, lin + o.lin); }
+    SpVec operator-(const SpVec& o) const { return SpVec(ang - o.ang, lin - o.lin); }
+    SpVec operator*(double s) const { return SpVec(ang * s, lin * s); }
+    double operator[](int i) const { return i < 3 ? ang[i] : lin[i - 3]; }
+    double& At(int i) { return i < 3 ? ang[i] : lin[i - 3]; }
+};
+
+// Motion x motion cross product.
+SpVec crm(const SpVec& v, const SpVec& m) {
+    return SpVec(Vcross(v.ang, m.ang), Vcross(v.ang, m.lin) + Vcross(v.lin, m.ang));
+}
+
+// Motion x force cross product.
+SpVec crf(const SpVec& v, const SpVec& f) {
+    return SpVec(Vcross(v.ang, f.ang) + Vcross(v.lin, f.lin), Vcross(v.ang, f.lin));
+}
+
+double SpDot(const SpVec& a, const SpVec& b) {
+    return Vdot(a.ang, b.ang) + Vdot(a.lin, b.lin);
+}
+
+// 6x6 spatial matrix (articulated-body inertia).
+struct SpMat {
+    double m[6][6];
+    SpMat() {
+        for (int i = 0; i < 6; i++)
+            for (int j = 0; j < 6; j++)
+                m[i][j] = 0;
+    }
+    SpVec operator*(const SpVec& x) const {
+        SpVec r;
+        for (int i = 0; i < 6; i++) {
+            double s = 0;
+            for (int j = 0; j < 6; j++)
+                s += m[i][j] * x[j];
+            r.At(i) = s;
+        }
+        return r;
+    }
+    void Add(const SpMat& o) {
+        for (int i = 0; i < 6; i++)
+            for (int j = 0; j < 6; j++)
+                m[i][j] += o.m[i][j];
+    }
+    // this -= (a b^T) / d
+    void SubOuter(const SpVec& a, const SpVec& b, double d) {
+        for (int i = 0; i < 6; i++)
+            for (int j = 0; j < 6; j++)
+                m[i][j] -= a[i] * b[j] / d;
+    }
+};
+
+// Spatial inertia at the world origin of a body with mass mass, world COM
+// location c, and world-axes rotational inertia (about the COM) Iw.
+SpMat SpatialInertia(double mass, const ChVector<>& c, const ChMatrix33<>& Iw) {
+    // skew(c)
+    double ct[3][3] = {{0, -c.z(), c.y()}, {c.z(), 0, -c.x()}, {-c.y(), c.x(), 0}};
+    SpMat I;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            // top-left: Iw + m * skew(c) * skew(c)^T
+            double s = 0;
+            for (int k = 0; k < 3; k++)
+                s += ct[i][k] * ct[j][k];
+            I.m[i][j] = Iw(i, j) + mass * s;
+            // off-diagonal blocks: m * skew(c) and its transpose
+            I.m[i][3 + j] = mass * ct[i][j];
+            I.m[3 + i][j] = mass * ct[j][i];
+        }
+        // bottom-right: m * identity
+        I.m[3 + i][3 + i] = mass;
+    }
+    return I;
+}
+
+// Spatial velocity (at the world origin) of a body.
+SpVec BodySpatialVelocity(const ChBody& body) {
+    ChVector<> w = body.GetWvel_par();
+    return SpVec(w, body.GetPos_dt() - Vcross(w, body.GetPos()));
+}
+
+// Spatial acceleration (at the world origin) of a body.
+SpVec BodySpatialAcceleration(const ChBody& body) {
+    ChVector<> w = body.GetWvel_par();
+    ChVector<> wd = body.GetWacc_par();
+    return SpVec(wd, body.GetPos_dtdt() - Vcross(wd, body.GetPos()) - Vcross(w, body.GetPos_dt()));
+}
+
+}  // end unnamed namespace
+
+// -----------------------------------------------------------------------------
+// Chain detection
+// -----------------------------------------------------------------------------
+
+std::vector<std::shared_ptr<ChArticulatedChain>> ChArticulatedChain::ExtractChains(const ChAssembly& assembly) {
+    std::vector<std::shared_ptr<ChArticulatedChain>> chains;
+
+    // Map raw body pointers (as returned by ChLink::GetBody1/2) back to the
+    // shared pointers owned by the assembly.
+    std::unordered_map<ChBody*, std::shared_ptr<ChBody>> body_map;
+    for (const auto& body : assembly.Get_bodylist())
+        body_map[body.get()] = body;
+
+    // Classify the links: an "edge" is an eligible chain joint; any other link
+    // disqualifies its bodies from being chain-interior.
+    struct Edge {
+        std::shared_ptr<ChLinkLock> link;
+        JointType type;
+        ChBody* b1;
+        ChBody* b2;
+        bool used;
+    };
+    std::vector<Edge> edges;
+    std::unordered_map<ChBody*, std::vector<size_t>> incident;
+    std::unordered_set<ChBody*> has_other_constraint;
+
+    for (const auto& link : assembly.Get_linklist()) {
+        ChBody* b1 = dynamic_cast<ChBody*>(link->GetBody1());
+        ChBody* b2 = dynamic_cast<ChBody*>(link->GetBody2());
+        bool eligible = false;
+        JointType type = JointType::REVOLUTE;
+        if (std::dynamic_pointer_cast<ChLinkLockRevolute>(link)) {
+            eligible = true;
+            type = JointType::REVOLUTE;
+        } else if (std::dynamic_pointer_cast<ChLinkLockPrismatic>(link)) {
+            eligible = true;
+            type = JointType::PRISMATIC;
+        }
+        if (eligible && b1 && b2 && body_map.count(b1) && body_map.count(b2)) {
+            incident[b1].push_back(edges.size());
+            incident[b2].push_back(edges.size());
+            edges.push_back({std::static_pointer_cast<ChLinkLock>(link), type, b1, b2, false});
+        } else {
+            if (b1)
+                has_other_constraint.insert(b1);
+            if (b2)
+                has_other_constraint.insert(b2);
+        }
+    }
+
+    // A body can be interior to a chain only if its sole constraints are one
+    // or two eligible joints and it is free to move.
+    auto is_interior = [&](ChBody* b) {
+        if (!b || b->GetBodyFixed() || has_other_constraint.count(b))
+            return false;
+        auto it = incident.find(b);
+        return it != incident.end() && it->second.size() <= 2;
+    };
+
+    // Walk outward from every (base body, joint) pair.
+    for (size_t e0 = 0; e0 < edges.size(); e0++) {
+        if (edges[e0].used)
+            continue;
+        for (int side = 0; side < 2; side++) {
+            ChBody* base = (side == 0) ? edges[e0].b1 : edges[e0].b2;
+            ChBody* next = (side == 0) ? edges[e0].b2 : edges[e0].b1;
+            if (is_interior(base) || !is_interior(next))
+                continue;
+
+            std::vector<size_t> walk(1, e0);
+            std::unordered_set<ChBody*> visited{base, next};
+            ChBody* cur = next;
+            bool valid = true;
+            while (incident[cur].size() == 2) {
+                size_t en = (incident[cur][0] == walk.back()) ? incident[cur][1] : incident[cur][0];
+                ChBody* nb = (edges[en].b1 == cur) ? edges[en].b2 : edges[en].b1;
+                if (edges[en].used || !is_interior(nb) || visited.count(nb)) {
+                    // closed loop, or a chain spanning two supports: leave it
+                    // to the maximal-coordinate solver.
+                    valid = false;
+                    break;
+                }
+                walk.push_back(en);
+                visited.insert(nb);
+                cur = nb;
+            }
+            if (!valid)
+                continue;
+
+            auto chain = std::shared_ptr<ChArticulatedChain>(new ChArticulatedChain);
+            chain->m_base = body_map[base];
+            ChBody* parent = base;
+            for (size_t ei : walk) {
+                edges[ei].used = true;
+                ChBody* child = (edges[ei].b1 == parent) ? edges[ei].b2 : edges[ei].b1;
+                chain->m_joints.push_back({edges[ei].type, edges[ei].link, body_map[child]});
+                parent = child;
+            }
+            chains.push_back(chain);
+            break;
+        }
+    }
+
+    return chains;
+}
+
+// -----------------------------------------------------------------------------
+// Setup / release
+// -----------------------------------------------------------------------------
+
+void ChArticulatedChain::Initialize() {
+    size_t n = m_joints.size();
+    m_q.assign(n, 0);
+    m_qd.assign(n, 0);
+    m_tau.assign(n, 0);
+    m_frame_inboard.resize(n);
+    m_frame_outboard.resize(n);
+    m_was_fixed.resize(n);
+    m_base_force = VNULL;
+    m_base_torque = VNULL;
+
+    std::shared_ptr<ChBody> parent = m_base;
+    for (size_t i = 0; i < n; i++) {
+        auto& joint = m_joints[i];
+        auto child = joint.body;
+
+        // Joint frame on the parent body: the link marker carried by it.
+        ChMarker* marker_p =
+            (joint.link->GetBody1() == parent.get()) ? joint.link->GetMarker1() : joint.link->GetMarker2();
+        m_frame_inboard[i] = ChFrame<>(marker_p->GetCoord());
+
+        // Outboard transform: whatever takes the joint frame to the child body
+        // frame in the current configuration (which defines q_i = 0).
+        ChFrame<> X_parent(parent->GetCoord());
+        ChFrame<> X_child(child->GetCoord());
+        m_frame_outboard[i] = (X_parent * m_frame_inboard[i]).GetInverse() * X_child;
+
+        // Current joint velocity, projected on the joint axis.
+        ChFrame<> F_joint = X_parent * m_frame_inboard[i];
+        ChVector<> axis = F_joint.TransformDirectionLocalToParent(VECT_Z);
+        if (joint.type == JointType::REVOLUTE) {
+            m_qd[i] = Vdot(axis, child->GetWvel_par() - parent->GetWvel_par());
+        } else {
+            ChVector<> o_j = F_joint.GetPos();
+            ChVector<> v_pt_c = child->GetPos_dt() + Vcross(child->GetWvel_par(), o_j - child->GetPos());
+            ChVector<> v_pt_p = parent->GetPos_dt() + Vcross(parent->GetWvel_par(), o_j - parent->GetPos());
+            m_qd[i] = Vdot(axis, v_pt_c - v_pt_p);
+        }
+
+        m_was_fixed[i] = child->GetBodyFixed();
+        child->SetBodyFixed(true);
+
+        parent = child;
+    }
+    m_active = true;
+}
+
+void ChArticulatedChain::Release() {
+    for (size_t i = 0; i < m_joints.size(); i++)
+        m_joints[i].body->SetBodyFixed(m_was_fixed[i]);
+    m_active = false;
+}
+
+// -----------------------------------------------------------------------------
+// Articulated-body forward dynamics
+// -----------------------------------------------------------------------------
+
+void ChArticulatedChain::ComputeJointAccelerations(std::vector<double>& qdd) {
+    size_t n = m_joints.size();
+    qdd.assign(n, 0);
+    if (n == 0)
+        return;
+
+    ChSystem* system = m_base->GetSystem();
+    ChVector<> gravity = system ? system->Get_G_acc() : VNULL;
+
+    std::vector<SpVec> S(n), v(n), c_bias(n), pA(n), U(n), a(n);
+    std::vector<SpMat> IA(n);
+    std::vector<double> D(n), u(n);
+
+    // Pass 1 (base to tip): joint geometry, velocities, bias terms.
+    std::shared_ptr<ChBody> parent = m_base;
+    SpVec v_parent = BodySpatialVelocity(*m_base);
+    for (size_t i = 0; i < n; i++) {
+        auto body = m_joints[i].body;
+        ChFrame<> F_joint = ChFrame<>(parent->GetCoord()) * m_frame_inboard[i];
+        ChVector<> axis = F_joint.TransformDirectionLocalToParent(VECT_Z);
+        if (m_joints[i].type == JointType::REVOLUTE)
+            S[i] = SpVec(axis, Vcross(F_joint.GetPos(), axis));
+        else
+            S[i] = SpVec(VNULL, axis);
+
+        v[i] = v_parent + S[i] * m_qd[i];
+        c_bias[i] = crm(v[i], S[i] * m_qd[i]);
+
+        // Rigid-body inertia at the world origin.
+        const ChMatrix33<>& A = body->GetA();
+        ChMatrix33<> I_loc = body->GetInertia();
+        ChMatrix33<> Iw;
+        for (int r = 0; r < 3; r++) {
+            ChVector<> col(A(r, 0), A(r, 1), A(r, 2));
+            ChVector<> tmp = A.Matr_x_Vect(I_loc.MatrT_x_Vect(col));
+            for (int s = 0; s < 3; s++)
+                Iw(s, r) = tmp[s];
+        }
+        double mass = body->GetMass();
+        ChVector<> com = body->GetPos();
+        IA[i] = SpatialInertia(mass, com, Iw);
+
+        // External forces: gravity plus the body force accumulators, as a
+        // spatial force at the world origin.
+        ChVector<> force = gravity * mass + body->Get_accumulated_force();
+        SpVec f_ext(Vcross(com, force) + body->Get_accumulated_torque(), force);
+        pA[i] = crf(v[i], IA[i] * v[i]) - f_ext;
+
+        v_parent = v[i];
+        parent = body;
+    }
+
+    // Pass 2 (tip to base): articulated inertias.
+    for (size_t k = n; k-- > 0;) {
+        U[k] = IA[k] * S[k];
+        D[k] = SpDot(S[k], U[k]);
+        u[k] = m_tau[k] - SpDot(S[k], pA[k]);
+        if (D[k] < 1e-20) {
+            // massless/degenerate subtree: no dynamics along this joint
+            D[k] = 1;
+            u[k] = 0;
+        }
+        if (k > 0) {
+            SpMat Ia = IA[k];
+            Ia.SubOuter(U[k], U[k], D[k]);
+            SpVec pa = pA[k] + Ia * c_bias[k] + U[k] * (u[k] / D[k]);
+            IA[k - 1].Add(Ia);
+            pA[k - 1] = pA[k - 1] + pa;
+        }
+    }
+
+    // Pass 3 (base to tip): accelerations. The base is kinematically
+    // prescribed: its actual spatial acceleration is used, but the chain does
+    // not react it dynamically.
+    SpVec a_parent = BodySpatialAcceleration(*m_base);
+    for (size_t i = 0; i < n; i++) {
+        SpVec ap = a_parent + c_bias[i];
+        qdd[i] = (u[i] - SpDot(U[i], ap)) / D[i];
+        a[i] = ap + S[i] * qdd[i];
+        a_parent = a[i];
+    }
+
+    // Wrench transmitted to the base through the first joint (its reaction).
+    SpVec f_base = IA[0] * a[0] + pA[0];
+    m_base_force = -f_base.lin;
+    m_base_torque = -(f_base.ang - Vcross(m_base->GetPos(), f_base.lin));
+}
+
+// -----------------------------------------------------------------------------
+// Time stepping
+// -----------------------------------------------------------------------------
+
+void ChArticulatedChain::Advance(double step) {
+    assert(m_active);
+
+    std::vector<double> qdd;
+    ComputeJointAccelerations(qdd);
+
+    // Semi-implicit Euler in joint space.
+    for (size_t i = 0; i < m_joints.size(); i++) {
+        m_qd[i] += step * qdd[i];
+        m_q[i] += step * m_qd[i];
+    }
+
+    UpdateBodyStates();
+}
+
+void ChArticulatedChain::UpdateBodyStates() {
+    ChFrame<> X_parent(m_base->GetCoord());
+    SpVec v_parent = BodySpatialVelocity(*m_base);
+
+    for (size_t i = 0; i < m_joints.size(); i++) {
+        auto body = m_joints[i].body;
+
+        ChFrame<> F_joint = X_parent * m_frame_inboard[i];
+        ChFrame<> F_motion;
+        if (m_joints[i].type == JointType::REVOLUTE)
+            F_motion = ChFrame<>(VNULL, Q_from_AngZ(m_q[i]));
+        else
+            F_motion = ChFrame<>(ChVector<>(0, 0, m_q[i]), QUNIT);
+        ChFrame<> X_body = F_joint * F_motion * m_frame_outboard[i];
+
+        ChVector<> axis = F_joint.TransformDirectionLocalToParent(VECT_Z);
+        SpVec S = (m_joints[i].type == JointType::REVOLUTE) ? SpVec(axis, Vcross(F_joint.GetPos(), axis))
+                                                            : SpVec(VNULL, axis);
+        SpVec v_body = v_parent + S * m_qd[i];
+
+        body->SetCoord(X_body.GetCoord());
+        body->SetWvel_par(v_body.ang);
+        body->SetPos_dt(v_body.lin + Vcross(v_body.ang, X_body.GetPos()));
+        body->Update(true);
+
+        X_parent = X_body;
+        v_parent = v_body;
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHARTICULATEDCHAIN_H
+#define CHARTICULATEDCHAIN_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChAssembly.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkLock.h"
+
+namespace chrono {
+
+/// Reduced-coordinate model of an open kinematic chain of rigid bodies.
+///
+/// Chrono normally solves all bodies in maximal coordinates through the system
+/// descriptor, paying iterative-solver cost even for mechanisms (e.g. robotic
+/// arms) whose topology is a simple open chain of revolute/prismatic joints.
+/// This class provides an exact O(n) alternative for such chains: it detects
+/// them in an existing assembly (ExtractChains), takes over the chain bodies
+/// (Initialize marks them as fixed so the maximal-coordinate solver skips
+/// them), and advances the chain in joint coordinates with the articulated-body
+/// algorithm, writing the resulting body positions and velocities back after
+/// each step. The wrench transmitted to the supporting body is available
+/// through GetBaseReactionForce/GetBaseReactionTorque so that the chain can be
+/// coupled back to the surrounding maximal-coordinate world as an interface
+/// force.
+///
+/// Joint coordinates are measured from the configuration at the time of
+/// Initialize(). Gravity and the body force accumulators of the chain bodies
+/// are accounted for; the base body is treated as kinematically prescribed
+/// (its current motion is read, but the chain does not react it dynamically).
+class ChApi ChArticulatedChain {
+  public:
+    /// Type of a joint in the chain.
+    enum class JointType {
+        REVOLUTE,  ///< rotation about the z axis of the joint marker
+        PRISMATIC  ///< translation along the z axis of the joint marker
+    };
+
+    /// One joint of the chain, together with its outboard (child) body.
+    struct Joint {
+        JointType type;                     ///< joint type
+        std::shared_ptr<ChLinkLock> link;   ///< the original maximal-coordinate link
+        std::shared_ptr<ChBody> body;       ///< the outboard body driven by this joint
+    };
+
+    /// Scan the assembly for open chains of ChLinkLockRevolute/ChLinkLockPrismatic
+    /// joints and return one ChArticulatedChain per chain found.
+    /// A chain starts at a base body (a fixed body, or any body that carries
+    /// constraints other than eligible joints, or more than two of them) and
+    /// extends through bodies whose only constraints are the two chain joints,
+    /// ending at a body with a single joint. Closed loops and branched trees
+    /// are left to the maximal-coordinate solver. The returned chains are not
+    /// yet active: call Initialize() on each chain that should be taken over.
+    static std::vector<std::shared_ptr<ChArticulatedChain>> ExtractChains(const ChAssembly& assembly);
+
+    /// Capture the reference configuration and take over the chain bodies.
+    /// Joint coordinates are zero in the current configuration; the chain
+    /// bodies are marked as fixed so that the system solver ignores them and
+    /// their motion is prescribed by Advance() from now on.
+    void Initialize();
+
+    /// Return control of the chain bodies to the maximal-coordinate solver,
+    /// restoring their original fixed flags. The bodies keep the position and
+    /// velocity of the last Advance() call.
+    void Release();
+
+    /// Get the number of joints (= number of chain bodies).
+    size_t GetNumJoints() const { return m_joints.size(); }
+
+    /// Get the base (supporting) body of the chain.
+    std::shared_ptr<ChBody> GetBase() const { return m_base; }
+
+    /// Get the i-th joint, ordered from the base outward.
+    const Joint& GetJoint(size_t i) const { return m_joints[i]; }
+
+    /// Get the position of the i-th joint coordinate (rad or m, measured from
+    /// the configuration at Initialize()).
+    double GetJointPos(size_t i) const { return m_q[i]; }
+
+    /// Get the velocity of the i-th joint coordinate.
+    double GetJointVel(size_t i) const { return m_qd[i]; }
+
+    /// Set the actuation torque (or force, for prismatic joints) applied at
+    /// the i-th joint for the next step.
+    void SetJointTorque(size_t i, double tau) { m_tau[i] = tau; }
+
+    /// Compute the joint accelerations in the current state with the O(n)
+    /// articulated-body algorithm, using gravity, the body force accumulators,
+    /// and the joint torques set with SetJointTorque().
+    void ComputeJointAccelerations(std::vector<double>& qdd);
+
+    /// Advance the chain state by one step of semi-implicit Euler and write
+    /// the resulting positions and velocities back to the chain bodies.
+    /// Must be called between Initialize() and Release().
+    void Advance(double step);
+
+    /// Get the force (at the base COM, absolute coordinates) that the chain
+    /// transmitted to its base body during the last Advance().
+    const ChVector<>& GetBaseReactionForce() const { return m_base_force; }
+
+    /// Get the torque (about the base COM, absolute coordinates) that the
+    /// chain transmitted to its base body during the last Advance().
+    const ChVector<>& GetBaseReactionTorque() const { return m_base_torque; }
+
+  private:
+    ChArticulatedChain() {}
+
+    /// Write body positions and velocities for the current (q, qd).
+    void UpdateBodyStates();
+
+    std::shared_ptr<ChBody> m_base;  ///< supporting body (kinematically prescribed)
+    std::vector<Joint> m_joints;     ///< joints, ordered from the base outward
+
+    std::vector<double> m_q;    ///< joint positions
+    std::vector<double> m_qd;   ///< joint velocities
+    std::vector<double> m_tau;  ///< applied joint torques/forces
+
+    // Reference transforms captured at Initialize(): the pose of body i is
+    // X_parent * m_frame_inboard[i] * J(q_i) * m_frame_outboard[i], with J the
+    // joint motion (rotation about z or translation along z).
+    std::vector<ChFrame<>> m_frame_inboard;
+    std::vector<ChFrame<>> m_frame_outboard;
+    std::vector<bool> m_was_fixed;  ///< original fixed flags, restored by Release()
+    bool m_active = false;
+
+    ChVector<> m_base_force;   ///< last reaction force on the base, absolute
+    ChVector<> m_base_torque;  ///< last reaction torque on the base, about its COM
+};
+
+}  // end namespace chrono
+
+#endif
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 
 #include "chrono/core/ChLinearAlgebra.h"
@@ -45,7 +46,13 @@ ChAssembly::ChAssembly()
       nsysvars(0),
       nsysvars_w(0),
       nbodies_sleep(0),
-      nbodies_fixed(0) {}
+      nbodies_fixed(0),
+      topology_revision(0),
+      raw_tables_revision((unsigned int)-1),
+      incremental_setup(false),
+      body_slot_count(0) {
+    std::fill(topology_revision_cat, topology_revision_cat + TOPOLOGY_NUM_CATEGORIES, 0u);
+}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nbodies = other.nbodies;
@@ -63,6 +70,11 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nsysvars_w = other.nsysvars_w;
     nbodies_sleep = other.nbodies_sleep;
     nbodies_fixed = other.nbodies_fixed;
+    topology_revision = other.topology_revision;
+    std::copy(other.topology_revision_cat, other.topology_revision_cat + TOPOLOGY_NUM_CATEGORIES,
+              topology_revision_cat);
+    // journal subscribers are not copied: they subscribed to the other assembly
+    raw_tables_revision = topology_revision - 1;  // the raw tables are rebuilt on first access
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, linklist, meshlist,  otherphysicslist)
@@ -99,6 +111,19 @@ void ChAssembly::Clear() {
     nbodies_fixed = 0;
 }
 
+void ChAssembly::UnregisterTopologyChangeCallback(TopologyChangeCallback* callback) {
+    auto itr = std::find(topology_callbacks.begin(), topology_callbacks.end(), callback);
+    if (itr != topology_callbacks.end())
+        topology_callbacks.erase(itr);
+}
+
+void ChAssembly::BumpTopologyRevision(TopologyCategory category) {
+    topology_revision++;
+    topology_revision_cat[category]++;
+    for (auto& callback : topology_callbacks)
+        callback->OnTopologyChange(this, category, topology_revision);
+}
+
 // Note: removing items from the assembly incurs linear time cost
 
 void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
@@ -108,14 +133,23 @@ void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
     // set system and also add collision models to system
     body->SetSystem(system);
     bodylist.push_back(body);
+    BumpTopologyRevision(TOPOLOGY_BODIES);
 }
 
 void ChAssembly::RemoveBody(std::shared_ptr<ChBody> body) {
     auto itr = std::find(std::begin(bodylist), std::end(bodylist), body);
     assert(itr != bodylist.end());
 
+    // Recycle the coordinate slot of the removed body, if it had one.
+    auto slot = body_slot_map.find(body.get());
+    if (slot != body_slot_map.end()) {
+        body_slot_free.push_back(slot->second);
+        body_slot_map.erase(slot);
+    }
+
     bodylist.erase(itr);
     body->SetSystem(nullptr);
+    BumpTopologyRevision(TOPOLOGY_BODIES);
 }
 
 void ChAssembly::AddLink(std::shared_ptr<ChLink> link) {
@@ -123,6 +157,7 @@ void ChAssembly::AddLink(std::shared_ptr<ChLink> link) {
 
     link->SetSystem(system);
     linklist.push_back(link);
+    BumpTopologyRevision(TOPOLOGY_LINKS);
 }
 
 void ChAssembly::RemoveLink(std::shared_ptr<ChLink> link) {
@@ -131,6 +166,7 @@ void ChAssembly::RemoveLink(std::shared_ptr<ChLink> link) {
 
     linklist.erase(itr);
     link->SetSystem(nullptr);
+    BumpTopologyRevision(TOPOLOGY_LINKS);
 }
 
 void ChAssembly::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
@@ -138,6 +174,7 @@ void ChAssembly::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
 
     mesh->SetSystem(system);
     meshlist.push_back(mesh);
+    BumpTopologyRevision(TOPOLOGY_MESHES);
 }
 
 void ChAssembly::RemoveMesh(std::shared_ptr<fea::ChMesh> mesh) {
@@ -146,6 +183,7 @@ void ChAssembly::RemoveMesh(std::shared_ptr<fea::ChMesh> mesh) {
 
     meshlist.erase(itr);
     mesh->SetSystem(nullptr);
+    BumpTopologyRevision(TOPOLOGY_MESHES);
 }
 
 void ChAssembly::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
@@ -158,6 +196,7 @@ void ChAssembly::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
     // set system and also add collision models to system
     item->SetSystem(system);
     otherphysicslist.push_back(item);
+    BumpTopologyRevision(TOPOLOGY_OTHER_PHYSICS);
 }
 
 void ChAssembly::RemoveOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
@@ -166,6 +205,7 @@ void ChAssembly::RemoveOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
 
     otherphysicslist.erase(itr);
     item->SetSystem(nullptr);
+    BumpTopologyRevision(TOPOLOGY_OTHER_PHYSICS);
 }
 
 void ChAssembly::Add(std::shared_ptr<ChPhysicsItem> item) {
@@ -222,6 +262,11 @@ void ChAssembly::RemoveAllBodies() {
         body->SetSystem(nullptr);
     }
     bodylist.clear();
+    body_slot_map.clear();
+    body_slot_free.clear();
+    body_slot_unused.clear();
+    body_slot_count = 0;
+    BumpTopologyRevision(TOPOLOGY_BODIES);
 }
 
 void ChAssembly::RemoveAllLinks() {
@@ -229,6 +274,7 @@ void ChAssembly::RemoveAllLinks() {
         link->SetSystem(nullptr);
     }
     linklist.clear();
+    BumpTopologyRevision(TOPOLOGY_LINKS);
 }
 
 void ChAssembly::RemoveAllMeshes() {
@@ -236,6 +282,7 @@ void ChAssembly::RemoveAllMeshes() {
         mesh->SetSystem(nullptr);
     }
     meshlist.clear();
+    BumpTopologyRevision(TOPOLOGY_MESHES);
 }
 
 void ChAssembly::RemoveAllOtherPhysicsItems() {
@@ -243,6 +290,7 @@ void ChAssembly::RemoveAllOtherPhysicsItems() {
         item->SetSystem(nullptr);
     }
     otherphysicslist.clear();
+    BumpTopologyRevision(TOPOLOGY_OTHER_PHYSICS);
 }
 
 std::shared_ptr<ChBody> ChAssembly::SearchBody(const char* name) {
@@ -306,6 +354,65 @@ std::shared_ptr<ChMarker> ChAssembly::SearchMarker(int markID) {
 
 // -----------------------------------------------------------------------------
 
+std::vector<int> ChAssembly::CacheBodyIndices(const std::vector<std::shared_ptr<ChBody>>& bodies) const {
+    // Map each body of the assembly to its position in the body list.
+    std::unordered_map<ChBody*, int> positions;
+    positions.reserve(bodylist.size());
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        positions[bodylist[ib].get()] = ib;
+    }
+
+    std::vector<int> indices;
+    indices.reserve(bodies.size());
+    for (const auto& body : bodies) {
+        auto found = positions.find(body.get());
+        if (found != positions.end())
+            indices.push_back(found->second);
+    }
+
+    return indices;
+}
+
+void ChAssembly::GatherBodyStates(const std::vector<int>& indices, double* buffer) const {
+    for (size_t k = 0; k < indices.size(); k++) {
+        const ChBody* body = bodylist[indices[k]].get();
+        double* state = buffer + k * body_state_doubles;
+
+        const ChVector<>& pos = body->GetCoord().pos;
+        const ChQuaternion<>& rot = body->GetCoord().rot;
+        const ChVector<>& pos_dt = body->GetCoord_dt().pos;
+        ChVector<> wvel = body->GetWvel_loc();
+
+        state[0] = pos.x();
+        state[1] = pos.y();
+        state[2] = pos.z();
+        state[3] = rot.e0();
+        state[4] = rot.e1();
+        state[5] = rot.e2();
+        state[6] = rot.e3();
+        state[7] = pos_dt.x();
+        state[8] = pos_dt.y();
+        state[9] = pos_dt.z();
+        state[10] = wvel.x();
+        state[11] = wvel.y();
+        state[12] = wvel.z();
+    }
+}
+
+void ChAssembly::ScatterBodyStates(const std::vector<int>& indices, const double* buffer) {
+    for (size_t k = 0; k < indices.size(); k++) {
+        ChBody* body = bodylist[indices[k]].get();
+        const double* state = buffer + k * body_state_doubles;
+
+        body->SetCoord(ChCoordsys<>(ChVector<>(state[0], state[1], state[2]),
+                                    ChQuaternion<>(state[3], state[4], state[5], state[6])));
+        body->SetPos_dt(ChVector<>(state[7], state[8], state[9]));
+        body->SetWvel_loc(ChVector<>(state[10], state[11], state[12]));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void ChAssembly::SetSystem(ChSystem* m_system) {
     system = m_system;
 
@@ -323,7 +430,39 @@ void ChAssembly::SetSystem(ChSystem* m_system) {
     }
 }
 
+const std::vector<ChBody*>& ChAssembly::GetBodiesRawTable() {
+    if (raw_tables_revision != topology_revision) {
+        bodylist_raw.resize(bodylist.size());
+        for (size_t i = 0; i < bodylist.size(); i++) {
+            bodylist_raw[i] = bodylist[i].get();
+        }
+        meshlist_raw.resize(meshlist.size());
+        for (size_t i = 0; i < meshlist.size(); i++) {
+            meshlist_raw[i] = meshlist[i].get();
+        }
+        raw_tables_revision = topology_revision;
+    }
+    return bodylist_raw;
+}
+
+const std::vector<fea::ChMesh*>& ChAssembly::GetMeshesRawTable() {
+    GetBodiesRawTable();  // rebuilds all raw tables if out of date
+    return meshlist_raw;
+}
+
 void ChAssembly::SyncCollisionModels() {
+#ifdef _OPENMP
+    int nthreads = system ? system->GetParallelThreadNumber() : 1;
+    if (nthreads > 1) {
+        // Each body only writes the transform of its own collision model, so the
+        // (typically dominant) body list can be synchronized in parallel.
+        const std::vector<ChBody*>& bodies = GetBodiesRawTable();
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int ip = 0; ip < (int)bodies.size(); ++ip) {
+            bodies[ip]->SyncCollisionModels();
+        }
+    } else
+#endif
     for (auto& body : bodylist) {
         body->SyncCollisionModels();
     }
@@ -344,6 +483,11 @@ void ChAssembly::SyncCollisionModels() {
 // Count all bodies, links, meshes, and other physics items.
 // Set counters (DOF, num constraints, etc) and offsets.
 void ChAssembly::Setup() {
+    if (incremental_setup) {
+        SetupIncremental();
+        return;
+    }
+
     nbodies = 0;
     nbodies_sleep = 0;
     nbodies_fixed = 0;
@@ -382,6 +526,73 @@ void ChAssembly::Setup() {
         }
     }
 
+    SetupOtherLists();
+}
+
+// As Setup(), but with stable body coordinate slots: bodies keep the slot assigned at
+// their first Setup() sighting, removed bodies leave their slot to a free-list, and new
+// bodies take a recycled slot or are numbered at the tail of the body region.
+void ChAssembly::SetupIncremental() {
+    nbodies = 0;
+    nbodies_sleep = 0;
+    nbodies_fixed = 0;
+    ncoords = 0;
+    ncoords_w = 0;
+    ndoc = 0;
+    ndoc_w = 0;
+    ndoc_w_C = 0;
+    ndoc_w_D = 0;
+    nlinks = 0;
+    nmeshes = 0;
+    nphysicsitems = 0;
+
+    // Add any items queued for insertion in the assembly's lists.
+    this->FlushBatch();
+
+    // Assign a slot to bodies seen here for the first time.
+    for (auto& body : bodylist) {
+        if (body_slot_map.find(body.get()) == body_slot_map.end()) {
+            int slot;
+            if (!body_slot_free.empty()) {
+                slot = body_slot_free.back();
+                body_slot_free.pop_back();
+            } else {
+                slot = body_slot_count++;
+            }
+            body_slot_map[body.get()] = slot;
+        }
+    }
+
+    // Collect the slots that currently back no active body (recycled slots plus the
+    // slots of fixed and sleeping bodies); see ClearUnusedBodySlots().
+    body_slot_unused = body_slot_free;
+
+    for (auto& body : bodylist) {
+        int slot = body_slot_map[body.get()];
+        if (body->GetBodyFixed()) {
+            nbodies_fixed++;
+            body_slot_unused.push_back(slot);
+        } else if (body->GetSleeping()) {
+            nbodies_sleep++;
+            body_slot_unused.push_back(slot);
+        } else {
+            nbodies++;
+
+            body->SetOffset_x(this->offset_x + 7 * slot);
+            body->SetOffset_w(this->offset_w + 6 * slot);
+            body->SetOffset_L(this->offset_L + ndoc_w);
+        }
+    }
+
+    // The body region spans all slots, including the currently unused ones;
+    // compaction is deferred to an explicit CompactCoordinates() call.
+    ncoords = 7 * body_slot_count;
+    ncoords_w = 6 * body_slot_count;
+
+    SetupOtherLists();
+}
+
+void ChAssembly::SetupOtherLists() {
     for (auto& link : linklist) {
         if (link->IsActive()) {
             nlinks++;
@@ -440,6 +651,97 @@ void ChAssembly::Setup() {
     ndof = ncoords_w - ndoc_w;
 }
 
+void ChAssembly::SetIncrementalSetup(bool val) {
+    if (incremental_setup && !val)
+        CompactCoordinates();
+    incremental_setup = val;
+}
+
+void ChAssembly::CompactCoordinates() {
+    if (body_slot_map.empty() && body_slot_free.empty())
+        return;
+
+    body_slot_map.clear();
+    body_slot_free.clear();
+    body_slot_unused.clear();
+    body_slot_count = 0;
+
+    // The numbering changes: caches keyed on the topology revision must refresh.
+    BumpTopologyRevision(TOPOLOGY_BODIES);
+}
+
+// Spread the lower 10 bits of v so that they occupy every third bit position,
+// for interleaving into a 30-bit Morton code.
+static uint32_t Morton_SpreadBits3(uint32_t v) {
+    v &= 0x000003ff;
+    v = (v | (v << 16)) & 0x030000ff;
+    v = (v | (v << 8)) & 0x0300f00f;
+    v = (v | (v << 4)) & 0x030c30c3;
+    v = (v | (v << 2)) & 0x09249249;
+    return v;
+}
+
+void ChAssembly::SortBodiesSpatially() {
+    if (bodylist.size() < 2)
+        return;
+
+    // Bounding box of the body positions.
+    ChVector<> bbmin = bodylist[0]->GetPos();
+    ChVector<> bbmax = bbmin;
+    for (auto& body : bodylist) {
+        const ChVector<>& p = body->GetPos();
+        bbmin.x() = ChMin(bbmin.x(), p.x());
+        bbmin.y() = ChMin(bbmin.y(), p.y());
+        bbmin.z() = ChMin(bbmin.z(), p.z());
+        bbmax.x() = ChMax(bbmax.x(), p.x());
+        bbmax.y() = ChMax(bbmax.y(), p.y());
+        bbmax.z() = ChMax(bbmax.z(), p.z());
+    }
+
+    ChVector<> size = bbmax - bbmin;
+    double maxsize = ChMax(ChMax(size.x(), size.y()), size.z());
+    if (maxsize <= 0)
+        return;  // all bodies coincident: nothing to gain
+
+    // Quantize positions on a 1024^3 grid and interleave into Morton codes.
+    double scale = 1023.0 / maxsize;
+    std::vector<std::pair<uint32_t, std::shared_ptr<ChBody>>> keyed;
+    keyed.reserve(bodylist.size());
+    for (auto& body : bodylist) {
+        ChVector<> p = (body->GetPos() - bbmin) * scale;
+        uint32_t cx = (uint32_t)ChClamp(p.x(), 0.0, 1023.0);
+        uint32_t cy = (uint32_t)ChClamp(p.y(), 0.0, 1023.0);
+        uint32_t cz = (uint32_t)ChClamp(p.z(), 0.0, 1023.0);
+        uint32_t code = (Morton_SpreadBits3(cx) << 2) | (Morton_SpreadBits3(cy) << 1) | Morton_SpreadBits3(cz);
+        keyed.emplace_back(code, body);
+    }
+
+    std::stable_sort(keyed.begin(), keyed.end(),
+                     [](const std::pair<uint32_t, std::shared_ptr<ChBody>>& a,
+                        const std::pair<uint32_t, std::shared_ptr<ChBody>>& b) { return a.first < b.first; });
+
+    for (size_t i = 0; i < keyed.size(); i++)
+        bodylist[i] = keyed[i].second;
+
+    // Offsets follow the list order: drop any stable slot assignment so the next
+    // Setup() renumbers in the new order, and invalidate topology-keyed caches.
+    CompactCoordinates();
+    BumpTopologyRevision(TOPOLOGY_BODIES);
+}
+
+void ChAssembly::ClearUnusedBodySlots(ChState* x, unsigned int base_x, ChStateDelta* v, unsigned int base_v) const {
+    for (int slot : body_slot_unused) {
+        if (x) {
+            for (int i = 0; i < 7; i++)
+                (*x)(base_x + 7 * slot + i) = 0;
+        }
+        if (v) {
+            for (int i = 0; i < 6; i++)
+                (*v)(base_v + 6 * slot + i) = 0;
+        }
+    }
+}
+
 // Update assembly's own properties first (ChTime and assets, if any).
 // Then update all contents of this assembly.
 void ChAssembly::Update(double mytime, bool update_assets) {
@@ -451,6 +753,33 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
+#ifdef _OPENMP
+    int nthreads = system ? system->GetParallelThreadNumber() : 1;
+    if (nthreads > 1) {
+        // Bodies are mutually independent (each only touches its own markers and
+        // forces), as are meshes, so those lists can be updated in parallel. Links
+        // and other physics items may reference the bodies and markers they connect,
+        // so they are processed serially after the body update has completed.
+        const std::vector<ChBody*>& bodies = GetBodiesRawTable();
+        const std::vector<fea::ChMesh*>& meshes = GetMeshesRawTable();
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int ip = 0; ip < (int)bodies.size(); ++ip) {
+            bodies[ip]->Update(ChTime, update_assets);
+        }
+        for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
+            otherphysicslist[ip]->Update(ChTime, update_assets);
+        }
+        for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+            linklist[ip]->Update(ChTime, update_assets);
+        }
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 1)
+        for (int ip = 0; ip < (int)meshes.size(); ++ip) {
+            meshes[ip]->Update(ChTime, update_assets);
+        }
+        return;
+    }
+#endif
+
     //// NOTE: do not switch these to range for loops (may want to use OMP for)
     for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
         bodylist[ip]->Update(ChTime, update_assets);
@@ -489,6 +818,8 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
+    ClearUnusedBodySlots(&x, off_x, &v, off_v);
+
     for (auto& body : bodylist) {
         if (body->IsActive())
             body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
@@ -540,6 +871,8 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
 
+    ClearUnusedBodySlots(nullptr, 0, &a, off_a);
+
     for (auto& body : bodylist) {
         if (body->IsActive())
             body->IntStateGatherAcceleration(displ_a + body->GetOffset_w(), a);
@@ -624,6 +957,8 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
+    ClearUnusedBodySlots(&x_new, off_x, nullptr, 0);
+
     for (auto& body : bodylist) {
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
@@ -792,6 +1127,8 @@ void ChAssembly::IntFromDescriptor(const unsigned int off_v,
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
 
+    ClearUnusedBodySlots(nullptr, 0, &v, off_v);
+
     for (auto& body : bodylist) {
         if (body->IsActive())
             body->IntFromDescriptor(displ_v + body->GetOffset_w(), v, displ_L + body->GetOffset_L(), L);
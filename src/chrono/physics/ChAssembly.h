@@ -16,6 +16,7 @@
 #define CHASSEMBLY_H
 
 #include <cmath>
+#include <unordered_map>
 #include "chrono/fea/ChMesh.h"
 #include "chrono/physics/ChLinksAll.h"
 #include "chrono/physics/ChPhysicsItem.h"
@@ -104,6 +105,16 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Get the list of physics items that are not in the body or link lists.
     const std::vector<std::shared_ptr<ChPhysicsItem>>& Get_otherphysicslist() const { return otherphysicslist; }
 
+    /// Get the raw-pointer table of the bodies in this assembly.
+    /// The table mirrors the body list and is rebuilt only when items are added to or
+    /// removed from the assembly (see GetTopologyRevision): hot loops can iterate it
+    /// without touching the shared_ptr control blocks, while ownership stays with the
+    /// shared_ptr lists. Pointers remain valid as long as the topology is unchanged.
+    const std::vector<ChBody*>& GetBodiesRawTable();
+
+    /// Get the raw-pointer table of the meshes in this assembly (see GetBodiesRawTable).
+    const std::vector<fea::ChMesh*>& GetMeshesRawTable();
+
     /// Search a body by its name.
     std::shared_ptr<ChBody> SearchBody(const char* name);
     /// Search a link by its name.
@@ -120,6 +131,114 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Search a marker by its unique ID.
     std::shared_ptr<ChMarker> SearchMarker(int markID);
 
+    //
+    // BULK BODY STATE ACCESS
+    //
+
+    /// Number of scalars per body in the buffers of the bulk body state accessors:
+    /// position (3), rotation quaternion (4), linear velocity (3), and angular velocity
+    /// expressed in the local frame (3).
+    static const int body_state_doubles = 13;
+
+    /// Build the index set used by GatherBodyStates() / ScatterBodyStates() for the given
+    /// selection of bodies. Indices refer to positions in the body list, so a cached set
+    /// stays valid as long as no item is added to or removed from the assembly; rebuild it
+    /// whenever GetTopologyRevision() changed. Bodies not contained in this assembly are
+    /// silently skipped.
+    std::vector<int> CacheBodyIndices(const std::vector<std::shared_ptr<ChBody>>& bodies) const;
+
+    /// Fill the caller-provided contiguous buffer with the current states of the selected
+    /// bodies, in a single pass: body k of the index set writes #body_state_doubles values
+    /// starting at buffer[k * body_state_doubles], laid out as [pos, rot, pos_dt, wvel_loc].
+    /// The buffer must hold at least indices.size() * #body_state_doubles doubles.
+    /// Meant for external controllers (e.g. MPC) that query many body states per control
+    /// cycle: one sweep over a cached index set instead of per-body accessor chains.
+    void GatherBodyStates(const std::vector<int>& indices, double* buffer) const;
+
+    /// Set the states of the selected bodies from a contiguous buffer with the same layout
+    /// as in GatherBodyStates(). Note that, like the individual ChBody setters, this does
+    /// not update markers, forces, or assets of the modified bodies; a subsequent Update()
+    /// call does.
+    void ScatterBodyStates(const std::vector<int>& indices, const double* buffer);
+
+    /// Enable/disable incremental setup with stable body coordinate offsets (default: false).
+    /// In incremental mode, each rigid body is assigned a fixed-size coordinate slot which it
+    /// keeps for its whole life: slots freed by removed bodies are recycled through a free-list
+    /// and newly added bodies are numbered at the tail of the body region, so Setup() never
+    /// renumbers the surviving bodies when the population changes. This is intended for
+    /// simulations that continuously spawn and remove bodies (e.g. with ChParticleRemover).
+    /// The coordinate space can accumulate unused slots over time; call #CompactCoordinates()
+    /// to squeeze it back to a dense numbering.
+    void SetIncrementalSetup(bool val);
+    bool GetIncrementalSetup() const { return incremental_setup; }
+
+    /// Drop the stable slot assignment built in incremental mode, so that the next Setup()
+    /// call renumbers all body coordinates densely. This invalidates topology-dependent
+    /// caches (the topology revision counter is incremented).
+    void CompactCoordinates();
+
+    /// Reorder the body list along a Morton (Z-order) space-filling curve of the current
+    /// body positions. Since state offsets and solver variables follow the list order,
+    /// bodies that are close in space then end up close in the system vectors, improving
+    /// cache locality during contact jacobian assembly and solver sweeps. The numbering
+    /// changes, so topology-dependent caches are invalidated (topology revision bump);
+    /// call this periodically, not at every step.
+    void SortBodiesSpatially();
+
+    //
+    // TOPOLOGY CHANGE JOURNAL
+    //
+
+    /// Categories of the topology change journal. Each insertion/removal path bumps the
+    /// counter of its own category (plus the global counter), so a consumer that depends
+    /// only on, say, the set of bodies is not invalidated when a link is added.
+    /// Note: collision shapes are journaled by the collision engine itself; see
+    /// collision::ChCollisionSystem::GetShapeRevision().
+    enum TopologyCategory {
+        TOPOLOGY_BODIES = 0,      ///< the set or the numbering of the bodies changed
+        TOPOLOGY_LINKS,           ///< the set of links changed
+        TOPOLOGY_MESHES,          ///< the set of FEA meshes changed
+        TOPOLOGY_OTHER_PHYSICS,   ///< the set of other physics items changed
+        TOPOLOGY_NUM_CATEGORIES,  ///< number of journal categories (not a category)
+    };
+
+    /// Get the topology revision counter.
+    /// The counter is incremented every time a physics item is added to or removed from
+    /// this assembly. Consumers that cache topology-dependent data (e.g. the sparsity
+    /// pattern of the system matrix) can compare this value against the one seen at the
+    /// time the cache was built, to cheaply detect when the cache must be invalidated.
+    unsigned int GetTopologyRevision() const { return topology_revision; }
+
+    /// Get the topology revision counter of a single journal category.
+    /// Like GetTopologyRevision(), but incremented only by changes of the given category,
+    /// so caches that depend on a single item list can survive changes of the others.
+    unsigned int GetTopologyRevision(TopologyCategory category) const {
+        return topology_revision_cat[category];
+    }
+
+    /// Class to be used as a callback interface for subscribers to the topology change
+    /// journal, notified whenever an insertion or removal bumps a revision counter.
+    class ChApi TopologyChangeCallback {
+      public:
+        virtual ~TopologyChangeCallback() {}
+
+        /// Called after the journal counter of the given category was incremented.
+        /// 'generation' is the new value of the global topology revision counter.
+        /// Note: called from within the Add()/Remove() paths, so the callback must not
+        /// itself add or remove items of the notifying assembly.
+        virtual void OnTopologyChange(ChAssembly* assembly, TopologyCategory category, unsigned int generation) {}
+    };
+
+    /// Subscribe a callback object to the topology change journal. Multiple such
+    /// callback objects can be registered with an assembly; each is invoked at every
+    /// insertion or removal of a physics item. The caller retains ownership.
+    void RegisterTopologyChangeCallback(TopologyChangeCallback* callback) {
+        topology_callbacks.push_back(callback);
+    }
+
+    /// Unsubscribe a callback object from the topology change journal.
+    void UnregisterTopologyChangeCallback(TopologyChangeCallback* callback);
+
     //
     // STATISTICS
     //
@@ -282,6 +401,18 @@ class ChApi ChAssembly : public ChPhysicsItem {
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
   protected:
+    /// Setup() implementation with stable body coordinate slots (see SetIncrementalSetup).
+    void SetupIncremental();
+
+    /// Number links, meshes and other physics items after the body region, and finalize
+    /// the assembly counters. Common tail of Setup() and SetupIncremental().
+    void SetupOtherLists();
+
+    /// Zero the state entries of body slots that currently back no active body (recycled
+    /// slots and slots of fixed/sleeping bodies), so that whole-vector operations in the
+    /// timesteppers (norms, error estimates) see zeros instead of stale values.
+    void ClearUnusedBodySlots(ChState* x, unsigned int base_x, ChStateDelta* v, unsigned int base_v) const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChLink>> linklist;                 ///< list of joints (links)
     std::vector<std::shared_ptr<fea::ChMesh>> meshlist;            ///< list of meshes
@@ -304,6 +435,26 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_D;       ///< number of scalar constraints D, when using 3 rot. dof. per body (only unilaterals)
     int nbodies_sleep;  ///< number of bodies that are sleeping
     int nbodies_fixed;  ///< number of bodies that are fixed
+
+    unsigned int topology_revision;  ///< incremented at every insertion/removal of a physics item
+    unsigned int topology_revision_cat[TOPOLOGY_NUM_CATEGORIES];  ///< per-category journal counters
+    std::vector<TopologyChangeCallback*> topology_callbacks;      ///< journal subscribers (not owned)
+
+    /// Increment the global and the per-category topology revision counters and
+    /// notify the journal subscribers. Called by every insertion/removal path.
+    void BumpTopologyRevision(TopologyCategory category);
+
+    std::vector<ChBody*> bodylist_raw;       ///< raw-pointer mirror of bodylist (see GetBodiesRawTable)
+    std::vector<fea::ChMesh*> meshlist_raw;  ///< raw-pointer mirror of meshlist
+    unsigned int raw_tables_revision;        ///< topology revision at which the raw tables were built
+
+    // Incremental setup bookkeeping (see SetIncrementalSetup).
+    // A body slot spans 7 position coordinates and 6 velocity-level coordinates.
+    bool incremental_setup;                          ///< use stable body coordinate slots in Setup()?
+    int body_slot_count;                             ///< number of body slots (used + free) in the offset space
+    std::vector<int> body_slot_free;                 ///< recycled slots of removed bodies
+    std::vector<int> body_slot_unused;               ///< slots currently backing no active body
+    std::unordered_map<ChBody*, int> body_slot_map;  ///< stable slot assigned to each body
 };
 
 CH_CLASS_VERSION(ChAssembly, 0)
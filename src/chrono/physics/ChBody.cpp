@@ -61,6 +61,7 @@ ChBody::ChBody(ChMaterialSurface::ContactMethod contact_method) {
     density = 1000.0f;
 
     last_coll_pos = CSYSNORM;
+    last_sync_valid = false;
 
 
     max_speed = 0.5f;
@@ -106,6 +107,7 @@ ChBody::ChBody(std::shared_ptr<collision::ChCollisionModel> new_collision_model,
     density = 1000.0f;
 
     last_coll_pos = CSYSNORM;
+    last_sync_valid = false;
 
     max_speed = 0.5f;
     max_wvel = 2.0f * float(CH_C_PI);
@@ -145,6 +147,7 @@ ChBody::ChBody(const ChBody& other) : ChPhysicsItem(other), ChBodyFrame(other) {
     Scr_torque = other.Scr_torque;
 
     last_coll_pos = other.last_coll_pos;
+    last_sync_valid = false;
 
     max_speed = other.max_speed;
     max_wvel = other.max_wvel;
@@ -813,6 +816,7 @@ void ChBody::SetCollisionModel(std::shared_ptr<collision::ChCollisionModel> new_
 
     collision_model = new_collision_model;
     collision_model->SetContactable(this);
+    last_sync_valid = false;
 }
 
 bool ChBody::RecomputeCollisionModel() {
@@ -829,8 +833,17 @@ bool ChBody::RecomputeCollisionModel() {
 }
 
 void ChBody::SyncCollisionModels() {
-    if (this->GetCollide())
-        this->GetCollisionModel()->SyncPosition();
+    if (!this->GetCollide())
+        return;
+
+    // Skip the transform copy into the collision engine if the body did not move
+    // since the last sync (the common case for sleeping/settled bodies).
+    if (last_sync_valid && coord.pos == last_sync_csys.pos && coord.rot == last_sync_csys.rot)
+        return;
+    last_sync_csys = coord;
+    last_sync_valid = true;
+
+    this->GetCollisionModel()->SyncPosition();
 }
 
 void ChBody::AddCollisionModelsToSystem() {
@@ -874,26 +887,8 @@ void ChBody::ComputeJacobianForContactPart(const ChVector<>& abs_point,
                                            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
                                            ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
                                            bool second) {
-    ChVector<> m_p1_loc = this->Point_World2Body(abs_point);
-    ChMatrix33<> Jx1, Jr1;
-    ChMatrix33<> Ps1, Jtemp;
-    Ps1.Set_X_matrix(m_p1_loc);
-
-    Jx1.CopyFromMatrixT(contact_plane);
-    if (!second)
-        Jx1.MatrNeg();
-
-    Jtemp.MatrMultiply(this->GetA(), Ps1);
-    Jr1.MatrTMultiply(contact_plane, Jtemp);
-    if (second)
-        Jr1.MatrNeg();
-
-    jacobian_tuple_N.Get_Cq()->PasteClippedMatrix(Jx1, 0, 0, 1, 3, 0, 0);
-    jacobian_tuple_U.Get_Cq()->PasteClippedMatrix(Jx1, 1, 0, 1, 3, 0, 0);
-    jacobian_tuple_V.Get_Cq()->PasteClippedMatrix(Jx1, 2, 0, 1, 3, 0, 0);
-    jacobian_tuple_N.Get_Cq()->PasteClippedMatrix(Jr1, 0, 0, 1, 3, 0, 3);
-    jacobian_tuple_U.Get_Cq()->PasteClippedMatrix(Jr1, 1, 0, 1, 3, 0, 3);
-    jacobian_tuple_V.Get_Cq()->PasteClippedMatrix(Jr1, 2, 0, 1, 3, 0, 3);
+    ComputeContactJacobian6dof(this->GetPos(), this->GetA(), abs_point, contact_plane, jacobian_tuple_N,
+                               jacobian_tuple_U, jacobian_tuple_V, second);
 }
 
 void ChBody::ComputeJacobianForRollingContactPart(
@@ -71,6 +71,11 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     // routines require to know the last time that coll. detect. was satisfied
     ChCoordsys<> last_coll_pos;  ///< cached position at last collision
 
+    // Auxiliary, stores the coordinates at the last collision model sync, so the
+    // transform copy into the collision engine can be skipped for unmoved bodies
+    ChCoordsys<> last_sync_csys;  ///< cached coordinates at last collision model sync
+    bool last_sync_valid;         ///< is last_sync_csys usable for sync filtering?
+
     float density;  ///< used when doing the 'recompute mass' operation.
 
     ChVariablesBodyOwnMass variables;  ///< interface to solver (store inertia and coordinates)
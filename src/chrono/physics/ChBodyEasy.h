@@ -22,6 +22,7 @@
 #include "chrono/assets/ChSphereShape.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/collision/ChCCollisionUtils.h"
+#include "chrono/collision/ChCModelBullet.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChBodyAuxRef.h"
 
@@ -351,7 +352,9 @@ class ChBodyEasyMesh : public ChBodyAuxRef {
         bool collide = false,         ///< enable the collision detection
         double sphere_swept = 0.001,  ///< radius of 'inflating' of mesh, leads to more robust collision detection
         bool visual_asset = true,     ///< attach a visualization asset to the body
-        ChMaterialSurface::ContactMethod contact_method = ChMaterialSurface::NSC  ///< contact method
+        ChMaterialSurface::ContactMethod contact_method = ChMaterialSurface::NSC,  ///< contact method
+        bool lod_coarse_hull = false  ///< also build a coarse convex hull level, used except near other fine-detail
+                                      ///< bodies (see ChModelBullet::BeginFineDetail)
         )
         : ChBodyAuxRef(contact_method) {
         auto trimesh = std::make_shared< geometry::ChTriangleMeshConnected>();
@@ -382,6 +385,15 @@ class ChBodyEasyMesh : public ChBodyAuxRef {
         if (collide) {
             // coll.model is respect to REF c.sys
             GetCollisionModel()->ClearModel();
+            if (lod_coarse_hull) {
+                // The hull is the level used by default; the collision system
+                // switches to the triangle mesh below only while the broadphase
+                // reports proximity to another fine-detail body.
+                if (auto bt_model = std::dynamic_pointer_cast<collision::ChModelBullet>(GetCollisionModel())) {
+                    bt_model->AddConvexHull(trimesh->getCoordsVertices());
+                    bt_model->BeginFineDetail();
+                }
+            }
             GetCollisionModel()->AddTriangleMesh(trimesh, false, false, VNULL, ChMatrix33<>(1), sphere_swept);
             GetCollisionModel()->BuildModel();
             SetCollide(true);
@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CH_CONTACTARENA_H
+#define CH_CONTACTARENA_H
+
+#include <memory>
+#include <vector>
+
+namespace chrono {
+
+/// Chunked arena allocator for the per-step contact objects of a contact container.
+///
+/// Contact containers create and destroy a large number of small, identical contact
+/// objects at every step; allocating each of them with operator new causes heap churn
+/// and scatters the objects in memory, making the per-contact iteration during
+/// jacobian setup pointer-chasing. This arena hands out objects from contiguous
+/// chunks, so consecutively created contacts are (mostly) adjacent in memory, and
+/// destroyed objects go to a free list so the steady-state simulation performs no
+/// heap allocation at all.
+///
+/// Objects obtained from Create() must be returned to the same arena with Destroy();
+/// the arena does not track live objects and only releases its memory when destroyed.
+template <class Tcont>
+class ChContactArena {
+  public:
+    ChContactArena(size_t chunk_size = 512) : m_chunk_size(chunk_size), m_next_in_chunk(chunk_size) {}
+
+    ~ChContactArena() {}
+
+    /// Construct a contact object in the arena, forwarding the given arguments,
+    /// reusing a free slot if one is available.
+    template <typename... Args>
+    Tcont* Create(Args&&... args) {
+        return new (allocate()) Tcont(std::forward<Args>(args)...);
+    }
+
+    /// Destroy a contact object previously obtained from Create() and make its
+    /// slot available for reuse.
+    void Destroy(Tcont* obj) {
+        obj->~Tcont();
+        m_free_slots.push_back(obj);
+    }
+
+    /// Ensure the arena owns storage for at least n objects, allocating whole
+    /// chunks ahead of time. Lets a container size the arena from an estimate
+    /// of the upcoming contact count, so that the allocation does not happen
+    /// in the middle of contact generation.
+    void Reserve(size_t n) {
+        if (m_chunks.size() * m_chunk_size >= n)
+            return;
+        // The untouched tail of the current chunk would be skipped once new
+        // chunks are appended; hand it to the free list instead.
+        if (!m_chunks.empty()) {
+            for (size_t i = m_chunk_size; i-- > m_next_in_chunk;)
+                m_free_slots.push_back(&m_chunks.back()[i]);
+        }
+        while (m_chunks.size() * m_chunk_size < n) {
+            m_chunks.emplace_back(new storage_t[m_chunk_size]);
+            // pushed in reverse so that consecutive Create() calls still hand
+            // out ascending addresses
+            for (size_t i = m_chunk_size; i-- > 0;)
+                m_free_slots.push_back(&m_chunks.back()[i]);
+        }
+        m_next_in_chunk = m_chunk_size;
+    }
+
+    /// Number of objects each memory chunk can hold.
+    size_t GetChunkSize() const { return m_chunk_size; }
+
+    /// Total number of object slots currently reserved by the arena.
+    size_t GetCapacity() const { return m_chunks.size() * m_chunk_size; }
+
+  private:
+    /// Get a raw slot, either from the free list or from the current chunk,
+    /// allocating a new chunk when the current one is exhausted.
+    void* allocate() {
+        if (!m_free_slots.empty()) {
+            void* slot = m_free_slots.back();
+            m_free_slots.pop_back();
+            return slot;
+        }
+        if (m_next_in_chunk == m_chunk_size) {
+            m_chunks.emplace_back(new storage_t[m_chunk_size]);
+            m_next_in_chunk = 0;
+        }
+        return &m_chunks.back()[m_next_in_chunk++];
+    }
+
+    typedef typename std::aligned_storage<sizeof(Tcont), alignof(Tcont)>::type storage_t;
+
+    size_t m_chunk_size;                                ///< number of object slots per chunk
+    size_t m_next_in_chunk;                             ///< first unused slot in the newest chunk
+    std::vector<std::unique_ptr<storage_t[]>> m_chunks; ///< contiguous storage chunks
+    std::vector<void*> m_free_slots;                    ///< slots of destroyed objects, ready for reuse
+};
+
+}  // end namespace chrono
+
+#endif
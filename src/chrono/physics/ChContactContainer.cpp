@@ -24,6 +24,52 @@ ChContactContainer::ChContactContainer(const ChContactContainer& other) : ChPhys
     report_contact_callback = other.report_contact_callback;
 }
 
+namespace {
+
+// Adapter used by the default ExtractContacts implementation: converts each reported
+// contact into a ContactData record, applying the (optional) filter.
+class ContactDataExtractor : public ChContactContainer::ReportContactCallback {
+  public:
+    ContactDataExtractor(std::vector<ChContactContainer::ContactData>& moutput,
+                         const ChContactContainer::ContactFilter* mfilter)
+        : output(moutput), filter(mfilter) {}
+
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        if (filter && !filter->Match(contactobjA, contactobjB, pA))
+            return true;
+        ChContactContainer::ContactData record;
+        record.pA = pA;
+        record.pB = pB;
+        record.normal = plane_coord.Get_A_Xaxis();
+        record.distance = distance;
+        record.eff_radius = eff_radius;
+        record.react_force = react_forces;
+        record.react_torque = react_torques;
+        record.objA = contactobjA;
+        record.objB = contactobjB;
+        output.push_back(record);
+        return true;
+    }
+
+    std::vector<ChContactContainer::ContactData>& output;
+    const ChContactContainer::ContactFilter* filter;
+};
+
+}  // namespace
+
+void ChContactContainer::ExtractContacts(std::vector<ContactData>& output, const ContactFilter* filter) {
+    ContactDataExtractor extractor(output, filter);
+    ReportAllContacts(&extractor);
+}
+
 ChVector<> ChContactContainer::GetContactableForce(ChContactable* contactable) {
     std::unordered_map<ChContactable*, ForceTorque>::const_iterator Iterator = contact_forces.find(contactable);
     if (Iterator != contact_forces.end()) {
@@ -17,6 +17,8 @@
 
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "chrono/collision/ChCCollisionInfo.h"
 #include "chrono/physics/ChBody.h"
@@ -114,6 +116,49 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// Derived classes of ChContactContainer should try to implement this.
     virtual void ReportAllContacts(ReportContactCallback* mcallback) {}
 
+    /// Compact record of one contact, as written by ExtractContacts().
+    struct ContactData {
+        ChVector<> pA;            ///< contact point on first model, in absolute coordinates
+        ChVector<> pB;            ///< contact point on second model, in absolute coordinates
+        ChVector<> normal;        ///< contact normal, directed from pA to pB
+        double distance;          ///< contact distance (negative: penetration)
+        double eff_radius;        ///< effective radius of curvature at contact
+        ChVector<> react_force;   ///< reaction force, in the contact plane coordsystem (x = normal)
+        ChVector<> react_torque;  ///< reaction torque, if rolling friction
+        ChContactable* objA;      ///< first contacted model (may be nullptr, see ReportAllContacts)
+        ChContactable* objB;      ///< second contacted model (may be nullptr, see ReportAllContacts)
+    };
+
+    /// Filter for bulk contact extraction with ExtractContacts().
+    /// A contact is kept if it involves at least one of the given contactable objects
+    /// (when the set is not empty) and its first contact point lies inside the given
+    /// axis-aligned box (when enabled).
+    struct ContactFilter {
+        std::unordered_set<ChContactable*> objects;  ///< keep contacts touching these objects (empty: all)
+        bool use_aabb = false;                       ///< enable the spatial filter?
+        ChVector<> aabb_min;                         ///< lower corner of the filter box
+        ChVector<> aabb_max;                         ///< upper corner of the filter box
+
+        /// Evaluate the filter on one contact.
+        bool Match(ChContactable* objA, ChContactable* objB, const ChVector<>& pA) const {
+            if (!objects.empty() && objects.count(objA) == 0 && objects.count(objB) == 0)
+                return false;
+            if (use_aabb && (pA.x() < aabb_min.x() || pA.x() > aabb_max.x() ||  //
+                             pA.y() < aabb_min.y() || pA.y() > aabb_max.y() ||  //
+                             pA.z() < aabb_min.z() || pA.z() > aabb_max.z()))
+                return false;
+            return true;
+        }
+    };
+
+    /// Bulk extraction of contact data: append to \a output one record per contact, keeping
+    /// only the contacts accepted by \a filter (if provided). All records are written into the
+    /// caller's buffer in a single pass, with no per-contact virtual call to user code.
+    /// The default implementation adapts ReportAllContacts(); derived classes with direct
+    /// access to their contact storage should override it and evaluate the filter at the
+    /// source, so that discarded contacts are never expanded into records.
+    virtual void ExtractContacts(std::vector<ContactData>& output, const ContactFilter* filter = nullptr);
+
     /// Compute contact forces on all contactable objects in this container.
     /// If implemented by a derived class, these forces must be stored in the hash table
     /// contact_forces (with key a pointer to ChContactable and value a ForceTorque structure).
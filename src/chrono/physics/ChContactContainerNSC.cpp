@@ -35,7 +35,8 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      use_multiplier_cache(false) {}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
     n_added_6_6 = 0;
@@ -49,6 +50,7 @@ ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
     n_added_666_333 = 0;
     n_added_666_666 = 0;
     n_added_6_6_rolling = 0;
+    use_multiplier_cache = other.use_multiplier_cache;
 }
 
 ChContactContainerNSC::~ChContactContainerNSC() {
@@ -61,10 +63,10 @@ void ChContactContainerNSC::Update(double mytime, bool update_assets) {
 }
 
 template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
+void _RemoveAllContacts(std::list<Tcont*>& contactlist, ChContactArena<Tcont>& arena, Titer& lastcontact, int& n_added) {
     typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
-        delete (*itercontact);
+        arena.Destroy(*itercontact);
         (*itercontact) = 0;
         ++itercontact;
     }
@@ -74,20 +76,109 @@ void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int&
 }
 
 void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    _RemoveAllContacts(contactlist_6_6, arena_6_6, lastcontact_6_6, n_added_6_6);
+    _RemoveAllContacts(contactlist_6_3, arena_6_3, lastcontact_6_3, n_added_6_3);
+    _RemoveAllContacts(contactlist_3_3, arena_3_3, lastcontact_3_3, n_added_3_3);
+    _RemoveAllContacts(contactlist_333_3, arena_333_3, lastcontact_333_3, n_added_333_3);
+    _RemoveAllContacts(contactlist_333_6, arena_333_6, lastcontact_333_6, n_added_333_6);
+    _RemoveAllContacts(contactlist_333_333, arena_333_333, lastcontact_333_333, n_added_333_333);
+    _RemoveAllContacts(contactlist_666_3, arena_666_3, lastcontact_666_3, n_added_666_3);
+    _RemoveAllContacts(contactlist_666_6, arena_666_6, lastcontact_666_6, n_added_666_6);
+    _RemoveAllContacts(contactlist_666_333, arena_666_333, lastcontact_666_333, n_added_666_333);
+    _RemoveAllContacts(contactlist_666_666, arena_666_666, lastcontact_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_6_6_rolling, arena_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+}
+
+
+// Hashing for the persistent multiplier cache: combine the addresses of the two
+// contactable objects (and the ordinal of the contact within the pair) into a key.
+// A collision in this hash only results in a sub-optimal warm start, never in a
+// wrong solution, so no collision resolution is needed.
+static uint64_t _contact_pair_key(const void* objA, const void* objB) {
+    return (uint64_t)(uintptr_t)objA ^ ((uint64_t)(uintptr_t)objB * 0x9e3779b97f4a7c15ULL);
+}
+
+static uint64_t _contact_key(uint64_t pair_key, int ordinal) {
+    return pair_key ^ ((uint64_t)(ordinal + 1) << 32);
+}
+
+template <class Tcont>
+void _HarvestContactMultipliers(std::list<Tcont*>& contactlist,
+                                std::unordered_map<uint64_t, ChContactContainerNSC::ChCachedMultipliers>& cache,
+                                std::unordered_map<uint64_t, int>& pair_counters) {
+    for (auto itercontact = contactlist.begin(); itercontact != contactlist.end(); ++itercontact) {
+        uint64_t pair_key = _contact_pair_key((*itercontact)->GetObjA(), (*itercontact)->GetObjB());
+        ChContactContainerNSC::ChCachedMultipliers& entry = cache[_contact_key(pair_key, pair_counters[pair_key]++)];
+        entry.force = (*itercontact)->GetContactForce();
+        entry.torque = VNULL;
+    }
+}
+
+template <class Tcont>
+void _InjectContactMultipliers(std::list<Tcont*>& contactlist,
+                               const std::unordered_map<uint64_t, ChContactContainerNSC::ChCachedMultipliers>& cache,
+                               std::unordered_map<uint64_t, int>& pair_counters) {
+    for (auto itercontact = contactlist.begin(); itercontact != contactlist.end(); ++itercontact) {
+        uint64_t pair_key = _contact_pair_key((*itercontact)->GetObjA(), (*itercontact)->GetObjB());
+        auto entry = cache.find(_contact_key(pair_key, pair_counters[pair_key]++));
+        // do not overwrite multipliers already restored from the collision engine cache
+        if (entry != cache.end() && !(*itercontact)->HasReactionsCache())
+            (*itercontact)->SetContactForce(entry->second.force);
+    }
 }
 
 void ChContactContainerNSC::BeginAddContact() {
+    // Before recycling the contact lists, harvest the multipliers of the previous
+    // step into the persistent cache, so they can be re-injected in EndAddContact().
+    if (use_multiplier_cache) {
+        multiplier_cache.clear();
+        std::unordered_map<uint64_t, int> pair_counters;
+        _HarvestContactMultipliers(contactlist_6_6, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_6_3, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_3_3, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_333_3, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_333_6, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_333_333, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_666_3, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_666_6, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_666_333, multiplier_cache, pair_counters);
+        _HarvestContactMultipliers(contactlist_666_666, multiplier_cache, pair_counters);
+        for (auto itercontact = contactlist_6_6_rolling.begin(); itercontact != contactlist_6_6_rolling.end();
+             ++itercontact) {
+            uint64_t pair_key = _contact_pair_key((*itercontact)->GetObjA(), (*itercontact)->GetObjB());
+            ChCachedMultipliers& entry = multiplier_cache[_contact_key(pair_key, pair_counters[pair_key]++)];
+            entry.force = (*itercontact)->GetContactForce();
+            entry.torque = (*itercontact)->GetContactTorque();
+        }
+    }
+
+    // Predictive preallocation: update the exponentially-decayed peak of each
+    // per-type contact count with the count of the step just completed, and
+    // size the arenas ahead of the estimate (with some headroom) before the
+    // collision system starts adding contacts.
+    est_6_6 = ChMax((double)n_added_6_6, 0.9 * est_6_6);
+    est_6_3 = ChMax((double)n_added_6_3, 0.9 * est_6_3);
+    est_3_3 = ChMax((double)n_added_3_3, 0.9 * est_3_3);
+    est_333_3 = ChMax((double)n_added_333_3, 0.9 * est_333_3);
+    est_333_6 = ChMax((double)n_added_333_6, 0.9 * est_333_6);
+    est_333_333 = ChMax((double)n_added_333_333, 0.9 * est_333_333);
+    est_666_3 = ChMax((double)n_added_666_3, 0.9 * est_666_3);
+    est_666_6 = ChMax((double)n_added_666_6, 0.9 * est_666_6);
+    est_666_333 = ChMax((double)n_added_666_333, 0.9 * est_666_333);
+    est_666_666 = ChMax((double)n_added_666_666, 0.9 * est_666_666);
+    est_6_6_rolling = ChMax((double)n_added_6_6_rolling, 0.9 * est_6_6_rolling);
+    arena_6_6.Reserve((size_t)(1.5 * est_6_6));
+    arena_6_3.Reserve((size_t)(1.5 * est_6_3));
+    arena_3_3.Reserve((size_t)(1.5 * est_3_3));
+    arena_333_3.Reserve((size_t)(1.5 * est_333_3));
+    arena_333_6.Reserve((size_t)(1.5 * est_333_6));
+    arena_333_333.Reserve((size_t)(1.5 * est_333_333));
+    arena_666_3.Reserve((size_t)(1.5 * est_666_3));
+    arena_666_6.Reserve((size_t)(1.5 * est_666_6));
+    arena_666_333.Reserve((size_t)(1.5 * est_666_333));
+    arena_666_666.Reserve((size_t)(1.5 * est_666_666));
+    arena_6_6_rolling.Reserve((size_t)(1.5 * est_6_6_rolling));
+
     lastcontact_6_6 = contactlist_6_6.begin();
     n_added_6_6 = 0;
 
@@ -125,54 +216,80 @@ void ChContactContainerNSC::BeginAddContact() {
 void ChContactContainerNSC::EndAddContact() {
     // remove contacts that are beyond last contact
     while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
+        arena_6_6.Destroy(*lastcontact_6_6);
         lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
     }
     while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
+        arena_6_3.Destroy(*lastcontact_6_3);
         lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
     }
     while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
+        arena_3_3.Destroy(*lastcontact_3_3);
         lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
     }
     while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
+        arena_333_3.Destroy(*lastcontact_333_3);
         lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
     }
     while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
+        arena_333_6.Destroy(*lastcontact_333_6);
         lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
     }
     while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
+        arena_333_333.Destroy(*lastcontact_333_333);
         lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
     }
     while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
+        arena_666_3.Destroy(*lastcontact_666_3);
         lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
     }
     while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
+        arena_666_6.Destroy(*lastcontact_666_6);
         lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
     }
     while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
+        arena_666_333.Destroy(*lastcontact_666_333);
         lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
     }
     while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
+        arena_666_666.Destroy(*lastcontact_666_666);
         lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
     }
 
     while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
+        arena_6_6_rolling.Destroy(*lastcontact_6_6_rolling);
         lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
     }
+
+    // Re-inject the multipliers harvested in BeginAddContact() into the matching
+    // contacts of this step, to warm start the solver.
+    if (use_multiplier_cache) {
+        std::unordered_map<uint64_t, int> pair_counters;
+        _InjectContactMultipliers(contactlist_6_6, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_6_3, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_3_3, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_333_3, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_333_6, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_333_333, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_666_3, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_666_6, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_666_333, multiplier_cache, pair_counters);
+        _InjectContactMultipliers(contactlist_666_666, multiplier_cache, pair_counters);
+        for (auto itercontact = contactlist_6_6_rolling.begin(); itercontact != contactlist_6_6_rolling.end();
+             ++itercontact) {
+            uint64_t pair_key = _contact_pair_key((*itercontact)->GetObjA(), (*itercontact)->GetObjB());
+            auto entry = multiplier_cache.find(_contact_key(pair_key, pair_counters[pair_key]++));
+            if (entry != multiplier_cache.end() && !(*itercontact)->HasReactionsCache()) {
+                (*itercontact)->SetContactForce(entry->second.force);
+                (*itercontact)->SetContactTorque(entry->second.torque);
+            }
+        }
+    }
 }
 
 template <class Tcont, class Titer, class Ta, class Tb>
 void _OptimalContactInsert(std::list<Tcont*>& contactlist,          ///< contact list
+                           ChContactArena<Tcont>& arena,            ///< arena allocator for the contact objects
                            Titer& lastcontact,                      ///< last contact acquired
                            int& n_added,                            ///< number of contact inserted
                            ChContactContainer* mcontainer,          ///< contact container
@@ -186,8 +303,8 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,          ///< contact
         lastcontact++;
 
     } else {
-        // add new contact
-        Tcont* mc = new Tcont(mcontainer, objA, objB, cinfo);
+        // add new contact, allocated in the arena
+        Tcont* mc = arena.Create(mcontainer, objA, objB, cinfo);
         contactlist.push_back(mc);
         lastcontact = contactlist.end();
     }
@@ -233,16 +350,16 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& mcontac
         if (ChContactable_1vars<6>* mmboB = dynamic_cast<ChContactable_1vars<6>*>(mcontact.modelB->GetContactable())) {
             if ((mmatA->rolling_friction && mmatB->rolling_friction) ||
                 (mmatA->spinning_friction && mmatB->spinning_friction)) {
-                _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
+                _OptimalContactInsert(contactlist_6_6_rolling, arena_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
                                       mmboA, mmboB, mcontact);
             } else {
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, mmboA, mmboB, mcontact);
+                _OptimalContactInsert(contactlist_6_6, arena_6_6, lastcontact_6_6, n_added_6_6, this, mmboA, mmboB, mcontact);
             }
             return;
         }
         // 6_3
         if (ChContactable_1vars<3>* mmboB = dynamic_cast<ChContactable_1vars<3>*>(mcontact.modelB->GetContactable())) {
-            _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_6_3, arena_6_3, lastcontact_6_3, n_added_6_3, this, mmboA, mmboB, mcontact);
             return;
         }
     }
@@ -251,12 +368,12 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& mcontac
         // 3_6 -> 6_3
         if (ChContactable_1vars<6>* mmboB = dynamic_cast<ChContactable_1vars<6>*>(mcontact.modelB->GetContactable())) {
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, mmboB, mmboA, swapped_contact);
+            _OptimalContactInsert(contactlist_6_3, arena_6_3, lastcontact_6_3, n_added_6_3, this, mmboB, mmboA, swapped_contact);
             return;
         }
         // 3_3
         if (ChContactable_1vars<3>* mmboB = dynamic_cast<ChContactable_1vars<3>*>(mcontact.modelB->GetContactable())) {
-            _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_3_3, arena_3_3, lastcontact_3_3, n_added_3_3, this, mmboA, mmboB, mcontact);
             return;
         }
     }
@@ -264,20 +381,20 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& mcontac
     if (auto mmboA = dynamic_cast<ChContactable_1vars<3>*>(contactableA)) {
         if (auto mmboB = dynamic_cast<ChContactable_1vars<3>*>(contactableB)) {
             // 3_3
-            _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_3_3, arena_3_3, lastcontact_3_3, n_added_3_3, this, mmboA, mmboB, mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_1vars<6>*>(contactableB)) {
             // 3_6 -> 6_3
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, mmboB, mmboA, swapped_contact);
+            _OptimalContactInsert(contactlist_6_3, arena_6_3, lastcontact_6_3, n_added_6_3, this, mmboB, mmboA, swapped_contact);
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<3, 3, 3>*>(contactableB)) {
             // 3_333 -> 333_3
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, mmboB, mmboA,
+            _OptimalContactInsert(contactlist_333_3, arena_333_3, lastcontact_333_3, n_added_333_3, this, mmboB, mmboA,
                                   swapped_contact);
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<6, 6, 6>*>(contactableB)) {
             // 3_666 -> 666_3
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, mmboB, mmboA,
+            _OptimalContactInsert(contactlist_666_3, arena_666_3, lastcontact_666_3, n_added_666_3, this, mmboB, mmboA,
                                   swapped_contact);
         }
     }
@@ -285,25 +402,25 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& mcontac
     else if (auto mmboA = dynamic_cast<ChContactable_1vars<6>*>(contactableA)) {
         if (auto mmboB = dynamic_cast<ChContactable_1vars<3>*>(contactableB)) {
             // 6_3
-            _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_6_3, arena_6_3, lastcontact_6_3, n_added_6_3, this, mmboA, mmboB, mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_1vars<6>*>(contactableB)) {
             // 6_6    ***NOTE: for body-body one could have rolling friction: ***
             if ((mmatA->rolling_friction && mmatB->rolling_friction) ||
                 (mmatA->spinning_friction && mmatB->spinning_friction)) {
-                _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
+                _OptimalContactInsert(contactlist_6_6_rolling, arena_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
                                       mmboA, mmboB, mcontact);
             } else {
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, mmboA, mmboB, mcontact);
+                _OptimalContactInsert(contactlist_6_6, arena_6_6, lastcontact_6_6, n_added_6_6, this, mmboA, mmboB, mcontact);
             }
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<3, 3, 3>*>(contactableB)) {
             // 6_333 -> 333_6
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, mmboB, mmboA,
+            _OptimalContactInsert(contactlist_333_6, arena_333_6, lastcontact_333_6, n_added_333_6, this, mmboB, mmboA,
                                   swapped_contact);
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<6, 6, 6>*>(contactableB)) {
             // 6_666 -> 666_6
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, mmboB, mmboA,
+            _OptimalContactInsert(contactlist_666_6, arena_666_6, lastcontact_666_6, n_added_666_6, this, mmboB, mmboA,
                                   swapped_contact);
         }
     }
@@ -311,18 +428,18 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& mcontac
     else if (auto mmboA = dynamic_cast<ChContactable_3vars<3, 3, 3>*>(contactableA)) {
         if (auto mmboB = dynamic_cast<ChContactable_1vars<3>*>(contactableB)) {
             // 333_3
-            _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_333_3, arena_333_3, lastcontact_333_3, n_added_333_3, this, mmboA, mmboB, mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_1vars<6>*>(contactableB)) {
             // 333_6
-            _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_333_6, arena_333_6, lastcontact_333_6, n_added_333_6, this, mmboA, mmboB, mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<3, 3, 3>*>(contactableB)) {
             // 333_333
-            _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, mmboA, mmboB,
+            _OptimalContactInsert(contactlist_333_333, arena_333_333, lastcontact_333_333, n_added_333_333, this, mmboA, mmboB,
                                   mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<6, 6, 6>*>(contactableB)) {
             // 333_666 -> 666_333
             collision::ChCollisionInfo swapped_contact(mcontact, true);
-            _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, mmboB, mmboA,
+            _OptimalContactInsert(contactlist_666_333, arena_666_333, lastcontact_666_333, n_added_666_333, this, mmboB, mmboA,
                                   swapped_contact);
         }
     }
@@ -330,17 +447,17 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& mcontac
     else if (auto mmboA = dynamic_cast<ChContactable_3vars<6, 6, 6>*>(contactableA)) {
         if (auto mmboB = dynamic_cast<ChContactable_1vars<3>*>(contactableB)) {
             // 666_3
-            _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_666_3, arena_666_3, lastcontact_666_3, n_added_666_3, this, mmboA, mmboB, mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_1vars<6>*>(contactableB)) {
             // 666_6
-            _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, mmboA, mmboB, mcontact);
+            _OptimalContactInsert(contactlist_666_6, arena_666_6, lastcontact_666_6, n_added_666_6, this, mmboA, mmboB, mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<3, 3, 3>*>(contactableB)) {
             // 666_333
-            _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, mmboA, mmboB,
+            _OptimalContactInsert(contactlist_666_333, arena_666_333, lastcontact_666_333, n_added_666_333, this, mmboA, mmboB,
                                   mcontact);
         } else if (auto mmboB = dynamic_cast<ChContactable_3vars<6, 6, 6>*>(contactableB)) {
             // 666_666
-            _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, mmboA, mmboB,
+            _OptimalContactInsert(contactlist_666_666, arena_666_666, lastcontact_666_666, n_added_666_666, this, mmboA, mmboB,
                                   mcontact);
         }
     }
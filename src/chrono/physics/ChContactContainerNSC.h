@@ -16,7 +16,9 @@
 #define CH_CONTACTCONTAINER_NSC_H
 
 #include <list>
+#include <unordered_map>
 
+#include "chrono/physics/ChContactArena.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
@@ -46,6 +48,13 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     typedef ChContactNSCrolling<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSCrolling_6_6;
 
+    /// Multipliers stored in the persistent cache for one contact (torque part
+    /// used only by rolling contacts).
+    struct ChCachedMultipliers {
+        ChVector<> force;
+        ChVector<> torque;
+    };
+
   protected:
     std::list<ChContactNSC_6_6*> contactlist_6_6;
     std::list<ChContactNSC_6_3*> contactlist_6_3;
@@ -85,6 +94,44 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
 
+    // Arena allocators for the contact objects; consecutively created contacts are
+    // adjacent in memory and, once the simulation reaches steady state, no heap
+    // allocation happens in the contact creation hot path.
+    ChContactArena<ChContactNSC_6_6> arena_6_6;
+    ChContactArena<ChContactNSC_6_3> arena_6_3;
+    ChContactArena<ChContactNSC_3_3> arena_3_3;
+    ChContactArena<ChContactNSC_333_3> arena_333_3;
+    ChContactArena<ChContactNSC_333_6> arena_333_6;
+    ChContactArena<ChContactNSC_333_333> arena_333_333;
+    ChContactArena<ChContactNSC_666_3> arena_666_3;
+    ChContactArena<ChContactNSC_666_6> arena_666_6;
+    ChContactArena<ChContactNSC_666_333> arena_666_333;
+    ChContactArena<ChContactNSC_666_666> arena_666_666;
+    ChContactArena<ChContactNSCrolling_6_6> arena_6_6_rolling;
+
+    // Exponentially-decayed peaks of the per-type contact counts, carried
+    // across steps; BeginAddContact() keeps each arena sized ahead of its
+    // estimate so that a surge in contacts does not trigger chunk allocation
+    // in the middle of contact generation.
+    double est_6_6 = 0;
+    double est_6_3 = 0;
+    double est_3_3 = 0;
+    double est_333_3 = 0;
+    double est_333_6 = 0;
+    double est_333_333 = 0;
+    double est_666_3 = 0;
+    double est_666_6 = 0;
+    double est_666_333 = 0;
+    double est_666_666 = 0;
+    double est_6_6_rolling = 0;
+
+    bool use_multiplier_cache;  ///< enable the persistent contact-multiplier cache
+
+    /// Persistent cache of contact multipliers, keyed by the pair of contactable
+    /// objects and the ordinal of the contact within that pair; it survives the
+    /// per-step recycling of the contact lists.
+    std::unordered_map<uint64_t, ChCachedMultipliers> multiplier_cache;
+
   public:
     ChContactContainerNSC();
     ChContactContainerNSC(const ChContactContainerNSC& other);
@@ -99,6 +146,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
                n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
     }
 
+    /// Enable/disable the persistent contact-multiplier cache (default: false).
+    /// When enabled, the Lagrange multipliers of all contacts are harvested before the
+    /// contact lists are recycled and re-injected into the matching contacts of the next
+    /// step, so iterative solvers (e.g. APGD, BB) are warm started near the previous
+    /// solution even when the collision engine does not provide a persistent reaction
+    /// cache. Contacts are matched by the pair of contactable objects and by the ordinal
+    /// of the contact within that pair.
+    void EnableMultiplierCache(bool val) { use_multiplier_cache = val; }
+
+    /// Return true if the persistent contact-multiplier cache is enabled.
+    bool IsMultiplierCacheEnabled() const { return use_multiplier_cache; }
+
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
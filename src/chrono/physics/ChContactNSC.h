@@ -97,13 +97,7 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
             this->container->GetAddContactCallback()->OnAddContact(cinfo, &mat);
         }
 
-        Nx.SetFrictionCoefficient(mat.static_friction);
-        Nx.SetCohesion(mat.cohesion);
-
-        this->restitution = mat.restitution;
-        this->dampingf = mat.dampingf;
-        this->compliance = mat.compliance;
-        this->complianceT = mat.complianceT;
+        ApplyMaterial(mat);
 
         this->reactions_cache = cinfo.reaction_cache;
 
@@ -128,9 +122,31 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
 		}
     }
 
+    /// Apply the composite material properties (possibly modified by the user
+    /// contact callback) to the constraints of this contact. Derived contact
+    /// classes extend this to consume their additional material coefficients,
+    /// so the composite material is evaluated only once per Reset.
+    virtual void ApplyMaterial(const ChMaterialCompositeNSC& mat) {
+        Nx.SetFrictionCoefficient(mat.static_friction);
+        Nx.SetCohesion(mat.cohesion);
+
+        this->restitution = mat.restitution;
+        this->dampingf = mat.dampingf;
+        this->compliance = mat.compliance;
+        this->complianceT = mat.complianceT;
+    }
+
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector<> GetContactForce() const override { return react_force; }
 
+    /// Set the contact force (multipliers), in contact coordinate system.
+    /// Used by the container to warm start the solver from a persistent multiplier cache.
+    void SetContactForce(const ChVector<>& mf) { react_force = mf; }
+
+    /// Return true if this contact is backed by a persistent reaction cache
+    /// provided by the collision engine.
+    bool HasReactionsCache() const { return reactions_cache != nullptr; }
+
     /// Get the contact friction coefficient
     virtual double GetFriction() { return Nx.GetFrictionCoefficient(); }
 
@@ -71,7 +71,8 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
     virtual void Reset(Ta* mobjA,
                        Tb* mobjB,
                        const collision::ChCollisionInfo& cinfo) {
-        // Base method call:
+        // Base method call (evaluates the composite material once and applies
+        // it, including the rolling coefficients, through ApplyMaterial):
         ChContactNSC<Ta, Tb>::Reset(mobjA, mobjB, cinfo);
 
         Rx.Get_tuple_a().SetVariables(*this->objA);
@@ -81,18 +82,6 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
         Rv.Get_tuple_a().SetVariables(*this->objA);
         Rv.Get_tuple_b().SetVariables(*this->objB);
 
-        // Calculate composite material properties
-        ChMaterialCompositeNSC mat(
-            this->container->GetSystem()->composition_strategy.get(),
-            std::static_pointer_cast<ChMaterialSurfaceNSC>(this->objA->GetMaterialSurfaceBase()),
-            std::static_pointer_cast<ChMaterialSurfaceNSC>(this->objB->GetMaterialSurfaceBase()));
-
-        Rx.SetRollingFrictionCoefficient(mat.rolling_friction);
-        Rx.SetSpinningFrictionCoefficient(mat.spinning_friction);
-
-        this->complianceRoll = mat.complianceRoll;
-        this->complianceSpin = mat.complianceSpin;
-
         // COMPUTE JACOBIANS
 
         // delegate objA to compute its half of jacobian
@@ -106,9 +95,27 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
         this->react_torque = VNULL;
     }
 
+    /// Apply the composite material properties to the constraints of this
+    /// contact, including the rolling and spinning coefficients. Note that this
+    /// also makes any changes made by the user contact callback effective for
+    /// the rolling and spinning constraints.
+    virtual void ApplyMaterial(const ChMaterialCompositeNSC& mat) override {
+        ChContactNSC<Ta, Tb>::ApplyMaterial(mat);
+
+        Rx.SetRollingFrictionCoefficient(mat.rolling_friction);
+        Rx.SetSpinningFrictionCoefficient(mat.spinning_friction);
+
+        this->complianceRoll = mat.complianceRoll;
+        this->complianceSpin = mat.complianceSpin;
+    }
+
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector<> GetContactTorque() { return react_torque; };
 
+    /// Set the contact torque (rolling/spinning multipliers), in contact coordinate system.
+    /// Used by the container to warm start the solver from a persistent multiplier cache.
+    void SetContactTorque(const ChVector<>& mt) { react_torque = mt; }
+
     /// Get the contact rolling friction coefficient
     virtual float GetRollingFriction() { return Rx.GetRollingFrictionCoefficient(); };
     /// Set the contact rolling friction coefficient
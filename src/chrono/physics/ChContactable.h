@@ -124,7 +124,63 @@ class ChContactable_1vars : public ChContactable, public ChVariableTupleCarrier_
                                                       bool second){};
 };
 
-// Note that template T1 and T2 are the number of DOFs in the referenced ChVariable s, 
+/// Fill the three 1x6 contact jacobian rows of a 6-DOF rigid contactable,
+/// fully inlined and branch-free (the common rigid body vs rigid body case,
+/// which is a hotspot of NSC contact processing). The rows are the projections
+/// of the contact plane axes (X=normal, then U, V), and, in columns 3-5, their
+/// moments about the contact point. 'pos' and 'A' are the absolute position
+/// and rotation of the frame the contactable's variables refer to (the COG
+/// frame for a rigid body). Writes are direct element stores; the 'second'
+/// flag only flips signs through a factor, with no branches in the fill.
+inline void ComputeContactJacobian6dof(const ChVector<>& pos,
+                                       const ChMatrix33<>& A,
+                                       const ChVector<>& abs_point,
+                                       const ChMatrix33<>& contact_plane,
+                                       ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+                                       ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+                                       ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+                                       bool second) {
+    double sx = second ? 1.0 : -1.0;  // translational rows: -plane' for the first object, +plane' for the second
+    double sr = -sx;                  // rotational rows have the opposite convention
+
+    ChVector<> n = contact_plane.Get_A_Xaxis();
+    ChVector<> u = contact_plane.Get_A_Yaxis();
+    ChVector<> v = contact_plane.Get_A_Zaxis();
+
+    // Contact point in the local frame, and rotational rows
+    // d'*[A]*skew(p_loc) == cross([A]'*d, p_loc)' for each plane axis d
+    ChVector<> p_loc = A.MatrT_x_Vect(abs_point - pos);
+    ChVector<> rn = Vcross(A.MatrT_x_Vect(n), p_loc);
+    ChVector<> ru = Vcross(A.MatrT_x_Vect(u), p_loc);
+    ChVector<> rv = Vcross(A.MatrT_x_Vect(v), p_loc);
+
+    ChMatrix<double>* CqN = jacobian_tuple_N.Get_Cq();
+    ChMatrix<double>* CqU = jacobian_tuple_U.Get_Cq();
+    ChMatrix<double>* CqV = jacobian_tuple_V.Get_Cq();
+
+    CqN->SetElementN(0, sx * n.x());
+    CqN->SetElementN(1, sx * n.y());
+    CqN->SetElementN(2, sx * n.z());
+    CqN->SetElementN(3, sr * rn.x());
+    CqN->SetElementN(4, sr * rn.y());
+    CqN->SetElementN(5, sr * rn.z());
+
+    CqU->SetElementN(0, sx * u.x());
+    CqU->SetElementN(1, sx * u.y());
+    CqU->SetElementN(2, sx * u.z());
+    CqU->SetElementN(3, sr * ru.x());
+    CqU->SetElementN(4, sr * ru.y());
+    CqU->SetElementN(5, sr * ru.z());
+
+    CqV->SetElementN(0, sx * v.x());
+    CqV->SetElementN(1, sx * v.y());
+    CqV->SetElementN(2, sx * v.z());
+    CqV->SetElementN(3, sr * rv.x());
+    CqV->SetElementN(4, sr * rv.y());
+    CqV->SetElementN(5, sr * rv.z());
+}
+
+// Note that template T1 and T2 are the number of DOFs in the referenced ChVariable s,
 // for instance 3 and 3 for an 'edge' betweeen two xyz nodes.
 
 template <int T1, int T2>
@@ -58,6 +58,10 @@ ChLinkMateGeneric::ChLinkMateGeneric(bool mc_x, bool mc_y, bool mc_z, bool mc_rx
 
     C = 0;
 
+    cache_jacobians = false;
+    cache_threshold = 1e-9;
+    cache_valid = false;
+
     mask = new ChLinkMask();
 
     SetupLinkMask();
@@ -71,6 +75,10 @@ ChLinkMateGeneric::ChLinkMateGeneric(const ChLinkMateGeneric& other) : ChLinkMat
     c_ry = other.c_ry;
     c_rz = other.c_rz;
 
+    cache_jacobians = other.cache_jacobians;
+    cache_threshold = other.cache_threshold;
+    cache_valid = false;
+
     SetupLinkMask();
 }
 
@@ -116,6 +124,8 @@ void ChLinkMateGeneric::SetupLinkMask() {
         delete C;
     C = new ChMatrixDynamic<>(nc, 1);
 
+    cache_valid = false;
+
     ChangedLinkMask();
 }
 
@@ -153,6 +163,23 @@ void ChLinkMateGeneric::Update(double mytime, bool update_assets) {
     if (this->Body1 && this->Body2) {
         this->mask->SetTwoBodiesVariables(&Body1->Variables(), &Body2->Variables());
 
+        // If jacobian caching is enabled and both bodies moved less than the threshold since
+        // the last full update, the jacobians (and residual) stored in the constraints are
+        // still valid: skip the recomputation. This is the common case for locked mates in
+        // large CAD-derived assemblies, where most of the model never moves.
+        if (cache_jacobians) {
+            if (cache_valid &&
+                (Body1->GetCoord().pos - cache_csys1.pos).Length() < cache_threshold &&
+                (Body2->GetCoord().pos - cache_csys2.pos).Length() < cache_threshold &&
+                (Body1->GetCoord().rot - cache_csys1.rot).Length() < cache_threshold &&
+                (Body2->GetCoord().rot - cache_csys2.rot).Length() < cache_threshold) {
+                return;
+            }
+            cache_csys1 = Body1->GetCoord();
+            cache_csys2 = Body2->GetCoord();
+            cache_valid = true;
+        }
+
         ChFrame<> aframe = this->frame1 >> (*this->Body1);
         ChVector<> p1_abs = aframe.GetPos();
         ChFrame<> aframe2 = this->frame2 >> (*this->Body2);
@@ -277,6 +304,8 @@ void ChLinkMateGeneric::Initialize(std::shared_ptr<ChBodyFrame> mbody1,
         static_cast<ChFrame<>*>(this->Body1)->TransformParentToLocal(mpos1, this->frame1);
         static_cast<ChFrame<>*>(this->Body2)->TransformParentToLocal(mpos2, this->frame2);
     }
+
+    cache_valid = false;
 }
 
  
@@ -339,6 +368,8 @@ void ChLinkMateGeneric::Initialize(std::shared_ptr<ChBodyFrame> mbody1,
 
     this->frame1 = mfr1;
     this->frame2 = mfr2;
+
+    cache_valid = false;
 }
 
 //// STATE BOOKKEEPING FUNCTIONS
@@ -641,7 +672,7 @@ ChLinkMatePlane::ChLinkMatePlane(const ChLinkMatePlane& other) : ChLinkMateGener
 
 void ChLinkMatePlane::SetFlipped(bool doflip) {
     if (doflip != this->flipped) {
-        // swaps direction of X axis by flipping 180� the frame A (slave)
+        // swaps direction of X axis by flipping 180� the frame A (slave)
 
         ChFrame<> frameRotator(VNULL, Q_from_AngAxis(CH_C_PI, VECT_Y));
         this->frame1.ConcatenatePostTransformation(frameRotator);
@@ -714,7 +745,7 @@ ChLinkMateCoaxial::ChLinkMateCoaxial(const ChLinkMateCoaxial& other) : ChLinkMat
 
 void ChLinkMateCoaxial::SetFlipped(bool doflip) {
     if (doflip != this->flipped) {
-        // swaps direction of X axis by flipping 180� the frame A (slave)
+        // swaps direction of X axis by flipping 180� the frame A (slave)
 
         ChFrame<> frameRotator(VNULL, Q_from_AngAxis(CH_C_PI, VECT_Y));
         this->frame1.ConcatenatePostTransformation(frameRotator);
@@ -840,7 +871,7 @@ ChLinkMateParallel::ChLinkMateParallel(const ChLinkMateParallel& other) : ChLink
 
 void ChLinkMateParallel::SetFlipped(bool doflip) {
     if (doflip != this->flipped) {
-        // swaps direction of X axis by flipping 180� the frame A (slave)
+        // swaps direction of X axis by flipping 180� the frame A (slave)
 
         ChFrame<> frameRotator(VNULL, Q_from_AngAxis(CH_C_PI, VECT_Y));
         this->frame1.ConcatenatePostTransformation(frameRotator);
@@ -78,6 +78,12 @@ class ChApi ChLinkMateGeneric : public ChLinkMate {
 
     ChMatrix<>* C;  ///< residuals
 
+    bool cache_jacobians;      ///< skip jacobian recomputation when the bodies did not move?
+    double cache_threshold;    ///< body motion (position/quaternion norm) triggering a refresh
+    bool cache_valid;          ///< are the cached jacobians usable?
+    ChCoordsys<> cache_csys1;  ///< Body1 coordinates at the last full update
+    ChCoordsys<> cache_csys2;  ///< Body2 coordinates at the last full update
+
   public:
     ChLinkMateGeneric(bool mc_x = true,
                       bool mc_y = true,
@@ -119,6 +125,21 @@ class ChApi ChLinkMateGeneric : public ChLinkMate {
     /// Sets which movements (of frame 1 respect to frame 2) are constrained
     void SetConstrainedCoords(bool mc_x, bool mc_y, bool mc_z, bool mc_rx, bool mc_ry, bool mc_rz);
 
+    /// Enable/disable caching of the constraint jacobians (default: disabled).
+    /// When enabled, Update() skips the jacobian and residual recomputation whenever both
+    /// bodies moved less than the given threshold (in position and quaternion norm) since the
+    /// last full update. CAD-derived assemblies with thousands of mates are mostly static,
+    /// so this removes the bulk of the link update cost. Use InvalidateJacobianCache() to
+    /// force a refresh at the next update (e.g. after a solver failure).
+    void SetJacobianCaching(bool enable, double threshold = 1e-9) {
+        cache_jacobians = enable;
+        cache_threshold = threshold;
+        cache_valid = false;
+    }
+
+    /// Force a full jacobian recomputation at the next call to Update().
+    void InvalidateJacobianCache() { cache_valid = false; }
+
     /// Specialized initialization for generic mate, given the two bodies to be connected, the
     /// positions of the two frames to connect on the bodies (each expressed
     /// in body or abs. coordinates).
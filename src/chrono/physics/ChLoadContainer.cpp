@@ -12,7 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 
@@ -33,6 +35,22 @@ void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
 }
 
 void ChLoadContainer::Update(double mytime, bool update_assets) {
+#ifdef _OPENMP
+    int nthreads = GetSystem() ? GetSystem()->GetParallelThreadNumber() : 1;
+    if (nthreads > 1 && (int)loadlist.size() >= 64) {
+        // Each load evaluates its own loader(s) and writes only its own Q
+        // vector and jacobian blocks, reading the (shared) node states, so the
+        // list can be updated in parallel. For stiff loads Update() includes
+        // the numerical differentiation of the jacobian (2*ndof evaluations of
+        // Q per load), which is what makes the load update of large
+        // distributed load sets as expensive as the element internal forces;
+        // dynamic scheduling balances a mix of stiff and non-stiff loads.
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 4)
+        for (int i = 0; i < (int)loadlist.size(); ++i) {
+            loadlist[i]->Update(mytime);
+        }
+    } else
+#endif
     for (size_t i = 0; i < loadlist.size(); ++i) {
         loadlist[i]->Update(mytime);
     }
@@ -44,6 +62,35 @@ void ChLoadContainer::IntLoadResidual_F(const unsigned int off,  // offset in R
                                         ChVectorDynamic<>& R,    // result: the R residual, R += c*F
                                         const double c           // a scaling factor
                                         ) {
+#ifdef _OPENMP
+    int nthreads = GetSystem() ? GetSystem()->GetParallelThreadNumber() : 1;
+    if (nthreads > 1 && (int)loadlist.size() >= 64) {
+        // Neighbouring loads share nodes, so their scatters cannot write R
+        // concurrently; accumulate into one buffer per thread (each zeroed by
+        // its own thread, so the pages stay local to it) and sum the buffers
+        // into R afterwards. Worthwhile only for large load sets: the
+        // reduction sweeps the whole residual once per thread.
+        if ((int)scatter_buf.size() < nthreads)
+            scatter_buf.resize(nthreads);
+#pragma omp parallel num_threads(nthreads)
+        {
+            int tid = omp_get_thread_num();
+            scatter_buf[tid].Reset(R.GetRows());
+#pragma omp for schedule(dynamic, 16)
+            for (int i = 0; i < (int)loadlist.size(); ++i) {
+                loadlist[i]->LoadIntLoadResidual_F(scatter_buf[tid], c);
+            }
+#pragma omp for schedule(static)
+            for (int row = 0; row < R.GetRows(); ++row) {
+                double sum = 0;
+                for (int it = 0; it < nthreads; ++it)
+                    sum += scatter_buf[it](row);
+                R(row) += sum;
+            }
+        }
+        return;
+    }
+#endif
     for (size_t i = 0; i < loadlist.size(); ++i) {
         loadlist[i]->LoadIntLoadResidual_F(R, c);
     }
@@ -56,6 +103,17 @@ void ChLoadContainer::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 }
 
 void ChLoadContainer::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+#ifdef _OPENMP
+    int nthreads = GetSystem() ? GetSystem()->GetParallelThreadNumber() : 1;
+    if (nthreads > 1 && (int)loadlist.size() >= 64) {
+        // Each stiff load combines its own K,R,M into its own KRM block.
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (int i = 0; i < (int)loadlist.size(); ++i) {
+            loadlist[i]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        }
+        return;
+    }
+#endif
     for (size_t i = 0; i < loadlist.size(); ++i) {
         loadlist[i]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
     }
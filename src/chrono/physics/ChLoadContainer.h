@@ -29,6 +29,10 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
   private:
     std::vector<std::shared_ptr<ChLoadBase> > loadlist;
 
+    /// Per-thread accumulation buffers of the parallel residual scatter
+    /// (see IntLoadResidual_F); kept across steps to avoid reallocation.
+    std::vector<ChVectorDynamic<> > scatter_buf;
+
   public:
     ChLoadContainer() {}
     ChLoadContainer(const ChLoadContainer& other);
@@ -145,26 +145,8 @@ void ChAparticle::ComputeJacobianForContactPart(
     ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
     ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
     bool second) {
-    ChVector<> m_p1_loc = this->TransformPointParentToLocal(abs_point);
-    ChMatrix33<> Jx1, Jr1;
-    ChMatrix33<> Ps1, Jtemp;
-    Ps1.Set_X_matrix(m_p1_loc);
-
-    Jx1.CopyFromMatrixT(contact_plane);
-    if (!second)
-        Jx1.MatrNeg();
-
-    Jtemp.MatrMultiply(this->GetA(), Ps1);
-    Jr1.MatrTMultiply(contact_plane, Jtemp);
-    if (second)
-        Jr1.MatrNeg();
-
-    jacobian_tuple_N.Get_Cq()->PasteClippedMatrix(Jx1, 0, 0, 1, 3, 0, 0);
-    jacobian_tuple_U.Get_Cq()->PasteClippedMatrix(Jx1, 1, 0, 1, 3, 0, 0);
-    jacobian_tuple_V.Get_Cq()->PasteClippedMatrix(Jx1, 2, 0, 1, 3, 0, 0);
-    jacobian_tuple_N.Get_Cq()->PasteClippedMatrix(Jr1, 0, 0, 1, 3, 0, 3);
-    jacobian_tuple_U.Get_Cq()->PasteClippedMatrix(Jr1, 1, 0, 1, 3, 0, 3);
-    jacobian_tuple_V.Get_Cq()->PasteClippedMatrix(Jr1, 2, 0, 1, 3, 0, 3);
+    ComputeContactJacobian6dof(this->GetPos(), this->GetA(), abs_point, contact_plane, jacobian_tuple_N,
+                               jacobian_tuple_U, jacobian_tuple_V, second);
 }
 
 void ChAparticle::ComputeJacobianForRollingContactPart(
@@ -287,15 +269,23 @@ void ChParticlesClones::ResizeNparticles(int newsize) {
     bool oldcoll = GetCollide();
     SetCollide(false);  // this will remove old particle coll.models from coll.engine, if previously added
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    // Delete only the particles that were heap-allocated by AddParticle; the
+    // leading ones live in (and are owned by) the arena.
+    for (unsigned int j = (unsigned int)particle_arena.size(); j < particles.size(); j++) {
         delete (particles[j]);
         particles[j] = 0;
     }
+    particles.clear();
+
+    // Bulk creation uses one contiguous arena, so that particle state
+    // (coordinates and per-particle variables) is laid out in address order.
+    particle_arena.clear();
+    particle_arena.resize(newsize);
 
     particles.resize(newsize);
 
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j] = new ChAparticle;
+        particles[j] = &particle_arena[j];
 
         particles[j]->SetContainer(this);
 
@@ -171,6 +171,13 @@ class ChApi ChParticlesClones : public ChIndexedParticles {
   private:
     std::vector<ChAparticle*> particles;  ///< the parricles
 
+    /// Contiguous storage for the particles created in bulk by ResizeNparticles.
+    /// Keeping the clones in one arena (instead of one heap allocation each) lets
+    /// the per-particle integrator and solver loops stream through memory in
+    /// address order. Particles appended later by AddParticle are heap-allocated
+    /// and always follow the arena ones in the 'particles' list.
+    std::vector<ChAparticle> particle_arena;
+
     ChSharedMassBody particle_mass;  ///< shared mass of particles
 
     collision::ChCollisionModel* particle_collision_model;  ///< sample collision model
@@ -55,6 +55,13 @@ ChSystem::ChSystem()
       min_bounce_speed(0.15),
       max_penetration_recovery_speed(0.6),
       use_sleeping(false),
+      update_assets_enabled(true),
+      spatial_sort_interval(0),
+      pipelined_collision(false),
+      pipelined_collision_tol(0),
+      collision_pipeline_valid(false),
+      state_history_depth(0),
+      health_metrics_enabled(false),
       G_acc(ChVector<>(0, -9.8, 0)),
       stepcount(0),
       solvecount(0),
@@ -65,6 +72,9 @@ ChSystem::ChSystem()
     // Required by ChAssembly
     system = this;
 
+    edit_queue_head = nullptr;
+    health_count = 0;
+
     // Set default number of threads to be equal to number of available cores
     parallel_thread_number = CHOMPfunctions::GetNumProcs();
 
@@ -80,6 +90,8 @@ ChSystem::ChSystem(const ChSystem& other) : ChAssembly(other) {
     // Required by ChAssembly
     system = this;
 
+    edit_queue_head = nullptr;
+
     G_acc = other.G_acc;
     end_time = other.end_time;
     step = other.step;
@@ -101,6 +113,15 @@ ChSystem::ChSystem(const ChSystem& other) : ChAssembly(other) {
     SetSolverType(GetSolverType());
     parallel_thread_number = other.parallel_thread_number;
     use_sleeping = other.use_sleeping;
+    update_assets_enabled = other.update_assets_enabled;
+    spatial_sort_interval = other.spatial_sort_interval;
+    pipelined_collision = other.pipelined_collision;
+    pipelined_collision_tol = other.pipelined_collision_tol;
+    collision_pipeline_valid = false;
+    state_history_depth = other.state_history_depth;
+    health_metrics_enabled = other.health_metrics_enabled;
+    health_ring.resize(other.health_ring.size());
+    health_count = 0;
 
     ncontacts = other.ncontacts;
 
@@ -113,6 +134,17 @@ ChSystem::ChSystem(const ChSystem& other) : ChAssembly(other) {
 }
 
 ChSystem::~ChSystem() {
+    // Wait for any speculative collision run before tearing down the collision system.
+    WaitPipelinedCollision();
+
+    // Discard scene edits still pending in the queue.
+    SceneEdit* node = edit_queue_head.exchange(nullptr);
+    while (node) {
+        SceneEdit* next = node->next;
+        delete node;
+        node = next;
+    }
+
     // Before proceeding, anticipate Clear(). This would be called also by base ChAssembly destructor, anyway, but
     // it would happen after this destructor, so the ith_body->SetSystem(0) in Clear() would not be able to remove
     // body's collision
@@ -395,6 +427,55 @@ void ChSystem::RemoveAllControls() {
     controlslist.clear();
 }
 
+void ChSystem::EnqueueAdd(std::shared_ptr<ChPhysicsItem> item) {
+    SceneEdit* node = new SceneEdit{SceneEdit::OP_ADD, item, nullptr};
+    node->next = edit_queue_head.load(std::memory_order_relaxed);
+    while (!edit_queue_head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+    }
+}
+
+void ChSystem::EnqueueRemove(std::shared_ptr<ChPhysicsItem> item) {
+    SceneEdit* node = new SceneEdit{SceneEdit::OP_REMOVE, item, nullptr};
+    node->next = edit_queue_head.load(std::memory_order_relaxed);
+    while (!edit_queue_head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+    }
+}
+
+void ChSystem::ProcessEnqueuedEdits() {
+    // Detach the whole pending stack in one atomic exchange; producers can keep
+    // enqueuing (their edits will be applied at the next call).
+    SceneEdit* node = edit_queue_head.exchange(nullptr, std::memory_order_acquire);
+    if (!node)
+        return;
+
+    // A speculative collision run may still be in flight and must not observe the
+    // collision world changing underneath it; also, its results would refer to the
+    // old population, so they are discarded.
+    WaitPipelinedCollision();
+    collision_pipeline_valid = false;
+
+    // The stack is LIFO: reverse it so edits are applied in enqueue order.
+    SceneEdit* prev = nullptr;
+    while (node) {
+        SceneEdit* next = node->next;
+        node->next = prev;
+        prev = node;
+        node = next;
+    }
+
+    for (node = prev; node;) {
+        if (node->op == SceneEdit::OP_ADD)
+            Add(node->item);
+        else
+            Remove(node->item);
+        SceneEdit* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
 void ChSystem::Reference_LM_byID() {
     std::vector<std::shared_ptr<ChLink> > toremove;
 
@@ -619,6 +700,8 @@ bool ChSystem::ManageSleepingBodies() {
 // -----------------------------------------------------------------------------
 
 void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& mdescriptor) {
+    CH_PROFILE( "DescriptorPrepareInject");
+
     mdescriptor.BeginInsertion();  // This resets the vectors of constr. and var. pointers.
 
     InjectConstraints(mdescriptor);
@@ -626,6 +709,10 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& mdescriptor) {
     InjectKRMmatrices(mdescriptor);
 
     mdescriptor.EndInsertion();
+
+    // Stamp the descriptor with the current topology revision, so that solvers caching
+    // structure-dependent data (e.g. a locked sparsity pattern) can detect staleness.
+    mdescriptor.SetStructureRevision(GetTopologyRevision());
 }
 
 // -----------------------------------------------------------------------------
@@ -713,11 +800,14 @@ void ChSystem::Update(bool update_assets) {
     // Executes the "forUpdate" in all controls of controlslist
     ExecuteControlsForUpdate();
 
+    // When the system runs headless, prune all visualization asset updates
+    bool do_assets = update_assets && update_assets_enabled;
+
     // Inherit parent class (recursively update sub objects bodies, links, etc)
-    ChAssembly::Update(update_assets);
+    ChAssembly::Update(do_assets);
 
     // Update all contacts, if any
-    contact_container->Update(ChTime, update_assets);
+    contact_container->Update(ChTime, do_assets);
 
     timer_update.stop();
 }
@@ -1104,6 +1194,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
     // fill the sparse system structures with information in G and Cq.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        CH_PROFILE( "LoadJacobians");
         timer_jacobian.start();
 
         // Cq  matrix
@@ -1140,6 +1231,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_PROFILE( "SolverSetup");
         timer_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_setup.stop();
@@ -1150,9 +1242,12 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_solver.start();
-    GetSolver()->Solve(*descriptor);
-    timer_solver.stop();
+    {
+        CH_PROFILE( "SolverSolve");
+        timer_solver.start();
+        GetSolver()->Solve(*descriptor);
+        timer_solver.stop();
+    }
     
 
     // Dv and L vectors  <-- sparse solver structures
@@ -1243,6 +1338,46 @@ void ChSystem::SynchronizeLastCollPositions() {
     }
 }
 
+void ChSystem::SetPipelinedCollision(bool val) {
+    if (!val)
+        WaitPipelinedCollision();
+    pipelined_collision = val;
+    collision_pipeline_valid = false;
+}
+
+void ChSystem::WaitPipelinedCollision() {
+    if (collision_pipeline_thread.joinable())
+        collision_pipeline_thread.join();
+}
+
+void ChSystem::StartPipelinedCollision() {
+    // Predict the end-of-step pose of each body by constant-velocity extrapolation
+    // and temporarily move the bodies there, to stamp the predicted poses into the
+    // collision engine; then restore the true coordinates before the solve starts.
+    collision_pipeline_pred.resize(bodylist.size());
+    std::vector<ChCoordsys<> > saved(bodylist.size());
+    for (size_t ip = 0; ip < bodylist.size(); ++ip) {
+        std::shared_ptr<ChBody>& body = bodylist[ip];
+        saved[ip] = body->GetCoord();
+        ChCoordsys<> pred = saved[ip];
+        pred.pos += body->GetPos_dt() * step;
+        pred.rot = saved[ip].rot + body->GetRot_dt() * step;
+        pred.rot.Normalize();
+        collision_pipeline_pred[ip] = pred;
+        body->SetCoord(pred);
+    }
+
+    SyncCollisionModels();
+
+    for (size_t ip = 0; ip < bodylist.size(); ++ip)
+        bodylist[ip]->SetCoord(saved[ip]);
+
+    // Broadphase and narrowphase only touch the collision engine side (the poses
+    // stamped above), so they can overlap with the solver updating the body states.
+    collision_pipeline_thread = std::thread([this]() { collision_system->Run(); });
+    collision_pipeline_valid = true;
+}
+
 double ChSystem::ComputeCollisions() {
     CH_PROFILE( "ComputeCollisions");
 
@@ -1250,11 +1385,48 @@ double ChSystem::ComputeCollisions() {
 
     timer_collision.start();
 
-    // Update all positions of collision models: delegate this to the ChAssembly
-    SyncCollisionModels();
+    // If a speculative collision run for this step was launched during the
+    // previous step, join it and validate the pose prediction.
+    bool need_run = true;
+    if (pipelined_collision && collision_pipeline_valid) {
+        WaitPipelinedCollision();
+        collision_pipeline_valid = false;
+
+        if (collision_pipeline_pred.size() == bodylist.size()) {
+            double drift_tol = (pipelined_collision_tol > 0)
+                                   ? pipelined_collision_tol
+                                   : 0.5 * collision::ChCollisionModel::GetDefaultSuggestedEnvelope();
+            bool within = true;
+            for (size_t ip = 0; ip < bodylist.size() && within; ++ip) {
+                std::shared_ptr<ChBody>& body = bodylist[ip];
+                if (!body->GetCollide())
+                    continue;
+                // bound the drift of any shape point: translation plus rotation
+                // times the shape bounding radius
+                double err = (body->GetPos() - collision_pipeline_pred[ip].pos).Length();
+                double qdot = fabs(body->GetRot().Dot(collision_pipeline_pred[ip].rot));
+                double angle = 2.0 * acos(ChMin(1.0, qdot));
+                if (angle > 1e-20) {
+                    ChVector<> bbmin, bbmax;
+                    body->GetCollisionModel()->GetAABB(bbmin, bbmax);
+                    err += angle * 0.5 * (bbmax - bbmin).Length();
+                }
+                if (err > drift_tol)
+                    within = false;
+            }
+            // Accept the speculative results: contact points are at most drift_tol
+            // away from where a synchronous run would put them, within the envelope.
+            need_run = !within;
+        }
+    }
+
+    if (need_run) {
+        // Update all positions of collision models: delegate this to the ChAssembly
+        SyncCollisionModels();
 
-    // Perform the collision detection ( broadphase and narrowphase )
-    collision_system->Run();
+        // Perform the collision detection ( broadphase and narrowphase )
+        collision_system->Run();
+    }
 
     // Report and store contacts and/or proximities, if there are some
     // containers in the physic system. The default contact container
@@ -1402,6 +1574,230 @@ int ChSystem::DoStepDynamics(double m_step) {
 //  PERFORM INTEGRATION STEP  using pluggable timestepper
 // -----------------------------------------------------------------------------
 
+void ChSystem::SetStateHistoryDepth(int depth) {
+    state_history_depth = std::max(depth, 0);
+    while ((int)state_history.size() > state_history_depth)
+        state_history.pop_front();
+}
+
+void ChSystem::PushStateHistory() {
+    StateHistorySample sample;
+    sample.t = 0;
+    sample.x.Reset(GetNcoords_x(), this);
+    sample.v.Reset(GetNcoords_v(), this);
+    StateGather(sample.x, sample.v, sample.t);
+
+    // A structural change between steps makes the earlier samples incompatible.
+    if (!state_history.empty() && state_history.back().x.GetRows() != sample.x.GetRows())
+        state_history.clear();
+
+    state_history.push_back(sample);
+    while ((int)state_history.size() > state_history_depth)
+        state_history.pop_front();
+}
+
+bool ChSystem::SampleStateHistory(double time, ChState& x, ChStateDelta& v) {
+    if (state_history.empty() || time < state_history.front().t || time > state_history.back().t)
+        return false;
+
+    // Find the first retained sample at or after the requested time, scanning
+    // from the most recent one (queries are typically near the end).
+    size_t i1 = state_history.size() - 1;
+    while (i1 > 0 && state_history[i1 - 1].t >= time)
+        i1--;
+
+    const StateHistorySample& s1 = state_history[i1];
+    if (i1 == 0 || s1.t == time) {
+        x = s1.x;
+        v = s1.v;
+        return true;
+    }
+    const StateHistorySample& s0 = state_history[i1 - 1];
+    double h = s1.t - s0.t;
+    double s = (time - s0.t) / h;
+
+    int n_x = s0.x.GetRows();
+    int n_v = s0.v.GetRows();
+
+    // End-point tangents dx/dt in coordinate space, obtained by pushing the
+    // recorded velocities through the state increment, so the quaternion
+    // coordinates get their tangent from the exponential map.
+    const double eps = 1e-7;
+    ChState x_pert(n_x, this);
+    StateIncrementX(x_pert, s0.x, s0.v * eps);
+    ChState xdot0 = (x_pert - s0.x) * (1.0 / eps);
+    StateIncrementX(x_pert, s1.x, s1.v * eps);
+    ChState xdot1 = (x_pert - s1.x) * (1.0 / eps);
+
+    // Cubic Hermite basis
+    double s2 = s * s;
+    double s3 = s2 * s;
+    double h00 = 2 * s3 - 3 * s2 + 1;
+    double h10 = s3 - 2 * s2 + s;
+    double h01 = -2 * s3 + 3 * s2;
+    double h11 = s3 - s2;
+
+    x.Reset(n_x, this);
+    for (int i = 0; i < n_x; i++) {
+        x.ElementN(i) = h00 * s0.x.GetElementN(i) + h10 * h * xdot0.GetElementN(i) + h01 * s1.x.GetElementN(i) +
+                        h11 * h * xdot1.GetElementN(i);
+    }
+
+    v.Reset(n_v, this);
+    for (int i = 0; i < n_v; i++) {
+        v.ElementN(i) = (1 - s) * s0.v.GetElementN(i) + s * s1.v.GetElementN(i);
+    }
+
+    return true;
+}
+
+void ChSystem::SaveStateSnapshot(int slot) {
+    Setup();
+
+    StateSnapshot& snap = state_snapshots[slot];
+    snap.x.Reset(GetNcoords_x(), this);
+    snap.v.Reset(GetNcoords_v(), this);
+    snap.a.Reset(GetNcoords_v(), this);
+    snap.L.Reset(GetNconstr());
+
+    StateGather(snap.x, snap.v, snap.t);
+    StateGatherAcceleration(snap.a);
+    StateGatherReactions(snap.L);
+}
+
+bool ChSystem::RestoreStateSnapshot(int slot) {
+    auto it = state_snapshots.find(slot);
+    if (it == state_snapshots.end())
+        return false;
+    StateSnapshot& snap = it->second;
+
+    Setup();
+    if (snap.x.GetRows() != GetNcoords_x() || snap.v.GetRows() != GetNcoords_v())
+        return false;
+
+    // A speculative collision run, if in flight, predicts from the poses being
+    // abandoned: join it and discard its result.
+    if (pipelined_collision) {
+        WaitPipelinedCollision();
+        collision_pipeline_valid = false;
+    }
+
+    StateScatter(snap.x, snap.v, snap.t);
+    StateScatterAcceleration(snap.a);
+
+    // The collision system and the contact container still describe the
+    // abandoned poses; rebuild the contact set at the restored ones.
+    ComputeCollisions();
+    Setup();
+    Update(false);
+
+    // The contact set was rebuilt at the same poses the snapshot was taken at,
+    // so normally the constraint count matches and the saved multipliers warm
+    // start the solver; if it does not (e.g. collision parameters changed in
+    // between), skip them - the kinematic state is restored regardless.
+    if (snap.L.GetRows() == GetNconstr())
+        StateScatterReactions(snap.L);
+
+    return true;
+}
+
+void ChSystem::ClearStateSnapshots() {
+    state_snapshots.clear();
+}
+
+namespace {
+
+/// Deepest-contact scan of the health metrics channel.
+class ChHealthContactReporter : public ChContactContainer::ReportContactCallback {
+  public:
+    double min_distance;
+
+    ChHealthContactReporter() : min_distance(0) {}
+
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        if (distance < min_distance)
+            min_distance = distance;
+        return true;
+    }
+};
+
+}  // end anonymous namespace
+
+void ChSystem::SetHealthMetrics(bool enable, int depth) {
+    health_metrics_enabled = enable;
+    health_ring.clear();
+    // Minimum depth 2: the reader validates its copy by re-checking the
+    // counter, which requires at least one slot the writer is not about to
+    // enter (see GetLastHealthMetrics).
+    health_ring.resize(std::max(depth, 2));
+    health_count = 0;
+}
+
+bool ChSystem::GetLastHealthMetrics(HealthMetricsSample& sample) const {
+    size_t depth = health_ring.size();
+    uint64_t count = health_count.load(std::memory_order_acquire);
+    while (count > 0) {
+        sample = health_ring[(count - 1) % depth];
+        // Re-check the counter: the writer fills a slot before publishing it,
+        // so at counter value count + depth - 1 it may already be overwriting
+        // the slot just copied. Accept only if the writer cannot have reached
+        // it - otherwise retry on the newer sample. (With any reasonable depth
+        // this never loops.)
+        uint64_t count2 = health_count.load(std::memory_order_acquire);
+        if (count2 < count + depth - 1)
+            return true;
+        count = count2;
+    }
+    return false;
+}
+
+void ChSystem::ComputeHealthMetrics() {
+    HealthMetricsSample sample;
+    sample.t = ChTime;
+
+    // Deepest penetration over the current contact set.
+    ChHealthContactReporter reporter;
+    contact_container->ReportAllContacts(&reporter);
+    sample.max_penetration = ChMax(0.0, -reporter.min_distance);
+
+    // Residuals of the constraints as left by the solve of this step.
+    descriptor->ComputeFeasabilityViolation(sample.constraint_violation, sample.complementarity);
+
+    // Last recorded solver violation, if the iterative solver logs them
+    // (see ChIterativeSolver::SetRecordViolation).
+    sample.solver_residual = 0;
+    if (auto iter_solver = std::dynamic_pointer_cast<ChIterativeSolver>(solver_speed)) {
+        if (!iter_solver->GetViolationHistory().empty())
+            sample.solver_residual = iter_solver->GetViolationHistory().back();
+    }
+
+    // Kinetic energy of the rigid bodies. A sudden jump, like growing
+    // penetration or violation, is the cheap early symptom of divergence.
+    double ekin = 0;
+    for (size_t ip = 0; ip < bodylist.size(); ++ip) {
+        ChBody* body = bodylist[ip].get();
+        if (!body->GetBodyFixed() && !body->GetSleeping()) {
+            ekin += 0.5 * body->GetMass() * body->GetPos_dt().Length2();
+            ChVector<> wloc = body->GetWvel_loc();
+            ekin += 0.5 * Vdot(wloc, body->GetInertia().Matr_x_Vect(wloc));
+        }
+    }
+    sample.kinetic_energy = ekin;
+
+    // Single writer: fill the slot, then publish it by advancing the counter.
+    uint64_t count = health_count.load(std::memory_order_relaxed);
+    health_ring[count % health_ring.size()] = sample;
+    health_count.store(count + 1, std::memory_order_release);
+}
+
 bool ChSystem::Integrate_Y() {
     CH_PROFILE("Integrate_Y");
 
@@ -1416,6 +1812,16 @@ bool ChSystem::Integrate_Y() {
     solvecount = 0;
     setupcount = 0;
 
+    // Apply scene edits enqueued from other threads (see EnqueueAdd/EnqueueRemove),
+    // in one batch, before collision detection and Setup() see the new population.
+    ProcessEnqueuedEdits();
+
+    // Periodically reorder bodies along a space-filling curve, if requested.
+    // Done before collision detection and Setup(), so the new numbering is in
+    // place before contact constraints and offsets are generated for this step.
+    if (spatial_sort_interval > 0 && (stepcount % spatial_sort_interval) == 0)
+        SortBodiesSpatially();
+
     // Compute contacts and create contact constraints
     ComputeCollisions();
 
@@ -1441,6 +1847,13 @@ bool ChSystem::Integrate_Y() {
         std::dynamic_pointer_cast<ChTimestepperNewmark>(timestepper))
         timestepper->SetQcDoClamp(false);
 
+    // Speculatively start the collision detection for the next step, overlapped
+    // with the solver below. Predicted end-of-step poses are stamped into the
+    // collision engine now; the results are validated (and re-run if the
+    // prediction drifted too far) at the next ComputeCollisions().
+    if (pipelined_collision)
+        StartPipelinedCollision();
+
     // PERFORM TIME STEP HERE!
     {
         CH_PROFILE( "Advance");
@@ -1459,6 +1872,14 @@ bool ChSystem::Integrate_Y() {
     // Call method to gather contact forces/torques in rigid bodies
     contact_container->ComputeContactForces();
 
+    // Retain the end-of-step state for interpolated sampling, if requested.
+    if (state_history_depth > 0)
+        PushStateHistory();
+
+    // Publish the health sample of this step, if the channel is enabled.
+    if (health_metrics_enabled)
+        ComputeHealthMetrics();
+
     // Time elapsed for step..
     timer_step.stop();
 
@@ -15,13 +15,17 @@
 #ifndef CHSYSTEM_H
 #define CHSYSTEM_H
 
+#include <atomic>
 #include <cfloat>
+#include <deque>
 #include <memory>
 #include <cstdlib>
 #include <cmath>
 #include <cstring>
 #include <iostream>
 #include <list>
+#include <thread>
+#include <unordered_map>
 
 #include "chrono/collision/ChCCollisionSystem.h"
 #include "chrono/core/ChLog.h"
@@ -607,6 +611,13 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// client ChSystem object).
     std::shared_ptr<collision::ChCollisionSystem> GetCollisionSystem() const { return collision_system; }
 
+    /// Get the generation counter of the collision shapes currently registered with the
+    /// collision engine. The collision-shape entry of the topology change journal: bumped
+    /// whenever a collision model is added to or removed from the engine, which can also
+    /// happen without an item insertion/removal (e.g. ChBody::SetCollide), so it moves
+    /// independently of the per-category counters of GetTopologyRevision().
+    unsigned int GetCollisionShapeRevision() const { return collision_system->GetShapeRevision(); }
+
     /// Turn on this feature to let the system put to sleep the bodies whose
     /// motion has almost come to a rest. This feature will allow faster simulation
     /// of large scenarios for real-time purposes, but it will affect the precision!
@@ -616,7 +627,154 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Enable/disable the update of visualization assets during system updates.
+    /// Disable this in 'headless' batch simulations with no visualization attached:
+    /// every update (hence every stage of the integrator) traverses the asset trees
+    /// of all physics items, which is pure overhead if nothing renders them.
+    void SetUpdateAssets(bool val) { update_assets_enabled = val; }
+
+    /// Tell if visualization assets are updated during system updates.
+    bool GetUpdateAssets() const { return update_assets_enabled; }
+
+    /// Reorder bodies spatially (see ChAssembly::SortBodiesSpatially) every 'interval'
+    /// integration steps (default: 0, disabled). Useful for large granular-type systems
+    /// where bodies drift far from their insertion order; the reordering improves cache
+    /// locality in contact assembly and solver sweeps at the cost of renumbering the
+    /// system (which invalidates locked sparsity patterns for that step).
+    void SetSpatialSortInterval(int interval) { spatial_sort_interval = interval; }
+
+    /// Get the spatial reordering interval (0 if disabled).
+    int GetSpatialSortInterval() const { return spatial_sort_interval; }
+
+    /// Enable pipelined collision detection: the broadphase and narrowphase for
+    /// the next step run on a worker thread, overlapped with the solver of the
+    /// current step, using body poses predicted by constant-velocity
+    /// extrapolation. When the next step begins, the prediction error is checked
+    /// against the tolerance (see SetPipelinedCollisionTolerance): if any body
+    /// drifted beyond it, collision detection is re-run synchronously with the
+    /// true poses, so results never degrade beyond the tolerance. Contact
+    /// reporting and constraint generation always happen synchronously.
+    /// Intended for rigid-body systems: deformable FEA contact surfaces read
+    /// nodal positions during the narrowphase and must not be used together
+    /// with this mode. If the system is modified while a speculative run may be
+    /// in flight (i.e. between steps), call WaitPipelinedCollision() first.
+    void SetPipelinedCollision(bool val);
+
+    /// Tell if pipelined collision detection is enabled.
+    bool GetPipelinedCollision() const { return pipelined_collision; }
+
+    /// Set the prediction-error tolerance of the pipelined collision mode, as the
+    /// maximum drift of any point of a collision shape between the predicted and
+    /// the actual pose. If <= 0 (default), half the default suggested collision
+    /// envelope is used, so accepted speculative results stay conservative.
+    void SetPipelinedCollisionTolerance(double tol) { pipelined_collision_tol = tol; }
+
+    /// Get the prediction-error tolerance of the pipelined collision mode.
+    double GetPipelinedCollisionTolerance() const { return pipelined_collision_tol; }
+
+    /// Block until the speculative collision run of the pipelined mode (if any
+    /// is in flight) has completed. Call before structurally modifying the
+    /// system between steps when pipelined collision is enabled.
+    void WaitPipelinedCollision();
+
+    /// Retain the last 'depth' integration step states in a history buffer
+    /// (default: 0, disabled), so that consumers running at other rates
+    /// (rendering, telemetry, controllers) can sample the state at arbitrary
+    /// times through SampleStateHistory() instead of forcing the simulation to
+    /// step to their exact output instants. Each retained state stores the
+    /// packed position and velocity vectors of StateGather().
+    void SetStateHistoryDepth(int depth);
+
+    /// Get the depth of the state history buffer (0 if disabled).
+    int GetStateHistoryDepth() const { return state_history_depth; }
+
+    /// Sample the system state at an arbitrary time within the retained
+    /// history window, with cubic Hermite interpolation of the position
+    /// coordinates (end-point tangents obtained from the recorded velocities
+    /// through the state increment, so quaternion coordinates are handled by
+    /// their own exponential map; interpolated quaternions are approximately,
+    /// not exactly, unit length) and linear interpolation of the velocities.
+    /// The vectors x and v are resized as needed. Returns false if the history
+    /// is disabled or 'time' falls outside the retained window.
+    bool SampleStateHistory(double time, ChState& x, ChStateDelta& v);
+
+    /// Enqueue the addition of a physics item to the system.
+    /// Unlike Add(), this may be called from any thread, concurrently with a running
+    /// DoStepDynamics(): the edit is pushed on a lock-free queue and applied, together
+    /// with all other pending edits, at the beginning of the next integration step
+    /// (before collision detection and Setup()). Intended for interactive scene
+    /// editing from threads other than the simulation thread.
+    void EnqueueAdd(std::shared_ptr<ChPhysicsItem> item);
+
+    /// Enqueue the removal of a physics item from the system.
+    /// Thread-safe counterpart of Remove(); see EnqueueAdd().
+    void EnqueueRemove(std::shared_ptr<ChPhysicsItem> item);
+
+    /// Apply all pending scene edits enqueued with EnqueueAdd()/EnqueueRemove(), in
+    /// the order they were enqueued. Called automatically at the beginning of each
+    /// integration step; may also be called explicitly between steps, but only from
+    /// the simulation thread.
+    void ProcessEnqueuedEdits();
+
+    /// Capture the complete dynamic state of the system (time, positions,
+    /// velocities, accelerations, constraint and contact multipliers) into the
+    /// given in-memory snapshot slot, overwriting its previous content.
+    /// Snapshots are compact (the packed vectors of StateGather()) and cheap to
+    /// take and restore, so many candidate futures can be sampled from the same
+    /// starting point per control step (e.g. in model-predictive control)
+    /// without checkpointing to disk. Only the dynamic state is captured: the
+    /// set of bodies, links and other physics items must stay unchanged between
+    /// save and restore.
+    void SaveStateSnapshot(int slot = 0);
+
+    /// Restore the state captured in the given snapshot slot. The saved
+    /// positions, velocities, accelerations and time are scattered back,
+    /// collision detection is re-run so that the contact set matches the
+    /// restored poses again, and the saved multipliers are scattered to warm
+    /// start the solver of the next step. Returns false (leaving the system
+    /// untouched) if the slot is empty or the system structure changed since
+    /// the snapshot was taken.
+    bool RestoreStateSnapshot(int slot = 0);
+
+    /// Drop all saved state snapshots.
+    void ClearStateSnapshots();
+
+    /// A per-step system health sample (see SetHealthMetrics).
+    struct HealthMetricsSample {
+        double t;                     ///< time at the end of the step
+        double max_penetration;       ///< deepest contact penetration, >= 0 (0: no penetrating contact)
+        double constraint_violation;  ///< max velocity-level constraint residual |c_i|, bi- and unilateral
+        double complementarity;       ///< max |c_i * l_i| over the unilateral constraints
+        double kinetic_energy;        ///< total kinetic energy of the rigid bodies
+        double solver_residual;       ///< last recorded solver violation (0 unless the solver records them)
+    };
+
+    /// Enable (or disable) the per-step health metrics channel: at the end of
+    /// every integration step a HealthMetricsSample is appended to a ring
+    /// buffer of the given depth (minimum 2, so that lock-free reads can be
+    /// validated). The metrics cost one sweep over bodies,
+    /// contacts and constraints per step - cheap next to the solve - and let a
+    /// watchdog catch divergence (growing penetration, violation or energy)
+    /// early, instead of diagnosing an exploded run afterwards. The ring is
+    /// written by the simulation thread only and can be read from any thread
+    /// without locks through GetLastHealthMetrics().
+    void SetHealthMetrics(bool enable, int depth = 256);
+
+    /// Tell if the health metrics channel is enabled.
+    bool GetHealthMetrics() const { return health_metrics_enabled; }
+
+    /// Total number of health samples written so far (monotonic; the ring
+    /// retains the most recent ones up to its depth).
+    uint64_t GetHealthMetricsCount() const { return health_count.load(std::memory_order_acquire); }
+
+    /// Get the most recent health sample, lock-free (safe from any thread
+    /// while the simulation advances). Returns false if no sample exists yet.
+    bool GetLastHealthMetrics(HealthMetricsSample& sample) const;
+
   private:
+    /// Compute and publish the health sample of the step just completed.
+    void ComputeHealthMetrics();
+
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
     /// returns false if nothing changed. In the former case, also performs Setup()
@@ -628,6 +786,15 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Depending on the integration type, it switches to one of the following:
     virtual bool Integrate_Y();
 
+    /// Launch the speculative collision run of the pipelined collision mode:
+    /// stamp constant-velocity predicted body poses into the collision engine
+    /// and start broadphase+narrowphase on a worker thread.
+    void StartPipelinedCollision();
+
+    /// Append the current state to the history buffer (see SetStateHistoryDepth),
+    /// dropping the oldest retained state when the buffer is full.
+    void PushStateHistory();
+
   public:
     // ---- DYNAMICS
 
@@ -812,6 +979,47 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    bool update_assets_enabled;  ///< if false, skip visualization asset updates (headless mode)
+    int spatial_sort_interval;   ///< reorder bodies spatially every N steps (0: disabled)
+
+    bool pipelined_collision;        ///< overlap next-step collision detection with the current solve
+    double pipelined_collision_tol;  ///< prediction-error tolerance (<=0: half the suggested envelope)
+    bool collision_pipeline_valid;   ///< a speculative collision run was launched for the next step
+    std::thread collision_pipeline_thread;              ///< worker running the speculative collision run
+    std::vector<ChCoordsys<> > collision_pipeline_pred;  ///< predicted body coordinates of the speculative run
+
+    /// A retained integration step state (see SetStateHistoryDepth).
+    struct StateHistorySample {
+        double t;       ///< time of the sample
+        ChState x;      ///< packed position coordinates
+        ChStateDelta v; ///< packed velocity coordinates
+    };
+    int state_history_depth;                        ///< number of step states retained (0: disabled)
+    std::deque<StateHistorySample> state_history;   ///< retained step states, oldest first
+
+    /// A saved full simulation state (see SaveStateSnapshot).
+    struct StateSnapshot {
+        double t;             ///< time of the snapshot
+        ChState x;            ///< packed position coordinates
+        ChStateDelta v;       ///< packed velocity coordinates
+        ChStateDelta a;       ///< packed accelerations
+        ChVectorDynamic<> L;  ///< constraint and contact multipliers
+    };
+    std::unordered_map<int, StateSnapshot> state_snapshots;  ///< saved snapshot slots
+
+    bool health_metrics_enabled;                   ///< per-step health metrics channel (see SetHealthMetrics)
+    std::vector<HealthMetricsSample> health_ring;  ///< ring buffer of the most recent samples
+    std::atomic<uint64_t> health_count;            ///< total samples written; publishes the ring slots
+
+    /// A pending scene edit, enqueued from any thread (see EnqueueAdd/EnqueueRemove).
+    struct SceneEdit {
+        enum Operation { OP_ADD, OP_REMOVE };
+        Operation op;
+        std::shared_ptr<ChPhysicsItem> item;
+        SceneEdit* next;
+    };
+    std::atomic<SceneEdit*> edit_queue_head;  ///< lock-free stack of pending scene edits
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< the system descriptor
     std::shared_ptr<ChSolver> solver_speed;          ///< the solver for speed problem
     std::shared_ptr<ChSolver> solver_stab;           ///< the solver for position (stabilization) problem, if any
@@ -36,7 +36,11 @@ namespace chrono {
 class  ChArchiveOutJSON : public ChArchiveOut {
   public:
 
-      ChArchiveOutJSON( ChStreamOutAsciiFile& mostream) {
+      /// Serialize to any ASCII output stream: a plain or buffered file
+      /// (ChStreamOutAsciiFile, ChStreamOutAsciiBufferedFile) or a memory
+      /// target (ChStreamOutAsciiBuffer) when the JSON text is shipped
+      /// elsewhere instead of being saved to disk.
+      ChArchiveOutJSON( ChStreamOutAscii& mostream) {
           ostream = &mostream;
           
           (*ostream) << "{ ";
@@ -281,7 +285,7 @@ class  ChArchiveOutJSON : public ChArchiveOut {
 
   protected:
       int tablevel;
-      ChStreamOutAsciiFile* ostream;
+      ChStreamOutAscii* ostream;
       std::stack<int> nitems;
       std::stack<bool> is_array;
 };
@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSTATESNAPSHOT_H
+#define CHSTATESNAPSHOT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChException.h"
+#include "chrono/physics/ChSystem.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace chrono {
+
+///
+/// Raw binary snapshot of the packed state of a ChSystem, for fast
+/// checkpoint/restart of large simulations.
+///
+/// Unlike the ChArchive serialization, which walks every object and writes
+/// field-by-field through virtual stream calls, a snapshot only stores the
+/// packed state vectors obtained from StateGather (positions and velocities)
+/// plus the constraint multipliers, as three contiguous double arrays behind a
+/// small fixed-size header. Writing is three block writes; restarting memory-maps
+/// the file (on platforms that support it) and scatters the payload back with
+/// plain memory copies. A snapshot can only be restored into a system with the
+/// same items in the same order as the one that wrote it: it is a checkpoint of
+/// a known model, not a self-describing archive.
+///
+
+class ChStateSnapshot {
+  public:
+    /// Fixed-size header at the start of a snapshot file. The payload (the x, v
+    /// and L arrays, back to back) starts right after it; the header is sized to
+    /// a multiple of 8 bytes so the payload stays naturally aligned when mapped.
+    struct Header {
+        char magic[8];        ///< file identifier, "CHSNAP"
+        uint64_t version;     ///< format version
+        uint64_t n_x;         ///< number of position coordinates
+        uint64_t n_v;         ///< number of speed coordinates
+        uint64_t n_c;         ///< number of constraint multipliers
+        double time;          ///< simulation time of the snapshot
+        uint64_t reserved[2]; ///< reserved for future use, written as zero
+    };
+
+    static const uint64_t SNAPSHOT_VERSION = 1;
+
+    /// Dump the packed state of the system (positions, velocities, constraint
+    /// multipliers and simulation time) to a snapshot file.
+    /// Throws a ChException if the file cannot be written.
+    static void Write(ChSystem& system, const std::string& filename) {
+        system.Setup();
+
+        int n_x = system.GetNcoords_x();
+        int n_v = system.GetNcoords_v();
+        int n_c = system.GetNconstr();
+
+        ChState x(n_x, &system);
+        ChStateDelta v(n_v, &system);
+        ChVectorDynamic<> L(n_c);
+        double time = 0;
+        system.StateGather(x, v, time);
+        system.StateGatherReactions(L);
+
+        Header header;
+        memset(&header, 0, sizeof(Header));
+        memcpy(header.magic, "CHSNAP", 6);
+        header.version = SNAPSHOT_VERSION;
+        header.n_x = (uint64_t)n_x;
+        header.n_v = (uint64_t)n_v;
+        header.n_c = (uint64_t)n_c;
+        header.time = time;
+
+        FILE* file = fopen(filename.c_str(), "wb");
+        if (!file)
+            throw ChException("Cannot open snapshot file for writing: " + filename);
+        bool ok = fwrite(&header, sizeof(Header), 1, file) == 1;
+        ok = ok && (n_x == 0 || fwrite(x.GetAddress(), sizeof(double), n_x, file) == (size_t)n_x);
+        ok = ok && (n_v == 0 || fwrite(v.GetAddress(), sizeof(double), n_v, file) == (size_t)n_v);
+        ok = ok && (n_c == 0 || fwrite(L.GetAddress(), sizeof(double), n_c, file) == (size_t)n_c);
+        fclose(file);
+        if (!ok)
+            throw ChException("Cannot write snapshot file: " + filename);
+    }
+
+    /// Restore the system state from a snapshot file. On POSIX platforms the file
+    /// is memory-mapped and scattered directly from the mapping; elsewhere it is
+    /// read with a single block read. The system must contain the same items, in
+    /// the same order, as the one that wrote the snapshot.
+    /// Throws a ChException if the file cannot be read or does not match the system.
+    static void Read(ChSystem& system, const std::string& filename) {
+#if !defined(_WIN32)
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw ChException("Cannot open snapshot file for reading: " + filename);
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            throw ChException("Cannot open snapshot file for reading: " + filename);
+        }
+        size_t length = (size_t)file_stat.st_size;
+        void* mapping = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            throw ChException("Cannot map snapshot file: " + filename);
+        }
+        try {
+            ScatterBlob(system, (const char*)mapping, length);
+        } catch (...) {
+            munmap(mapping, length);
+            close(fd);
+            throw;
+        }
+        munmap(mapping, length);
+        close(fd);
+#else
+        FILE* file = fopen(filename.c_str(), "rb");
+        if (!file)
+            throw ChException("Cannot open snapshot file for reading: " + filename);
+        fseek(file, 0, SEEK_END);
+        size_t length = (size_t)ftell(file);
+        fseek(file, 0, SEEK_SET);
+        std::vector<char> blob(length);
+        bool ok = length > 0 && fread(blob.data(), 1, length, file) == length;
+        fclose(file);
+        if (!ok)
+            throw ChException("Cannot read snapshot file: " + filename);
+        ScatterBlob(system, blob.data(), length);
+#endif
+    }
+
+    /// Scatter a snapshot blob (header followed by payload) back into the system.
+    /// Exposed separately so that a blob obtained by other means (e.g. a region
+    /// kept mapped by the caller, or received over a network) can be restored too.
+    static void ScatterBlob(ChSystem& system, const char* data, size_t length) {
+        if (length < sizeof(Header))
+            throw ChException("Snapshot blob is smaller than the snapshot header");
+
+        Header header;
+        memcpy(&header, data, sizeof(Header));
+        if (memcmp(header.magic, "CHSNAP", 6) != 0)
+            throw ChException("Not a state snapshot blob");
+        if (header.version != SNAPSHOT_VERSION)
+            throw ChException("Unsupported state snapshot version");
+        if (length < sizeof(Header) + (size_t)(header.n_x + header.n_v + header.n_c) * sizeof(double))
+            throw ChException("State snapshot blob is truncated");
+
+        system.Setup();
+        int n_x = system.GetNcoords_x();
+        int n_v = system.GetNcoords_v();
+        int n_c = system.GetNconstr();
+        if ((uint64_t)n_x != header.n_x || (uint64_t)n_v != header.n_v || (uint64_t)n_c != header.n_c)
+            throw ChException("State snapshot does not match the system (different number of states or constraints)");
+
+        const double* payload = (const double*)(data + sizeof(Header));
+
+        ChState x(n_x, &system);
+        ChStateDelta v(n_v, &system);
+        ChVectorDynamic<> L(n_c);
+        memcpy(x.GetAddress(), payload, n_x * sizeof(double));
+        memcpy(v.GetAddress(), payload + n_x, n_v * sizeof(double));
+        memcpy(L.GetAddress(), payload + n_x + n_v, n_c * sizeof(double));
+
+        system.StateScatter(x, v, header.time);
+        system.StateScatterReactions(L);
+    }
+};
+
+}  // end namespace chrono
+
+#endif
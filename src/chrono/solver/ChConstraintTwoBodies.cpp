@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <cstring>
+
 #include "chrono/solver/ChConstraintTwoBodies.h"
 
 namespace chrono {
@@ -20,6 +22,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChConstraintTwoBodies)
 
 ChConstraintTwoBodies::ChConstraintTwoBodies(ChVariablesBody* mvariables_a, ChVariablesBody* mvariables_b) {
+    aux_cache_valid = false;
     SetVariables(mvariables_a, mvariables_b);
 }
 
@@ -28,6 +31,7 @@ ChConstraintTwoBodies::ChConstraintTwoBodies(const ChConstraintTwoBodies& other)
     Cq_b = other.Cq_b;
     Eq_a = other.Eq_a;
     Eq_b = other.Eq_b;
+    aux_cache_valid = false;
 }
 
 ChConstraintTwoBodies& ChConstraintTwoBodies::operator=(const ChConstraintTwoBodies& other) {
@@ -41,6 +45,7 @@ ChConstraintTwoBodies& ChConstraintTwoBodies::operator=(const ChConstraintTwoBod
     Cq_b = other.Cq_b;
     Eq_a = other.Eq_a;
     Eq_b = other.Eq_b;
+    aux_cache_valid = false;
 
     this->variables_a = other.variables_a;
     this->variables_b = other.variables_b;
@@ -63,6 +68,36 @@ void ChConstraintTwoBodies::SetVariables(ChVariables* mvariables_a, ChVariables*
 }
 
 void ChConstraintTwoBodies::Update_auxiliary() {
+    // The auxiliary quantities depend only on the jacobian entries (which vary
+    // with the orientation of the two bodies) and on their mass matrices.
+    // Collect these inputs in a fingerprint and skip the recomputation when it
+    // matches the one of the previous call: in link-dominated mechanisms large
+    // parts of the model do not rotate between solver setups, and for their
+    // constraints the two [invM]*[Cq]' products reduce to a comparison of the
+    // fingerprint entries.
+    const ChVariablesBody* bva = static_cast<ChVariablesBody*>(variables_a);
+    const ChVariablesBody* bvb = static_cast<ChVariablesBody*>(variables_b);
+    const ChMatrix33<>& invIa = bva->GetBodyInvInertia();
+    const ChMatrix33<>& invIb = bvb->GetBodyInvInertia();
+
+    double fingerprint[35];
+    for (int i = 0; i < 6; i++) {
+        fingerprint[i] = Cq_a.ElementN(i);
+        fingerprint[6 + i] = Cq_b.ElementN(i);
+    }
+    fingerprint[12] = bva->GetBodyMass();
+    fingerprint[13] = bvb->GetBodyMass();
+    for (int i = 0; i < 9; i++) {
+        fingerprint[14 + i] = invIa.GetElementN(i);
+        fingerprint[23 + i] = invIb.GetElementN(i);
+    }
+    fingerprint[32] = cfm_i;
+    fingerprint[33] = variables_a->IsActive() ? 1 : 0;
+    fingerprint[34] = variables_b->IsActive() ? 1 : 0;
+
+    if (aux_cache_valid && std::memcmp(aux_cache, fingerprint, sizeof(fingerprint)) == 0)
+        return;
+
     // 1- Assuming jacobians are already computed, now compute
     //   the matrices [Eq_a]=[invM_a]*[Cq_a]' and [Eq_b]
     if (variables_a->IsActive()) {
@@ -77,20 +112,20 @@ void ChConstraintTwoBodies::Update_auxiliary() {
     }
 
     // 2- Compute g_i = [Cq_i]*[invM_i]*[Cq_i]' + cfm_i
-    ChMatrixNM<double, 1, 1> res;
     g_i = 0;
-    if (variables_a->IsActive()) {
-        res.MatrMultiply(Cq_a, Eq_a);
-        g_i = res(0, 0);
-    }
-    if (variables_b->IsActive()) {
-        res.MatrMultiply(Cq_b, Eq_b);
-        g_i += res(0, 0);
-    }
+    if (variables_a->IsActive())
+        for (int i = 0; i < 6; i++)
+            g_i += Cq_a.ElementSN(i) * Eq_a.ElementSN(i);
+    if (variables_b->IsActive())
+        for (int i = 0; i < 6; i++)
+            g_i += Cq_b.ElementSN(i) * Eq_b.ElementSN(i);
 
     // 3- adds the constraint force mixing term (usually zero):
     if (cfm_i)
         g_i += cfm_i;
+
+    std::memcpy(aux_cache, fingerprint, sizeof(aux_cache));
+    aux_cache_valid = true;
 }
 
 double ChConstraintTwoBodies::Compute_Cq_q() {
@@ -98,11 +133,11 @@ double ChConstraintTwoBodies::Compute_Cq_q() {
 
     if (variables_a->IsActive())
         for (int i = 0; i < 6; i++)
-            ret += Cq_a.ElementN(i) * variables_a->Get_qb().ElementN(i);
+            ret += Cq_a.ElementSN(i) * variables_a->Get_qb().ElementN(i);
 
     if (variables_b->IsActive())
         for (int i = 0; i < 6; i++)
-            ret += Cq_b.ElementN(i) * variables_b->Get_qb().ElementN(i);
+            ret += Cq_b.ElementSN(i) * variables_b->Get_qb().ElementN(i);
 
     return ret;
 }
@@ -110,11 +145,11 @@ double ChConstraintTwoBodies::Compute_Cq_q() {
 void ChConstraintTwoBodies::Increment_q(const double deltal) {
     if (variables_a->IsActive())
         for (int i = 0; i < 6; i++)
-            variables_a->Get_qb()(i) += Eq_a.ElementN(i) * deltal;
+            variables_a->Get_qb()(i) += Eq_a.ElementSN(i) * deltal;
 
     if (variables_b->IsActive())
         for (int i = 0; i < 6; i++)
-            variables_b->Get_qb()(i) += Eq_b.ElementN(i) * deltal;
+            variables_b->Get_qb()(i) += Eq_b.ElementSN(i) * deltal;
 }
 
 void ChConstraintTwoBodies::MultiplyAndAdd(double& result, const ChMatrix<double>& vect) const {
@@ -123,11 +158,11 @@ void ChConstraintTwoBodies::MultiplyAndAdd(double& result, const ChMatrix<double
 
     if (variables_a->IsActive())
         for (int i = 0; i < 6; i++)
-            result += vect(off_a + i) * Cq_a.ElementN(i);
+            result += vect(off_a + i) * Cq_a.ElementSN(i);
 
     if (variables_b->IsActive())
         for (int i = 0; i < 6; i++)
-            result += vect(off_b + i) * Cq_b.ElementN(i);
+            result += vect(off_b + i) * Cq_b.ElementSN(i);
 }
 
 void ChConstraintTwoBodies::MultiplyTandAdd(ChMatrix<double>& result, double l) {
@@ -136,11 +171,11 @@ void ChConstraintTwoBodies::MultiplyTandAdd(ChMatrix<double>& result, double l)
 
     if (variables_a->IsActive())
         for (int i = 0; i < 6; i++)
-            result(off_a + i) += Cq_a.ElementN(i) * l;
+            result(off_a + i) += Cq_a.ElementSN(i) * l;
 
     if (variables_b->IsActive())
         for (int i = 0; i < 6; i++)
-            result(off_b + i) += Cq_b.ElementN(i) * l;
+            result(off_b + i) += Cq_b.ElementSN(i) * l;
 }
 
 void ChConstraintTwoBodies::Build_Cq(ChSparseMatrix& storage, int insrow) {
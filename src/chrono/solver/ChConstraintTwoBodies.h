@@ -34,9 +34,15 @@ class ChApi ChConstraintTwoBodies : public ChConstraintTwo {
     ChMatrixNM<double, 6, 1> Eq_a;  ///< The [Eq_a] product [Eq_a]=[invM_a]*[Cq_a]'
     ChMatrixNM<double, 6, 1> Eq_b;  ///< The [Eq_a] product [Eq_b]=[invM_b]*[Cq_b]'
 
+    /// Fingerprint of the data the auxiliary quantities were last computed from
+    /// (jacobian entries, mass and inverse inertia of the two bodies, cfm): when
+    /// it is unchanged, Update_auxiliary() keeps the cached Eq_a, Eq_b and g_i.
+    double aux_cache[35];
+    bool aux_cache_valid;  ///< is aux_cache the fingerprint of the current Eq/g_i?
+
   public:
     /// Default constructor
-    ChConstraintTwoBodies() {}
+    ChConstraintTwoBodies() : aux_cache_valid(false) {}
 
     /// Construct and immediately set references to variables
     ChConstraintTwoBodies(ChVariablesBody* mvariables_a, ChVariablesBody* mvariables_b);
@@ -15,10 +15,54 @@
 #ifndef CHITERATIVESOLVER_H
 #define CHITERATIVESOLVER_H
 
+#include <cassert>
+#include <vector>
+
+#include "chrono/core/ChAlignedAllocator.h"
 #include "chrono/solver/ChSolver.h"
 
 namespace chrono {
 
+/// Column-vector view over a slice of an iterative solver workspace (see
+/// ChIterativeSolver::AcquireWorkspace), so that the ChSystemDescriptor bulk
+/// functions taking a ChMatrix<>& and the ChMatrix operations can run in place
+/// on the flat workspace arrays. The memory is owned by the workspace: resizing
+/// is allowed only as the no-op with unchanged dimensions performed by the
+/// descriptor fill functions, and assignment copies values, not the binding.
+class ChWorkVector : public ChMatrix<double> {
+  public:
+    ChWorkVector() {
+        this->address = 0;
+        this->rows = 0;
+        this->columns = 1;
+    }
+    ChWorkVector(double* mem, int nrows) { Bind(mem, nrows); }
+    ~ChWorkVector() { this->address = 0; }
+
+    /// Attach the view to workspace memory.
+    void Bind(double* mem, int nrows) {
+        this->address = mem;
+        this->rows = nrows;
+        this->columns = 1;
+    }
+
+    /// Copy the values (not the binding) of another same-sized matrix.
+    ChWorkVector& operator=(const ChMatrix<double>& other) {
+        CopyFromMatrix(other);
+        return *this;
+    }
+    ChWorkVector& operator=(const ChWorkVector& other) {
+        CopyFromMatrix(other);
+        return *this;
+    }
+
+    virtual void Resize(int nrows, int ncols) override {
+        assert(nrows == this->rows && ncols == this->columns);
+        (void)nrows;
+        (void)ncols;
+    }
+};
+
 /// Base class for ITERATIVE solvers aimed at solving complementarity problems arising
 /// from QP optimization problems.
 /// This class does nothing: it is up to derived classes to implement specific solution
@@ -48,6 +92,25 @@ class ChApi ChIterativeSolver : public ChSolver {
     std::vector<double> violation_history;
     std::vector<double> dlambda_history;
 
+    /// Working storage for the solver temporaries, reused across Solve() calls.
+    /// Grows monotonically to the high-water mark of the requested sizes, so
+    /// with fluctuating contact counts no per-call allocation takes place.
+    std::vector<double, aligned_allocator<double, 32> > work_buffer;
+    int work_shrink_factor;  ///< release policy of the workspace (see SetWorkspaceShrinkFactor)
+
+    /// Return a zero-filled block of n doubles from the per-solver workspace,
+    /// 32-byte aligned. The block stays valid until the next acquisition (or
+    /// ShrinkWorkspace); derived solvers carve their temporary vectors out of
+    /// it, typically through ChWorkVector views over slices.
+    double* AcquireWorkspace(size_t n) {
+        if (work_shrink_factor > 0 && work_buffer.capacity() > (size_t)work_shrink_factor * (n > 0 ? n : 1)) {
+            // the capacity kept from an earlier, much larger problem is released
+            std::vector<double, aligned_allocator<double, 32> >().swap(work_buffer);
+        }
+        work_buffer.assign(n, 0.0);
+        return work_buffer.data();
+    }
+
   public:
     ChIterativeSolver(int mmax_iters = 50,       ///< max.number of iterations
                       bool mwarm_start = false,  ///< uses warm start?
@@ -61,7 +124,8 @@ class ChApi ChIterativeSolver : public ChSolver {
           tolerance(mtolerance),
           omega(momega),
           shlambda(mshlambda),
-          record_violation_history(false) {}
+          record_violation_history(false),
+          work_shrink_factor(0) {}
 
     virtual ~ChIterativeSolver() {}
 
@@ -111,6 +175,20 @@ class ChApi ChIterativeSolver : public ChSolver {
     /// Return a flag indicating whether or not warm start is enabled.
     bool GetWarmStart() const { return warm_start; }
 
+    /// Control when the solver workspace releases its memory. The workspace
+    /// grows to the high-water mark of the problem sizes seen so far; with
+    /// factor > 0, it is released (and re-grown to the current size) whenever
+    /// the retained capacity exceeds 'factor' times the current request, giving
+    /// hysteresis against fluctuating contact counts. Default: 0, never shrink.
+    void SetWorkspaceShrinkFactor(int factor) { work_shrink_factor = factor; }
+
+    /// Return the current workspace capacity, in bytes.
+    size_t GetWorkspaceSizeBytes() const { return work_buffer.capacity() * sizeof(double); }
+
+    /// Release the solver workspace memory now. Any ChWorkVector views into it
+    /// (e.g. the vectors exposed by some solvers for debugging) become invalid.
+    void ShrinkWorkspace() { std::vector<double, aligned_allocator<double, 32> >().swap(work_buffer); }
+
     /// Set the tolerance for stopping criterion.
     /// The iteration is stopped when the constraint feasibility error is below this value.
     /// Default: 0.0
@@ -44,6 +44,9 @@ class ChApi ChKblock {
     /// Returns the number of referenced ChVariables items
     virtual size_t GetNvars() const = 0;
 
+    /// Access the m-th referenced ChVariables item
+    virtual ChVariables* GetVariableN(unsigned int m_var) const = 0;
+
     /// Access the K stiffness matrix as a single block,
     /// referring only to the referenced ChVariable objects
     virtual ChMatrix<double>* Get_K() = 0;
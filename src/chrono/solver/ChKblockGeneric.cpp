@@ -131,30 +131,26 @@ void ChKblockGeneric::Build_K(ChSparseMatrix& storage, bool add) {
     if (!K)
         return;
 
+    // Build the scatter map from the rows/columns of K to the global matrix indexes,
+    // so that the whole block is injected with a single PasteBlock() call instead of
+    // one sub-block paste per variable pair. Rows/columns of inactive variables are
+    // marked with -1 and skipped by the scatter.
+    block_map.resize(K->GetRows());
+
     int kio = 0;
     for (unsigned int iv = 0; iv < this->GetNvars(); iv++) {
         int io = this->GetVariableN(iv)->GetOffset();
         int in = this->GetVariableN(iv)->Get_ndof();
+        bool active = this->GetVariableN(iv)->IsActive();
 
-        if (this->GetVariableN(iv)->IsActive()) {
-            int kjo = 0;
-            for (unsigned int jv = 0; jv < this->GetNvars(); jv++) {
-                int jo = this->GetVariableN(jv)->GetOffset();
-                int jn = this->GetVariableN(jv)->Get_ndof();
-
-                if (this->GetVariableN(jv)->IsActive()) {
-                    if (add)
-                        storage.PasteSumClippedMatrix(*K, kio, kjo, in, jn, io, jo);
-                    else
-                        storage.PasteClippedMatrix(*K, kio, kjo, in, jn, io, jo);
-                }
-
-                kjo += jn;
-            }
-        }
+        for (int r = 0; r < in; r++)
+            block_map[kio + r] = active ? io + r : -1;
 
         kio += in;
     }
+
+    // K spans the same variables along rows and columns, so the same map applies to both.
+    storage.PasteBlock(*K, block_map, block_map, !add);
 }
 
 
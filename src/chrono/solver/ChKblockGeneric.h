@@ -37,6 +37,7 @@ class ChApi ChKblockGeneric : public ChKblock {
   private:
     ChMatrixDynamic<double>* K;
     std::vector<ChVariables*> variables;
+    std::vector<int> block_map;  ///< scatter map from K rows/columns to global matrix indexes (see Build_K)
 
   public:
     ChKblockGeneric() : K(NULL) {}
@@ -55,7 +56,7 @@ class ChApi ChKblockGeneric : public ChKblock {
     virtual size_t GetNvars() const override { return variables.size(); }
 
     /// Access the m-th vector variable object
-    ChVariables* GetVariableN(unsigned int m_var) const { return variables[m_var]; }
+    virtual ChVariables* GetVariableN(unsigned int m_var) const override { return variables[m_var]; }
 
     /// Access the K stiffness matrix as a single block,
     /// referring only to the referenced ChVariable objects
@@ -91,14 +91,16 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     double obj1, obj2;
 
     nc = sysd.CountActiveConstraints();
-    gamma_hat.Resize(nc, 1);
-    gammaNew.Resize(nc, 1);
-    g.Resize(nc, 1);
-    y.Resize(nc, 1);
-    gamma.Resize(nc, 1);
-    yNew.Resize(nc, 1);
-    r.Resize(nc, 1);
-    tmp.Resize(nc, 1);
+    int stride = (nc + 3) & ~3;  // keep each slice 32-byte aligned
+    double* w = AcquireWorkspace(8 * (size_t)stride);
+    gamma_hat.Bind(w + 0 * stride, nc);
+    gammaNew.Bind(w + 1 * stride, nc);
+    g.Bind(w + 2 * stride, nc);
+    y.Bind(w + 3 * stride, nc);
+    gamma.Bind(w + 4 * stride, nc);
+    yNew.Bind(w + 5 * stride, nc);
+    r.Bind(w + 6 * stride, nc);
+    tmp.Bind(w + 7 * stride, nc);
 
     residual = 10e30;
 
@@ -28,7 +28,7 @@ class ChApi ChSolverAPGD : public ChIterativeSolver {
   protected:
     double residual = 0;
     int nc = 0;
-    ChMatrixDynamic<> gamma_hat, gammaNew, g, y, gamma, yNew, r, tmp;
+    ChWorkVector gamma_hat, gammaNew, g, y, gamma, yNew, r, tmp;
 
   public:
     ChSolverAPGD(int mmax_iters = 1000,     ///< max.number of iterations
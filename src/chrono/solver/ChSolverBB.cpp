@@ -54,18 +54,20 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd  ///< system description with
     if (verbose)
         GetLog() << "\n-----Barzilai-Borwein, solving nc=" << nc << "unknowns \n";
 
-    ChMatrixDynamic<> ml(nc, 1);
-    ChMatrixDynamic<> ml_candidate(nc, 1);
-    ChMatrixDynamic<> mg(nc, 1);
-    ChMatrixDynamic<> mg_p(nc, 1);
-    ChMatrixDynamic<> ml_p(nc, 1);
-    ChMatrixDynamic<> mdir(nc, 1);
-    ChMatrixDynamic<> mb(nc, 1);
-    ChMatrixDynamic<> mb_tmp(nc, 1);
-    ChMatrixDynamic<> ms(nc, 1);
-    ChMatrixDynamic<> my(nc, 1);
-    ChMatrixDynamic<> mD(nc, 1);
-    ChMatrixDynamic<> mDg(nc, 1);
+    int stride = (nc + 3) & ~3;  // keep each slice 32-byte aligned
+    double* w = AcquireWorkspace(12 * (size_t)stride);
+    ChWorkVector ml(w + 0 * stride, nc);
+    ChWorkVector ml_candidate(w + 1 * stride, nc);
+    ChWorkVector mg(w + 2 * stride, nc);
+    ChWorkVector mg_p(w + 3 * stride, nc);
+    ChWorkVector ml_p(w + 4 * stride, nc);
+    ChWorkVector mdir(w + 5 * stride, nc);
+    ChWorkVector mb(w + 6 * stride, nc);
+    ChWorkVector mb_tmp(w + 7 * stride, nc);
+    ChWorkVector ms(w + 8 * stride, nc);
+    ChWorkVector my(w + 9 * stride, nc);
+    ChWorkVector mD(w + 10 * stride, nc);
+    ChWorkVector mDg(w + 11 * stride, nc);
 
     // Update auxiliary data in all constraints before starting,
     // that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
@@ -407,18 +409,20 @@ double ChSolverBB::Solve_SupportingStiffness(
     if (verbose)
         GetLog() << "\n-----Barzilai-Borwein -supporting stiffness-, n.unknowns nx=" << nx << " \n";
 
-    ChMatrixDynamic<> mx(nx, 1);
-    ChMatrixDynamic<> mx_candidate(nx, 1);
-    ChMatrixDynamic<> mg(nx, 1);
-    ChMatrixDynamic<> mg_p(nx, 1);
-    ChMatrixDynamic<> mx_p(nx, 1);
-    ChMatrixDynamic<> mdir(nx, 1);
-    ChMatrixDynamic<> md(nx, 1);
-    ChMatrixDynamic<> md_tmp(nx, 1);
-    ChMatrixDynamic<> ms(nx, 1);
-    ChMatrixDynamic<> my(nx, 1);
-    ChMatrixDynamic<> mD(nx, 1);
-    ChMatrixDynamic<> mDg(nx, 1);
+    int stride = (nx + 3) & ~3;  // keep each slice 32-byte aligned
+    double* w = AcquireWorkspace(12 * (size_t)stride);
+    ChWorkVector mx(w + 0 * stride, nx);
+    ChWorkVector mx_candidate(w + 1 * stride, nx);
+    ChWorkVector mg(w + 2 * stride, nx);
+    ChWorkVector mg_p(w + 3 * stride, nx);
+    ChWorkVector mx_p(w + 4 * stride, nx);
+    ChWorkVector mdir(w + 5 * stride, nx);
+    ChWorkVector md(w + 6 * stride, nx);
+    ChWorkVector md_tmp(w + 7 * stride, nx);
+    ChWorkVector ms(w + 8 * stride, nx);
+    ChWorkVector my(w + 9 * stride, nx);
+    ChWorkVector mD(w + 10 * stride, nx);
+    ChWorkVector mDg(w + 11 * stride, nx);
 
     //
     // --- Compute a diagonal (scaling) preconditioner for the KKT system:
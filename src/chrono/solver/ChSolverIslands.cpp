@@ -0,0 +1,120 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <unordered_map>
+
+#include "chrono/core/ChMathematics.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/solver/ChSolverIslands.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverIslands)
+
+double ChSolverIslands::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                              ) {
+    assert(inner_solver);
+
+    // Decomposition is possible only when the inner solver works directly off the
+    // descriptor (iterative solvers); direct solvers factorized the full problem
+    // during Setup() and must see the same monolithic problem here.
+    if (!inner_solver->SolveRequiresMatrix())
+        return inner_solver->Solve(sysd);
+
+    int num_islands = sysd.ComputeIslands(var_island, constr_island);
+    if (num_islands <= 1)
+        return inner_solver->Solve(sysd);
+
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChKblock*>& mstiffness = sysd.GetKblocksList();
+
+    // Degenerate active constraints (no structural nonzero in their jacobian row)
+    // belong to no island: keep the monolithic path rather than dropping them.
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        if (mconstraints[ic]->IsActive() && constr_island[ic] < 0)
+            return inner_solver->Solve(sysd);
+    }
+
+    // Attribute each stiffness block to the island of (any of) its variables; all the
+    // variables of a block ended up in the same island by construction. ChKblock
+    // specializations that do not expose their variables cannot be attributed.
+    std::vector<int> kblock_island(mstiffness.size(), -1);
+    if (!mstiffness.empty()) {
+        std::unordered_map<ChVariables*, int> island_of_var;
+        for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+            if (var_island[iv] >= 0)
+                island_of_var[mvariables[iv]] = var_island[iv];
+        }
+        for (unsigned int ik = 0; ik < mstiffness.size(); ik++) {
+            ChKblockGeneric* mkblock = dynamic_cast<ChKblockGeneric*>(mstiffness[ik]);
+            if (!mkblock)
+                return inner_solver->Solve(sysd);
+            for (unsigned int iv = 0; iv < mkblock->GetNvars(); iv++) {
+                auto found = island_of_var.find(mkblock->GetVariableN(iv));
+                if (found != island_of_var.end()) {
+                    kblock_island[ik] = found->second;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Bucket variables, constraints and stiffness blocks per island, preserving the
+    // original insertion order within each island.
+    std::vector<std::vector<ChVariables*> > island_vars(num_islands);
+    std::vector<std::vector<ChConstraint*> > island_constr(num_islands);
+    std::vector<std::vector<ChKblock*> > island_stiff(num_islands);
+    for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+        if (var_island[iv] >= 0)
+            island_vars[var_island[iv]].push_back(mvariables[iv]);
+    }
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        if (constr_island[ic] >= 0)
+            island_constr[constr_island[ic]].push_back(mconstraints[ic]);
+    }
+    for (unsigned int ik = 0; ik < mstiffness.size(); ik++) {
+        if (kblock_island[ik] >= 0)
+            island_stiff[kblock_island[ik]].push_back(mstiffness[ik]);
+    }
+
+    island_descriptor.SetMassFactor(sysd.GetMassFactor());
+
+    double max_violation = 0;
+    for (int isl = 0; isl < num_islands; isl++) {
+        island_descriptor.BeginInsertion();
+        for (unsigned int iv = 0; iv < island_vars[isl].size(); iv++)
+            island_descriptor.InsertVariables(island_vars[isl][iv]);
+        for (unsigned int ic = 0; ic < island_constr[isl].size(); ic++)
+            island_descriptor.InsertConstraint(island_constr[isl][ic]);
+        for (unsigned int ik = 0; ik < island_stiff[isl].size(); ik++)
+            island_descriptor.InsertKblock(island_stiff[isl][ik]);
+        island_descriptor.EndInsertion();  // note: rewrites the offsets inside the shared objects
+
+        double violation = inner_solver->Solve(island_descriptor);
+        max_violation = ChMax(max_violation, violation);
+    }
+
+    if (verbose)
+        GetLog() << " ChSolverIslands: solved " << num_islands << " islands \n";
+
+    // The island solves rewrote the variable and constraint offsets stored inside the
+    // shared objects; restore the global numbering for the rest of the time step.
+    sysd.UpdateCountsAndOffsets();
+
+    return max_violation;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHSOLVERISLANDS_H
+#define CHSOLVERISLANDS_H
+
+#include <memory>
+
+#include "chrono/solver/ChSolver.h"
+
+namespace chrono {
+
+/// Wrapper solver that decomposes the problem into independent constraint 'islands'
+/// and runs an inner solver on each island as a separate, smaller problem.
+///
+/// When the scene contains groups of bodies that share no constraint or contact
+/// (e.g. separate piles or mechanisms), the monolithic VI/CCP iterates over all
+/// variables and constraints at every sweep, and the convergence of the whole solve
+/// is dictated by the worst-conditioned group. Solving each island independently
+/// lets well-conditioned islands converge (and terminate) early, and shrinks the
+/// working set of each solve. Island detection uses
+/// ChSystemDescriptor::ComputeIslands(), which extracts the coupling graph from the
+/// sparsity pattern of the constraint jacobians and stiffness blocks.
+///
+/// The wrapper only decomposes when the inner solver works directly off the system
+/// descriptor (i.e. SolveRequiresMatrix() returns true, as for all the iterative
+/// solvers); for other solvers, and whenever a single island is found, it falls back
+/// to a monolithic inner solve.
+///
+/// Note that the islands are solved one after the other, not concurrently: the
+/// variable and constraint offsets used during a solve are stored inside the shared
+/// ChVariables and ChConstraint objects, so two island solves cannot be in flight at
+/// the same time. The speedup comes from early termination and smaller working sets,
+/// not from thread parallelism (the inner solver may still use its own threads).
+
+class ChApi ChSolverIslands : public ChSolver {
+
+  public:
+    ChSolverIslands(std::shared_ptr<ChSolver> my_inner_solver = nullptr) : inner_solver(my_inner_solver) {}
+
+    virtual ~ChSolverIslands() {}
+
+    virtual Type GetType() const override { return Type::CUSTOM; }
+
+    /// Set the solver used on each island (and for the monolithic fallback).
+    void SetInnerSolver(std::shared_ptr<ChSolver> my_inner_solver) { inner_solver = my_inner_solver; }
+
+    /// Get the solver used on each island.
+    std::shared_ptr<ChSolver> GetInnerSolver() const { return inner_solver; }
+
+    /// Deferred to the inner solver.
+    virtual bool SolveRequiresMatrix() const override {
+        return inner_solver ? inner_solver->SolveRequiresMatrix() : true;
+    }
+
+    /// The setup phase is deferred to the inner solver, on the full system
+    /// (for the iterative solvers this is a no-operation anyway).
+    virtual bool Setup(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                       ) override {
+        return inner_solver ? inner_solver->Setup(sysd) : true;
+    }
+
+    /// Performs the solution of the problem, one island at a time.
+    /// \return  the maximum constraint violation over all islands after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+  private:
+    std::shared_ptr<ChSolver> inner_solver;  ///< solver applied to each island
+
+    ChSystemDescriptor island_descriptor;  ///< reusable descriptor for the island being solved
+
+    std::vector<int> var_island;     ///< island index of each variable, from ComputeIslands()
+    std::vector<int> constr_island;  ///< island index of each constraint, from ComputeIslands()
+};
+
+}  // end namespace chrono
+
+#endif
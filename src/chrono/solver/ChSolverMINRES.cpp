@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include "chrono/core/ChLinearAlgebra.h"
 #include "chrono/solver/ChSolverMINRES.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 
@@ -64,13 +65,15 @@ double ChSolverMINRES::Solve(ChSystemDescriptor& sysd  ///< system description w
 
     if (verbose)
         GetLog() << "nc = " << nc << "\n";
-    ChMatrixDynamic<> ml(nc, 1);
-    ChMatrixDynamic<> mb(nc, 1);
-    ChMatrixDynamic<> mr(nc, 1);
-    ChMatrixDynamic<> mp(nc, 1);
-    ChMatrixDynamic<> mb_i(nc, 1);
-    ChMatrixDynamic<> Nr(nc, 1);
-    ChMatrixDynamic<> Np(nc, 1);
+    int stride = (nc + 3) & ~3;  // keep each slice 32-byte aligned
+    double* w = AcquireWorkspace(7 * (size_t)stride);
+    ChWorkVector ml(w + 0 * stride, nc);
+    ChWorkVector mb(w + 1 * stride, nc);
+    ChWorkVector mr(w + 2 * stride, nc);
+    ChWorkVector mp(w + 3 * stride, nc);
+    ChWorkVector mb_i(w + 4 * stride, nc);
+    ChWorkVector Nr(w + 5 * stride, nc);
+    ChWorkVector Np(w + 6 * stride, nc);
     std::vector<bool> en_l(nc);
 
     // Compute the b_shur vector in the Shur complement equation N*l = b_shur
@@ -216,7 +219,8 @@ double ChSolverMINRES::Solve(ChSystemDescriptor& sysd  ///< system description w
                     ++s_cc;
                 }
 
-            mr.MatrDec((Np * alpha));  // r = r - alpha * N*p;
+            for (int k = 0; k < nc; k++)  // r = r - alpha * N*p;  (in place, no temporary)
+                mr(k, 0) -= alpha * Np(k, 0);
 
             sysd.ShurComplementProduct(Nr, &mr, &en_l);  // Nr  =  N * r
             double rNr_ = mr.MatrDot(mr, Nr);            // rNr = r' * N * r
@@ -368,18 +372,20 @@ double ChSolverMINRES::Solve_SupportingStiffness(
         GetLog() << "\n----- MINRES -supporting stiffness-, n.vars nx=" << nx << "  max.iters=" << max_iterations
                  << "\n";
 
-    ChMatrixDynamic<> x(nx, 1);
-    ChMatrixDynamic<> d(nx, 1);
-    ChMatrixDynamic<> p(nx, 1);
-    ChMatrixDynamic<> r(nx, 1);
-    ChMatrixDynamic<> Zr(nx, 1);
-    ChMatrixDynamic<> Zp(nx, 1);
-    ChMatrixDynamic<> MZp(nx, 1);
-    ChMatrixDynamic<> r_old(nx, 1);
-    ChMatrixDynamic<> Zr_old(nx, 1);
-
-    ChMatrixDynamic<> tmp(nx, 1);
-    ChMatrixDynamic<> mDi(nx, 1);
+    int stride = (nx + 3) & ~3;  // keep each slice 32-byte aligned
+    double* w = AcquireWorkspace(11 * (size_t)stride);
+    ChWorkVector x(w + 0 * stride, nx);
+    ChWorkVector d(w + 1 * stride, nx);
+    ChWorkVector p(w + 2 * stride, nx);
+    ChWorkVector r(w + 3 * stride, nx);
+    ChWorkVector Zr(w + 4 * stride, nx);
+    ChWorkVector Zp(w + 5 * stride, nx);
+    ChWorkVector MZp(w + 6 * stride, nx);
+    ChWorkVector r_old(w + 7 * stride, nx);
+    ChWorkVector Zr_old(w + 8 * stride, nx);
+
+    ChWorkVector tmp(w + 9 * stride, nx);
+    ChWorkVector mDi(w + 10 * stride, nx);
 
     this->tot_iterations = 0;
     double maxviolation = 0.;
@@ -402,6 +408,124 @@ double ChSolverMINRES::Solve_SupportingStiffness(
             mDi(nel) = 1.0;
     }
 
+    // Optionally upgrade the variable part of the preconditioner to block-Jacobi: one small
+    // dense block per variable, assembled from the (scaled) mass sub-block and the diagonal
+    // sub-blocks of the ChKblock objects, then inverted in place. Assembly and storage stay
+    // O(n) - no global matrix is formed - so this preserves the matrix-free character of
+    // this solver while giving a much better preconditioner than the scalar diagonal on
+    // stiffness-dominated problems (e.g. FEA statics, where the mass factor is zero and the
+    // system reduces to the tangent stiffness). The constraint part of the unknowns keeps
+    // the scalar preconditioning computed above.
+    bool do_blockjacobi = do_preconditioning && this->blockjacobi_preconditioning;
+    if (do_blockjacobi) {
+        precond_blocks.resize(mvariables.size());
+
+        // Mass sub-blocks, extracted column by column with basis products (the
+        // MultiplyAndAdd of a ChVariables object only touches its own entries).
+        tmp.FillElem(0);
+        r.FillElem(0);
+        for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+            if (!mvariables[iv]->IsActive())
+                continue;
+            int io = mvariables[iv]->GetOffset();
+            int in = mvariables[iv]->Get_ndof();
+            ChMatrixDynamic<double>& mB = precond_blocks[iv];
+            mB.Reset(in, in);
+            for (int col = 0; col < in; col++) {
+                tmp(io + col) = 1;
+                mvariables[iv]->MultiplyAndAdd(r, tmp, sysd.GetMassFactor());
+                for (int row = 0; row < in; row++) {
+                    mB(row, col) = r(io + row);
+                    r(io + row) = 0;
+                }
+                tmp(io + col) = 0;
+            }
+        }
+
+        // Map variable offsets back to positions in the variables list, to locate the
+        // block of each variable referenced by a ChKblock.
+        std::vector<int> block_of_offset(nv);
+        for (unsigned int iv = 0; iv < mvariables.size(); iv++)
+            if (mvariables[iv]->IsActive())
+                block_of_offset[mvariables[iv]->GetOffset()] = (int)iv;
+
+        // Add the diagonal sub-blocks of the stiffness blocks.
+        for (unsigned int is = 0; is < mstiffness.size(); is++) {
+            ChMatrix<double>* mK = mstiffness[is]->Get_K();
+            int kio = 0;
+            for (unsigned int ikv = 0; ikv < mstiffness[is]->GetNvars(); ikv++) {
+                ChVariables* mvar = mstiffness[is]->GetVariableN(ikv);
+                int in = mvar->Get_ndof();
+                if (mvar->IsActive()) {
+                    ChMatrixDynamic<double>& mB = precond_blocks[block_of_offset[mvar->GetOffset()]];
+                    for (int row = 0; row < in; row++)
+                        for (int col = 0; col < in; col++)
+                            mB(row, col) += (*mK)(kio + row, kio + col);
+                }
+                kio += in;
+            }
+        }
+
+        // Invert each block, via its LU decomposition (near-null diagonal entries get
+        // the same unit fallback as in the scalar preconditioner above, to avoid
+        // singular blocks).
+        for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+            if (!mvariables[iv]->IsActive())
+                continue;
+            ChMatrixDynamic<double>& mB = precond_blocks[iv];
+            int in = mB.GetRows();
+            for (int nel = 0; nel < in; nel++)
+                if (fabs(mB(nel, nel)) < 1e-9)
+                    mB(nel, nel) = 1.0;
+            ChMatrixDynamic<double> mLU(mB);
+            ChMatrixDynamic<double> me(in, 1);
+            ChMatrixDynamic<double> mcol(in, 1);
+            std::vector<int> pivarray(in);
+            double mdet;
+            ChLinearAlgebra::Decompose_LU(mLU, pivarray.data(), &mdet);
+            for (int col = 0; col < in; col++) {
+                me.FillElem(0);
+                me(col) = 1;
+                ChLinearAlgebra::Solve_LU(mLU, &me, &mcol, pivarray.data());
+                for (int row = 0; row < in; row++)
+                    mB(row, col) = mcol(row);
+            }
+        }
+    }
+
+    // Apply the preconditioner: v = M(v). In block-Jacobi mode, each variable slice is
+    // multiplied by its inverted block; the constraint slice always uses mDi scaling.
+    double block_prod[16];
+    auto ApplyPrecond = [&](ChWorkVector& v) {
+        if (!do_blockjacobi) {
+            v.MatrScale(mDi);
+            return;
+        }
+        for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+            if (!mvariables[iv]->IsActive())
+                continue;
+            int io = mvariables[iv]->GetOffset();
+            int in = mvariables[iv]->Get_ndof();
+            const ChMatrixDynamic<double>& mB = precond_blocks[iv];
+            if (in > 16) {
+                // oversized variable (uncommon): fall back to its diagonal scaling
+                for (int row = 0; row < in; row++)
+                    v(io + row) *= mDi(io + row);
+                continue;
+            }
+            for (int row = 0; row < in; row++) {
+                double tot = 0;
+                for (int col = 0; col < in; col++)
+                    tot += mB(row, col) * v(io + col);
+                block_prod[row] = tot;
+            }
+            for (int row = 0; row < in; row++)
+                v(io + row) = block_prod[row];
+        }
+        for (int ic = nv; ic < nx; ic++)
+            v(ic) *= mDi(ic);
+    };
+
     //
     // --- Vector initialization and book-keeping
     //
@@ -432,7 +556,7 @@ double ChSolverMINRES::Solve_SupportingStiffness(
 
     // r = M(r)								//						   ## Precond
     if (do_preconditioning)
-        r.MatrScale(mDi);
+        ApplyPrecond(r);
 
     // p = r
     p = r;
@@ -459,7 +583,7 @@ double ChSolverMINRES::Solve_SupportingStiffness(
         // MZp = M*Z*p
         MZp = Zp;
         if (do_preconditioning)
-            MZp.MatrScale(mDi);
+            ApplyPrecond(MZp);
 
         // alpha = (r' * Zr) / ((Zp)'*(MZp));
         double rZr = r.MatrDot(r, Zr);      // 1)  z'* Zr
@@ -531,6 +655,7 @@ void ChSolverMINRES::ArchiveOUT(ChArchiveOut& marchive) {
     marchive << CHNVP(feas_tolerance);
     marchive << CHNVP(max_fixedpoint_steps);
     marchive << CHNVP(diag_preconditioning);
+    marchive << CHNVP(blockjacobi_preconditioning);
     marchive << CHNVP(rel_tolerance);
 }
 
@@ -543,6 +668,7 @@ void ChSolverMINRES::ArchiveIN(ChArchiveIn& marchive) {
     marchive >> CHNVP(feas_tolerance);
     marchive >> CHNVP(max_fixedpoint_steps);
     marchive >> CHNVP(diag_preconditioning);
+    marchive >> CHNVP(blockjacobi_preconditioning);
     marchive >> CHNVP(rel_tolerance);
 }
 
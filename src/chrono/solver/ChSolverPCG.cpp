@@ -38,14 +38,16 @@ double ChSolverPCG::Solve(ChSystemDescriptor& sysd  ///< system description with
     if (verbose)
         GetLog() << "\n-----Projected CG, solving nc=" << nc << "unknowns \n";
 
-    ChMatrixDynamic<> ml(nc, 1);
-    ChMatrixDynamic<> mb(nc, 1);
-    ChMatrixDynamic<> mu(nc, 1);
-    ChMatrixDynamic<> mp(nc, 1);
-    ChMatrixDynamic<> mw(nc, 1);
-    ChMatrixDynamic<> mz(nc, 1);
-    ChMatrixDynamic<> mNp(nc, 1);
-    ChMatrixDynamic<> mtmp(nc, 1);
+    int stride = (nc + 3) & ~3;  // keep each slice 32-byte aligned
+    double* w = AcquireWorkspace(8 * (size_t)stride);
+    ChWorkVector ml(w + 0 * stride, nc);
+    ChWorkVector mb(w + 1 * stride, nc);
+    ChWorkVector mu(w + 2 * stride, nc);
+    ChWorkVector mp(w + 3 * stride, nc);
+    ChWorkVector mw(w + 4 * stride, nc);
+    ChWorkVector mz(w + 5 * stride, nc);
+    ChWorkVector mNp(w + 6 * stride, nc);
+    ChWorkVector mtmp(w + 7 * stride, nc);
 
     double graddiff = 0.00001;  // explorative search step for gradient
 
@@ -12,6 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
 #include "chrono/solver/ChSolverPMINRES.h"
 
 namespace chrono {
@@ -19,6 +23,243 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPMINRES)
 
+// -----------------------------------------------------------------------------
+// Vectorized kernels for the PMINRES vector updates.
+//
+// The per-iteration cost of PMINRES outside the Schur/system products is pure
+// streaming vector math (axpy, dots, element-wise scaling), so the temporaries
+// are carved out of one aligned allocation and updated with flat-array kernels:
+// AVX (with FMA where available) at the bottom, OpenMP chunking on top for
+// large problems. The AVX paths are entered only if the host CPU supports it,
+// same run-time dispatch as the dense kernels in ChMatrix.
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Below this size the OpenMP fork/join overhead outweighs the bandwidth gain.
+const int PMINRES_OMP_MIN_SIZE = 4000;
+// Chunk size (multiple of 4, so vector lanes never straddle a chunk boundary).
+const int PMINRES_OMP_CHUNK = 4096;
+
+// Run 'body(i0,i1)' over [0,n), chunked across threads when n is large.
+template <typename Body>
+inline void vec_for_chunks(int n, const Body& body) {
+    if (n > PMINRES_OMP_MIN_SIZE) {
+        int nchunks = (n + PMINRES_OMP_CHUNK - 1) / PMINRES_OMP_CHUNK;
+#pragma omp parallel for schedule(static)
+        for (int c = 0; c < nchunks; c++)
+            body(c * PMINRES_OMP_CHUNK, std::min(n, (c + 1) * PMINRES_OMP_CHUNK));
+    } else {
+        body(0, n);
+    }
+}
+
+// x'*y over [i0,i1)
+inline double vec_dot_range(const double* x, const double* y, int i0, int i1) {
+    double acc = 0;
+#ifdef CHRONO_HAS_AVX
+    if (ChCpuHasAVX()) {
+        int iv = i0 + (((i1 - i0) >> 2) << 2);
+        __m256d sum = _mm256_setzero_pd();
+        for (int i = i0; i < iv; i += 4) {
+            __m256d vx = _mm256_loadu_pd(x + i);
+            __m256d vy = _mm256_loadu_pd(y + i);
+#ifdef CHRONO_HAS_FMA
+            sum = _mm256_fmadd_pd(vx, vy, sum);
+#else
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(vx, vy));
+#endif
+        }
+        sum = _mm256_hadd_pd(sum, sum);
+        acc = ((double*)&sum)[0] + ((double*)&sum)[2];
+        for (int i = iv; i < i1; i++)
+            acc += x[i] * y[i];
+        return acc;
+    }
+#endif
+    for (int i = i0; i < i1; i++)
+        acc += x[i] * y[i];
+    return acc;
+}
+
+// x'*(a-b) over [i0,i1)
+inline double vec_dot_diff_range(const double* x, const double* a, const double* b, int i0, int i1) {
+    double acc = 0;
+#ifdef CHRONO_HAS_AVX
+    if (ChCpuHasAVX()) {
+        int iv = i0 + (((i1 - i0) >> 2) << 2);
+        __m256d sum = _mm256_setzero_pd();
+        for (int i = i0; i < iv; i += 4) {
+            __m256d vx = _mm256_loadu_pd(x + i);
+            __m256d vd = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+#ifdef CHRONO_HAS_FMA
+            sum = _mm256_fmadd_pd(vx, vd, sum);
+#else
+            sum = _mm256_add_pd(sum, _mm256_mul_pd(vx, vd));
+#endif
+        }
+        sum = _mm256_hadd_pd(sum, sum);
+        acc = ((double*)&sum)[0] + ((double*)&sum)[2];
+        for (int i = iv; i < i1; i++)
+            acc += x[i] * (a[i] - b[i]);
+        return acc;
+    }
+#endif
+    for (int i = i0; i < i1; i++)
+        acc += x[i] * (a[i] - b[i]);
+    return acc;
+}
+
+// y += a*x over [i0,i1)
+inline void vec_axpy_range(double* y, double a, const double* x, int i0, int i1) {
+#ifdef CHRONO_HAS_AVX
+    if (ChCpuHasAVX()) {
+        int iv = i0 + (((i1 - i0) >> 2) << 2);
+        __m256d va = _mm256_set1_pd(a);
+        for (int i = i0; i < iv; i += 4) {
+            __m256d vy = _mm256_loadu_pd(y + i);
+#ifdef CHRONO_HAS_FMA
+            vy = _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i), vy);
+#else
+            vy = _mm256_add_pd(vy, _mm256_mul_pd(va, _mm256_loadu_pd(x + i)));
+#endif
+            _mm256_storeu_pd(y + i, vy);
+        }
+        for (int i = iv; i < i1; i++)
+            y[i] += a * x[i];
+        return;
+    }
+#endif
+    for (int i = i0; i < i1; i++)
+        y[i] += a * x[i];
+}
+
+// y = x + b*y over [i0,i1)
+inline void vec_xpby_range(double* y, const double* x, double b, int i0, int i1) {
+#ifdef CHRONO_HAS_AVX
+    if (ChCpuHasAVX()) {
+        int iv = i0 + (((i1 - i0) >> 2) << 2);
+        __m256d vb = _mm256_set1_pd(b);
+        for (int i = i0; i < iv; i += 4) {
+            __m256d vx = _mm256_loadu_pd(x + i);
+#ifdef CHRONO_HAS_FMA
+            vx = _mm256_fmadd_pd(vb, _mm256_loadu_pd(y + i), vx);
+#else
+            vx = _mm256_add_pd(vx, _mm256_mul_pd(vb, _mm256_loadu_pd(y + i)));
+#endif
+            _mm256_storeu_pd(y + i, vx);
+        }
+        for (int i = iv; i < i1; i++)
+            y[i] = x[i] + b * y[i];
+        return;
+    }
+#endif
+    for (int i = i0; i < i1; i++)
+        y[i] = x[i] + b * y[i];
+}
+
+// y = x - y over [i0,i1)
+inline void vec_rsub_range(double* y, const double* x, int i0, int i1) {
+#ifdef CHRONO_HAS_AVX
+    if (ChCpuHasAVX()) {
+        int iv = i0 + (((i1 - i0) >> 2) << 2);
+        for (int i = i0; i < iv; i += 4)
+            _mm256_storeu_pd(y + i, _mm256_sub_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+        for (int i = iv; i < i1; i++)
+            y[i] = x[i] - y[i];
+        return;
+    }
+#endif
+    for (int i = i0; i < i1; i++)
+        y[i] = x[i] - y[i];
+}
+
+// y = (y - x)*s over [i0,i1)
+inline void vec_sub_scale_range(double* y, const double* x, double s, int i0, int i1) {
+#ifdef CHRONO_HAS_AVX
+    if (ChCpuHasAVX()) {
+        int iv = i0 + (((i1 - i0) >> 2) << 2);
+        __m256d vs = _mm256_set1_pd(s);
+        for (int i = i0; i < iv; i += 4)
+            _mm256_storeu_pd(
+                y + i, _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i)), vs));
+        for (int i = iv; i < i1; i++)
+            y[i] = (y[i] - x[i]) * s;
+        return;
+    }
+#endif
+    for (int i = i0; i < i1; i++)
+        y[i] = (y[i] - x[i]) * s;
+}
+
+// z = x.*d over [i0,i1)
+inline void vec_hadamard_range(double* z, const double* x, const double* d, int i0, int i1) {
+#ifdef CHRONO_HAS_AVX
+    if (ChCpuHasAVX()) {
+        int iv = i0 + (((i1 - i0) >> 2) << 2);
+        for (int i = i0; i < iv; i += 4)
+            _mm256_storeu_pd(z + i, _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(d + i)));
+        for (int i = iv; i < i1; i++)
+            z[i] = x[i] * d[i];
+        return;
+    }
+#endif
+    for (int i = i0; i < i1; i++)
+        z[i] = x[i] * d[i];
+}
+
+// OpenMP-on-top wrappers
+
+inline double vec_dot(const double* x, const double* y, int n) {
+    if (n > PMINRES_OMP_MIN_SIZE) {
+        double acc = 0;
+        int nchunks = (n + PMINRES_OMP_CHUNK - 1) / PMINRES_OMP_CHUNK;
+#pragma omp parallel for reduction(+ : acc) schedule(static)
+        for (int c = 0; c < nchunks; c++)
+            acc += vec_dot_range(x, y, c * PMINRES_OMP_CHUNK, std::min(n, (c + 1) * PMINRES_OMP_CHUNK));
+        return acc;
+    }
+    return vec_dot_range(x, y, 0, n);
+}
+
+inline double vec_dot_diff(const double* x, const double* a, const double* b, int n) {
+    if (n > PMINRES_OMP_MIN_SIZE) {
+        double acc = 0;
+        int nchunks = (n + PMINRES_OMP_CHUNK - 1) / PMINRES_OMP_CHUNK;
+#pragma omp parallel for reduction(+ : acc) schedule(static)
+        for (int c = 0; c < nchunks; c++)
+            acc += vec_dot_diff_range(x, a, b, c * PMINRES_OMP_CHUNK, std::min(n, (c + 1) * PMINRES_OMP_CHUNK));
+        return acc;
+    }
+    return vec_dot_diff_range(x, a, b, 0, n);
+}
+
+inline void vec_axpy(double* y, double a, const double* x, int n) {
+    vec_for_chunks(n, [&](int i0, int i1) { vec_axpy_range(y, a, x, i0, i1); });
+}
+
+inline void vec_xpby(double* y, const double* x, double b, int n) {
+    vec_for_chunks(n, [&](int i0, int i1) { vec_xpby_range(y, x, b, i0, i1); });
+}
+
+inline void vec_rsub(double* y, const double* x, int n) {
+    vec_for_chunks(n, [&](int i0, int i1) { vec_rsub_range(y, x, i0, i1); });
+}
+
+inline void vec_sub_scale(double* y, const double* x, double s, int n) {
+    vec_for_chunks(n, [&](int i0, int i1) { vec_sub_scale_range(y, x, s, i0, i1); });
+}
+
+inline void vec_hadamard(double* z, const double* x, const double* d, int n) {
+    vec_for_chunks(n, [&](int i0, int i1) { vec_hadamard_range(z, x, d, i0, i1); });
+}
+
+inline void vec_copy(double* dst, const double* src, int n) {
+    memcpy(dst, src, (size_t)n * sizeof(double));
+}
+
+}  // end anonymous namespace
+
 double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
 ) {
     bool do_preconditioning = this->diag_preconditioning;
@@ -37,18 +278,25 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description
     if (verbose)
         GetLog() << "\n-----Projected MINRES, solving nc=" << nc << "unknowns \n";
 
-    ChMatrixDynamic<> ml(nc, 1);
-    ChMatrixDynamic<> mb(nc, 1);
-    ChMatrixDynamic<> mp(nc, 1);
-    ChMatrixDynamic<> mr(nc, 1);
-    ChMatrixDynamic<> mz(nc, 1);
-    ChMatrixDynamic<> mz_old(nc, 1);
-    ChMatrixDynamic<> mNp(nc, 1);
-    ChMatrixDynamic<> mMNp(nc, 1);
-    ChMatrixDynamic<> mNMr(nc, 1);
-    ChMatrixDynamic<> mNMr_old(nc, 1);
-    ChMatrixDynamic<> mtmp(nc, 1);
-    ChMatrixDynamic<> mDi(nc, 1);
+    // Workspace: all nc-sized temporaries carved out of one aligned allocation;
+    // slices are padded to a multiple of four doubles so that each vector starts
+    // on a 32-byte boundary for the SIMD kernels.
+    int stride = (nc + 3) & ~3;
+    double* pl = AcquireWorkspace(11 * (size_t)stride);
+    double* pb = pl + stride;
+    double* pp = pb + stride;
+    double* pr = pp + stride;
+    double* pz = pr + stride;
+    double* pz_old = pz + stride;
+    double* pNp = pz_old + stride;
+    double* pMNp = pNp + stride;
+    double* pNMr = pMNp + stride;
+    double* pNMr_old = pNMr + stride;
+    double* pDi = pNMr_old + stride;
+
+    ChWorkVector ml(pl, nc);
+    ChWorkVector mb(pb, nc);
+    ChWorkVector mtmp(pDi, nc);  // mDi slice doubles as scratch until the preconditioner is built
 
     this->tot_iterations = 0;
     double maxviolation = 0.;
@@ -76,14 +324,6 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description
         }
     }
 
-    // The vector with the inverse of diagonal of the N matrix
-    int d_i = 0;
-    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
-        if (mconstraints[ic]->IsActive()) {
-            mDi(d_i, 0) = 1.0 / mconstraints[ic]->Get_g_i();
-            ++d_i;
-        }
-
     // ***TO DO*** move the following thirty lines in a short function ChSystemDescriptor::ShurBvectorCompute() ?
 
     // Compute the b_shur vector in the Shur complement equation N*l = b_shur
@@ -102,13 +342,21 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description
     int s_i = 0;
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         if (mconstraints[ic]->IsActive()) {
-            mb(s_i, 0) = -mconstraints[ic]->Compute_Cq_q();
+            pb[s_i] = -mconstraints[ic]->Compute_Cq_q();
             ++s_i;
         }
 
     // ..and finally do   b_shur = b_shur - c
     sysd.BuildBiVector(mtmp);  // b_i   =   -c   = phi/h
-    mb.MatrDec(mtmp);
+    vec_axpy(pb, -1.0, pDi, nc);
+
+    // The vector with the inverse of diagonal of the N matrix
+    int d_i = 0;
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+        if (mconstraints[ic]->IsActive()) {
+            pDi[d_i] = 1.0 / mconstraints[ic]->Get_g_i();
+            ++d_i;
+        }
 
     // Optimization: backup the  q  sparse data computed above,
     // because   (M^-1)*k   will be needed at the end when computing primals.
@@ -122,54 +370,62 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description
     // Initialize lambdas
     if (warm_start)
         sysd.FromConstraintsToVector(ml);
-    else
-        ml.FillElem(0);
+    // (else: the workspace is already zero-filled)
 
     // Initial projection of ml   ***TO DO***?
     // ...
 
     // r = b - N*l;
-    sysd.ShurComplementProduct(
-        mr, &ml);    // 1)  r = N*l ...        #### MATR.MULTIPLICATION!!!### can be avoided if no warm starting!
-    mr.MatrNeg();    // 2)  r =-N*l
-    mr.MatrInc(mb);  // 3)  r =-N*l+b
+    {
+        ChWorkVector mr(pr, nc);
+        sysd.ShurComplementProduct(
+            mr, &ml);  // 1)  r = N*l ...        #### MATR.MULTIPLICATION!!!### can be avoided if no warm starting!
+    }
+    vec_rsub(pr, pb, nc);  // 2-3)  r = b - N*l
 
     // r = (project_orthogonal(l+diff*r, fric) - l)/diff;
-    mr.MatrScale(this->grad_diffstep);
-    mr.MatrInc(ml);
-    sysd.ConstraintsProject(mr);  // p = P(l+diff*p) ...
-    mr.MatrDec(ml);
-    mr.MatrScale(1.0 / this->grad_diffstep);  // p = (P(l+diff*p)-l)/diff
+    vec_xpby(pr, pl, this->grad_diffstep, nc);  // r = l + diff*r
+    {
+        ChWorkVector mr(pr, nc);
+        sysd.ConstraintsProject(mr);  // r = P(l+diff*r) ...
+    }
+    vec_sub_scale(pr, pl, 1.0 / this->grad_diffstep, nc);  // r = (P(l+diff*r)-l)/diff
 
     // p = Mi * r;
-    mp = mr;
     if (do_preconditioning)
-        mp.MatrScale(mDi);
+        vec_hadamard(pp, pr, pDi, nc);
+    else
+        vec_copy(pp, pr, nc);
 
     // z = Mi * r;
-    mz = mp;
+    vec_copy(pz, pp, nc);
 
     // NMr = N*M*r = N*z
-    sysd.ShurComplementProduct(mNMr, &mz);  // NMr = N*z    #### MATR.MULTIPLICATION!!!###
+    {
+        ChWorkVector mz(pz, nc), mNMr(pNMr, nc);
+        sysd.ShurComplementProduct(mNMr, &mz);  // NMr = N*z    #### MATR.MULTIPLICATION!!!###
+    }
 
     // Np = N*p
-    sysd.ShurComplementProduct(mNp, &mp);  // Np = N*p    #### MATR.MULTIPLICATION!!!###
+    {
+        ChWorkVector mp(pp, nc), mNp(pNp, nc);
+        sysd.ShurComplementProduct(mNp, &mp);  // Np = N*p    #### MATR.MULTIPLICATION!!!###
+    }
 
     //
     // THE LOOP
     //
 
-    std::vector<double> f_hist;
-
     for (int iter = 0; iter < max_iterations; iter++) {
         // MNp = Mi*Np; % = Mi*N*p                  %% -- Precond
-        mMNp = mNp;
         if (do_preconditioning)
-            mMNp.MatrScale(mDi);
+            vec_hadamard(pMNp, pNp, pDi, nc);
+        else
+            vec_copy(pMNp, pNp, nc);
 
         // alpha = (z'*(NMr))/((MNp)'*(Np));
-        double zNMr = mz.MatrDot(mz, mNMr);      // 1)  zMNr = z'* NMr
-        double MNpNp = mMNp.MatrDot(mMNp, mNp);  // 2)  MNpNp = ((MNp)'*(Np))
+        double zNMr = vec_dot(pz, pNMr, nc);     // 1)  zMNr = z'* NMr
+        double MNpNp = vec_dot(pMNp, pNp, nc);   // 2)  MNpNp = ((MNp)'*(Np))
 
         if (fabs(MNpNp) < 10e-30) {
             if (verbose)
@@ -180,55 +436,62 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description
         double alpha = zNMr / MNpNp;  // 3)  alpha = (z'*(NMr))/((MNp)'*(Np));
 
         // l = l + alpha * p;
-        mtmp = mp;
-        mtmp.MatrScale(alpha);
-        ml.MatrInc(mtmp);
+        vec_axpy(pl, alpha, pp, nc);
 
-        double maxdeltalambda = mtmp.NormTwo();  //***better NormInf() for speed reasons?
+        double maxdeltalambda = fabs(alpha) * sqrt(vec_dot(pp, pp, nc));  //***better NormInf() for speed reasons?
 
         // l = Proj(l)
-        sysd.ConstraintsProject(ml);  // l = P(l)
+        {
+            ChWorkVector mlv(pl, nc);
+            sysd.ConstraintsProject(mlv);  // l = P(l)
+        }
 
         // r = b - N*l;
-        sysd.ShurComplementProduct(mr, &ml);  // 1)  r = N*l ...        #### MATR.MULTIPLICATION!!!###
-        mr.MatrNeg();                         // 2)  r =-N*l
-        mr.MatrInc(mb);                       // 3)  r =-N*l+b
+        {
+            ChWorkVector mlv(pl, nc), mr(pr, nc);
+            sysd.ShurComplementProduct(mr, &mlv);  // 1)  r = N*l ...        #### MATR.MULTIPLICATION!!!###
+        }
+        vec_rsub(pr, pb, nc);  // 2-3)  r = b - N*l
 
         // r = (project_orthogonal(l+diff*r, fric) - l)/diff;
-        mr.MatrScale(this->grad_diffstep);
-        mr.MatrInc(ml);
-        sysd.ConstraintsProject(mr);  // r = P(l+diff*r) ...
-        mr.MatrDec(ml);
-        mr.MatrScale(1.0 / this->grad_diffstep);  // r = (P(l+diff*r)-l)/diff
+        vec_xpby(pr, pl, this->grad_diffstep, nc);  // r = l + diff*r
+        {
+            ChWorkVector mr(pr, nc);
+            sysd.ConstraintsProject(mr);  // r = P(l+diff*r) ...
+        }
+        vec_sub_scale(pr, pl, 1.0 / this->grad_diffstep, nc);  // r = (P(l+diff*r)-l)/diff
 
         this->tot_iterations++;
 
         // Terminate iteration when the projected r is small, if (norm(r,2) <= max(rel_tol_b,abs_tol))
-        double r_proj_resid = mr.NormTwo();
+        double r_proj_resid = sqrt(vec_dot(pr, pr, nc));
         if (r_proj_resid < ChMax(rel_tol_b, abs_tol)) {
             if (verbose)
                 GetLog() << "Iter=" << iter << " P(r)-converged!  |P(r)|=" << r_proj_resid << "\n";
             break;
         }
 
-        // z_old = z;
-        mz_old = mz;
+        // z_old = z;  (pointer swap: the old buffer is overwritten below)
+        std::swap(pz, pz_old);
 
         // z = Mi*r;                                 %% -- Precond
-        mz = mr;
         if (do_preconditioning)
-            mz.MatrScale(mDi);
+            vec_hadamard(pz, pr, pDi, nc);
+        else
+            vec_copy(pz, pr, nc);
 
-        // NMr_old = NMr;
-        mNMr_old = mNMr;
+        // NMr_old = NMr;  (pointer swap, as above)
+        std::swap(pNMr, pNMr_old);
 
         // NMr = N*z;
-        sysd.ShurComplementProduct(mNMr, &mz);  // NMr = N*z;    #### MATR.MULTIPLICATION!!!###
+        {
+            ChWorkVector mz(pz, nc), mNMr(pNMr, nc);
+            sysd.ShurComplementProduct(mNMr, &mz);  // NMr = N*z;    #### MATR.MULTIPLICATION!!!###
+        }
 
         // beta = z'*(NMr-NMr_old)/(z_old'*(NMr_old));
-        mtmp.MatrSub(mNMr, mNMr_old);
-        double numerator = mz.MatrDot(mz, mtmp);
-        double denominator = mz_old.MatrDot(mz_old, mNMr_old);
+        double numerator = vec_dot_diff(pz, pNMr, pNMr_old, nc);
+        double denominator = vec_dot(pz_old, pNMr_old, nc);
 
         double beta = numerator / denominator;
 
@@ -243,14 +506,10 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description
         // beta = ChMax(0.0, beta); //***NOT NEEDED!!! (may be negative in not positive def.matrices!)
 
         // p = z + beta * p;
-        mtmp = mp;
-        mtmp.MatrScale(beta);
-        mp = mz;
-        mp.MatrInc(mtmp);
+        vec_xpby(pp, pz, beta, nc);
 
         // Np = NMr + beta*Np;   // Optimization!! avoid matr x vect!!! (if no 'p' projection has been done)
-        mNp.MatrScale(beta);
-        mNp.MatrInc(mNMr);
+        vec_xpby(pNp, pNMr, beta, nc);
 
         // ---------------------------------------------
         // METRICS - convergence, plots, etc
@@ -306,20 +565,24 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
         GetLog() << "\n-----Projected MINRES -supporting stiffness-, n.vars nx=" << nx
                  << "  max.iters=" << max_iterations << "\n";
 
-    ChMatrixDynamic<> mx(nx, 1);
-    ChMatrixDynamic<> md(nx, 1);
-    ChMatrixDynamic<> mp(nx, 1);
-    ChMatrixDynamic<> mr(nx, 1);
-    ChMatrixDynamic<> mz(nx, 1);
-    ChMatrixDynamic<> mz_old(nx, 1);
-    ChMatrixDynamic<> mZp(nx, 1);
-    ChMatrixDynamic<> mMZp(nx, 1);
-    ChMatrixDynamic<> mZMr(nx, 1);
-    ChMatrixDynamic<> mZMr_old(nx, 1);
-    ChMatrixDynamic<> mtmp(nx, 1);
-    ChMatrixDynamic<> mDi(nx, 1);
+    // Workspace: same aligned single-allocation layout as in Solve().
+    int stride = (nx + 3) & ~3;
+    double* px = AcquireWorkspace(11 * (size_t)stride);
+    double* pd = px + stride;
+    double* pp = pd + stride;
+    double* pr = pp + stride;
+    double* pz = pr + stride;
+    double* pz_old = pz + stride;
+    double* pZp = pz_old + stride;
+    double* pMZp = pZp + stride;
+    double* pZMr = pMZp + stride;
+    double* pZMr_old = pZMr + stride;
+    double* pDi = pZMr_old + stride;
+
+    ChWorkVector mx(px, nx);
+    ChWorkVector md(pd, nx);
+    ChWorkVector mDi(pDi, nx);
 
-    this->tot_iterations = 0;
     double maxviolation = 0.;
 
     //
@@ -333,11 +596,11 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
     // From now, mDi contains the inverse of the diagonal of Z.
     // Note, for constraints, the diagonal is 0, so set inverse of D as 1 assuming
     // a constraint preconditioning and assuming the dot product of jacobians is already about 1.
-    for (int nel = 0; nel < mDi.GetRows(); nel++) {
-        if (fabs(mDi(nel)) > 1e-9)
-            mDi(nel) = 1.0 / mDi(nel);
+    for (int nel = 0; nel < nx; nel++) {
+        if (fabs(pDi[nel]) > 1e-9)
+            pDi[nel] = 1.0 / pDi[nel];
         else
-            mDi(nel) = 1.0;
+            pDi[nel] = 1.0;
     }
 
     //
@@ -348,8 +611,7 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
     // x with current values of q and l in variables and constraints)
     if (warm_start)
         sysd.FromUnknownsToVector(mx);
-    else
-        mx.FillElem(0);
+    // (else: the workspace is already zero-filled)
 
     // Initialize the d vector filling it with {f, -b}
     sysd.BuildDiVector(md);
@@ -366,10 +628,12 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
     sysd.UnknownsProject(mx);
 
     // r = d - Z*x;
-    sysd.SystemProduct(
-        mr, &mx);    // 1)  r = Z*x ...        #### MATR.MULTIPLICATION!!!### can be avoided if no warm starting!
-    mr.MatrNeg();    // 2)  r =-Z*x
-    mr.MatrInc(md);  // 3)  r =-Z*x+d
+    {
+        ChWorkVector mr(pr, nx);
+        sysd.SystemProduct(
+            mr, &mx);  // 1)  r = Z*x ...        #### MATR.MULTIPLICATION!!!### can be avoided if no warm starting!
+    }
+    vec_rsub(pr, pd, nx);  // 2-3)  r = d - Z*x
                      /*
                          // r = (project_orthogonal(x+diff*r, fric) - x)/diff;
                          mr.MatrScale(this->grad_diffstep);
@@ -379,18 +643,25 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
                          mr.MatrScale(1.0/this->grad_diffstep);		// p = (P(x+diff*p)-x)/diff
                      */
     // p = Mi * r;
-    mp = mr;
     if (do_preconditioning)
-        mp.MatrScale(mDi);
+        vec_hadamard(pp, pr, pDi, nx);
+    else
+        vec_copy(pp, pr, nx);
 
     // z = Mi * r;
-    mz = mp;
+    vec_copy(pz, pp, nx);
 
     // ZMr = Z*M*r = Z*z
-    sysd.SystemProduct(mZMr, &mz);  // ZMr = Z*z    #### MATR.MULTIPLICATION!!!###
+    {
+        ChWorkVector mz(pz, nx), mZMr(pZMr, nx);
+        sysd.SystemProduct(mZMr, &mz);  // ZMr = Z*z    #### MATR.MULTIPLICATION!!!###
+    }
 
     // Zp = Z*p
-    sysd.SystemProduct(mZp, &mp);  // Zp = Z*p    #### MATR.MULTIPLICATION!!!###
+    {
+        ChWorkVector mp(pp, nx), mZp(pZp, nx);
+        sysd.SystemProduct(mZp, &mp);  // Zp = Z*p    #### MATR.MULTIPLICATION!!!###
+    }
 
     //
     // THE LOOP
@@ -398,13 +669,14 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
 
     for (int iter = 0; iter < max_iterations; iter++) {
         // MZp = Mi*Zp; % = Mi*Z*p                  %% -- Precond
-        mMZp = mZp;
         if (do_preconditioning)
-            mMZp.MatrScale(mDi);
+            vec_hadamard(pMZp, pZp, pDi, nx);
+        else
+            vec_copy(pMZp, pZp, nx);
 
         // alpha = (z'*(ZMr))/((MZp)'*(Zp));
-        double zZMr = mz.MatrDot(mz, mZMr);      // 1)  zZMr = z'* ZMr
-        double MZpZp = mMZp.MatrDot(mMZp, mZp);  // 2)  MZpZp = ((MZp)'*(Zp))
+        double zZMr = vec_dot(pz, pZMr, nx);    // 1)  zZMr = z'* ZMr
+        double MZpZp = vec_dot(pMZp, pZp, nx);  // 2)  MZpZp = ((MZp)'*(Zp))
 
         // Robustness improver: case of division by zero
         if (fabs(MZpZp) < 10e-30) {
@@ -429,19 +701,19 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
                 GetLog() << "Rayleigh alpha < 0: " << alpha << "    iter=" << iter << "\n";
 
         // x = x + alpha * p;
-        mtmp = mp;
-        mtmp.MatrScale(alpha);
-        mx.MatrInc(mtmp);
+        vec_axpy(px, alpha, pp, nx);
 
-        double maxdeltaunknowns = mtmp.NormTwo();  //***better NormInf() for speed reasons?
+        double maxdeltaunknowns = fabs(alpha) * sqrt(vec_dot(pp, pp, nx));  //***better NormInf() for speed reasons?
 
         // x = Proj(x)
         sysd.UnknownsProject(mx);  // x = P(x)
 
         // r = d - Z*x;
-        sysd.SystemProduct(mr, &mx);  // 1)  r = Z*x ...        #### MATR.MULTIPLICATION!!!###
-        mr.MatrNeg();                 // 2)  r =-Z*x
-        mr.MatrInc(md);               // 3)  r =-Z*x+d
+        {
+            ChWorkVector mr(pr, nx);
+            sysd.SystemProduct(mr, &mx);  // 1)  r = Z*x ...        #### MATR.MULTIPLICATION!!!###
+        }
+        vec_rsub(pr, pd, nx);  // 2-3)  r = d - Z*x
                                       /*
                                               // r = (project_orthogonal(x+diff*r, fric) - x)/diff;
                                               mr.MatrScale(this->grad_diffstep);
@@ -453,32 +725,35 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
         this->tot_iterations++;
 
         // Terminate iteration when the projected r is small, if (norm(r,2) <= max(rel_tol_d,abs_tol))
-        double r_proj_resid = mr.NormTwo();
+        double r_proj_resid = sqrt(vec_dot(pr, pr, nx));
         if (r_proj_resid < ChMax(rel_tol_d, abs_tol)) {
             if (verbose)
                 GetLog() << "P(r)-converged! iter=" << iter << " |P(r)|=" << r_proj_resid << "\n";
             break;
         }
 
-        // z_old = z;
-        mz_old = mz;
+        // z_old = z;  (pointer swap: the old buffer is overwritten below)
+        std::swap(pz, pz_old);
 
         // z = Mi*r;                                 %% -- Precond
-        mz = mr;
         if (do_preconditioning)
-            mz.MatrScale(mDi);
+            vec_hadamard(pz, pr, pDi, nx);
+        else
+            vec_copy(pz, pr, nx);
 
-        // ZMr_old = ZMr;
-        mZMr_old = mZMr;
+        // ZMr_old = ZMr;  (pointer swap, as above)
+        std::swap(pZMr, pZMr_old);
 
         // ZMr = Z*z;
-        sysd.SystemProduct(mZMr, &mz);  // ZMr = Z*z;    #### MATR.MULTIPLICATION!!!###
+        {
+            ChWorkVector mz(pz, nx), mZMr(pZMr, nx);
+            sysd.SystemProduct(mZMr, &mz);  // ZMr = Z*z;    #### MATR.MULTIPLICATION!!!###
+        }
 
         // Ribiere quotient (for flexible preconditioning)
         // beta = z'*(ZMr-ZMr_old)/(z_old'*(ZMr_old));
-        mtmp.MatrSub(mZMr, mZMr_old);
-        double numerator = mz.MatrDot(mz, mtmp);
-        double denominator = mz_old.MatrDot(mz_old, mZMr_old);
+        double numerator = vec_dot_diff(pz, pZMr, pZMr_old, nx);
+        double denominator = vec_dot(pz_old, pZMr_old, nx);
         // Rayleigh quotient (original Minres)
         // double numerator   = mr.MatrDot(mz,mZMr);			// 1)  r'* Z *r
         // double denominator = mr.MatrDot(mz_old,mZMr_old);	// 2)  r_old'* Z *r_old
@@ -493,14 +768,10 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
         }
 
         // p = z + beta * p;
-        mtmp = mp;
-        mtmp.MatrScale(beta);
-        mp = mz;
-        mp.MatrInc(mtmp);
+        vec_xpby(pp, pz, beta, nx);
 
         // Zp = ZMr + beta*Zp;   // Optimization!! avoid matr x vect!!! (if no 'p' projection has been done)
-        mZp.MatrScale(beta);
-        mZp.MatrInc(mZMr);
+        vec_xpby(pZp, pZMr, beta, nx);
 
         // ---------------------------------------------
         // METRICS - convergence, plots, etc
@@ -515,7 +786,7 @@ double ChSolverPMINRES::Solve_SupportingStiffness(
     sysd.FromVectorToUnknowns(mx);
 
     if (verbose)
-        GetLog() << "residual: " << mr.NormTwo() << " ---\n";
+        GetLog() << "residual: " << sqrt(vec_dot(pr, pr, nx)) << " ---\n";
 
     return maxviolation;
 }
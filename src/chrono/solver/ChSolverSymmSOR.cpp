@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
+#include "chrono/core/ChCSMatrix.h"
 #include "chrono/solver/ChSolverSymmSOR.h"
 
 namespace chrono {
@@ -19,9 +22,146 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverSymmSOR)
 
+void ChSolverSymmSOR::UpdateOrdering(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+
+    // Rebuild only when the constraint set changed, using the descriptor structure
+    // revision as a fast pre-check before comparing the constraint lists.
+    if (order_revision == sysd.GetStructureRevision() && order_signature == mconstraints)
+        return;
+    order_revision = sysd.GetStructureRevision();
+    order_signature = mconstraints;
+    ordered_constraints.clear();
+
+    const int nConstr = (int)mconstraints.size();
+    if (nConstr < 3)
+        return;
+
+    // Partition the constraint list into reorderable groups: a triplet of consecutive
+    // friction constraints (the n,u,v rows of one contact) moves as a unit, everything
+    // else is a group of one. If the friction rows are not laid out in contiguous
+    // triplets (the sweep could not handle that either), keep the insertion order.
+    std::vector<std::pair<int, int>> groups;  // (first constraint index, size)
+    groups.reserve(nConstr);
+    for (int ic = 0; ic < nConstr;) {
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            if (ic + 2 >= nConstr || mconstraints[ic + 1]->GetMode() != CONSTRAINT_FRIC ||
+                mconstraints[ic + 2]->GetMode() != CONSTRAINT_FRIC)
+                return;
+            groups.push_back(std::make_pair(ic, 3));
+            ic += 3;
+        } else {
+            groups.push_back(std::make_pair(ic, 1));
+            ic++;
+        }
+    }
+    const int nGroups = (int)groups.size();
+
+    // Map each scalar unknown back to the owning ChVariables object, so jacobian
+    // columns translate into graph edges between groups (same as ComputeIslands()).
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+    int mn_q = sysd.CountActiveVariables();
+    std::vector<int> dof_to_var(mn_q);
+    for (size_t iv = 0; iv < mvariables.size(); iv++) {
+        if (mvariables[iv]->IsActive()) {
+            for (int k = 0; k < mvariables[iv]->Get_ndof(); k++)
+                dof_to_var[mvariables[iv]->GetOffset() + k] = (int)iv;
+        }
+    }
+
+    // Record the structural nonzeros of each constraint row (row index = position
+    // in the constraint list, so inactive constraints simply get empty rows).
+    ChSparsityPatternLearner Cq_pattern(nConstr, mn_q);
+    for (int ic = 0; ic < nConstr; ic++) {
+        if (mconstraints[ic]->IsActive())
+            mconstraints[ic]->Build_Cq(Cq_pattern, ic);
+    }
+    auto& Cq_rows = Cq_pattern.GetSparsityPattern();
+
+    // Incidence between groups and the variable objects they act on. Group
+    // adjacency is traversed through this incidence (two groups are neighbors iff
+    // they share a variable), avoiding explicit adjacency lists which grow
+    // quadratically on bodies with many contacts.
+    std::vector<std::vector<int>> group_vars(nGroups);
+    std::vector<std::vector<int>> var_groups(mvariables.size());
+    for (int ig = 0; ig < nGroups; ig++) {
+        std::vector<int>& vars = group_vars[ig];
+        for (int k = 0; k < groups[ig].second; k++) {
+            auto& row = Cq_rows[groups[ig].first + k];
+            for (auto col_iter = row.begin(); col_iter != row.end(); ++col_iter)
+                vars.push_back(dof_to_var[*col_iter]);
+        }
+        std::sort(vars.begin(), vars.end());
+        vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+        for (size_t k = 0; k < vars.size(); k++)
+            var_groups[vars[k]].push_back(ig);
+    }
+
+    // Approximate degree of each group (multiplicity of shared variables included);
+    // only used to rank BFS seeds and neighbors, so exactness does not matter.
+    std::vector<int> degree(nGroups);
+    for (int ig = 0; ig < nGroups; ig++) {
+        int deg = 0;
+        for (size_t k = 0; k < group_vars[ig].size(); k++)
+            deg += (int)var_groups[group_vars[ig][k]].size() - 1;
+        degree[ig] = deg;
+    }
+
+    // Reverse Cuthill-McKee over the group graph: breadth-first from minimum-degree
+    // seeds, neighbors visited by increasing degree, final order reversed. Keeps
+    // groups acting on the same bodies close in the sweep.
+    std::vector<int> seeds(nGroups);
+    for (int ig = 0; ig < nGroups; ig++)
+        seeds[ig] = ig;
+    std::sort(seeds.begin(), seeds.end(), [&degree](int a, int b) { return degree[a] < degree[b]; });
+
+    std::vector<char> visited(nGroups, 0);
+    std::vector<int> order;
+    order.reserve(nGroups);
+    std::vector<int> frontier;
+    for (size_t is = 0; is < seeds.size(); is++) {
+        if (visited[seeds[is]])
+            continue;
+        visited[seeds[is]] = 1;
+        size_t head = order.size();
+        order.push_back(seeds[is]);
+        while (head < order.size()) {
+            int ig = order[head++];
+            frontier.clear();
+            for (size_t k = 0; k < group_vars[ig].size(); k++) {
+                std::vector<int>& adjacent = var_groups[group_vars[ig][k]];
+                for (size_t j = 0; j < adjacent.size(); j++) {
+                    if (!visited[adjacent[j]]) {
+                        visited[adjacent[j]] = 1;
+                        frontier.push_back(adjacent[j]);
+                    }
+                }
+            }
+            std::sort(frontier.begin(), frontier.end(),
+                      [&degree](int a, int b) { return degree[a] < degree[b]; });
+            order.insert(order.end(), frontier.begin(), frontier.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+
+    ordered_constraints.reserve(nConstr);
+    for (int io = 0; io < nGroups; io++) {
+        for (int k = 0; k < groups[order[io]].second; k++)
+            ordered_constraints.push_back(mconstraints[groups[order[io]].first + k]);
+    }
+}
+
 double ChSolverSymmSOR::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
                               ) {
-    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    if (reorder_constraints)
+        UpdateOrdering(sysd);
+    else
+        ordered_constraints.clear();
+
+    // Sweep the reordered list when available (it is a permutation of the descriptor
+    // list that keeps friction triplets contiguous, so all the logic below applies).
+    std::vector<ChConstraint*>& mconstraints =
+        ordered_constraints.empty() ? sysd.GetConstraintsList() : ordered_constraints;
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
     double maxviolation = 0.;
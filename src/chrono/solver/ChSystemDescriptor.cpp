@@ -13,7 +13,10 @@
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
+#include "chrono/solver/ChVariablesBody.h"
+#include "chrono/core/ChCSMatrix.h"
 #include "chrono/core/ChLinkedListMatrix.h"
+#include "chrono/core/ChMatrixView.h"
 
 namespace chrono {
 
@@ -30,6 +33,12 @@ ChSystemDescriptor::ChSystemDescriptor() {
 
     c_a = 1.0;
 
+    structure_revision = 0;
+
+    frozen_Z = nullptr;
+    frozen_revision = 0;
+    frozen_size = 0;
+
     n_q = 0;
     n_c = 0;
     freeze_count = false;
@@ -77,12 +86,32 @@ int ChSystemDescriptor::CountActiveVariables() {
     if (this->freeze_count)  // optimization, avoid list count all times
         return n_q;
 
-    n_q = 0;
-    for (unsigned int iv = 0; iv < vvariables.size(); iv++) {
-        if (vvariables[iv]->IsActive()) {
+    // Items in the head of the list that did not change since the previous count
+    // (same object, same active state) keep their cached offsets: renumbering can
+    // restart at the first difference, which in the typical step is the tail of
+    // per-contact items appended after the persistent bodies and links.
+    // (This assumes the ndof of a given ChVariables object is constant, as
+    // everywhere else in the solver.)
+    size_t first_dirty = 0;
+    size_t ncommon = std::min(vvariables.size(), count_cache_v.size());
+    while (first_dirty < ncommon && count_cache_v[first_dirty] == vvariables[first_dirty] &&
+           count_cache_v_active[first_dirty] == (char)vvariables[first_dirty]->IsActive())
+        first_dirty++;
+
+    n_q = (first_dirty > 0) ? count_cache_v_cumsum[first_dirty - 1] : 0;
+    count_cache_v.resize(vvariables.size());
+    count_cache_v_active.resize(vvariables.size());
+    count_cache_v_cumsum.resize(vvariables.size());
+
+    for (size_t iv = first_dirty; iv < vvariables.size(); iv++) {
+        bool active = vvariables[iv]->IsActive();
+        if (active) {
             vvariables[iv]->SetOffset(n_q);  // also store offsets in state and MC matrix
             n_q += vvariables[iv]->Get_ndof();
         }
+        count_cache_v[iv] = vvariables[iv];
+        count_cache_v_active[iv] = (char)active;
+        count_cache_v_cumsum[iv] = n_q;
     }
     return n_q;
 }
@@ -91,12 +120,27 @@ int ChSystemDescriptor::CountActiveConstraints() {
     if (this->freeze_count)  // optimization, avoid list count all times
         return n_c;
 
-    n_c = 0;
-    for (unsigned int ic = 0; ic < vconstraints.size(); ic++) {
-        if (vconstraints[ic]->IsActive()) {
+    // Same incremental renumbering as in CountActiveVariables().
+    size_t first_dirty = 0;
+    size_t ncommon = std::min(vconstraints.size(), count_cache_c.size());
+    while (first_dirty < ncommon && count_cache_c[first_dirty] == vconstraints[first_dirty] &&
+           count_cache_c_active[first_dirty] == (char)vconstraints[first_dirty]->IsActive())
+        first_dirty++;
+
+    n_c = (first_dirty > 0) ? count_cache_c_cumsum[first_dirty - 1] : 0;
+    count_cache_c.resize(vconstraints.size());
+    count_cache_c_active.resize(vconstraints.size());
+    count_cache_c_cumsum.resize(vconstraints.size());
+
+    for (size_t ic = first_dirty; ic < vconstraints.size(); ic++) {
+        bool active = vconstraints[ic]->IsActive();
+        if (active) {
             vconstraints[ic]->SetOffset(n_c);  // also store offsets in state and MC matrix
             n_c++;
         }
+        count_cache_c[ic] = vconstraints[ic];
+        count_cache_c_active[ic] = (char)active;
+        count_cache_c_cumsum[ic] = n_c;
     }
     return n_c;
 }
@@ -106,6 +150,119 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     CountActiveVariables();
     CountActiveConstraints();
     freeze_count = true;
+
+    // Rebuild the SoA cache of the rigid-body variables used by the fast
+    // [M^(-1)]*v sweep in ShurComplementProduct(). Masses and inertias are
+    // constant during a solve (angular terms are expressed in the body frame),
+    // so their inverses can be flattened here, once per insertion.
+    bodyvar_other.clear();
+    bodyvar_qb.clear();
+    bodyvar_offset.clear();
+    bodyvar_inv_mass.clear();
+    bodyvar_inv_inertia.clear();
+    for (int iv = 0; iv < (int)vvariables.size(); iv++) {
+        if (!vvariables[iv]->IsActive() || vvariables[iv]->Get_ndof() == 0)
+            continue;
+        if (ChVariablesBody* bvar = dynamic_cast<ChVariablesBody*>(vvariables[iv])) {
+            bodyvar_qb.push_back(bvar->Get_qb().GetAddress());
+            bodyvar_offset.push_back(bvar->GetOffset());
+            double bmass = bvar->GetBodyMass();
+            bodyvar_inv_mass.push_back(bmass ? 1.0 / bmass : 1e32);  // as in SetBodyMass()
+            const ChMatrix33<>& inv_inertia = bvar->GetBodyInvInertia();
+            for (int i = 0; i < 3; i++)
+                for (int j = 0; j < 3; j++)
+                    bodyvar_inv_inertia.push_back(inv_inertia(i, j));
+        } else {
+            bodyvar_other.push_back(vvariables[iv]);
+        }
+    }
+}
+
+int ChSystemDescriptor::ComputeIslands(std::vector<int>& var_island, std::vector<int>& constr_island) {
+    int mn_q = CountActiveVariables();
+    int mn_c = CountActiveConstraints();
+    size_t nv = vvariables.size();
+    size_t nc = vconstraints.size();
+
+    // Map each scalar unknown (column in the global matrix) back to the index of the
+    // ChVariables object owning it, so jacobian/stiffness columns can be translated
+    // into graph edges between variable objects.
+    std::vector<int> dof_to_var(mn_q);
+    for (size_t iv = 0; iv < nv; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            for (int k = 0; k < vvariables[iv]->Get_ndof(); k++)
+                dof_to_var[vvariables[iv]->GetOffset() + k] = (int)iv;
+        }
+    }
+
+    // Union-find forest over the ChVariables objects, with path halving.
+    std::vector<int> uf_parent(nv);
+    for (size_t iv = 0; iv < nv; iv++)
+        uf_parent[iv] = (int)iv;
+    auto find_root = [&uf_parent](int i) {
+        while (uf_parent[i] != i) {
+            uf_parent[i] = uf_parent[uf_parent[i]];
+            i = uf_parent[i];
+        }
+        return i;
+    };
+
+    // Record the structural nonzeros of the Cq jacobian rows; all variables touched
+    // by the same constraint row belong to the same island.
+    ChSparsityPatternLearner Cq_pattern(mn_c, mn_q);
+    for (size_t ic = 0; ic < nc; ic++) {
+        if (vconstraints[ic]->IsActive())
+            vconstraints[ic]->Build_Cq(Cq_pattern, vconstraints[ic]->GetOffset());
+    }
+    auto& Cq_rows = Cq_pattern.GetSparsityPattern();
+    for (int row = 0; row < mn_c; row++) {
+        auto col_iter = Cq_rows[row].begin();
+        if (col_iter == Cq_rows[row].end())
+            continue;
+        int root_first = find_root(dof_to_var[*col_iter]);
+        for (++col_iter; col_iter != Cq_rows[row].end(); ++col_iter)
+            uf_parent[find_root(dof_to_var[*col_iter])] = root_first;
+    }
+
+    // Same for the optional stiffness blocks: an off-diagonal structural nonzero
+    // K(r,c) couples the variables owning dofs r and c.
+    if (!vstiffness.empty()) {
+        ChSparsityPatternLearner K_pattern(mn_q, mn_q);
+        for (size_t ik = 0; ik < vstiffness.size(); ik++)
+            vstiffness[ik]->Build_K(K_pattern, true);
+        auto& K_rows = K_pattern.GetSparsityPattern();
+        for (int row = 0; row < mn_q; row++) {
+            int root_row = find_root(dof_to_var[row]);
+            for (auto col_iter = K_rows[row].begin(); col_iter != K_rows[row].end(); ++col_iter)
+                uf_parent[find_root(dof_to_var[*col_iter])] = root_row;
+        }
+    }
+
+    // Enumerate the islands in order of first appearance, so the numbering is
+    // deterministic given the insertion order of the variables.
+    var_island.assign(nv, -1);
+    std::vector<int> island_of_root(nv, -1);
+    int num_islands = 0;
+    for (size_t iv = 0; iv < nv; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            int root = find_root((int)iv);
+            if (island_of_root[root] < 0)
+                island_of_root[root] = num_islands++;
+            var_island[iv] = island_of_root[root];
+        }
+    }
+
+    // A constraint belongs to the island of (any of) the variables in its jacobian row.
+    constr_island.assign(nc, -1);
+    for (size_t ic = 0; ic < nc; ic++) {
+        if (vconstraints[ic]->IsActive()) {
+            auto& row = Cq_rows[vconstraints[ic]->GetOffset()];
+            if (!row.empty())
+                constr_island[ic] = var_island[dof_to_var[row.front()]];
+        }
+    }
+
+    return num_islands;
 }
 
 void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
@@ -201,6 +358,32 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
     }
 }
 
+// Adapter used by the one-triangle assembly path of ConvertToMatrixForm(): it forwards
+// only the upper-triangular entries (col >= row) to the wrapped matrix, so that the same
+// Build_M / Build_K / Build_CqT calls used for full assembly can be reused unchanged for
+// symmetric storage.
+class ChUpperTriangularAdapter : public ChSparseMatrix {
+  public:
+    explicit ChUpperTriangularAdapter(ChSparseMatrix& target)
+        : ChSparseMatrix(target.GetNumRows(), target.GetNumColumns()), m_target(target) {}
+
+    virtual void SetElement(int insrow, int inscol, double insval, bool overwrite = true) override {
+        if (inscol >= insrow)
+            m_target.SetElement(insrow, inscol, insval, overwrite);
+    }
+
+    virtual double GetElement(int row, int col) const override { return m_target.GetElement(row, col); }
+
+    virtual void Reset(int row, int col, int nonzeros = 0) override { m_target.Reset(row, col, nonzeros); }
+
+    virtual bool Resize(int nrows, int ncols, int nonzeros = 0) override {
+        return m_target.Resize(nrows, ncols, nonzeros);
+    }
+
+  private:
+    ChSparseMatrix& m_target;
+};
+
 void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChMatrix<>* rhs) {
 
     std::vector<ChConstraint*>& mconstraints = this->GetConstraintsList();
@@ -219,14 +402,24 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChMatrix<>* rhs)
    
 	if (Z)
 	{
+		// If the target matrix is declared symmetric, assemble only its upper triangle:
+		// the M and K contributions are filtered through an adapter and the constraint
+		// jacobian is stored once, as Cq' in the upper-right block. Solvers accepting
+		// symmetric input (e.g. MUMPS) must then be fed exactly one triangle.
+		bool symmetric = (Z->GetType() == ChSparseMatrix::SYMMETRIC_INDEF) ||
+		                 (Z->GetType() == ChSparseMatrix::SYMMETRIC_POSDEF);
+
 		Z->Reset(n_q + mn_c, n_q + mn_c);
 
+		ChUpperTriangularAdapter Z_upper(*Z);
+		ChSparseMatrix& Z_dest = symmetric ? static_cast<ChSparseMatrix&>(Z_upper) : *Z;
+
 		// Fill Z with masses and inertias.
 		int s_q = 0;
 		for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
 			if (mvariables[iv]->IsActive()) {
 				// Masses and inertias in upper-left block of Z
-				mvariables[iv]->Build_M(*Z, s_q, s_q, this->c_a);
+				mvariables[iv]->Build_M(Z_dest, s_q, s_q, this->c_a);
 				s_q += mvariables[iv]->Get_ndof();
 			}
 		}
@@ -234,15 +427,17 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChMatrix<>* rhs)
 		// If present, add stiffness matrix K to upper-left block of Z.
 		int s_k = 0;
 		for (unsigned int ik = 0; ik < this->vstiffness.size(); ik++) {
-			this->vstiffness[ik]->Build_K(*Z, true);
+			this->vstiffness[ik]->Build_K(Z_dest, true);
 		}
 
 		// Fill Z by looping over constraints.
 		int s_c = 0;
 		for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
 			if (mconstraints[ic]->IsActive()) {
-				// Constraint Jacobian in lower-left block of Z
-				mconstraints[ic]->Build_Cq(*Z, n_q + s_c);
+				// Constraint Jacobian in lower-left block of Z (skipped in symmetric
+				// storage, where the transposed copy represents both blocks)
+				if (!symmetric)
+					mconstraints[ic]->Build_Cq(*Z, n_q + s_c);
 				// Transposed constraint Jacobian in upper-right block of Z
 				mconstraints[ic]->Build_CqT(*Z, n_q + s_c);
 				// -E ( = cfm ) in lower-right block of Z
@@ -284,6 +479,43 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChMatrix<>* rhs)
 }
 
 
+void ChSystemDescriptor::ConvertToMatrixFormIncremental(ChSparseMatrix* Z, ChMatrix<>* rhs) {
+    ChCSMatrix* Zcs = Z ? dynamic_cast<ChCSMatrix*>(Z) : nullptr;
+
+    if (Zcs) {
+        // Count active constraints and variables, as in ConvertToMatrixForm.
+        int mn_c = 0;
+        for (unsigned int ic = 0; ic < vconstraints.size(); ic++) {
+            if (vconstraints[ic]->IsActive())
+                mn_c++;
+        }
+        n_q = CountActiveVariables();
+        int size = n_q + mn_c;
+
+        if (Z != frozen_Z || frozen_revision != structure_revision || frozen_size != size) {
+            // First assembly into this matrix, or the system structure changed:
+            // acquire the sparsity pattern by sweeping the same Build_* calls
+            // used for the values through a learner, then load it into the
+            // matrix and lock it. This assembly - and every later one with
+            // unchanged structure - then performs no structural insertion.
+            ChSparsityPatternLearner pattern(size, size);
+            pattern.SetType(Z->GetType());  // a symmetric target learns a one-triangle pattern
+            ConvertToMatrixForm(&pattern, nullptr);
+            Zcs->LoadSparsityPattern(pattern);
+            Zcs->SetSparsityPatternLock(true);
+
+            frozen_Z = Z;
+            frozen_revision = structure_revision;
+            frozen_size = size;
+        }
+    }
+
+    // With the pattern loaded and locked, the regular assembly resets the
+    // values in place (Reset() keeps the element positions) and every write
+    // lands on an existing position.
+    ConvertToMatrixForm(Z, rhs);
+}
+
 void ChSystemDescriptor::DumpLastMatrices(bool assembled, const char* path) {
     char filename[300];
     try {
@@ -549,6 +781,106 @@ void ChSystemDescriptor::ShurComplementProduct(ChMatrix<>& result, ChMatrix<>* l
 
     result.Reset(n_c, 1);  // fast! Reset() method does not realloc if size doesn't change
 
+#ifdef _OPENMP
+    // Parallel version of the product, used when more than one thread is requested.
+    // The race on the qb data of shared ChVariables is avoided by accumulating the
+    // [Cq']*l scatter into per-thread buffers, followed by an atomic-free reduction
+    // where each thread sums a disjoint row range over all buffers. The remaining
+    // phases write each either to a distinct variable or to a distinct result row,
+    // so they parallelize trivially.
+    if (num_threads > 1) {
+        n_q = CountActiveVariables();
+
+        ChMatrixDynamic<> Cqt_l(n_q, 1);
+        std::vector<ChMatrixDynamic<>> buffers(num_threads);
+
+#pragma omp parallel num_threads(num_threads)
+        {
+            int tid = CHOMPfunctions::GetThreadNum();
+            ChMatrixDynamic<>& buffer = buffers[tid];
+            buffer.Reset(n_q, 1);
+
+            // 1 - accumulate   buffer += [Cq']*l   (per thread, no concurrent writes)
+            //     and add the cfm term ( -[E]*l ) to the result.
+#pragma omp for schedule(static)
+            for (int ic = 0; ic < (int)vconstraints.size(); ic++) {
+                if (vconstraints[ic]->IsActive()) {
+                    int s_c = vconstraints[ic]->GetOffset();
+
+                    bool process = true;
+                    if (enabled)
+                        if ((*enabled)[s_c] == false)
+                            process = false;
+
+                    if (process) {
+                        double li;
+                        if (lvector)
+                            li = (*lvector)(s_c, 0);
+                        else
+                            li = vconstraints[ic]->Get_l_i();
+
+                        vconstraints[ic]->MultiplyTandAdd(buffer, li);
+
+                        result(s_c, 0) = vconstraints[ic]->Get_cfm_i() * li;
+                    }
+                }
+            }
+
+            // 2 - reduction:   Cqt_l = sum of the per-thread buffers
+            //     (each thread owns a disjoint row range, so no atomics are needed)
+#pragma omp for schedule(static)
+            for (int row = 0; row < n_q; row++) {
+                double sum = 0;
+                for (int it = 0; it < (int)buffers.size(); it++)
+                    sum += buffers[it](row, 0);
+                Cqt_l(row, 0) = sum;
+            }
+
+            // 3 - performs    qb = [M^(-1)]*Cqt_l    (each variable is written by one thread only)
+            //     Rigid-body variables go through the flat SoA cache built in
+            //     UpdateCountsAndOffsets() - no virtual call and no temporary
+            //     per body; the remaining variables use the generic path.
+#pragma omp for schedule(static) nowait
+            for (int ib = 0; ib < (int)bodyvar_qb.size(); ib++) {
+                const double* v = Cqt_l.GetAddress() + bodyvar_offset[ib];
+                const double* iJ = &bodyvar_inv_inertia[9 * ib];
+                double im = bodyvar_inv_mass[ib];
+                double* q = bodyvar_qb[ib];
+                q[0] = im * v[0];
+                q[1] = im * v[1];
+                q[2] = im * v[2];
+                q[3] = iJ[0] * v[3] + iJ[1] * v[4] + iJ[2] * v[5];
+                q[4] = iJ[3] * v[3] + iJ[4] * v[4] + iJ[5] * v[5];
+                q[5] = iJ[6] * v[3] + iJ[7] * v[4] + iJ[8] * v[5];
+            }
+#pragma omp for schedule(static)
+            for (int iv = 0; iv < (int)bodyvar_other.size(); iv++) {
+                int ndof = bodyvar_other[iv]->Get_ndof();
+                ChMatrixView<> vseg(Cqt_l, bodyvar_other[iv]->GetOffset(), ndof);
+                bodyvar_other[iv]->Compute_invMb_v(bodyvar_other[iv]->Get_qb(), vseg);
+            }
+
+            // 4 - performs    result += [Cq]*qb    (each constraint writes its own result row)
+#pragma omp for schedule(static)
+            for (int ic = 0; ic < (int)vconstraints.size(); ic++) {
+                if (vconstraints[ic]->IsActive()) {
+                    bool process = true;
+                    if (enabled)
+                        if ((*enabled)[vconstraints[ic]->GetOffset()] == false)
+                            process = false;
+
+                    if (process)
+                        result(vconstraints[ic]->GetOffset(), 0) += vconstraints[ic]->Compute_Cq_q();
+                    else
+                        result(vconstraints[ic]->GetOffset(), 0) = 0;
+                }
+            }
+        }
+
+        return;
+    }
+#endif
+
 // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
 // in different phases:
 
@@ -675,6 +1007,12 @@ void ChSystemDescriptor::ConstraintsProject(
     ) {
     this->FromVectorToConstraints(multipliers);
 
+    // Each Project() only modifies the multipliers of its own constraint (for contacts
+    // with friction, of its own normal/tangential triplet), so the projections of
+    // different constraints are independent and can run in parallel.
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(static) if (num_threads > 1)
+#endif
     for (int ic = 0; ic < (int)vconstraints.size(); ic++) {
         if (vconstraints[ic]->IsActive())
             vconstraints[ic]->Project();
@@ -697,6 +1035,10 @@ void ChSystemDescriptor::UnknownsProject(
     }
 
 // constraint projection!
+// (independent per constraint, see ConstraintsProject)
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(static) if (num_threads > 1)
+#endif
     for (int ic = 0; ic < (int)vconstraints.size(); ic++) {
         if (vconstraints[ic]->IsActive())
             vconstraints[ic]->Project();
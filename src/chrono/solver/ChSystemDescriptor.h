@@ -84,11 +84,45 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  // coefficient form M mass matrices in vvariables
 
+    unsigned int structure_revision;  ///< revision of the system topology at the time of the last insertion
+
   private:
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
     bool freeze_count;  ///< for optimization: avoid to re-count the number of active variables and constraints
 
+    // Caches for incremental offset computation: the items, active flags and cumulated
+    // scalar counts seen at the previous CountActiveVariables()/CountActiveConstraints().
+    // Items in the unchanged head of the lists (typically the persistent bodies and
+    // links, since per-step contact constraints are appended last) keep their offsets
+    // without being renumbered.
+    std::vector<ChVariables*> count_cache_v;
+    std::vector<char> count_cache_v_active;
+    std::vector<int> count_cache_v_cumsum;
+    std::vector<ChConstraint*> count_cache_c;
+    std::vector<char> count_cache_c_active;
+    std::vector<int> count_cache_c_cumsum;
+
+    // SoA cache of the active rigid-body variables (ChVariablesBody and derived),
+    // rebuilt by UpdateCountsAndOffsets(): flattened inverse mass and inverse
+    // inertia plus direct pointers to each qb data block. The [M^(-1)]*v sweep
+    // of ShurComplementProduct() runs ncontacts x niterations times per step,
+    // so it reads these flat arrays instead of doing one virtual call plus one
+    // temporary-matrix allocation per body per product. Active variables that
+    // are not rigid bodies are kept aside and go through the generic path.
+    std::vector<ChVariables*> bodyvar_other;    ///< active non-body variables
+    std::vector<double*> bodyvar_qb;            ///< qb data block of each body variable
+    std::vector<int> bodyvar_offset;            ///< global offset of each body variable
+    std::vector<double> bodyvar_inv_mass;       ///< inverse mass, one per body
+    std::vector<double> bodyvar_inv_inertia;    ///< inverse inertia, 9 per body (row-major)
+
+    // State of the frozen-pattern assembly (see ConvertToMatrixFormIncremental):
+    // target matrix of the last pattern acquisition, plus the structure revision
+    // and system size it was acquired for.
+    ChSparseMatrix* frozen_Z;
+    unsigned int frozen_revision;
+    int frozen_size;
+
   public:
     /// Constructor
     ChSystemDescriptor();
@@ -146,10 +180,37 @@ class ChApi ChSystemDescriptor {
     /// otherwise CountActiveVariables() and CountActiveConstraints() might fail.
     virtual void UpdateCountsAndOffsets();
 
+    /// Partition the inserted variables and constraints into independent 'islands',
+    /// i.e. groups that share no jacobian or stiffness coupling, so that each island
+    /// could be solved as a separate, smaller problem (see ChSolverIslands).
+    /// On return, var_island has one entry per inserted ChVariables object and
+    /// constr_island one entry per inserted ChConstraint object, each containing the
+    /// 0-based index of the island the item belongs to (-1 for inactive items, and for
+    /// degenerate constraints whose jacobian row has no structural nonzero).
+    /// Couplings are detected from the sparsity pattern of the Cq jacobian rows and of
+    /// the ChKblock stiffness blocks; variables not referenced by any constraint or
+    /// stiffness block form singleton islands.
+    /// Note: this function updates the offsets of variables and constraints, as
+    /// CountActiveVariables() and CountActiveConstraints() do.
+    /// \return  the number of islands found.
+    virtual int ComputeIslands(std::vector<int>& var_island,    ///< island index, one entry per ChVariables object
+                               std::vector<int>& constr_island  ///< island index, one entry per ChConstraint object
+    );
+
     /// Sets the c_a coefficient (default=1) used for scaling the M masses of the vvariables
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual void SetMassFactor(const double mc_a) { c_a = mc_a; }
 
+    /// Set the structure revision stamp.
+    /// This is set by the owner ChSystem at every descriptor preparation, from the assembly
+    /// topology revision counter (see ChAssembly::GetTopologyRevision()), so that solvers
+    /// caching structure-dependent data (e.g. a locked sparsity pattern or a symbolic
+    /// factorization) can detect topology changes without re-scanning the system.
+    void SetStructureRevision(unsigned int rev) { structure_revision = rev; }
+
+    /// Get the structure revision stamp (see SetStructureRevision()).
+    unsigned int GetStructureRevision() const { return structure_revision; }
+
     /// Gets the c_a coefficient (default=1) used for scaling the M masses of the vvariables
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
@@ -354,10 +415,32 @@ class ChApi ChSystemDescriptor {
     );
 
     /// Create and return the assembled system matrix and RHS vector.
+    /// If Z is marked symmetric (SYMMETRIC_INDEF or SYMMETRIC_POSDEF, see
+    /// ChSparseMatrix::SetType()), only the upper triangle of the KKT matrix is
+    /// assembled: the constraint jacobian is stored once, as Cq' in the
+    /// upper-right block, instead of materializing both the Cq and Cq' copies.
+    /// This halves assembly work and storage for the saddle-point matrix and is
+    /// the storage expected by direct solvers with symmetric support (e.g. the
+    /// MUMPS interface, which would sum duplicate (i,j)/(j,i) entries).
     virtual void ConvertToMatrixForm(ChSparseMatrix* Z,  ///< [out] assembled system matrix
                                      ChMatrix<>* rhs     ///< [out] assembled RHS vector
     );
 
+    /// Incremental variant of ConvertToMatrixForm(Z, rhs), for reassembly loops
+    /// with unchanged structure such as the Newton iterations of implicit
+    /// integrators. On the first call into a given matrix - and whenever the
+    /// system structure changed since the previous call, as detected through
+    /// the structure revision stamp (see SetStructureRevision()) - the
+    /// sparsity pattern of Z is acquired with a ChSparsityPatternLearner,
+    /// loaded into the matrix and locked. On every subsequent call the pattern
+    /// is structurally frozen: Reset() keeps the element positions and each
+    /// SetElement() reduces to an in-place value overwrite, with no insertion
+    /// bookkeeping or reallocation. Falls back to plain ConvertToMatrixForm()
+    /// if Z is not a ChCSMatrix.
+    virtual void ConvertToMatrixFormIncremental(ChSparseMatrix* Z,  ///< [out] assembled system matrix
+                                                ChMatrix<>* rhs     ///< [out] assembled RHS vector
+    );
+
     /// Saves to disk the LAST used matrices of the problem.
     /// If assembled == true,
     ///    dump_Z.dat   has the assembled optimization matrix (Matlab sparse format)
@@ -85,8 +85,9 @@ void ChTimestepperEulerExpl::Advance(const double dt) {
 
     // Euler formula!
     //   y_new= y + dy/dt * dt
+    // (in-place fused axpy: a single streaming pass, no temporary state vectors)
 
-    Y = Y + dYdt * dt;  //  also: GetIntegrable().StateIncrement(y_new, y, Dy);
+    Y.MatrIncScaled(dYdt, dt);  //  also: GetIntegrable().StateIncrement(y_new, y, Dy);
 
     T += dt;
 
@@ -124,10 +125,12 @@ void ChTimestepperEulerExplIIorder::Advance(const double dt) {
     mintegrable->StateSolveA(A, L, X, V, T, dt, false);  // Dv/dt = f(x,v,T)
 
     // Euler formula!
+    // (in-place fused axpy updates: memory-bound streaming over the raw state
+    // arrays, instead of operator arithmetic through temporaries)
 
-    X = X + V * dt;  // x_new= x + v * dt
+    X.MatrIncScaled(V, dt);  // x_new= x + v * dt
 
-    V = V + A * dt;  // v_new= v + a * dt
+    V.MatrIncScaled(A, dt);  // v_new= v + a * dt
 
     T += dt;
 
@@ -162,9 +165,9 @@ void ChTimestepperEulerSemiImplicit::Advance(const double dt) {
 
     // Semi-implicit Euler formula!   (note the order of update of x and v, respect to original Euler II order explicit)
 
-    V = V + A * dt;  // v_new= v + a * dt
+    V.MatrIncScaled(A, dt);  // v_new= v + a * dt
 
-    X = X + V * dt;  // x_new= x + v_new * dt
+    X.MatrIncScaled(V, dt);  // x_new= x + v_new * dt
 
     T += dt;
 
@@ -199,16 +202,23 @@ void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
     GetIntegrable()->StateSolve(Dydt1, L, Y, T, dt,
                                 false);  // note, 'false'=no need to update with StateScatter before computation
 
-    y_new = Y + Dydt1 * 0.5 * dt;  // integrable.StateIncrement(y_new, Y, Dydt1*0.5*dt);
+    y_new.CopyFromMatrix(Y);
+    y_new.MatrIncScaled(Dydt1, 0.5 * dt);  // integrable.StateIncrement(y_new, Y, Dydt1*0.5*dt);
     GetIntegrable()->StateSolve(Dydt2, L, y_new, T + dt * 0.5, dt);
 
-    y_new = Y + Dydt2 * 0.5 * dt;  // integrable.StateIncrement(y_new, Y, Dydt2*0.5*dt);
+    y_new.CopyFromMatrix(Y);
+    y_new.MatrIncScaled(Dydt2, 0.5 * dt);  // integrable.StateIncrement(y_new, Y, Dydt2*0.5*dt);
     GetIntegrable()->StateSolve(Dydt3, L, y_new, T + dt * 0.5, dt);
 
-    y_new = Y + Dydt3 * dt;  // integrable.StateIncrement(y_new, Y, Dydt3*dt);
+    y_new.CopyFromMatrix(Y);
+    y_new.MatrIncScaled(Dydt3, dt);  // integrable.StateIncrement(y_new, Y, Dydt3*dt);
     GetIntegrable()->StateSolve(Dydt4, L, y_new, T + dt, dt);
 
-    Y = Y + (Dydt1 + Dydt2 * 2.0 + Dydt3 * 2.0 + Dydt4) * (1. / 6.) * dt;  // integrable.StateIncrement(...);
+    // Y += (Dydt1 + 2*Dydt2 + 2*Dydt3 + Dydt4) * dt/6, accumulated in place
+    Y.MatrIncScaled(Dydt1, dt * (1. / 6.));  // integrable.StateIncrement(...);
+    Y.MatrIncScaled(Dydt2, dt * (2. / 6.));
+    Y.MatrIncScaled(Dydt3, dt * (2. / 6.));
+    Y.MatrIncScaled(Dydt4, dt * (1. / 6.));
     dYdt = Dydt4;                                                          // to check
     T += dt;
 
@@ -241,10 +251,13 @@ void ChTimestepperHeun::Advance(const double dt) {
     GetIntegrable()->StateSolve(Dydt1, L, Y, T, dt,
                                 false);  // note, 'false'=no need to update with StateScatter before computation
 
-    y_new = Y + Dydt1 * dt;
+    y_new.CopyFromMatrix(Y);
+    y_new.MatrIncScaled(Dydt1, dt);
     GetIntegrable()->StateSolve(Dydt2, L, y_new, T + dt, dt);
 
-    Y = Y + (Dydt1 + Dydt2) * (dt / 2.);
+    // Y += (Dydt1 + Dydt2) * dt/2, accumulated in place
+    Y.MatrIncScaled(Dydt1, dt / 2.);
+    Y.MatrIncScaled(Dydt2, dt / 2.);
     dYdt = Dydt2;
     T += dt;
 
@@ -279,15 +292,17 @@ void ChTimestepperLeapfrog::Advance(const double dt) {
     mintegrable->StateGather(X, V, T);  // state <- system
     mintegrable->StateGatherAcceleration(Aold);
 
-    // advance X (uses last A)
-    X = X + V * dt + Aold * (0.5 * dt * dt);
+    // advance X (uses last A):  X += V*dt + Aold*(dt^2/2), accumulated in place
+    X.MatrIncScaled(V, dt);
+    X.MatrIncScaled(Aold, 0.5 * dt * dt);
 
     // computes new A  (NOTE!!true for imposing a state-> system scatter update,because X changed..)
     mintegrable->StateSolveA(A, L, X, V, T, dt, true);  // Dv/dt = f(x,v,T)   Dv = f(x,v,T)*dt
 
-    // advance V
+    // advance V:  V += (Aold + A) * dt/2, accumulated in place
 
-    V = V + (Aold + A) * (0.5 * dt);
+    V.MatrIncScaled(Aold, 0.5 * dt);
+    V.MatrIncScaled(A, 0.5 * dt);
 
     T += dt;
 
@@ -397,6 +412,78 @@ void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
+    if (!adaptive) {
+        AdvanceStep(mintegrable, dt);
+        return;
+    }
+
+    // A change in the number of constraints since the previous call signals a collision event:
+    // reset the controller memory and clamp the sub-step back to the call step, instead of
+    // carrying the (possibly much larger) step of a smooth phase across the impact.
+    if (mintegrable->GetNconstr() != nconstr_prev) {
+        nconstr_prev = mintegrable->GetNconstr();
+        have_Aprev = false;
+        err_prev = 1;
+        h = ChMin(h, dt);
+    }
+
+    double tfinal = T + dt;
+
+    while (T < tfinal) {
+        // never step past the target time; snap to it when close
+        double hs = ChMin(h, tfinal - T);
+        if (tfinal - (T + hs) < 1e-6 * dt)
+            hs = tfinal - T;
+
+        Xsaved = X;
+        double Tsaved = T;
+
+        AdvanceStep(mintegrable, hs);
+
+        // Embedded local error estimate for implicit Euler, using the acceleration of the
+        // previous accepted sub-step:  e = (h/2) * (a_new - a_old)  (velocity error).
+        // The very first sub-step after a (re)start is accepted unconditionally.
+        double err = 0;
+        ChStateDelta Acur = (V - Vold) * (1 / hs);
+        if (have_Aprev) {
+            ewt.Reset(V.GetLength());
+            for (int i = 0; i < V.GetLength(); ++i)
+                ewt.ElementN(i) = 1.0 / (adapt_reltol * std::abs(V.ElementN(i)) + adapt_abstol);
+            err = ((Acur - Aprev) * (0.5 * hs)).NormWRMS(ewt);
+        }
+
+        if (err <= 1) {
+            // ------ sub-step accepted: PI proposal for the next sub-step size
+            //        (exponents 0.7/(p+1) and 0.4/(p+1), with method order p = 1)
+            Aprev = Acur;
+            have_Aprev = true;
+            if (err > 0) {
+                double factor = 0.9 * std::pow(1.0 / err, 0.35) * std::pow(err_prev / err, 0.2);
+                factor = ChMin(ChMax(factor, 0.2), 5.0);
+                err_prev = err;
+                h = hs * factor;
+            }
+        } else {
+            // ------ sub-step rejected: roll back and retry with a reduced size
+            X = Xsaved;
+            V = Vold;
+            T = Tsaved;
+            mintegrable->StateScatter(X, V, T);
+
+            h = hs * ChMax(0.9 * std::pow(1.0 / err, 0.5), 0.1);
+
+            if (verbose)
+                GetLog() << " ---EulerImplicitLinearized reject sub-step, reduce stepsize to " << h << "\n";
+
+            // bail out if stepsize reaches minimum allowable
+            if (h < h_min)
+                throw ChException("EulerImplicitLinearized: Reached minimum allowable step size.");
+        }
+    }
+}
+
+// Perform a single step of size dt of the linearized implicit Euler scheme.
+void ChTimestepperEulerImplicitLinearized::AdvanceStep(ChIntegrableIIorder* mintegrable, const double dt) {
     // setup main vectors
     mintegrable->StateSetup(X, V, A);
 
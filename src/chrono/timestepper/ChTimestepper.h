@@ -412,16 +412,64 @@ class ChApi ChTimestepperEulerImplicitLinearized : public ChTimestepperIIorder,
     ChVectorDynamic<> R;
     ChVectorDynamic<> Qc;
 
+    bool adaptive;        ///< adaptive sub-stepping enabled?
+    double adapt_reltol;  ///< relative tolerance for the local error test
+    double adapt_abstol;  ///< absolute tolerance for the local error test
+    double h_min;         ///< minimum allowable sub-step size
+    double h;             ///< sub-step size currently proposed by the controller
+    double err_prev;      ///< error norm of the previous accepted sub-step (PI memory)
+    int nconstr_prev;     ///< constraint count at the previous call (collision event detection)
+    ChStateDelta Aprev;   ///< acceleration of the previous accepted sub-step
+    bool have_Aprev;      ///< is Aprev valid?
+    ChState Xsaved;       ///< saved positions, to roll back a rejected sub-step
+    ChVectorDynamic<> ewt;  ///< vector of error weights
+
   public:
     /// Constructors (default empty)
     ChTimestepperEulerImplicitLinearized(ChIntegrableIIorder* mintegrable = nullptr)
-        : ChTimestepperIIorder(mintegrable), ChImplicitTimestepper() {}
+        : ChTimestepperIIorder(mintegrable),
+          ChImplicitTimestepper(),
+          adaptive(false),
+          adapt_reltol(1e-4),
+          adapt_abstol(1e-8),
+          h_min(1e-10),
+          h(1e6),
+          err_prev(1),
+          nconstr_prev(-1),
+          have_Aprev(false) {}
 
     virtual Type GetType() const override { return Type::EULER_IMPLICIT_LINEARIZED; }
 
+    /// Enable/disable adaptive sub-stepping with embedded error estimation (default: disabled).
+    /// When enabled, each call to Advance() may be carried out as a sequence of sub-steps whose
+    /// size is selected by a PI controller, based on an embedded estimate of the local truncation
+    /// error (measured in the WRMS norm with the given relative and absolute tolerances).
+    /// Sub-steps that fail the error test are rejected and re-attempted with a smaller size.
+    /// Since collision detection is performed by the caller at the granularity of the Advance()
+    /// steps, the controller clamps the sub-step back to the call step whenever the number of
+    /// constraints changed since the previous call (a collision event).
+    void SetAdaptiveStepControl(bool enable, double rel_tol = 1e-4, double abs_tol = 1e-8) {
+        adaptive = enable;
+        adapt_reltol = rel_tol;
+        adapt_abstol = abs_tol;
+    }
+
+    /// Set the minimum allowable sub-step size for adaptive sub-stepping.
+    /// An exception is thrown if the controller decreases the sub-step below this limit.
+    void SetMinStepSize(double min_step) { h_min = min_step; }
+
+    /// Return the step size currently proposed by the adaptive controller.
+    /// During smooth (e.g. contact-free) phases this may grow beyond the step specified in the
+    /// calls to Advance(); a driver program can use it to enlarge its own step accordingly.
+    double GetAdaptiveStep() const { return h; }
+
     /// Performs an integration timestep
     virtual void Advance(const double dt  ///< timestep to advance
                          ) override;
+
+  private:
+    /// Perform a single step of size dt (the original Anitescu/Stewart/Trinkle scheme).
+    void AdvanceStep(ChIntegrableIIorder* mintegrable, const double dt);
 };
 
 /// Performs a step of Euler implicit for II order systems using a semi implicit Euler without
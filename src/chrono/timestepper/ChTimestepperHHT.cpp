@@ -34,7 +34,14 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* mintegrable)
       h_min(1e-10),
       h(1e6),
       num_successful_steps(0),
-      modified_Newton(true) {
+      modified_Newton(true),
+      jacobian_reuse(false),
+      jacobian_reuse_iters(3),
+      matrix_refresh_needed(true),
+      h_matrix(-1),
+      err_control(false),
+      err_prev(1),
+      nconstr_prev(-1) {
     SetAlpha(-0.2);  // default: some dissipation
 }
 
@@ -83,12 +90,24 @@ void ChTimestepperHHT::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    // With error control, a change in the number of constraints since the previous call
+    // signals a collision event: reset the controller memory, so the stepsize is re-earned
+    // from scratch rather than carried over from the smooth phase before the impact.
+    if (err_control && mintegrable->GetNconstr() != nconstr_prev) {
+        nconstr_prev = mintegrable->GetNconstr();
+        err_prev = 1;
+        num_successful_steps = 0;
+    }
+
     // If we had a streak of successful steps, consider a stepsize increase.
     // Note that we never attempt a step larger than the specified dt value.
     // If step size control is disabled, always use h = dt.
+    // With error control, stepsize increases are proposed by the PI controller instead.
     if (!step_control) {
         h = dt;
         num_successful_steps = 0;
+    } else if (err_control) {
+        h = ChMin(h, dt);
     } else if (num_successful_steps >= req_successful_steps) {
         double new_h = ChMin(h * step_increase_factor, dt);
         if (new_h > h + h_min) {
@@ -107,8 +126,13 @@ void ChTimestepperHHT::Advance(const double dt) {
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
+    // If additionally reusing the Newton matrix across steps, the factorization of a
+    // previous step is kept (and Setup skipped even at the beginning of this step) as
+    // long as the stepsize is unchanged and no refresh was scheduled.
     matrix_is_current = false;
     call_setup = true;
+    if (modified_Newton && jacobian_reuse && !matrix_refresh_needed && h == h_matrix)
+        call_setup = false;
 
     // Loop until reaching final time
     while (T < tfinal) {
@@ -118,6 +142,7 @@ void ChTimestepperHHT::Advance(const double dt) {
         // Newton-Raphson for state at T+h
         bool converged;
         int it;
+        bool fresh_matrix_attempt = call_setup;  // does this attempt start with an up-to-date matrix?
 
         for (it = 0; it < maxiters; it++) {
             if (verbose && modified_Newton && call_setup)
@@ -131,6 +156,8 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                h_matrix = h;
+                matrix_refresh_needed = false;
             }
 
             // If using modified Newton, do not call Setup again
@@ -142,8 +169,20 @@ void ChTimestepperHHT::Advance(const double dt) {
                 break;
         }
 
-        if (converged) {
-            // ------ NR converged
+        // With error control, a converged step must additionally pass the embedded local
+        // truncation error test (the Zienkiewicz-Xie estimate for the Newmark family):
+        //   e = (beta - 1/6) h^2 (a_new - a_old)
+        // measured in the WRMS norm against the position increment over the step.
+        bool accepted = converged;
+        double err = 0;
+        if (converged && step_control && err_control && std::abs(beta - 1.0 / 6.0) > 1e-10) {
+            CalcErrorWeights(Vnew * h, reltol, abstolS, ewtE);
+            err = ((Anew - A) * (h * h * std::abs(beta - 1.0 / 6.0))).NormWRMS(ewtE);
+            accepted = (err <= 1);
+        }
+
+        if (accepted) {
+            // ------ NR converged (and local error acceptable)
 
             // if the number of iterations was low enough, increase the count of successive
             // successful steps (for possible step increase)
@@ -161,6 +200,11 @@ void ChTimestepperHHT::Advance(const double dt) {
             if (std::abs(T + h - tfinal) < 1e-6)
                 h = tfinal - T;
 
+            // with jacobian reuse, schedule a matrix refresh for the next step if this
+            // step needed too many iterations with the reused matrix
+            if (jacobian_reuse && it + 1 > jacobian_reuse_iters)
+                matrix_refresh_needed = true;
+
             // advance time and set the state
             T += h;
             X = Xnew;
@@ -168,6 +212,55 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
+            // PI stepsize proposal for the next step
+            // (exponents 0.7/(p+1) and 0.4/(p+1), with method order p = 2)
+            if (step_control && err_control && err > 0) {
+                double factor = 0.9 * std::pow(1.0 / err, 0.7 / 3.0) * std::pow(err_prev / err, 0.4 / 3.0);
+                factor = ChMin(ChMax(factor, step_decrease_factor), step_increase_factor);
+                err_prev = err;
+                double h_new = ChMin(h * factor, (T < tfinal) ? tfinal - T : dt);
+                if (h_new != h) {
+                    h = h_new;
+                    call_setup = true;  // a stepsize change invalidates the Newton matrix
+                }
+            }
+
+        } else if (converged) {
+            // ------ NR converged but the error test failed: reject the step and
+            //        re-attempt it with a reduced stepsize (deadbeat control)
+
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
+
+            h *= ChMax(0.9 * std::pow(1.0 / err, 1.0 / 3.0), 0.1);
+
+            if (verbose)
+                GetLog() << " ---HHT error test failed, reduce stepsize to " << h << "\n";
+
+            // bail out if stepsize reaches minimum allowable
+            if (h < h_min) {
+                if (verbose)
+                    GetLog() << " HHT at minimum stepsize. Exiting...\n";
+                throw ChException("HHT: Reached minimum allowable step size.");
+            }
+
+            // force a matrix re-evaluation (due to change in stepsize)
+            call_setup = true;
+
+        } else if (jacobian_reuse && !fresh_matrix_attempt) {
+            // ------ NR did not converge, but the Newton matrix was reused from a
+            //        previous step: re-attempt the same step with a refreshed matrix
+            //        before touching the stepsize.
+
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
+
+            if (verbose) {
+                GetLog() << " HHT re-attempt step with updated matrix.\n";
+            }
+
+            call_setup = true;
+
         /*
         } else if (!matrix_is_current) {
             // ------ NR did not converge but the matrix was out-of-date
@@ -195,6 +288,9 @@ void ChTimestepperHHT::Advance(const double dt) {
                 GetLog() << "  T = " << T + h << "  h = " << h << "\n";
             }
 
+            // convergence degraded: never carry a stale matrix into the next step
+            matrix_refresh_needed = true;
+
             T += h;
             X = Xnew;
             V = Vnew;
@@ -65,8 +65,18 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     bool matrix_is_current;  ///< is the Newton matrix up-to-date?
     bool call_setup;         ///< should the solver's Setup function be called?
 
+    bool jacobian_reuse;          ///< reuse the factored Newton matrix across steps?
+    int jacobian_reuse_iters;     ///< NR iteration count above which the reused matrix is refreshed
+    bool matrix_refresh_needed;   ///< must the Newton matrix be refreshed at the next step?
+    double h_matrix;              ///< stepsize at which the current Newton matrix was assembled
+
+    bool err_control;   ///< use the embedded local error estimate for step size control?
+    double err_prev;    ///< error norm of the previous accepted step (PI memory)
+    int nconstr_prev;   ///< constraint count at the previous call (collision event detection)
+
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
+    ChVectorDynamic<> ewtE;  ///< vector of error weights (local error estimate)
 
   public:
     ChTimestepperHHT(ChIntegrableIIorder* mintegrable = nullptr);
@@ -118,6 +128,30 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// Modified Newton iteration is enabled by default.
     void SetModifiedNewton(bool val) { modified_Newton = val; }
 
+    /// Enable/disable reuse of the factored Newton matrix across steps (default: false).
+    /// Effective only in combination with modified Newton. When enabled, the iteration
+    /// matrix assembled and factorized in one step is kept for the following steps, so
+    /// the (possibly expensive) solver Setup phase is skipped entirely, until convergence
+    /// degrades: a refresh is scheduled whenever a step needs more than  refresh_iters
+    /// NR iterations, and a step that fails to converge with a stale matrix is first
+    /// re-attempted with a refreshed one before the stepsize is reduced. The matrix is
+    /// always refreshed when the internal stepsize changes.
+    void SetJacobianReuse(bool val, int refresh_iters = 3) {
+        jacobian_reuse = val;
+        jacobian_reuse_iters = refresh_iters;
+    }
+
+    /// Enable/disable local error-based step size control (default: disabled).
+    /// Effective only in combination with step size control. When enabled, each converged step
+    /// is additionally subjected to an embedded local truncation error test, based on the
+    /// Zienkiewicz-Xie estimate  e = (beta - 1/6) h^2 (a_new - a_old)  measured in the WRMS
+    /// norm with the tolerances set through SetRelTolerance and SetAbsTolerances. Steps that
+    /// fail the test are rejected and re-attempted with a smaller stepsize; accepted steps
+    /// feed a PI controller which proposes the next stepsize, replacing the iteration-count
+    /// growth heuristic. The stepsize is clamped back to the call step whenever the number of
+    /// constraints changed since the previous call (a collision event).
+    void SetErrorControl(bool val) { err_control = val; }
+
     /// Perform an integration timestep.
     virtual void Advance(const double dt  ///< timestep to advance
                          ) override;
@@ -41,7 +41,17 @@
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 #include <cstring>
+#include <fstream>
+#include <memory>
 #include <utility>
+
+#include <sys/stat.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 using namespace filesystem;
 using namespace rapidxml;
 
@@ -51,6 +61,99 @@ namespace utils {
 using std::cout;
 using std::endl;
 
+// -----------------------------------------------------------------------------
+// Cache of parsed model files, keyed by file name and validated against file
+// size and modification time. The file text is memory-mapped where available
+// (copy-on-write, since rapidxml parses the buffer in place) and DOM-parsed
+// once; repeated Parse() calls on the same model reuse the parsed document.
+// -----------------------------------------------------------------------------
+
+namespace {
+
+struct CachedModelFile {
+    char* data = nullptr;       // XML text (null terminated, parsed in place)
+    size_t size = 0;            // mapped length
+    bool mapped = false;        // memory-mapped (vs. read into storage)?
+    std::vector<char> storage;  // buffer used when not memory-mapped
+    rapidxml::xml_document<> doc;
+    long long file_size = 0;
+    long long file_mtime = 0;
+
+    ~CachedModelFile() {
+#if !defined(_WIN32)
+        if (mapped)
+            munmap(data, size);
+#endif
+    }
+};
+
+static std::map<std::string, std::unique_ptr<CachedModelFile>> model_cache;
+
+// Return the parsed document for the given file, loading and parsing it only if
+// it is not cached yet (or changed on disk since it was cached).
+static rapidxml::xml_document<>* GetParsedModel(const std::string& filename) {
+    long long file_size = 0;
+    long long file_mtime = 0;
+    struct stat st;
+    if (stat(filename.c_str(), &st) == 0) {
+        file_size = (long long)st.st_size;
+        file_mtime = (long long)st.st_mtime;
+    }
+
+    auto cached = model_cache.find(filename);
+    if (cached != model_cache.end() && cached->second->file_size == file_size &&
+        cached->second->file_mtime == file_mtime) {
+        return &cached->second->doc;
+    }
+
+    std::unique_ptr<CachedModelFile> entry(new CachedModelFile);
+    entry->file_size = file_size;
+    entry->file_mtime = file_mtime;
+
+#if !defined(_WIN32)
+    // Memory-map the file (private mapping: rapidxml inserts terminators in
+    // place, which copy-on-write confines to this mapping). The zero fill of
+    // the last page provides the null terminator rapidxml requires; if the
+    // file size is an exact multiple of the page size there is no such byte,
+    // so fall back to a buffered read.
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (file_size > 0 && file_size % page_size != 0) {
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            void* address = mmap(nullptr, (size_t)file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (address != MAP_FAILED) {
+                entry->data = (char*)address;
+                entry->size = (size_t)file_size;
+                entry->mapped = true;
+            }
+        }
+    }
+#endif
+
+    if (!entry->mapped) {
+        std::ifstream stream(filename.c_str(), std::ios::binary);
+        if (!stream.is_open())
+            throw std::runtime_error("Cannot open input file " + filename);
+        entry->storage.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        entry->storage.push_back('\0');
+        entry->data = entry->storage.data();
+        entry->size = entry->storage.size();
+    }
+
+    entry->doc.parse<0>(entry->data);
+
+    auto& slot = model_cache[filename];
+    slot = std::move(entry);
+    return &slot->doc;
+}
+
+}  // end unnamed namespace
+
+void ChParserOpenSim::ClearModelCache() {
+    model_cache.clear();
+}
+
 // -----------------------------------------------------------------------------
 // Constructor for the OpenSim parser.
 // Initializes lambda table.
@@ -71,7 +174,9 @@ ChParserOpenSim::ChParserOpenSim()
       m_kt(2e5),
       m_gn(40),
       m_gt(20),
-      m_datapath("opensim/") {
+      m_datapath("opensim/"),
+      m_defer_vis(false),
+      m_max_depth_level(0) {
     initFunctionTable();
 }
 
@@ -119,10 +224,14 @@ void ChParserOpenSim::Parse(ChSystem& system, const std::string& filename) {
     // Strip the parent and stem to use as directory for data files
     m_datapath = filepath.parent_path().str() + "/" + filepath.stem() + "/";
 
-    rapidxml::file<char> file(filename.c_str());
+    // Reset per-parse state, so that the parser can be reused across models.
+    m_jointList.clear();
+    m_pending_meshes.clear();
 
-    xml_document<> doc;
-    doc.parse<0>(file.data());
+    // Obtain the parsed document for this model. The file is memory-mapped and
+    // DOM-parsed only the first time it is seen in this process; afterwards the
+    // cached document is reused (see GetParsedModel).
+    xml_document<>& doc = *GetParsedModel(filename);
 
     // Get gravity from model and set it in system
     auto elems = strToSTLVector<double>(doc.first_node()->first_node("Model")->first_node("gravity")->value());
@@ -673,9 +782,14 @@ void ChParserOpenSim::initFunctionTable() {
             auto geometry = fieldNode->first_node("GeometrySet")->first_node("objects")->first_node();
             while (geometry != nullptr) {
                 std::string meshFilename(geometry->first_node("geometry_file")->value());
-                auto bodyMesh = std::make_shared<ChObjShapeFile>();
-                bodyMesh->SetFilename(m_datapath + meshFilename);
-                newBody->AddAsset(bodyMesh);
+                if (m_defer_vis) {
+                    // Record only; attached later by CreateVisualizationAssets().
+                    m_pending_meshes.push_back(std::make_pair(newBody, m_datapath + meshFilename));
+                } else {
+                    auto bodyMesh = std::make_shared<ChObjShapeFile>();
+                    bodyMesh->SetFilename(m_datapath + meshFilename);
+                    newBody->AddAsset(bodyMesh);
+                }
                 geometry = geometry->next_sibling();
             }
         }
@@ -710,10 +824,38 @@ struct body_collision_struct {
 // Used for vis shapes
 static std::map<std::string, body_collision_struct> body_collision_info;
 
+// Attach primitive visualization assets (COM sphere and connection cylinders)
+// for a single body, colored by its depth in the joint tree.
+static void addPrimitiveAssets(const body_collision_struct& body_info, int max_depth_level) {
+    // Assign a color based on the body's level in the tree hierarchy
+    float colorVal = (1.0f * body_info.level) / max_depth_level;
+    body_info.body->AddAsset(std::make_shared<ChColorAsset>(colorVal, 1.0f - colorVal, 0.0f));
+
+    // Create a sphere at the body COM
+    auto sphere = std::make_shared<ChSphereShape>();
+    sphere->GetSphereGeometry().rad = 0.1;
+    sphere->Pos = body_info.body->GetFrame_COG_to_REF().GetPos();
+    body_info.body->AddAsset(sphere);
+
+    // Create visualization cylinders
+    for (auto cyl_info : body_info.cylinders) {
+        auto cylinder = std::make_shared<ChCylinderShape>();
+        cylinder->GetCylinderGeometry().rad = cyl_info.rad;
+        cylinder->GetCylinderGeometry().p1 = ChVector<>(0, cyl_info.hlen, 0);
+        cylinder->GetCylinderGeometry().p2 = ChVector<>(0, -cyl_info.hlen, 0);
+        cylinder->Pos = cyl_info.pos;
+        cylinder->Rot = cyl_info.rot;
+        body_info.body->AddAsset(cylinder);
+    }
+}
+
 void ChParserOpenSim::initShapes(rapidxml::xml_node<>* node, ChSystem& system) {
     if (m_verbose)
         std::cout << "Creating collision and visualization shapes " << std::endl;
 
+    // Drop entries from a previous parse; they reference bodies of other models.
+    body_collision_info.clear();
+
     // Keep the maximum depth so that we can color appropriately
     int max_depth_level = 0;
 
@@ -802,32 +944,16 @@ void ChParserOpenSim::initShapes(rapidxml::xml_node<>* node, ChSystem& system) {
         }
     }
 
+    // Remember the tree depth for a later CreateVisualizationAssets() call.
+    m_max_depth_level = max_depth_level;
+
     // Loop through the list of bodies in the model and create visualization and collision shapes
     for (auto body_info_pair : body_collision_info) {
         auto body_info = body_info_pair.second;
 
-        // Create primitive visualization assets
-        if (m_visType == VisType::PRIMITIVES) {
-            // Assign a color based on the body's level in the tree hierarchy
-            float colorVal = (1.0f * body_info.level) / max_depth_level;
-            body_info.body->AddAsset(std::make_shared<ChColorAsset>(colorVal, 1.0f - colorVal, 0.0f));
-
-            // Create a sphere at the body COM
-            auto sphere = std::make_shared<ChSphereShape>();
-            sphere->GetSphereGeometry().rad = 0.1;
-            sphere->Pos = body_info.body->GetFrame_COG_to_REF().GetPos();
-            body_info.body->AddAsset(sphere);
-
-            // Create visualization cylinders
-            for (auto cyl_info : body_info.cylinders) {
-                auto cylinder = std::make_shared<ChCylinderShape>();
-                cylinder->GetCylinderGeometry().rad = cyl_info.rad;
-                cylinder->GetCylinderGeometry().p1 = ChVector<>(0, cyl_info.hlen, 0);
-                cylinder->GetCylinderGeometry().p2 = ChVector<>(0, -cyl_info.hlen, 0);
-                cylinder->Pos = cyl_info.pos;
-                cylinder->Rot = cyl_info.rot;
-                body_info.body->AddAsset(cylinder);
-            }
+        // Create primitive visualization assets (unless deferred)
+        if (m_visType == VisType::PRIMITIVES && !m_defer_vis) {
+            addPrimitiveAssets(body_info, max_depth_level);
         }
 
         // Set collision shapes
@@ -847,5 +973,26 @@ void ChParserOpenSim::initShapes(rapidxml::xml_node<>* node, ChSystem& system) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Attach the visualization assets recorded during a deferred Parse().
+// -----------------------------------------------------------------------------
+
+void ChParserOpenSim::CreateVisualizationAssets() {
+    // Attach mesh assets recorded while parsing the body nodes.
+    for (auto& pending : m_pending_meshes) {
+        auto bodyMesh = std::make_shared<ChObjShapeFile>();
+        bodyMesh->SetFilename(pending.second);
+        pending.first->AddAsset(bodyMesh);
+    }
+    m_pending_meshes.clear();
+
+    // Attach the primitive assets skipped by initShapes().
+    if (m_visType == VisType::PRIMITIVES) {
+        for (auto body_info_pair : body_collision_info) {
+            addPrimitiveAssets(body_info_pair.second, m_max_depth_level);
+        }
+    }
+}
+
 }  // end namespace utils
 }  // end namespace chrono
@@ -123,6 +123,17 @@ class ChApi ChParserOpenSim {
     /// Set body visualization type (default: NONE).
     void SetVisualizationType(VisType val) { m_visType = val; }
 
+    /// Defer creation of visualization assets (default: false).
+    /// When enabled, Parse() records the visualization geometry (primitive shapes
+    /// or mesh file references) but does not attach any asset to the bodies; call
+    /// CreateVisualizationAssets() to attach them later. Headless batch jobs that
+    /// never render can simply skip that call.
+    void SetDeferVisualizationAssets(bool val) { m_defer_vis = val; }
+
+    /// Attach the visualization assets recorded during a deferred Parse().
+    /// No-op if visualization was not deferred or the parser has not run.
+    void CreateVisualizationAssets();
+
     /// Enable/disable verbose parsing output (default: false).
     void SetVerbose(bool val) { m_verbose = val; }
 
@@ -156,6 +167,14 @@ class ChApi ChParserOpenSim {
     /// This method should be invoked only after parsing an osim file.
     void SetExcitationFunction(const std::string& name, std::shared_ptr<ChFunction> modulation);
 
+    /// Drop all cached parsed model files.
+    /// Parse() memory-maps and DOM-parses each input file only the first time it is
+    /// seen in the process and reuses the parsed document afterwards (validated
+    /// against file size and modification time), so batch runs against the same
+    /// model skip the file I/O and XML parsing entirely. Call this to release the
+    /// cached buffers.
+    static void ClearModelCache();
+
   private:
     /// Setup lambda table for body parsing
     void initFunctionTable();
@@ -199,6 +218,12 @@ class ChApi ChParserOpenSim {
 
     bool m_verbose;             ///< verbose output
     VisType m_visType;          ///< body visualization type
+    bool m_defer_vis;           ///< defer creation of visualization assets?
+    int m_max_depth_level;      ///< maximum body depth in the joint tree (for coloring)
+
+    /// Mesh assets recorded during a deferred parse (body and mesh file name).
+    std::vector<std::pair<std::shared_ptr<ChBodyAuxRef>, std::string>> m_pending_meshes;
+
     bool m_collide;             ///< do bodies have collision shapes?
     int m_family_1;             ///< first collision family
     int m_family_2;             ///< second collision family
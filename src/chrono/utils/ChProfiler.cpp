@@ -234,6 +234,8 @@ ChProfileNode	ChProfileManager::Root( "Root", NULL );
 ChProfileNode *	ChProfileManager::CurrentNode = &ChProfileManager::Root;
 int				ChProfileManager::FrameCounter = 0;
 unsigned long int			ChProfileManager::ResetTime = 0;
+bool			ChProfileManager::EventRecording = false;
+std::vector<ChProfileManager::ChProfileEvent>	ChProfileManager::Events;
 
 
 /***********************************************************************************************
@@ -253,9 +255,17 @@ void	ChProfileManager::Start_Profile( const char * name )
 {
 	if (name != CurrentNode->Get_Name()) {
 		CurrentNode = CurrentNode->Get_Sub_Node( name );
-	} 
-	
+	}
+
 	CurrentNode->Call();
+
+	if (EventRecording) {
+		ChProfileEvent ev;
+		ev.Name = name;
+		Profile_Get_Ticks(&ev.Ticks);
+		ev.Phase = 'B';
+		Events.push_back(ev);
+	}
 }
 
 
@@ -264,6 +274,14 @@ void	ChProfileManager::Start_Profile( const char * name )
  *=============================================================================================*/
 void	ChProfileManager::Stop_Profile( void )
 {
+	if (EventRecording) {
+		ChProfileEvent ev;
+		ev.Name = CurrentNode->Get_Name();
+		Profile_Get_Ticks(&ev.Ticks);
+		ev.Phase = 'E';
+		Events.push_back(ev);
+	}
+
 	// Return will indicate whether we should back up to our parent (we may
 	// be profiling a recursive function)
 	if (CurrentNode->Return()) {
@@ -369,6 +387,77 @@ void	ChProfileManager::dumpAll()
 }
 
 
+void	ChProfileManager::dumpJsonRecursive(ChProfileIterator* profileIterator, FILE* f, int indent)
+{
+	profileIterator->First();
+	if (profileIterator->Is_Done())
+		return;
+
+	int numChildren = 0;
+	for ( ; !profileIterator->Is_Done(); profileIterator->Next())
+		numChildren++;
+
+	for (int i=0; i<numChildren; i++)
+	{
+		profileIterator->Enter_Child(i);
+		fprintf(f, "%*s{\"name\": \"%s\", \"total_ms\": %.3f, \"calls\": %d, \"children\": [\n",
+			indent, "",
+			profileIterator->Get_Current_Parent_Name(),
+			profileIterator->Get_Current_Parent_Total_Time(),
+			profileIterator->Get_Current_Parent_Total_Calls());
+		dumpJsonRecursive(profileIterator, f, indent+2);
+		fprintf(f, "%*s]}%s\n", indent, "", (i < numChildren-1) ? "," : "");
+		profileIterator->Enter_Parent();
+	}
+}
+
+
+void	ChProfileManager::dumpJson(const char* filename)
+{
+	FILE* f = fopen(filename, "w");
+	if (!f)
+		return;
+
+	fprintf(f, "{\"name\": \"Root\", \"total_ms\": %.3f, \"frames\": %d, \"children\": [\n",
+		Get_Time_Since_Reset(), FrameCounter);
+
+	ChProfileIterator* profileIterator = ChProfileManager::Get_Iterator();
+	dumpJsonRecursive(profileIterator, f, 2);
+	ChProfileManager::Release_Iterator(profileIterator);
+
+	fprintf(f, "]}\n");
+	fclose(f);
+}
+
+
+void	ChProfileManager::Set_Event_Recording( bool enable )
+{
+	if (enable && !EventRecording) {
+		Events.clear();
+		Events.reserve(65536);
+	}
+	EventRecording = enable;
+}
+
+
+void	ChProfileManager::dumpChromeTracing(const char* filename)
+{
+	FILE* f = fopen(filename, "w");
+	if (!f)
+		return;
+
+	// 'ts' is in microseconds, which is exactly what Profile_Get_Ticks returns.
+	fprintf(f, "{\"traceEvents\":[\n");
+	for (size_t i = 0; i < Events.size(); i++) {
+		fprintf(f, "{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":0,\"tid\":0,\"ts\":%lu}%s\n",
+			Events[i].Name, Events[i].Phase, Events[i].Ticks,
+			(i + 1 < Events.size()) ? "," : "");
+	}
+	fprintf(f, "]}\n");
+	fclose(f);
+}
+
+
 
 
 #endif //CH_NO_PROFILE
@@ -45,6 +45,7 @@ CODE MODIFIED FROM:
 #include <ctime>
 #include <ratio>
 #include <chrono>
+#include <vector>
 #include "chrono/core/ChApiCE.h"
 
 namespace chrono {
@@ -148,11 +149,37 @@ public:
 
 	static void	dumpAll();
 
+	///Write the aggregated profile tree (total time in ms and call count per node,
+	///hierarchically nested) to a JSON file, for scripted regression chasing.
+	static void	dumpJson(const char* filename);
+
+	static void	dumpJsonRecursive(ChProfileIterator* profileIterator, FILE* f, int indent);
+
+	///Enable/disable the recording of individual begin/end timing events, on top of
+	///the always-on aggregation in the profile tree. When disabled (the default) the
+	///overhead is a single branch per profiled scope. Enabling clears previously
+	///recorded events.
+	static	void						Set_Event_Recording( bool enable );
+	static	bool						Get_Event_Recording( void )		{ return EventRecording; }
+
+	///Write the recorded timing events to a JSON file in the 'chrome tracing' format,
+	///to be loaded in the chrome://tracing (or 'Perfetto') timeline viewer.
+	///Timestamps are microseconds since the last Reset().
+	static void	dumpChromeTracing(const char* filename);
+
 private:
+	struct ChProfileEvent {
+		const char *	Name;
+		unsigned long int	Ticks;
+		char			Phase;	// 'B' begin or 'E' end
+	};
+
 	static	ChProfileNode			Root;
 	static	ChProfileNode *			CurrentNode;
 	static	int						FrameCounter;
 	static	unsigned long int					ResetTime;
+	static	bool						EventRecording;
+	static	std::vector<ChProfileEvent>	Events;
 };
 
 
@@ -177,7 +204,7 @@ public:
 }  // end namespace chrono
 
 
-#define	CH_PROFILE( name )			chrono::utils::CProfileSample __ch_profile( name )
+#define	CH_PROFILE( name )			::chrono::utils::CProfileSample __ch_profile( name )
 
 #else
 
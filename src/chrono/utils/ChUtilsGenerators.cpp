@@ -497,6 +497,10 @@ ChVector<> Generator::calcMinSeparation(const ChVector<>& sep) {
 }
 
 // Create objects at the specified locations using the current mixture settings.
+// Body creation is split in three passes so that the expensive per-body work
+// (collision model construction) can run in parallel, while everything that
+// consumes the random engine or global counters stays sequential and produces
+// the exact same bodies as a serial run.
 void Generator::createObjects(const PointVector& points, const ChVector<>& vel) {
     bool check = false;
     std::vector<bool> flags;
@@ -506,7 +510,16 @@ void Generator::createObjects(const PointVector& points, const ChVector<>& vel)
         check = true;
     }
 
-    for (int i = 0; i < points.size(); i++) {
+    int num_points = (int)points.size();
+    std::vector<std::shared_ptr<ChBody>> bodies(num_points);
+    std::vector<int> ingredients(num_points, -1);
+    std::vector<ChVector<>> sizes(num_points);
+    std::vector<double> densities(num_points);
+    std::vector<double> volumes(num_points, 0);
+
+    // First pass (sequential): select the ingredients, allocate the bodies, and
+    // draw all random quantities (materials, sizes, densities) in point order.
+    for (int i = 0; i < num_points; i++) {
         if (check && !flags[i])
             continue;
 
@@ -529,6 +542,23 @@ void Generator::createObjects(const PointVector& points, const ChVector<>& vel)
         // Set identifier
         body->SetIdentifier(m_crtBodyId++);
 
+        ingredients[i] = index;
+        bodies[i] = std::shared_ptr<ChBody>(body);
+        sizes[i] = m_mixture[index]->getSize();
+        densities[i] = m_mixture[index]->getDensity();
+    }
+
+    // Second pass (parallel): initial state, mass properties, and collision
+    // model construction are independent per body.
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int i = 0; i < num_points; i++) {
+        if (!bodies[i])
+            continue;
+
+        ChBody* body = bodies[i].get();
+        int index = ingredients[i];
+        const ChVector<>& size = sizes[i];
+
         // Set position and orientation
         body->SetPos(points[i]);
         body->SetRot(ChQuaternion<>(1, 0, 0, 0));
@@ -536,19 +566,15 @@ void Generator::createObjects(const PointVector& points, const ChVector<>& vel)
         body->SetBodyFixed(false);
         body->SetCollide(true);
 
-        // Get size and density; calculate geometric properties
-        ChVector<> size = m_mixture[index]->getSize();
-        double density = m_mixture[index]->getDensity();
+        // Calculate geometric properties and set mass properties
         double volume;
         ChVector<> gyration;
         m_mixture[index]->calcGeometricProps(size, volume, gyration);
-        double mass = density * volume;
+        double mass = densities[i] * volume;
 
-        // Set mass properties
         body->SetMass(mass);
         body->SetInertiaXX(mass * gyration);
-        m_totalMass += mass;
-        m_totalVolume += volume;
+        volumes[i] = volume;
 
         // Add collision geometry
         body->GetCollisionModel()->ClearModel();
@@ -581,18 +607,27 @@ void Generator::createObjects(const PointVector& points, const ChVector<>& vel)
         }
 
         body->GetCollisionModel()->BuildModel();
+    }
+
+    // Third pass (sequential): attach the bodies to the system in point order,
+    // invoke the user callbacks, and update the accounting.
+    for (int i = 0; i < num_points; i++) {
+        if (!bodies[i])
+            continue;
+
+        int index = ingredients[i];
 
-        // Attach the body to the system and append to list of generated bodies.
-        std::shared_ptr<ChBody> bodyPtr(body);
+        m_totalMass += bodies[i]->GetMass();
+        m_totalVolume += volumes[i];
 
-        m_system->AddBody(bodyPtr);
+        m_system->AddBody(bodies[i]);
 
         // If the callback pointer is set, call the function with the body pointer
         if (m_mixture[index]->add_body_callback) {
-            m_mixture[index]->add_body_callback->OnAddBody(bodyPtr);
+            m_mixture[index]->add_body_callback->OnAddBody(bodies[i]);
         }
 
-        m_bodies.push_back(BodyInfo(m_mixture[index]->m_type, density, size, bodyPtr));
+        m_bodies.push_back(BodyInfo(m_mixture[index]->m_type, densities[i], sizes[i], bodies[i]));
     }
 
     m_totalNumBodies += (unsigned int)points.size();
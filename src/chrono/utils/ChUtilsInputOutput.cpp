@@ -21,19 +21,77 @@
 namespace chrono {
 namespace utils {
 
+// -----------------------------------------------------------------------------
+// ChAsyncWriter
+//
+// Background output worker with back-pressure.
+// -----------------------------------------------------------------------------
+ChAsyncWriter::ChAsyncWriter(size_t max_pending_bytes)
+    : m_pending(0), m_max_pending(max_pending_bytes), m_busy(false), m_stop(false) {
+    m_worker = std::thread(&ChAsyncWriter::WorkerLoop, this);
+}
+
+ChAsyncWriter::~ChAsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_worker.notify_all();
+    m_worker.join();
+}
+
+void ChAsyncWriter::QueueWrite(const std::string& filename, std::string&& content, const std::string& header) {
+    size_t cost = content.size() + header.size();
+    QueueTask(cost, [filename, header, blob = std::move(content)]() {
+        std::ofstream ofile(filename.c_str());
+        ofile << header;
+        ofile << blob;
+        ofile.close();
+    });
+}
+
+void ChAsyncWriter::QueueTask(size_t cost, std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Back-pressure: wait until the job fits under the pending limit. A single
+    // job larger than the limit is still accepted once the queue is empty, so
+    // that it cannot block forever.
+    m_cv_space.wait(lock, [&] { return m_pending == 0 || m_pending + cost <= m_max_pending; });
+    m_pending += cost;
+    m_jobs.push_back({cost, std::move(task)});
+    m_cv_worker.notify_one();
+}
+
+void ChAsyncWriter::Flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_space.wait(lock, [&] { return m_jobs.empty() && !m_busy; });
+}
+
+void ChAsyncWriter::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv_worker.wait(lock, [&] { return m_stop || !m_jobs.empty(); });
+        // Drain the queue completely before honoring a stop request.
+        if (m_jobs.empty())
+            break;
+        Job job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        m_busy = true;
+        lock.unlock();
+        job.task();
+        lock.lock();
+        m_busy = false;
+        m_pending -= job.cost;
+        m_cv_space.notify_all();
+    }
+}
+
 // -----------------------------------------------------------------------------
 // WriteBodies
 //
 // Write to a CSV file pody position, orientation, and (optionally) linear and
 // angular velocity. Optionally, only active bodies are processed.
 // -----------------------------------------------------------------------------
-void WriteBodies(ChSystem* system,
-                 const std::string& filename,
-                 bool active_only,
-                 bool dump_vel,
-                 const std::string& delim) {
-    CSV_writer csv(delim);
-
+static void FormatBodies(ChSystem* system, bool active_only, bool dump_vel, CSV_writer& csv) {
     for (auto body : system->Get_bodylist()) {
         if (active_only && !body->IsActive())
             continue;
@@ -42,20 +100,36 @@ void WriteBodies(ChSystem* system,
             csv << body->GetPos_dt() << body->GetWvel_loc();
         csv << std::endl;
     }
+}
 
+void WriteBodies(ChSystem* system,
+                 const std::string& filename,
+                 bool active_only,
+                 bool dump_vel,
+                 const std::string& delim) {
+    CSV_writer csv(delim);
+    FormatBodies(system, active_only, dump_vel, csv);
     csv.write_to_file(filename);
 }
 
+void WriteBodies(ChSystem* system,
+                 const std::string& filename,
+                 ChAsyncWriter& writer,
+                 bool active_only,
+                 bool dump_vel,
+                 const std::string& delim) {
+    CSV_writer csv(delim);
+    FormatBodies(system, active_only, dump_vel, csv);
+    csv.write_to_file(writer, filename);
+}
+
 // -----------------------------------------------------------------------------
 // WriteCheckpoint
 //
 // Create a CSV file with a checkpoint ...
 //
 // -----------------------------------------------------------------------------
-bool WriteCheckpoint(ChSystem* system, const std::string& filename) {
-    // Create the CSV stream.
-    CSV_writer csv(" ");
-
+static bool FormatCheckpoint(ChSystem* system, CSV_writer& csv) {
     for (auto body : system->Get_bodylist()) {
         // Infer body type (0: NSC, 1:SMC)
         int btype = (body->GetContactMethod() == ChMaterialSurface::NSC) ? 0 : 1;
@@ -141,11 +215,35 @@ bool WriteCheckpoint(ChSystem* system, const std::string& filename) {
         }
     }
 
+    return true;
+}
+
+bool WriteCheckpoint(ChSystem* system, const std::string& filename) {
+    // Create the CSV stream.
+    CSV_writer csv(" ");
+
+    if (!FormatCheckpoint(system, csv))
+        return false;
+
     csv.write_to_file(filename);
 
     return true;
 }
 
+bool WriteCheckpoint(ChSystem* system, const std::string& filename, ChAsyncWriter& writer) {
+    // Checkpoint data (velocities, materials, collision families) must be read
+    // while the system is in a consistent state, so formatting stays on the
+    // caller thread and only the file write is offloaded.
+    CSV_writer csv(" ");
+
+    if (!FormatCheckpoint(system, csv))
+        return false;
+
+    csv.write_to_file(writer, filename);
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ReadCheckpoint
 //
@@ -331,29 +429,57 @@ enum POVRayLinkType {
     SPRING_CB = 7
 };
 
-void WriteShapesPovray(ChSystem* system, const std::string& filename, bool body_info, const std::string& delim) {
-    CSV_writer csv(delim);
+// Snapshot of the state of one body, in the order of the system body list.
+// This is the only simulation state the asset output lines depend on, so it is
+// what the asynchronous variant captures before handing off the formatting.
+struct BodyFrameState {
+    int id;                ///< body identifier
+    bool active;           ///< body active flag
+    ChVector<> pos;        ///< position of the body REF frame, absolute
+    ChQuaternion<> rot;    ///< orientation of the body REF frame, absolute
+};
 
+static void CaptureBodyFrames(ChSystem* system, std::vector<BodyFrameState>& frames) {
+    frames.clear();
+    for (auto body : system->Get_bodylist()) {
+        BodyFrameState frame;
+        frame.id = body->GetIdentifier();
+        frame.active = body->IsActive();
+        frame.pos = body->GetFrame_REF_to_abs().GetPos();
+        frame.rot = body->GetFrame_REF_to_abs().GetRot();
+        frames.push_back(frame);
+    }
+}
+
+// Format the body and asset lines from the given body frame snapshot. Asset
+// geometry is read from the system, which is safe while the simulation steps
+// since asset shapes are static; all per-step state comes from the snapshot.
+static void FormatShapesPovray(ChSystem* system,
+                               const std::vector<BodyFrameState>& frames,
+                               bool body_info,
+                               const std::string& delim,
+                               CSV_writer& csv,
+                               int& b_count,
+                               int& a_count) {
     // If requested, Loop over all bodies and write out their position and
     // orientation.  Otherwise, body count is left at 0.
-    int b_count = 0;
+    b_count = 0;
 
     if (body_info) {
-        for (auto body : system->Get_bodylist()) {
-            const ChVector<>& body_pos = body->GetFrame_REF_to_abs().GetPos();
-            const ChQuaternion<>& body_rot = body->GetFrame_REF_to_abs().GetRot();
-
-            csv << body->GetIdentifier() << body->IsActive() << body_pos << body_rot << std::endl;
+        for (const auto& frame : frames) {
+            csv << frame.id << frame.active << frame.pos << frame.rot << std::endl;
 
             b_count++;
         }
     }
 
     // Loop over all bodies and over all their assets.
-    int a_count = 0;
+    a_count = 0;
+    size_t ib = 0;
     for (auto body : system->Get_bodylist()) {
-        const ChVector<>& body_pos = body->GetFrame_REF_to_abs().GetPos();
-        const ChQuaternion<>& body_rot = body->GetFrame_REF_to_abs().GetRot();
+        const BodyFrameState& frame = frames[ib++];
+        const ChVector<>& body_pos = frame.pos;
+        const ChQuaternion<>& body_rot = frame.rot;
 
         ChColor color(0.8f, 0.8f, 0.8f);
 
@@ -427,13 +553,17 @@ void WriteShapesPovray(ChSystem* system, const std::string& filename, bool body_
             }
 
             if (supported) {
-                csv << body->GetIdentifier() << body->IsActive() << pos << rot << color << gss.str() << std::endl;
+                csv << frame.id << frame.active << pos << rot << color << gss.str() << std::endl;
             }
         }
     }
+}
 
+// Format the link lines. Reads the live marker frames, so this is always done
+// on the caller thread, together with the body frame capture.
+static void FormatLinksPovray(ChSystem* system, CSV_writer& csv, int& l_count) {
     // Loop over all links.  Write information on selected types of links.
-    int l_count = 0;
+    l_count = 0;
     for (auto ilink : system->Get_linklist()) {
         if (auto link = std::dynamic_pointer_cast<ChLinkLockRevolute>(ilink)) {
             chrono::ChFrame<> frA_abs = *(link->GetMarker1()) >> *(link->GetBody1());
@@ -484,6 +614,17 @@ void WriteShapesPovray(ChSystem* system, const std::string& filename, bool body_
             l_count++;
         }
     }
+}
+
+void WriteShapesPovray(ChSystem* system, const std::string& filename, bool body_info, const std::string& delim) {
+    CSV_writer csv(delim);
+
+    std::vector<BodyFrameState> frames;
+    CaptureBodyFrames(system, frames);
+
+    int b_count, a_count, l_count;
+    FormatShapesPovray(system, frames, body_info, delim, csv, b_count, a_count);
+    FormatLinksPovray(system, csv, l_count);
 
     // Write the output file, including a first line with number of bodies, visual
     // assets, and links.
@@ -493,6 +634,39 @@ void WriteShapesPovray(ChSystem* system, const std::string& filename, bool body_
     csv.write_to_file(filename, header.str());
 }
 
+void WriteShapesPovray(ChSystem* system,
+                       const std::string& filename,
+                       ChAsyncWriter& writer,
+                       bool body_info,
+                       const std::string& delim) {
+    // Capture the per-step body state; everything else the asset lines need
+    // (asset geometry, identifiers) is constant while the simulation steps.
+    auto frames = std::make_shared<std::vector<BodyFrameState>>();
+    CaptureBodyFrames(system, *frames);
+
+    // The link lines read the live marker frames, so format them now; there are
+    // typically few links compared to assets.
+    CSV_writer csv_links(delim);
+    int l_count;
+    FormatLinksPovray(system, csv_links, l_count);
+    auto links_part = std::make_shared<std::string>(csv_links.stream().str());
+
+    // Offload the asset formatting and the file write. The cost estimate
+    // approximates the size of the formatted output for back-pressure purposes.
+    size_t cost = frames->size() * 160 + links_part->size();
+    writer.QueueTask(cost, [system, filename, body_info, delim, frames, links_part, l_count]() {
+        CSV_writer csv(delim);
+        int b_count, a_count;
+        FormatShapesPovray(system, *frames, body_info, delim, csv, b_count, a_count);
+        csv.stream() << *links_part;
+
+        std::stringstream header;
+        header << b_count << delim << a_count << delim << l_count << delim << std::endl;
+
+        csv.write_to_file(filename, header.str());
+    });
+}
+
 // -----------------------------------------------------------------------------
 // WriteMeshPovray
 //
@@ -38,6 +38,11 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChBezierCurve.h"
@@ -47,6 +52,55 @@
 namespace chrono {
 namespace utils {
 
+// -----------------------------------------------------------------------------
+// ChAsyncWriter
+//
+// Background worker that performs output work off the simulation thread.
+// Output jobs (typically an already formatted blob to be written to a file, or
+// a deferred formatting task) are queued with an estimated memory cost; the
+// queueing call blocks when the total cost of the pending jobs exceeds the
+// given limit, so a disk that falls behind throttles the producer instead of
+// exhausting memory. The destructor drains the queue before returning.
+// -----------------------------------------------------------------------------
+class ChApi ChAsyncWriter {
+ public:
+  /// Create the writer and start its worker thread. The limit caps the total
+  /// estimated size of the queued, not yet written jobs (back-pressure).
+  explicit ChAsyncWriter(size_t max_pending_bytes = size_t(1) << 28);
+
+  /// Wait for all pending output to complete and stop the worker thread.
+  ~ChAsyncWriter();
+
+  /// Queue already formatted content to be written to the given file.
+  /// Blocks while the pending jobs exceed the back-pressure limit.
+  void QueueWrite(const std::string& filename, std::string&& content, const std::string& header = "");
+
+  /// Queue an arbitrary output task with the given estimated memory cost.
+  /// Blocks while the pending jobs exceed the back-pressure limit.
+  void QueueTask(size_t cost, std::function<void()> task);
+
+  /// Block until every queued job has completed.
+  void Flush();
+
+ private:
+  void WorkerLoop();
+
+  struct Job {
+    size_t cost;
+    std::function<void()> task;
+  };
+
+  std::deque<Job> m_jobs;         ///< queued, not yet completed jobs
+  size_t m_pending;               ///< total estimated cost of the queued jobs
+  size_t m_max_pending;           ///< back-pressure limit on the pending cost
+  bool m_busy;                    ///< worker is executing a job
+  bool m_stop;                    ///< worker shutdown request
+  std::mutex m_mutex;
+  std::condition_variable m_cv_worker;  ///< signaled when a job is queued or stop requested
+  std::condition_variable m_cv_space;   ///< signaled when a job completed
+  std::thread m_worker;
+};
+
 // -----------------------------------------------------------------------------
 // CSV_writer
 //
@@ -71,6 +125,14 @@ class ChApi CSV_writer {
     ofile.close();
   }
 
+  // Hand the accumulated content to the given background writer and reset the
+  // stream, so the caller can immediately start formatting the next frame.
+  void write_to_file(ChAsyncWriter& writer, const std::string& filename, const std::string& header = "") {
+    writer.QueueWrite(filename, m_ss.str(), header);
+    m_ss.str("");
+    m_ss.clear();
+  }
+
   const std::string& delim() const { return m_delim; }
   std::ostringstream& stream() { return m_ss; }
 
@@ -135,10 +197,25 @@ void WriteBodies(ChSystem* system,
                  bool dump_vel = false,
                  const std::string& delim = ",");
 
+// Same as above, but formatting on the caller thread and writing through the
+// given background writer.
+ChApi
+void WriteBodies(ChSystem* system,
+                 const std::string& filename,
+                 ChAsyncWriter& writer,
+                 bool active_only = false,
+                 bool dump_vel = false,
+                 const std::string& delim = ",");
+
 // Create a CSV file with a checkpoint...
 ChApi
 bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 
+// Same as above, but formatting on the caller thread and writing through the
+// given background writer.
+ChApi
+bool WriteCheckpoint(ChSystem* system, const std::string& filename, ChAsyncWriter& writer);
+
 // Read a CSV file with a checkpoint...
 ChApi
 void ReadCheckpoint(ChSystem* system, const std::string& filename);
@@ -154,6 +231,17 @@ void WriteShapesPovray(ChSystem* system,
                        bool body_info = true,
                        const std::string& delim = ",");
 
+// Same as above, but offloading the formatting and writing of the asset lines
+// to the given background writer. Only the body frames are snapshotted on the
+// caller thread; the background task formats the (static) asset geometry from
+// that snapshot while the simulation keeps stepping.
+ChApi
+void WriteShapesPovray(ChSystem* system,
+                       const std::string& filename,
+                       ChAsyncWriter& writer,
+                       bool body_info = true,
+                       const std::string& delim = ",");
+
 // Write the specified mesh as a macro in a PovRay include file. The output file
 // will be "[out_dir]/[mesh_name].inc". The mesh vertices will be transformed to
 // the frame with specified offset and orientation.
@@ -282,21 +282,26 @@ class PDSampler : public Sampler<T> {
 
         // As long as there are active points...
         while (m_active.size() != 0) {
-            // ... select one of them at random
+            // ... select one of them at random (by index, so that selection and
+            // removal are O(1) regardless of the size of the active list)
             std::uniform_int_distribution<int> intDist(0, (int)m_active.size() - 1);
 
-            typename PointList::iterator point = m_active.begin();
-            std::advance(point, intDist(rengine()));
+            int idx = intDist(rengine());
+            ChVector<T> point = m_active[idx];
 
             // ... attempt to add points near the active one
             bool found = false;
 
             for (int k = 0; k < m_ppi; k++)
-                found |= AddNextPoint(t, *point, out_points);
-
-            // ... if not possible, remove the current active point
-            if (!found)
-                m_active.erase(point);
+                found |= AddNextPoint(t, point, out_points);
+
+            // ... if not possible, remove the current active point (swap with
+            // the last one; the active list is sampled randomly, so its order
+            // is irrelevant)
+            if (!found) {
+                m_active[idx] = m_active.back();
+                m_active.pop_back();
+            }
         }
 
         return out_points;
@@ -406,7 +411,7 @@ class PDSampler : public Sampler<T> {
     }
 
     PDGrid<ChVector<T>> m_grid;
-    PointList m_active;
+    PointVector m_active;
 
     Direction2D m_2D;  ///< 2D or 3D sampling
     ChVector<T> m_bl;  ///< bottom-left corner of sampling domain
@@ -0,0 +1,358 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "chrono_cascade/ChCascadeFlattener.h"
+
+#include "chrono/assets/ChAssetLevel.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMarkers.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/utils/ChCompositeInertia.h"
+
+namespace chrono {
+namespace cascade {
+
+// A link is a rigid joint (removable after merging its two bodies) if it
+// constrains all six relative DOFs with no imposed motion.
+static bool IsRigidJoint(ChLink* link) {
+    if (dynamic_cast<ChLinkMateFix*>(link))
+        return true;
+    if (dynamic_cast<ChLinkLockLock*>(link))
+        return true;
+    return false;
+}
+
+void ChCascadeFlattener::DecimateMesh(geometry::ChTriangleMeshConnected& mesh, double cell) {
+    if (cell <= 0)
+        return;
+
+    std::vector<ChVector<double>>& vertices = mesh.getCoordsVertices();
+    std::vector<ChVector<int>>& faces = mesh.getIndicesVertexes();
+
+    // Cluster vertices on a uniform grid: all vertices falling in the same
+    // cell collapse onto their average.
+    struct Cluster {
+        ChVector<> sum;
+        int count;
+        int new_index;
+    };
+    std::map<std::array<long, 3>, Cluster> clusters;
+    std::vector<int> remap(vertices.size());
+
+    for (size_t iv = 0; iv < vertices.size(); ++iv) {
+        std::array<long, 3> key = {(long)std::floor(vertices[iv].x() / cell),
+                                   (long)std::floor(vertices[iv].y() / cell),
+                                   (long)std::floor(vertices[iv].z() / cell)};
+        auto ins = clusters.insert({key, {VNULL, 0, (int)clusters.size()}});
+        Cluster& cl = ins.first->second;
+        cl.sum += vertices[iv];
+        cl.count++;
+        remap[iv] = cl.new_index;
+    }
+
+    std::vector<ChVector<double>> new_vertices(clusters.size());
+    for (auto& kv : clusters)
+        new_vertices[kv.second.new_index] = kv.second.sum / kv.second.count;
+
+    std::vector<ChVector<int>> new_faces;
+    new_faces.reserve(faces.size());
+    for (auto& f : faces) {
+        ChVector<int> nf(remap[f.x()], remap[f.y()], remap[f.z()]);
+        // drop triangles collapsed to an edge or a point
+        if (nf.x() != nf.y() && nf.y() != nf.z() && nf.z() != nf.x())
+            new_faces.push_back(nf);
+    }
+
+    vertices.swap(new_vertices);
+    faces.swap(new_faces);
+}
+
+bool ChCascadeFlattener::MergeGroup(ChSystem& system,
+                                    const std::vector<std::shared_ptr<ChBody>>& group,
+                                    std::shared_ptr<ChBodyAuxRef> anchor,
+                                    const std::vector<std::shared_ptr<ChLink>>& internal_links,
+                                    double decimation_cell,
+                                    Report& report) {
+    ChFrame<> anchor_ref_abs = anchor->GetFrame_REF_to_abs();
+    ChFrame<> anchor_ref_inv = anchor_ref_abs.GetInverse();
+
+    std::unordered_set<ChBodyFrame*> in_group;
+    for (auto& body : group)
+        in_group.insert(body.get());
+    std::unordered_set<ChLink*> internal;
+    for (auto& link : internal_links)
+        internal.insert(link.get());
+
+    // ---- Scan all links touching the group and plan their re-attachment,
+    //      before modifying anything: if any of them cannot be handled, the
+    //      whole group is skipped and the system is left untouched.
+
+    // Mate links get re-initialized from their absolute frames (recorded now,
+    // since the anchor COG will move). Mates attached to the anchor itself are
+    // included: their frames are stored relative to the COG and go stale too.
+    struct MateReinit {
+        std::shared_ptr<ChLinkMateGeneric> link;
+        std::shared_ptr<ChBody> body1;
+        std::shared_ptr<ChBody> body2;
+        ChFrame<> frame1_abs;
+        ChFrame<> frame2_abs;
+    };
+    std::vector<MateReinit> mate_reinits;
+
+    // Marker-based links keep their marker objects: the markers sitting on an
+    // absorbed body are re-parented to the anchor at unchanged absolute pose,
+    // then the link refreshes its cached body pointers.
+    struct MarkerMove {
+        std::shared_ptr<ChMarker> marker;
+        std::shared_ptr<ChBody> old_body;
+    };
+    std::vector<MarkerMove> marker_moves;
+    std::vector<ChLinkMarkers*> marker_links;
+
+    auto find_body = [&](ChBodyFrame* bf) -> std::shared_ptr<ChBody> {
+        for (auto& body : system.Get_bodylist())
+            if (static_cast<ChBodyFrame*>(body.get()) == bf)
+                return body;
+        return nullptr;
+    };
+
+    for (auto& link : system.Get_linklist()) {
+        if (internal.count(link.get()))
+            continue;
+        ChBodyFrame* lb1 = link->GetBody1();
+        ChBodyFrame* lb2 = link->GetBody2();
+        bool in1 = in_group.count(lb1) != 0;
+        bool in2 = in_group.count(lb2) != 0;
+        if (!in1 && !in2)
+            continue;
+        if (in1 && in2)  // non-rigid link internal to the group: would become a self-link
+            return false;
+
+        if (auto mate = std::dynamic_pointer_cast<ChLinkMateGeneric>(link)) {
+            MateReinit mr;
+            mr.link = mate;
+            mr.body1 = in1 ? std::static_pointer_cast<ChBody>(anchor) : find_body(lb1);
+            mr.body2 = in2 ? std::static_pointer_cast<ChBody>(anchor) : find_body(lb2);
+            if (!mr.body1 || !mr.body2)
+                return false;
+            mr.frame1_abs = ChFrame<>(lb1->GetCoord()) * mate->GetFrame1();
+            mr.frame2_abs = ChFrame<>(lb2->GetCoord()) * mate->GetFrame2();
+            mate_reinits.push_back(mr);
+        } else if (auto mlink = std::dynamic_pointer_cast<ChLinkMarkers>(link)) {
+            ChMarker* group_marker = in1 ? mlink->GetMarker1() : mlink->GetMarker2();
+            if (!group_marker)
+                return false;
+            std::shared_ptr<ChBody> owner = find_body(in1 ? lb1 : lb2);
+            if (!owner)
+                return false;
+            if (owner != std::static_pointer_cast<ChBody>(anchor)) {
+                // find the shared pointer owning this marker
+                std::shared_ptr<ChMarker> marker_sp;
+                for (auto& mk : owner->GetMarkerList())
+                    if (mk.get() == group_marker)
+                        marker_sp = mk;
+                if (!marker_sp)
+                    return false;
+                marker_moves.push_back({marker_sp, owner});
+            }
+            marker_links.push_back(mlink.get());
+        } else {
+            return false;  // external link of a type we cannot re-attach
+        }
+    }
+
+    // ---- Composite mass properties about the anchor REF frame.
+
+    utils::CompositeInertia composite;
+    for (auto& body : group) {
+        ChFrame<> cog_rel = anchor_ref_inv * ChFrame<>(body->GetCoord());
+        composite.AddComponent(cog_rel, body->GetMass(), body->GetInertia());
+    }
+
+    anchor->SetMass(composite.GetMass());
+    anchor->SetInertia(composite.GetInertia());
+    // Keep the anchor REF where it is and move only the COG; markers already
+    // attached to the anchor are compensated by SetFrame_COG_to_REF itself.
+    anchor->SetFrame_COG_to_REF(ChFrame<>(composite.GetCOM(), QUNIT));
+
+    // ---- Re-attach the external links.
+
+    for (auto& mr : mate_reinits)
+        mr.link->Initialize(mr.body1, mr.body2, false, mr.frame1_abs, mr.frame2_abs);
+
+    for (auto& mv : marker_moves) {
+        Coordsys abs_coord = mv.marker->GetAbsCoord();
+        mv.old_body->RemoveMarker(mv.marker);
+        anchor->AddMarker(mv.marker);
+        mv.marker->Impose_Abs_Coord(abs_coord);
+    }
+    for (auto* mlink : marker_links)
+        mlink->SetUpMarkers(mlink->GetMarker1(), mlink->GetMarker2());
+
+    // ---- Move visualization assets onto the anchor, baking the (constant)
+    //      relative transform of each absorbed part into a ChAssetLevel.
+    //      Also merge the collision triangle meshes, expressed in the anchor
+    //      REF frame, into a single mesh.
+
+    bool any_collide = anchor->GetCollide();
+    auto merged_mesh = std::make_shared<geometry::ChTriangleMeshConnected>();
+
+    for (auto& body : group) {
+        ChFrame<> rel = anchor_ref_inv * body->GetAssetsFrame();
+
+        if (body->GetCollide()) {
+            any_collide = true;
+            for (auto& asset : body->GetAssets()) {
+                if (auto mesh_shape = std::dynamic_pointer_cast<ChTriangleMeshShape>(asset)) {
+                    auto mesh = mesh_shape->GetMesh();
+                    for (auto& f : mesh->getIndicesVertexes()) {
+                        merged_mesh->addTriangle(rel * mesh->getCoordsVertices()[f.x()],
+                                                 rel * mesh->getCoordsVertices()[f.y()],
+                                                 rel * mesh->getCoordsVertices()[f.z()]);
+                    }
+                }
+            }
+        }
+
+        if (body != std::static_pointer_cast<ChBody>(anchor) && !body->GetAssets().empty()) {
+            auto level = std::make_shared<ChAssetLevel>();
+            level->GetFrame() = rel;
+            for (auto& asset : body->GetAssets())
+                level->AddAsset(asset);
+            anchor->AddAsset(level);
+        }
+    }
+
+    if (any_collide && !merged_mesh->getIndicesVertexes().empty()) {
+        DecimateMesh(*merged_mesh, decimation_cell);
+        anchor->GetCollisionModel()->ClearModel();
+        anchor->GetCollisionModel()->AddTriangleMesh(merged_mesh, false, false);
+        anchor->GetCollisionModel()->BuildModel();
+        anchor->SetCollide(true);
+    }
+
+    // ---- Drop the internal rigid joints and the absorbed bodies.
+
+    for (auto& link : internal_links) {
+        system.RemoveLink(link);
+        report.num_links_removed++;
+    }
+    for (auto& body : group) {
+        if (body != std::static_pointer_cast<ChBody>(anchor)) {
+            system.RemoveBody(body);
+            report.num_bodies_removed++;
+        }
+    }
+    report.num_groups++;
+    return true;
+}
+
+ChCascadeFlattener::Report ChCascadeFlattener::FlattenRigidSubtrees(ChSystem& system, double decimation_cell) {
+    Report report = {0, 0, 0, 0};
+
+    // Snapshot the body and link lists: merging modifies the system lists.
+    std::vector<std::shared_ptr<ChBody>> bodies = system.Get_bodylist();
+    std::vector<std::shared_ptr<ChLink>> links = system.Get_linklist();
+
+    // Union-find over the bodies, joined through the rigid links.
+    std::unordered_map<ChBodyFrame*, int> body_index;
+    for (size_t ib = 0; ib < bodies.size(); ++ib)
+        body_index[static_cast<ChBodyFrame*>(bodies[ib].get())] = (int)ib;
+
+    std::vector<int> parent(bodies.size());
+    for (size_t ib = 0; ib < bodies.size(); ++ib)
+        parent[ib] = (int)ib;
+    std::function<int(int)> find_root = [&](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    for (auto& link : links) {
+        if (!IsRigidJoint(link.get()))
+            continue;
+        auto it1 = body_index.find(link->GetBody1());
+        auto it2 = body_index.find(link->GetBody2());
+        if (it1 == body_index.end() || it2 == body_index.end())
+            continue;
+        parent[find_root(it1->second)] = find_root(it2->second);
+    }
+
+    std::unordered_map<int, std::vector<std::shared_ptr<ChBody>>> groups;
+    for (size_t ib = 0; ib < bodies.size(); ++ib)
+        groups[find_root((int)ib)].push_back(bodies[ib]);
+
+    for (auto& kv : groups) {
+        const std::vector<std::shared_ptr<ChBody>>& group = kv.second;
+        if (group.size() < 2)
+            continue;
+
+        std::unordered_set<ChBodyFrame*> in_group;
+        for (auto& body : group)
+            in_group.insert(body.get());
+
+        // Internal rigid joints of this group, and the number of external
+        // attachments of each body (used to pick the anchor).
+        std::vector<std::shared_ptr<ChLink>> internal_links;
+        std::unordered_map<ChBodyFrame*, int> num_external;
+        for (auto& link : links) {
+            bool in1 = in_group.count(link->GetBody1()) != 0;
+            bool in2 = in_group.count(link->GetBody2()) != 0;
+            if (in1 && in2 && IsRigidJoint(link.get()))
+                internal_links.push_back(link);
+            else if (in1 != in2)
+                num_external[in1 ? link->GetBody1() : link->GetBody2()]++;
+        }
+
+        // Anchor: a ChBodyAuxRef of the group (needed to relocate the COG
+        // while keeping the reference frame and the attached geometry fixed),
+        // preferring the body with the most external attachments. If the
+        // group contains fixed bodies the anchor must be one of them, so that
+        // the merged body stays fixed.
+        bool group_fixed = false;
+        for (auto& body : group)
+            group_fixed = group_fixed || body->GetBodyFixed();
+
+        std::shared_ptr<ChBodyAuxRef> anchor;
+        int best_score = -1;
+        for (auto& body : group) {
+            auto aux = std::dynamic_pointer_cast<ChBodyAuxRef>(body);
+            if (!aux)
+                continue;
+            if (group_fixed && !body->GetBodyFixed())
+                continue;
+            int score = num_external[body.get()];
+            if (score > best_score) {
+                best_score = score;
+                anchor = aux;
+            }
+        }
+
+        if (!anchor || !MergeGroup(system, group, anchor, internal_links, decimation_cell, report))
+            report.num_groups_skipped++;
+    }
+
+    return report;
+}
+
+}  // end namespace cascade
+}  // end namespace chrono
@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHCASCADEFLATTENER_H
+#define CHCASCADEFLATTENER_H
+
+#include "chrono_cascade/ChApiCASCADE.h"
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChBodyAuxRef.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace cascade {
+
+/// @addtogroup cascade_module
+/// @{
+
+/// Post-import flattening of rigidly-joined assemblies.
+/// STEP files exported from CAD often model one physically rigid part as a
+/// deep subtree of sub-bodies held together by fixed mates; importing such
+/// a file one body per shape creates many bodies and many 6-DOF constraints
+/// that only waste solver iterations. This class collapses every group of
+/// bodies connected through rigid joints (ChLinkMateFix, ChLinkLockLock)
+/// into a single body: the group's composite mass, center of mass and
+/// inertia tensor are computed with utils::CompositeInertia and assigned to
+/// one surviving 'anchor' body, visualization assets of the absorbed bodies
+/// are re-parented to the anchor (wrapped in a ChAssetLevel carrying the
+/// baked relative transform), their collision triangle meshes are merged
+/// into one mesh expressed in the anchor reference frame, and links that
+/// connected an absorbed body to the outside are re-attached to the anchor.
+/// The internal rigid joints and the absorbed bodies are then removed from
+/// the system. Simulation results are identical (the removed constraints
+/// were exactly rigid) but the body and constraint counts drop to what the
+/// mechanism actually needs.
+class ChApiCASCADE ChCascadeFlattener {
+  public:
+    /// Statistics returned by FlattenRigidSubtrees().
+    struct Report {
+        int num_groups;          ///< rigid groups that were merged
+        int num_bodies_removed;  ///< bodies absorbed into their group anchor
+        int num_links_removed;   ///< internal rigid joints removed
+        int num_groups_skipped;  ///< groups left untouched (no usable anchor,
+                                 ///< or an external link of unsupported type)
+    };
+
+    /// Collapse all groups of bodies connected through rigid joints into
+    /// single bodies, as described above. Fixed bodies are never absorbed
+    /// (a group containing a fixed body keeps it as anchor only if the whole
+    /// group is meant to be fixed, i.e. the anchor is the fixed body itself);
+    /// groups for which a safe merge cannot be determined are skipped and
+    /// counted in the report rather than altered.
+    /// If 'decimation_cell' is positive, the merged collision mesh is
+    /// decimated by clustering its vertices on a uniform grid with the given
+    /// cell size, reducing triangle count for dense CAD tessellations.
+    static Report FlattenRigidSubtrees(ChSystem& system, double decimation_cell = 0);
+
+  private:
+    /// Merge one group of rigidly-joined bodies into the anchor body.
+    /// Returns false (leaving the system untouched) if the group contains an
+    /// external link of a type that cannot be re-attached.
+    static bool MergeGroup(ChSystem& system,
+                           const std::vector<std::shared_ptr<ChBody>>& group,
+                           std::shared_ptr<ChBodyAuxRef> anchor,
+                           const std::vector<std::shared_ptr<ChLink>>& internal_links,
+                           double decimation_cell,
+                           Report& report);
+
+    /// Cluster the vertices of 'mesh' on a uniform grid of the given cell
+    /// size and drop degenerate triangles. In-place; no-op for cell <= 0.
+    static void DecimateMesh(geometry::ChTriangleMeshConnected& mesh, double cell);
+};
+
+/// @} cascade_module
+
+}  // end namespace cascade
+}  // end namespace chrono
+
+#endif
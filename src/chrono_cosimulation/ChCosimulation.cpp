@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cstring>
 #include <vector>
 
 #include "chrono_cosimulation/ChCosimulation.h"
@@ -29,6 +30,10 @@ ChCosimulation::ChCosimulation(ChSocketFramework& mframework,
     this->in_n = n_in_values;
     this->out_n = n_out_values;
     this->nport = 0;
+
+    // Preallocate the frame buffers once; the channel layout is fixed.
+    this->send_buffer.resize(sizeof(double) * (n_out_values + 1));
+    this->recv_buffer.resize(sizeof(double) * (n_in_values + 1));
 }
 
 ChCosimulation::~ChCosimulation() {
@@ -62,6 +67,13 @@ bool ChCosimulation::WaitConnection(int aport) {
     return true;
 }
 
+void ChCosimulation::SetNoDelay(bool toggle) {
+    if (!myClient)
+        throw ChExceptionSocket(0, "Error. Attempted 'SetNoDelay' with no connected client.");
+
+    this->myClient->setNoDelay(toggle ? 1 : 0);
+}
+
 bool ChCosimulation::SendData(double mtime, ChMatrix<double>* out_data) {
     if (out_data->GetColumns() != 1)
         throw ChExceptionSocket(0, "Error. Sent data must be a matrix with 1 column");
@@ -70,19 +82,15 @@ bool ChCosimulation::SendData(double mtime, ChMatrix<double>* out_data) {
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'SendData' with no connected client.");
 
-    std::vector<char> mbuffer;                     // now zero length
-    ChStreamOutBinaryVector stream_out(&mbuffer);  // wrap the buffer, for easy formatting
-
-    // Serialize datas (little endian)...
+    // Frame the whole step in the preallocated buffer: time followed by the
+    // N values, memcpy'd in place (the matrix is a column vector, so its
+    // elements are contiguous). One frame = one send().
 
-    // time:
-    stream_out << mtime;
-    // variables:
-    for (int i = 0; i < out_data->GetRows(); i++)
-        stream_out << out_data->Element(i, 0);
+    memcpy(&send_buffer[0], &mtime, sizeof(double));
+    memcpy(&send_buffer[sizeof(double)], out_data->GetAddress(), sizeof(double) * this->out_n);
 
     // -----> SEND!!!
-    this->myClient->SendBuffer(*stream_out.GetVector());
+    this->myClient->SendBuffer(send_buffer);
 
     return true;
 }
@@ -95,22 +103,15 @@ bool ChCosimulation::ReceiveData(double& mtime, ChMatrix<double>* in_data) {
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'ReceiveData' with no connected client.");
 
-    // Receive from the client
+    // Receive the whole frame into the preallocated buffer (looping until all
+    // expected bytes arrived) and memcpy the values in place.
     int nbytes = sizeof(double) * (this->in_n + 1);
-    std::vector<char> rbuffer;
-    rbuffer.resize(nbytes);                      // reserve to number of expected bytes
-    ChStreamInBinaryVector stream_in(&rbuffer);  // wrap the buffer, for easy formatting
 
     // -----> RECEIVE!!!
-    int numBytes = this->myClient->ReceiveBuffer(*stream_in.GetVector(), nbytes);
-
-    // Deserialize datas (little endian)...
+    this->myClient->ReceiveBufferAll(recv_buffer, nbytes);
 
-    // time:
-    stream_in >> mtime;
-    // variables:
-    for (int i = 0; i < in_data->GetRows(); i++)
-        stream_in >> in_data->Element(i, 0);
+    memcpy(&mtime, &recv_buffer[0], sizeof(double));
+    memcpy(in_data->GetAddress(), &recv_buffer[sizeof(double)], sizeof(double) * this->in_n);
 
     return true;
 }
@@ -50,6 +50,12 @@ class ChApiCosimulation ChCosimulation {
     /// \a aport is a free port number, for example 50009.
     bool WaitConnection(int aport);
 
+    /// Disable (true) or re-enable (false) Nagle buffering on the connected
+    /// socket. Recommended for high-rate couplings, where each small frame
+    /// must go out immediately instead of waiting to be coalesced.
+    /// Must be called after WaitConnection().
+    void SetNoDelay(bool toggle);
+
     /// Exchange data with the client, by sending a
     /// vector of floating point values over TCP socket
     /// connection (values are double precision, little endian, 4 bytes each)
@@ -69,6 +75,9 @@ class ChApiCosimulation ChCosimulation {
 
     int in_n;
     int out_n;
+
+    std::vector<char> send_buffer;  ///< preallocated frame for SendData
+    std::vector<char> recv_buffer;  ///< preallocated frame for ReceiveData
 };
 
 /// @} cosimulation_module
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cstring>
+#include <thread>
+
+#include "chrono_cosimulation/ChSharedMemoryCosimulation.h"
+#include "chrono_cosimulation/ChExceptionSocket.h"
+
+#ifdef UNIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+namespace chrono {
+namespace cosimul {
+
+// Size of one direction slot: a cache line for the sequence counter followed
+// by the payload (time + n values), rounded up to a cache line multiple so
+// that the two directions do not false-share.
+static size_t slot_bytes(int n) {
+    size_t bytes = 64 + sizeof(double) * (n + 1);
+    return (bytes + 63) & ~(size_t)63;
+}
+
+ChSharedMemoryCosimulation::ChSharedMemoryCosimulation(const std::string& name,
+                                                       bool create,
+                                                       int n_in_values,
+                                                       int n_out_values)
+    : m_name(name), m_owner(create), m_mem(0), m_last_recv_seq(0), in_n(n_in_values), out_n(n_out_values) {
+    // The creator publishes in the first slot and reads the second; the
+    // opening side uses the mirrored convention, so the two processes agree
+    // on the layout as long as their value counts mirror each other.
+    int first_n = create ? out_n : in_n;
+    int second_n = create ? in_n : out_n;
+    m_size = slot_bytes(first_n) + slot_bytes(second_n);
+
+#ifdef UNIX
+    m_fd = open(name.c_str(), create ? (O_RDWR | O_CREAT) : O_RDWR, 0666);
+    if (m_fd < 0)
+        throw ChExceptionSocket(0, "Error. Cannot open shared memory region '" + name + "'");
+    if (create && ftruncate(m_fd, m_size) != 0)
+        throw ChExceptionSocket(0, "Error. Cannot size shared memory region '" + name + "'");
+    m_mem = (char*)mmap(0, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (m_mem == MAP_FAILED)
+        throw ChExceptionSocket(0, "Error. Cannot map shared memory region '" + name + "'");
+#else
+    if (create)
+        m_hMap = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, (DWORD)m_size, name.c_str());
+    else
+        m_hMap = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+    if (!m_hMap)
+        throw ChExceptionSocket(0, "Error. Cannot open shared memory region '" + name + "'");
+    m_mem = (char*)MapViewOfFile(m_hMap, FILE_MAP_ALL_ACCESS, 0, 0, m_size);
+    if (!m_mem)
+        throw ChExceptionSocket(0, "Error. Cannot map shared memory region '" + name + "'");
+#endif
+
+    char* first = m_mem;
+    char* second = m_mem + slot_bytes(first_n);
+    char* send_slot = create ? first : second;
+    char* recv_slot = create ? second : first;
+
+    m_send_seq = reinterpret_cast<std::atomic<unsigned int>*>(send_slot);
+    m_send_data = reinterpret_cast<double*>(send_slot + 64);
+    m_recv_seq = reinterpret_cast<std::atomic<unsigned int>*>(recv_slot);
+    m_recv_data = reinterpret_cast<double*>(recv_slot + 64);
+}
+
+ChSharedMemoryCosimulation::~ChSharedMemoryCosimulation() {
+#ifdef UNIX
+    if (m_mem)
+        munmap(m_mem, m_size);
+    if (m_fd >= 0)
+        close(m_fd);
+    if (m_owner)
+        unlink(m_name.c_str());
+#else
+    if (m_mem)
+        UnmapViewOfFile(m_mem);
+    if (m_hMap)
+        CloseHandle(m_hMap);
+#endif
+}
+
+bool ChSharedMemoryCosimulation::SendData(double mtime, ChMatrix<double>* out_data) {
+    if (out_data->GetColumns() != 1)
+        throw ChExceptionSocket(0, "Error. Sent data must be a matrix with 1 column");
+    if (out_data->GetRows() != this->out_n)
+        throw ChExceptionSocket(0, "Error. Sent data must be a matrix with N rows and 1 column");
+
+    // Seqlock publication: the counter is odd while the payload is being
+    // written, and a new even value signals a complete frame.
+    unsigned int seq = m_send_seq->load(std::memory_order_relaxed);
+    m_send_seq->store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    m_send_data[0] = mtime;
+    memcpy(&m_send_data[1], out_data->GetAddress(), sizeof(double) * this->out_n);
+
+    m_send_seq->store(seq + 2, std::memory_order_release);
+
+    return true;
+}
+
+bool ChSharedMemoryCosimulation::ReceiveData(double& mtime, ChMatrix<double>* in_data) {
+    if (in_data->GetColumns() != 1)
+        throw ChExceptionSocket(0, "Error. Received data must be a matrix with 1 column");
+    if (in_data->GetRows() != this->in_n)
+        throw ChExceptionSocket(0, "Error. Received data must be a matrix with N rows and 1 column");
+
+    for (;;) {
+        unsigned int seq = m_recv_seq->load(std::memory_order_acquire);
+        if ((seq & 1) == 0 && seq != m_last_recv_seq) {
+            mtime = m_recv_data[0];
+            memcpy(in_data->GetAddress(), &m_recv_data[1], sizeof(double) * this->in_n);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Retry if the writer started a new frame while we were copying.
+            if (m_recv_seq->load(std::memory_order_relaxed) == seq) {
+                m_last_recv_seq = seq;
+                return true;
+            }
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+}  // end namespace cosimul
+}  // end namespace chrono
@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSHAREDMEMORYCOSIMULATION_H
+#define CHSHAREDMEMORYCOSIMULATION_H
+
+#include <atomic>
+#include <string>
+
+#include "chrono_cosimulation/ChApiCosimulation.h"
+#include "chrono_cosimulation/ChHostInfo.h"  // for the WINDOWS_XP / UNIX flags
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+namespace cosimul {
+
+/// @addtogroup cosimulation_module
+/// @{
+
+/// Co-simulation interface over a shared-memory region, for the case where
+/// both simulators run on the same host. Exchange semantics are the same as
+/// ChCosimulation (lock-step send/receive of a time stamp plus a vector of
+/// scalar values each step), but frames are passed through a memory-mapped
+/// region with no sockets and no syscalls on the exchange path: each
+/// direction is a single-writer/single-reader slot protected by a sequence
+/// counter (seqlock), and the reader spins (yielding) until a new frame is
+/// published.
+///
+/// One side constructs with create = true (it creates the backing region) and
+/// the other with create = false; the two sides must use mirrored values for
+/// the number of input/output scalars.
+class ChApiCosimulation ChSharedMemoryCosimulation {
+  public:
+    /// Create or open a shared-memory co-simulation interface.
+    ChSharedMemoryCosimulation(const std::string& name,  ///< name of the shared region (a file path)
+                               bool create,              ///< create the region (true) or open an existing one
+                               int n_in_values,          ///< number of scalar variables to receive each timestep
+                               int n_out_values          ///< number of scalar variables to send each timestep
+    );
+
+    ~ChSharedMemoryCosimulation();
+
+    /// Publish a vector of floating point values (prefixed by the simulator
+    /// actual time) in the outgoing slot. Never blocks.
+    bool SendData(double mtime, ChMatrix<double>* mdata);
+
+    /// Wait for the peer to publish a new frame in the incoming slot and copy
+    /// it out. The first value received is the external time.
+    bool ReceiveData(double& mtime, ChMatrix<double>* mdata);
+
+  private:
+    std::string m_name;
+    bool m_owner;
+    char* m_mem;
+    size_t m_size;
+
+    std::atomic<unsigned int>* m_send_seq;  ///< sequence counter of the outgoing slot
+    double* m_send_data;                    ///< payload of the outgoing slot (time + out_n values)
+    std::atomic<unsigned int>* m_recv_seq;  ///< sequence counter of the incoming slot
+    double* m_recv_data;                    ///< payload of the incoming slot (time + in_n values)
+    unsigned int m_last_recv_seq;           ///< last sequence consumed by ReceiveData
+
+    int in_n;
+    int out_n;
+
+#ifdef UNIX
+    int m_fd;
+#else
+    void* m_hMap;
+#endif
+};
+
+/// @} cosimulation_module
+
+}  // end namespace cosimul
+}  // end namespace chrono
+
+#endif
@@ -115,6 +115,29 @@ void ChSocket::setReuseAddr(int reuseToggle) {
     }
 }
 
+void ChSocket::setNoDelay(int noDelayToggle) {
+    try {
+        if (setsockopt(socketId, IPPROTO_TCP, TCP_NODELAY, (char*)&noDelayToggle, sizeof(noDelayToggle)) == -1) {
+#ifdef WINDOWS_XP
+            int errorCode;
+            string errorMsg = "NODELAY option:";
+            detectErrorSetSocketOption(&errorCode, errorMsg);
+            ChExceptionSocket* socketOptionException = new ChExceptionSocket(errorCode, errorMsg);
+            throw socketOptionException;
+#endif
+
+#ifdef UNIX
+            ChExceptionSocket* unixSocketOptionException = new ChExceptionSocket(0, "unix: error setting TCP_NODELAY");
+            throw unixSocketOptionException;
+#endif
+        }
+    } catch (ChExceptionSocket* excp) {
+        excp->response();
+        delete excp;
+        exit(1);
+    }
+}
+
 void ChSocket::setKeepAlive(int aliveToggle) {
     try {
         if (setsockopt(socketId, SOL_SOCKET, SO_KEEPALIVE, (char*)&aliveToggle, sizeof(aliveToggle)) == -1) {
@@ -1299,6 +1322,32 @@ int ChSocketTCP::SendBuffer(std::vector<char>& source_buf) {
     return sentBytes;
 }
 
+int ChSocketTCP::ReceiveBufferAll(std::vector<char>& dest_buf, int bsize) {
+    dest_buf.resize(bsize);
+
+    int received = 0;
+    while (received < bsize) {
+        int numBytes = recv(socketId, &dest_buf[received], bsize - received, 0);
+        if (numBytes == -1) {
+#ifdef WINDOWS_XP
+            int errorCode = 0;
+            string errorMsg = "error calling recv():\n";
+            detectErrorRecv(&errorCode, errorMsg);
+            throw ChExceptionSocket(errorCode, errorMsg);
+#endif
+
+#ifdef UNIX
+            throw ChExceptionSocket(0, "Error calling recv() in buffer receive:");
+#endif
+        }
+        if (numBytes == 0)
+            throw ChExceptionSocket(0, "Connection closed by peer during buffer receive.");
+        received += numBytes;
+    }
+
+    return received;
+}
+
 int ChSocketTCP::ReceiveBuffer(std::vector<char>& dest_buf, int bsize) {
     int nbytes = bsize;
 
@@ -22,6 +22,7 @@
 
 #ifdef UNIX
 #include <sys/socket.h>
+#include <netinet/tcp.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <cerrno>
@@ -85,6 +86,7 @@ class ChApiCosimulation ChSocket {
     void setDebug(int);
     void setReuseAddr(int);
     void setKeepAlive(int);
+    void setNoDelay(int);  // disable (1) / enable (0) Nagle buffering
     void setLingerOnOff(bool);
     void setLingerSeconds(int);
     void setSocketBlocking(int);
@@ -178,6 +180,12 @@ class ChApiCosimulation ChSocketTCP : public ChSocket {
                       int bsize                     ///< size in bytes of expected received buffer.
                       );
 
+    /// As ReceiveBuffer, but loops on recv() until exactly bsize bytes have
+    /// been received (a frame can arrive split across TCP segments).
+    int ReceiveBufferAll(std::vector<char>& dest_buf,  ///< destination buffer - will be resized
+                         int bsize                     ///< size in bytes of expected received buffer.
+                         );
+
     /// Binds the socket to an address and port number
     /// (a server call)
     void bindSocket();
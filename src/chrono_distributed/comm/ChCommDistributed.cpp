@@ -40,6 +40,8 @@ using namespace collision;
 ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) {
     this->my_sys = my_sys;
     this->data_manager = my_sys->data_manager;
+    this->exchange_pending = false;
+    this->num_send_requests = 0;
 
     ddm = my_sys->ddm;
 
@@ -70,6 +72,20 @@ ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) {
     MPI_Type_create_struct(3, blocklen_update, disp_update, type_update, &BodyUpdateType);
     MPI_Type_commit(&BodyUpdateType);
 
+    // Slim Update
+    MPI_Datatype type_update_slim[3] = {MPI_UNSIGNED, MPI_DOUBLE, MPI_FLOAT};
+    int blocklen_update_slim[3] = {1, 3, 10};
+    MPI_Aint disp_update_slim[3];
+    disp_update_slim[0] = offsetof(BodyUpdateSlim, gid);
+    disp_update_slim[1] = offsetof(BodyUpdateSlim, pos);
+    disp_update_slim[2] = offsetof(BodyUpdateSlim, rot);
+    MPI_Datatype temp_type_us;
+    MPI_Type_create_struct(3, blocklen_update_slim, disp_update_slim, type_update_slim, &temp_type_us);
+    MPI_Aint lb_us, extent_us;
+    MPI_Type_get_extent(temp_type_us, &lb_us, &extent_us);
+    MPI_Type_create_resized(temp_type_us, lb_us, extent_us, &BodyUpdateSlimType);
+    MPI_Type_commit(&BodyUpdateSlimType);
+
     // Shape
     MPI_Datatype type_shape[4] = {MPI_UNSIGNED, MPI_INT, MPI_SHORT, MPI_DOUBLE};
     int blocklen_shape[4] = {1, 1, 2, 13};
@@ -167,6 +183,32 @@ void ChCommDistributed::ProcessUpdates(int num_recv, BodyUpdate* buf) {
     }
 }
 
+void ChCommDistributed::ProcessUpdatesSlim(int num_recv, BodyUpdateSlim* buf) {
+    // If the buffer is empty
+    if (buf->gid == UINT_MAX) {
+        return;
+    }
+    std::shared_ptr<ChBody> body;
+    for (int n = 0; n < num_recv; n++) {
+        // Find the existing body
+        int index = ddm->GetLocalIndex((buf + n)->gid);
+
+        if (index != -1 && ddm->comm_status[index] != distributed::EMPTY) {
+            if (ddm->comm_status[index] != distributed::GHOST_UP &&
+                ddm->comm_status[index] != distributed::GHOST_DOWN) {
+                my_sys->ErrorAbort(std::string("Trying to update a non-ghost body on rank ") +
+                                   std::to_string(my_sys->my_rank) + std::string("GID ") +
+                                   std::to_string((buf + n)->gid) + std::string("\n"));
+            }
+            body = (*data_manager->body_list)[index];
+            UnpackUpdateSlim(buf + n, body);
+        } else {
+            GetLog() << "GID " << (buf + n)->gid << " NOT found rank " << my_sys->my_rank << "\n";
+            my_sys->ErrorAbort("Body to be updated not found\n");
+        }
+    }
+}
+
 void ChCommDistributed::ProcessTakes(int num_recv, uint* buf) {
     if (buf[0] == UINT_MAX) {
         return;
@@ -241,6 +283,15 @@ void ChCommDistributed::ProcessShapes(int num_recv, Shape* buf) {
 
 // Handle all necessary communication
 void ChCommDistributed::Exchange() {
+    ExchangeStart();
+    ExchangeFinish();
+}
+
+// Packs all outgoing messages and posts them with nonblocking sends. The
+// shape messages can be posted here as well: the receiver may only process
+// them after it has processed the corresponding exchanges, but nothing
+// prevents the data from being in flight earlier.
+void ChCommDistributed::ExchangeStart() {
     int my_rank = my_sys->my_rank;
     int num_ranks = my_sys->num_ranks;
     std::forward_list<int> exchanges_up;
@@ -248,20 +299,25 @@ void ChCommDistributed::Exchange() {
 
     // Saves a reference copy for consistency in the threads.
     ddm->curr_status = ddm->comm_status;
-    std::vector<BodyExchange> exchange_up_buf;
-    std::vector<BodyExchange> exchange_down_buf;
-    std::vector<BodyUpdate> update_up_buf;
-    std::vector<BodyUpdate> update_down_buf;
-    std::vector<Shape> shapes_up;
-    std::vector<Shape> shapes_down;
-    std::vector<uint> update_take_up;
-    std::vector<uint> update_take_down;
+    exchange_up_buf.clear();
+    exchange_down_buf.clear();
+    update_up_buf.clear();
+    update_down_buf.clear();
+    update_slim_up_buf.clear();
+    update_slim_down_buf.clear();
+    shapes_up.clear();
+    shapes_down.clear();
+    update_take_up.clear();
+    update_take_down.clear();
 
     // Send Counts
     int num_exchange_up = 0;
     int num_exchange_down = 0;
     int num_update_up = 0;
     int num_update_down = 0;
+    int num_update_slim_up = 0;
+    int num_update_slim_down = 0;
+    bool slim = my_sys->slim_updates;
     int num_shapes_up = 0;
     int num_shapes_down = 0;
     int num_take_up = 0;
@@ -321,13 +377,23 @@ void ChCommDistributed::Exchange() {
                     continue;
 
                 // If the body has already been shared, it need only update its
-                // corresponding ghost
+                // corresponding ghost. The plain state update is the per-step
+                // common case, so it goes out as a slim message when enabled;
+                // updates that change the comm_status are always sent full.
                 if (location == distributed::SHARED_UP && curr_status == distributed::SHARED_UP) {
-                    BodyUpdate b_upd = {};
-                    PackUpdate(&b_upd, i, distributed::UPDATE);
-                    update_up_buf.push_back(b_upd);
+                    if (slim) {
+                        BodyUpdateSlim b_upd = {};
+                        PackUpdateSlim(&b_upd, i);
+                        update_slim_up_buf.push_back(b_upd);
 
-                    num_update_up++;  // TODO might be able to eliminate
+                        num_update_slim_up++;
+                    } else {
+                        BodyUpdate b_upd = {};
+                        PackUpdate(&b_upd, i, distributed::UPDATE);
+                        update_up_buf.push_back(b_upd);
+
+                        num_update_up++;  // TODO might be able to eliminate
+                    }
                 } else if (location == distributed::GHOST_UP && curr_status == distributed::SHARED_UP) {
                     BodyUpdate b_upd = {};
                     PackUpdate(&b_upd, i, distributed::UPDATE_TRANSFER_SHARE);
@@ -340,11 +406,19 @@ void ChCommDistributed::Exchange() {
                 // If the body has already been shared, it need only update its
                 // corresponding ghost
                 else if (location == distributed::SHARED_DOWN && curr_status == distributed::SHARED_DOWN) {
-                    BodyUpdate b_upd = {};
-                    PackUpdate(&b_upd, i, distributed::UPDATE);
-                    update_down_buf.push_back(b_upd);
+                    if (slim) {
+                        BodyUpdateSlim b_upd = {};
+                        PackUpdateSlim(&b_upd, i);
+                        update_slim_down_buf.push_back(b_upd);
 
-                    num_update_down++;  // TODO might be able to eliminate
+                        num_update_slim_down++;
+                    } else {
+                        BodyUpdate b_upd = {};
+                        PackUpdate(&b_upd, i, distributed::UPDATE);
+                        update_down_buf.push_back(b_upd);
+
+                        num_update_down++;  // TODO might be able to eliminate
+                    }
                 } else if (location == distributed::GHOST_DOWN && curr_status == distributed::SHARED_DOWN) {
                     BodyUpdate b_upd = {};
                     PackUpdate(&b_upd, i, distributed::UPDATE_TRANSFER_SHARE);
@@ -415,58 +489,13 @@ void ChCommDistributed::Exchange() {
         }      // End of update take loop
     }          // End of parallel sections
 
-    //MPI_Status status_exchange_up;
-    //MPI_Status status_exchange_down;
-    //MPI_Status status_update_up;
-    //MPI_Status status_update_down;
-    //MPI_Status status_take_up;
-    //MPI_Status status_take_down;
-    //MPI_Status status_shapes_up;
-    //MPI_Status status_shapes_down;
-
-    MPI_Request rq_exchange_up;
-    MPI_Request rq_exchange_down;
-    MPI_Request rq_update_up;
-    MPI_Request rq_update_down;
-    MPI_Request rq_take_up;
-    MPI_Request rq_take_down;
-    MPI_Request rq_shapes_up;
-    MPI_Request rq_shapes_down;
-
-    MPI_Status recv_status_exchange_up;
-    MPI_Status recv_status_exchange_down;
-    MPI_Status recv_status_update_up;
-    MPI_Status recv_status_update_down;
-    MPI_Status recv_status_take_up;
-    MPI_Status recv_status_take_down;
-    MPI_Status recv_status_shapes_up;
-    MPI_Status recv_status_shapes_down;
-
-    int num_recv_exchange_up;
-    int num_recv_exchange_down;
-    int num_recv_update_up;
-    int num_recv_update_down;
-    int num_recv_take_up;
-    int num_recv_take_down;
-    int num_recv_shapes_up;
-    int num_recv_shapes_down;
-
-    BodyExchange* recv_exchange_down = NULL;
-    BodyExchange* recv_exchange_up = NULL;
-    BodyUpdate* recv_update_down = NULL;
-    BodyUpdate* recv_update_up = NULL;
-    uint* recv_take_down = NULL;
-    uint* recv_take_up = NULL;
-    Shape* recv_shapes_down = NULL;
-    Shape* recv_shapes_up = NULL;
+    num_send_requests = 0;
 
 #pragma omp parallel sections
     {
-// Send/Recv
+// Send
 #pragma omp section
         {
-            // SENDING - TODO sequential for now
-
             // Send empty message if there is nothing to send
             if (num_exchange_up == 0) {
                 BodyExchange b_e = {};
@@ -500,96 +529,59 @@ void ChCommDistributed::Exchange() {
                 update_take_down.push_back(UINT_MAX);
                 num_take_down = 1;
             }
+            if (slim && num_update_slim_up == 0) {
+                BodyUpdateSlim b_u = {};
+                b_u.gid = UINT_MAX;
+                update_slim_up_buf.push_back(b_u);
+                num_update_slim_up = 1;
+            }
+            if (slim && num_update_slim_down == 0) {
+                BodyUpdateSlim b_u = {};
+                b_u.gid = UINT_MAX;
+                update_slim_down_buf.push_back(b_u);
+                num_update_slim_down = 1;
+            }
 
             // Send Exchanges
             if (my_rank != num_ranks - 1) {
                 MPI_Isend(&(exchange_up_buf[0]), num_exchange_up, BodyExchangeType, my_rank + 1, 1, my_sys->world,
-                          &rq_exchange_up);
+                          &send_requests[num_send_requests++]);
             }
             if (my_rank != 0) {
                 MPI_Isend(&(exchange_down_buf[0]), num_exchange_down, BodyExchangeType, my_rank - 1, 2, my_sys->world,
-                          &rq_exchange_down);
-            }
-
-            // Recv Exchanges
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 1, my_sys->world, &recv_status_exchange_down);
-                MPI_Get_count(&recv_status_exchange_down, BodyExchangeType, &num_recv_exchange_down);
-                recv_exchange_down = new BodyExchange[num_recv_exchange_down];
-                MPI_Recv(recv_exchange_down, num_recv_exchange_down, BodyExchangeType, my_rank - 1, 1, my_sys->world,
-                         &recv_status_exchange_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 2, my_sys->world, &recv_status_exchange_up);
-                MPI_Get_count(&recv_status_exchange_up, BodyExchangeType, &num_recv_exchange_up);
-                recv_exchange_up = new BodyExchange[num_recv_exchange_up];
-                MPI_Recv(recv_exchange_up, num_recv_exchange_up, BodyExchangeType, my_rank + 1, 2, my_sys->world,
-                         &recv_status_exchange_up);
+                          &send_requests[num_send_requests++]);
             }
 
             // Send Updates
             if (my_rank != num_ranks - 1) {
                 MPI_Isend(&(update_up_buf[0]), num_update_up, BodyUpdateType, my_rank + 1, 3, my_sys->world,
-                          &rq_update_up);
+                          &send_requests[num_send_requests++]);
             }
             if (my_rank != 0) {
                 MPI_Isend(&(update_down_buf[0]), num_update_down, BodyUpdateType, my_rank - 1, 4, my_sys->world,
-                          &rq_update_down);
+                          &send_requests[num_send_requests++]);
             }
 
-            // Recv Updates
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 3, my_sys->world, &recv_status_update_down);
-                MPI_Get_count(&recv_status_update_down, BodyUpdateType, &num_recv_update_down);
-                recv_update_down = new BodyUpdate[num_recv_update_down];
-                MPI_Recv(recv_update_down, num_recv_update_down, BodyUpdateType, my_rank - 1, 3, my_sys->world,
-                         &recv_status_update_down);
+            // Send Slim Updates
+            if (slim && my_rank != num_ranks - 1) {
+                MPI_Isend(&(update_slim_up_buf[0]), num_update_slim_up, BodyUpdateSlimType, my_rank + 1, 9,
+                          my_sys->world, &send_requests[num_send_requests++]);
             }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 4, my_sys->world, &recv_status_update_up);
-                MPI_Get_count(&recv_status_update_up, BodyUpdateType, &num_recv_update_up);
-                recv_update_up = new BodyUpdate[num_recv_update_up];
-                MPI_Recv(recv_update_up, num_recv_update_up, BodyUpdateType, my_rank + 1, 4, my_sys->world,
-                         &recv_status_update_up);
+            if (slim && my_rank != 0) {
+                MPI_Isend(&(update_slim_down_buf[0]), num_update_slim_down, BodyUpdateSlimType, my_rank - 1, 10,
+                          my_sys->world, &send_requests[num_send_requests++]);
             }
 
             // Send Takes
             if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world, &rq_take_up);
+                MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world,
+                          &send_requests[num_send_requests++]);
             }
             if (my_rank != 0) {
                 MPI_Isend(&(update_take_down[0]), num_take_down, MPI_UNSIGNED, my_rank - 1, 6, my_sys->world,
-                          &rq_take_down);
+                          &send_requests[num_send_requests++]);
             }
-
-            // Recv Takes
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 5, my_sys->world, &recv_status_take_down);
-                MPI_Get_count(&recv_status_take_down, MPI_UNSIGNED, &num_recv_take_down);
-                recv_take_down = new uint[num_recv_take_down];
-                MPI_Recv(recv_take_down, num_recv_take_down, MPI_UNSIGNED, my_rank - 1, 5, my_sys->world,
-                         &recv_status_take_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 6, my_sys->world, &recv_status_take_up);
-                MPI_Get_count(&recv_status_take_up, MPI_UNSIGNED, &num_recv_take_up);
-                recv_take_up = new uint[num_recv_take_up];
-                MPI_Recv(recv_take_up, num_recv_take_up, MPI_UNSIGNED, my_rank + 1, 6, my_sys->world,
-                         &recv_status_take_up);
-            }
-
-            // Make sure all non-blocking communications are done.
-            if (my_rank != num_ranks - 1) {
-                MPI_Wait(&rq_exchange_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_up, MPI_STATUS_IGNORE);
-            }
-            if (my_rank != 0) {
-                MPI_Wait(&rq_exchange_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_down, MPI_STATUS_IGNORE);
-            }
-        }  // End of send/recv section
+        }  // End of send section
 
 // TODO could do in parallel if counting the spaces in the buffers in the first pass
 // Pack Shapes Up
@@ -622,26 +614,125 @@ void ChCommDistributed::Exchange() {
         }  // End of pack shapes down section
     }      // End of parallel sections
 
-    // TODO sections?
-    if (my_rank != 0)
-        ProcessExchanges(num_recv_exchange_down, recv_exchange_down, 0);
-    if (my_rank != num_ranks - 1)
-        ProcessExchanges(num_recv_exchange_up, recv_exchange_up, 1);
-    if (my_rank != 0)
-        ProcessUpdates(num_recv_update_down, recv_update_down);
-    if (my_rank != num_ranks - 1)
-        ProcessUpdates(num_recv_update_up, recv_update_up);
-    if (my_rank != 0)
-        ProcessTakes(num_recv_take_down, recv_take_down);
-    if (my_rank != num_ranks - 1)
-        ProcessTakes(num_recv_take_up, recv_take_up);
-
     // Send Shapes
     if (my_rank != num_ranks - 1) {
-        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world, &rq_shapes_up);
+        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world,
+                  &send_requests[num_send_requests++]);
     }
     if (my_rank != 0) {
-        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world, &rq_shapes_down);
+        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world,
+                  &send_requests[num_send_requests++]);
+    }
+
+    exchange_pending = true;
+}
+
+// Receives and processes the messages posted by ExchangeStart and waits for
+// the outgoing sends to complete. MPI matches messages in order per rank pair
+// and tag, so the messages of one step cannot be confused with those of the
+// next and no barrier is needed.
+void ChCommDistributed::ExchangeFinish() {
+    if (!exchange_pending)
+        return;
+
+    int my_rank = my_sys->my_rank;
+    int num_ranks = my_sys->num_ranks;
+    bool slim = my_sys->slim_updates;
+
+    MPI_Status recv_status_exchange_up;
+    MPI_Status recv_status_exchange_down;
+    MPI_Status recv_status_update_up;
+    MPI_Status recv_status_update_down;
+    MPI_Status recv_status_update_slim_up;
+    MPI_Status recv_status_update_slim_down;
+    MPI_Status recv_status_take_up;
+    MPI_Status recv_status_take_down;
+    MPI_Status recv_status_shapes_up;
+    MPI_Status recv_status_shapes_down;
+
+    int num_recv_exchange_up;
+    int num_recv_exchange_down;
+    int num_recv_update_up;
+    int num_recv_update_down;
+    int num_recv_update_slim_up;
+    int num_recv_update_slim_down;
+    int num_recv_take_up;
+    int num_recv_take_down;
+    int num_recv_shapes_up;
+    int num_recv_shapes_down;
+
+    BodyExchange* recv_exchange_down = NULL;
+    BodyExchange* recv_exchange_up = NULL;
+    BodyUpdate* recv_update_down = NULL;
+    BodyUpdate* recv_update_up = NULL;
+    BodyUpdateSlim* recv_update_slim_down = NULL;
+    BodyUpdateSlim* recv_update_slim_up = NULL;
+    uint* recv_take_down = NULL;
+    uint* recv_take_up = NULL;
+    Shape* recv_shapes_down = NULL;
+    Shape* recv_shapes_up = NULL;
+
+    // Recv Exchanges
+    if (my_rank != 0) {
+        MPI_Probe(my_rank - 1, 1, my_sys->world, &recv_status_exchange_down);
+        MPI_Get_count(&recv_status_exchange_down, BodyExchangeType, &num_recv_exchange_down);
+        recv_exchange_down = new BodyExchange[num_recv_exchange_down];
+        MPI_Recv(recv_exchange_down, num_recv_exchange_down, BodyExchangeType, my_rank - 1, 1, my_sys->world,
+                 &recv_status_exchange_down);
+    }
+    if (my_rank != num_ranks - 1) {
+        MPI_Probe(my_rank + 1, 2, my_sys->world, &recv_status_exchange_up);
+        MPI_Get_count(&recv_status_exchange_up, BodyExchangeType, &num_recv_exchange_up);
+        recv_exchange_up = new BodyExchange[num_recv_exchange_up];
+        MPI_Recv(recv_exchange_up, num_recv_exchange_up, BodyExchangeType, my_rank + 1, 2, my_sys->world,
+                 &recv_status_exchange_up);
+    }
+
+    // Recv Updates
+    if (my_rank != 0) {
+        MPI_Probe(my_rank - 1, 3, my_sys->world, &recv_status_update_down);
+        MPI_Get_count(&recv_status_update_down, BodyUpdateType, &num_recv_update_down);
+        recv_update_down = new BodyUpdate[num_recv_update_down];
+        MPI_Recv(recv_update_down, num_recv_update_down, BodyUpdateType, my_rank - 1, 3, my_sys->world,
+                 &recv_status_update_down);
+    }
+    if (my_rank != num_ranks - 1) {
+        MPI_Probe(my_rank + 1, 4, my_sys->world, &recv_status_update_up);
+        MPI_Get_count(&recv_status_update_up, BodyUpdateType, &num_recv_update_up);
+        recv_update_up = new BodyUpdate[num_recv_update_up];
+        MPI_Recv(recv_update_up, num_recv_update_up, BodyUpdateType, my_rank + 1, 4, my_sys->world,
+                 &recv_status_update_up);
+    }
+
+    // Recv Slim Updates
+    if (slim && my_rank != 0) {
+        MPI_Probe(my_rank - 1, 9, my_sys->world, &recv_status_update_slim_down);
+        MPI_Get_count(&recv_status_update_slim_down, BodyUpdateSlimType, &num_recv_update_slim_down);
+        recv_update_slim_down = new BodyUpdateSlim[num_recv_update_slim_down];
+        MPI_Recv(recv_update_slim_down, num_recv_update_slim_down, BodyUpdateSlimType, my_rank - 1, 9, my_sys->world,
+                 &recv_status_update_slim_down);
+    }
+    if (slim && my_rank != num_ranks - 1) {
+        MPI_Probe(my_rank + 1, 10, my_sys->world, &recv_status_update_slim_up);
+        MPI_Get_count(&recv_status_update_slim_up, BodyUpdateSlimType, &num_recv_update_slim_up);
+        recv_update_slim_up = new BodyUpdateSlim[num_recv_update_slim_up];
+        MPI_Recv(recv_update_slim_up, num_recv_update_slim_up, BodyUpdateSlimType, my_rank + 1, 10, my_sys->world,
+                 &recv_status_update_slim_up);
+    }
+
+    // Recv Takes
+    if (my_rank != 0) {
+        MPI_Probe(my_rank - 1, 5, my_sys->world, &recv_status_take_down);
+        MPI_Get_count(&recv_status_take_down, MPI_UNSIGNED, &num_recv_take_down);
+        recv_take_down = new uint[num_recv_take_down];
+        MPI_Recv(recv_take_down, num_recv_take_down, MPI_UNSIGNED, my_rank - 1, 5, my_sys->world,
+                 &recv_status_take_down);
+    }
+    if (my_rank != num_ranks - 1) {
+        MPI_Probe(my_rank + 1, 6, my_sys->world, &recv_status_take_up);
+        MPI_Get_count(&recv_status_take_up, MPI_UNSIGNED, &num_recv_take_up);
+        recv_take_up = new uint[num_recv_take_up];
+        MPI_Recv(recv_take_up, num_recv_take_up, MPI_UNSIGNED, my_rank + 1, 6, my_sys->world, &recv_status_take_up);
     }
 
     // Recv Shapes
@@ -660,29 +751,47 @@ void ChCommDistributed::Exchange() {
         MPI_Recv(recv_shapes_up, num_recv_shapes_up, ShapeType, my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
     }
 
+    // TODO sections?
+    // NOTE: Shapes must be processed after the exchanges so that the bodies
+    // they attach to exist on this rank.
+    if (my_rank != 0)
+        ProcessExchanges(num_recv_exchange_down, recv_exchange_down, 0);
+    if (my_rank != num_ranks - 1)
+        ProcessExchanges(num_recv_exchange_up, recv_exchange_up, 1);
+    if (my_rank != 0)
+        ProcessUpdates(num_recv_update_down, recv_update_down);
+    if (my_rank != num_ranks - 1)
+        ProcessUpdates(num_recv_update_up, recv_update_up);
+    if (slim && my_rank != 0)
+        ProcessUpdatesSlim(num_recv_update_slim_down, recv_update_slim_down);
+    if (slim && my_rank != num_ranks - 1)
+        ProcessUpdatesSlim(num_recv_update_slim_up, recv_update_slim_up);
+    if (my_rank != 0)
+        ProcessTakes(num_recv_take_down, recv_take_down);
+    if (my_rank != num_ranks - 1)
+        ProcessTakes(num_recv_take_up, recv_take_up);
     if (my_rank != 0)
         ProcessShapes(num_recv_shapes_down, recv_shapes_down);
     if (my_rank != num_ranks - 1)
         ProcessShapes(num_recv_shapes_up, recv_shapes_up);
 
-    if (my_rank != num_ranks - 1) {
-        MPI_Wait(&rq_shapes_up, MPI_STATUS_IGNORE);
-    }
-    if (my_rank != 0) {
-        MPI_Wait(&rq_shapes_down, MPI_STATUS_IGNORE);
-    }
+    // Make sure all non-blocking sends are done before the buffers are reused.
+    MPI_Waitall(num_send_requests, send_requests, MPI_STATUSES_IGNORE);
+    num_send_requests = 0;
 
     // Free all dynamic memory used for recving
     delete[] recv_exchange_down;
     delete[] recv_exchange_up;
     delete[] recv_update_down;
     delete[] recv_update_up;
+    delete[] recv_update_slim_down;
+    delete[] recv_update_slim_up;
     delete[] recv_take_down;
     delete[] recv_take_up;
     delete[] recv_shapes_down;
     delete[] recv_shapes_up;
 
-    MPI_Barrier(my_sys->world);
+    exchange_pending = false;
 }
 
 void ChCommDistributed::PackExchange(BodyExchange* buf, int index) {
@@ -860,6 +969,50 @@ void ChCommDistributed::UnpackUpdate(BodyUpdate* buf, std::shared_ptr<ChBody> bo
     body->SetWvel_par(ChVector<double>(buf->vel[3], buf->vel[4], buf->vel[5]));
 }
 
+// Packs only the body state, with rotation and velocities in single precision
+void ChCommDistributed::PackUpdateSlim(BodyUpdateSlim* buf, int index) {
+    // Global Id
+    buf->gid = ddm->global_id[index];
+
+    // Position
+    buf->pos[0] = data_manager->host_data.pos_rigid[index].x;
+    buf->pos[1] = data_manager->host_data.pos_rigid[index].y;
+    buf->pos[2] = data_manager->host_data.pos_rigid[index].z;
+
+    // Rotation
+    buf->rot[0] = static_cast<float>(data_manager->host_data.rot_rigid[index].w);
+    buf->rot[1] = static_cast<float>(data_manager->host_data.rot_rigid[index].x);
+    buf->rot[2] = static_cast<float>(data_manager->host_data.rot_rigid[index].y);
+    buf->rot[3] = static_cast<float>(data_manager->host_data.rot_rigid[index].z);
+
+    // Velocity
+    buf->vel[0] = static_cast<float>(data_manager->host_data.v[index * 6]);
+    buf->vel[1] = static_cast<float>(data_manager->host_data.v[index * 6 + 1]);
+    buf->vel[2] = static_cast<float>(data_manager->host_data.v[index * 6 + 2]);
+
+    // Angular Velocity
+    ChVector<> omega((*data_manager->body_list)[index]->GetWvel_par());
+    buf->vel[3] = static_cast<float>(omega.x());
+    buf->vel[4] = static_cast<float>(omega.y());
+    buf->vel[5] = static_cast<float>(omega.z());
+}
+
+void ChCommDistributed::UnpackUpdateSlim(BodyUpdateSlim* buf, std::shared_ptr<ChBody> body) {
+    // Position
+    body->SetPos(ChVector<double>(buf->pos[0], buf->pos[1], buf->pos[2]));
+
+    // Rotation (re-normalized after the single-precision round trip)
+    ChQuaternion<double> rot(buf->rot[0], buf->rot[1], buf->rot[2], buf->rot[3]);
+    rot.Normalize();
+    body->SetRot(rot);
+
+    // Linear Velocity
+    body->SetPos_dt(ChVector<double>(buf->vel[0], buf->vel[1], buf->vel[2]));
+
+    // Angular Velocity
+    body->SetWvel_par(ChVector<double>(buf->vel[3], buf->vel[4], buf->vel[5]));
+}
+
 // Packs all shapes for a single body into the buffer
 int ChCommDistributed::PackShapes(std::vector<Shape>* buf, int index) {
     int shape_count = ddm->body_shape_count[index];
@@ -68,6 +68,22 @@ typedef struct BodyUpdate {
 /// @addtogroup distributed_comm
 /// @{
 
+/// Compact structure of data for the per-step state update of an existing
+/// ghost, used instead of BodyUpdate when slim updates are enabled on the
+/// system. Carries no update_type (it always means distributed::UPDATE);
+/// position keeps full precision, rotation and velocities are compressed to
+/// single precision.
+typedef struct BodyUpdateSlim {
+    uint gid;
+    double pos[3];
+    float rot[4];
+    float vel[6];
+} BodyUpdateSlim;
+/// @} distributed_comm
+
+/// @addtogroup distributed_comm
+/// @{
+
 /// Structure of data for sending a collision shape to a rank
 typedef struct Shape {
     uint gid;
@@ -109,14 +125,29 @@ class CH_DISTR_API ChCommDistributed {
     ///	- need to update their comm_status
     /// Sends updates via mpi to the appropriate rank
     /// Processes incoming updates from other ranks
+    /// Equivalent to ExchangeStart() immediately followed by ExchangeFinish().
     void Exchange();
 
+    /// Posts the halo exchange for this step: packs all outgoing exchange,
+    /// update, take, and shape messages and starts them with nonblocking
+    /// sends. No receiving is done here; the messages are left in flight so
+    /// that the caller can overlap local work with the communication until
+    /// ExchangeFinish() is called.
+    void ExchangeStart();
+
+    /// Completes the halo exchange posted by ExchangeStart(): receives and
+    /// processes the incoming exchange, update, take, and shape messages from
+    /// the neighboring ranks and waits for the outgoing sends to complete.
+    /// A no-op if no exchange is pending.
+    void ExchangeFinish();
+
   protected:
     ChSystemDistributed* my_sys;
 
     /// MPI Data Types for sending 1) new body 2) body update 3) new collision shape
     MPI_Datatype BodyExchangeType;
     MPI_Datatype BodyUpdateType;
+    MPI_Datatype BodyUpdateSlimType;
     MPI_Datatype ShapeType;
 
     /// Pointer to underlying chrono::parallel data
@@ -132,6 +163,9 @@ class CH_DISTR_API ChCommDistributed {
     /// Helper function for processing incoming update messages.
     void ProcessUpdates(int num_recv, BodyUpdate* buf);
 
+    /// Helper function for processing incoming slim update messages.
+    void ProcessUpdatesSlim(int num_recv, BodyUpdateSlim* buf);
+
     /// Helper function for processing incoming take messages.
     void ProcessTakes(int num_recv, uint* buf);
 
@@ -151,12 +185,40 @@ class CH_DISTR_API ChCommDistributed {
     /// Unpacks an incoming body to update a ghost
     void UnpackUpdate(BodyUpdate* buf, std::shared_ptr<ChBody> body);
 
+    /// Packs the state of the body at index into a slim update message
+    void PackUpdateSlim(BodyUpdateSlim* buf, int index);
+
+    /// Unpacks an incoming slim update into a ghost
+    void UnpackUpdateSlim(BodyUpdateSlim* buf, std::shared_ptr<ChBody> body);
+
     /// Packs the gid of the body at index index into buf
     void PackUpdateTake(uint* buf, int index);
 
     /// Packs all shapes for the body at index into buf and returns
     /// the number of shapes that it has packed.
     int PackShapes(std::vector<Shape>* buf, int index);
+
+    /// True while an exchange posted by ExchangeStart() has not yet been
+    /// completed by ExchangeFinish().
+    bool exchange_pending;
+
+    /// Send-side buffers of the exchange in flight. Must remain valid from
+    /// ExchangeStart() until the nonblocking sends complete in
+    /// ExchangeFinish().
+    std::vector<BodyExchange> exchange_up_buf;
+    std::vector<BodyExchange> exchange_down_buf;
+    std::vector<BodyUpdate> update_up_buf;
+    std::vector<BodyUpdate> update_down_buf;
+    std::vector<BodyUpdateSlim> update_slim_up_buf;
+    std::vector<BodyUpdateSlim> update_slim_down_buf;
+    std::vector<Shape> shapes_up;
+    std::vector<Shape> shapes_down;
+    std::vector<uint> update_take_up;
+    std::vector<uint> update_take_down;
+
+    /// Requests for the nonblocking sends posted by ExchangeStart().
+    MPI_Request send_requests[10];
+    int num_send_requests;
 };
 /// @} distributed_comm
 
@@ -73,10 +73,17 @@ void ChDomainDistributed::SplitDomain() {
     // Length of this subdomain along the long axis
     double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / my_sys->num_ranks;
 
+    // Uniform slabs to start with; Rebalance can move the boundaries later
+    slab_bounds.resize(my_sys->num_ranks + 1);
+    for (int i = 0; i < my_sys->num_ranks; i++) {
+        slab_bounds[i] = boxlo[split_axis] + i * sub_len;
+    }
+    slab_bounds[my_sys->num_ranks] = boxhi[split_axis];
+
     for (int i = 0; i < 3; i++) {
         if (split_axis == i) {
-            sublo[i] = boxlo[i] + my_sys->my_rank * sub_len;
-            subhi[i] = sublo[i] + sub_len;
+            sublo[i] = slab_bounds[my_sys->my_rank];
+            subhi[i] = slab_bounds[my_sys->my_rank + 1];
         } else {
             sublo[i] = boxlo[i];
             subhi[i] = boxhi[i];
@@ -86,10 +93,75 @@ void ChDomainDistributed::SplitDomain() {
 }
 
 int ChDomainDistributed::GetRank(ChVector<double> pos) {
-    double sub_len = subhi[split_axis] - sublo[split_axis];
-    double pt = pos[split_axis] - boxlo[split_axis];
+    double pt = pos[split_axis];
+
+    for (int i = 1; i < my_sys->num_ranks; i++) {
+        if (pt < slab_bounds[i])
+            return i - 1;
+    }
+    return my_sys->num_ranks - 1;
+}
+
+void ChDomainDistributed::Rebalance() {
+    int num_ranks = my_sys->num_ranks;
+    int my_rank = my_sys->my_rank;
+    if (num_ranks == 1)
+        return;
+
+    // Count the bodies this rank is responsible for advancing (ghosts are
+    // advanced by their owning rank and are not counted here)
+    int my_count = 0;
+    for (uint i = 0; i < my_sys->data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = my_sys->ddm->comm_status[i];
+        if (status == distributed::OWNED || status == distributed::SHARED_UP ||
+            status == distributed::SHARED_DOWN) {
+            my_count++;
+        }
+    }
+
+    std::vector<int> counts(num_ranks);
+    MPI_Allgather(&my_count, 1, MPI_INT, counts.data(), 1, MPI_INT, my_sys->world);
+
+    long total = 0;
+    for (int i = 0; i < num_ranks; i++) {
+        total += counts[i];
+    }
+    if (total == 0)
+        return;
+
+    // Limiting the boundary motion to the ghost layer thickness guarantees
+    // that a body losing its owner lands in the new shared/ghost bands, where
+    // the exchange machinery picks it up. The minimum width keeps the shared
+    // bands of opposite faces of a slab from overlapping.
+    double max_shift = my_sys->GetGhostLayer();
+    double min_width = 3.0 * my_sys->GetGhostLayer();
+    double target = (double)total / num_ranks;
+
+    // All ranks compute identical new boundaries from the gathered counts
+    std::vector<double> new_bounds = slab_bounds;
+    long cumulative = 0;
+    for (int b = 1; b < num_ranks; b++) {
+        cumulative += counts[b - 1];
+
+        // Surplus of the ranks below this boundary w.r.t. a perfect balance;
+        // move the boundary against it, proportionally but clamped
+        double surplus = (double)cumulative - target * b;
+        double shift = -max_shift * surplus / target;
+        if (shift > max_shift)
+            shift = max_shift;
+        if (shift < -max_shift)
+            shift = -max_shift;
+
+        new_bounds[b] = slab_bounds[b] + shift;
+        if (new_bounds[b] < new_bounds[b - 1] + min_width)
+            new_bounds[b] = new_bounds[b - 1] + min_width;
+        if (new_bounds[b] > slab_bounds[b + 1] - min_width)
+            new_bounds[b] = slab_bounds[b + 1] - min_width;
+    }
 
-    return (int)(pt / sub_len);
+    slab_bounds = new_bounds;
+    sublo[split_axis] = slab_bounds[my_rank];
+    subhi[split_axis] = slab_bounds[my_rank + 1];
 }
 
 distributed::COMM_STATUS ChDomainDistributed::GetRegion(double pos) {
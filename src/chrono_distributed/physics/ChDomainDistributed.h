@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
@@ -142,6 +143,14 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns true if the domain has been set.
     bool IsSplit() { return split; }
 
+    /// Shifts the slab boundaries toward an even distribution of bodies
+    /// across the ranks and adopts the new sub-domain bounds on this rank.
+    /// Collective operation - must be called on all ranks. Each interior
+    /// boundary moves by at most the ghost layer thickness per call, so every
+    /// body whose owner changes passes through the shared/ghost bands and is
+    /// handed off by the regular exchange machinery over the following steps.
+    virtual void Rebalance();
+
     /// Prints basic information about the domain decomposition
     virtual void PrintDomain();
 
@@ -150,6 +159,11 @@ class CH_DISTR_API ChDomainDistributed {
 
     ChVector<double> sublo;  ///< Lower coordinates of this subdomain
     ChVector<double> subhi;  ///< Upper coordinates of this subdomain
+
+    /// Boundaries of the slabs along the split axis, identical on all ranks.
+    /// Rank i owns [slab_bounds[i], slab_bounds[i+1]). Initially uniform;
+    /// Rebalance() makes the decomposition non-uniform.
+    std::vector<double> slab_bounds;
   protected:
     ChSystemDistributed* my_sys;
 
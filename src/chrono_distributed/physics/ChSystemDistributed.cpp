@@ -15,9 +15,11 @@
 #include <cstdlib>
 
 #include <mpi.h>
+#include <algorithm>
 #include <cfloat>
 #include <climits>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <iostream>
@@ -27,6 +29,7 @@
 
 #include "chrono/collision/ChCCollisionSystem.h"
 #include "chrono/physics/ChBody.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
 
 #include "chrono_distributed/ChDistributedDataManager.h"
 #include "chrono_distributed/collision/ChCollisionModelDistributed.h"
@@ -57,7 +60,15 @@ static void PrintNode(LocalShapeNode* node) {
 }
 
 ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlayer, unsigned int maxobjects)
-    : ghost_layer(ghostlayer), master_rank(0), num_bodies_global(0) {
+    : ghost_layer(ghostlayer),
+      master_rank(0),
+      num_bodies_global(0),
+      rebalance_interval(0),
+      steps_since_rebalance(0),
+      slim_updates(false),
+      timer_trace(false),
+      dump_pending(false),
+      dump_buffer_index(0) {
     MPI_Comm_dup(communicator, &world);
     MPI_Comm_size(world, &num_ranks);
     MPI_Comm_rank(world, &my_rank);
@@ -115,6 +126,7 @@ ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlaye
 }
 
 ChSystemDistributed::~ChSystemDistributed() {
+    WaitForDump();
     delete domain;
     delete comm;
     // delete ddm;
@@ -134,12 +146,52 @@ bool ChSystemDistributed::Integrate_Y() {
     assert(domain->IsSplit());
     ddm->initial_add = false;
 
+    // Complete the halo exchange posted at the end of the previous step. The
+    // messages have been in flight while the application ran its local work
+    // between steps (output, analysis, ...), so little or no time is spent
+    // waiting here. Incoming ghost data must be in place before the step
+    // performs collision detection.
+    if (num_ranks != 1) {
+        data_manager->system_timer.start("Exchange");
+        comm->ExchangeFinish();
+        data_manager->system_timer.stop("Exchange");
+    }
+
+    // Periodically move the slab boundaries toward an even load across the
+    // ranks. Done here, between exchanges, so that every rank classifies the
+    // bodies of this step against the same decomposition.
+    if (num_ranks != 1 && rebalance_interval > 0 && ++steps_since_rebalance >= rebalance_interval) {
+        domain->Rebalance();
+        steps_since_rebalance = 0;
+    }
+
     bool ret = ChSystemParallelSMC::Integrate_Y();
+
+    // Post this step's halo exchange with nonblocking sends; it is completed
+    // at the start of the next step so that the communication overlaps with
+    // whatever the caller does between steps.
     if (num_ranks != 1) {
         data_manager->system_timer.start("Exchange");
-        comm->Exchange();
+        comm->ExchangeStart();
         data_manager->system_timer.stop("Exchange");
     }
+
+    // Append the aggregated per-step timer trace (collective)
+    if (timer_trace) {
+        std::vector<std::string> names;
+        std::vector<double> tmin, tmax, tmean;
+        std::vector<int> max_rank;
+        AggregateTimers(names, tmin, tmax, tmean, max_rank);
+        if (my_rank == master_rank && timer_trace_file.is_open()) {
+            size_t step = GetStepcount();
+            for (size_t i = 0; i < names.size(); i++) {
+                double imbalance = (tmean[i] > 0) ? tmax[i] / tmean[i] : 1.0;
+                timer_trace_file << step << ',' << names[i] << ',' << tmin[i] << ',' << tmax[i] << ',' << tmean[i]
+                                 << ',' << imbalance << ',' << max_rank[i] << '\n';
+            }
+        }
+    }
+
 #ifdef DistrProfile
     PrintEfficiency();
 #endif
@@ -419,6 +471,162 @@ void ChSystemDistributed::PrintEfficiency() {
     }
 }
 
+void ChSystemDistributed::AggregateTimers(std::vector<std::string>& names,
+                                          std::vector<double>& tmin,
+                                          std::vector<double>& tmax,
+                                          std::vector<double>& tmean,
+                                          std::vector<int>& max_rank) {
+    // All ranks register the same timer names, and std::map iterates in sorted
+    // order, so the positional reductions below line up across ranks.
+    names.clear();
+    std::vector<double> local;
+    for (auto& t : data_manager->system_timer.timer_list) {
+        names.push_back(t.first);
+        local.push_back(t.second.GetSec());
+    }
+    int n = (int)local.size();
+
+    tmin.resize(n);
+    tmax.resize(n);
+    tmean.resize(n);
+    max_rank.resize(n);
+
+    std::vector<double> sum(n);
+    MPI_Reduce(local.data(), tmin.data(), n, MPI_DOUBLE, MPI_MIN, master_rank, world);
+    MPI_Reduce(local.data(), sum.data(), n, MPI_DOUBLE, MPI_SUM, master_rank, world);
+
+    // MAXLOC reduction to identify the rank that attains the max of each timer
+    struct DoubleInt {
+        double val;
+        int rank;
+    };
+    std::vector<DoubleInt> loc(n), glob(n);
+    for (int i = 0; i < n; i++) {
+        loc[i].val = local[i];
+        loc[i].rank = my_rank;
+    }
+    MPI_Reduce(loc.data(), glob.data(), n, MPI_DOUBLE_INT, MPI_MAXLOC, master_rank, world);
+
+    if (my_rank == master_rank) {
+        for (int i = 0; i < n; i++) {
+            tmax[i] = glob[i].val;
+            max_rank[i] = glob[i].rank;
+            tmean[i] = sum[i] / num_ranks;
+        }
+    }
+}
+
+void ChSystemDistributed::PrintTimerAggregates(std::ostream& os) {
+    std::vector<std::string> names;
+    std::vector<double> tmin, tmax, tmean;
+    std::vector<int> max_rank;
+    AggregateTimers(names, tmin, tmax, tmean, max_rank);
+
+    if (my_rank != master_rank)
+        return;
+
+    os << "Timer Report (" << num_ranks << " ranks):" << std::endl;
+    os << "------------" << std::endl;
+    for (size_t i = 0; i < names.size(); i++) {
+        double imbalance = (tmean[i] > 0) ? tmax[i] / tmean[i] : 1.0;
+        os << "Name:\t" << names[i] << "\tmin " << tmin[i] << "\tmax " << tmax[i] << " (rank " << max_rank[i]
+           << ")\tmean " << tmean[i] << "\timbalance " << imbalance << "\n";
+    }
+    os << "------------" << std::endl;
+}
+
+void ChSystemDistributed::EnableTimerTrace(const std::string& filename) {
+    if (my_rank == master_rank) {
+        if (timer_trace_file.is_open())
+            timer_trace_file.close();
+        timer_trace_file.open(filename);
+        timer_trace_file << "step,timer,min_s,max_s,mean_s,imbalance,max_rank\n";
+    }
+    timer_trace = true;
+}
+
+void ChSystemDistributed::DisableTimerTrace() {
+    timer_trace = false;
+    if (my_rank == master_rank && timer_trace_file.is_open())
+        timer_trace_file.close();
+}
+
+void ChSystemDistributed::WriteBinaryDump(const std::string& filename) {
+    // Complete (and close) the previous frame before reusing its resources.
+    WaitForDump();
+
+    // Gather the local indices of the bodies this rank is responsible for,
+    // sorted by global id: MPI file views require monotonically increasing
+    // displacements.
+    std::vector<int> indices;
+    for (int i = 0; i < (int)data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = ddm->comm_status[i];
+        bool mine = status == distributed::OWNED || status == distributed::SHARED_UP ||
+                    status == distributed::SHARED_DOWN ||
+                    (status == distributed::GLOBAL && my_rank == master_rank);
+        if (mine)
+            indices.push_back(i);
+    }
+    std::sort(indices.begin(), indices.end(),
+              [&](int a, int b) { return ddm->global_id[a] < ddm->global_id[b]; });
+
+    // Stage the fixed-width records into the current buffer.
+    std::vector<double>& buf = dump_buffer[dump_buffer_index];
+    buf.clear();
+    buf.reserve(indices.size() * dump_fields);
+    dump_displs.clear();
+    dump_displs.reserve(indices.size());
+    for (int i : indices) {
+        std::shared_ptr<ChBody> body = bodylist[i];
+        dump_displs.push_back((MPI_Aint)ddm->global_id[i] * dump_fields * (MPI_Aint)sizeof(double));
+        buf.push_back((double)ddm->global_id[i]);
+        ChVector<double> pos = body->GetPos();
+        buf.push_back(pos.x());
+        buf.push_back(pos.y());
+        buf.push_back(pos.z());
+        ChQuaternion<double> rot = body->GetRot();
+        buf.push_back(rot.e0());
+        buf.push_back(rot.e1());
+        buf.push_back(rot.e2());
+        buf.push_back(rot.e3());
+        ChVector<double> vel = body->GetPos_dt();
+        buf.push_back(vel.x());
+        buf.push_back(vel.y());
+        buf.push_back(vel.z());
+        ChVector<double> wvel = body->GetWvel_par();
+        buf.push_back(wvel.x());
+        buf.push_back(wvel.y());
+        buf.push_back(wvel.z());
+    }
+
+    MPI_File_open(world, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &dump_file);
+
+    // File view: this rank touches exactly the records of its bodies, at
+    // gid * record-size; the collective write below then lets the MPI library
+    // aggregate everything into large contiguous file accesses.
+    int n = (int)dump_displs.size();
+    MPI_Datatype filetype;
+    MPI_Type_create_hindexed_block(n, dump_fields, dump_displs.data(), MPI_DOUBLE, &filetype);
+    MPI_Type_commit(&filetype);
+    MPI_File_set_view(dump_file, 0, MPI_DOUBLE, filetype, "native", MPI_INFO_NULL);
+    MPI_Type_free(&filetype);
+
+    MPI_File_iwrite_all(dump_file, buf.data(), n * dump_fields, MPI_DOUBLE, &dump_request);
+    dump_pending = true;
+
+    // Swap staging buffers: the next frame fills the other buffer while this
+    // write drains.
+    dump_buffer_index = 1 - dump_buffer_index;
+}
+
+void ChSystemDistributed::WaitForDump() {
+    if (!dump_pending)
+        return;
+    MPI_Wait(&dump_request, MPI_STATUS_IGNORE);
+    MPI_File_close(&dump_file);
+    dump_pending = false;
+}
+
 double ChSystemDistributed::GetLowestZ(uint* local_id) {
     double min = 0;
     for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
@@ -527,6 +735,120 @@ void ChSystemDistributed::SetBodyState(uint gid, const BodyState& state) {
     }
 }
 
+// On-disk layout of a per-rank checkpoint file: a fixed-size header followed
+// by one record per body. Written and read as raw structs, like the MPI
+// message types; a checkpoint is a restart file for the same platform, not a
+// portable archive.
+struct CheckpointHeader {
+    char magic[8];  // "CHDCKPT"
+    uint64_t version;
+    uint64_t num_bodies;
+    double time;
+};
+
+struct CheckpointBody {
+    uint gid;
+    double pos[3];
+    double rot[4];
+    double pos_dt[3];
+    double rot_dt[4];
+};
+
+void ChSystemDistributed::WriteCheckpointAsync(const std::string& filename, utils::ChAsyncWriter& writer) {
+    // Copy the states into the snapshot now; only the file write is deferred.
+    std::vector<CheckpointBody> records;
+    records.reserve(data_manager->num_rigid_bodies);
+    for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = ddm->comm_status[i];
+        if (status != distributed::OWNED && status != distributed::SHARED_UP && status != distributed::SHARED_DOWN)
+            continue;
+
+        CheckpointBody rec = {};
+        rec.gid = ddm->global_id[i];
+
+        ChVector<double> pos = bodylist[i]->GetPos();
+        rec.pos[0] = pos.x();
+        rec.pos[1] = pos.y();
+        rec.pos[2] = pos.z();
+
+        ChQuaternion<double> rot = bodylist[i]->GetRot();
+        rec.rot[0] = rot.e0();
+        rec.rot[1] = rot.e1();
+        rec.rot[2] = rot.e2();
+        rec.rot[3] = rot.e3();
+
+        ChVector<double> pos_dt = bodylist[i]->GetPos_dt();
+        rec.pos_dt[0] = pos_dt.x();
+        rec.pos_dt[1] = pos_dt.y();
+        rec.pos_dt[2] = pos_dt.z();
+
+        ChQuaternion<double> rot_dt = bodylist[i]->GetRot_dt();
+        rec.rot_dt[0] = rot_dt.e0();
+        rec.rot_dt[1] = rot_dt.e1();
+        rec.rot_dt[2] = rot_dt.e2();
+        rec.rot_dt[3] = rot_dt.e3();
+
+        records.push_back(rec);
+    }
+
+    CheckpointHeader header;
+    memset(&header, 0, sizeof(CheckpointHeader));
+    memcpy(header.magic, "CHDCKPT", 7);
+    header.version = 1;
+    header.num_bodies = (uint64_t)records.size();
+    header.time = GetChTime();
+
+    std::string blob(sizeof(CheckpointHeader) + records.size() * sizeof(CheckpointBody), '\0');
+    memcpy(&blob[0], &header, sizeof(CheckpointHeader));
+    if (!records.empty())
+        memcpy(&blob[0] + sizeof(CheckpointHeader), records.data(), records.size() * sizeof(CheckpointBody));
+
+    writer.QueueWrite(filename + "." + std::to_string(my_rank), std::move(blob));
+}
+
+void ChSystemDistributed::ReadCheckpoint(const std::string& filename) {
+    std::vector<uint> gids;
+    std::vector<BodyState> states;
+    double time = 0;
+
+    // Every rank reads the file of every rank, so each rank sees the complete
+    // set of states no matter where the bodies live now.
+    for (int rank = 0; rank < num_ranks; rank++) {
+        std::string rank_file = filename + "." + std::to_string(rank);
+        std::ifstream file(rank_file, std::ios::binary);
+        if (!file) {
+            ErrorAbort(std::string("Cannot open checkpoint file ") + rank_file + "\n");
+        }
+
+        CheckpointHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(CheckpointHeader));
+        if (!file || memcmp(header.magic, "CHDCKPT", 7) != 0 || header.version != 1) {
+            ErrorAbort(std::string("Invalid checkpoint file ") + rank_file + "\n");
+        }
+        time = header.time;
+
+        for (uint64_t n = 0; n < header.num_bodies; n++) {
+            CheckpointBody rec;
+            file.read(reinterpret_cast<char*>(&rec), sizeof(CheckpointBody));
+            if (!file) {
+                ErrorAbort(std::string("Truncated checkpoint file ") + rank_file + "\n");
+            }
+
+            BodyState state;
+            state.pos = ChVector<double>(rec.pos[0], rec.pos[1], rec.pos[2]);
+            state.rot = ChQuaternion<double>(rec.rot[0], rec.rot[1], rec.rot[2], rec.rot[3]);
+            state.pos_dt = ChVector<double>(rec.pos_dt[0], rec.pos_dt[1], rec.pos_dt[2]);
+            state.rot_dt = ChQuaternion<double>(rec.rot_dt[0], rec.rot_dt[1], rec.rot_dt[2], rec.rot_dt[3]);
+
+            gids.push_back(rec.gid);
+            states.push_back(state);
+        }
+    }
+
+    SetBodyStates(gids, states);
+    SetChTime(time);
+}
+
 void ChSystemDistributed::SetSphereShapes(const std::vector<uint>& gids,
                                           const std::vector<int>& shape_idx,
                                           const std::vector<double>& radii) {
@@ -17,8 +17,11 @@
 #include <mpi.h>
 #include <fstream>
 #include <iostream>
+#include <fstream>
+#include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "chrono/physics/ChBody.h"
 
@@ -33,6 +36,10 @@
 
 namespace chrono {
 
+namespace utils {
+class ChAsyncWriter;
+}
+
 class ChDomainDistributed;
 class ChCommDistributed;
 class ChDataManagerDistr;
@@ -77,6 +84,28 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Return the distance into the neighboring sub-domain that is considered shared.
     double GetGhostLayer() const { return ghost_layer; }
 
+    /// Set the number of time steps between domain re-balancing operations.
+    /// A value of 0 (the default) keeps the decomposition fixed. At each
+    /// re-balance the slab boundaries move by at most the ghost layer
+    /// thickness toward an even body count per rank, and bodies change owner
+    /// through the regular exchange machinery over the following steps.
+    void SetRebalanceInterval(int interval) { rebalance_interval = interval; }
+
+    /// Return the number of time steps between domain re-balancing operations.
+    int GetRebalanceInterval() const { return rebalance_interval; }
+
+    /// Enable or disable slim ghost updates (default: disabled).
+    /// When enabled, the per-step state updates of existing ghosts are sent as
+    /// compact messages carrying only the body state, with rotation and
+    /// velocities compressed to single precision; the full update message is
+    /// used only when the comm_status of the body changes. This roughly halves
+    /// the per-step update traffic at the cost of single-precision ghost
+    /// velocities. Must be set identically on all ranks, before the first step.
+    void SetSlimUpdates(bool slim) { slim_updates = slim; }
+
+    /// Return true if slim ghost updates are enabled.
+    bool GetSlimUpdates() const { return slim_updates; }
+
     /// Return the current global number of bodies in the system.
     unsigned int GetNumBodiesGlobal() const { return num_bodies_global; }
 
@@ -135,6 +164,43 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Prints measures for computing efficiency.
     void PrintEfficiency();
 
+    /// Reduces the per-rank timers across all ranks and prints, on the master
+    /// rank, one line per timer with the min/max/mean over ranks, the imbalance
+    /// factor (max over mean), and the rank attaining the max. Collective: must
+    /// be called by all ranks in the communicator.
+    void PrintTimerAggregates(std::ostream& os = std::cout);
+
+    /// Enables a per-step CSV trace of the aggregated timers, appended by the
+    /// master rank to the given file. Each step writes one row per timer:
+    /// step,timer,min_s,max_s,mean_s,imbalance,max_rank. The aggregation is
+    /// collective, so enabling the trace adds one reduction per step on all
+    /// ranks. Must be called by all ranks.
+    void EnableTimerTrace(const std::string& filename);
+
+    /// Stops the per-step timer trace.
+    void DisableTimerTrace();
+
+    /// Number of doubles per body record in WriteBinaryDump().
+    static const int dump_fields = 14;
+
+    /// Collectively writes one fixed-width binary record per body to the given
+    /// file with MPI-IO. Record layout (doubles): global id, position (3),
+    /// rotation quaternion (4), linear velocity (3), angular velocity (3).
+    /// The record of a body sits at byte offset gid * dump_fields * 8, so a
+    /// single globally-ordered file is produced per frame with no postprocess
+    /// merging of per-rank output. Each body is written by exactly one rank:
+    /// its owner (OWNED or SHARED status), or the master rank for bodies with
+    /// GLOBAL status. The write is issued as a nonblocking collective
+    /// (MPI_File_iwrite_all) on an internal staging buffer so that stepping
+    /// can proceed while the I/O drains; the previous frame is completed
+    /// before its buffer is reused. Collective: must be called by all ranks.
+    void WriteBinaryDump(const std::string& filename);
+
+    /// Completes the in-flight binary dump, if any, and closes its file.
+    /// Called automatically by the next WriteBinaryDump() and by the
+    /// destructor. Collective: must be called by all ranks.
+    void WaitForDump();
+
     /// Central data storages for chrono_distributed. Adds scaffolding data
     /// around ChDataManager used by chrono_parallel in order to maintain
     /// a consistent and correct view of all valid data.
@@ -213,6 +279,25 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Must be called on all system ranks; return value valid only on 'master' rank.
     virtual real3 GetBodyContactForce(uint gid) const override;
 
+    /// Write an asynchronous checkpoint of the body states.
+    /// The states of the bodies this rank is responsible for (owned or shared;
+    /// ghosts are skipped, so the union of the per-rank files covers every body
+    /// exactly once) are copied into an in-memory snapshot at the call, which
+    /// must be made at a step boundary; the file <filename>.<rank> is then
+    /// written by the given background writer while stepping continues. The
+    /// snapshot copy takes milliseconds, so the ranks no longer stall on the
+    /// disk. Must be called on all ranks; flush or destroy the writer before
+    /// reading the checkpoint back.
+    void WriteCheckpointAsync(const std::string& filename, utils::ChAsyncWriter& writer);
+
+    /// Restore the body states from the per-rank files written by
+    /// WriteCheckpointAsync. Every rank reads all per-rank files, so ownership
+    /// at restore time need not match ownership at checkpoint time. Must be
+    /// called on all ranks of a system containing the same bodies (same global
+    /// ids) as the one that wrote the checkpoint; bodies not present in the
+    /// checkpoint are left untouched.
+    void ReadCheckpoint(const std::string& filename);
+
   protected:
     /// Number of MPI ranks
     int num_ranks;
@@ -226,6 +311,41 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Length into the neighboring sub-domain which is considered shared.
     double ghost_layer;
 
+    /// Number of time steps between domain re-balancing operations (0 = never).
+    int rebalance_interval;
+
+    /// True if per-step ghost updates are sent as slim state-only messages.
+    bool slim_updates;
+
+    /// True if the per-step aggregated timer trace is enabled.
+    bool timer_trace;
+
+    /// CSV stream of the timer trace. Open on the master rank only.
+    std::ofstream timer_trace_file;
+
+    /// Reduces the current values of all timers across the ranks. The output
+    /// vectors are filled (on the master rank only) in the iteration order of
+    /// the sorted timer map, which is identical on every rank since all ranks
+    /// register the same timer names. Collective.
+    void AggregateTimers(std::vector<std::string>& names,
+                         std::vector<double>& tmin,
+                         std::vector<double>& tmax,
+                         std::vector<double>& tmean,
+                         std::vector<int>& max_rank);
+
+    /// State of the nonblocking binary dump (see WriteBinaryDump): the
+    /// in-flight file and request, and two staging buffers swapped between
+    /// frames so one can be filled while the other is being written.
+    MPI_File dump_file;
+    MPI_Request dump_request;
+    bool dump_pending;
+    std::vector<double> dump_buffer[2];
+    int dump_buffer_index;
+    std::vector<MPI_Aint> dump_displs;  ///< scratch: byte offsets of this rank's records
+
+    /// Number of time steps since the last domain re-balancing operation.
+    int steps_since_rebalance;
+
     /// Number of bodies in the whole global simulation. Important for maintaining
     /// unique global IDs
     unsigned int num_bodies_global;
@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include "chrono_fsi/ChBce.cuh"  //for FsiGeneralData
+#include "chrono_fsi/ChFsiProfiler.cuh"
 
 namespace chrono {
 namespace fsi {
@@ -580,32 +581,25 @@ __global__ void UpdateFlexMarkersPositionVelocityAccD(Real4* posRadD,
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__global__ void Calc_Rigid_FSI_ForcesD(Real3* rigid_FSI_ForcesD, Real4* derivVelRhoD, uint* rigidIdentifierD) {
+__global__ void Calc_Rigid_FSI_Forces_TorquesD(Real3* rigid_FSI_ForcesD,
+                                               Real3* rigid_FSI_TorquesD,
+                                               Real4* derivVelRhoD,
+                                               Real4* posRadD,
+                                               uint* rigidIdentifierD,
+                                               Real3* posRigidD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
     if (index >= numObjectsD.numRigid_SphMarkers) {
         return;
     }
     int RigidIndex = rigidIdentifierD[index];
     uint rigidMarkerIndex = index + numObjectsD.startRigidMarkers;  // updatePortion = [start, end]
+    Real3 mforce = mR3(derivVelRhoD[rigidMarkerIndex]);
+    Real3 dist3 = Distance(mR3(posRadD[rigidMarkerIndex]), posRigidD[RigidIndex]);
+    Real3 mtorque = cross(dist3, mforce);
 
-    atomicAdd(&(rigid_FSI_ForcesD[RigidIndex].x), (double)derivVelRhoD[rigidMarkerIndex].x);
-    atomicAdd(&(rigid_FSI_ForcesD[RigidIndex].y), (double)derivVelRhoD[rigidMarkerIndex].y);
-    atomicAdd(&(rigid_FSI_ForcesD[RigidIndex].z), (double)derivVelRhoD[rigidMarkerIndex].z);
-}
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void Calc_Markers_TorquesD(Real3* rigid_FSI_TorquesD,
-                                      Real4* derivVelRhoD,
-                                      Real4* posRadD,
-                                      uint* rigidIdentifierD,
-                                      Real3* posRigidD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numRigid_SphMarkers) {
-        return;
-    }
-    int RigidIndex = rigidIdentifierD[index];
-    uint rigidMarkerIndex = index + numObjectsD.startRigidMarkers;
-    Real3 dist3 = Distance(mR3(posRadD[rigidMarkerIndex]), posRigidD[rigidIdentifierD[index]]);
-    Real3 mtorque = cross(dist3, mR3(derivVelRhoD[rigidMarkerIndex]));
+    atomicAdd(&(rigid_FSI_ForcesD[RigidIndex].x), (double)mforce.x);
+    atomicAdd(&(rigid_FSI_ForcesD[RigidIndex].y), (double)mforce.y);
+    atomicAdd(&(rigid_FSI_ForcesD[RigidIndex].z), (double)mforce.z);
 
     atomicAdd(&(rigid_FSI_TorquesD[RigidIndex].x), (double)mtorque.x);
     atomicAdd(&(rigid_FSI_TorquesD[RigidIndex].y), (double)mtorque.y);
@@ -805,6 +799,7 @@ void ChBce::RecalcSortedVelocityPressure_BCE(thrust::device_vector<Real3>& velMa
                                              const thrust::device_vector<uint>& mapOriginalToSorted,
                                              const thrust::device_vector<Real3>& bceAcc,
                                              int2 updatePortion) {
+    FSI_PROFILE("Bce_recalcVelocityPressure");
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -842,6 +837,7 @@ void ChBce::CalcBceAcceleration(thrust::device_vector<Real3>& bceAcc,
                                 const thrust::device_vector<Real3>& rigidSPH_MeshPos_LRF_D,
                                 const thrust::device_vector<uint>& rigidIdentifierD,
                                 int numRigid_SphMarkers) {
+    FSI_PROFILE("Bce_calcAcceleration");
     // thread per particle
     uint numThreads, numBlocks;
     computeGridSize(numRigid_SphMarkers, 64, numBlocks, numThreads);
@@ -899,21 +895,19 @@ void ChBce::Rigid_Forces_Torques(SphMarkerDataD* sphMarkersD, FsiBodiesDataD* fs
         return;
     }
 
+    FSI_PROFILE("Bce_rigidForcesTorques");
+
     thrust::fill(fsiGeneralData->rigid_FSI_ForcesD.begin(), fsiGeneralData->rigid_FSI_ForcesD.end(), mR3(0));
     thrust::fill(fsiGeneralData->rigid_FSI_TorquesD.begin(), fsiGeneralData->rigid_FSI_TorquesD.end(), mR3(0));
 
     uint nBlocks_numRigid_SphMarkers;
     uint nThreads_SphMarkers;
     computeGridSize(numObjectsH->numRigid_SphMarkers, 256, nBlocks_numRigid_SphMarkers, nThreads_SphMarkers);
-    Calc_Rigid_FSI_ForcesD<<<nBlocks_numRigid_SphMarkers, nThreads_SphMarkers>>>(
-        mR3CAST(fsiGeneralData->rigid_FSI_ForcesD), mR4CAST(fsiGeneralData->derivVelRhoD),
-        U1CAST(fsiGeneralData->rigidIdentifierD));
-    cudaDeviceSynchronize();
-    cudaCheckError();
-
-    Calc_Markers_TorquesD<<<nBlocks_numRigid_SphMarkers, nThreads_SphMarkers>>>(
-        mR3CAST(fsiGeneralData->rigid_FSI_TorquesD), mR4CAST(fsiGeneralData->derivVelRhoD),
-        mR4CAST(sphMarkersD->posRadD), U1CAST(fsiGeneralData->rigidIdentifierD),
+    // Force and torque of each marker are accumulated in one pass so derivVelRhoD
+    // is read once and a single kernel launch and synchronization suffice.
+    Calc_Rigid_FSI_Forces_TorquesD<<<nBlocks_numRigid_SphMarkers, nThreads_SphMarkers>>>(
+        mR3CAST(fsiGeneralData->rigid_FSI_ForcesD), mR3CAST(fsiGeneralData->rigid_FSI_TorquesD),
+        mR4CAST(fsiGeneralData->derivVelRhoD), mR4CAST(sphMarkersD->posRadD), U1CAST(fsiGeneralData->rigidIdentifierD),
         mR3CAST(fsiBodiesD->posRigid_fsiBodies_D));
     cudaDeviceSynchronize();
     cudaCheckError();
@@ -924,6 +918,8 @@ void ChBce::Flex_Forces(SphMarkerDataD* sphMarkersD, FsiMeshDataD* fsiMeshD) {
         return;
     }
 
+    FSI_PROFILE("Bce_flexForces");
+
     thrust::fill(fsiGeneralData->Flex_FSI_ForcesD.begin(), fsiGeneralData->Flex_FSI_ForcesD.end(), mR3(0));
 
     uint nBlocks_numFlex_SphMarkers;
@@ -944,6 +940,8 @@ void ChBce::UpdateRigidMarkersPositionVelocity(SphMarkerDataD* sphMarkersD, FsiB
         return;
     }
 
+    FSI_PROFILE("Bce_updateRigidMarkers");
+
     uint nBlocks_numRigid_SphMarkers;
     uint nThreads_SphMarkers;
     computeGridSize(numObjectsH->numRigid_SphMarkers, 256, nBlocks_numRigid_SphMarkers, nThreads_SphMarkers);
@@ -969,6 +967,8 @@ void ChBce::UpdateFlexMarkersPositionVelocity(SphMarkerDataD* sphMarkersD, FsiMe
         return;
     }
 
+    FSI_PROFILE("Bce_updateFlexMarkers");
+
     uint nBlocks_numFlex_SphMarkers;
     uint nThreads_SphMarkers;
     printf("UpdateFlexMarkersPositionVelocity..\n");
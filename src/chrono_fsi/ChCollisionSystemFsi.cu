@@ -15,8 +15,18 @@
 // Base class for processing proximity in fsi system.//
 // =============================================================================
 
+#include <thrust/extrema.h>
+#include <thrust/gather.h>
+#include <thrust/inner_product.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/partition.h>
+#include <thrust/scatter.h>
 #include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
 #include "chrono_fsi/ChCollisionSystemFsi.cuh"
+#include "chrono_fsi/ChFsiProfiler.cuh"
 #include "chrono_fsi/ChDeviceUtils.cuh"
 #include "chrono_fsi/ChSphGeneral.cuh"
 
@@ -183,6 +193,24 @@ __global__ void reorderDataAndFindCellStartD(uint* cellStartD,      // output: c
     }
 }
 
+/// Functor returning the squared displacement of a marker with respect to its
+/// position at the last grid build. Used to decide whether the grid can be
+/// reused (Verlet-list style, see SimParams::useVerletCellList).
+struct squared_displacement {
+    __host__ __device__ Real operator()(const thrust::tuple<Real4, Real4>& t) const {
+        Real3 d = mR3(thrust::get<0>(t)) - mR3(thrust::get<1>(t));
+        return dot(d, d);
+    }
+};
+
+/// Predicate on a (new hash, old hash) pair: true when the marker changed cell
+/// since the last cell-list build. Used by the incremental update.
+struct hash_changed {
+    __host__ __device__ bool operator()(const thrust::tuple<uint, uint>& t) const {
+        return thrust::get<0>(t) != thrust::get<1>(t);
+    }
+};
+
 //--------------------------------------------------------------------------------------------------------------------------------
 
 ChCollisionSystemFsi::ChCollisionSystemFsi(SphMarkerDataD* otherSortedSphMarkersD,
@@ -192,7 +220,8 @@ ChCollisionSystemFsi::ChCollisionSystemFsi(SphMarkerDataD* otherSortedSphMarkers
     : sortedSphMarkersD(otherSortedSphMarkersD),
       markersProximityD(otherMarkersProximityD),
       paramsH(otherParamsH),
-      numObjectsH(otherNumObjects) {
+      numObjectsH(otherNumObjects),
+      gridValid(false) {
     //    printf("ChCollisionSystemFsi::ChCollisionSystemFsi constructor\n");
     sphMarkersD = NULL;
 }
@@ -210,13 +239,16 @@ ChCollisionSystemFsi::~ChCollisionSystemFsi() {
 //--------------------------------------------------------------------------------------------------------------------------------
 
 void ChCollisionSystemFsi::calcHash() {
-    if (!(markersProximityD->gridMarkerHashD.size() == numObjectsH->numAllMarkers &&
-          markersProximityD->gridMarkerIndexD.size() == numObjectsH->numAllMarkers)) {
+    calcHash(markersProximityD->gridMarkerHashD, markersProximityD->gridMarkerIndexD);
+}
+
+void ChCollisionSystemFsi::calcHash(thrust::device_vector<uint>& hashD, thrust::device_vector<uint>& indexD) {
+    FSI_PROFILE("Fsi_calcHash");
+    if (!(hashD.size() == numObjectsH->numAllMarkers && indexD.size() == numObjectsH->numAllMarkers)) {
         printf(
             "mError! calcHash!, gridMarkerHashD.size()=%d "
             "gridMarkerIndexD.size()=%d numObjectsH->numAllMarkers %d \n",
-            markersProximityD->gridMarkerHashD.size(), markersProximityD->gridMarkerIndexD.size(),
-            numObjectsH->numAllMarkers);
+            hashD.size(), indexD.size(), numObjectsH->numAllMarkers);
         throw std::runtime_error("Error! size error, calcHash!");
     }
 
@@ -233,8 +265,7 @@ void ChCollisionSystemFsi::calcHash() {
     computeGridSize(numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
     /* Execute Kernel */
 
-    calcHashD<<<numBlocks, numThreads>>>(U1CAST(markersProximityD->gridMarkerHashD),
-                                         U1CAST(markersProximityD->gridMarkerIndexD), mR4CAST(sphMarkersD->posRadD),
+    calcHashD<<<numBlocks, numThreads>>>(U1CAST(hashD), U1CAST(indexD), mR4CAST(sphMarkersD->posRadD),
                                          numObjectsH->numAllMarkers, isErrorD);
 
     /* Check for errors in kernel execution */
@@ -255,6 +286,7 @@ void ChCollisionSystemFsi::ResetCellSize(int s) {
 }
 
 void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
+    FSI_PROFILE("Fsi_reorderDataAndFindCellStart");
     int3 cellsDim = paramsH->gridSize;
     int numCells = cellsDim.x * cellsDim.y * cellsDim.z;
     if (!(markersProximityD->cellStartD.size() == numCells && markersProximityD->cellEndD.size() == numCells)) {
@@ -278,14 +310,100 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     cudaCheckError();
 
     // unroll sorted index to have the location of original particles in the
-    // sorted arrays
-    thrust::device_vector<uint> dummyIndex = markersProximityD->gridMarkerIndexD;
-    thrust::sort_by_key(dummyIndex.begin(), dummyIndex.end(), markersProximityD->mapOriginalToSorted.begin());
-    dummyIndex.clear();
+    // sorted arrays. gridMarkerIndexD is a permutation of 0..N-1, so the scatter
+    // writes each destination exactly once and replaces the full sort that was
+    // used here before.
+    thrust::scatter(thrust::make_counting_iterator<uint>(0),
+                    thrust::make_counting_iterator<uint>(numObjectsH->numAllMarkers),
+                    markersProximityD->gridMarkerIndexD.begin(), markersProximityD->mapOriginalToSorted.begin());
+}
+
+bool ChCollisionSystemFsi::PatchCellLists() {
+    uint numAllMarkers = numObjectsH->numAllMarkers;
+
+    // Current cell hash of every marker, in original marker order
+    currentHashD.resize(numAllMarkers);
+    scratchIndexD.resize(numAllMarkers);
+    calcHash(currentHashD, scratchIndexD);
+
+    // Gather the current hashes into the sorted order of the previous build and
+    // count how many markers changed cell
+    newHashSortedD.resize(numAllMarkers);
+    thrust::gather(markersProximityD->gridMarkerIndexD.begin(), markersProximityD->gridMarkerIndexD.end(),
+                   currentHashD.begin(), newHashSortedD.begin());
+    uint numMoved =
+        thrust::inner_product(newHashSortedD.begin(), newHashSortedD.end(),
+                              markersProximityD->gridMarkerHashD.begin(), (uint)0, thrust::plus<uint>(),
+                              thrust::not_equal_to<uint>());
+
+    Real threshold = (paramsH->cellListChurnThreshold > 0) ? paramsH->cellListChurnThreshold : Real(0.1);
+    if (numMoved > threshold * numAllMarkers)
+        return false;  // too much churn, the full radix sort is cheaper
+
+    if (numMoved == 0)
+        return true;  // every marker kept its cell; keys and order are unchanged
+
+    // Split the (key, index) pairs: the markers that kept their cell form a
+    // subsequence of the previous sorted order (hence still sorted), the moved
+    // ones are sorted as a small batch and merged back.
+    unchangedHashD.resize(numAllMarkers - numMoved);
+    unchangedIndexD.resize(numAllMarkers - numMoved);
+    movedHashD.resize(numMoved);
+    movedIndexD.resize(numMoved);
+
+    thrust::stable_partition_copy(
+        thrust::make_zip_iterator(
+            thrust::make_tuple(newHashSortedD.begin(), markersProximityD->gridMarkerIndexD.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(newHashSortedD.end(), markersProximityD->gridMarkerIndexD.end())),
+        thrust::make_zip_iterator(
+            thrust::make_tuple(newHashSortedD.begin(), markersProximityD->gridMarkerHashD.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(movedHashD.begin(), movedIndexD.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(unchangedHashD.begin(), unchangedIndexD.begin())),
+        hash_changed());
+
+    thrust::sort_by_key(movedHashD.begin(), movedHashD.end(), movedIndexD.begin());
+
+    thrust::merge_by_key(unchangedHashD.begin(), unchangedHashD.end(), movedHashD.begin(), movedHashD.end(),
+                         unchangedIndexD.begin(), movedIndexD.begin(), markersProximityD->gridMarkerHashD.begin(),
+                         markersProximityD->gridMarkerIndexD.begin());
+
+    return true;
 }
 
 void ChCollisionSystemFsi::ArrangeData(SphMarkerDataD* otherSphMarkersD) {
     sphMarkersD = otherSphMarkersD;
+
+    // Verlet-list style reuse: the bins were enlarged by the skin at domain
+    // creation, so as long as no marker has moved more than half the skin
+    // since the last build, the hash, sort, and cell ranges are still valid.
+    // Only the sorted copies of the marker data have to be refreshed.
+    if (paramsH->useVerletCellList && gridValid && buildPosRadD.size() == numObjectsH->numAllMarkers) {
+        Real maxDispSq = thrust::transform_reduce(
+            thrust::make_zip_iterator(thrust::make_tuple(sphMarkersD->posRadD.begin(), buildPosRadD.begin())),
+            thrust::make_zip_iterator(thrust::make_tuple(sphMarkersD->posRadD.end(), buildPosRadD.end())),
+            squared_displacement(), Real(0), thrust::maximum<Real>());
+        Real halfSkin = Real(0.5) * paramsH->verletSkin;
+        if (maxDispSq < halfSkin * halfSkin) {
+            thrust::gather(markersProximityD->gridMarkerIndexD.begin(), markersProximityD->gridMarkerIndexD.end(),
+                           sphMarkersD->posRadD.begin(), sortedSphMarkersD->posRadD.begin());
+            thrust::gather(markersProximityD->gridMarkerIndexD.begin(), markersProximityD->gridMarkerIndexD.end(),
+                           sphMarkersD->velMasD.begin(), sortedSphMarkersD->velMasD.begin());
+            thrust::gather(markersProximityD->gridMarkerIndexD.begin(), markersProximityD->gridMarkerIndexD.end(),
+                           sphMarkersD->rhoPresMuD.begin(), sortedSphMarkersD->rhoPresMuD.begin());
+            return;
+        }
+    }
+
+    // Incremental update: patch the sorted (hash, index) arrays in place when
+    // few markers changed cell, then rebuild the cell ranges and sorted copies.
+    if (paramsH->useIncrementalCellList && gridValid &&
+        markersProximityD->gridMarkerHashD.size() == numObjectsH->numAllMarkers) {
+        if (PatchCellLists()) {
+            reorderDataAndFindCellStart();
+            return;
+        }
+    }
+
     int3 cellsDim = paramsH->gridSize;
     int numCells = cellsDim.x * cellsDim.y * cellsDim.z;
     ResetCellSize(numCells);
@@ -293,6 +411,14 @@ void ChCollisionSystemFsi::ArrangeData(SphMarkerDataD* otherSphMarkersD) {
     thrust::sort_by_key(markersProximityD->gridMarkerHashD.begin(), markersProximityD->gridMarkerHashD.end(),
                         markersProximityD->gridMarkerIndexD.begin());
     reorderDataAndFindCellStart();
+
+    if (paramsH->useVerletCellList) {
+        // Snapshot the build positions for the displacement checks above
+        buildPosRadD = sphMarkersD->posRadD;
+        gridValid = true;
+    } else if (paramsH->useIncrementalCellList) {
+        gridValid = true;
+    }
 }
 
 }  // end namespace fsi
@@ -18,6 +18,8 @@
 #ifndef CH_COLLISIONSYSTEM_FSI_H_
 #define CH_COLLISIONSYSTEM_FSI_H_
 
+#include <thrust/device_vector.h>
+
 #include "chrono_fsi/ChApiFsi.h"
 #include "chrono_fsi/ChFsiGeneral.cuh"
 #include "chrono_fsi/ChSphGeneral.cuh"
@@ -53,12 +55,39 @@ class CH_FSI_API ChCollisionSystemFsi : public ChFsiGeneral {
     SimParams* paramsH;                 ///< Parameters of the simulation
     NumberOfObjects* numObjectsH;       ///< Size of different objects in the system
 
+    bool gridValid;  ///< True when a grid built earlier can still be reused (see paramsH->useVerletCellList)
+
+    /// Marker positions at the last grid build, used to decide when the markers
+    /// have drifted far enough (half the skin) to force a rebuild.
+    thrust::device_vector<Real4> buildPosRadD;
+
+    // Scratch arrays for the incremental cell-list update
+    // (see paramsH->useIncrementalCellList).
+    thrust::device_vector<uint> currentHashD;    ///< cell hash of the current positions, original marker order
+    thrust::device_vector<uint> scratchIndexD;   ///< throw-away index array for the hash kernel
+    thrust::device_vector<uint> newHashSortedD;  ///< current hashes gathered into the previous sorted order
+    thrust::device_vector<uint> unchangedHashD;  ///< keys of markers that kept their cell (still sorted)
+    thrust::device_vector<uint> unchangedIndexD;
+    thrust::device_vector<uint> movedHashD;  ///< keys of markers that changed cell (sorted as a small batch)
+    thrust::device_vector<uint> movedIndexD;
+
     void ResetCellSize(int s);
 
     /// calcHash is the wrapper function for calcHashD. calcHashD is a kernel
     /// function, which means that all the code in it is executed in parallel on the GPU.
     void calcHash();
 
+    /// Variant of calcHash writing into the given hash/index arrays, used by the
+    /// incremental update to compute the current hashes without touching the
+    /// sorted arrays of the previous build.
+    void calcHash(thrust::device_vector<uint>& hashD, thrust::device_vector<uint>& indexD);
+
+    /// Try to update the sorted (hash, index) arrays incrementally: markers that
+    /// kept their cell are still in sorted order, the (few) moved ones are sorted
+    /// as a batch and merged back. Returns false when the churn exceeds the
+    /// threshold and a full rebuild is required.
+    bool PatchCellLists();
+
     /// Wrapper function for reorderDataAndFindCellStartD
     void reorderDataAndFindCellStart();
 };
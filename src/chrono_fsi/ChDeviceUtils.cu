@@ -23,6 +23,37 @@
 namespace chrono {
 namespace fsi {
 
+int ChDeviceUtils::GetNumGpus() {
+    int count = 0;
+    cudaGetDeviceCount(&count);
+    return count;
+}
+
+void ChDeviceUtils::SetGpu(int device) {
+    cudaSetDevice(device);
+    cudaCheckError();
+}
+
+bool ChDeviceUtils::EnablePeerAccess(int device_a, int device_b) {
+    int can_ab = 0;
+    int can_ba = 0;
+    cudaDeviceCanAccessPeer(&can_ab, device_a, device_b);
+    cudaDeviceCanAccessPeer(&can_ba, device_b, device_a);
+    if (!can_ab || !can_ba)
+        return false;
+
+    int current;
+    cudaGetDevice(&current);
+    cudaSetDevice(device_a);
+    cudaError_t err_a = cudaDeviceEnablePeerAccess(device_b, 0);
+    cudaSetDevice(device_b);
+    cudaError_t err_b = cudaDeviceEnablePeerAccess(device_a, 0);
+    cudaSetDevice(current);
+
+    return (err_a == cudaSuccess || err_a == cudaErrorPeerAccessAlreadyEnabled) &&
+           (err_b == cudaSuccess || err_b == cudaErrorPeerAccessAlreadyEnabled);
+}
+
 void ChDeviceUtils::ResizeMyThrust3(thrust::device_vector<Real3>& mThrustVec, int mSize) {
     mThrustVec.resize(mSize);
 }
@@ -61,6 +61,8 @@ typedef unsigned int uint;
 #define mR2CAST(x) (Real2*)thrust::raw_pointer_cast(&x[0])
 #define mR3CAST(x) (Real3*)thrust::raw_pointer_cast(&x[0])
 #define mR4CAST(x) (Real4*)thrust::raw_pointer_cast(&x[0])
+#define F3CAST(x) (float3*)thrust::raw_pointer_cast(&x[0])
+#define F4CAST(x) (float4*)thrust::raw_pointer_cast(&x[0])
 #define TCAST(x) thrust::raw_pointer_cast(x.data())
 #define mR3BY3CAST(x) (Real3By3*)thrust::raw_pointer_cast(&x[0])
 
@@ -146,6 +148,18 @@ class GpuTimer {
 // --------------------------------------------------------------------
 class CH_FSI_API ChDeviceUtils {
   public:
+    /// Returns the number of CUDA devices visible to this process
+    static int GetNumGpus();
+
+    /// Makes the given device current for all subsequent allocations and kernel
+    /// launches on this thread
+    static void SetGpu(int device);
+
+    /// Enables bidirectional peer access between two devices so that
+    /// cudaMemcpyPeer transfers bypass host memory. Returns false if the
+    /// hardware does not support peer access between the pair.
+    static bool EnablePeerAccess(int device_a, int device_b);
+
     /// Resizes a thrust vector of Real3 on the device to a specific size
     static void ResizeMyThrust3(thrust::device_vector<Real3>& mThrustVec, int mSize);
 
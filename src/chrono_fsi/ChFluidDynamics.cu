@@ -342,6 +342,20 @@ ChFluidDynamics::ChFluidDynamics(ChBce* otherBceWorker,
                                  ChFluidDynamics::Integrator type)
     : fsiData(otherFsiData), paramsH(otherParamsH), numObjectsH(otherNumObjects) {
     myIntegrator = type;
+    // Persistent stream and error flags: the substep kernels are enqueued on a
+    // single stream (in-stream ordering replaces the device-wide syncs between
+    // them) and the error flag buffers are allocated once instead of a
+    // cudaMalloc/cudaFree pair per substep.
+    cudaStreamCreate(&stream);
+    cudaMallocHost((void**)&isErrorH, sizeof(bool));
+    cudaMalloc((void**)&isErrorD, sizeof(bool));
+    *isErrorH = false;
+    cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
+    use_graph_capture = false;
+#if CUDART_VERSION >= 10000
+    update_graph_dT = 0;
+    update_graph_markers = 0;
+#endif
     switch (myIntegrator) {
         case ChFluidDynamics::Integrator::IISPH:
             forceSystem =
@@ -383,6 +397,13 @@ void ChFluidDynamics::Finalize() {
 // -----------------------------------------------------------------------------
 
 ChFluidDynamics::~ChFluidDynamics() {
+#if CUDART_VERSION >= 10000
+    for (std::map<void*, cudaGraphExec_t>::iterator it = update_graphs.begin(); it != update_graphs.end(); ++it)
+        cudaGraphExecDestroy(it->second);
+#endif
+    cudaFree(isErrorD);
+    cudaFreeHost(isErrorH);
+    cudaStreamDestroy(stream);
     delete forceSystem;
 }
 // -----------------------------------------------------------------------------
@@ -397,12 +418,62 @@ void ChFluidDynamics::IntegrateSPH(SphMarkerDataD* sphMarkersD2,
     else
         forceSystem->ForceSPH(sphMarkersD1, fsiBodiesD, fsiMeshD);
 
+    // The marker update and the periodic boundary kernels form a fixed sequence
+    // which is enqueued on the persistent stream and synchronized once at the
+    // end, instead of a device-wide sync per kernel. When graph capture is
+    // enabled (and the toolkit supports it), the sequence is captured once per
+    // target marker buffer and replayed as a single graph launch.
+    *isErrorH = false;
+
+#if CUDART_VERSION >= 10000
+    if (use_graph_capture) {
+        // Invalidate cached graphs if the time step or the marker count changed
+        if (update_graph_dT != dT || update_graph_markers != numObjectsH->numAllMarkers) {
+            for (std::map<void*, cudaGraphExec_t>::iterator it = update_graphs.begin(); it != update_graphs.end(); ++it)
+                cudaGraphExecDestroy(it->second);
+            update_graphs.clear();
+            update_graph_dT = dT;
+            update_graph_markers = numObjectsH->numAllMarkers;
+        }
+        std::map<void*, cudaGraphExec_t>::iterator it = update_graphs.find((void*)sphMarkersD2);
+        if (it == update_graphs.end()) {
+            cudaGraph_t graph;
+            cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal);
+            EnqueueUpdateSequence(sphMarkersD2, dT);
+            cudaStreamEndCapture(stream, &graph);
+            cudaGraphExec_t graph_exec;
+            cudaGraphInstantiate(&graph_exec, graph, NULL, NULL, 0);
+            cudaGraphDestroy(graph);
+            it = update_graphs.insert(std::make_pair((void*)sphMarkersD2, graph_exec)).first;
+        }
+        cudaGraphLaunch(it->second, stream);
+    } else {
+        EnqueueUpdateSequence(sphMarkersD2, dT);
+    }
+#else
+    EnqueueUpdateSequence(sphMarkersD2, dT);
+#endif
+
+    cudaStreamSynchronize(stream);
+    cudaCheckError();
+    if (*isErrorH == true) {
+        throw std::runtime_error("Error! program crashed in the fluid update kernels!\n");
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChFluidDynamics::EnqueueUpdateSequence(SphMarkerDataD* sphMarkersD, Real dT) {
+    cudaMemcpyAsync(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice, stream);
+
     if (myIntegrator == ChFluidDynamics::Integrator::IISPH)
-        this->UpdateFluid_Implicit(sphMarkersD2);
+        this->UpdateFluid_Implicit(sphMarkersD);
     else if (GetIntegratorType() == ChFluidDynamics::Integrator::ExplicitSPH)
-        this->UpdateFluid(sphMarkersD2, dT);
+        this->UpdateFluid(sphMarkersD, dT);
+
+    this->ApplyBoundarySPH_Markers(sphMarkersD);
 
-    this->ApplyBoundarySPH_Markers(sphMarkersD2);
+    cudaMemcpyAsync(isErrorH, isErrorD, sizeof(bool), cudaMemcpyDeviceToHost, stream);
 }
 
 // -----------------------------------------------------------------------------
@@ -418,26 +489,13 @@ void ChFluidDynamics::UpdateFluid(SphMarkerDataD* sphMarkersD, Real dT) {
         mI2(0, fsiData->fsiGeneralData.referenceArray[fsiData->fsiGeneralData.referenceArray.size() - 1].y);
     // int2 updatePortion = mI2(referenceArray[0].x, referenceArray[0].y);
 
-    bool *isErrorH, *isErrorD;
-    isErrorH = (bool*)malloc(sizeof(bool));
-    cudaMalloc((void**)&isErrorD, sizeof(bool));
-    *isErrorH = false;
-    cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
     //------------------------
     uint nBlock_UpdateFluid, nThreads;
     computeGridSize(updatePortion.y - updatePortion.x, 128, nBlock_UpdateFluid, nThreads);
-    UpdateFluidD<<<nBlock_UpdateFluid, nThreads>>>(
+    UpdateFluidD<<<nBlock_UpdateFluid, nThreads, 0, stream>>>(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD), mR3CAST(fsiData->fsiGeneralData.vel_XSPH_D),
         mR4CAST(sphMarkersD->rhoPresMuD), mR4CAST(fsiData->fsiGeneralData.derivVelRhoD), updatePortion, dT, isErrorD);
-    cudaDeviceSynchronize();
     cudaCheckError();
-    //------------------------
-    cudaMemcpy(isErrorH, isErrorD, sizeof(bool), cudaMemcpyDeviceToHost);
-    if (*isErrorH == true) {
-        throw std::runtime_error("Error! program crashed in  UpdateFluidD!\n");
-    }
-    cudaFree(isErrorD);
-    free(isErrorH);
 }
 void ChFluidDynamics::UpdateFluid_Implicit(SphMarkerDataD* sphMarkersD) {
     uint numThreads, numBlocks;
@@ -452,25 +510,10 @@ void ChFluidDynamics::UpdateFluid_Implicit(SphMarkerDataD* sphMarkersD) {
     //              << fsiData->fsiGeneralData.referenceArray[haveHelper + haveGhost].y << " in position update\n";
 
     std::cout << "time step in UpdateFluid_Implicit " << paramsH->dT << std::endl;
-    bool *isErrorH, *isErrorD;
-    isErrorH = (bool*)malloc(sizeof(bool));
-    cudaMalloc((void**)&isErrorD, sizeof(bool));
-    *isErrorH = false;
-    cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
-    Update_Fluid_State<<<numBlocks, numThreads>>>(
+    Update_Fluid_State<<<numBlocks, numThreads, 0, stream>>>(
         mR3CAST(fsiData->fsiGeneralData.vel_XSPH_D), mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD),
         mR4CAST(sphMarkersD->rhoPresMuD), updatePortion, numObjectsH->numAllMarkers, paramsH->dT, isErrorD);
-    cudaDeviceSynchronize();
     cudaCheckError();
-
-    cudaMemcpy(isErrorH, isErrorD, sizeof(bool), cudaMemcpyDeviceToHost);
-    if (*isErrorH == true) {
-        throw std::runtime_error("Error! program crashed in  Update_Fluid_State!\n");
-    }
-    //------------------------------------------------------------------------
-
-    cudaFree(isErrorD);
-    free(isErrorH);
 }
 // -----------------------------------------------------------------------------
 /**
@@ -481,18 +524,18 @@ void ChFluidDynamics::UpdateFluid_Implicit(SphMarkerDataD* sphMarkersD) {
 void ChFluidDynamics::ApplyBoundarySPH_Markers(SphMarkerDataD* sphMarkersD) {
     uint nBlock_NumSpheres, nThreads_SphMarkers;
     computeGridSize(numObjectsH->numAllMarkers, 256, nBlock_NumSpheres, nThreads_SphMarkers);
-    ApplyPeriodicBoundaryXKernel<<<nBlock_NumSpheres, nThreads_SphMarkers>>>(mR4CAST(sphMarkersD->posRadD),
-                                                                             mR4CAST(sphMarkersD->rhoPresMuD));
-    cudaDeviceSynchronize();
+    // The three kernels run back to back on the persistent stream; in-stream
+    // ordering makes the intermediate device-wide syncs unnecessary, and the
+    // caller synchronizes the stream once at the end of the substep.
+    ApplyPeriodicBoundaryXKernel<<<nBlock_NumSpheres, nThreads_SphMarkers, 0, stream>>>(
+        mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD));
     cudaCheckError();
     //    // these are useful anyway for out of bound particles
-    ApplyPeriodicBoundaryYKernel<<<nBlock_NumSpheres, nThreads_SphMarkers>>>(mR4CAST(sphMarkersD->posRadD),
-                                                                             mR4CAST(sphMarkersD->rhoPresMuD));
-    cudaDeviceSynchronize();
+    ApplyPeriodicBoundaryYKernel<<<nBlock_NumSpheres, nThreads_SphMarkers, 0, stream>>>(
+        mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD));
     cudaCheckError();
-    ApplyPeriodicBoundaryZKernel<<<nBlock_NumSpheres, nThreads_SphMarkers>>>(mR4CAST(sphMarkersD->posRadD),
-                                                                             mR4CAST(sphMarkersD->rhoPresMuD));
-    cudaDeviceSynchronize();
+    ApplyPeriodicBoundaryZKernel<<<nBlock_NumSpheres, nThreads_SphMarkers, 0, stream>>>(
+        mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD));
     cudaCheckError();
     //    SetOutputPressureToZero_X<<<nBlock_NumSpheres, nThreads_SphMarkers>>>(mR3CAST(posRadD), mR4CAST(rhoPresMuD));
     //    cudaDeviceSynchronize();
@@ -512,18 +555,15 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(SphMarkerDataD* sphMarkersD) {
 void ChFluidDynamics::ApplyModifiedBoundarySPH_Markers(SphMarkerDataD* sphMarkersD) {
     uint nBlock_NumSpheres, nThreads_SphMarkers;
     computeGridSize(numObjectsH->numAllMarkers, 256, nBlock_NumSpheres, nThreads_SphMarkers);
-    ApplyInletBoundaryXKernel<<<nBlock_NumSpheres, nThreads_SphMarkers>>>(
+    ApplyInletBoundaryXKernel<<<nBlock_NumSpheres, nThreads_SphMarkers, 0, stream>>>(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD), mR4CAST(sphMarkersD->rhoPresMuD));
-    cudaDeviceSynchronize();
     cudaCheckError();
     // these are useful anyway for out of bound particles
-    ApplyPeriodicBoundaryYKernel<<<nBlock_NumSpheres, nThreads_SphMarkers>>>(mR4CAST(sphMarkersD->posRadD),
-                                                                             mR4CAST(sphMarkersD->rhoPresMuD));
-    cudaDeviceSynchronize();
+    ApplyPeriodicBoundaryYKernel<<<nBlock_NumSpheres, nThreads_SphMarkers, 0, stream>>>(
+        mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD));
     cudaCheckError();
-    ApplyPeriodicBoundaryZKernel<<<nBlock_NumSpheres, nThreads_SphMarkers>>>(mR4CAST(sphMarkersD->posRadD),
-                                                                             mR4CAST(sphMarkersD->rhoPresMuD));
-    cudaDeviceSynchronize();
+    ApplyPeriodicBoundaryZKernel<<<nBlock_NumSpheres, nThreads_SphMarkers, 0, stream>>>(
+        mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD));
     cudaCheckError();
 }
 // -----------------------------------------------------------------------------
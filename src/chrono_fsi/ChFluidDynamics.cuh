@@ -19,6 +19,8 @@
 #ifndef CH_FLUIDDYNAMICS_H_
 #define CH_FLUIDDYNAMICS_H_
 
+#include <map>
+
 #include "chrono_fsi/ChFsiForce.cuh"
 
 #include "chrono_fsi/ChSphGeneral.cuh"
@@ -94,6 +96,15 @@ class CH_FSI_API ChFluidDynamics : public ChFsiGeneral {
 
     ChFsiForce* GetForceSystem() { return forceSystem; }
 
+    /// Enable/disable CUDA graph capture of the fixed marker update + boundary
+    /// kernel sequence of each substep (disabled by default; requires CUDA 10,
+    /// silently ignored on older toolkits). The sequence is captured once per
+    /// target marker buffer and replayed as a single graph launch afterwards,
+    /// removing the per-kernel launch latency, which at small substep grains is
+    /// a significant fraction of GPU time. The captured graphs are invalidated
+    /// automatically if the time step or the number of markers changes.
+    void EnableGraphCapture(bool val) { use_graph_capture = val; }
+
   protected:
     ChFsiDataManager* fsiData;  ///< pointer to the fsi data. The values are maintained externally
 
@@ -114,6 +125,22 @@ class CH_FSI_API ChFluidDynamics : public ChFsiGeneral {
     /// The function applies periodic boundary to the markers.
     virtual void ApplyBoundarySPH_Markers(SphMarkerDataD* sphMarkersD);
     virtual void ApplyModifiedBoundarySPH_Markers(SphMarkerDataD* sphMarkersD);
+
+    /// Enqueue the marker update + periodic boundary kernels for one substep on
+    /// the persistent stream, without synchronizing. Used both for the direct
+    /// path and as the capture body when graph capture is enabled.
+    void EnqueueUpdateSequence(SphMarkerDataD* sphMarkersD, Real dT);
+
+    cudaStream_t stream;  ///< persistent stream on which the substep kernels are enqueued
+    bool* isErrorH;       ///< pinned host-side error flag, reused across substeps
+    bool* isErrorD;       ///< device-side error flag, reused across substeps
+
+    bool use_graph_capture;  ///< replay the captured update sequence as a CUDA graph (CUDA 10+)
+#if CUDART_VERSION >= 10000
+    std::map<void*, cudaGraphExec_t> update_graphs;  ///< captured update sequence per target marker buffer
+    Real update_graph_dT;                            ///< time step the cached graphs were captured with
+    uint update_graph_markers;                       ///< marker count the cached graphs were captured with
+#endif
 };
 
 /// @} fsi_physics
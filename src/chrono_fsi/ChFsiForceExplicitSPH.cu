@@ -14,19 +14,39 @@
 #include <thrust/extrema.h>
 #include <thrust/sort.h>
 #include "chrono_fsi/ChFsiForceExplicitSPH.cuh"
+#include "chrono_fsi/ChFsiProfiler.cuh"
 
 //==========================================================================================================================================
 namespace chrono {
 namespace fsi {
 //--------------------------------------------------------------------------------------------------------------------------------
+// Neighbor data loads, overloaded so the same kernels can read either the native
+// Real arrays or the single-precision mirrors. Values are widened to Real before
+// use; all arithmetic and accumulation stay in full precision.
+__device__ inline Real3 FetchPos(const Real4& p) {
+    return mR3(p);
+}
+__device__ inline Real3 FetchVel(const Real3& v) {
+    return v;
+}
+#ifdef CHRONO_FSI_USE_DOUBLE
+__device__ inline Real3 FetchPos(const float4& p) {
+    return mR3((Real)p.x, (Real)p.y, (Real)p.z);
+}
+__device__ inline Real3 FetchVel(const float3& v) {
+    return mR3((Real)v.x, (Real)v.y, (Real)v.z);
+}
+#endif
+//--------------------------------------------------------------------------------------------------------------------------------
 // collide a particle against all other particles in a given cell
+template <typename TP4, typename TV3>
 __device__ Real3 deltaVShare(int3 gridPos,
                              uint index,
                              Real3 posRadA,
                              Real3 velMasA,
                              Real4 rhoPresMuA,
-                             Real4* sortedPosRad,
-                             Real3* sortedVelMas,
+                             TP4* sortedPosRad,
+                             TV3* sortedVelMas,
                              Real4* sortedRhoPreMu,
                              uint* cellStart,
                              uint* cellEnd) {
@@ -41,7 +61,7 @@ __device__ Real3 deltaVShare(int3 gridPos,
 
         for (uint j = startIndex; j < endIndex; j++) {
             if (j != index) {  // check not colliding with self
-                Real3 posRadB = mR3(sortedPosRad[j]);
+                Real3 posRadB = FetchPos(sortedPosRad[j]);
                 Real3 dist3 = Distance(posRadA, posRadB);
                 Real d = length(dist3);
                 if (d > RESOLUTION_LENGTH_MULT * paramsD.HSML)
@@ -57,7 +77,7 @@ __device__ Real3 deltaVShare(int3 gridPos,
 
                 Real rho_bar = 0.5 * (rhoPresMuA.x + rhoPresMuB.x);
 
-                Real3 velMasB = sortedVelMas[j];
+                Real3 velMasB = FetchVel(sortedVelMas[j]);
                 deltaV += paramsD.markerMass * (velMasB - velMasA) * W3(d) / rho_bar;
             }
         }
@@ -153,14 +173,15 @@ __device__ inline Real4 DifVelocityRho(Real3& dist3,
 }
 //--------------------------------------------------------------------------------------------------------------------------------
 // collide a particle against all other particles in a given cell
+template <typename TP4, typename TV3>
 __device__ Real4 collideCell(int3 gridPos,
                              uint index,
                              Real3 posRadA,
                              Real3 velMasA,
                              Real3 vel_XSPH_A,
                              Real4 rhoPresMuA,
-                             Real4* sortedPosRad,
-                             Real3* sortedVelMas,
+                             TP4* sortedPosRad,
+                             TV3* sortedVelMas,
                              Real3* vel_XSPH_Sorted_D,
                              Real4* sortedRhoPreMu,
                              Real3* velMas_ModifiedBCE,
@@ -181,7 +202,7 @@ __device__ Real4 collideCell(int3 gridPos,
 
     for (uint j = startIndex; j < endIndex; j++) {
         if (j != index) {  // check not colliding with self
-            Real3 posRadB = mR3(sortedPosRad[j]);
+            Real3 posRadB = FetchPos(sortedPosRad[j]);
             Real3 dist3Alpha = posRadA - posRadB;
             //			Real3 dist3 = Distance(posRadA, posRadB);
             Real3 dist3 = Modify_Local_PosB(posRadB, posRadA);
@@ -204,7 +225,7 @@ __device__ Real4 collideCell(int3 gridPos,
                 printf("Error! particle rhoPresMuB is NAN: thrown from modifyPressure !\n");
             }
 
-            Real3 velMasB = sortedVelMas[j];
+            Real3 velMasB = FetchVel(sortedVelMas[j]);
             if (rhoPresMuB.w > -1.0) {
                 int bceIndexB = gridMarkerIndex[j] - (numObjectsD.numFluidMarkers);
                 if (!(bceIndexB >= 0 && bceIndexB < numObjectsD.numBoundaryMarkers + numObjectsD.numRigid_SphMarkers)) {
@@ -230,9 +251,10 @@ __device__ Real4 collideCell(int3 gridPos,
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
+template <typename TP4, typename TV3>
 __global__ void newVel_XSPH_D(Real3* vel_XSPH_Sorted_D,  // output: new velocity
-                              Real4* sortedPosRad,       // input: sorted positions
-                              Real3* sortedVelMas,       // input: sorted velocities
+                              TP4* sortedPosRad,         // input: sorted positions
+                              TV3* sortedVelMas,         // input: sorted velocities
                               Real4* sortedRhoPreMu,
                               uint* gridMarkerIndex,  // input: sorted particle indices
                               uint* cellStart,
@@ -247,14 +269,14 @@ __global__ void newVel_XSPH_D(Real3* vel_XSPH_Sorted_D,  // output: new velocity
     sortedRhoPreMu[index].y = Eos(sortedRhoPreMu[index].x, sortedRhoPreMu[index].w);  //
 
     Real4 rhoPreMuA = sortedRhoPreMu[index];
-    Real3 velMasA = sortedVelMas[index];
+    Real3 velMasA = FetchVel(sortedVelMas[index]);
     //    if (rhoPreMuA.w > -0.1) {  // v_XSPH is calculated only for fluid markers. Keep
     //                               // unchanged if not fluid.
     //        vel_XSPH_Sorted_D[index] = velMasA;
     //        return;
     //    }
 
-    Real3 posRadA = mR3(sortedPosRad[index]);
+    Real3 posRadA = FetchPos(sortedPosRad[index]);
     Real3 deltaV = mR3(0);
 
     // get address in grid
@@ -286,9 +308,10 @@ __global__ void newVel_XSPH_D(Real3* vel_XSPH_Sorted_D,  // output: new velocity
     vel_XSPH_Sorted_D[index] = vXSPH;
 }
 //--------------------------------------------------------------------------------------------------------------------------------
+template <typename TP4, typename TV3>
 __global__ void collideD(Real4* sortedDerivVelRho_fsi_D,  // output: new velocity
-                         Real4* sortedPosRad,             // input: sorted positions
-                         Real3* sortedVelMas,             // input: sorted velocities
+                         TP4* sortedPosRad,               // input: sorted positions
+                         TV3* sortedVelMas,               // input: sorted velocities
                          Real3* vel_XSPH_Sorted_D,
                          Real4* sortedRhoPreMu,
                          Real3* velMas_ModifiedBCE,
@@ -303,8 +326,8 @@ __global__ void collideD(Real4* sortedDerivVelRho_fsi_D,  // output: new velocit
         return;
 
     // read particle data from sorted arrays
-    Real3 posRadA = mR3(sortedPosRad[index]);
-    Real3 velMasA = sortedVelMas[index];
+    Real3 posRadA = FetchPos(sortedPosRad[index]);
+    Real3 velMasA = FetchVel(sortedVelMas[index]);
     Real4 rhoPreMuA = sortedRhoPreMu[index];
 
     // *** comment these couple of lines since we don't want the force on the
@@ -376,6 +399,7 @@ ChFsiForceExplicitSPH::ChFsiForceExplicitSPH(
                  otherFsiGeneralData,
                  otherParamsH,
                  otherNumObjects) {
+    use_float_neighbors = false;
     CopyParams_NumberOfObjects(paramsH, numObjectsH);
 }
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -395,12 +419,47 @@ void ChFsiForceExplicitSPH::ForceSPH(SphMarkerDataD* otherSphMarkersD,
     sphMarkersD = otherSphMarkersD;
     fsiCollisionSystem->ArrangeData(sphMarkersD);
     bceWorker->ModifyBceVelocity(sphMarkersD, otherFsiBodiesD);
+#ifdef CHRONO_FSI_USE_DOUBLE
+    if (use_float_neighbors)
+        RefreshNeighborMirror();
+#endif
     CalculateXSPH_velocity();
     CollideWrapper();
     AddGravityToFluid();
 }
 
+#ifdef CHRONO_FSI_USE_DOUBLE
+//--------------------------------------------------------------------------------------------------------------------------------
+__global__ void copyNeighborMirrorD(Real4* sortedPosRad,
+                                    Real3* sortedVelMas,
+                                    float4* sortedPosRadF,
+                                    float3* sortedVelMasF,
+                                    uint numAllMarkers) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numAllMarkers)
+        return;
+    Real4 p = sortedPosRad[index];
+    sortedPosRadF[index] = make_float4((float)p.x, (float)p.y, (float)p.z, (float)p.w);
+    Real3 v = sortedVelMas[index];
+    sortedVelMasF[index] = make_float3((float)v.x, (float)v.y, (float)v.z);
+}
+
+void ChFsiForceExplicitSPH::RefreshNeighborMirror() {
+    FSI_PROFILE("ExplicitSPH_copyNeighborMirror");
+    sortedPosRadF.resize(numObjectsH->numAllMarkers);
+    sortedVelMasF.resize(numObjectsH->numAllMarkers);
+    uint numThreads, numBlocks;
+    computeGridSize(numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
+    copyNeighborMirrorD<<<numBlocks, numThreads>>>(mR4CAST(sortedSphMarkersD->posRadD),
+                                                   mR3CAST(sortedSphMarkersD->velMasD), F4CAST(sortedPosRadF),
+                                                   F3CAST(sortedVelMasF), numObjectsH->numAllMarkers);
+    cudaDeviceSynchronize();
+    cudaCheckError();
+}
+#endif
+
 void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
+    FSI_PROFILE("ExplicitSPH_newVel_XSPH");
     /* Calculate vel_XSPH */
     if (vel_XSPH_Sorted_D.size() != numObjectsH->numAllMarkers) {
         printf("vel_XSPH_Sorted_D.size() %u numObjectsH->numAllMarkers %d \n", vel_XSPH_Sorted_D.size(),
@@ -421,11 +480,22 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
     computeGridSize(numObjectsH->numAllMarkers, 64, numBlocks, numThreads);
 
     /* Execute the kernel */
-    newVel_XSPH_D<<<numBlocks, numThreads>>>(
-        mR3CAST(vel_XSPH_Sorted_D), mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
-        mR4CAST(sortedSphMarkersD->rhoPresMuD), U1CAST(markersProximityD->gridMarkerIndexD),
-        U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD), numObjectsH->numAllMarkers,
-        isErrorD);
+#ifdef CHRONO_FSI_USE_DOUBLE
+    if (use_float_neighbors) {
+        newVel_XSPH_D<<<numBlocks, numThreads>>>(
+            mR3CAST(vel_XSPH_Sorted_D), F4CAST(sortedPosRadF), F3CAST(sortedVelMasF),
+            mR4CAST(sortedSphMarkersD->rhoPresMuD), U1CAST(markersProximityD->gridMarkerIndexD),
+            U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD), numObjectsH->numAllMarkers,
+            isErrorD);
+    } else
+#endif
+    {
+        newVel_XSPH_D<<<numBlocks, numThreads>>>(
+            mR3CAST(vel_XSPH_Sorted_D), mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
+            mR4CAST(sortedSphMarkersD->rhoPresMuD), U1CAST(markersProximityD->gridMarkerIndexD),
+            U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD), numObjectsH->numAllMarkers,
+            isErrorD);
+    }
 
     cudaDeviceSynchronize();
     cudaCheckError();
@@ -445,11 +515,12 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
  * @details
  * 		See SDKCollisionSystem.cuh for informaton on collide
  */
+template <typename TP4, typename TV3>
 void ChFsiForceExplicitSPH::collide(
 
     thrust::device_vector<Real4>& sortedDerivVelRho_fsi_D,
-    thrust::device_vector<Real4>& sortedPosRad,
-    thrust::device_vector<Real3>& sortedVelMas,
+    thrust::device_vector<TP4>& sortedPosRad,
+    thrust::device_vector<TV3>& sortedVelMas,
     thrust::device_vector<Real3>& vel_XSPH_Sorted_D,
     thrust::device_vector<Real4>& sortedRhoPreMu,
     thrust::device_vector<Real3>& velMas_ModifiedBCE,
@@ -458,6 +529,7 @@ void ChFsiForceExplicitSPH::collide(
     thrust::device_vector<uint>& gridMarkerIndex,
     thrust::device_vector<uint>& cellStart,
     thrust::device_vector<uint>& cellEnd) {
+    FSI_PROFILE("ExplicitSPH_collide");
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -470,7 +542,7 @@ void ChFsiForceExplicitSPH::collide(
 
     // execute the kernel
     collideD<<<numBlocks, numThreads>>>(
-        mR4CAST(sortedDerivVelRho_fsi_D), mR4CAST(sortedPosRad), mR3CAST(sortedVelMas), mR3CAST(vel_XSPH_Sorted_D),
+        mR4CAST(sortedDerivVelRho_fsi_D), TCAST(sortedPosRad), TCAST(sortedVelMas), mR3CAST(vel_XSPH_Sorted_D),
         mR4CAST(sortedRhoPreMu), mR3CAST(velMas_ModifiedBCE), mR4CAST(rhoPreMu_ModifiedBCE), U1CAST(gridMarkerIndex),
         U1CAST(cellStart), U1CAST(cellEnd), numObjectsH->numAllMarkers, isErrorD);
 
@@ -502,20 +574,33 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
                                       // in the device memory
     thrust::fill(m_dSortedDerivVelRho_fsi_D.begin(), m_dSortedDerivVelRho_fsi_D.end(), mR4(0.0));
 
-    collide(m_dSortedDerivVelRho_fsi_D, sortedSphMarkersD->posRadD, sortedSphMarkersD->velMasD, vel_XSPH_Sorted_D,
-            sortedSphMarkersD->rhoPresMuD, bceWorker->velMas_ModifiedBCE, bceWorker->rhoPreMu_ModifiedBCE,
-            markersProximityD->gridMarkerIndexD, markersProximityD->cellStartD, markersProximityD->cellEndD);
+#ifdef CHRONO_FSI_USE_DOUBLE
+    if (use_float_neighbors) {
+        collide(m_dSortedDerivVelRho_fsi_D, sortedPosRadF, sortedVelMasF, vel_XSPH_Sorted_D,
+                sortedSphMarkersD->rhoPresMuD, bceWorker->velMas_ModifiedBCE, bceWorker->rhoPreMu_ModifiedBCE,
+                markersProximityD->gridMarkerIndexD, markersProximityD->cellStartD, markersProximityD->cellEndD);
+    } else
+#endif
+    {
+        collide(m_dSortedDerivVelRho_fsi_D, sortedSphMarkersD->posRadD, sortedSphMarkersD->velMasD, vel_XSPH_Sorted_D,
+                sortedSphMarkersD->rhoPresMuD, bceWorker->velMas_ModifiedBCE, bceWorker->rhoPreMu_ModifiedBCE,
+                markersProximityD->gridMarkerIndexD, markersProximityD->cellStartD, markersProximityD->cellEndD);
+    }
 
-    CopySortedToOriginal_NonInvasive_R3(fsiGeneralData->vel_XSPH_D, vel_XSPH_Sorted_D,
-                                        markersProximityD->gridMarkerIndexD);
-    CopySortedToOriginal_NonInvasive_R4(fsiGeneralData->derivVelRhoD, m_dSortedDerivVelRho_fsi_D,
-                                        markersProximityD->gridMarkerIndexD);
+    {
+        FSI_PROFILE("ExplicitSPH_copySortedToOriginal");
+        CopySortedToOriginal_NonInvasive_R3(fsiGeneralData->vel_XSPH_D, vel_XSPH_Sorted_D,
+                                            markersProximityD->gridMarkerIndexD);
+        CopySortedToOriginal_NonInvasive_R4(fsiGeneralData->derivVelRhoD, m_dSortedDerivVelRho_fsi_D,
+                                            markersProximityD->gridMarkerIndexD);
+    }
 
     m_dSortedDerivVelRho_fsi_D.clear();
     // vel_XSPH_Sorted_D.clear();
 }
 //--------------------------------------------------------------------------------------------------------------------------------
 void ChFsiForceExplicitSPH::AddGravityToFluid() {
+    FSI_PROFILE("ExplicitSPH_addGravity");
     // add gravity to fluid markers
     /* Add outside forces. Don't add gravity to rigids, BCE, and boundaries, it is
      * added in ChSystem */
@@ -40,6 +40,15 @@ class CH_FSI_API ChFsiForceExplicitSPH : public ChFsiForce {
     ~ChFsiForceExplicitSPH();
     void Finalize() override;
 
+    /// Enable/disable reading neighbor positions and velocities from a packed
+    /// single-precision mirror of the sorted arrays inside the force kernels
+    /// (disabled by default; only effective in double-precision builds). The
+    /// mirror is refreshed once per substep after sorting and roughly halves
+    /// the per-neighbor bandwidth of the WCSPH kernels; all arithmetic and
+    /// accumulation stay in full precision, and densities/pressures are always
+    /// read at full precision.
+    void EnableSinglePrecisionNeighbors(bool val) { use_float_neighbors = val; }
+
   private:
     void ForceSPH(SphMarkerDataD* otherSphMarkersD, FsiBodiesDataD* otherFsiBodiesD, FsiMeshDataD* fsiMeshD) override;
 
@@ -54,9 +63,12 @@ class CH_FSI_API ChFsiForceExplicitSPH : public ChFsiForce {
 
     /// Function to calculate the force terms for SPH markers.
     /// This function calculates the derivatives of the density and velocity in a WCSPH fashion.
+    /// Templated on the storage type of the sorted position/velocity arrays, so the same
+    /// code path runs on either the native Real arrays or the single-precision mirrors.
+    template <typename TP4, typename TV3>
     void collide(thrust::device_vector<Real4>& sortedDerivVelRho_fsi_D,
-                 thrust::device_vector<Real4>& sortedPosRad,
-                 thrust::device_vector<Real3>& sortedVelMas,
+                 thrust::device_vector<TP4>& sortedPosRad,
+                 thrust::device_vector<TV3>& sortedVelMas,
                  thrust::device_vector<Real3>& vel_XSPH_Sorted_D,
                  thrust::device_vector<Real4>& sortedRhoPreMu,
                  thrust::device_vector<Real3>& velMas_ModifiedBCE,
@@ -68,6 +80,15 @@ class CH_FSI_API ChFsiForceExplicitSPH : public ChFsiForce {
 
     /// Function to add gravity force (acceleration) to other forces on SPH  markers.
     void AddGravityToFluid();
+
+    bool use_float_neighbors;  ///< read neighbor data from the FP32 mirrors (see EnableSinglePrecisionNeighbors)
+#ifdef CHRONO_FSI_USE_DOUBLE
+    thrust::device_vector<float4> sortedPosRadF;  ///< FP32 mirror of the sorted positions
+    thrust::device_vector<float3> sortedVelMasF;  ///< FP32 mirror of the sorted velocities
+
+    /// Refresh the FP32 mirrors from the freshly sorted arrays (once per substep).
+    void RefreshNeighborMirror();
+#endif
 };
 
 /// @} fsi_physics
@@ -46,14 +46,54 @@ ChFsiInterface::ChFsiInterface(SimParams* other_paramsH,
       ShellElementsNodes(other_ShellElementsNodes),
       rigid_FSI_ForcesD(other_rigid_FSI_ForcesD),
       rigid_FSI_TorquesD(other_rigid_FSI_TorquesD),
-      Flex_FSI_ForcesD(other_Flex_FSI_ForcesD) {
+      Flex_FSI_ForcesD(other_Flex_FSI_ForcesD),
+      rigid_forces_pinnedH(NULL),
+      rigid_torques_pinnedH(NULL),
+      flex_forces_pinnedH(NULL),
+      num_rigid_pinned(0),
+      num_flex_pinned(0) {
     size_t numBodies = mphysicalSystem->Get_bodylist().size();
     chronoRigidBackup = new ChronoBodiesDataH(numBodies);
     chronoFlexMeshBackup = new ChronoMeshDataH(0);
+    cudaStreamCreate(&copy_stream);
+    cudaCheckError();
 }
 
 //------------------------------------------------------------------------------------
-ChFsiInterface::~ChFsiInterface() {}
+ChFsiInterface::~ChFsiInterface() {
+    if (rigid_forces_pinnedH)
+        cudaFreeHost(rigid_forces_pinnedH);
+    if (rigid_torques_pinnedH)
+        cudaFreeHost(rigid_torques_pinnedH);
+    if (flex_forces_pinnedH)
+        cudaFreeHost(flex_forces_pinnedH);
+    cudaStreamDestroy(copy_stream);
+}
+
+//------------------------------------------------------------------------------------
+void ChFsiInterface::EnsureRigidPinned(size_t count) {
+    if (count <= num_rigid_pinned)
+        return;
+    if (rigid_forces_pinnedH)
+        cudaFreeHost(rigid_forces_pinnedH);
+    if (rigid_torques_pinnedH)
+        cudaFreeHost(rigid_torques_pinnedH);
+    cudaHostAlloc((void**)&rigid_forces_pinnedH, count * sizeof(Real3), cudaHostAllocDefault);
+    cudaHostAlloc((void**)&rigid_torques_pinnedH, count * sizeof(Real3), cudaHostAllocDefault);
+    cudaCheckError();
+    num_rigid_pinned = count;
+}
+
+//------------------------------------------------------------------------------------
+void ChFsiInterface::EnsureFlexPinned(size_t count) {
+    if (count <= num_flex_pinned)
+        return;
+    if (flex_forces_pinnedH)
+        cudaFreeHost(flex_forces_pinnedH);
+    cudaHostAlloc((void**)&flex_forces_pinnedH, count * sizeof(Real3), cudaHostAllocDefault);
+    cudaCheckError();
+    num_flex_pinned = count;
+}
 
 void ChFsiInterface::Add_Rigid_ForceTorques_To_ChSystem() {
     size_t numRigids = fsiBodeisPtr->size();
@@ -62,9 +102,21 @@ void ChFsiInterface::Add_Rigid_ForceTorques_To_ChSystem() {
     ChVector<> totalForce(0);
     ChVector<> totalTorque(0);
 
+    // Stage the device forces/torques through the pinned buffers in two batched
+    // asynchronous copies instead of one pageable transfer per element.
+    if (numRigids > 0) {
+        EnsureRigidPinned(numRigids);
+        cudaMemcpyAsync(rigid_forces_pinnedH, mR3CAST((*rigid_FSI_ForcesD)), numRigids * sizeof(Real3),
+                        cudaMemcpyDeviceToHost, copy_stream);
+        cudaMemcpyAsync(rigid_torques_pinnedH, mR3CAST((*rigid_FSI_TorquesD)), numRigids * sizeof(Real3),
+                        cudaMemcpyDeviceToHost, copy_stream);
+        cudaStreamSynchronize(copy_stream);
+        cudaCheckError();
+    }
+
     for (int i = 0; i < numRigids; i++) {
-        chrono::ChVector<> mforce = ChFsiTypeConvert::Real3ToChVector((*rigid_FSI_ForcesD)[i]);
-        chrono::ChVector<> mtorque = ChFsiTypeConvert::Real3ToChVector((*rigid_FSI_TorquesD)[i]);
+        chrono::ChVector<> mforce = ChFsiTypeConvert::Real3ToChVector(rigid_forces_pinnedH[i]);
+        chrono::ChVector<> mtorque = ChFsiTypeConvert::Real3ToChVector(rigid_torques_pinnedH[i]);
         totalForce += mforce;
         totalTorque + mtorque;
         std::shared_ptr<chrono::ChBody> body = (*fsiBodeisPtr)[i];
@@ -240,8 +292,19 @@ void ChFsiInterface::Add_Flex_Forces_To_ChSystem() {
 
     size_t numNodes = fsiNodesPtr->size();
     chrono::ChVector<> total_force(0, 0, 0);
+
+    // Batched readback through the pinned staging buffer; see
+    // Add_Rigid_ForceTorques_To_ChSystem.
+    if (numNodes > 0) {
+        EnsureFlexPinned(numNodes);
+        cudaMemcpyAsync(flex_forces_pinnedH, mR3CAST((*Flex_FSI_ForcesD)), numNodes * sizeof(Real3),
+                        cudaMemcpyDeviceToHost, copy_stream);
+        cudaStreamSynchronize(copy_stream);
+        cudaCheckError();
+    }
+
     for (int i = 0; i < numNodes; i++) {
-        chrono::ChVector<> mforce = ChFsiTypeConvert::Real3ToChVector((*Flex_FSI_ForcesD)[i]);
+        chrono::ChVector<> mforce = ChFsiTypeConvert::Real3ToChVector(flex_forces_pinnedH[i]);
         // if (mforce.Length() != 0.0)
         auto node = std::dynamic_pointer_cast<fea::ChNodeFEAxyzD>(fsi_mesh->GetNode(i));
 
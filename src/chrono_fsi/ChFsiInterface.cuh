@@ -122,6 +122,23 @@ class CH_FSI_API ChFsiInterface : public ChFsiGeneral {
     FsiMeshDataH* fsiMeshH;
     ChronoMeshDataH* chronoFlexMeshBackup;  ///< A backup data structure to save the state of the chrono system
     SimParams* paramsH;                     ///< pointer to the simulation parameters
+
+    // Pinned (page-locked) staging buffers, allocated once and grown on
+    // demand, through which the per-step force/torque readbacks are batched
+    // with asynchronous copies on a dedicated stream. This replaces one
+    // pageable cudaMemcpy per body per step with a single batched transfer.
+    Real3* rigid_forces_pinnedH;   ///< Staging buffer for rigid_FSI_ForcesD
+    Real3* rigid_torques_pinnedH;  ///< Staging buffer for rigid_FSI_TorquesD
+    Real3* flex_forces_pinnedH;    ///< Staging buffer for Flex_FSI_ForcesD
+    size_t num_rigid_pinned;       ///< Capacity of the rigid staging buffers
+    size_t num_flex_pinned;        ///< Capacity of the flex staging buffer
+    cudaStream_t copy_stream;      ///< Stream on which the staging copies run
+
+    /// Make sure the rigid staging buffers can hold count entries.
+    void EnsureRigidPinned(size_t count);
+
+    /// Make sure the flex staging buffer can hold count entries.
+    void EnsureFlexPinned(size_t count);
 };
 
 /// @} fsi_physics
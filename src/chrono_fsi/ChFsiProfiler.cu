@@ -0,0 +1,59 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Implementation of the per-kernel timing registry of the fsi module.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono_fsi/ChFsiProfiler.cuh"
+
+namespace chrono {
+namespace fsi {
+
+ChFsiProfiler& ChFsiProfiler::GetInstance() {
+    static ChFsiProfiler profiler;
+    return profiler;
+}
+
+void ChFsiProfiler::Accumulate(const std::string& name, float msec) {
+    FsiTimerData& data = timer_list[name];
+    data.total_ms += msec;
+    data.runs++;
+}
+
+void ChFsiProfiler::Reset() {
+    timer_list.clear();
+}
+
+double ChFsiProfiler::GetTime(const std::string& name) const {
+    auto it = timer_list.find(name);
+    return it == timer_list.end() ? 0 : it->second.total_ms * 1e-3;
+}
+
+int ChFsiProfiler::GetRuns(const std::string& name) const {
+    auto it = timer_list.find(name);
+    return it == timer_list.end() ? 0 : it->second.runs;
+}
+
+void ChFsiProfiler::PrintReport() const {
+    std::cout << "Timer Report:" << std::endl;
+    std::cout << "------------" << std::endl;
+    for (auto& timer : timer_list) {
+        std::cout << "Name:\t" << timer.first << "\t" << timer.second.total_ms * 1e-3 << "\n";
+    }
+    std::cout << "------------" << std::endl;
+}
+
+}  // end namespace fsi
+}  // end namespace chrono
@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// cudaEvent based per-kernel timing layer for the fsi module. Host-side kernel
+// wrappers mark their body with the FSI_PROFILE macro; when profiling is
+// enabled at run time, each marked region is timed with a pair of cuda events
+// and accumulated under its name, giving in-product visibility into the kernel
+// cost distribution without an external profiler. Disabled (the default), a
+// region costs one boolean test. Defining CHRONO_FSI_NO_PROFILING compiles the
+// markers out entirely.
+//
+// =============================================================================
+
+#ifndef CH_FSIPROFILER_H_
+#define CH_FSIPROFILER_H_
+
+#include <map>
+#include <string>
+
+#include <cuda_runtime.h>
+
+#include "chrono_fsi/ChApiFsi.h"
+
+namespace chrono {
+namespace fsi {
+
+/// Accumulated gpu time of one profiled region.
+struct FsiTimerData {
+    FsiTimerData() : total_ms(0), runs(0) {}
+    double total_ms;  ///< total gpu time, in milliseconds
+    int runs;         ///< number of times the region executed
+};
+
+/// Per-process registry of the profiled kernel timings.
+class CH_FSI_API ChFsiProfiler {
+  public:
+    /// Return the profiler instance.
+    static ChFsiProfiler& GetInstance();
+
+    /// Enable or disable the timing of profiled regions (default: disabled).
+    void SetEnabled(bool val) { enabled = val; }
+    bool IsEnabled() const { return enabled; }
+
+    /// Add a timing sample for the named region.
+    void Accumulate(const std::string& name, float msec);
+
+    /// Drop all accumulated timings.
+    void Reset();
+
+    /// Return the accumulated time of the named region, in seconds
+    /// (0 if never timed).
+    double GetTime(const std::string& name) const;
+
+    /// Return the number of times the named region was timed.
+    int GetRuns(const std::string& name) const;
+
+    /// Print the accumulated timings, in the format of
+    /// ChTimerParallel::PrintReport (name and total time in seconds).
+    void PrintReport() const;
+
+  private:
+    ChFsiProfiler() : enabled(false) {}
+
+    bool enabled;
+    std::map<std::string, FsiTimerData> timer_list;
+};
+
+/// Scoped timer for one profiled region: records a cuda event on construction
+/// and on destruction and accumulates the elapsed gpu time under the given
+/// name. No-op when profiling is disabled.
+class ChFsiProfileRegion {
+  public:
+    ChFsiProfileRegion(const char* name) : m_name(name), m_active(ChFsiProfiler::GetInstance().IsEnabled()) {
+        if (m_active) {
+            cudaEventCreate(&m_start);
+            cudaEventCreate(&m_stop);
+            cudaEventRecord(m_start);
+        }
+    }
+
+    ~ChFsiProfileRegion() {
+        if (m_active) {
+            cudaEventRecord(m_stop);
+            cudaEventSynchronize(m_stop);
+            float msec = 0;
+            cudaEventElapsedTime(&msec, m_start, m_stop);
+            ChFsiProfiler::GetInstance().Accumulate(m_name, msec);
+            cudaEventDestroy(m_start);
+            cudaEventDestroy(m_stop);
+        }
+    }
+
+  private:
+    const char* m_name;
+    bool m_active;
+    cudaEvent_t m_start;
+    cudaEvent_t m_stop;
+};
+
+}  // end namespace fsi
+}  // end namespace chrono
+
+#ifdef CHRONO_FSI_NO_PROFILING
+#define FSI_PROFILE(name)
+#else
+#define FSI_PROFILE(name) chrono::fsi::ChFsiProfileRegion fsi_profile_region_(name)
+#endif
+
+#endif
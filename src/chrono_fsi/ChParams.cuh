@@ -118,6 +118,20 @@ struct SimParams {
     Real binSize0;  ///< Suggests the length of the bin each particle occupies. Normally this would be 2*hsml since hsml
                     ///< is the radius of the particle, but when we have periodic boundary condition varies a little
                     ///< from 2*hsml. This may change slightly due to the location of the periodic BC.
+
+    bool useVerletCellList;  ///< Reuse the proximity grid across substeps (Verlet-list style). The bins are enlarged by
+                             ///< verletSkin and the grid is rebuilt only when some marker has moved more than half the
+                             ///< skin since the last build. Set before utils::FinalizeDomainCreating.
+    Real verletSkin;         ///< Skin added to the bin edge when useVerletCellList is true. A value <= 0 selects
+                             ///< 0.5*HSML. Larger skins mean fewer rebuilds but more neighbor candidates per bin.
+
+    bool useIncrementalCellList;  ///< Update the sorted cell lists incrementally: each substep the markers whose cell
+                                  ///< changed are extracted, sorted as a (small) batch and merged back into the
+                                  ///< still-sorted remainder, instead of re-sorting all markers. Falls back to the full
+                                  ///< sort when the fraction of cell-changed markers exceeds cellListChurnThreshold.
+                                  ///< Effective in quiescent or settled scenarios where most markers keep their cell.
+    Real cellListChurnThreshold;  ///< Fraction of markers allowed to change cell before the incremental update falls
+                                  ///< back to a full re-sort (a value <= 0 selects 0.1).
     Real3 rigidRadius;  ///< Radius of rigid bodies.
 
     int densityReinit;  ///< Reinitialize density after densityReinit steps. Note that doing this more frequently helps
@@ -32,6 +32,8 @@ ChSystemFsi::ChSystemFsi(ChSystem* other_physicalSystem, bool other_haveFluid, C
     : mphysicalSystem(other_physicalSystem), haveFluid(other_haveFluid), mTime(0) {
     fsiData = new ChFsiDataManager();
     paramsH = new SimParams;
+    paramsH->useVerletCellList = false;
+    paramsH->verletSkin = 0;
     numObjectsH = &(fsiData->numObjects);
     fluidIntegrator = type;
     bceWorker = new ChBce(&(fsiData->sortedSphMarkersD), &(fsiData->markersProximityD), &(fsiData->fsiGeneralData),
@@ -89,6 +91,15 @@ void ChSystemFsi::SetFluidSystemLinearSolver(ChFsiLinearSolver::SolverType other
     fluidDynamics->GetForceSystem()->SetLinearSolver(other_solverType);
 }
 //--------------------------------------------------------------------------------------------------------------------------------
+void ChSystemFsi::SetCudaDevice(int device) {
+    ChDeviceUtils::SetGpu(device);
+    int num_gpus = ChDeviceUtils::GetNumGpus();
+    for (int other = 0; other < num_gpus; other++) {
+        if (other != device)
+            ChDeviceUtils::EnablePeerAccess(device, other);
+    }
+}
+//--------------------------------------------------------------------------------------------------------------------------------
 
 void ChSystemFsi::DoStepDynamics_FSI() {
     /// The following is used to execute the previous Explicit SPH
@@ -89,6 +89,14 @@ class CH_FSI_API ChSystemFsi : public ChFsiGeneral {
     ChFsiDataManager* GetDataManager() { return fsiData; }
     void SetFluidSystemLinearSolver(ChFsiLinearSolver::SolverType other_solverType);
 
+    /// Select the CUDA device this FSI system runs on and enable peer access
+    /// with the other visible devices where the hardware supports it. Must be
+    /// called right after construction, before any markers are added, since
+    /// all device arrays are allocated on the current device. Together with
+    /// peer access this allows independent FSI systems to be placed on
+    /// separate devices and exchange marker data via cudaMemcpyPeer.
+    void SetCudaDevice(int device);
+
     /// Get a pointer to the parameters used to set up the simulation.
     SimParams* GetSimParams() { return paramsH; }
 
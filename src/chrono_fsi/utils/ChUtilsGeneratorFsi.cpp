@@ -36,9 +36,15 @@ void FinalizeDomainCreating(SimParams* paramsH) {
     paramsH->ApplyInFlowOutFlow = false;
     paramsH->Apply_BC_U = false;  ///< You should go to custom_math.h all the way to end of file and set your function
     paramsH->ApplyInFlowOutFlow = false;
-    int3 side0 = mI3(floor((paramsH->cMax.x - paramsH->cMin.x) / (2 * paramsH->HSML)),
-                     floor((paramsH->cMax.y - paramsH->cMin.y) / (2 * paramsH->HSML)),
-                     floor((paramsH->cMax.z - paramsH->cMin.z) / (2 * paramsH->HSML)));
+    // The bin edge covers the kernel support; with grid reuse enabled it is
+    // enlarged by the skin so that the one-ring bin search stays exhaustive
+    // while markers drift up to half the skin away from their build positions.
+    if (paramsH->useVerletCellList && paramsH->verletSkin <= 0)
+        paramsH->verletSkin = Real(0.5) * paramsH->HSML;
+    Real binEdge = 2 * paramsH->HSML + (paramsH->useVerletCellList ? paramsH->verletSkin : 0);
+    int3 side0 = mI3(floor((paramsH->cMax.x - paramsH->cMin.x) / binEdge),
+                     floor((paramsH->cMax.y - paramsH->cMin.y) / binEdge),
+                     floor((paramsH->cMax.z - paramsH->cMin.z) / binEdge));
     Real3 binSize3 = mR3((paramsH->cMax.x - paramsH->cMin.x) / side0.x, (paramsH->cMax.y - paramsH->cMin.y) / side0.y,
                          (paramsH->cMax.z - paramsH->cMin.z) / side0.z);
     paramsH->binSize0 = (binSize3.x > binSize3.y) ? binSize3.x : binSize3.y;
@@ -0,0 +1,127 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <unordered_set>
+
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_irrlicht/ChIrrNode.h"
+#include "chrono_irrlicht/ChIrrNodeAsset.h"
+#include "chrono_irrlicht/ChIrrTools.h"
+#include "chrono_irrlicht/ChIrrTransformBuffer.h"
+
+namespace chrono {
+namespace irrlicht {
+
+ChIrrTransformBuffer::ChIrrTransformBuffer()
+    : write_slot(0),
+      pending_slot(1),
+      front_slot(2),
+      fresh(false),
+      scene_change(false),
+      scene_version(0),
+      polled_version(0),
+      last_num_items(0) {}
+
+void ChIrrTransformBuffer::CaptureAssembly(Snapshot& snap, ChAssembly* assembly) {
+    for (auto& body : assembly->Get_bodylist()) {
+        if (!body->GetAssetsFrameNclones()) {
+            snap.items.push_back(body);
+            snap.frames.push_back(body->GetAssetsFrame().GetCoord());
+        }
+    }
+
+    for (auto& mesh : assembly->Get_meshlist()) {
+        snap.items.push_back(mesh);
+        snap.frames.push_back(mesh->GetAssetsFrame().GetCoord());
+    }
+
+    for (auto& ph : assembly->Get_otherphysicslist()) {
+        if (!ph->GetAssetsFrameNclones()) {
+            snap.items.push_back(ph);
+            snap.frames.push_back(ph->GetAssetsFrame().GetCoord());
+        }
+
+        // If the assembly holds other assemblies, also capture their contents.
+        if (auto assy = std::dynamic_pointer_cast<ChAssembly>(ph)) {
+            CaptureAssembly(snap, assy.get());
+        }
+    }
+
+    for (auto& link : assembly->Get_linklist()) {
+        snap.items.push_back(link);
+        snap.frames.push_back(link->GetAssetsFrame().GetCoord());
+    }
+}
+
+void ChIrrTransformBuffer::Capture(ChSystem& system) {
+    Snapshot& snap = buffers[write_slot];
+    snap.items.clear();  // keeps capacity: steady-state captures do not allocate
+    snap.frames.clear();
+
+    CaptureAssembly(snap, &system);
+
+    // items appearing or disappearing is a scene change as well
+    if (scene_change || snap.items.size() != last_num_items)
+        scene_version++;
+    scene_change = false;
+    last_num_items = snap.items.size();
+
+    snap.time = system.GetChTime();
+    snap.scene_version = scene_version;
+
+    // publish: the filled buffer becomes the hand-over slot
+    std::lock_guard<std::mutex> lock(swap_mutex);
+    std::swap(write_slot, pending_slot);
+    fresh = true;
+}
+
+bool ChIrrTransformBuffer::Consume() {
+    std::lock_guard<std::mutex> lock(swap_mutex);
+    if (!fresh)
+        return false;
+    std::swap(front_slot, pending_slot);
+    fresh = false;
+    return true;
+}
+
+bool ChIrrTransformBuffer::PollSceneChange() {
+    if (buffers[front_slot].scene_version == polled_version)
+        return false;
+    polled_version = buffers[front_slot].scene_version;
+    return true;
+}
+
+void ChIrrTransformBuffer::ApplyToScene() {
+    const Snapshot& snap = buffers[front_slot];
+
+    for (size_t i = 0; i < snap.items.size(); i++) {
+        auto item = snap.items[i].lock();
+        if (!item)
+            continue;
+
+        // find the proxy to the ChIrrNode, by scanning the item assets
+        for (auto& asset : item->GetAssets()) {
+            if (auto irrasset = std::dynamic_pointer_cast<ChIrrNodeAsset>(asset)) {
+                if (auto node = irrasset->GetIrrlichtNode()) {
+                    // the node now follows the snapshot, not the live item state
+                    static_cast<ChIrrNode*>(node)->SetChronoControlled(false);
+                    ChIrrTools::alignIrrlichtNodeToChronoCsys(node, snap.frames[i]);
+                }
+                break;
+            }
+        }
+    }
+}
+
+}  // end namespace irrlicht
+}  // end namespace chrono
@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHIRRTRANSFORMBUFFER_H
+#define CHIRRTRANSFORMBUFFER_H
+
+#include <mutex>
+#include <vector>
+
+#include "chrono/core/ChCoordsys.h"
+#include "chrono/physics/ChPhysicsItem.h"
+
+#include "chrono_irrlicht/ChApiIrr.h"
+
+namespace chrono {
+
+class ChSystem;
+class ChAssembly;
+
+namespace irrlicht {
+
+/// @addtogroup irrlicht_module
+/// @{
+
+/// Versioned transform buffer decoupling the simulation loop from the render
+/// loop. The simulation thread captures, after each step (or every few steps),
+/// a snapshot with the assets frame of every physics item; the render thread
+/// consumes the most recent snapshot at its own rate and aligns the Irrlicht
+/// scene nodes to it, without ever touching the live simulation state. The
+/// exchange uses a buffer pair plus a hand-over slot, so neither thread waits
+/// for the other and the only shared section is an index swap under a mutex.
+/// Scene rebuilds (BindAll/UpdateAll of the asset converter) are driven only
+/// by explicit scene-change events, signalled with NoteSceneChange() and
+/// polled on the render side with PollSceneChange(); adding or removing items
+/// is detected automatically.
+///
+/// Typical usage:
+///   - simulation thread, after every DoStepDynamics():
+///       buffer.Capture(my_system);
+///   - render thread, once per frame:
+///       buffer.Consume();
+///       if (buffer.PollSceneChange()) {
+///           application.AssetBindAll();
+///           application.AssetUpdateAll();
+///       }
+///       buffer.ApplyToScene();
+///
+/// Nodes aligned by ApplyToScene() get their 'Chrono controlled' flag turned
+/// off, so that ChIrrNode::OnAnimate() does not re-read the live (and
+/// concurrently advancing) item state during rendering.
+class ChApiIrr ChIrrTransformBuffer {
+  public:
+    /// One captured state of the scene.
+    struct Snapshot {
+        double time = 0;                                  ///< simulation time of the capture
+        unsigned int scene_version = 0;                   ///< bumped on scene-change events
+        std::vector<std::weak_ptr<ChPhysicsItem>> items;  ///< captured items
+        std::vector<ChCoordsys<>> frames;                 ///< assets frame of each item
+    };
+
+    ChIrrTransformBuffer();
+
+    // --- Simulation thread side ---
+
+    /// Capture the assets frames of all items of the system into the buffer
+    /// and publish the snapshot for the render thread. Items whose visual
+    /// assets use frame clones (particle clusters) are not captured; their
+    /// nodes keep following the item in ChIrrNode::OnAnimate().
+    void Capture(ChSystem& system);
+
+    /// Signal that the scene structure changed (assets added to an item, shape
+    /// resized, ...) so that the render thread rebuilds the Irrlicht nodes at
+    /// its next frame. Adding or removing physics items is detected by
+    /// Capture() itself and does not need an explicit call.
+    void NoteSceneChange() { scene_change = true; }
+
+    // --- Render thread side ---
+
+    /// Swap in the most recent published snapshot, if a new one is available.
+    /// Returns true if the visible snapshot changed.
+    bool Consume();
+
+    /// True (once per scene-change event) if the structure of the scene of the
+    /// visible snapshot differs from the last polled one: the caller should
+    /// rebuild the Irrlicht nodes (BindAll/UpdateAll) before ApplyToScene().
+    bool PollSceneChange();
+
+    /// Align the Irrlicht scene nodes of the captured items to the frames of
+    /// the visible snapshot. Items that lost their node (or expired) are
+    /// skipped.
+    void ApplyToScene();
+
+    /// Read access to the visible snapshot (e.g. for custom consumers).
+    const Snapshot& GetSnapshot() const { return buffers[front_slot]; }
+
+  private:
+    /// Append the items of an assembly (and of its sub-assemblies) to 'snap'.
+    void CaptureAssembly(Snapshot& snap, ChAssembly* assembly);
+
+    Snapshot buffers[3];  ///< write slot, hand-over slot and visible slot
+    int write_slot;       ///< buffer the simulation thread fills
+    int pending_slot;     ///< most recent published buffer
+    int front_slot;       ///< buffer the render thread reads
+    bool fresh;           ///< a published snapshot is waiting in the hand-over slot
+
+    bool scene_change;                 ///< set by NoteSceneChange(), consumed at the next Capture()
+    unsigned int scene_version;        ///< version stamped on captured snapshots
+    unsigned int polled_version;       ///< last version seen by PollSceneChange()
+    size_t last_num_items;             ///< item count of the previous capture
+
+    std::mutex swap_mutex;  ///< guards the slot indices
+};
+
+/// @} irrlicht_module
+
+}  // end namespace irrlicht
+}  // end namespace chrono
+
+#endif
@@ -15,7 +15,14 @@
 #ifndef CHSOLVERMKL_H
 #define CHSOLVERMKL_H
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 #include "chrono/core/ChMatrixDynamic.h"
+#include "chrono/parallel/ChOpenMP.h"
 #include "chrono/core/ChSparseMatrix.h"
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolver.h"
@@ -71,7 +78,7 @@ class ChSolverMKL : public ChSolver {
   public:
     ChSolverMKL() { SetSparsityPatternLock(true); }
 
-    ~ChSolverMKL() override {}
+    ~ChSolverMKL() override { SetDedicatedThreadPool(false); }
 
     /// Get a handle to the underlying MKL engine.
     ChMklEngine& GetMklEngine() { return m_engine; }
@@ -106,6 +113,47 @@ class ChSolverMKL : public ChSolver {
     /// Set the number of non-zero entries in the problem matrix.
     void SetMatrixNNZ(int nnz) { m_nnz = nnz; }
 
+    /// Set the number of MKL threads used by the Pardiso calls of this solver (default: 0, MKL default).\n
+    /// The value is applied thread-locally around each Pardiso call (through mkl_set_num_threads_local)
+    /// and restored afterwards, so it does not leak into other MKL users or fight with the global
+    /// setting; Chrono's own OpenMP regions are unaffected. Use this to prevent oversubscription when
+    /// the factorization runs inside (or concurrently with) an OpenMP parallel section.
+    void SetNumThreadsMKL(int num_threads) { m_mkl_threads = num_threads; }
+
+    /// Reserve the MKL threads out of the pool used by Chrono's OpenMP regions (default: false).\n
+    /// When enabled together with #SetNumThreadsMKL(), the OpenMP thread count (as set through
+    /// CHOMPfunctions) is reduced to GetNumProcs() minus the MKL thread count, so that a
+    /// factorization overlapped with other work (e.g. collision detection) runs on its own
+    /// dedicated sub-pool of cores while the rest of Chrono uses the remainder. Disabling
+    /// restores the OpenMP thread count active when the option was enabled.
+    void SetDedicatedThreadPool(bool val) {
+        if (val == m_dedicated_pool)
+            return;
+        m_dedicated_pool = val;
+        if (m_dedicated_pool && m_mkl_threads > 0) {
+            m_omp_threads_saved = CHOMPfunctions::GetMaxThreads();
+            CHOMPfunctions::SetNumThreads(std::max(1, CHOMPfunctions::GetNumProcs() - m_mkl_threads));
+        } else if (!m_dedicated_pool && m_omp_threads_saved > 0) {
+            CHOMPfunctions::SetNumThreads(m_omp_threads_saved);
+            m_omp_threads_saved = 0;
+        }
+    }
+
+    /// Enable caching of Pardiso analysis (reordering) data for up to \a size distinct
+    /// sparsity patterns (default: 0, disabled).\n
+    /// Contact-rich systems often alternate between a small set of recurring patterns;
+    /// when a previously seen pattern recurs, the cached analysis result is reused and
+    /// #Setup() performs the numerical factorization only, skipping the reordering phase.
+    /// Each cached pattern keeps its own Pardiso internal storage alive, so \a size
+    /// should be kept small. Setting \a size to 0 disables the cache and releases its storage.
+    void SetPatternCacheSize(int size) {
+        m_pattern_cache_size = size;
+        if ((int)m_pattern_cache.size() > size) {
+            m_pattern_cache.clear();
+            m_engine_active = &m_engine;
+        }
+    }
+
     /// Reset timers for internal phases in Solve and Setup.
     void ResetTimers() {
         m_timer_setup_assembly.reset();
@@ -137,9 +185,18 @@ class ChSolverMKL : public ChSolver {
     virtual bool Setup(ChSystemDescriptor& sysd) override {
         m_timer_setup_assembly.start();
 
-        // Calculate problem size at first call.
-        if (m_setup_call == 0) {
+        // Calculate problem size at first call and whenever the system topology changed.
+        // A topology change (e.g. a body added to or removed from the system) invalidates
+        // a locked sparsity pattern, so in that case schedule a pattern update before the
+        // matrix is assembled again.
+        if (m_setup_call == 0 || sysd.GetStructureRevision() != m_structure_revision) {
+            if (m_setup_call > 0 && m_lock)
+                m_force_sparsity_pattern_update = true;
+            m_structure_revision = sysd.GetStructureRevision();
             m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
+            // Patterns cached under the previous topology cannot recur; drop them.
+            m_pattern_cache.clear();
+            m_engine_active = &m_engine;
         }
 
         // Let the matrix acquire the information about ChSystem
@@ -166,23 +223,38 @@ class ChSolverMKL : public ChSolver {
         // Allow the matrix to be compressed.
         bool change = m_mat.Compress();
 
+        // Select the engine that will factor (and later solve) with this pattern.
+        // If the pattern cache holds an engine that already analyzed this pattern,
+        // the reordering phase can be skipped.
+        bool analysis_cached = false;
+        if (m_pattern_cache_size > 0) {
+            analysis_cached = FindCachedPattern(PatternFingerprint(m_mat));
+        } else {
+            m_engine_active = &m_engine;
+        }
+
         // Set current matrix in the MKL engine.
-        m_engine.SetMatrix(m_mat);
+        m_engine_active->SetMatrix(m_mat);
 
         // If compression made any change, flag for update of permutation vector.
         if (change && m_use_perm) {
-            m_engine.UsePermutationVector(true);
+            m_engine_active->UsePermutationVector(true);
         }
 
         // The sparsity of rhs must be updated at every cycle (is this true?)
         if (m_use_rhs_sparsity && !m_use_perm)
-            m_engine.UsePartialSolution(2);
+            m_engine_active->UsePartialSolution(2);
 
         m_timer_setup_assembly.stop();
 
-        // Perform the factorization with the Pardiso sparse direct solver.
+        // Perform the factorization with the Pardiso sparse direct solver,
+        // skipping the analysis phase when a cached reordering is available.
         m_timer_setup_solvercall.start();
-        int pardiso_message_phase12 = m_engine.PardisoCall(ChMklEngine::phase_t::ANALYSIS_NUMFACTORIZATION, 0);
+        int mkl_threads_prev = PushMklThreads();
+        int pardiso_message_phase12 = m_engine_active->PardisoCall(
+            analysis_cached ? ChMklEngine::phase_t::NUMFACTORIZATION : ChMklEngine::phase_t::ANALYSIS_NUMFACTORIZATION,
+            0);
+        PopMklThreads(mkl_threads_prev);
         m_timer_setup_solvercall.stop();
 
         m_setup_call++;
@@ -208,13 +280,15 @@ class ChSolverMKL : public ChSolver {
         m_timer_solve_assembly.start();
         sysd.ConvertToMatrixForm(nullptr, &m_rhs);
         m_sol.Resize(m_rhs.GetRows(), 1);
-        m_engine.SetRhsVector(m_rhs);
-        m_engine.SetSolutionVector(m_sol);
+        m_engine_active->SetRhsVector(m_rhs);
+        m_engine_active->SetSolutionVector(m_sol);
         m_timer_solve_assembly.stop();
 
         // Solve the problem using Pardiso.
         m_timer_solve_solvercall.start();
-        int pardiso_message_phase33 = m_engine.PardisoCall(ChMklEngine::phase_t::SOLVE, 0);
+        int mkl_threads_prev = PushMklThreads();
+        int pardiso_message_phase33 = m_engine_active->PardisoCall(ChMklEngine::phase_t::SOLVE, 0);
+        PopMklThreads(mkl_threads_prev);
         m_timer_solve_solvercall.stop();
 
         m_solve_call++;
@@ -225,7 +299,7 @@ class ChSolverMKL : public ChSolver {
         }
 
         if (verbose) {
-            double res_norm = m_engine.GetResidualNorm();
+            double res_norm = m_engine_active->GetResidualNorm();
             GetLog() << " MKL solve call " << m_solve_call << "  |residual| = " << res_norm << "\n";
             GetLog() << "  assembly: " << m_timer_solve_assembly.GetTimeSecondsIntermediate() << "s\n"
                      << "  solver_call: " << m_timer_solve_solvercall.GetTimeSecondsIntermediate() << "\n";
@@ -264,6 +338,80 @@ class ChSolverMKL : public ChSolver {
     }
 
   private:
+    /// Apply the per-solver MKL thread count for the calling thread.
+    /// Return the previous thread-local value, to be restored by #PopMklThreads().
+    int PushMklThreads() {
+        if (m_mkl_threads <= 0)
+            return 0;
+        return mkl_set_num_threads_local(m_mkl_threads);
+    }
+
+    /// Restore the thread-local MKL thread count saved by #PushMklThreads().
+    void PopMklThreads(int prev) {
+        if (m_mkl_threads <= 0)
+            return;
+        mkl_set_num_threads_local(prev);
+    }
+
+    /// A cached Pardiso analysis result for one sparsity pattern.
+    struct PatternCacheEntry {
+        uint64_t fingerprint;                 ///< fingerprint of the sparsity pattern
+        std::unique_ptr<ChMklEngine> engine;  ///< engine holding the analysis data for this pattern
+        int last_use;                         ///< value of m_setup_call at the last hit (for LRU eviction)
+    };
+
+    /// Compute a fingerprint of the matrix sparsity pattern (FNV-1a hash of the CSR index arrays).
+    static uint64_t PatternFingerprint(const ChSparseMatrix& mat) {
+        uint64_t h = 14695981039346656037ULL;
+        auto hash_int = [&h](int v) {
+            for (int b = 0; b < 4; b++) {
+                h ^= static_cast<uint64_t>((v >> (8 * b)) & 0xFF);
+                h *= 1099511628211ULL;
+            }
+        };
+        int n = mat.GetNumRows();
+        hash_int(n);
+        const int* ia = mat.GetCS_LeadingIndexArray();
+        const int* ja = mat.GetCS_TrailingIndexArray();
+        for (int i = 0; i <= n; i++)
+            hash_int(ia[i]);
+        for (int k = 0; k < ia[n]; k++)
+            hash_int(ja[k]);
+        return h;
+    }
+
+    /// Look up \a fingerprint in the pattern cache and make the matching engine active.
+    /// On a miss, allocate a fresh engine for this pattern (evicting the least recently
+    /// used entry if the cache is full). Return true if the analysis data was cached.
+    bool FindCachedPattern(uint64_t fingerprint) {
+        for (auto& entry : m_pattern_cache) {
+            if (entry.fingerprint == fingerprint) {
+                entry.last_use = m_setup_call;
+                m_engine_active = entry.engine.get();
+                return true;
+            }
+        }
+
+        if ((int)m_pattern_cache.size() >= m_pattern_cache_size) {
+            size_t lru = 0;
+            for (size_t i = 1; i < m_pattern_cache.size(); i++) {
+                if (m_pattern_cache[i].last_use < m_pattern_cache[lru].last_use)
+                    lru = i;
+            }
+            m_pattern_cache.erase(m_pattern_cache.begin() + lru);
+        }
+
+        PatternCacheEntry entry;
+        entry.fingerprint = fingerprint;
+        entry.engine.reset(new ChMklEngine(0, ChSparseMatrix::GENERAL));
+        // Inherit the solver settings currently active on the main engine.
+        std::memcpy(entry.engine->GetIparmAddress(), m_engine.GetIparmAddress(), 64 * sizeof(MKL_INT));
+        entry.last_use = m_setup_call;
+        m_engine_active = entry.engine.get();
+        m_pattern_cache.push_back(std::move(entry));
+        return false;
+    }
+
     ChMklEngine m_engine = {0, ChSparseMatrix::GENERAL};  ///< interface to MKL solver
     Matrix m_mat = {1, 1};                                ///< problem matrix
     ChMatrixDynamic<double> m_rhs;                        ///< right-hand side vector
@@ -274,6 +422,16 @@ class ChSolverMKL : public ChSolver {
     int m_solve_call = 0;  ///< counter for calls to Solve
     int m_setup_call = 0;  ///< counter for calls to Setup
 
+    unsigned int m_structure_revision = 0;  ///< system topology revision seen at the last Setup call
+
+    std::vector<PatternCacheEntry> m_pattern_cache;  ///< cached Pardiso analysis results, one per pattern
+    int m_pattern_cache_size = 0;                    ///< maximum number of cached patterns (0: cache disabled)
+    ChMklEngine* m_engine_active = &m_engine;        ///< engine used by the current Setup/Solve pair
+
+    int m_mkl_threads = 0;        ///< MKL thread count for the Pardiso calls (0: MKL default)
+    bool m_dedicated_pool = false;  ///< reserve the MKL threads out of the OpenMP pool?
+    int m_omp_threads_saved = 0;  ///< OpenMP thread count to restore when the dedicated pool is disabled
+
     bool m_lock = false;                           ///< is the matrix sparsity pattern locked?
     bool m_force_sparsity_pattern_update = false;  ///< is the sparsity pattern changed compared to last call?
     bool m_use_perm = false;                       ///< enable use of the permutation vector?
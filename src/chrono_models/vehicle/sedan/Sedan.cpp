@@ -183,10 +183,7 @@ void Sedan::Synchronize(double time,
 
     double driveshaft_speed = m_vehicle->GetDriveshaftSpeed();
 
-    m_tires[0]->Synchronize(time, wheel_states[0], terrain);
-    m_tires[1]->Synchronize(time, wheel_states[1], terrain);
-    m_tires[2]->Synchronize(time, wheel_states[2], terrain);
-    m_tires[3]->Synchronize(time, wheel_states[3], terrain);
+    SynchronizeTires(time, 4, m_tires.data(), wheel_states, terrain);
 
     m_powertrain->Synchronize(time, throttle_input, driveshaft_speed);
 
@@ -195,10 +192,7 @@ void Sedan::Synchronize(double time,
 
 // -----------------------------------------------------------------------------
 void Sedan::Advance(double step) {
-    m_tires[0]->Advance(step);
-    m_tires[1]->Advance(step);
-    m_tires[2]->Advance(step);
-    m_tires[3]->Advance(step);
+    AdvanceTires(step, 4, m_tires.data());
 
     m_powertrain->Advance(step);
 
@@ -188,10 +188,7 @@ void UAZBUS::Synchronize(double time,
         driveshaft_speed = m_vehicle->GetDriveshaftSpeed();
     }
 
-    m_tires[0]->Synchronize(time, wheel_states[0], terrain);
-    m_tires[1]->Synchronize(time, wheel_states[1], terrain);
-    m_tires[2]->Synchronize(time, wheel_states[2], terrain);
-    m_tires[3]->Synchronize(time, wheel_states[3], terrain);
+    SynchronizeTires(time, 4, m_tires.data(), wheel_states, terrain);
 
     m_powertrain->Synchronize(time, throttle_input, driveshaft_speed);
 
@@ -200,10 +197,7 @@ void UAZBUS::Synchronize(double time,
 
 // -----------------------------------------------------------------------------
 void UAZBUS::Advance(double step) {
-    m_tires[0]->Advance(step);
-    m_tires[1]->Advance(step);
-    m_tires[2]->Advance(step);
-    m_tires[3]->Advance(step);
+    AdvanceTires(step, 4, m_tires.data());
 
     m_powertrain->Advance(step);
 
@@ -19,16 +19,24 @@ namespace chrono {
 bool ChSolverMumps::Setup(ChSystemDescriptor& sysd) {
     m_timer_setup_assembly.start();
 
-    // Calculate problem size at first call.
-    if (m_setup_call == 0) {
+    // Calculate problem size at first call and whenever the system topology changed.
+    // A topology change invalidates a locked sparsity pattern, so in that case schedule
+    // a pattern update before the matrix is assembled again.
+    if (m_setup_call == 0 || sysd.GetStructureRevision() != m_structure_revision) {
+        if (m_setup_call > 0 && m_lock)
+            m_force_sparsity_pattern_update = true;
+        m_structure_revision = sysd.GetStructureRevision();
         m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
+        m_analysis_valid = false;
     }
 
     // Let the matrix acquire the information about ChSystem
     if (m_force_sparsity_pattern_update) {
         m_force_sparsity_pattern_update = false;
+        m_analysis_valid = false;
 
         ChSparsityPatternLearner sparsity_learner(m_dim, m_dim, true);
+        sparsity_learner.SetType(m_mat.GetType());  // a symmetric matrix needs a one-triangle pattern
         sysd.ConvertToMatrixForm(&sparsity_learner, nullptr);
         m_mat.LoadSparsityPattern(sparsity_learner);
     } else {
@@ -54,11 +62,18 @@ bool ChSolverMumps::Setup(ChSystemDescriptor& sysd) {
 
     m_timer_setup_assembly.stop();
 
-    // Perform the factorization with the Pardiso sparse direct solver.
+    // Perform the factorization with the MUMPS direct solver.
+    // MUMPS keeps the symbolic factorization inside its handle, so when analysis reuse
+    // is enabled and the pattern did not change, only the numerical phase is submitted.
     m_timer_setup_solvercall.start();
-    auto mumps_message = m_engine.MumpsCall(ChMumpsEngine::mumps_JOB::ANALYZE_FACTORIZE);
+    auto job = (m_reuse_analysis && m_analysis_valid) ? ChMumpsEngine::mumps_JOB::FACTORIZE
+                                                      : ChMumpsEngine::mumps_JOB::ANALYZE_FACTORIZE;
+    auto mumps_message = m_engine.MumpsCall(job);
     m_timer_setup_solvercall.stop();
 
+    if (mumps_message == 0)
+        m_analysis_valid = true;
+
     m_setup_call++;
 
     if (verbose) {
@@ -110,11 +125,26 @@ double ChSolverMumps::Solve(ChSystemDescriptor& sysd)  ///< system description w
     return 0.0;
 }
 
+void ChSolverMumps::SetReuseAnalysis(bool val) {
+    m_reuse_analysis = val;
+    if (val)
+        SetSparsityPatternLock(true);
+    m_analysis_valid = false;
+}
+
 void ChSolverMumps::SetSparsityPatternLock(bool val) {
     m_lock = val;
     m_mat.SetSparsityPatternLock(m_lock);
 }
 
+void ChSolverMumps::SetSymmetricStorage(bool val) {
+    m_mat.SetType(val ? ChSparseMatrix::SYMMETRIC_INDEF : ChSparseMatrix::GENERAL);
+    // The structural change (one triangle vs. full matrix) invalidates any locked
+    // pattern and any symbolic factorization held by MUMPS.
+    m_force_sparsity_pattern_update = true;
+    m_analysis_valid = false;
+}
+
 void ChSolverMumps::SetNullPivotDetection(bool val, double threshold) {
     m_null_pivot_detection = val;
     m_engine.SetNullPivotDetection(val, threshold);
@@ -51,6 +51,23 @@ class ChApiMumps ChSolverMumps : public ChSolver {
 
     void SetNullPivotDetection(bool val, double threshold = 0);
 
+    /// Enable/disable symmetric storage of the problem matrix (default: false).
+    /// The assembled KKT matrix is symmetric indefinite; when enabled, only its upper
+    /// triangle is assembled (the constraint jacobian is stored once, as Cq', instead
+    /// of both Cq and Cq' copies) and MUMPS is switched to its symmetric mode, which
+    /// expects exactly one triangle on input. This halves assembly work and matrix
+    /// memory. Leave disabled when null-pivot detection on the unsymmetric path is
+    /// preferred, or when the engine is reused for unsymmetric matrices.
+    void SetSymmetricStorage(bool val);
+
+    /// Enable/disable reuse of the MUMPS analysis phase across calls (default: false).
+    /// When enabled, the symbolic factorization (JOB=1) is computed at the first Setup()
+    /// call only; subsequent calls run the numerical factorization alone (JOB=2), until a
+    /// topology change signalled by ChSystemDescriptor forces a new analysis.
+    /// Since the symbolic factorization is valid only as long as the sparsity pattern does
+    /// not change, enabling this option also locks the sparsity pattern (#SetSparsityPatternLock).
+    void SetReuseAnalysis(bool val);
+
     /// Get cumulative time for assembly operations in Solve phase.
     double GetTimeSolve_Assembly() const { return m_timer_solve_assembly(); }
     /// Get cumulative time for Pardiso calls in Solve phase.
@@ -85,11 +102,15 @@ class ChApiMumps ChSolverMumps : public ChSolver {
     int m_solve_call = 0;  ///< counter for calls to Solve
     int m_setup_call = 0;  ///< counter for calls to Setup
 
+    unsigned int m_structure_revision = 0;  ///< system topology revision seen at the last Setup call
+
     bool m_lock = false;                           ///< is the matrix sparsity pattern locked?
     bool m_force_sparsity_pattern_update = false;  ///< is the sparsity pattern changed compared to last call?
     bool m_use_perm = false;                       ///< enable use of the permutation vector?
     bool m_use_rhs_sparsity = false;               ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection = false;           ///< leverage right-hand side sparsity?
+    bool m_reuse_analysis = false;                 ///< reuse the symbolic factorization across calls?
+    bool m_analysis_valid = false;                 ///< does MUMPS hold an analysis for the current pattern?
 
     ChTimer<> m_timer_setup_assembly;    ///< timer for matrix assembly
     ChTimer<> m_timer_setup_solvercall;  ///< timer for factorization
@@ -23,7 +23,7 @@ using namespace glm;
 namespace chrono {
 namespace opengl {
 
-ChOpenGLMesh::ChOpenGLMesh() : ChOpenGLObject() {}
+ChOpenGLMesh::ChOpenGLMesh() : ChOpenGLObject(), size(0), capacity(0) {}
 
 bool ChOpenGLMesh::Initialize(std::vector<glm::vec3>& vertices,
                               std::vector<glm::vec3>& normals,
@@ -185,6 +185,8 @@ bool ChOpenGLMesh::PostInitialize() {
 void ChOpenGLMesh::TakeDown() {
     // Clean up the vertex arrtibute data
     this->data.clear();
+    size = 0;
+    capacity = 0;
 
     super::TakeDown();
 }
@@ -198,20 +200,27 @@ void ChOpenGLMesh::TakeDown() {
  bytes.
  */
 void ChOpenGLMesh::Update(std::vector<glm::mat4>& model) {
-    std::vector<glm::vec3> a(model.size()), d(model.size()), s(model.size());
-    for (int i = 0; i < model.size(); i++) {
-        a[i] = ambient;
-        d[i] = diffuse;
-    }
+    // The per-instance colors are constant for this mesh, so the color buffers
+    // only need a refill when more instances are drawn than ever before. The
+    // transform buffer is allocated once for the same capacity and updated in
+    // place each frame.
+    if ((int)model.size() > capacity) {
+        capacity = (int)model.size();
 
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_ambient_handle);
-    glBufferData(GL_ARRAY_BUFFER, a.size() * sizeof(vec3), &a[0], GL_DYNAMIC_DRAW);
+        std::vector<glm::vec3> a(capacity, ambient), d(capacity, diffuse);
 
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_diffuse_handle);
-    glBufferData(GL_ARRAY_BUFFER, d.size() * sizeof(vec3), &d[0], GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_ambient_handle);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(vec3), &a[0], GL_STATIC_DRAW);
+
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_diffuse_handle);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(vec3), &d[0], GL_STATIC_DRAW);
+    }
 
+    // Orphan the previous transform storage before filling it, so the driver
+    // does not stall on a buffer possibly still in use by the previous frame.
     glBindBuffer(GL_ARRAY_BUFFER, vertex_model_handle);
-    glBufferData(GL_ARRAY_BUFFER, model.size() * sizeof(mat4), &model[0], GL_DYNAMIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(mat4), NULL, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, model.size() * sizeof(mat4), &model[0]);
 
     size = (int)model.size();
 }
@@ -55,7 +55,8 @@ class CH_OPENGL_API ChOpenGLMesh : public ChOpenGLObject {
     glm::vec3 ambient;
     glm::vec3 specular;
     glm::vec3 diffuse;
-    int size;
+    int size;      ///< number of instances drawn in the current frame
+    int capacity;  ///< number of instances the GL buffers are sized for
 
     typedef ChOpenGLObject super;
 };
@@ -236,6 +236,10 @@ struct host_container {
     custom_vector<real3> aabb_min_tet;  ///< List of bounding boxes minimum point for tets
     custom_vector<real3> aabb_max_tet;  ///< List of bounding boxes maximum point for tets
 
+    /// Per-body collision envelope, derived from the body speed each step
+    /// (only filled when collision_settings::use_adaptive_envelope is enabled).
+    custom_vector<real> env_rigid;
+
     custom_vector<long long> contact_pairs;  ///< Contact pairs (encoded in a single long log)
 
     // Contact data
@@ -245,6 +249,7 @@ struct host_container {
     custom_vector<real> dpth_rigid_rigid;
     custom_vector<real> erad_rigid_rigid;
     custom_vector<vec2> bids_rigid_rigid;
+    custom_vector<char> sphere_rigid_rigid;  ///< Contact between two origin-centered spheres (closed-form jacobian)
 
     custom_vector<real3> norm_rigid_fluid;
     custom_vector<real3> cpta_rigid_fluid;
@@ -293,6 +298,9 @@ struct host_container {
     // Contact shear history (SMC)
     custom_vector<vec3> shear_neigh;  ///< Neighbor list of contacting bodies and shapes
     custom_vector<real3> shear_disp;  ///< Accumulated shear displacement for each neighbor
+    custom_vector<int> shear_hash;    ///< Open-addressing hash table over contact pair ids; entries hold
+                                      ///< the index of an occupied shear history slot, or -1 if empty
+    uint shear_hash_mask;             ///< Size of shear_hash minus one (the size is a power of two)
 
     /// Mapping from all bodies in the system to bodies involved in a contact.
     /// For bodies that are currently not in contact, the mapping entry is -1.
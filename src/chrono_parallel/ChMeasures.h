@@ -45,6 +45,8 @@ class collision_measures {
         number_of_contacts_possible = 0;
         number_of_bins_active = 0;
         number_of_bin_intersections = 0;
+        number_of_ghost_slots = 0;
+        number_of_deep_contacts = 0;
 
         rigid_min_bounding_point = real3(0);
         rigid_max_bounding_point = real3(0);
@@ -69,6 +71,10 @@ class collision_measures {
     uint number_of_bins_active;        ///< Number of active bins (containing 1+ AABBs)
     uint number_of_bin_intersections;  ///< Number of AABB bin intersections
     uint number_of_contacts_possible;  ///< Number of contacts possible from broadphase
+    uint number_of_ghost_slots;        ///< Contact slots from broadphase candidates that narrowphase left empty
+                                       ///< (persistently high: envelope/bounding boxes too fat)
+    uint number_of_deep_contacts;      ///< Contacts penetrating deeper than the pair envelope
+                                       ///< (nonzero: envelope too small for the impact speeds)
 
     real3 rigid_min_bounding_point;
     real3 rigid_max_bounding_point;
@@ -0,0 +1,264 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: allocator for the host data arrays (with selectable backing
+// store and NUMA-aware first-touch placement) and per-thread scratch arenas
+// for kernel temporaries.
+//
+// On multi-socket machines the OS backs each memory page on the NUMA node of
+// the thread that first writes to it. The default allocator lets the (serial)
+// resize of a host array fault all of its pages on one node, after which every
+// parallel kernel sweeping the array pays remote accesses for most of its
+// range. The first_touch_allocator faults the pages of a fresh allocation from
+// an OpenMP loop with the same static schedule as the consuming kernels, so
+// each page ends up local to the thread that will actually work on it.
+//
+// In CUDA-enabled builds the backing store of the host arrays can instead be
+// page-locked (pinned) or unified (managed) memory, so that the CUDA paths
+// (matrix.cu, ChMPM) transfer host data without staging through a pageable
+// buffer. All backings return 64-byte aligned memory, sufficient for any of
+// the vector kernels sweeping these arrays.
+//
+// =============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#include "chrono_parallel/ChConfigParallel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef CHRONO_PARALLEL_USE_CUDA
+#include <cuda_runtime_api.h>
+#endif
+
+namespace chrono {
+
+/// Backing store used by the host data arrays (custom_vector).
+enum class HostMemoryBacking {
+    FIRST_TOUCH,  ///< heap memory with NUMA first-touch page placement (default)
+    PINNED,       ///< CUDA page-locked memory: device transfers run at full bus speed, no staging copy
+    MANAGED       ///< CUDA unified memory, migrated on demand between host and device
+};
+
+/// Backing store applied to host data arrays allocated from now on (process
+/// wide). Select before constructing the system; each allocation remembers the
+/// backing it was made with, so arrays allocated under a previous setting are
+/// still released correctly. The CUDA backings silently fall back to
+/// FIRST_TOUCH in builds without CUDA support.
+inline HostMemoryBacking& host_memory_backing() {
+    static HostMemoryBacking backing = HostMemoryBacking::FIRST_TOUCH;
+    return backing;
+}
+
+/// Allocator for the host data arrays, with selectable backing store.
+/// Drop-in replacement for std::allocator. With the default FIRST_TOUCH
+/// backing, fresh allocations are touched page by page from a statically
+/// scheduled OpenMP loop, distributing the physical pages over the NUMA nodes
+/// in the same blocked fashion as the parallel kernels that later sweep the
+/// array (serial builds degenerate to a plain allocation with zero-touch of
+/// the pages). The PINNED and MANAGED backings hand the arrays to the CUDA
+/// runtime instead (see HostMemoryBacking). Every backing returns memory
+/// aligned to 64 bytes.
+template <typename T>
+class first_touch_allocator {
+  public:
+    typedef T value_type;
+
+    first_touch_allocator() {}
+    template <typename U>
+    first_touch_allocator(const first_touch_allocator<U>&) {}
+
+    T* allocate(std::size_t count) {
+        HostMemoryBacking backing = host_memory_backing();
+#ifndef CHRONO_PARALLEL_USE_CUDA
+        backing = HostMemoryBacking::FIRST_TOUCH;
+#endif
+        // Room for the bookkeeping header plus the worst-case alignment shift.
+        const std::size_t num_bytes = count * sizeof(T);
+        const std::size_t total = num_bytes + alignment + sizeof(alloc_header);
+
+        void* raw = 0;
+#ifdef CHRONO_PARALLEL_USE_CUDA
+        if (backing == HostMemoryBacking::PINNED) {
+            if (cudaHostAlloc(&raw, total, cudaHostAllocDefault) != cudaSuccess)
+                throw std::bad_alloc();
+        } else if (backing == HostMemoryBacking::MANAGED) {
+            if (cudaMallocManaged(&raw, total) != cudaSuccess)
+                throw std::bad_alloc();
+        }
+#endif
+        if (!raw)
+            raw = ::operator new(total);
+
+        // Align the payload and stash the raw pointer and the backing used in
+        // the header just below it, so deallocate() releases through the
+        // matching API even if the process-wide backing changed in between.
+        char* payload = reinterpret_cast<char*>(
+            (reinterpret_cast<std::uintptr_t>(raw) + sizeof(alloc_header) + alignment - 1) & ~std::uintptr_t(alignment - 1));
+        alloc_header* header = reinterpret_cast<alloc_header*>(payload) - 1;
+        header->raw = raw;
+        header->backing = backing;
+
+        // Pinned pages are resident by construction and managed pages migrate
+        // to their first accessor on demand; only plain heap memory needs the
+        // explicit first touch.
+        if (backing == HostMemoryBacking::FIRST_TOUCH) {
+            const std::ptrdiff_t num_pages = (std::ptrdiff_t)((num_bytes + page_size - 1) / page_size);
+#pragma omp parallel for schedule(static)
+            for (std::ptrdiff_t page = 0; page < num_pages; page++) {
+                payload[page * page_size] = 0;
+            }
+        }
+        return reinterpret_cast<T*>(payload);
+    }
+
+    void deallocate(T* ptr, std::size_t) {
+        if (!ptr)
+            return;
+        alloc_header* header = reinterpret_cast<alloc_header*>(ptr) - 1;
+#ifdef CHRONO_PARALLEL_USE_CUDA
+        if (header->backing == HostMemoryBacking::PINNED) {
+            cudaFreeHost(header->raw);
+            return;
+        }
+        if (header->backing == HostMemoryBacking::MANAGED) {
+            cudaFree(header->raw);
+            return;
+        }
+#endif
+        ::operator delete(header->raw);
+    }
+
+    template <typename U>
+    bool operator==(const first_touch_allocator<U>&) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const first_touch_allocator<U>&) const {
+        return false;
+    }
+
+  private:
+    /// Per-allocation bookkeeping, stored immediately below the payload.
+    struct alloc_header {
+        void* raw;                 ///< pointer actually obtained from the backing API
+        HostMemoryBacking backing; ///< backing the allocation was made with
+    };
+
+    static const std::size_t alignment = 64;
+    static const std::ptrdiff_t page_size = 4096;
+};
+
+/// Vector over the host-array allocator (see first_touch_allocator).
+template <typename T>
+using numa_vector = std::vector<T, first_touch_allocator<T>>;
+
+/// Reserve at least 'count' elements, growing the capacity geometrically by
+/// 1.5x. Plain reserve(n) with a slowly increasing n reallocates on almost
+/// every call (quadratic copying); routing such call sites through this helper
+/// amortizes them while wasting at most a third of the peak footprint.
+template <typename T>
+void reserve_geometric(numa_vector<T>& vec, std::size_t count) {
+    if (count <= vec.capacity())
+        return;
+    vec.reserve(std::max(count, vec.capacity() + vec.capacity() / 2));
+}
+
+/// Release the excess capacity of a host array (geometric growth and decayed
+/// peaks deliberately over-allocate; call this after a permanent drop in the
+/// problem size, e.g. after removing a batch of bodies).
+template <typename T>
+void shrink_capacity(numa_vector<T>& vec) {
+    if (vec.capacity() > vec.size())
+        numa_vector<T>(vec.begin(), vec.end()).swap(vec);
+}
+
+/// Pool of per-thread scratch arenas for kernel temporaries.
+/// Each OpenMP thread gets its own byte arena, carved out with Acquire() and
+/// rewound wholesale with Rewind(); the backing storage is kept across calls,
+/// so a kernel that needs per-thread workspace every step allocates it only
+/// once. The arenas are first-touched by their owning thread, hence local to
+/// its NUMA node, and padded apart so their bookkeeping does not false-share.
+class ChScratchArena {
+  public:
+    ChScratchArena() {
+#ifdef _OPENMP
+        arenas.resize(omp_get_max_threads());
+#else
+        arenas.resize(1);
+#endif
+    }
+
+    /// Get a pointer to 'count' elements of type T in the calling thread's
+    /// arena. Alignment is guaranteed for any scalar type. The pointer stays
+    /// valid until the next Rewind(); a growing arena does not move the blocks
+    /// already handed out during the current parallel region, as long as
+    /// Reserve() was called with a sufficient total beforehand.
+    template <typename T>
+    T* Acquire(std::size_t count) {
+#ifdef _OPENMP
+        Arena& arena = arenas[omp_get_thread_num()];
+#else
+        Arena& arena = arenas[0];
+#endif
+        std::size_t offset = (arena.used + alignment - 1) & ~(alignment - 1);
+        std::size_t num_bytes = count * sizeof(T);
+        if (offset + num_bytes > arena.buffer.size()) {
+            // growing invalidates earlier blocks of this thread: acceptable
+            // here since each kernel acquires its whole workspace up front
+            arena.buffer.resize(std::max(offset + num_bytes, arena.buffer.size() * 2));
+        }
+        arena.used = offset + num_bytes;
+        return reinterpret_cast<T*>(arena.buffer.data() + offset);
+    }
+
+    /// Pre-size the calling thread's arena so that subsequent Acquire() calls
+    /// up to 'num_bytes' total are guaranteed not to reallocate.
+    void Reserve(std::size_t num_bytes) {
+#ifdef _OPENMP
+        Arena& arena = arenas[omp_get_thread_num()];
+#else
+        Arena& arena = arenas[0];
+#endif
+        if (arena.buffer.size() < num_bytes)
+            arena.buffer.resize(num_bytes);
+    }
+
+    /// Rewind all arenas, invalidating every pointer handed out by Acquire().
+    /// The backing storage is kept for reuse.
+    void Rewind() {
+        for (auto& arena : arenas)
+            arena.used = 0;
+    }
+
+  private:
+    static const std::size_t alignment = 64;
+
+    struct Arena {
+        Arena() : used(0) {}
+        std::vector<char, first_touch_allocator<char>> buffer;  ///< thread-local storage
+        std::size_t used;                                       ///< bytes handed out so far
+        char padding[64];                                       ///< keep arenas on separate cache lines
+    };
+
+    std::vector<Arena> arenas;
+};
+
+}  // end namespace chrono
@@ -29,6 +29,7 @@
 
 #include "chrono_parallel/ChApiParallel.h"
 #include "chrono_parallel/ChConfigParallel.h"
+#include "chrono_parallel/ChNumaAllocator.h"
 
 typedef int shape_type;
 
@@ -37,7 +38,8 @@ typedef int shape_type;
 #define CH_PARALLEL_API
 #define custom_vector std::vector
 #else
-#define custom_vector std::vector
+// Host data arrays get NUMA-aware first-touch page placement (see ChNumaAllocator.h)
+#define custom_vector ::chrono::numa_vector
 #endif
 
 #if defined _MSC_VER
@@ -71,6 +73,7 @@ static std::ostream null_stream(&null_buffer);
     thrust::inclusive_scan(THRUST_PAR x.begin(), x.end(), x.begin()); \
     y = x.back();
 #define Thrust_Sort_By_Key(x, y) thrust::sort_by_key(THRUST_PAR x.begin(), x.end(), y.begin())
+#define Thrust_Stable_Sort_By_Key(x, y) thrust::stable_sort_by_key(THRUST_PAR x.begin(), x.end(), y.begin())
 
 #define Run_Length_Encode(y, z, w)                                                                                  \
     (thrust::reduce_by_key(THRUST_PAR y.begin(), y.end(), thrust::constant_iterator<uint>(1), z.begin(), w.begin()) \
@@ -113,7 +116,8 @@ enum class SolverType {
     GAUSS_SEIDEL,                ///< Gauss-Seidel
     PDIP,                        ///< Primal-Dual Interior Point
     BB,                          ///< Barzilai-Borwein
-    SPGQP                        ///< Spectral Projected Gradient (QP projection)
+    SPGQP,                       ///< Spectral Projected Gradient (QP projection)
+    APGDGPU                      ///< device resident APGD (requires a CUDA build)
 };
 
 /// Enumeration for solver mode.
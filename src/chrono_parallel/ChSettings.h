@@ -55,6 +55,23 @@ class collision_settings {
         narrowphase_algorithm = NarrowPhaseType::NARROWPHASE_HYBRID_MPR;
         grid_density = 5;
         fixed_bins = true;
+        broadphase_single_pass = true;
+        use_manifold_cache = false;
+        manifold_cache_position_tol = 1e-6;
+        manifold_cache_rotation_tol = 1e-8;
+        use_two_level_grid = false;
+        grid_level_factor = 4;
+        use_aabb_refit = false;
+        aabb_refit_margin = 0.01;
+        use_shape_dictionary = false;
+        perform_bin_tuning = false;
+        adaptive_bins = false;
+        bin_recalibration_factor = 2;
+        max_contacts_per_pair = 0;
+        device_pipeline = false;
+        use_adaptive_envelope = false;
+        adaptive_envelope_min = 0;
+        adaptive_envelope_factor = 1.0;
     }
 
     real3 min_bounding_point, max_bounding_point;
@@ -64,6 +81,21 @@ class collision_settings {
     /// contact constraints before objects acutally come into contact. In general
     /// this helps with stability.
     real collision_envelope;
+    /// Scale the envelope of each body with its speed instead of applying the
+    /// worst-case value everywhere. When enabled, each rigid body uses an
+    /// envelope of Clamp(speed * step_size * adaptive_envelope_factor,
+    /// adaptive_envelope_min, collision_envelope), and a shape pair is detected
+    /// within the sum of the two body envelopes, so a single fast body no
+    /// longer inflates the bounding boxes (and hence the broadphase cost) of
+    /// the entire scene. collision_envelope remains the worst-case cap. The
+    /// ghost-slot and deep-contact counters in the collision measures give
+    /// feedback on whether the bounds are adequate.
+    bool use_adaptive_envelope;
+    /// Lower bound of the adaptive per-body envelope (envelope of a body at rest).
+    real adaptive_envelope_min;
+    /// Safety factor applied to the per-step travel (speed * step_size) of a
+    /// body when deriving its adaptive envelope.
+    real adaptive_envelope_factor;
     /// Chrono parallel has an optional feature that allows the user to set a
     /// bounding box that automatically freezes (makes inactive) any object that
     /// exits the bounding box.
@@ -85,6 +117,82 @@ class collision_settings {
     real grid_density;
     /// Use fixed number of bins instead of tuning them.
     bool fixed_bins;
+    /// Generate the candidate pair list in a single pass over the grid bins, using
+    /// per-thread pair buffers, instead of the count-then-fill scheme which performs
+    /// every AABB-AABB overlap test twice. Produces the same pair list; disable only
+    /// to fall back to the original two-pass scheme.
+    bool broadphase_single_pass;
+    /// Cache the narrowphase result of each shape pair across steps and reuse it,
+    /// instead of re-running MPR, for pairs whose shapes moved less than the
+    /// tolerances below since the cached evaluation (MPR narrowphase only).
+    /// Useful for dense quasi-static packings where most pairs barely move;
+    /// disabled by default since reused contacts lag behind the true geometry
+    /// by up to the tolerance.
+    bool use_manifold_cache;
+    /// Squared-distance threshold on shape translation for manifold cache reuse.
+    real manifold_cache_position_tol;
+    /// Threshold on 1-|dot| of the shape rotation quaternions for manifold cache reuse.
+    real manifold_cache_rotation_tol;
+    /// Use a two-level hierarchical grid for the broadphase. Shapes whose AABB is
+    /// larger than grid_level_factor times the mean AABB extent register at a coarser
+    /// grid whose resolution is driven by their count, while the remaining shapes use
+    /// the regular grid; pairs between the two levels are generated on the fine grid.
+    /// Useful for polydisperse mixtures, where sizing a single grid for the largest
+    /// shapes makes the pair count explode.
+    bool use_two_level_grid;
+    /// Ratio of shape AABB extent to mean AABB extent above which a shape registers
+    /// at the coarse grid level (only used if use_two_level_grid is true).
+    real grid_level_factor;
+    /// Recompute shape AABBs incrementally: boxes are inflated ("fattened") by
+    /// aabb_refit_margin and a body's shapes keep their cached boxes until the
+    /// body has translated/rotated enough to possibly escape the margin. In a
+    /// settled bed this skips the AABB pass for most shapes at the cost of
+    /// slightly larger boxes (and hence some extra broadphase pairs).
+    bool use_aabb_refit;
+    /// Fat AABB margin used when use_aabb_refit is true. Larger margins let
+    /// slow bodies keep their boxes for more steps but generate more pairs.
+    real aabb_refit_margin;
+    /// Deduplicate the geometry records in shape_data: shapes with an identical
+    /// payload (e.g. the millions of equal-radius spheres of a granular problem)
+    /// share a single entry in the per-type geometry arrays and differ only in
+    /// their index and transform. Cuts the geometry storage from one record per
+    /// shape to one per unique shape and keeps the AABB/narrowphase lookups on a
+    /// handful of hot cache lines. Set this before adding bodies to the system.
+    bool use_shape_dictionary;
+    /// Tune bins_per_axis online from the measured collision time, in the same
+    /// trial-and-revert fashion as the thread count tuning. Only meaningful with
+    /// fixed_bins enabled. Disabled by default.
+    bool perform_bin_tuning;
+    /// Recalibrate bins_per_axis when the measured grid occupancy (AABBs per
+    /// active bin) drifts by more than bin_recalibration_factor from the value
+    /// the grid was last calibrated for, re-deriving the resolution from the
+    /// current shape count and domain extents. Useful for simulations whose
+    /// density changes by orders of magnitude over a run (e.g. hopper
+    /// discharge). Only meaningful with fixed_bins enabled; do not combine with
+    /// perform_bin_tuning, which also modifies bins_per_axis. Disabled by
+    /// default.
+    bool adaptive_bins;
+    /// Hysteresis band for adaptive_bins: the grid is kept as long as the
+    /// occupancy stays within this factor (in either direction) of the
+    /// occupancy at the last calibration.
+    real bin_recalibration_factor;
+    /// Cap on the number of contacts kept per body pair (0 = keep all, the
+    /// default). Body pairs exceeding the cap have their contacts clustered by
+    /// normal and position and replaced with depth-weighted representative
+    /// contacts, approximately preserving the net wrench of the patch while
+    /// cutting the constraint count seen by the solver. Intended for dense
+    /// near-coplanar patches (e.g. tire on granular terrain).
+    uint max_contacts_per_pair;
+    /// Run the whole collision step (AABB generation, broadphase, narrowphase)
+    /// on the GPU, keeping every intermediate result in device memory; per step
+    /// only the body states go in and the final contact list comes out.
+    /// Requires a CUDA build and is used only for scenes whose rigid shapes
+    /// are all spheres with none of the broadphase/narrowphase extensions
+    /// enabled (the host pipeline is used otherwise, see
+    /// ChCollisionSystemParallel::RunDeviceResident()). Combine with
+    /// SolverType::APGDGPU to also keep the contact solve on the device.
+    /// Disabled by default.
+    bool device_pipeline;
 };
 
 /// Chrono::Parallel solver_settings.
@@ -120,12 +228,23 @@ class solver_settings {
         use_material_properties = true;
         characteristic_vel = 1;
         min_slip_vel = 1e-4;
+        smc_substeps = 1;
         cache_step_length = false;
         precondition = false;
         use_power_iteration = false;
         max_power_iteration = 15;
         power_iter_tolerance = 0.1;
         skip_residual = 1;
+        bilateral_jacobian_cache_threshold = 0;
+        use_contact_warm_start = false;
+        warm_start_displacement_threshold = 0.01;
+        perform_solver_tuning = false;
+        tuning_min_iterations = 10;
+        tuning_max_iterations = 1000;
+        tuning_min_tolerance = 1e-6;
+        tuning_max_tolerance = 1;
+        use_mixed_precision = false;
+        mixed_precision_refine = 50;
     }
 
     /// The solver type variable defines name of the solver that will be used to
@@ -168,6 +287,15 @@ class solver_settings {
     bool use_power_iteration;
     int max_power_iteration;
     real power_iter_tolerance;
+    /// Run the inner solver iterations and Shur products in single precision,
+    /// with the convergence of the solve measured on a double precision residual.
+    /// This gives most of the bandwidth benefit of a single precision build
+    /// without the contact penetration drift of pure single precision.
+    /// Has no effect in builds where real is already a float.
+    bool use_mixed_precision;
+    /// Number of single precision iterations between the double precision
+    /// residual corrections when mixed precision is enabled.
+    uint mixed_precision_refine;
 
     /// Contact force model for SMC.
     ChSystemSMC::ContactForceModel contact_force_model;
@@ -186,6 +314,14 @@ class solver_settings {
     real characteristic_vel;
     /// Threshold tangential velocity.
     real min_slip_vel;
+    /// Number of internal force sub-steps per macro step for the SMC solver.
+    /// With a value K > 1, collision detection runs once per macro step, the contact
+    /// set is frozen, and the contact forces are evaluated K times at step_size/K with
+    /// the contact gaps extrapolated from the relative normal velocities and the body
+    /// velocities updated in between; the rigid states still advance at the macro
+    /// rate. This decouples the detection rate from the rate needed to resolve stiff
+    /// contacts. The default of 1 reproduces the single-evaluation behavior.
+    int smc_substeps;
 
     /// Along with setting the solver mode, the total number of iterations for each
     /// type of constraints can be performed.
@@ -210,8 +346,49 @@ class solver_settings {
     /// This variable defines the tolerance if the solver is using the objective.
     /// termination condition
     real tolerance_objective;
-    /// Compute residual every x iterations.
+    /// Upper bound on the residual checking interval of the iterative solvers.
+    /// With the default of 1 the full residual is computed every iteration.
+    /// Larger values let APGD/BB adapt the interval: while the solver is far
+    /// from the tolerance the full residual (an extra Shur product and cone
+    /// projection) is computed every K-th iteration with K doubling up to this
+    /// bound, and between full checks a cheap max-delta probe on the iterate
+    /// triggers an early check when the step stagnates. Termination can be
+    /// delayed by at most K-1 iterations; the converged solution is unchanged.
     int skip_residual;
+    /// Pose change (position norm plus quaternion component change) below which
+    /// the Jacobian values of a body-body bilateral constraint are considered
+    /// unchanged and re-used from the previous step instead of being re-read
+    /// from the scattered constraint objects. The default of 0 disables the
+    /// cache. Useful for systems with many stable joints (e.g. a vehicle on
+    /// granular terrain) where the bilateral topology is fixed across steps.
+    real bilateral_jacobian_cache_threshold;
+    /// Warm start the rigid contact multipliers across steps. Contacts of the
+    /// new step are matched to those of the previous step by shape pair id and
+    /// start from the converged multipliers of that step (normal, sliding and
+    /// spinning lanes, as available in the current solver mode) instead of
+    /// zero. Matched contacts whose contact point moved more than
+    /// warm_start_displacement_threshold are still started from zero. In
+    /// settled beds, where most contacts persist step to step, this cuts the
+    /// iterations needed to reach tolerance. Disabled by default.
+    bool use_contact_warm_start;
+    /// Displacement of the contact point (on the first body) above which a
+    /// matched contact is considered too stale to warm start.
+    real warm_start_displacement_threshold;
+    /// Adapt the iteration caps and the tolerance online to the difficulty of the
+    /// current phase of the simulation, within the tuning bounds below. The system
+    /// monitors the per-step iteration counts and the residual decay and scales the
+    /// settings up when the solver persistently exhausts its cap while still making
+    /// progress, relaxes the tolerance when it stagnates, and scales both back when
+    /// convergence is consistently cheap. Disabled by default.
+    bool perform_solver_tuning;
+    /// Lower bound on the adapted iteration caps.
+    uint tuning_min_iterations;
+    /// Upper bound on the adapted iteration caps.
+    uint tuning_max_iterations;
+    /// Lower bound on the adapted tolerance.
+    real tuning_min_tolerance;
+    /// Upper bound on the adapted tolerance.
+    real tuning_max_tolerance;
 };
 
 /// Aggregate of all settings for Chrono::Parallel.
@@ -234,6 +411,7 @@ class settings_container {
         perform_thread_tuning = ((min_threads == max_threads) ? false : true);
         system_type = SystemType::SYSTEM_NSC;
         step_size = .01;
+        deterministic = false;
     }
 
     /// The settings for the collision detection.
@@ -260,6 +438,15 @@ class settings_container {
     /// The system type defines if the system is solving the NSC frictional contact
     /// problem or a SMC penalty based.
     SystemType system_type;
+    /// Make multithreaded runs bitwise reproducible, at a small fixed cost. The
+    /// sorts that order shapes into broadphase bins, contacts into the contact
+    /// list and per-contact forces into the SMC reduction are unstable by
+    /// default, so ties are broken in thread-dependent order and floating point
+    /// sums accumulate in different orders between runs. With this flag those
+    /// sorts become stable, which pins the contact ordering (and hence every
+    /// downstream reduction) to the deterministic broadphase order regardless
+    /// of the number of threads.
+    bool deterministic;
 };
 
 /// @} parallel_module
@@ -120,12 +120,76 @@ void ChCAABBGenerator::GenerateAABB() {
         const custom_vector<real3>& pos_rigid = data_manager->host_data.pos_rigid;
         const custom_vector<quaternion>& body_rot = data_manager->host_data.rot_rigid;
         const uint num_rigid_shapes = data_manager->num_rigid_shapes;
+        const uint num_rigid_bodies = data_manager->num_rigid_bodies;
         custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
         custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
 
+        const bool refit = data_manager->settings.collision.use_aabb_refit;
+        const real margin = data_manager->settings.collision.aabb_refit_margin;
+
+        // Per-body speed-scaled envelopes: a body at rest keeps the tight lower
+        // bound, a fast body gets an envelope covering its per-step travel, and
+        // the configured global envelope remains the worst-case cap. Falls back
+        // to the global envelope until the velocity vector is available.
+        const bool adaptive_envelope = data_manager->settings.collision.use_adaptive_envelope;
+        custom_vector<real>& env_rigid = data_manager->host_data.env_rigid;
+        if (adaptive_envelope) {
+            const real step = data_manager->settings.step_size;
+            const real env_factor = data_manager->settings.collision.adaptive_envelope_factor;
+            const real env_min = data_manager->settings.collision.adaptive_envelope_min;
+            const DynamicVector<real>& vel = data_manager->host_data.v;
+            const bool has_vel = vel.size() >= (size_t)num_rigid_bodies * 6;
+            env_rigid.resize(num_rigid_bodies);
+#pragma omp parallel for
+            for (int i = 0; i < (signed)num_rigid_bodies; i++) {
+                if (!has_vel) {
+                    env_rigid[i] = collision_envelope;
+                    continue;
+                }
+                real speed = Sqrt(vel[i * 6 + 0] * vel[i * 6 + 0] + vel[i * 6 + 1] * vel[i * 6 + 1] +
+                                  vel[i * 6 + 2] * vel[i * 6 + 2]);
+                env_rigid[i] = Clamp(speed * step * env_factor, env_min, collision_envelope);
+            }
+        }
+        // In refit mode shapes keep their cached (fattened) boxes until their
+        // body may have escaped the margin; a topology change, or enabling the
+        // mode mid-run, rebuilds everything.
+        const bool rebuild_all =
+            !refit || aabb_min.size() != num_rigid_shapes || ref_pos_rigid.size() != num_rigid_bodies;
+
         aabb_min.resize(num_rigid_shapes);
         aabb_max.resize(num_rigid_shapes);
 
+        if (refit) {
+            body_dirty.resize(num_rigid_bodies);
+            if (rebuild_all) {
+                ref_pos_rigid.resize(num_rigid_bodies);
+                ref_rot_rigid.resize(num_rigid_bodies);
+                ref_radius_rigid.resize(num_rigid_bodies);
+                ref_env_rigid.resize(num_rigid_bodies);
+#pragma omp parallel for
+                for (int i = 0; i < (signed)num_rigid_bodies; i++) {
+                    body_dirty[i] = 1;
+                }
+            } else {
+#pragma omp parallel for
+                for (int i = 0; i < (signed)num_rigid_bodies; i++) {
+                    real3 dp = pos_rigid[i] - ref_pos_rigid[i];
+                    // 2*sin(theta/2)*r bounds the displacement any point within
+                    // radius r of the body center picks up from a rotation by
+                    // theta; together with the translation this bounds how far
+                    // the body's shapes moved since their boxes were built.
+                    real cos_half = Min(Abs(Dot(body_rot[i], ref_rot_rigid[i])), (real)1.0);
+                    real sin_half = Sqrt(1.0 - cos_half * cos_half);
+                    real motion = Length(dp) + 2.0 * sin_half * ref_radius_rigid[i];
+                    // A cached box also becomes stale when the adaptive envelope
+                    // of its body grew past the value it was built with.
+                    bool env_grew = adaptive_envelope && env_rigid[i] > ref_env_rigid[i];
+                    body_dirty[i] = (motion >= margin || env_grew) ? 1 : 0;
+                }
+            }
+        }
+
 #pragma omp parallel for
         for (int index = 0; index < (signed)num_rigid_shapes; index++) {
             // Shape data
@@ -139,35 +203,40 @@ void ChCAABBGenerator::GenerateAABB() {
             if (id == UINT_MAX)
                 continue;
 
+            // The cached fat box is still valid for this body.
+            if (refit && body_dirty[id] == 0)
+                continue;
+
             real3 position = pos_rigid[id];
             quaternion rotation = Mult(body_rot[id], local_rot);
+            const real envelope = adaptive_envelope ? env_rigid[id] : collision_envelope;
             real3 temp_min;
             real3 temp_max;
 
             if (type == SPHERE) {
                 real radius = data_manager->shape_data.sphere_rigid[start];
-                ComputeAABBSphere(radius + collision_envelope, local_pos, position, body_rot[id], temp_min, temp_max);
+                ComputeAABBSphere(radius + envelope, local_pos, position, body_rot[id], temp_min, temp_max);
 
             } else if (type == ELLIPSOID || type == BOX || type == CYLINDER || type == CONE) {
                 real3 B = data_manager->shape_data.box_like_rigid[start];
-                ComputeAABBBox(B + collision_envelope, local_pos, position, rotation, body_rot[id], temp_min, temp_max);
+                ComputeAABBBox(B + envelope, local_pos, position, rotation, body_rot[id], temp_min, temp_max);
 
             } else if (type == ROUNDEDBOX || type == ROUNDEDCYL || type == ROUNDEDCONE) {
                 real4 T = data_manager->shape_data.rbox_like_rigid[start];
-                real3 B = real3(T.x, T.y, T.z) + T.w + collision_envelope;
+                real3 B = real3(T.x, T.y, T.z) + T.w + envelope;
                 ComputeAABBBox(B, local_pos, position, rotation, body_rot[id], temp_min, temp_max);
 
             } else if (type == CAPSULE) {
                 real2 T = data_manager->shape_data.capsule_rigid[start];
-                real3 B_ = real3(T.x, T.x + T.y, T.x) + collision_envelope;
+                real3 B_ = real3(T.x, T.x + T.y, T.x) + envelope;
                 ComputeAABBBox(B_, local_pos, position, rotation, body_rot[id], temp_min, temp_max);
 
             } else if (type == CONVEX) {
                 int length = data_manager->shape_data.length_rigid[index];
                 ComputeAABBConvex(convex_rigid.data(), start, length, local_pos, position, rotation, temp_min,
                                   temp_max);
-                temp_min -= collision_envelope;
-                temp_max += collision_envelope;
+                temp_min -= envelope;
+                temp_max += envelope;
 
             } else if (type == TRIANGLEMESH) {
                 real3 A, B, C;
@@ -186,9 +255,36 @@ void ChCAABBGenerator::GenerateAABB() {
                 continue;
             }
 
+            if (refit) {
+                temp_min = temp_min - margin;
+                temp_max = temp_max + margin;
+            }
+
             aabb_min[index] = temp_min;
             aabb_max[index] = temp_max;
         }
+
+        if (refit) {
+            // Rebuilt bodies get a new reference pose and a radius covering all
+            // of their shapes, used in the rotation part of the motion bound.
+            // The shape scan is serial but only touches rebuilt bodies.
+            for (int i = 0; i < (signed)num_rigid_bodies; i++) {
+                if (body_dirty[i]) {
+                    ref_pos_rigid[i] = pos_rigid[i];
+                    ref_rot_rigid[i] = body_rot[i];
+                    ref_radius_rigid[i] = 0;
+                    ref_env_rigid[i] = adaptive_envelope ? env_rigid[i] : collision_envelope;
+                }
+            }
+            for (int index = 0; index < (signed)num_rigid_shapes; index++) {
+                uint id = id_rigid[index];
+                if (id == UINT_MAX || body_dirty[id] == 0)
+                    continue;
+                real3 furthest =
+                    Max(Abs(aabb_min[index] - pos_rigid[id]), Abs(aabb_max[index] - pos_rigid[id]));
+                ref_radius_rigid[id] = Max(ref_radius_rigid[id], Length(furthest));
+            }
+        }
     }
     // Deal with tetrahedral elements
     const uint num_tets = (uint)data_manager->host_data.boundary_element_fea.size();
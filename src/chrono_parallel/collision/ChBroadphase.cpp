@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <vector>
 
 #include <chrono_parallel/collision/ChCollision.h>
 #include "chrono_parallel/collision/ChBroadphaseUtils.h"
@@ -27,6 +28,7 @@
 #include <thrust/iterator/constant_iterator.h>
 
 #if defined(CHRONO_OPENMP_ENABLED)
+#include <omp.h>
 #include <thrust/system/omp/execution_policy.h>
 #elif defined(CHRONO_TBB_ENABLED)
 #include <thrust/system/tbb/execution_policy.h>
@@ -221,6 +223,8 @@ void ChCBroadphase::ComputeTopLevelResolution() {
     // Compute the number of slices in this grid level
     if (data_manager->settings.collision.fixed_bins == false) {
         bins_per_axis = function_Compute_Grid_Resolution(num_shapes, diagonal, density);
+    } else if (data_manager->settings.collision.adaptive_bins) {
+        RecalibrateResolution(num_shapes, diagonal);
     }
     bin_size = diagonal / real3(bins_per_axis.x, bins_per_axis.y, bins_per_axis.z);
     LOG(TRACE) << "ChCBroadphase::ComputeTopLevelResolution() bins_per_axis: [" << bins_per_axis.x << ", "
@@ -231,16 +235,102 @@ void ChCBroadphase::ComputeTopLevelResolution() {
     inv_bin_size = 1.0 / bin_size;
 }
 
+// Recalibrate the grid resolution from the occupancy measured on the previous
+// dispatch (see adaptive_bins in ChSettings.h). Right after a (re)calibration
+// the measured occupancy is recorded as the baseline; on subsequent steps the
+// grid is left untouched while the occupancy stays within
+// bin_recalibration_factor of that baseline in either direction (hysteresis,
+// so a grid is never resized on small fluctuations), and is otherwise
+// re-derived from the current shape count and domain extents with the density
+// heuristic, exactly as if fixed_bins were disabled for that one step.
+void ChCBroadphase::RecalibrateResolution(int num_shapes, const real3& diagonal) {
+    const uint bins_active = data_manager->measures.collision.number_of_bins_active;
+    if (bins_active == 0)
+        return;
+    const real occupancy = (real)data_manager->measures.collision.number_of_bin_intersections / bins_active;
+
+    if (calibrated_occupancy <= 0) {
+        // First dispatch after a (re)calibration: record the baseline.
+        calibrated_occupancy = occupancy;
+        return;
+    }
+
+    const real factor = data_manager->settings.collision.bin_recalibration_factor;
+    if (occupancy < calibrated_occupancy * factor && occupancy * factor > calibrated_occupancy)
+        return;
+
+    vec3& bins_per_axis = data_manager->settings.collision.bins_per_axis;
+    vec3 bins_new =
+        function_Compute_Grid_Resolution(num_shapes, diagonal, data_manager->settings.collision.grid_density);
+    if (bins_new.x != bins_per_axis.x || bins_new.y != bins_per_axis.y || bins_new.z != bins_per_axis.z) {
+        LOG(TRACE) << "ChCBroadphase::RecalibrateResolution() occupancy " << occupancy << " (calibrated for "
+                   << calibrated_occupancy << "), bins_per_axis: [" << bins_new.x << ", " << bins_new.y << ", "
+                   << bins_new.z << "]";
+        bins_per_axis = bins_new;
+    }
+    // Re-baseline on the next dispatch, measured with the new grid.
+    calibrated_occupancy = 0;
+}
+
 // =========================================================================================================
 ChCBroadphase::ChCBroadphase() {
     data_manager = 0;
+    calibrated_occupancy = 0;
+}
+
+// Map the family data of each shape to a compact signature id and precompute the
+// pairwise compatibility of the distinct signatures as a bitmap. Models use a
+// handful of distinct family masks at most, so the per-pair family test in the
+// candidate loops becomes one bit probe, and a bin whose occupants are mutually
+// incompatible (e.g. the static shapes of a mixer, masked against themselves) is
+// skipped in O(bin size) instead of paying the full pair sweep. Rebuilt every
+// dispatch: one O(num_shapes) pass with a small lookup table.
+void ChCBroadphase::BuildFamilySignatures() {
+    const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
+    const int num_shapes = data_manager->num_rigid_shapes;
+
+    fam_signature.resize(num_shapes);
+    std::unordered_map<int, char> signature_of;
+    std::vector<short2> fam_of_signature;
+
+    for (int i = 0; i < num_shapes; i++) {
+        short2 fam = fam_data[i];
+        int key = ((int)(unsigned short)fam.x << 16) | (int)(unsigned short)fam.y;
+        auto it = signature_of.find(key);
+        if (it != signature_of.end()) {
+            fam_signature[i] = it->second;
+            continue;
+        }
+        // The bitmap holds 64 distinct signatures; anything beyond that keeps
+        // the per-pair fallback test (never seen in practice, families are 15).
+        char sig = fam_signature_overflow;
+        if (fam_of_signature.size() < 64) {
+            sig = (char)fam_of_signature.size();
+            fam_of_signature.push_back(fam);
+        }
+        signature_of[key] = sig;
+        fam_signature[i] = sig;
+    }
+
+    fam_compat.assign(fam_of_signature.size(), 0);
+    for (size_t a = 0; a < fam_of_signature.size(); a++) {
+        for (size_t b = 0; b < fam_of_signature.size(); b++) {
+            if (collide(fam_of_signature[a], fam_of_signature[b]))
+                fam_compat[a] |= (uint64_t)1 << b;
+        }
+    }
 }
 // =========================================================================================================
 // use spatial subdivision to detect the list of POSSIBLE collisions
 // let user define their own narrow-phase collision detection
 void ChCBroadphase::DispatchRigid() {
     if (data_manager->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        BuildFamilySignatures();
+        if (data_manager->settings.collision.use_two_level_grid) {
+            TwoLevelBroadphase();
+        } else {
+            OneLevelBroadphase();
+        }
         data_manager->num_rigid_contacts = data_manager->measures.collision.number_of_contacts_possible;
     }
     return;
@@ -301,7 +391,13 @@ void ChCBroadphase::OneLevelBroadphase() {
                                       bin_aabb_number);
     }
 
-    Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+    // With the deterministic flag the sort is stable, so the shapes in each bin
+    // (and hence the candidate pairs emitted per bin) keep shape-index order
+    // regardless of the number of threads.
+    if (data_manager->settings.deterministic)
+        Thrust_Stable_Sort_By_Key(bin_number, bin_aabb_number);
+    else
+        Thrust_Sort_By_Key(bin_number, bin_aabb_number);
     number_of_bins_active = (int)(Run_Length_Encode(bin_number, bin_number_out, bin_start_index));
 
     if (number_of_bins_active <= 0) {
@@ -315,14 +411,62 @@ void ChCBroadphase::OneLevelBroadphase() {
     LOG(TRACE) << "Number of bins active: " << number_of_bins_active;
 
     Thrust_Exclusive_Scan(bin_start_index);
+
+    if (data_manager->settings.collision.broadphase_single_pass) {
+        // Single-pass pair generation: each thread appends the pairs of its bins to a
+        // local buffer, so the AABB-AABB overlap tests are not repeated in a separate
+        // counting pass. With a static schedule each thread processes a contiguous
+        // range of bins, so concatenating the buffers in thread order produces the
+        // same pair ordering as the count-then-fill scheme below.
+#if defined(CHRONO_OPENMP_ENABLED)
+        const int num_threads = omp_get_max_threads();
+#else
+        const int num_threads = 1;
+#endif
+        // reuse the persistent per-thread buffers: clear() keeps their capacity,
+        // so after warm-up each thread appends into its own NUMA-local pages
+        thread_pairs.resize(num_threads);
+        for (int t = 0; t < num_threads; t++)
+            thread_pairs[t].clear();
+
+#pragma omp parallel num_threads(num_threads)
+        {
+#if defined(CHRONO_OPENMP_ENABLED)
+            std::vector<long long>& local_pairs = thread_pairs[omp_get_thread_num()];
+#else
+            std::vector<long long>& local_pairs = thread_pairs[0];
+#endif
+#pragma omp for schedule(static)
+            for (int i = 0; i < (signed)number_of_bins_active; i++) {
+                f_Gather_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_number_out,
+                                                bin_aabb_number, bin_start_index, fam_data, fam_signature, fam_compat,
+                                                obj_active, obj_collide, obj_data_id, local_pairs);
+            }
+        }
+
+        number_of_contacts_possible = 0;
+        for (int t = 0; t < num_threads; t++)
+            number_of_contacts_possible += (uint)thread_pairs[t].size();
+        contact_pairs.resize(number_of_contacts_possible);
+
+        uint offset = 0;
+        for (int t = 0; t < num_threads; t++) {
+            thrust::copy(thread_pairs[t].begin(), thread_pairs[t].end(), contact_pairs.begin() + offset);
+            offset += (uint)thread_pairs[t].size();
+        }
+
+        LOG(TRACE) << "Number of possible collisions: " << number_of_contacts_possible;
+        return;
+    }
+
     bin_num_contact.resize(number_of_bins_active + 1);
     bin_num_contact[number_of_bins_active] = 0;
 
 #pragma omp parallel for
     for (int i = 0; i < (signed)number_of_bins_active; i++) {
         f_Count_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_number_out,
-                                       bin_aabb_number, bin_start_index, fam_data, obj_active, obj_collide, obj_data_id,
-                                       bin_num_contact);
+                                       bin_aabb_number, bin_start_index, fam_data, fam_signature, fam_compat,
+                                       obj_active, obj_collide, obj_data_id, bin_num_contact);
     }
 
     thrust::exclusive_scan(bin_num_contact.begin(), bin_num_contact.end(), bin_num_contact.begin());
@@ -333,13 +477,221 @@ void ChCBroadphase::OneLevelBroadphase() {
 #pragma omp parallel for
     for (int index = 0; index < (signed)number_of_bins_active; index++) {
         f_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_number_out,
-                                       bin_aabb_number, bin_start_index, bin_num_contact, fam_data, obj_active,
-                                       obj_collide, obj_data_id, contact_pairs);
+                                       bin_aabb_number, bin_start_index, bin_num_contact, fam_data, fam_signature,
+                                       fam_compat, obj_active, obj_collide, obj_data_id, contact_pairs);
     }
 
     contact_pairs.resize(number_of_contacts_possible);
     LOG(TRACE) << "Number of unique collisions: " << number_of_contacts_possible;
 }
 
+// Two-level hierarchical broadphase for polydisperse mixtures. Shapes whose AABB is
+// much larger than the mean register at a coarse grid whose resolution is driven by
+// their count, so that large-large pairs are found with a handful of overlap tests
+// instead of being duplicated across thousands of fine bins. The remaining shapes,
+// together with the large ones, are binned into the regular fine grid, where the
+// small-small and the cross-level pairs are generated (large-large pairs are skipped
+// there). The two pair sets are disjoint, so no duplicate filtering is needed.
+void ChCBroadphase::TwoLevelBroadphase() {
+    LOG(TRACE) << "ChCBroadphase::TwoLevelBroadphase()";
+    const custom_vector<real3>& aabb_min = data_manager->host_data.aabb_min;
+    const custom_vector<real3>& aabb_max = data_manager->host_data.aabb_max;
+    const custom_vector<short2>& fam_data = data_manager->shape_data.fam_rigid;
+    const custom_vector<char>& obj_active = data_manager->host_data.active_rigid;
+    const custom_vector<char>& obj_collide = data_manager->host_data.collide_rigid;
+    const custom_vector<uint>& obj_data_id = data_manager->shape_data.id_rigid;
+    custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+
+    custom_vector<uint>& bin_intersections = data_manager->host_data.bin_intersections;
+    custom_vector<uint>& bin_number = data_manager->host_data.bin_number;
+    custom_vector<uint>& bin_number_out = data_manager->host_data.bin_number_out;
+    custom_vector<uint>& bin_aabb_number = data_manager->host_data.bin_aabb_number;
+    custom_vector<uint>& bin_start_index = data_manager->host_data.bin_start_index;
+
+    vec3& bins_per_axis = data_manager->settings.collision.bins_per_axis;
+    const int num_shapes = data_manager->num_rigid_shapes;
+    const real density = data_manager->settings.collision.grid_density;
+
+    real3& inv_bin_size = data_manager->measures.collision.inv_bin_size;
+    uint& number_of_contacts_possible = data_manager->measures.collision.number_of_contacts_possible;
+
+    // Classify the shapes: everything with an AABB extent above grid_level_factor
+    // times the mean extent registers at the coarse level.
+    real mean_extent = 0;
+    uint num_counted = 0;
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX)
+            continue;
+        mean_extent += Max(aabb_max[i] - aabb_min[i]);
+        num_counted++;
+    }
+    if (num_counted == 0) {
+        number_of_contacts_possible = 0;
+        return;
+    }
+    mean_extent = mean_extent / num_counted;
+    const real large_threshold = data_manager->settings.collision.grid_level_factor * mean_extent;
+
+    custom_vector<char> shape_level(num_shapes);
+    uint num_large = 0;
+#pragma omp parallel for reduction(+ : num_large)
+    for (int i = 0; i < num_shapes; i++) {
+        shape_level[i] = (obj_data_id[i] != UINT_MAX) && (Max(aabb_max[i] - aabb_min[i]) > large_threshold);
+        num_large += shape_level[i];
+    }
+
+    LOG(TRACE) << "Number of large shapes: " << num_large;
+
+    // With all shapes on the same level there is nothing to split.
+    if (num_large == 0 || num_large == num_counted) {
+        OneLevelBroadphase();
+        return;
+    }
+
+    // Coarse level: bin only the large shapes, with a resolution based on their
+    // count. The standard kernels are reused by masking the small shapes out of a
+    // copy of the shape id array. The few resulting bins are processed serially.
+    custom_vector<uint> id_coarse = obj_data_id;
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_level[i] == 0)
+            id_coarse[i] = UINT_MAX;
+    }
+
+    const real3 diagonal =
+        Abs(data_manager->measures.collision.max_bounding_point - data_manager->measures.collision.global_origin);
+    vec3 bins_coarse = function_Compute_Grid_Resolution(num_large, diagonal, density);
+    real3 bin_size_coarse = diagonal / real3(bins_coarse.x, bins_coarse.y, bins_coarse.z);
+    real3 inv_bin_size_coarse = 1.0 / bin_size_coarse;
+
+    std::vector<long long> pairs_coarse;
+    {
+        bin_intersections.resize(num_shapes + 1);
+        bin_intersections[num_shapes] = 0;
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            if (id_coarse[i] == UINT_MAX) {
+                bin_intersections[i] = 0;
+                continue;
+            }
+            f_Count_AABB_BIN_Intersection(i, inv_bin_size_coarse, aabb_min, aabb_max, bin_intersections);
+        }
+        Thrust_Exclusive_Scan(bin_intersections);
+        uint num_intersections = bin_intersections.back();
+
+        bin_number.resize(num_intersections);
+        bin_number_out.resize(num_intersections);
+        bin_aabb_number.resize(num_intersections);
+        bin_start_index.resize(num_intersections);
+
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            if (id_coarse[i] == UINT_MAX)
+                continue;
+            f_Store_AABB_BIN_Intersection(i, bins_coarse, inv_bin_size_coarse, aabb_min, aabb_max, bin_intersections,
+                                          bin_number, bin_aabb_number);
+        }
+
+        if (data_manager->settings.deterministic)
+            Thrust_Stable_Sort_By_Key(bin_number, bin_aabb_number);
+        else
+            Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+        uint num_bins_coarse = (uint)(Run_Length_Encode(bin_number, bin_number_out, bin_start_index));
+
+        if (num_bins_coarse > 0) {
+            bin_start_index.resize(num_bins_coarse + 1);
+            bin_start_index[num_bins_coarse] = 0;
+            Thrust_Exclusive_Scan(bin_start_index);
+
+            for (int i = 0; i < (signed)num_bins_coarse; i++) {
+                f_Gather_AABB_AABB_Intersection(i, inv_bin_size_coarse, bins_coarse, aabb_min, aabb_max, bin_number_out,
+                                                bin_aabb_number, bin_start_index, fam_data, fam_signature, fam_compat,
+                                                obj_active, obj_collide, id_coarse, pairs_coarse);
+            }
+        }
+        LOG(TRACE) << "Number of possible large-large collisions: " << pairs_coarse.size();
+    }
+
+    // Fine level: bin all shapes into the regular grid. Large shapes are rasterized
+    // here as well, so the cross-level pairs come out of the same per-bin sweep as
+    // the small-small ones; only the large-large pairs are skipped.
+    bin_intersections.resize(num_shapes + 1);
+    bin_intersections[num_shapes] = 0;
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX) {
+            bin_intersections[i] = 0;
+            continue;
+        }
+        f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
+    }
+    Thrust_Exclusive_Scan(bin_intersections);
+    uint num_intersections = bin_intersections.back();
+
+    bin_number.resize(num_intersections);
+    bin_number_out.resize(num_intersections);
+    bin_aabb_number.resize(num_intersections);
+    bin_start_index.resize(num_intersections);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX)
+            continue;
+        f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
+                                      bin_aabb_number);
+    }
+
+    if (data_manager->settings.deterministic)
+        Thrust_Stable_Sort_By_Key(bin_number, bin_aabb_number);
+    else
+        Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+    uint num_bins_fine = (uint)(Run_Length_Encode(bin_number, bin_number_out, bin_start_index));
+
+#if defined(CHRONO_OPENMP_ENABLED)
+    const int num_threads = omp_get_max_threads();
+#else
+    const int num_threads = 1;
+#endif
+    thread_pairs.resize(num_threads);
+    for (int t = 0; t < num_threads; t++)
+        thread_pairs[t].clear();
+
+    if (num_bins_fine > 0) {
+        bin_start_index.resize(num_bins_fine + 1);
+        bin_start_index[num_bins_fine] = 0;
+        Thrust_Exclusive_Scan(bin_start_index);
+
+#pragma omp parallel num_threads(num_threads)
+        {
+#if defined(CHRONO_OPENMP_ENABLED)
+            std::vector<long long>& local_pairs = thread_pairs[omp_get_thread_num()];
+#else
+            std::vector<long long>& local_pairs = thread_pairs[0];
+#endif
+#pragma omp for schedule(static)
+            for (int i = 0; i < (signed)num_bins_fine; i++) {
+                f_Gather_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_number_out,
+                                                bin_aabb_number, bin_start_index, fam_data, fam_signature, fam_compat,
+                                                obj_active, obj_collide, obj_data_id, shape_level, local_pairs);
+            }
+        }
+    }
+
+    // Concatenate the two disjoint pair sets: coarse level first, then the fine
+    // level buffers in thread order, so the list is deterministic.
+    number_of_contacts_possible = (uint)pairs_coarse.size();
+    for (int t = 0; t < num_threads; t++)
+        number_of_contacts_possible += (uint)thread_pairs[t].size();
+    contact_pairs.resize(number_of_contacts_possible);
+
+    thrust::copy(pairs_coarse.begin(), pairs_coarse.end(), contact_pairs.begin());
+    uint offset = (uint)pairs_coarse.size();
+    for (int t = 0; t < num_threads; t++) {
+        thrust::copy(thread_pairs[t].begin(), thread_pairs[t].end(), contact_pairs.begin() + offset);
+        offset += (uint)thread_pairs[t].size();
+    }
+
+    LOG(TRACE) << "Number of possible collisions: " << number_of_contacts_possible;
+}
+
 } // end namespace collision
 } // end namespace chrono
@@ -19,6 +19,9 @@
 #pragma once
 
 #include <climits>
+#include <cstdint>
+
+#include <vector>
 
 #include "chrono_parallel/ChParallelDefines.h"
 #include "chrono_parallel/math/ChParallelMath.h"
@@ -55,6 +58,35 @@ inline vec3 HashMax(const T& A, const real3& inv_bin_size_vec) {
     return temp;
 }
 
+/// Convert the min/max corners of an AABB into the (inclusive) range of bin
+/// indices it touches. Equivalent to HashMin on the min corner followed by
+/// HashMax on the max corner, but converts each corner with packed
+/// multiply/floor/ceil/truncate instructions instead of six scalar libm calls;
+/// this is the inner operation of the per-shape binning loops below.
+inline void HashRange(const real3& Amin,
+                      const real3& Amax,
+                      const real3& inv_bin_size_vec,
+                      vec3& gmin,
+                      vec3& gmax) {
+#if defined(USE_AVX)
+    // The products are integral after the floor/ceil, so the truncating
+    // conversion to int32 is exact.
+    gmin = _mm256_cvttpd_epi32(_mm256_floor_pd(_mm256_mul_pd(Amin, inv_bin_size_vec)));
+    gmax = _mm_sub_epi32(_mm256_cvttpd_epi32(_mm256_ceil_pd(_mm256_mul_pd(Amax, inv_bin_size_vec))),
+                         _mm_set1_epi32(1));
+    gmin.w = 0;
+    gmax.w = 0;
+#elif defined(USE_SSE)
+    gmin = _mm_cvttps_epi32(_mm_floor_ps(_mm_mul_ps(Amin, inv_bin_size_vec)));
+    gmax = _mm_sub_epi32(_mm_cvttps_epi32(_mm_ceil_ps(_mm_mul_ps(Amax, inv_bin_size_vec))), _mm_set1_epi32(1));
+    gmin.w = 0;
+    gmax.w = 0;
+#else
+    gmin = HashMin(Amin, inv_bin_size_vec);
+    gmax = HashMax(Amax, inv_bin_size_vec);
+#endif
+}
+
 /// Convert a bin index into a unique hash value.
 static inline uint Hash_Index(const vec3& A, vec3 bins_per_axis) {
     return ((A.z * bins_per_axis.y) * bins_per_axis.x) + (A.y * bins_per_axis.x) + A.x;
@@ -78,6 +110,28 @@ static inline bool collide(short2 fam_data_A, short2 fam_data_B) {
     return (fam_data_A.y & fam_data_B.x) && (fam_data_B.y & fam_data_A.x);
 }
 
+/// Signature id marking shapes whose family data did not fit in the 64-entry
+/// compatibility bitmap (see ChCBroadphase::BuildFamilySignatures); pairs
+/// involving such shapes fall back to the per-pair collide() test.
+static const char fam_signature_overflow = 127;
+
+/// Compute the mask of family signatures present in a bin: bit s is set iff
+/// some shape in [start, end) has signature s. If any shape carries the
+/// overflow signature the full mask is returned, disabling the pruning.
+static inline uint64_t f_Bin_Family_Mask(const uint start,
+                                         const uint end,
+                                         const custom_vector<uint>& aabb_number,
+                                         const custom_vector<char>& fam_signature) {
+    uint64_t bin_mask = 0;
+    for (uint i = start; i < end; i++) {
+        char sig = fam_signature[aabb_number[i]];
+        if (sig == fam_signature_overflow)
+            return ~(uint64_t)0;
+        bin_mask |= (uint64_t)1 << sig;
+    }
+    return bin_mask;
+}
+
 /// Check if two AABBs overlap using their min/max corners.
 static inline bool overlap(real3 Amin, real3 Amax, real3 Bmin, real3 Bmax) {
     // Return true only if the two AABBs overlap in all 3 directions.
@@ -172,8 +226,8 @@ static void f_TL_Count_AABB_Leaf_Intersection(const uint index,
         Amin = Clamp(Amin, real3(0), Amax);
 
         // Find the extents
-        vec3 gmin = HashMin(Amin, inv_leaf_size);
-        vec3 gmax = HashMax(Amax, inv_leaf_size);
+        vec3 gmin, gmax;
+        HashRange(Amin, Amax, inv_leaf_size, gmin, gmax);
         // Make sure that the maximum bin value does not exceed the bounds of this grid
         vec3 max_clamp = cell_res - vec3(1);
         gmin = Clamp(gmin, vec3(0), max_clamp);
@@ -221,8 +275,8 @@ static void f_TL_Write_AABB_Leaf_Intersection(const uint& index,
         Amin = Clamp(Amin, real3(0), Amax);
 
         // Find the extents
-        vec3 gmin = HashMin(Amin, inv_leaf_size);
-        vec3 gmax = HashMax(Amax, inv_leaf_size);
+        vec3 gmin, gmax;
+        HashRange(Amin, Amax, inv_leaf_size, gmin, gmax);
 
         // Make sure that the maximum bin value does not exceed the bounds of this grid
         vec3 max_clamp = cell_res - vec3(1);
@@ -250,8 +304,8 @@ static inline void f_Count_AABB_BIN_Intersection(const uint index,
                                                  const custom_vector<real3>& aabb_min,
                                                  const custom_vector<real3>& aabb_max,
                                                  custom_vector<uint>& bins_intersected) {
-    vec3 gmin = HashMin(aabb_min[index], inv_bin_size);
-    vec3 gmax = HashMax(aabb_max[index], inv_bin_size);
+    vec3 gmin, gmax;
+    HashRange(aabb_min[index], aabb_max[index], inv_bin_size, gmin, gmax);
     bins_intersected[index] = (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
 }
 
@@ -265,8 +319,8 @@ static inline void f_Store_AABB_BIN_Intersection(const uint index,
                                                  custom_vector<uint>& bin_number,
                                                  custom_vector<uint>& aabb_number) {
     uint count = 0, i, j, k;
-    vec3 gmin = HashMin(aabb_min_data[index], inv_bin_size);
-    vec3 gmax = HashMax(aabb_max_data[index], inv_bin_size);
+    vec3 gmin, gmax;
+    HashRange(aabb_min_data[index], aabb_max_data[index], inv_bin_size, gmin, gmax);
     uint mInd = bins_intersected[index];
     for (i = gmin.x; i <= (uint)gmax.x; i++) {
         for (j = gmin.y; j <= (uint)gmax.y; j++) {
@@ -289,6 +343,8 @@ static inline void f_Count_AABB_AABB_Intersection(const uint index,
                                                   const custom_vector<uint>& aabb_number,
                                                   const custom_vector<uint>& bin_start_index,
                                                   const custom_vector<short2>& fam_data,
+                                                  const custom_vector<char>& fam_signature,
+                                                  const std::vector<uint64_t>& fam_compat,
                                                   const custom_vector<char>& body_active,
                                                   const custom_vector<char>& body_collide,
                                                   const custom_vector<uint>& body_id,
@@ -301,17 +357,22 @@ static inline void f_Count_AABB_AABB_Intersection(const uint index,
         num_contact[index] = 0;
         return;
     }
+    const uint64_t bin_mask = f_Bin_Family_Mask(start, end, aabb_number, fam_signature);
     for (uint i = start; i < end; i++) {
         uint shapeA = aabb_number[i];
         real3 Amin = aabb_min_data[shapeA];
         real3 Amax = aabb_max_data[shapeA];
         short2 famA = fam_data[shapeA];
+        char sigA = fam_signature[shapeA];
         uint bodyA = body_id[shapeA];
 
         if (bodyA == UINT_MAX)
             continue;
         if (body_collide[bodyA] == 0)
             continue;
+        // No shape of a compatible family shares this bin: skip the whole sweep.
+        if (sigA != fam_signature_overflow && !(fam_compat[sigA] & bin_mask))
+            continue;
 
         for (uint k = i + 1; k < end; k++) {
             uint shapeB = aabb_number[k];
@@ -329,7 +390,11 @@ static inline void f_Count_AABB_AABB_Intersection(const uint index,
                 continue;
             if (!body_active[bodyA] && !body_active[bodyB])
                 continue;
-            if (!collide(famA, fam_data[shapeB]))
+            char sigB = fam_signature[shapeB];
+            if (sigA == fam_signature_overflow || sigB == fam_signature_overflow) {
+                if (!collide(famA, fam_data[shapeB]))
+                    continue;
+            } else if (!((fam_compat[sigA] >> sigB) & 1))
                 continue;
             if (!overlap(Amin, Amax, Bmin, Bmax))
                 continue;
@@ -353,6 +418,8 @@ static inline void f_Store_AABB_AABB_Intersection(const uint index,
                                                   const custom_vector<uint>& bin_start_index,
                                                   const custom_vector<uint>& num_contact,
                                                   const custom_vector<short2>& fam_data,
+                                                  const custom_vector<char>& fam_signature,
+                                                  const std::vector<uint64_t>& fam_compat,
                                                   const custom_vector<char>& body_active,
                                                   const custom_vector<char>& body_collide,
                                                   const custom_vector<uint>& body_id,
@@ -365,18 +432,23 @@ static inline void f_Store_AABB_AABB_Intersection(const uint index,
     }
     uint offset = num_contact[index];
     uint count = 0;
+    const uint64_t bin_mask = f_Bin_Family_Mask(start, end, aabb_number, fam_signature);
 
     for (uint i = start; i < end; i++) {
         uint shapeA = aabb_number[i];
         real3 Amin = aabb_min_data[shapeA];
         real3 Amax = aabb_max_data[shapeA];
         short2 famA = fam_data[shapeA];
+        char sigA = fam_signature[shapeA];
         uint bodyA = body_id[shapeA];
 
         if (bodyA == UINT_MAX)
             continue;
         if (body_collide[bodyA] == 0)
             continue;
+        // No shape of a compatible family shares this bin: skip the whole sweep.
+        if (sigA != fam_signature_overflow && !(fam_compat[sigA] & bin_mask))
+            continue;
 
         for (uint k = i + 1; k < end; k++) {
             uint shapeB = aabb_number[k];
@@ -394,7 +466,11 @@ static inline void f_Store_AABB_AABB_Intersection(const uint index,
                 continue;
             if (!body_active[bodyA] && !body_active[bodyB])
                 continue;
-            if (!collide(famA, fam_data[shapeB]))
+            char sigB = fam_signature[shapeB];
+            if (sigA == fam_signature_overflow || sigB == fam_signature_overflow) {
+                if (!collide(famA, fam_data[shapeB]))
+                    continue;
+            } else if (!((fam_compat[sigA] >> sigB) & 1))
                 continue;
             if (!overlap(Amin, Amax, Bmin, Bmax))
                 continue;
@@ -413,6 +489,167 @@ static inline void f_Store_AABB_AABB_Intersection(const uint index,
     }
 }
 
+/// Function to test and store AABB-AABB intersections in a single pass.
+/// Performs the same sequence of rejection tests as the count/store pair of
+/// functions above, but appends the encoded shape pairs directly to the given
+/// buffer, so the overlap tests are not repeated in a separate counting pass.
+static inline void f_Gather_AABB_AABB_Intersection(const uint index,
+                                                   const real3 inv_bin_size_vec,
+                                                   const vec3 bins_per_axis,
+                                                   const custom_vector<real3>& aabb_min_data,
+                                                   const custom_vector<real3>& aabb_max_data,
+                                                   const custom_vector<uint>& bin_number,
+                                                   const custom_vector<uint>& aabb_number,
+                                                   const custom_vector<uint>& bin_start_index,
+                                                   const custom_vector<short2>& fam_data,
+                                                   const custom_vector<char>& fam_signature,
+                                                   const std::vector<uint64_t>& fam_compat,
+                                                   const custom_vector<char>& body_active,
+                                                   const custom_vector<char>& body_collide,
+                                                   const custom_vector<uint>& body_id,
+                                                   std::vector<long long>& potential_contacts) {
+    uint start = bin_start_index[index];
+    uint end = bin_start_index[index + 1];
+    // Terminate early if there is only one object in the bin
+    if (end - start == 1) {
+        return;
+    }
+    const uint64_t bin_mask = f_Bin_Family_Mask(start, end, aabb_number, fam_signature);
+
+    for (uint i = start; i < end; i++) {
+        uint shapeA = aabb_number[i];
+        real3 Amin = aabb_min_data[shapeA];
+        real3 Amax = aabb_max_data[shapeA];
+        short2 famA = fam_data[shapeA];
+        char sigA = fam_signature[shapeA];
+        uint bodyA = body_id[shapeA];
+
+        if (bodyA == UINT_MAX)
+            continue;
+        if (body_collide[bodyA] == 0)
+            continue;
+        // No shape of a compatible family shares this bin: skip the whole sweep.
+        if (sigA != fam_signature_overflow && !(fam_compat[sigA] & bin_mask))
+            continue;
+
+        for (uint k = i + 1; k < end; k++) {
+            uint shapeB = aabb_number[k];
+            uint bodyB = body_id[shapeB];
+            real3 Bmin = aabb_min_data[shapeB];
+            real3 Bmax = aabb_max_data[shapeB];
+
+            if (bodyB == UINT_MAX)
+                continue;
+            if (shapeA == shapeB)
+                continue;
+            if (bodyA == bodyB)
+                continue;
+            if (body_collide[bodyB] == 0)
+                continue;
+            if (!body_active[bodyA] && !body_active[bodyB])
+                continue;
+            char sigB = fam_signature[shapeB];
+            if (sigA == fam_signature_overflow || sigB == fam_signature_overflow) {
+                if (!collide(famA, fam_data[shapeB]))
+                    continue;
+            } else if (!((fam_compat[sigA] >> sigB) & 1))
+                continue;
+            if (!overlap(Amin, Amax, Bmin, Bmax))
+                continue;
+            if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size_vec, bins_per_axis, bin_number[index]) == false)
+                continue;
+
+            // the two indices of the shapes that make up the contact, smaller one first
+            if (shapeB < shapeA)
+                potential_contacts.push_back((long long)shapeB << 32 | (long long)shapeA);
+            else
+                potential_contacts.push_back((long long)shapeA << 32 | (long long)shapeB);
+        }
+    }
+}
+
+/// Variant of the single-pass pair gathering for the fine level of the two-level
+/// broadphase: identical to the function above, except that pairs where both shapes
+/// registered at the coarse grid level are skipped, since those are generated on the
+/// coarse grid with a bin size appropriate for them.
+static inline void f_Gather_AABB_AABB_Intersection(const uint index,
+                                                   const real3 inv_bin_size_vec,
+                                                   const vec3 bins_per_axis,
+                                                   const custom_vector<real3>& aabb_min_data,
+                                                   const custom_vector<real3>& aabb_max_data,
+                                                   const custom_vector<uint>& bin_number,
+                                                   const custom_vector<uint>& aabb_number,
+                                                   const custom_vector<uint>& bin_start_index,
+                                                   const custom_vector<short2>& fam_data,
+                                                   const custom_vector<char>& fam_signature,
+                                                   const std::vector<uint64_t>& fam_compat,
+                                                   const custom_vector<char>& body_active,
+                                                   const custom_vector<char>& body_collide,
+                                                   const custom_vector<uint>& body_id,
+                                                   const custom_vector<char>& shape_level,
+                                                   std::vector<long long>& potential_contacts) {
+    uint start = bin_start_index[index];
+    uint end = bin_start_index[index + 1];
+    // Terminate early if there is only one object in the bin
+    if (end - start == 1) {
+        return;
+    }
+    const uint64_t bin_mask = f_Bin_Family_Mask(start, end, aabb_number, fam_signature);
+
+    for (uint i = start; i < end; i++) {
+        uint shapeA = aabb_number[i];
+        real3 Amin = aabb_min_data[shapeA];
+        real3 Amax = aabb_max_data[shapeA];
+        short2 famA = fam_data[shapeA];
+        char sigA = fam_signature[shapeA];
+        uint bodyA = body_id[shapeA];
+
+        if (bodyA == UINT_MAX)
+            continue;
+        if (body_collide[bodyA] == 0)
+            continue;
+        // No shape of a compatible family shares this bin: skip the whole sweep.
+        if (sigA != fam_signature_overflow && !(fam_compat[sigA] & bin_mask))
+            continue;
+
+        for (uint k = i + 1; k < end; k++) {
+            uint shapeB = aabb_number[k];
+            uint bodyB = body_id[shapeB];
+            real3 Bmin = aabb_min_data[shapeB];
+            real3 Bmax = aabb_max_data[shapeB];
+
+            if (bodyB == UINT_MAX)
+                continue;
+            if (shapeA == shapeB)
+                continue;
+            if (bodyA == bodyB)
+                continue;
+            if (body_collide[bodyB] == 0)
+                continue;
+            if (!body_active[bodyA] && !body_active[bodyB])
+                continue;
+            if (shape_level[shapeA] != 0 && shape_level[shapeB] != 0)
+                continue;
+            char sigB = fam_signature[shapeB];
+            if (sigA == fam_signature_overflow || sigB == fam_signature_overflow) {
+                if (!collide(famA, fam_data[shapeB]))
+                    continue;
+            } else if (!((fam_compat[sigA] >> sigB) & 1))
+                continue;
+            if (!overlap(Amin, Amax, Bmin, Bmax))
+                continue;
+            if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size_vec, bins_per_axis, bin_number[index]) == false)
+                continue;
+
+            // the two indices of the shapes that make up the contact, smaller one first
+            if (shapeB < shapeA)
+                potential_contacts.push_back((long long)shapeB << 32 | (long long)shapeA);
+            else
+                potential_contacts.push_back((long long)shapeA << 32 | (long long)shapeB);
+        }
+    }
+}
+
 /// @} parallel_colision
 
 } // end namespace collision
@@ -19,6 +19,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <unordered_map>
+
 #include "chrono/collision/ChCCollisionModel.h"
 
 #include "chrono_parallel/math/ChParallelMath.h"
@@ -39,6 +42,17 @@ class CH_PARALLEL_API ChCAABBGenerator {
     ChCAABBGenerator();
     void GenerateAABB();
     ChParallelDataManager* data_manager;
+
+    // State for the incremental refit mode (collision.use_aabb_refit): body
+    // pose at the last rebuild of its boxes, a conservative radius covering all
+    // of the body's shapes, and the per-body dirty flags for the current step.
+    custom_vector<real3> ref_pos_rigid;
+    custom_vector<quaternion> ref_rot_rigid;
+    custom_vector<real> ref_radius_rigid;
+    custom_vector<char> body_dirty;
+    /// Adaptive envelope each body's boxes were last built with (refit mode
+    /// only); a box whose body's envelope grew past it is rebuilt.
+    custom_vector<real> ref_env_rigid;
 };
 
 /// Class for performing broad-phase collision detection.
@@ -47,6 +61,7 @@ class CH_PARALLEL_API ChCBroadphase {
     ChCBroadphase();
     void DispatchRigid();
     void OneLevelBroadphase();
+    void TwoLevelBroadphase();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -56,6 +71,32 @@ class CH_PARALLEL_API ChCBroadphase {
     ChParallelDataManager* data_manager;
 
   private:
+    /// Map each shape's collision family data to a compact signature id and
+    /// precompute the pairwise family-compatibility bitmap over the distinct
+    /// signatures, so the per-pair family test in the candidate generation
+    /// loops reduces to one bit probe (and whole incompatible sweeps can be
+    /// skipped through the per-bin signature mask).
+    void BuildFamilySignatures();
+
+    /// Re-derive the grid resolution when the measured occupancy has drifted
+    /// outside the hysteresis band (see adaptive_bins in ChSettings.h).
+    void RecalibrateResolution(int num_shapes, const real3& diagonal);
+
+    /// Occupancy (AABBs per active bin) measured on the first dispatch after the
+    /// last grid (re)calibration; 0 requests a new baseline measurement.
+    real calibrated_occupancy;
+
+    /// Persistent per-thread pair buffers for the single-pass dispatch. Kept
+    /// across steps so that, after warm-up, each thread appends into memory it
+    /// first-touched itself (hence local to its NUMA node).
+    std::vector<std::vector<long long>> thread_pairs;
+
+    /// Per-shape family signature id (0..63), or fam_signature_overflow for
+    /// shapes beyond 64 distinct family masks (then the per-pair test falls
+    /// back to reading fam_rigid).
+    custom_vector<char> fam_signature;
+    /// Bit sb of entry sa is set iff families with signatures sa and sb collide.
+    std::vector<uint64_t> fam_compat;
 };
 
 /// Class for performing narrow-phase collision detection.
@@ -133,6 +174,10 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
                           uint& num_contacts);
 
     void DispatchMPR();
+    /// Drop all cached narrowphase results (see collision setting use_manifold_cache).
+    /// The cache is rebuilt from scratch at the next collision detection.
+    void ClearManifoldCache() { manifold_cache.clear(); }
+
     void DispatchR();
     void DispatchHybridMPR();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
@@ -140,14 +185,42 @@ class CH_PARALLEL_API ChCNarrowphaseDispatch {
     ChParallelDataManager* data_manager;
 
   private:
+    /// Cached single-point narrowphase result of a shape pair, together with the
+    /// global shape transforms at which it was computed.
+    struct ManifoldCacheEntry {
+        real3 posA;       ///< global position of shape A at the cached evaluation
+        real3 posB;       ///< global position of shape B at the cached evaluation
+        quaternion rotA;  ///< global rotation of shape A at the cached evaluation
+        quaternion rotB;  ///< global rotation of shape B at the cached evaluation
+        real3 norm;       ///< cached contact normal
+        real3 ptA;        ///< cached contact point on shape A
+        real3 ptB;        ///< cached contact point on shape B
+        real depth;       ///< cached penetration depth
+        bool active;      ///< did the cached evaluation produce a contact?
+    };
+
+    /// Persistent manifold cache, keyed by the encoded shape-pair id of the
+    /// broadphase candidate pairs.
+    std::unordered_map<long long, ManifoldCacheEntry> manifold_cache;
+
     custom_vector<char> contact_rigid_active;
     custom_vector<char> contact_rigid_fluid_active;
     custom_vector<char> contact_fluid_active;
     custom_vector<uint> contact_index;
+    custom_vector<long long> contact_sort_keys;
+    custom_vector<uint> dispatch_keys;     ///< (typeA,typeB) key of each candidate pair
+    custom_vector<uint> dispatch_indices;  ///< candidate pair indices, sorted by dispatch_keys
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
 
+    /// Exponentially-decayed peaks of the candidate and surviving rigid
+    /// contact counts, carried across steps. DispatchRigid() reserves the
+    /// contact arrays ahead of these estimates so that a surge in contacts
+    /// does not trigger reallocate-and-copy while the arrays are being filled.
+    double estimated_potential_contacts = 0;
+    double estimated_rigid_contacts = 0;
+
     real collision_envelope;
     NarrowPhaseType narrowphase_algorithm;
     SystemType system_type;
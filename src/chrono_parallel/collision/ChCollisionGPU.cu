@@ -0,0 +1,522 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Hammad Mazhar
+// =============================================================================
+
+#include "chrono_parallel/collision/ChCollisionGPU.cuh"
+#include "chrono_parallel/ChCudaHelper.cuh"
+#include "chrono_parallel/ChGPUVector.cuh"
+
+#include <thrust/device_ptr.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include "chrono_thirdparty/cub/cub.cuh"
+
+namespace chrono {
+namespace collision {
+
+// Device copies of the shape tables (uploaded on topology changes only) and of
+// the per-step pipeline working set. Persistent across steps so that device
+// memory is only reallocated when the problem grows.
+gpu_vector<uint> d_id_rigid;
+gpu_vector<short2> d_fam_rigid;
+gpu_vector<int> d_start_rigid;
+gpu_vector<real> d_sphere_rigid;
+gpu_vector<real3> d_ObA_rigid;
+gpu_vector<real3> d_pos_rigid;
+gpu_vector<quaternion> d_rot_rigid;
+gpu_vector<char> d_active_rigid, d_collide_rigid;
+
+gpu_vector<real3> d_aabb_min, d_aabb_max;
+gpu_vector<char> d_enabled;
+gpu_vector<real> d_bounds_scratch;
+gpu_vector<uint> d_bin_counts;
+gpu_vector<uint> d_bin_number, d_bin_shape;
+gpu_vector<uint> d_pair_counts;
+gpu_vector<uint2> d_pairs;
+gpu_vector<uint> d_contact_counts;
+gpu_vector<long long> d_contact_keys;
+gpu_vector<real3> d_norm, d_cpta, d_cptb;
+gpu_vector<real> d_dpth, d_erad;
+gpu_vector<vec2> d_bids;
+
+// Scene bounds and derived grid quantities, written by the bounds reduction
+// and read by the binning kernels without a round trip to the host:
+// [0..2] min point, [3..5] max point, [6..8] inverse bin size.
+CUDA_DEVICE real d_grid[9];
+
+// -----------------------------------------------------------------------------
+
+// The free real3 operators are compiled host-side (real3.cpp), so the kernels
+// work on components through these helpers.
+
+CUDA_DEVICE inline real3 RotateDev(const real3& v, const quaternion& q) {
+    // Rotate(v, q) from real_quaternion.h, written out on components.
+    real e0e0 = q.w * q.w;
+    real e1e1 = q.x * q.x;
+    real e2e2 = q.y * q.y;
+    real e3e3 = q.z * q.z;
+    real e0e1 = q.w * q.x;
+    real e0e2 = q.w * q.y;
+    real e0e3 = q.w * q.z;
+    real e1e2 = q.x * q.y;
+    real e1e3 = q.x * q.z;
+    real e2e3 = q.y * q.z;
+    return real3(((e0e0 + e1e1) * 2 - 1) * v.x + ((e1e2 - e0e3) * 2) * v.y + ((e1e3 + e0e2) * 2) * v.z,
+                 ((e1e2 + e0e3) * 2) * v.x + ((e0e0 + e2e2) * 2 - 1) * v.y + ((e2e3 - e0e1) * 2) * v.z,
+                 ((e1e3 - e0e2) * 2) * v.x + ((e2e3 + e0e1) * 2) * v.y + ((e0e0 + e3e3) * 2 - 1) * v.z);
+}
+
+CUDA_DEVICE inline bool CollideDev(const short2& fam_A, const short2& fam_B) {
+    // Same convention as collide() in ChBroadphaseUtils.h.
+    return (fam_A.y & fam_B.x) && (fam_B.y & fam_A.x);
+}
+
+CUDA_DEVICE inline int BinCoord(real p, real inv_bin_size, int bins) {
+    int b = (int)(p * inv_bin_size);
+    return min(max(b, 0), bins - 1);
+}
+
+// -----------------------------------------------------------------------------
+
+// Compute the world AABB of each sphere shape. Dead slots (body identifier
+// UINT_MAX) and shapes of inactive or non-colliding bodies are disabled and
+// take no further part in the pipeline.
+CUDA_GLOBAL void kSphereAABB(int num_shapes,
+                             const uint* id_rigid,
+                             const int* start_rigid,
+                             const real* sphere_rigid,
+                             const real3* ObA_rigid,
+                             const real3* pos_rigid,
+                             const quaternion* rot_rigid,
+                             const char* active_rigid,
+                             const char* collide_rigid,
+                             real envelope,
+                             real3* aabb_min,
+                             real3* aabb_max,
+                             char* enabled) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_shapes)
+        return;
+    uint body = id_rigid[i];
+    if (body == UINT_MAX || !active_rigid[body] || !collide_rigid[body]) {
+        enabled[i] = 0;
+        return;
+    }
+    enabled[i] = 1;
+    real3 p = pos_rigid[body];
+    real3 local = ObA_rigid[i];
+    real3 offset = RotateDev(local, rot_rigid[body]);
+    real radius = sphere_rigid[start_rigid[i]] + envelope;
+    aabb_min[i] = real3(p.x + offset.x - radius, p.y + offset.y - radius, p.z + offset.z - radius);
+    aabb_max[i] = real3(p.x + offset.x + radius, p.y + offset.y + radius, p.z + offset.z + radius);
+}
+
+// Scene bounds: one partial min/max per block into the scratch array...
+CUDA_GLOBAL void kBoundsPartial(int num_shapes,
+                                const real3* aabb_min,
+                                const real3* aabb_max,
+                                const char* enabled,
+                                real* scratch) {
+    typedef cub::BlockReduce<real, num_threads_per_block> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    bool valid = (i < num_shapes) && enabled[i];
+    real lo[3], hi[3];
+    for (int c = 0; c < 3; c++) {
+        lo[c] = valid ? aabb_min[i][c] : +C_LARGE_REAL;
+        hi[c] = valid ? aabb_max[i][c] : -C_LARGE_REAL;
+    }
+    for (int c = 0; c < 3; c++) {
+        real m = BlockReduce(temp_storage).Reduce(lo[c], cub::Min());
+        __syncthreads();
+        if (threadIdx.x == 0)
+            scratch[blockIdx.x * 6 + c] = m;
+        m = BlockReduce(temp_storage).Reduce(hi[c], cub::Max());
+        if (threadIdx.x == 0)
+            scratch[blockIdx.x * 6 + 3 + c] = m;
+        __syncthreads();
+    }
+}
+
+// ... then a single block folds the partials and derives the grid constants.
+CUDA_GLOBAL void kBoundsFinal(int num_blocks, const real* scratch, vec3 bins_per_axis) {
+    typedef cub::BlockReduce<real, num_threads_per_block> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    for (int c = 0; c < 3; c++) {
+        real lo = +C_LARGE_REAL;
+        real hi = -C_LARGE_REAL;
+        for (int b = threadIdx.x; b < num_blocks; b += blockDim.x) {
+            lo = fmin(lo, scratch[b * 6 + c]);
+            hi = fmax(hi, scratch[b * 6 + 3 + c]);
+        }
+        lo = BlockReduce(temp_storage).Reduce(lo, cub::Min());
+        __syncthreads();
+        hi = BlockReduce(temp_storage).Reduce(hi, cub::Max());
+        __syncthreads();
+        if (threadIdx.x == 0) {
+            int bins = (c == 0) ? bins_per_axis.x : (c == 1) ? bins_per_axis.y : bins_per_axis.z;
+            d_grid[c] = lo;
+            d_grid[3 + c] = hi;
+            d_grid[6 + c] = (hi > lo) ? (real)bins / (hi - lo) : 1;
+        }
+    }
+}
+
+// Number of grid bins covered by each shape AABB.
+CUDA_GLOBAL void kCountBins(int num_shapes,
+                            const real3* aabb_min,
+                            const real3* aabb_max,
+                            const char* enabled,
+                            vec3 bins_per_axis,
+                            uint* counts) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_shapes)
+        return;
+    if (!enabled[i]) {
+        counts[i] = 0;
+        return;
+    }
+    int nx = BinCoord(aabb_max[i].x - d_grid[0], d_grid[6], bins_per_axis.x) -
+             BinCoord(aabb_min[i].x - d_grid[0], d_grid[6], bins_per_axis.x) + 1;
+    int ny = BinCoord(aabb_max[i].y - d_grid[1], d_grid[7], bins_per_axis.y) -
+             BinCoord(aabb_min[i].y - d_grid[1], d_grid[7], bins_per_axis.y) + 1;
+    int nz = BinCoord(aabb_max[i].z - d_grid[2], d_grid[8], bins_per_axis.z) -
+             BinCoord(aabb_min[i].z - d_grid[2], d_grid[8], bins_per_axis.z) + 1;
+    counts[i] = nx * ny * nz;
+}
+
+// Emit the (bin, shape) incidence pairs, to be sorted by bin.
+CUDA_GLOBAL void kFillBins(int num_shapes,
+                           const real3* aabb_min,
+                           const real3* aabb_max,
+                           const char* enabled,
+                           vec3 bins_per_axis,
+                           const uint* offsets,
+                           uint* bin_number,
+                           uint* bin_shape) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_shapes || !enabled[i])
+        return;
+    int x0 = BinCoord(aabb_min[i].x - d_grid[0], d_grid[6], bins_per_axis.x);
+    int x1 = BinCoord(aabb_max[i].x - d_grid[0], d_grid[6], bins_per_axis.x);
+    int y0 = BinCoord(aabb_min[i].y - d_grid[1], d_grid[7], bins_per_axis.y);
+    int y1 = BinCoord(aabb_max[i].y - d_grid[1], d_grid[7], bins_per_axis.y);
+    int z0 = BinCoord(aabb_min[i].z - d_grid[2], d_grid[8], bins_per_axis.z);
+    int z1 = BinCoord(aabb_max[i].z - d_grid[2], d_grid[8], bins_per_axis.z);
+    uint write = offsets[i];
+    for (int x = x0; x <= x1; x++)
+        for (int y = y0; y <= y1; y++)
+            for (int z = z0; z <= z1; z++) {
+                bin_number[write] = (uint)x + (uint)y * bins_per_axis.x + (uint)z * bins_per_axis.x * bins_per_axis.y;
+                bin_shape[write] = (uint)i;
+                write++;
+            }
+}
+
+// A candidate pair is generated in its "home" bin only (the bin containing the
+// lower corner of the AABB overlap region), so pairs spanning several bins are
+// not duplicated. Same dedup rule as the host broadphase.
+CUDA_DEVICE inline bool PairInBin(int num_shapes_unused,
+                                  uint bin,
+                                  vec3 bins_per_axis,
+                                  const real3& min_a,
+                                  const real3& min_b) {
+    int hx = BinCoord(fmax(min_a.x, min_b.x) - d_grid[0], d_grid[6], bins_per_axis.x);
+    int hy = BinCoord(fmax(min_a.y, min_b.y) - d_grid[1], d_grid[7], bins_per_axis.y);
+    int hz = BinCoord(fmax(min_a.z, min_b.z) - d_grid[2], d_grid[8], bins_per_axis.z);
+    return bin == (uint)hx + (uint)hy * bins_per_axis.x + (uint)hz * bins_per_axis.x * bins_per_axis.y;
+}
+
+CUDA_DEVICE inline bool AABBOverlap(const real3& min_a, const real3& max_a, const real3& min_b, const real3& max_b) {
+    return max_a.x >= min_b.x && min_a.x <= max_b.x &&  //
+           max_a.y >= min_b.y && min_a.y <= max_b.y &&  //
+           max_a.z >= min_b.z && min_a.z <= max_b.z;
+}
+
+// Candidate pairs from the sorted (bin, shape) list: each entry tests against
+// the later entries of its bin segment (count pass / fill pass share this
+// code, with pairs == NULL in the count pass).
+CUDA_GLOBAL void kBinPairs(int num_entries,
+                           const uint* bin_number,
+                           const uint* bin_shape,
+                           const uint* id_rigid,
+                           const short2* fam_rigid,
+                           const real3* aabb_min,
+                           const real3* aabb_max,
+                           vec3 bins_per_axis,
+                           const uint* offsets,
+                           uint* counts,
+                           uint2* pairs) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_entries)
+        return;
+    const uint bin = bin_number[i];
+    const uint a = bin_shape[i];
+    uint found = 0;
+    uint write = pairs ? offsets[i] : 0;
+    for (int j = i + 1; j < num_entries && bin_number[j] == bin; j++) {
+        const uint b = bin_shape[j];
+        if (id_rigid[a] == id_rigid[b])
+            continue;
+        if (!CollideDev(fam_rigid[a], fam_rigid[b]))
+            continue;
+        if (!AABBOverlap(aabb_min[a], aabb_max[a], aabb_min[b], aabb_max[b]))
+            continue;
+        if (!PairInBin(0, bin, bins_per_axis, aabb_min[a], aabb_min[b]))
+            continue;
+        if (pairs) {
+            pairs[write] = (a < b) ? make_uint2(a, b) : make_uint2(b, a);
+            write++;
+        }
+        found++;
+    }
+    if (!pairs)
+        counts[i] = found;
+}
+
+// Sphere-sphere narrowphase on the candidate pairs (count pass / fill pass).
+// Matches the sphere case of the host narrowphase: a contact is kept when the
+// gap is within the (already envelope-inflated) radii.
+CUDA_GLOBAL void kSphereSphere(int num_pairs,
+                               const uint2* pairs,
+                               const uint* id_rigid,
+                               const int* start_rigid,
+                               const real* sphere_rigid,
+                               const real3* ObA_rigid,
+                               const real3* pos_rigid,
+                               const quaternion* rot_rigid,
+                               real envelope,
+                               const uint* offsets,
+                               uint* counts,
+                               long long* keys,
+                               real3* norm,
+                               real3* cpta,
+                               real3* cptb,
+                               real* dpth,
+                               real* erad,
+                               int2* bids) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= num_pairs)
+        return;
+    const uint a = pairs[i].x;
+    const uint b = pairs[i].y;
+    const uint body_a = id_rigid[a];
+    const uint body_b = id_rigid[b];
+
+    real3 oa = RotateDev(ObA_rigid[a], rot_rigid[body_a]);
+    real3 ob = RotateDev(ObA_rigid[b], rot_rigid[body_b]);
+    real3 ca = real3(pos_rigid[body_a].x + oa.x, pos_rigid[body_a].y + oa.y, pos_rigid[body_a].z + oa.z);
+    real3 cb = real3(pos_rigid[body_b].x + ob.x, pos_rigid[body_b].y + ob.y, pos_rigid[body_b].z + ob.z);
+    real ra = sphere_rigid[start_rigid[a]];
+    real rb = sphere_rigid[start_rigid[b]];
+
+    real3 delta = real3(cb.x - ca.x, cb.y - ca.y, cb.z - ca.z);
+    real dist2 = delta.x * delta.x + delta.y * delta.y + delta.z * delta.z;
+    real touch = ra + rb + 2 * envelope;
+    if (dist2 >= touch * touch || dist2 < C_EPSILON) {
+        if (!norm)
+            counts[i] = 0;
+        return;
+    }
+    if (!norm) {
+        counts[i] = 1;
+        return;
+    }
+    real dist = sqrt(dist2);
+    real inv_dist = 1 / dist;
+    real3 n = real3(delta.x * inv_dist, delta.y * inv_dist, delta.z * inv_dist);
+    uint w = offsets[i];
+    norm[w] = n;
+    cpta[w] = real3(ca.x + n.x * ra, ca.y + n.y * ra, ca.z + n.z * ra);
+    cptb[w] = real3(cb.x - n.x * rb, cb.y - n.y * rb, cb.z - n.z * rb);
+    dpth[w] = dist - (ra + rb);
+    erad[w] = ra * rb / (ra + rb);
+    bids[w] = make_int2((int)body_a, (int)body_b);
+    keys[w] = ((long long)body_a << 32) | (long long)body_b;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static void Upload(gpu_vector<T>& device, const T* host, size_t count) {
+    if (count == 0)
+        return;
+    if (device.size() < count)
+        device.resize(count);
+    cudaCheck(cudaMemcpy((void*)device(), host, count * sizeof(T), cudaMemcpyHostToDevice));
+}
+
+template <typename T>
+static void Download(gpu_vector<T>& device, std::vector<T>& host, size_t count) {
+    host.resize(count);
+    if (count)
+        cudaCheck(cudaMemcpy((void*)host.data(), device(), count * sizeof(T), cudaMemcpyDeviceToHost));
+}
+
+static uint ExclusiveScan(gpu_vector<uint>& v, uint count) {
+    // Returns the total; the array is scanned in place.
+    uint last_count;
+    cudaCheck(cudaMemcpy(&last_count, v() + count - 1, sizeof(uint), cudaMemcpyDeviceToHost));
+    thrust::device_ptr<uint> p((uint*)v());
+    thrust::exclusive_scan(p, p + count, p);
+    uint last_offset;
+    cudaCheck(cudaMemcpy(&last_offset, v() + count - 1, sizeof(uint), cudaMemcpyDeviceToHost));
+    return last_offset + last_count;
+}
+
+uint CollisionPipelineGPU(const uint num_shapes,
+                          const bool shapes_changed,
+                          const uint* id_rigid,
+                          const short2* fam_rigid,
+                          const int* start_rigid,
+                          const real* sphere_rigid,
+                          const real3* ObA_rigid,
+                          const uint num_sphere_records,
+                          const real3* pos_rigid,
+                          const quaternion* rot_rigid,
+                          const char* active_rigid,
+                          const char* collide_rigid,
+                          const real envelope,
+                          const vec3 bins_per_axis,
+                          real3& min_bounding_point,
+                          real3& max_bounding_point,
+                          std::vector<real3>& norm,
+                          std::vector<real3>& cpta,
+                          std::vector<real3>& cptb,
+                          std::vector<real>& dpth,
+                          std::vector<real>& erad,
+                          std::vector<vec2>& bids) {
+    if (num_shapes == 0)
+        return 0;
+    uint num_bodies = 0;
+    for (uint i = 0; i < num_shapes; i++) {
+        if (id_rigid[i] != UINT_MAX && id_rigid[i] + 1 > num_bodies)
+            num_bodies = id_rigid[i] + 1;
+    }
+    if (num_bodies == 0)
+        return 0;
+
+    // Shape tables: device-resident, refreshed only on topology changes.
+    if (shapes_changed || d_id_rigid.size() < num_shapes) {
+        Upload(d_id_rigid, id_rigid, num_shapes);
+        Upload(d_fam_rigid, fam_rigid, num_shapes);
+        Upload(d_start_rigid, start_rigid, num_shapes);
+        Upload(d_sphere_rigid, sphere_rigid, num_sphere_records);
+        Upload(d_ObA_rigid, ObA_rigid, num_shapes);
+    }
+
+    // Body states: the one host-to-device transfer of the step.
+    Upload(d_pos_rigid, pos_rigid, num_bodies);
+    Upload(d_rot_rigid, rot_rigid, num_bodies);
+    Upload(d_active_rigid, active_rigid, num_bodies);
+    Upload(d_collide_rigid, collide_rigid, num_bodies);
+
+    // AABB generation and scene bounds.
+    if (d_aabb_min.size() < num_shapes) {
+        d_aabb_min.resize(num_shapes);
+        d_aabb_max.resize(num_shapes);
+        d_enabled.resize(num_shapes);
+        d_bin_counts.resize(num_shapes);
+    }
+    kSphereAABB<<<CONFIG(num_shapes)>>>(num_shapes, d_id_rigid(), d_start_rigid(), d_sphere_rigid(), d_ObA_rigid(),
+                                        d_pos_rigid(), d_rot_rigid(), d_active_rigid(), d_collide_rigid(), envelope,
+                                        d_aabb_min(), d_aabb_max(), d_enabled());
+    const uint num_blocks = BLOCKS(num_shapes);
+    if (d_bounds_scratch.size() < 6 * num_blocks)
+        d_bounds_scratch.resize(6 * num_blocks);
+    kBoundsPartial<<<CONFIG(num_shapes)>>>(num_shapes, d_aabb_min(), d_aabb_max(), d_enabled(), d_bounds_scratch());
+    kBoundsFinal<<<1, num_threads_per_block>>>(num_blocks, d_bounds_scratch(), bins_per_axis);
+
+    real grid_host[9];
+    cudaCheck(cudaMemcpyFromSymbol(grid_host, d_grid, sizeof(grid_host)));
+    min_bounding_point = real3(grid_host[0], grid_host[1], grid_host[2]);
+    max_bounding_point = real3(grid_host[3], grid_host[4], grid_host[5]);
+
+    // Broadphase: bin the AABBs on the uniform grid and generate the candidate
+    // pairs bin by bin, with the usual count / scan / fill scheme.
+    kCountBins<<<CONFIG(num_shapes)>>>(num_shapes, d_aabb_min(), d_aabb_max(), d_enabled(), bins_per_axis,
+                                       d_bin_counts());
+    const uint num_entries = ExclusiveScan(d_bin_counts, num_shapes);
+    if (num_entries == 0)
+        return 0;
+    if (d_bin_number.size() < num_entries) {
+        d_bin_number.resize(num_entries);
+        d_bin_shape.resize(num_entries);
+        d_pair_counts.resize(num_entries);
+    }
+    kFillBins<<<CONFIG(num_shapes)>>>(num_shapes, d_aabb_min(), d_aabb_max(), d_enabled(), bins_per_axis,
+                                      d_bin_counts(), d_bin_number(), d_bin_shape());
+    {
+        thrust::device_ptr<uint> keys((uint*)d_bin_number());
+        thrust::device_ptr<uint> vals((uint*)d_bin_shape());
+        thrust::sort_by_key(keys, keys + num_entries, vals);
+    }
+    kBinPairs<<<CONFIG(num_entries)>>>(num_entries, d_bin_number(), d_bin_shape(), d_id_rigid(), d_fam_rigid(),
+                                       d_aabb_min(), d_aabb_max(), bins_per_axis, NULL, d_pair_counts(), NULL);
+    const uint num_pairs = ExclusiveScan(d_pair_counts, num_entries);
+    if (num_pairs == 0)
+        return 0;
+    if (d_pairs.size() < num_pairs) {
+        d_pairs.resize(num_pairs);
+        d_contact_counts.resize(num_pairs);
+    }
+    kBinPairs<<<CONFIG(num_entries)>>>(num_entries, d_bin_number(), d_bin_shape(), d_id_rigid(), d_fam_rigid(),
+                                       d_aabb_min(), d_aabb_max(), bins_per_axis, d_pair_counts(), NULL, d_pairs());
+
+    // Narrowphase: sphere-sphere on the candidate pairs, compacted into the
+    // contact arrays and sorted by the encoded body pair identifier, matching
+    // the host convention expected by the constraint assembly.
+    kSphereSphere<<<CONFIG(num_pairs)>>>(num_pairs, d_pairs(), d_id_rigid(), d_start_rigid(), d_sphere_rigid(),
+                                         d_ObA_rigid(), d_pos_rigid(), d_rot_rigid(), envelope, NULL,
+                                         d_contact_counts(), NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+    const uint num_contacts = ExclusiveScan(d_contact_counts, num_pairs);
+    if (num_contacts == 0)
+        return 0;
+    if (d_norm.size() < num_contacts) {
+        d_norm.resize(num_contacts);
+        d_cpta.resize(num_contacts);
+        d_cptb.resize(num_contacts);
+        d_dpth.resize(num_contacts);
+        d_erad.resize(num_contacts);
+        d_bids.resize(num_contacts);
+        d_contact_keys.resize(num_contacts);
+    }
+    kSphereSphere<<<CONFIG(num_pairs)>>>(num_pairs, d_pairs(), d_id_rigid(), d_start_rigid(), d_sphere_rigid(),
+                                         d_ObA_rigid(), d_pos_rigid(), d_rot_rigid(), envelope, d_contact_counts(),
+                                         NULL, d_contact_keys(), d_norm(), d_cpta(), d_cptb(), d_dpth(), d_erad(),
+                                         (int2*)d_bids());
+    {
+        thrust::device_ptr<long long> keys((long long*)d_contact_keys());
+        auto vals = thrust::make_zip_iterator(
+            thrust::make_tuple(thrust::device_ptr<real3>((real3*)d_norm()), thrust::device_ptr<real3>((real3*)d_cpta()),
+                               thrust::device_ptr<real3>((real3*)d_cptb()), thrust::device_ptr<real>((real*)d_dpth()),
+                               thrust::device_ptr<real>((real*)d_erad()), thrust::device_ptr<int2>((int2*)d_bids())));
+        thrust::sort_by_key(keys, keys + num_contacts, vals);
+    }
+
+    // The one device-to-host transfer: the final contact list.
+    Download(d_norm, norm, num_contacts);
+    Download(d_cpta, cpta, num_contacts);
+    Download(d_cptb, cptb, num_contacts);
+    Download(d_dpth, dpth, num_contacts);
+    Download(d_erad, erad, num_contacts);
+    Download(d_bids, bids, num_contacts);
+    cudaCheck(cudaPeekAtLastError());
+    return num_contacts;
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -0,0 +1,67 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Hammad Mazhar
+// =============================================================================
+//
+// Description: Device resident collision pipeline for sphere shapes. The shape
+// tables are uploaded once (and again only when models are added or removed);
+// per step, only the body states cross the bus on the way in and only the
+// final contact list on the way out. AABB generation, the uniform grid
+// broadphase and the sphere-sphere narrowphase all run as device kernels on
+// device arrays, so no intermediate result (bounding boxes, bin pairs,
+// candidate pairs) ever touches host memory. Combined with
+// SolverType::APGDGPU this keeps every O(num_shapes) phase of a granular
+// simulation on the GPU.
+// =============================================================================
+
+#include <vector>
+
+#include "chrono_parallel/math/real.h"
+#include "chrono_parallel/math/real3.h"
+#include "chrono_parallel/math/real4.h"
+#include "chrono_parallel/math/other_types.h"
+
+namespace chrono {
+namespace collision {
+
+/// Run one collision detection step fully on the device, for a scene whose
+/// rigid shapes are all spheres. The shape tables are re-uploaded only when
+/// shapes_changed is set; dead shape slots (body identifier UINT_MAX) are
+/// skipped on the device. The produced contacts are sorted by the encoded
+/// body pair identifier, matching the host narrowphase convention, and are
+/// downloaded into the given host arrays (the one device-to-host transfer of
+/// the pipeline). Returns the number of contacts.
+uint CollisionPipelineGPU(const uint num_shapes,         ///< number of shape slots (including dead slots)
+                          const bool shapes_changed,     ///< re-upload the shape tables before running
+                          const uint* id_rigid,          ///< body identifier of each shape
+                          const short2* fam_rigid,       ///< family group/mask of each shape
+                          const int* start_rigid,        ///< index of each shape's record in sphere_rigid
+                          const real* sphere_rigid,      ///< sphere radius records
+                          const real3* ObA_rigid,        ///< shape positions relative to the body
+                          const uint num_sphere_records, ///< number of entries in sphere_rigid
+                          const real3* pos_rigid,        ///< body positions
+                          const quaternion* rot_rigid,   ///< body rotations
+                          const char* active_rigid,      ///< body active flags
+                          const char* collide_rigid,     ///< body collide flags
+                          const real envelope,           ///< collision envelope added to each shape
+                          const vec3 bins_per_axis,      ///< broadphase grid resolution
+                          real3& min_bounding_point,     ///< (output) lower corner of the scene AABB
+                          real3& max_bounding_point,     ///< (output) upper corner of the scene AABB
+                          std::vector<real3>& norm,      ///< (output) contact normals
+                          std::vector<real3>& cpta,      ///< (output) contact points on body A
+                          std::vector<real3>& cptb,      ///< (output) contact points on body B
+                          std::vector<real>& dpth,       ///< (output) contact penetration depths
+                          std::vector<real>& erad,       ///< (output) contact effective radii
+                          std::vector<vec2>& bids);      ///< (output) contact body identifier pairs
+
+}  // end namespace collision
+}  // end namespace chrono
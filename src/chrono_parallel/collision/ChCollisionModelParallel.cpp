@@ -40,6 +40,7 @@ int ChCollisionModelParallel::ClearModel() {
 
     local_convex_data.clear();
     mData.clear();
+    shape_slots.clear();
     aabb_min = real3(C_LARGE_REAL);
     aabb_max = real3(-C_LARGE_REAL);
     nObjects = 0;
@@ -199,6 +199,10 @@ class CH_PARALLEL_API ChCollisionModelParallel : public ChCollisionModel {
     std::vector<ConvexModel> mData;
     std::vector<real3> local_convex_data;
 
+    /// Indices of this model's records in the global shape arrays, assigned by
+    /// the collision system when the model is added and recycled on removal.
+    std::vector<int> shape_slots;
+
     real3 aabb_min;
     real3 aabb_max;
 
@@ -20,6 +20,10 @@
 #include "chrono_parallel/collision/ChCollisionSystemParallel.h"
 #include "chrono_parallel/collision/ChCollision.h"
 
+#ifdef CHRONO_PARALLEL_USE_CUDA
+#include "chrono_parallel/collision/ChCollisionGPU.cuh"
+#endif
+
 namespace chrono {
 namespace collision {
 
@@ -27,6 +31,26 @@ ChCollisionSystemParallel::ChCollisionSystemParallel(ChParallelDataManager* dm)
 
 ChCollisionSystemParallel::~ChCollisionSystemParallel() {}
 
+// Append a geometry record, or reuse the record of an identical payload already
+// stored when the shape dictionary is enabled. Returns the record index the
+// shape's 'start' entry should point to. Note that sharing is by value only:
+// shape types that store the same payload layout (e.g. box and cylinder, which
+// both store a real3 in box_like_rigid) may legitimately share a record, since
+// the shape type is carried per shape in typ_rigid.
+template <typename T, typename Map>
+static int InsertShapeRecord(custom_vector<T>& records, Map& dict, const T& value, bool use_dict) {
+    if (use_dict) {
+        typename Map::iterator it = dict.find(value);
+        if (it != dict.end())
+            return it->second;
+    }
+    int start = (int)records.size();
+    records.push_back(value);
+    if (use_dict)
+        dict.insert(std::make_pair(value, start));
+    return start;
+}
+
 void ChCollisionSystemParallel::Add(ChCollisionModel* model) {
     if (model->GetPhysicsItem()->GetCollide() == true) {
         ChCollisionModelParallel* pmodel = static_cast<ChCollisionModelParallel*>(model);
@@ -40,6 +64,10 @@ void ChCollisionSystemParallel::Add(ChCollisionModel* model) {
                                                      pmodel->local_convex_data.begin(),
                                                      pmodel->local_convex_data.end());
 
+        bool use_dict = data_manager->settings.collision.use_shape_dictionary;
+
+        pmodel->shape_slots.clear();
+
         for (int j = 0; j < pmodel->GetNObjects(); j++) {
             real3 obA = pmodel->mData[j].A;
             real3 obB = pmodel->mData[j].B;
@@ -51,40 +79,23 @@ void ChCollisionSystemParallel::Add(ChCollisionModel* model) {
 
             switch (pmodel->mData[j].type) {
                 case chrono::collision::SPHERE:
-                    start = (int)data_manager->shape_data.sphere_rigid.size();
-                    data_manager->shape_data.sphere_rigid.push_back(obB.x);
+                    start = InsertShapeRecord(data_manager->shape_data.sphere_rigid, dict_sphere, obB.x, use_dict);
                     break;
                 case chrono::collision::ELLIPSOID:
-                    start = (int)data_manager->shape_data.box_like_rigid.size();
-                    data_manager->shape_data.box_like_rigid.push_back(obB);
-                    break;
                 case chrono::collision::BOX:
-                    start = (int)data_manager->shape_data.box_like_rigid.size();
-                    data_manager->shape_data.box_like_rigid.push_back(obB);
-                    break;
                 case chrono::collision::CYLINDER:
-                    start = (int)data_manager->shape_data.box_like_rigid.size();
-                    data_manager->shape_data.box_like_rigid.push_back(obB);
-                    break;
                 case chrono::collision::CONE:
-                    start = (int)data_manager->shape_data.box_like_rigid.size();
-                    data_manager->shape_data.box_like_rigid.push_back(obB);
+                    start = InsertShapeRecord(data_manager->shape_data.box_like_rigid, dict_box_like, obB, use_dict);
                     break;
                 case chrono::collision::CAPSULE:
-                    start = (int)data_manager->shape_data.capsule_rigid.size();
-                    data_manager->shape_data.capsule_rigid.push_back(real2(obB.x, obB.y));
+                    start = InsertShapeRecord(data_manager->shape_data.capsule_rigid, dict_capsule,
+                                              real2(obB.x, obB.y), use_dict);
                     break;
                 case chrono::collision::ROUNDEDBOX:
-                    start = (int)data_manager->shape_data.rbox_like_rigid.size();
-                    data_manager->shape_data.rbox_like_rigid.push_back(real4(obB, obC.x));
-                    break;
                 case chrono::collision::ROUNDEDCYL:
-                    start = (int)data_manager->shape_data.rbox_like_rigid.size();
-                    data_manager->shape_data.rbox_like_rigid.push_back(real4(obB, obC.x));
-                    break;
                 case chrono::collision::ROUNDEDCONE:
-                    start = (int)data_manager->shape_data.rbox_like_rigid.size();
-                    data_manager->shape_data.rbox_like_rigid.push_back(real4(obB, obC.x));
+                    start = InsertShapeRecord(data_manager->shape_data.rbox_like_rigid, dict_rbox_like,
+                                              real4(obB, obC.x), use_dict);
                     break;
                 case chrono::collision::CONVEX:
                     start = (int)(obB.y + convex_data_offset);
@@ -98,110 +109,65 @@ void ChCollisionSystemParallel::Add(ChCollisionModel* model) {
                     break;
             }
 
-            data_manager->shape_data.ObA_rigid.push_back(obA);
-            data_manager->shape_data.ObR_rigid.push_back(pmodel->mData[j].R);
-            data_manager->shape_data.start_rigid.push_back(start);
-            data_manager->shape_data.length_rigid.push_back(length);
-
-            data_manager->shape_data.fam_rigid.push_back(fam);
-            data_manager->shape_data.typ_rigid.push_back(pmodel->mData[j].type);
-            data_manager->shape_data.id_rigid.push_back(body_id);
-            data_manager->num_rigid_shapes++;
+            // Reuse a dead slot from the free-list when available; otherwise append
+            // a new slot. Existing slots never move, so adding a model does not
+            // disturb the records of any other model.
+            if (!free_shape_slots.empty()) {
+                int slot = free_shape_slots.back();
+                free_shape_slots.pop_back();
+
+                data_manager->shape_data.ObA_rigid[slot] = obA;
+                data_manager->shape_data.ObR_rigid[slot] = pmodel->mData[j].R;
+                data_manager->shape_data.start_rigid[slot] = start;
+                data_manager->shape_data.length_rigid[slot] = length;
+
+                data_manager->shape_data.fam_rigid[slot] = fam;
+                data_manager->shape_data.typ_rigid[slot] = pmodel->mData[j].type;
+                data_manager->shape_data.id_rigid[slot] = body_id;
+
+                pmodel->shape_slots.push_back(slot);
+            } else {
+                pmodel->shape_slots.push_back((int)data_manager->shape_data.id_rigid.size());
+
+                data_manager->shape_data.ObA_rigid.push_back(obA);
+                data_manager->shape_data.ObR_rigid.push_back(pmodel->mData[j].R);
+                data_manager->shape_data.start_rigid.push_back(start);
+                data_manager->shape_data.length_rigid.push_back(length);
+
+                data_manager->shape_data.fam_rigid.push_back(fam);
+                data_manager->shape_data.typ_rigid.push_back(pmodel->mData[j].type);
+                data_manager->shape_data.id_rigid.push_back(body_id);
+                data_manager->num_rigid_shapes++;
+            }
         }
+        shape_revision++;
     }
 }
 
-#define ERASE_MACRO(x, y) x.erase(x.begin() + y);
-#define ERASE_MACRO_LEN(x, y, z) x.erase(x.begin() + y, x.begin() + y + z);
-
-
 void ChCollisionSystemParallel::Remove(ChCollisionModel* model) {
-#if 0
-	ChCollisionModelParallel* pmodel = static_cast<ChCollisionModelParallel*>(model);
-	int body_id = pmodel->GetBody()->GetId();
-	//loop over the models we nned to remove
-	//std::cout << "removing: " << pmodel->GetNObjects() << " objects" << std::endl;
-	for (int j = 0; j < pmodel->GetNObjects(); j++) {
-		//find a model to remove
-		bool removed = false;
-		for (int i = 0; i < data_manager->shape_data.id_rigid.size(); i++) {
-			if (data_manager->shape_data.id_rigid[i] == body_id) {
-				int index = i;
-				data_manager->num_rigid_shapes--;
-
-				int start = data_manager->shape_data.start_rigid[index];
-				int length = data_manager->shape_data.length_rigid[index];
-				int type = data_manager->shape_data.typ_rigid[index];
-
-				//std::cout << "removing: type " << type << " " << start<< " " <<j << std::endl;
-
-
-				switch (type) {
-				case chrono::collision::SPHERE:
-					ERASE_MACRO_LEN(data_manager->shape_data.sphere_rigid, start, length);
-					break;
-				case chrono::collision::ELLIPSOID:
-					ERASE_MACRO_LEN(data_manager->shape_data.box_like_rigid, start, length);
-					break;
-				case chrono::collision::BOX:
-					ERASE_MACRO_LEN(data_manager->shape_data.box_like_rigid, start, length);
-					break;
-				case chrono::collision::CYLINDER:
-					ERASE_MACRO_LEN(data_manager->shape_data.box_like_rigid, start, length);
-					break;
-				case chrono::collision::CONE:
-					ERASE_MACRO_LEN(data_manager->shape_data.box_like_rigid, start, length);
-					break;
-				case chrono::collision::CAPSULE:
-					ERASE_MACRO_LEN(data_manager->shape_data.capsule_rigid, start, length);
-					break;
-				case chrono::collision::ROUNDEDBOX:
-					ERASE_MACRO_LEN(data_manager->shape_data.rbox_like_rigid, start, length);
-					break;
-				case chrono::collision::ROUNDEDCYL:
-					ERASE_MACRO_LEN(data_manager->shape_data.rbox_like_rigid, start, length);
-					break;
-				case chrono::collision::ROUNDEDCONE:
-					ERASE_MACRO_LEN(data_manager->shape_data.rbox_like_rigid, start, length);
-					break;
-				case chrono::collision::CONVEX:
-					ERASE_MACRO_LEN(data_manager->shape_data.convex_rigid, start, length);
-					break;
-				case chrono::collision::TRIANGLEMESH:
-					ERASE_MACRO_LEN(data_manager->shape_data.convex_rigid, start, 3);
-					break;
-				}
-
-				ERASE_MACRO(data_manager->shape_data.ObA_rigid, index);
-				ERASE_MACRO(data_manager->shape_data.ObR_rigid, index);
-				ERASE_MACRO(data_manager->shape_data.start_rigid, index);
-				ERASE_MACRO(data_manager->shape_data.length_rigid, index);
-
-				ERASE_MACRO(data_manager->shape_data.fam_rigid, index);
-				ERASE_MACRO(data_manager->shape_data.typ_rigid, index);
-				ERASE_MACRO(data_manager->shape_data.id_rigid, index);
-				removed = true;
-				break;
-			}
-		}
-		//std::cout << "decrement start "<< std::endl;
-		if (removed) {
-			//we removed a model, all of the starts are off by one, decrement all starts before removing a second model
-			for (int i = 0; i < data_manager->shape_data.start_rigid.size(); i++) {
-				if (data_manager->shape_data.start_rigid[i] != 0) {
-					data_manager->shape_data.start_rigid[i] -= 1;
-				}
-			}
-		}
-
-	}
-#endif
+    ChCollisionModelParallel* pmodel = static_cast<ChCollisionModelParallel*>(model);
+
+    // Mark this model's slots in the global shape arrays as inactive (the
+    // UINT_MAX body identifier is skipped by the AABB generator and by the
+    // broadphase) and hand them to the free-list for reuse by a later Add().
+    // No other slot moves, so removal is O(shapes of this model) instead of a
+    // recompaction of the global arrays. The geometry payload records
+    // (sphere_rigid, box_like_rigid, ...) are append-only and stay in place;
+    // with the shape dictionary enabled they are shared between shapes anyway.
+    for (int j = 0; j < (int)pmodel->shape_slots.size(); j++) {
+        int slot = pmodel->shape_slots[j];
+        data_manager->shape_data.id_rigid[slot] = UINT_MAX;
+        free_shape_slots.push_back(slot);
+    }
+    pmodel->shape_slots.clear();
+    shape_revision++;
 }
-#undef ERASE_MACRO
-#undef ERASE_MACRO_LEN
 
 void ChCollisionSystemParallel::Run() {
     LOG(INFO) << "ChCollisionSystemParallel::Run()";
+    if (data_manager->settings.collision.device_pipeline && RunDeviceResident())
+        return;
+
     if (data_manager->settings.collision.use_aabb_active) {
         body_active.resize(data_manager->num_rigid_bodies);
         std::fill(body_active.begin(), body_active.end(), false);
@@ -248,6 +214,88 @@ void ChCollisionSystemParallel::Run() {
     data_manager->system_timer.stop("collision_narrow");
 }
 
+bool ChCollisionSystemParallel::RunDeviceResident() {
+#ifdef CHRONO_PARALLEL_USE_CUDA
+    const collision_settings& cs = data_manager->settings.collision;
+    shape_container& shapes = data_manager->shape_data;
+    host_container& host = data_manager->host_data;
+
+    // Eligibility of the scene, independent of the shape tables.
+    if (!cs.fixed_bins || cs.use_aabb_active || cs.use_adaptive_envelope || cs.use_two_level_grid ||
+        cs.use_aabb_refit || cs.use_manifold_cache || cs.max_contacts_per_pair != 0)
+        return false;
+    if (data_manager->num_fluid_bodies != 0 || data_manager->num_fea_tets != 0)
+        return false;
+
+    // Eligibility of the shape tables, re-scanned only when they changed.
+    bool shapes_changed = (device_shape_revision != shape_revision);
+    if (shapes_changed) {
+        device_shape_revision = shape_revision;
+        device_shapes_supported = true;
+        for (uint i = 0; i < (uint)shapes.id_rigid.size(); i++) {
+            if (shapes.id_rigid[i] != UINT_MAX && shapes.typ_rigid[i] != chrono::collision::SPHERE) {
+                device_shapes_supported = false;
+                break;
+            }
+        }
+    }
+    if (!device_shapes_supported)
+        return false;
+
+    data_manager->system_timer.start("collision_broad");
+
+    real3 min_point, max_point;
+    std::vector<real3> norm, cpta, cptb;
+    std::vector<real> dpth, erad;
+    std::vector<vec2> bids;
+    uint num_contacts = CollisionPipelineGPU((uint)shapes.id_rigid.size(), shapes_changed,          //
+                                             shapes.id_rigid.data(), shapes.fam_rigid.data(),       //
+                                             shapes.start_rigid.data(), shapes.sphere_rigid.data(), //
+                                             shapes.ObA_rigid.data(),                               //
+                                             (uint)shapes.sphere_rigid.size(),                      //
+                                             host.pos_rigid.data(), host.rot_rigid.data(),          //
+                                             host.active_rigid.data(), host.collide_rigid.data(),   //
+                                             cs.collision_envelope, cs.bins_per_axis,               //
+                                             min_point, max_point,                                  //
+                                             norm, cpta, cptb, dpth, erad, bids);
+
+    data_manager->measures.collision.rigid_min_bounding_point = min_point;
+    data_manager->measures.collision.rigid_max_bounding_point = max_point;
+    data_manager->measures.collision.min_bounding_point = min_point;
+    data_manager->measures.collision.max_bounding_point = max_point;
+    data_manager->measures.collision.global_origin = min_point;
+    data_manager->system_timer.stop("collision_broad");
+
+    data_manager->system_timer.start("collision_narrow");
+    host.norm_rigid_rigid.resize(num_contacts);
+    host.cpta_rigid_rigid.resize(num_contacts);
+    host.cptb_rigid_rigid.resize(num_contacts);
+    host.dpth_rigid_rigid.resize(num_contacts);
+    host.erad_rigid_rigid.resize(num_contacts);
+    host.bids_rigid_rigid.resize(num_contacts);
+    std::copy(norm.begin(), norm.end(), host.norm_rigid_rigid.begin());
+    std::copy(cpta.begin(), cpta.end(), host.cpta_rigid_rigid.begin());
+    std::copy(cptb.begin(), cptb.end(), host.cptb_rigid_rigid.begin());
+    std::copy(dpth.begin(), dpth.end(), host.dpth_rigid_rigid.begin());
+    std::copy(erad.begin(), erad.end(), host.erad_rigid_rigid.begin());
+    std::copy(bids.begin(), bids.end(), host.bids_rigid_rigid.begin());
+    data_manager->num_rigid_contacts = num_contacts;
+
+    // Phases the device pipeline does not run.
+    host.c_counts_rigid_tet.clear();
+    host.c_counts_rigid_fluid.clear();
+    data_manager->num_rigid_tet_contacts = 0;
+    data_manager->num_rigid_tet_node_contacts = 0;
+    data_manager->num_rigid_fluid_contacts = 0;
+    data_manager->num_fluid_contacts = 0;
+    data_manager->system_timer.stop("collision_narrow");
+
+    return true;
+#else
+    return false;
+#endif
+}
+
 double ChCollisionSystemParallel::GetTimerCollisionBroad() const {
     return data_manager->system_timer.GetTime("collision_broad");
 }
@@ -256,17 +304,30 @@ double ChCollisionSystemParallel::GetTimerCollisionNarrow() const {
     return data_manager->system_timer.GetTime("collision_narrow");
 }
 
+void ChCollisionSystemParallel::ReportContacts(ChContactContainer* mcontactcontainer) {
+    // The contact arrays were filled in place by the narrowphase; apply the
+    // optional contact reduction and update the contact tracking of the
+    // container (both no-ops unless enabled).
+    if (auto container = dynamic_cast<ChContactContainerParallel*>(mcontactcontainer)) {
+        container->ReduceContacts();
+        container->ProcessContactTracking();
+    }
+}
+
 void ChCollisionSystemParallel::GetOverlappingAABB(custom_vector<char>& active_id, real3 Amin, real3 Amax) {
     data_manager->aabb_generator->GenerateAABB();
 #pragma omp parallel for
     for (int i = 0; i < data_manager->shape_data.typ_rigid.size(); i++) {
+        uint id = data_manager->shape_data.id_rigid[i];
+        if (id == UINT_MAX)
+            continue;
         real3 Bmin = data_manager->host_data.aabb_min[i];
         real3 Bmax = data_manager->host_data.aabb_max[i];
 
         bool inContact = (Amin.x <= Bmax.x && Bmin.x <= Amax.x) && (Amin.y <= Bmax.y && Bmin.y <= Amax.y) &&
                          (Amin.z <= Bmax.z && Bmin.z <= Amax.z);
         if (inContact) {
-            active_id[data_manager->shape_data.id_rigid[i]] = true;
+            active_id[id] = true;
         }
     }
 }
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <map>
+
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/physics/ChBody.h"
 
@@ -79,7 +81,9 @@ class CH_PARALLEL_API ChCollisionSystemParallel : public ChCollisionSystem {
     /// will call in sequence the functions BeginAddContact(), AddContact() (x n times),
     /// EndAddContact() of the contact container. But if a special container (say, GPU enabled)
     /// is passed, a more rapid buffer copy might be performed).
-    virtual void ReportContacts(ChContactContainer* mcontactcontainer) override {}
+    /// Here the contact arrays are filled in place by the narrowphase, so the only
+    /// work left is updating the contact tracking of the container (if enabled).
+    virtual void ReportContacts(ChContactContainer* mcontactcontainer) override;
 
     /// After the Run() has completed, you can call this function to
     /// fill a 'proximity container' (container of narrow phase pairs), that is
@@ -122,9 +126,63 @@ class CH_PARALLEL_API ChCollisionSystemParallel : public ChCollisionSystem {
     virtual std::vector<vec2> GetOverlappingPairs();
 
   private:
+    /// Try to run the collision step fully on the device (see
+    /// collision_settings::device_pipeline). Returns false when not compiled
+    /// with CUDA or when the scene uses features the device pipeline does not
+    /// cover (non-sphere shapes, fluid/FEA phases, broadphase extensions), in
+    /// which case the caller falls back to the host pipeline.
+    bool RunDeviceResident();
+
+    /// Lexicographic ordering of real-tuples, used as comparator for the shape
+    /// dictionary maps below.
+    struct RealTupleLess {
+        bool operator()(const real2& a, const real2& b) const {
+            if (a.x != b.x)
+                return a.x < b.x;
+            return a.y < b.y;
+        }
+        bool operator()(const real3& a, const real3& b) const {
+            if (a.x != b.x)
+                return a.x < b.x;
+            if (a.y != b.y)
+                return a.y < b.y;
+            return a.z < b.z;
+        }
+        bool operator()(const real4& a, const real4& b) const {
+            if (a.w != b.w)
+                return a.w < b.w;
+            if (a.x != b.x)
+                return a.x < b.x;
+            if (a.y != b.y)
+                return a.y < b.y;
+            return a.z < b.z;
+        }
+    };
+
     ChParallelDataManager* data_manager;
     custom_vector<char> body_active;
 
+    // Free-list of dead slots in the global shape arrays (entries whose body
+    // identifier is UINT_MAX). Remove() pushes the slots of the removed model
+    // and Add() reuses them before growing the arrays, so neither operation
+    // disturbs the records of other models.
+    std::vector<int> free_shape_slots;
+
+    // Shape revision seen by the device pipeline (compared against the
+    // inherited shape_revision counter, bumped by Add() and Remove()). The
+    // device pipeline caches the shape tables (and its eligibility scan) on
+    // the GPU and refreshes them only when the counter moved.
+    unsigned int device_shape_revision = ~0u;
+    bool device_shapes_supported = false;
+
+    // Shape dictionaries (used only if settings.collision.use_shape_dictionary is
+    // enabled): map each geometry payload to the index of its first record in the
+    // corresponding shape_data array, so identical shapes share a single record.
+    std::map<real, int> dict_sphere;
+    std::map<real3, int, RealTupleLess> dict_box_like;
+    std::map<real2, int, RealTupleLess> dict_capsule;
+    std::map<real4, int, RealTupleLess> dict_rbox_like;
+
     friend class ChSystemParallel;
 };
 
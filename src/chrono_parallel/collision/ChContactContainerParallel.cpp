@@ -12,6 +12,8 @@
 // Authors: Hammad Mazhar
 // =============================================================================
 
+#include <climits>
+
 #include "chrono_parallel/collision/ChContactContainerParallel.h"
 
 #include "chrono/physics/ChSystem.h"
@@ -27,6 +29,9 @@ using namespace geometry;
 ChContactContainerParallel::ChContactContainerParallel(ChParallelDataManager* dc) : data_manager(dc) {
     contactlist_6_6.clear();
     n_added_6_6 = 0;
+    track_contacts = false;
+    tracking_step = 0;
+    event_callback = nullptr;
 }
 
 ChContactContainerParallel::ChContactContainerParallel(const ChContactContainerParallel& other)
@@ -141,4 +146,306 @@ void ChContactContainerParallel::ReportAllContacts(ReportContactCallback* callba
     }
 }
 
+void ChContactContainerParallel::ExtractContacts(std::vector<ContactData>& output, const ContactFilter* filter) {
+    // Readibility
+    auto& ptA = data_manager->host_data.cpta_rigid_rigid;
+    auto& ptB = data_manager->host_data.cptb_rigid_rigid;
+    auto& nrm = data_manager->host_data.norm_rigid_rigid;
+    auto& depth = data_manager->host_data.dpth_rigid_rigid;
+    auto& erad = data_manager->host_data.erad_rigid_rigid;
+    auto& bids = data_manager->host_data.bids_rigid_rigid;
+    const uint num_contacts = data_manager->num_rigid_contacts;
+
+    if (num_contacts == 0)
+        return;
+
+    // Grab the list of bodies.
+    // NOTE: we assume that bodies were added in the order of their IDs!
+    const auto& bodylist = GetSystem()->Get_bodylist();
+
+    // Evaluate the filter on the raw contact arrays and derive the output position of each
+    // matching contact with a prefix sum, so that record construction can run in parallel
+    // and discarded contacts are never expanded into records.
+    std::vector<uint> offset(num_contacts + 1);
+    offset[0] = 0;
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        bool match =
+            !filter || filter->Match(bodylist[bids[i].x].get(), bodylist[bids[i].y].get(), ToChVector(ptA[i]));
+        offset[i + 1] = match ? 1 : 0;
+    }
+    for (uint i = 0; i < num_contacts; i++)
+        offset[i + 1] += offset[i];
+
+    size_t base = output.size();
+    output.resize(base + offset[num_contacts]);
+
+    // Reaction forces are reconstructed from the solver impulses of the last solve
+    // (zero if no solve was performed yet).
+    const DynamicVector<real>& gamma = data_manager->host_data.gamma;
+    const SolverMode solver_mode = data_manager->settings.solver.solver_mode;
+    bool has_reactions = gamma.size() >= num_contacts && data_manager->settings.step_size > 0;
+    real inv_h = has_reactions ? 1 / data_manager->settings.step_size : 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        if (offset[i + 1] == offset[i])
+            continue;
+        ContactData& record = output[base + offset[i]];
+        record.pA = ToChVector(ptA[i]);
+        record.pB = ToChVector(ptB[i]);
+        record.normal = ToChVector(nrm[i]);
+        record.distance = depth[i];
+        record.eff_radius = erad[i];
+        record.react_force = ChVector<>(0);
+        record.react_torque = ChVector<>(0);
+        if (has_reactions) {
+            record.react_force.x() = gamma[i] * inv_h;
+            if (solver_mode == SolverMode::SLIDING || solver_mode == SolverMode::SPINNING) {
+                record.react_force.y() = gamma[num_contacts + i * 2 + 0] * inv_h;
+                record.react_force.z() = gamma[num_contacts + i * 2 + 1] * inv_h;
+            }
+            if (solver_mode == SolverMode::SPINNING) {
+                record.react_torque.x() = gamma[3 * num_contacts + i * 3 + 0] * inv_h;
+                record.react_torque.y() = gamma[3 * num_contacts + i * 3 + 1] * inv_h;
+                record.react_torque.z() = gamma[3 * num_contacts + i * 3 + 2] * inv_h;
+            }
+        }
+        record.objA = bodylist[bids[i].x].get();
+        record.objB = bodylist[bids[i].y].get();
+    }
+}
+
+namespace {
+// Accumulator for one cluster of near-coincident contacts of a body pair.
+struct ContactCluster {
+    real weight;       // sum of the per-contact weights (clamped penetrations)
+    real3 wptA, wptB;  // weighted sums of the contact points
+    real3 wnorm;       // weighted sum of the normals
+    real werad;        // weighted sum of the effective radii
+    real min_depth;    // deepest penetration of the cluster
+    real3 norm_deepest;     // normal of the deepest member (fallback direction)
+    long long pair_deepest; // shape pair id of the deepest member
+    char sphere_deepest;    // sphere-sphere flag of the deepest member
+    uint count;             // number of contacts merged
+};
+}  // namespace
+
+void ChContactContainerParallel::ReduceContacts() {
+    const uint max_per_pair = data_manager->settings.collision.max_contacts_per_pair;
+    uint& num_contacts = data_manager->num_rigid_contacts;
+    if (max_per_pair == 0 || num_contacts == 0)
+        return;
+
+    custom_vector<real3>& nrm = data_manager->host_data.norm_rigid_rigid;
+    custom_vector<real3>& ptA = data_manager->host_data.cpta_rigid_rigid;
+    custom_vector<real3>& ptB = data_manager->host_data.cptb_rigid_rigid;
+    custom_vector<real>& depth = data_manager->host_data.dpth_rigid_rigid;
+    custom_vector<real>& erad = data_manager->host_data.erad_rigid_rigid;
+    custom_vector<vec2>& bids = data_manager->host_data.bids_rigid_rigid;
+    custom_vector<char>& sphere_flags = data_manager->host_data.sphere_rigid_rigid;
+    custom_vector<long long>& pairs = data_manager->host_data.contact_pairs;
+    const bool has_pairs = pairs.size() >= num_contacts;
+
+    // The narrowphase sorts the contacts body-pair-major, so the contacts of each
+    // body pair form a contiguous run. Runs within the cap are copied through;
+    // larger runs are clustered and replaced by their representatives. The write
+    // cursor never passes the read cursor, so the compaction is done in place.
+    std::unordered_map<long long, uint> cluster_of;
+    std::vector<ContactCluster> clusters;
+    uint write = 0;
+    uint start = 0;
+    while (start < num_contacts) {
+        uint end = start + 1;
+        while (end < num_contacts && bids[end].x == bids[start].x && bids[end].y == bids[start].y)
+            end++;
+
+        if (end - start <= max_per_pair) {
+            for (uint i = start; i < end; i++, write++) {
+                if (write == i)
+                    continue;
+                nrm[write] = nrm[i];
+                ptA[write] = ptA[i];
+                ptB[write] = ptB[i];
+                depth[write] = depth[i];
+                erad[write] = erad[i];
+                bids[write] = bids[i];
+                sphere_flags[write] = sphere_flags[i];
+                if (has_pairs)
+                    pairs[write] = pairs[i];
+            }
+            start = end;
+            continue;
+        }
+
+        // Cell size chosen so that a (near-planar) patch splits into roughly
+        // max_per_pair position cells; the normal key separates contacts across
+        // edges of the geometry so they are never merged.
+        real3 lo = ptA[start];
+        real3 hi = ptA[start];
+        for (uint i = start + 1; i < end; i++) {
+            lo = Min(lo, ptA[i]);
+            hi = Max(hi, ptA[i]);
+        }
+        real cell = Max(hi - lo) / Ceil(Sqrt((real)max_per_pair));
+        real inv_cell = cell > 0 ? 1 / cell : 0;
+
+        cluster_of.clear();
+        clusters.clear();
+        for (uint i = start; i < end; i++) {
+            int kx = (int)Round(nrm[i].x * 2);
+            int ky = (int)Round(nrm[i].y * 2);
+            int kz = (int)Round(nrm[i].z * 2);
+            long long key = ((kx + 2) * 5 + (ky + 2)) * 5 + (kz + 2);
+            key = (key << 48) | ((long long)(int)((ptA[i].x - lo.x) * inv_cell) << 32) |
+                  ((long long)(int)((ptA[i].y - lo.y) * inv_cell) << 16) |
+                  (long long)(int)((ptA[i].z - lo.z) * inv_cell);
+
+            real w = Max(-depth[i], (real)1e-6);
+            auto it = cluster_of.find(key);
+            if (it == cluster_of.end()) {
+                cluster_of[key] = (uint)clusters.size();
+                ContactCluster c;
+                c.weight = w;
+                c.wptA = w * ptA[i];
+                c.wptB = w * ptB[i];
+                c.wnorm = w * nrm[i];
+                c.werad = w * erad[i];
+                c.min_depth = depth[i];
+                c.norm_deepest = nrm[i];
+                c.pair_deepest = has_pairs ? pairs[i] : 0;
+                c.sphere_deepest = sphere_flags[i];
+                c.count = 1;
+                clusters.push_back(c);
+            } else {
+                ContactCluster& c = clusters[it->second];
+                c.weight += w;
+                c.wptA += w * ptA[i];
+                c.wptB += w * ptB[i];
+                c.wnorm += w * nrm[i];
+                c.werad += w * erad[i];
+                if (depth[i] < c.min_depth) {
+                    c.min_depth = depth[i];
+                    c.norm_deepest = nrm[i];
+                    c.pair_deepest = has_pairs ? pairs[i] : 0;
+                    c.sphere_deepest = sphere_flags[i];
+                }
+                c.count++;
+            }
+        }
+
+        vec2 pair_bids = bids[start];
+        for (uint k = 0; k < (uint)clusters.size(); k++, write++) {
+            const ContactCluster& c = clusters[k];
+            real inv_w = 1 / c.weight;
+            real3 n = c.wnorm * inv_w;
+            real len = Length(n);
+            // Keep the representative contact, at the depth-weighted centroid of
+            // the cluster and with the deepest penetration, so that a uniform
+            // pressure patch maps to the same net wrench.
+            nrm[write] = len > 0 ? n / len : c.norm_deepest;
+            ptA[write] = c.wptA * inv_w;
+            ptB[write] = c.wptB * inv_w;
+            depth[write] = c.min_depth;
+            erad[write] = c.werad * inv_w;
+            bids[write] = pair_bids;
+            sphere_flags[write] = c.count == 1 ? c.sphere_deepest : 0;
+            if (has_pairs)
+                pairs[write] = c.pair_deepest;
+        }
+        start = end;
+    }
+
+    if (write == num_contacts)
+        return;
+
+    num_contacts = write;
+    nrm.resize(write);
+    ptA.resize(write);
+    ptB.resize(write);
+    depth.resize(write);
+    erad.resize(write);
+    bids.resize(write);
+    sphere_flags.resize(write);
+    if (has_pairs)
+        pairs.resize(write);
+}
+
+void ChContactContainerParallel::ProcessContactTracking() {
+    if (!track_contacts)
+        return;
+
+    const custom_vector<long long>& pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<real3>& ptA = data_manager->host_data.cpta_rigid_rigid;
+    const custom_vector<real3>& nrm = data_manager->host_data.norm_rigid_rigid;
+    const uint num_contacts = data_manager->num_rigid_contacts;
+
+    // The per-contact pair ids are kept by the parallel narrowphase only; with the
+    // Bullet-based collision system the contact arrays are not tagged and no
+    // matching is possible.
+    if (pairs.size() < num_contacts)
+        return;
+
+    born_contacts.clear();
+    dead_contacts.clear();
+
+    std::vector<TrackedContact> alive;
+    alive.reserve(num_contacts);
+    std::unordered_map<long long, std::vector<uint>> alive_map;
+    std::unordered_map<long long, uint> feature_count;
+    std::vector<char> matched(tracked_contacts.size(), 0);
+
+    for (uint i = 0; i < num_contacts; i++) {
+        long long pair = pairs[i];
+        // The feature is the ordinal of the contact within its shape pair, in
+        // contact array order (stable across steps in deterministic mode).
+        uint feature = feature_count[pair]++;
+
+        uint old_index = UINT_MAX;
+        auto it = tracked_map.find(pair);
+        if (it != tracked_map.end() && feature < it->second.size())
+            old_index = it->second[feature];
+
+        TrackedContact tc;
+        if (old_index != UINT_MAX && matched[old_index] == 0) {
+            // The contact persists: carry its record over and accumulate the
+            // tangential motion of the contact point as slip.
+            tc = tracked_contacts[old_index];
+            matched[old_index] = 1;
+            real3 delta = ptA[i] - tc.point;
+            tc.accumulated_slip += Length(delta - Dot(delta, nrm[i]) * nrm[i]);
+        } else {
+            tc.pair = pair;
+            tc.feature = feature;
+            tc.birth_step = tracking_step;
+            tc.accumulated_slip = 0;
+            born_contacts.push_back((uint)alive.size());
+        }
+        tc.index = i;
+        tc.point = ptA[i];
+
+        std::vector<uint>& slots = alive_map[pair];
+        if (slots.size() <= feature)
+            slots.resize(feature + 1, UINT_MAX);
+        slots[feature] = (uint)alive.size();
+        alive.push_back(tc);
+    }
+
+    for (uint i = 0; i < (uint)tracked_contacts.size(); i++) {
+        if (matched[i] == 0)
+            dead_contacts.push_back(tracked_contacts[i]);
+    }
+
+    tracked_contacts.swap(alive);
+    tracked_map.swap(alive_map);
+    tracking_step++;
+
+    if (event_callback) {
+        for (uint i = 0; i < (uint)born_contacts.size(); i++)
+            event_callback->OnContactBirth(tracked_contacts[born_contacts[i]]);
+        for (uint i = 0; i < (uint)dead_contacts.size(); i++)
+            event_callback->OnContactDeath(dead_contacts[i]);
+    }
+}
+
 }  // end namespace chrono
@@ -15,6 +15,8 @@
 #pragma once
 
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactTuple.h"
@@ -66,6 +68,75 @@ class CH_PARALLEL_API ChContactContainerParallel : public ChContactContainer {
     /// Note: currently, the contact reaction force and torque are not set (always zero).
     virtual void ReportAllContacts(ReportContactCallback* callback) override;
 
+    /// Bulk extraction of contact data (see ChContactContainer::ExtractContacts).
+    /// The filter is evaluated OpenMP-parallel directly on the contact arrays of the data
+    /// manager, so contacts it discards are never expanded into records. The reaction force
+    /// (and torque, with SolverMode::SPINNING) is reconstructed from the solver impulses of
+    /// the last solve, expressed in the contact plane coordinate system; zero if no solve
+    /// was performed yet.
+    virtual void ExtractContacts(std::vector<ContactData>& output, const ContactFilter* filter = nullptr) override;
+
+    /// Persistent identity and statistics of a contact matched across steps
+    /// (see SetTrackContacts).
+    struct TrackedContact {
+        long long pair;         ///< encoded shape pair id, as produced by the broadphase
+        uint feature;           ///< ordinal of the contact within its shape pair
+        uint index;             ///< index in the contact arrays at the last step seen
+        uint birth_step;        ///< value of the tracking step counter at first sight
+        real accumulated_slip;  ///< accumulated tangential motion of the contact point
+        real3 point;            ///< contact point on body A at the last step seen (global frame)
+    };
+
+    /// Callback interface for contact birth/death events (see SetTrackContacts).
+    class ContactEventCallback {
+      public:
+        virtual ~ContactEventCallback() {}
+        /// Called once for each contact that appeared on the current step.
+        virtual void OnContactBirth(const TrackedContact& contact) {}
+        /// Called once for each contact that disappeared on the current step.
+        /// The record holds the state of the contact at the last step it was alive.
+        virtual void OnContactDeath(const TrackedContact& contact) {}
+    };
+
+    /// Enable matching of contacts across steps (default: false).
+    /// Contacts are identified by the shape pair id produced by the broadphase plus
+    /// the ordinal of the contact within its pair (the feature, stable for compound
+    /// shapes and multi-contact kernels when the deterministic setting is enabled),
+    /// so a contact that persists keeps its record, its age and its accumulated
+    /// tangential slip across steps. Only supported with the parallel collision
+    /// system, whose narrowphase keeps the pair id of each contact.
+    void SetTrackContacts(bool val) { track_contacts = val; }
+
+    /// Register a callback object invoked on contact birth/death events.
+    void RegisterContactEventCallback(ContactEventCallback* callback) { event_callback = callback; }
+
+    /// Reduce the contact set of body pairs exceeding max_contacts_per_pair (see
+    /// ChSettings.h): their contacts are clustered by normal direction and by
+    /// position on a grid over the contact patch, and each cluster is replaced
+    /// with one representative contact at the depth-weighted centroid, carrying
+    /// the deepest penetration of the cluster. Called once per step by the
+    /// parallel collision system, after the narrowphase and before contact
+    /// tracking; a no-op when the cap is 0.
+    void ReduceContacts();
+
+    /// Match the contacts of the current step against the tracked set, update the
+    /// per-contact statistics, and fire the birth/death events. Called once per
+    /// step by the parallel collision system when tracking is enabled; a no-op
+    /// otherwise.
+    void ProcessContactTracking();
+
+    /// Return the tracked contacts alive on the current step, in contact array order.
+    const std::vector<TrackedContact>& GetTrackedContacts() const { return tracked_contacts; }
+
+    /// Return the indices (into GetTrackedContacts) of the contacts born on the
+    /// current step. Together with GetContactsDied this is an incremental diff of
+    /// the contact set: contacts in neither list persist unchanged in identity.
+    const std::vector<uint>& GetContactsBorn() const { return born_contacts; }
+
+    /// Return the records of the contacts that disappeared on the current step,
+    /// in the state they had at the last step they were alive.
+    const std::vector<TrackedContact>& GetContactsDied() const { return dead_contacts; }
+
     /// Return the list of contacts between rigid bodies
     const std::list<ChContact_6_6*>& GetContactList() const { return contactlist_6_6; }
 
@@ -75,6 +146,15 @@ class CH_PARALLEL_API ChContactContainerParallel : public ChContactContainer {
     int n_added_6_6;
     std::list<ChContact_6_6*> contactlist_6_6;
     std::list<ChContact_6_6*>::iterator lastcontact_6_6;
+
+    bool track_contacts;                     ///< match contacts across steps?
+    uint tracking_step;                      ///< number of tracking updates performed
+    ContactEventCallback* event_callback;    ///< birth/death event callback (optional)
+    std::vector<TrackedContact> tracked_contacts;  ///< tracked contacts alive on the current step
+    std::vector<uint> born_contacts;               ///< indices of the contacts born on the current step
+    std::vector<TrackedContact> dead_contacts;     ///< contacts that died on the current step
+    /// Lookup from shape pair id to the tracked indices of its contacts, by feature.
+    std::unordered_map<long long, std::vector<uint>> tracked_map;
 };
 
 /// @} parallel_colision
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <vector>
 
 #include "chrono/collision/ChCCollisionModel.h"
 #include "chrono/collision/ChCCollisionInfo.h"
@@ -201,23 +202,99 @@ void ChCNarrowphaseDispatch::DispatchMPR() {
     custom_vector<real>& contactDepth = data_manager->host_data.dpth_rigid_rigid;
     custom_vector<real>& effective_radius = data_manager->host_data.erad_rigid_rigid;
 
+    const custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<real3>& pos_global = data_manager->shape_data.obj_data_A_global;
+    const custom_vector<quaternion>& rot_global = data_manager->shape_data.obj_data_R_global;
+
+    const bool use_cache = data_manager->settings.collision.use_manifold_cache;
+    const real pos_tol = data_manager->settings.collision.manifold_cache_position_tol;
+    const real rot_tol = data_manager->settings.collision.manifold_cache_rotation_tol;
+
+    // Per-pair staging area for the entries of the rebuilt manifold cache; the parallel
+    // loop below only reads the cache of the previous step, so no locking is needed.
+    std::vector<ManifoldCacheEntry> cache_entries;
+    if (use_cache)
+        cache_entries.resize(num_potential_rigid_contacts);
+
     ConvexShape shapeA;
     ConvexShape shapeB;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    const bool adaptive_envelope = data_manager->settings.collision.use_adaptive_envelope;
+    const real* body_envelope = adaptive_envelope ? data_manager->host_data.env_rigid.data() : nullptr;
+
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
-        if (MPRCollision(&shapeA, &shapeB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
-                         contactDepth[icoll])) {
+        // Each body contributes its own (possibly speed-scaled) envelope; MPR
+        // inflates both shapes by the same amount, so split the sum evenly.
+        const real envelope =
+            adaptive_envelope ? 0.5 * (body_envelope[ID_A] + body_envelope[ID_B]) : collision_envelope;
+
+        if (use_cache) {
+            const real3& posA = pos_global[shapeA.index];
+            const real3& posB = pos_global[shapeB.index];
+            const quaternion& rotA = rot_global[shapeA.index];
+            const quaternion& rotB = rot_global[shapeB.index];
+
+            // Reuse the cached result if both shapes moved less than the tolerances
+            // since the cached evaluation. The reference transforms of a reused entry
+            // are NOT updated, so a slowly drifting pair is re-evaluated as soon as
+            // its cumulative motion exceeds the tolerances.
+            auto cached = manifold_cache.find(contact_pairs[index]);
+            if (cached != manifold_cache.end() &&                                     //
+                Length2(posA - cached->second.posA) < pos_tol &&                      //
+                Length2(posB - cached->second.posB) < pos_tol &&                      //
+                1 - Abs(Dot(rotA, cached->second.rotA)) < rot_tol &&                  //
+                1 - Abs(Dot(rotB, cached->second.rotB)) < rot_tol) {
+                cache_entries[index] = cached->second;
+                if (cached->second.active) {
+                    norm[icoll] = cached->second.norm;
+                    ptA[icoll] = cached->second.ptA;
+                    ptB[icoll] = cached->second.ptB;
+                    contactDepth[icoll] = cached->second.depth;
+                    effective_radius[icoll] = default_eff_radius;
+                    Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+                }
+                continue;
+            }
+        }
+
+        bool hit = MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll],
+                                contactDepth[icoll]);
+        if (hit) {
             effective_radius[icoll] = default_eff_radius;
             // The number of contacts reported by MPR is always 1.
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
         }
+
+        if (use_cache) {
+            ManifoldCacheEntry& entry = cache_entries[index];
+            entry.posA = pos_global[shapeA.index];
+            entry.posB = pos_global[shapeB.index];
+            entry.rotA = rot_global[shapeA.index];
+            entry.rotB = rot_global[shapeB.index];
+            entry.active = hit;
+            if (hit) {
+                entry.norm = norm[icoll];
+                entry.ptA = ptA[icoll];
+                entry.ptB = ptB[icoll];
+                entry.depth = contactDepth[icoll];
+            }
+        }
+    }
+
+    // Rebuild the cache from the staged entries; pairs no longer reported by the
+    // broadphase are dropped here.
+    if (use_cache) {
+        manifold_cache.clear();
+        manifold_cache.reserve(num_potential_rigid_contacts);
+        for (int index = 0; index < (signed)num_potential_rigid_contacts; index++)
+            manifold_cache[contact_pairs[index]] = cache_entries[index];
     }
 }
 
@@ -228,21 +305,85 @@ void ChCNarrowphaseDispatch::DispatchR() {
     real* contactDepth = data_manager->host_data.dpth_rigid_rigid.data();
     real* effective_radius = data_manager->host_data.erad_rigid_rigid.data();
 
-    ConvexShape shapeA;
-    ConvexShape shapeB;
-
+    const custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<int>& typ_rigid = data_manager->shape_data.typ_rigid;
+
+    // Bucket the candidate pairs by shape-type pair so that each bucket runs as
+    // a tight homogeneous loop. Within a bucket the kernel is known up front:
+    // the sphere-sphere bucket (the hotspot of granular problems) calls the
+    // analytic kernel directly with no per-iteration dispatch, and in the
+    // remaining buckets the type tests inside RCollision resolve identically
+    // for every iteration, so the branches are perfectly predicted.
+    uint n = num_potential_rigid_contacts;
+    const bool adaptive_envelope = data_manager->settings.collision.use_adaptive_envelope;
+    const real* body_envelope = adaptive_envelope ? data_manager->host_data.env_rigid.data() : nullptr;
+    dispatch_keys.resize(n);
+    dispatch_indices.resize(n);
+#pragma omp parallel for
+    for (int index = 0; index < (signed)n; index++) {
+        long long p = contact_pairs[index];
+        dispatch_keys[index] = ((uint)typ_rigid[int(p >> 32)] << 8) | (uint)typ_rigid[int(p & 0xffffffff)];
+        dispatch_indices[index] = (uint)index;
+    }
+    Thrust_Sort_By_Key(dispatch_keys, dispatch_indices);
+
+    const uint key_sphere_sphere = ((uint)SPHERE << 8) | (uint)SPHERE;
+
+    uint start = 0;
+    while (start < n) {
+        uint key = dispatch_keys[start];
+        uint end = start + 1;
+        while (end < n && dispatch_keys[end] == key)
+            end++;
+
+        if (key == key_sphere_sphere) {
+            // Shape data is loaded directly from the flat arrays; no ConvexShape
+            // virtual calls and no dispatch chain in the loop body.
+            const custom_vector<uint>& obj_data_ID = data_manager->shape_data.id_rigid;
+            const custom_vector<real3>& pos_global = data_manager->shape_data.obj_data_A_global;
+            const custom_vector<real3>& pos_local = data_manager->shape_data.ObA_rigid;
+            const custom_vector<real>& sphere_radius = data_manager->shape_data.sphere_rigid;
+            const custom_vector<int>& start_rigid = data_manager->shape_data.start_rigid;
+            custom_vector<char>& sphere_flags = data_manager->host_data.sphere_rigid_rigid;
+            const real default_separation = 2 * collision_envelope;
+#pragma omp parallel for
+            for (int s = (signed)start; s < (signed)end; s++) {
+                uint index = dispatch_indices[s];
+                long long p = contact_pairs[index];
+                vec2 pair = I2(int(p >> 32), int(p & 0xffffffff));
+                uint icoll = contact_index[index];
+                const real separation = adaptive_envelope
+                                            ? body_envelope[obj_data_ID[pair.x]] + body_envelope[obj_data_ID[pair.y]]
+                                            : default_separation;
+                if (sphere_sphere(pos_global[pair.x], sphere_radius[start_rigid[pair.x]], pos_global[pair.y],
+                                  sphere_radius[start_rigid[pair.y]], separation, norm[icoll], contactDepth[icoll],
+                                  ptA[icoll], ptB[icoll], effective_radius[icoll])) {
+                    // Flag the contact for the closed-form jacobian build, valid only
+                    // when both spheres are centered at their body frame origin.
+                    sphere_flags[icoll] = IsZero(pos_local[pair.x]) && IsZero(pos_local[pair.y]);
+                    Dispatch_Finalize(icoll, obj_data_ID[pair.x], obj_data_ID[pair.y], 1);
+                }
+            }
+        } else {
+            ConvexShape shapeA;
+            ConvexShape shapeB;
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
-        uint ID_A, ID_B, icoll;
+            for (int s = (signed)start; s < (signed)end; s++) {
+                uint ID_A, ID_B, icoll;
 
-        int nC;
+                int nC;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+                Dispatch_Init(dispatch_indices[s], icoll, ID_A, ID_B, &shapeA, &shapeB);
 
-        if (RCollision(&shapeA, &shapeB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
-                       &contactDepth[icoll], &effective_radius[icoll], nC)) {
-            Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+                const real separation =
+                    adaptive_envelope ? body_envelope[ID_A] + body_envelope[ID_B] : 2 * collision_envelope;
+                if (RCollision(&shapeA, &shapeB, separation, &norm[icoll], &ptA[icoll], &ptB[icoll],
+                               &contactDepth[icoll], &effective_radius[icoll], nC)) {
+                    Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+                }
+            }
         }
+        start = end;
     }
 }
 
@@ -258,6 +399,9 @@ void ChCNarrowphaseDispatch::DispatchHybridMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    const bool adaptive_envelope = data_manager->settings.collision.use_adaptive_envelope;
+    const real* body_envelope = adaptive_envelope ? data_manager->host_data.env_rigid.data() : nullptr;
+
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
@@ -266,10 +410,12 @@ void ChCNarrowphaseDispatch::DispatchHybridMPR() {
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
-        if (RCollision(&shapeA, &shapeB, 2 * collision_envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
+        const real envelope =
+            adaptive_envelope ? 0.5 * (body_envelope[ID_A] + body_envelope[ID_B]) : collision_envelope;
+        if (RCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll],
                        &contactDepth[icoll], &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
-        } else if (MPRCollision(&shapeA, &shapeB, collision_envelope, norm[icoll], ptA[icoll], ptB[icoll],
+        } else if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll],
                                 contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
@@ -287,6 +433,7 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     custom_vector<real>& dpth_data = data_manager->host_data.dpth_rigid_rigid;
     custom_vector<real>& erad_data = data_manager->host_data.erad_rigid_rigid;
     custom_vector<vec2>& bids_data = data_manager->host_data.bids_rigid_rigid;
+    custom_vector<char>& sphere_data = data_manager->host_data.sphere_rigid_rigid;
     custom_vector<long long>& contact_pairs = data_manager->host_data.contact_pairs;
     uint& num_rigid_contacts = data_manager->num_rigid_contacts;
     // Set maximum possible number of contacts for each potential collision
@@ -300,13 +447,28 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     Thrust_Exclusive_Scan(contact_index);
     int num_potentialContacts = contact_index.back();
 
-    // Create storage to hold maximum number of contacts in worse case
+    // Create storage to hold maximum number of contacts in worse case.
+    // Reserve ahead of the decayed peak of past counts (with headroom), so
+    // that steps with growing contact counts do not pay reallocate-and-copy
+    // for every array right when the narrowphase gets more expensive anyway.
+    estimated_potential_contacts = Max((double)num_potentialContacts, 0.9 * estimated_potential_contacts);
+    size_t reserve_n = (size_t)(1.5 * estimated_potential_contacts);
+    reserve_geometric(norm_data, reserve_n);
+    reserve_geometric(cpta_data, reserve_n);
+    reserve_geometric(cptb_data, reserve_n);
+    reserve_geometric(dpth_data, reserve_n);
+    reserve_geometric(erad_data, reserve_n);
+    reserve_geometric(bids_data, reserve_n);
+    reserve_geometric(sphere_data, reserve_n);
+    reserve_geometric(contact_rigid_active, reserve_n);
     norm_data.resize(num_potentialContacts);
     cpta_data.resize(num_potentialContacts);
     cptb_data.resize(num_potentialContacts);
     dpth_data.resize(num_potentialContacts);
     erad_data.resize(num_potentialContacts);
     bids_data.resize(num_potentialContacts);
+    sphere_data.resize(num_potentialContacts);
+    thrust::fill(sphere_data.begin(), sphere_data.end(), 0);
 
     // These flags will keep track of which collision pairs are actually active
     // (as decided by the narrowphase algorithm).
@@ -331,9 +493,10 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     thrust::remove_if(
         thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
                                                      dpth_data.begin(), erad_data.begin(), bids_data.begin(),
-                                                     contact_pairs.begin())),
+                                                     sphere_data.begin(), contact_pairs.begin())),
         thrust::make_zip_iterator(thrust::make_tuple(norm_data.end(), cpta_data.end(), cptb_data.end(), dpth_data.end(),
-                                                     erad_data.end(), bids_data.end(), contact_pairs.end())),
+                                                     erad_data.end(), bids_data.end(), sphere_data.end(),
+                                                     contact_pairs.end())),
         contact_rigid_active.begin(), thrust::logical_not<bool>());
 
     // Resize all lists so that we don't access invalid contacts
@@ -343,7 +506,62 @@ void ChCNarrowphaseDispatch::DispatchRigid() {
     dpth_data.resize(num_rigid_contacts);
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
+    sphere_data.resize(num_rigid_contacts);
     contact_pairs.resize(num_rigid_contacts);
+
+    // Contact-quality feedback for envelope tuning: slots the narrowphase left
+    // empty come from broadphase candidates that produced no contact (envelope
+    // or bounding boxes too fat), while contacts already deeper than the pair
+    // envelope were detected late (envelope too small for the impact speed).
+    data_manager->measures.collision.number_of_ghost_slots = (uint)num_potentialContacts - num_rigid_contacts;
+    {
+        const bool adaptive_envelope = data_manager->settings.collision.use_adaptive_envelope;
+        const real* body_envelope = adaptive_envelope ? data_manager->host_data.env_rigid.data() : nullptr;
+        int num_deep = 0;
+#pragma omp parallel for reduction(+ : num_deep)
+        for (int i = 0; i < (signed)num_rigid_contacts; i++) {
+            real pair_env = adaptive_envelope ? body_envelope[bids_data[i].x] + body_envelope[bids_data[i].y]
+                                              : 2 * collision_envelope;
+            if (dpth_data[i] < -pair_env)
+                num_deep++;
+        }
+        data_manager->measures.collision.number_of_deep_contacts = (uint)num_deep;
+    }
+
+    // Sort the surviving contacts by their body pair, body-major. Narrowphase
+    // produces contacts in broadphase bin order, so the jacobian blocks built
+    // from these lists would address body data in an essentially random
+    // pattern; after this sort, contacts referencing the same body A (and,
+    // within it, the same body B) are contiguous, the sparsity pattern of D is
+    // banded and the Shur product streams body data (near-)sequentially.
+    estimated_rigid_contacts = Max((double)num_rigid_contacts, 0.9 * estimated_rigid_contacts);
+    if (num_rigid_contacts > 1) {
+        reserve_geometric(contact_sort_keys, (size_t)(1.5 * estimated_rigid_contacts));
+        contact_sort_keys.resize(num_rigid_contacts);
+#pragma omp parallel for
+        for (int i = 0; i < (signed)num_rigid_contacts; i++) {
+            contact_sort_keys[i] = ((long long)bids_data[i].x << 32) | (long long)bids_data[i].y;
+        }
+        // In deterministic mode the sort must be stable: contacts between the same
+        // body pair (compound shapes, multi-contact kernels) share a key and an
+        // unstable sort breaks their tie in thread-dependent order. The input order
+        // is deterministic (broadphase bin order), so a stable sort pins the final
+        // contact list bitwise across runs and thread counts.
+        if (data_manager->settings.deterministic) {
+            thrust::stable_sort_by_key(
+                THRUST_PAR contact_sort_keys.begin(), contact_sort_keys.end(),
+                thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
+                                                             dpth_data.begin(), erad_data.begin(), bids_data.begin(),
+                                                             sphere_data.begin(), contact_pairs.begin())));
+        } else {
+            thrust::sort_by_key(
+                THRUST_PAR contact_sort_keys.begin(), contact_sort_keys.end(),
+                thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
+                                                             dpth_data.begin(), erad_data.begin(), bids_data.begin(),
+                                                             sphere_data.begin(), contact_pairs.begin())));
+        }
+    }
+
     LOG(TRACE) << "ChCNarrowphaseDispatch::DispatchRigid() E " << num_rigid_contacts;
 }
 
@@ -60,6 +60,20 @@ void ChConstraintBilateral::Build_D() {
 
     const CompressedMatrix<real>& M_inv = data_manager->host_data.M_inv;
 
+    // Prepare the cache of body-body Jacobian values, if enabled. Entries whose
+    // constraint slot or body ids changed (topology change) are refreshed below.
+    const real cache_threshold = data_manager->settings.solver.bilateral_jacobian_cache_threshold;
+    const bool use_cache = cache_threshold > 0;
+    if (use_cache && cache_cntr.size() != data_manager->num_bilaterals) {
+        cache_vals.resize(data_manager->num_bilaterals * 12);
+        cache_cntr.assign(data_manager->num_bilaterals, -1);
+        cache_ids.resize(data_manager->num_bilaterals);
+        cache_pos[0].resize(data_manager->num_bilaterals);
+        cache_pos[1].resize(data_manager->num_bilaterals);
+        cache_rot[0].resize(data_manager->num_bilaterals);
+        cache_rot[1].resize(data_manager->num_bilaterals);
+    }
+
     //#pragma omp parallel for
     for (int index = 0; index < (signed)data_manager->num_bilaterals; index++) {
         int cntr = data_manager->host_data.bilateral_mapping[index];
@@ -75,6 +89,42 @@ void ChConstraintBilateral::Build_D() {
                 int colA = idA * 6;
                 int colB = idB * 6;
 
+                if (use_cache) {
+                    real* cached = &cache_vals[index * 12];
+                    // Re-use the cached entries if this row still maps to the same
+                    // constraint and bodies and neither body moved past the threshold.
+                    bool hit = cache_cntr[index] == cntr && cache_ids[index].x == idA && cache_ids[index].y == idB;
+                    if (hit) {
+                        const quaternion& rotA = data_manager->host_data.rot_rigid[idA];
+                        const quaternion& rotB = data_manager->host_data.rot_rigid[idB];
+                        hit = Length(data_manager->host_data.pos_rigid[idA] - cache_pos[0][index]) +
+                                      Abs(rotA.w - cache_rot[0][index].w) + Abs(rotA.x - cache_rot[0][index].x) +
+                                      Abs(rotA.y - cache_rot[0][index].y) + Abs(rotA.z - cache_rot[0][index].z) <
+                                  cache_threshold &&
+                              Length(data_manager->host_data.pos_rigid[idB] - cache_pos[1][index]) +
+                                      Abs(rotB.w - cache_rot[1][index].w) + Abs(rotB.x - cache_rot[1][index].x) +
+                                      Abs(rotB.y - cache_rot[1][index].y) + Abs(rotB.z - cache_rot[1][index].z) <
+                                  cache_threshold;
+                    }
+                    if (!hit) {
+                        for (int k = 0; k < 6; k++) {
+                            cached[k] = mbilateral->Get_Cq_a()->GetElementN(k);
+                            cached[6 + k] = mbilateral->Get_Cq_b()->GetElementN(k);
+                        }
+                        cache_cntr[index] = cntr;
+                        cache_ids[index] = vec2(idA, idB);
+                        cache_pos[0][index] = data_manager->host_data.pos_rigid[idA];
+                        cache_pos[1][index] = data_manager->host_data.pos_rigid[idB];
+                        cache_rot[0][index] = data_manager->host_data.rot_rigid[idA];
+                        cache_rot[1][index] = data_manager->host_data.rot_rigid[idB];
+                    }
+                    for (int k = 0; k < 6; k++) {
+                        D_b_T(row, colA + k) = cached[k];
+                        D_b_T(row, colB + k) = cached[6 + k];
+                    }
+                    break;
+                }
+
                 D_b_T(row, colA + 0) = mbilateral->Get_Cq_a()->GetElementN(0);
                 D_b_T(row, colA + 1) = mbilateral->Get_Cq_a()->GetElementN(1);
                 D_b_T(row, colA + 2) = mbilateral->Get_Cq_a()->GetElementN(2);
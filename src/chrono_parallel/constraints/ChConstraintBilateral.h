@@ -46,6 +46,22 @@ class CH_PARALLEL_API ChConstraintBilateral {
     void GenerateSparsity();
 
     ChParallelDataManager* data_manager;  ///< Pointer to the system's data manager.
+
+  private:
+    // Cache of the Jacobian values of body-body bilateral constraints, used by
+    // Build_D when settings.solver.bilateral_jacobian_cache_threshold > 0.
+    // For each bilateral row we keep the 12 Jacobian entries together with the
+    // constraint slot, the two body ids, and the body poses at the time the
+    // entries were read. Rows whose bodies moved less than the threshold since
+    // then are rewritten from this contiguous storage instead of re-reading the
+    // scattered ChConstraint objects. Note that only the values are cached; the
+    // sparsity pattern is still regenerated every step since the compressed
+    // matrix is cleared before assembly.
+    custom_vector<real> cache_vals;    ///< 12 Jacobian entries per bilateral row
+    custom_vector<int> cache_cntr;     ///< constraint slot at caching time (-1: invalid)
+    custom_vector<vec2> cache_ids;     ///< body ids at caching time
+    custom_vector<real3> cache_pos[2]; ///< body positions at caching time
+    custom_vector<quaternion> cache_rot[2];  ///< body rotations at caching time
 };
 
 /// @} parallel_constraint
@@ -479,6 +479,11 @@ void ChConstraintRigidRigid::Build_D() {
 
     const std::vector<std::shared_ptr<ChBody>>* body_list = data_manager->body_list;
 
+    // Per-contact flags set by the narrowphase for contacts between two
+    // origin-centered spheres (the entirety of a granular scene).
+    const custom_vector<char>& sphere_contact = data_manager->host_data.sphere_rigid_rigid;
+    bool has_sphere_flags = sphere_contact.size() == data_manager->num_rigid_contacts;
+
 #pragma omp parallel for
     for (int index = 0; index < (signed)data_manager->num_rigid_contacts; index++) {
         real3 U = norm[index], V, W;
@@ -499,6 +504,50 @@ void ChConstraintRigidRigid::Build_D() {
         quaternion q_a = quat_a[index];
         quaternion q_b = quat_b[index];
 
+        if (has_sphere_flags && sphere_contact[index]) {
+            // Closed-form jacobian for a sphere-sphere contact: the lever arms are
+            // parallel to the contact normal (sbar_a = r_a * U_A, sbar_b = -r_b * U_B),
+            // so the angular block of the normal row vanishes and the angular blocks
+            // of the tangential rows reduce to scaled rotated tangent directions,
+            // skipping all six cross products of the generic path.
+            real r_a = Length(sbar_a.v);
+            real r_b = Length(sbar_b.v);
+
+            SetRow6Check(D_T, off + row * 1 + 0, body_id.x * 6, -U, real3(0));
+            SetRow6Check(D_T, off + row * 1 + 0, body_id.y * 6, U, real3(0));
+
+            if (solver_mode == SolverMode::SLIDING || solver_mode == SolverMode::SPINNING) {
+                off = data_manager->num_rigid_contacts;
+
+                real3 V_A = Rotate(V, q_a);
+                real3 W_A = Rotate(W, q_a);
+                real3 V_B = Rotate(V, q_b);
+                real3 W_B = Rotate(W, q_b);
+
+                SetRow6Check(D_T, off + row * 2 + 0, body_id.x * 6, -V, -r_a * W_A);
+                SetRow6Check(D_T, off + row * 2 + 1, body_id.x * 6, -W, r_a * V_A);
+
+                SetRow6Check(D_T, off + row * 2 + 0, body_id.y * 6, V, -r_b * W_B);
+                SetRow6Check(D_T, off + row * 2 + 1, body_id.y * 6, W, r_b * V_B);
+
+                if (solver_mode == SolverMode::SPINNING) {
+                    off = 3 * data_manager->num_rigid_contacts;
+
+                    real3 U_A = Rotate(U, q_a);
+                    real3 U_B = Rotate(U, q_b);
+
+                    SetRow3Check(D_T, off + row * 3 + 0, body_id.x * 6 + 3, -U_A);
+                    SetRow3Check(D_T, off + row * 3 + 1, body_id.x * 6 + 3, -V_A);
+                    SetRow3Check(D_T, off + row * 3 + 2, body_id.x * 6 + 3, -W_A);
+
+                    SetRow3Check(D_T, off + row * 3 + 0, body_id.y * 6 + 3, U_B);
+                    SetRow3Check(D_T, off + row * 3 + 1, body_id.y * 6 + 3, V_B);
+                    SetRow3Check(D_T, off + row * 3 + 2, body_id.y * 6 + 3, W_B);
+                }
+            }
+            continue;
+        }
+
         NORMAL_J
 
         SetRow6Check(D_T, off + row * 1 + 0, body_id.x * 6, -U, T3);
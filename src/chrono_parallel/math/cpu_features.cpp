@@ -0,0 +1,191 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: run-time detection of the SIMD instruction sets available on
+// the executing CPU (cpuid), see cpu_features.h
+//
+// =============================================================================
+
+#include <cstdint>
+#include <iostream>
+
+#include "chrono_parallel/math/cpu_features.h"
+#include "chrono_parallel/math/sse.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace chrono {
+
+namespace {
+
+struct CpuFeatureSet {
+    bool sse2 = false;
+    bool sse42 = false;
+    bool avx = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool avx512f = false;
+};
+
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+
+static void run_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+    int out[4];
+    __cpuidex(out, (int)leaf, (int)subleaf);
+    regs[0] = (uint32_t)out[0];
+    regs[1] = (uint32_t)out[1];
+    regs[2] = (uint32_t)out[2];
+    regs[3] = (uint32_t)out[3];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t run_xgetbv() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+static CpuFeatureSet detect_features() {
+    CpuFeatureSet f;
+
+    uint32_t regs[4];
+    run_cpuid(0, 0, regs);
+    uint32_t max_leaf = regs[0];
+    if (max_leaf < 1)
+        return f;
+
+    run_cpuid(1, 0, regs);
+    f.sse2 = (regs[3] & (1u << 26)) != 0;   // EDX.SSE2
+    f.sse42 = (regs[2] & (1u << 20)) != 0;  // ECX.SSE4.2
+    f.fma = (regs[2] & (1u << 12)) != 0;    // ECX.FMA
+
+    // AVX requires both the CPU flag and OS support for the YMM state (OSXSAVE + XCR0).
+    bool osxsave = (regs[2] & (1u << 27)) != 0;
+    bool avx_flag = (regs[2] & (1u << 28)) != 0;
+    bool ymm_enabled = false;
+    bool zmm_enabled = false;
+    if (osxsave) {
+        uint64_t xcr0 = run_xgetbv();
+        ymm_enabled = (xcr0 & 0x6) == 0x6;     // XMM | YMM
+        zmm_enabled = (xcr0 & 0xE6) == 0xE6;   // XMM | YMM | OPMASK | ZMM0-15 | ZMM16-31
+    }
+    f.avx = avx_flag && ymm_enabled;
+
+    if (max_leaf >= 7) {
+        run_cpuid(7, 0, regs);
+        f.avx2 = f.avx && (regs[1] & (1u << 5)) != 0;           // EBX.AVX2
+        f.avx512f = zmm_enabled && (regs[1] & (1u << 16)) != 0; // EBX.AVX512F
+    }
+
+    return f;
+}
+
+#else
+
+// Non-x86 target: report no x86 SIMD tiers; the scalar path is always valid.
+static CpuFeatureSet detect_features() {
+    return CpuFeatureSet();
+}
+
+#endif
+
+static const CpuFeatureSet& features() {
+    static const CpuFeatureSet f = detect_features();
+    return f;
+}
+
+}  // end unnamed namespace
+
+bool ChCpuFeatures::SSE2() {
+    return features().sse2;
+}
+bool ChCpuFeatures::SSE42() {
+    return features().sse42;
+}
+bool ChCpuFeatures::AVX() {
+    return features().avx;
+}
+bool ChCpuFeatures::AVX2() {
+    return features().avx2;
+}
+bool ChCpuFeatures::FMA() {
+    return features().fma;
+}
+bool ChCpuFeatures::AVX512F() {
+    return features().avx512f;
+}
+
+const char* ChCpuFeatures::BestIsaName() {
+    if (features().avx512f)
+        return "AVX-512F";
+    if (features().avx2)
+        return "AVX2";
+    if (features().avx)
+        return "AVX";
+    if (features().sse42)
+        return "SSE4.2";
+    if (features().sse2)
+        return "SSE2";
+    return "scalar";
+}
+
+const char* ChCpuFeatures::CompiledIsaName() {
+#if defined(USE_AVX)
+    return "AVX";
+#elif defined(USE_SSE)
+    return "SSE";
+#else
+    return "scalar";
+#endif
+}
+
+bool ChCpuFeatures::BinaryIsaSupported() {
+#if defined(USE_AVX)
+    return AVX();
+#elif defined(USE_SSE)
+    return SSE42();
+#else
+    return true;
+#endif
+}
+
+bool ChCpuFeatures::Validate() {
+    static const bool supported = []() {
+        bool ok = BinaryIsaSupported();
+        if (!ok) {
+            std::cerr << "ERROR: Chrono::Parallel was compiled for " << CompiledIsaName()
+                      << " but this CPU only provides " << BestIsaName()
+                      << ". Rebuild for this node or disable SIMD (CHRONO_PARALLEL_USE_SIMD)." << std::endl;
+        } else if (features().avx2 || features().avx512f) {
+#if !defined(USE_AVX)
+            std::cout << "Chrono::Parallel: this CPU supports " << BestIsaName() << " but the library uses the "
+                      << CompiledIsaName() << " path; rebuilding for this node would use the wider units."
+                      << std::endl;
+#endif
+        }
+        return ok;
+    }();
+    return supported;
+}
+
+}  // end namespace chrono
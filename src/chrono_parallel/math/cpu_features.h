@@ -0,0 +1,71 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: run-time detection of the SIMD instruction sets available on
+// the executing CPU, and validation against the instruction set the library
+// was compiled for.
+//
+// The real3/real4/matrix kernels in this directory are small (3/4-wide) and
+// inlined at their call sites through simd_avx.h / simd_sse.h / simd_non.h, so
+// the SIMD tier is fixed at compile time and cannot be switched per call
+// without defeating the inlining that makes them fast. What CAN be done at
+// run time is (a) refuse to run a binary on a node that lacks the instruction
+// set it was compiled for, instead of dying later with SIGILL inside a solver
+// loop, and (b) report when a node supports a higher tier than the binary
+// uses, so deployments across heterogeneous clusters know which nodes would
+// benefit from a rebuild.
+//
+// =============================================================================
+
+#pragma once
+
+#include "chrono_parallel/ChApiParallel.h"
+
+namespace chrono {
+
+/// @addtogroup parallel_math
+/// @{
+
+/// Run-time CPU SIMD capability queries (cpuid based).
+/// All queries are cheap after the first call; the feature set is detected once.
+class CH_PARALLEL_API ChCpuFeatures {
+  public:
+    static bool SSE2();     ///< SSE2 available?
+    static bool SSE42();    ///< SSE4.2 available?
+    static bool AVX();      ///< AVX available and enabled by the OS?
+    static bool AVX2();     ///< AVX2 available and enabled by the OS?
+    static bool FMA();      ///< FMA3 available?
+    static bool AVX512F();  ///< AVX-512 Foundation available and enabled by the OS?
+
+    /// Name of the highest SIMD tier available on this CPU
+    /// ("AVX-512F", "AVX2", "AVX", "SSE4.2", "SSE2", or "scalar").
+    static const char* BestIsaName();
+
+    /// Name of the SIMD tier this library was compiled for
+    /// ("AVX", "SSE", or "scalar"; see sse.h for the selection logic).
+    static const char* CompiledIsaName();
+
+    /// Return true if the executing CPU supports the instruction set this
+    /// library was compiled for.
+    static bool BinaryIsaSupported();
+
+    /// Validate the binary against the executing CPU, once per process.
+    /// Prints an error and returns false if the CPU lacks the compiled-for
+    /// instruction set; prints an informational note if the CPU supports a
+    /// higher tier than the binary uses. Called from the ChSystemParallel
+    /// constructor.
+    static bool Validate();
+};
+
+/// @} parallel_math
+
+}  // end namespace chrono
@@ -316,8 +316,19 @@ class CH_PARALLEL_API ChParticleContainer : public Ch3DOFContainer {
     bool mpm_init;
     MPM_Settings temp_settings;
 
+    /// Number of fused relaxation sweeps for particle-particle contacts (0: disabled).
+    /// When positive, the particle-particle contacts are not inserted into the global
+    /// constraint system; instead, PreSolve() runs this many projected Jacobi sweeps
+    /// directly on the particle neighbor lists, with the same depth stabilization terms
+    /// as the constraint path but without building jacobian arrays. Only frictionless
+    /// pushing impulses are applied (mu is ignored and cohesion produces no tensile
+    /// force). The rigid-fluid boundary contacts still go through the solver, so this
+    /// mode trades generality for throughput on (mostly) pure granular flows.
+    uint fused_iterations;
+
   private:
     uint body_offset;
+    custom_vector<real3> fused_vel;  ///< scratch velocities for the fused Jacobi sweeps
 };
 
 /// @} parallel_physics
@@ -49,6 +49,47 @@ CUDA_CONSTANT Bounds system_bounds;
 cudaEvent_t start;
 cudaEvent_t stop;
 float time_measured = 0;
+
+// Persistent CUDA resources. All marker and grid state above stays resident on
+// the device across steps; only the coupling data (positions, velocities and
+// the JE/JP pair) crosses PCIe each step, staged through pinned host buffers.
+// The velocity upload and the JE/JP download run on a dedicated non-blocking
+// copy stream so they overlap with the grid kernels on the default stream.
+cudaStream_t copy_stream;
+cudaEvent_t copy_done;
+cudaEvent_t kernels_done;
+float* pos_pinned = 0;
+float* vel_pinned = 0;
+float* jejp_pinned = 0;
+size_t pos_pinned_size = 0;
+size_t vel_pinned_size = 0;
+size_t jejp_pinned_size = 0;
+bool cuda_resources_ready = false;
+
+// Grow a pinned staging buffer to hold at least count floats.
+static void MPM_StagePinned(float*& buffer, size_t& capacity, size_t count) {
+    if (capacity < count) {
+        if (buffer) {
+            cudaCheck(cudaFreeHost(buffer));
+        }
+        cudaCheck(cudaHostAlloc(&buffer, count * sizeof(float), cudaHostAllocDefault));
+        capacity = count;
+    }
+}
+
+// Create the timing events, copy stream, and synchronization events once;
+// they persist for the lifetime of the simulation.
+static void MPM_SetupCudaResources() {
+    if (cuda_resources_ready) {
+        return;
+    }
+    cudaEventCreate(&start);
+    cudaEventCreate(&stop);
+    cudaCheck(cudaStreamCreateWithFlags(&copy_stream, cudaStreamNonBlocking));
+    cudaCheck(cudaEventCreateWithFlags(&copy_done, cudaEventDisableTiming));
+    cudaCheck(cudaEventCreateWithFlags(&kernels_done, cudaEventDisableTiming));
+    cuda_resources_ready = true;
+}
 /////// BB Constants
 __device__ float alpha = 0.0001;
 __device__ float dot_ms_ms = 0;
@@ -900,19 +941,27 @@ void MPM_UpdateDeformationGradient(MPM_Settings& settings,
                                    std::vector<float>& positions,
                                    std::vector<float>& velocities,
                                    std::vector<float>& jejp) {
-    cudaEventCreate(&start);
-    cudaEventCreate(&stop);
+    MPM_SetupCudaResources();
 
     host_settings = settings;
     printf("Solving MPM: %d\n", host_settings.num_iterations);
 
-    pos.data_h = positions;
-
-    pos.copyHostToDevice();
+    // Upload the coupling data through pinned staging buffers. The positions go
+    // on the default stream (the bounds computation needs them immediately); the
+    // velocities go on the copy stream so their transfer overlaps with the
+    // bounds computation, which only depends on the positions.
+    pos.resize(positions.size());
+    vel.resize(velocities.size());
 
-    vel.data_h = velocities;
+    MPM_StagePinned(pos_pinned, pos_pinned_size, positions.size());
+    MPM_StagePinned(vel_pinned, vel_pinned_size, velocities.size());
+    memcpy(pos_pinned, positions.data(), positions.size() * sizeof(float));
+    memcpy(vel_pinned, velocities.data(), velocities.size() * sizeof(float));
 
-    vel.copyHostToDevice();
+    cudaCheck(cudaMemcpyAsync(pos.data_d, pos_pinned, positions.size() * sizeof(float), cudaMemcpyHostToDevice, 0));
+    cudaCheck(cudaMemcpyAsync(vel.data_d, vel_pinned, velocities.size() * sizeof(float), cudaMemcpyHostToDevice,
+                              copy_stream));
+    cudaCheck(cudaEventRecord(copy_done, copy_stream));
 
     cudaCheck(cudaMemcpyToSymbolAsync(device_settings, &host_settings, sizeof(MPM_Settings)));
 
@@ -923,6 +972,9 @@ void MPM_UpdateDeformationGradient(MPM_Settings& settings,
 
     grid_vel.resize(host_settings.num_mpm_nodes * 3);
     grid_vel = 0;
+
+    // The rasterization is the first kernel that consumes the velocities.
+    cudaCheck(cudaStreamWaitEvent(0, copy_done, 0));
     {
         CudaEventTimer timer(start, stop, true, time_measured);
         // ========================================================================================
@@ -946,9 +998,17 @@ void MPM_UpdateDeformationGradient(MPM_Settings& settings,
         CudaEventTimer timer(start, stop, true, time_measured);
         kUpdateDeformationGradient<<<CONFIG(host_settings.num_mpm_markers)>>>(
             grid_vel.data_d, pos.data_d, marker_Fe.data_d, marker_Fp.data_d, marker_plasticity.data_d, JE_JP.data_d);
-        JE_JP.copyDeviceToHost();
+
+        // Download JE/JP through the pinned buffer on the copy stream.
+        MPM_StagePinned(jejp_pinned, jejp_pinned_size, JE_JP.size());
+        cudaCheck(cudaEventRecord(kernels_done, 0));
+        cudaCheck(cudaStreamWaitEvent(copy_stream, kernels_done, 0));
+        cudaCheck(
+            cudaMemcpyAsync(jejp_pinned, JE_JP.data_d, JE_JP.size() * sizeof(float), cudaMemcpyDeviceToHost, copy_stream));
     }
-    jejp = JE_JP.data_h;
+    cudaCheck(cudaStreamSynchronize(copy_stream));
+    jejp.resize(JE_JP.size());
+    memcpy(jejp.data(), jejp_pinned, JE_JP.size() * sizeof(float));
     printf("kUpdateDeformationGradient: %f\n", time_measured);
     time_measured = 0;
 }
@@ -1008,11 +1068,13 @@ void MPM_Solve(MPM_Settings& settings, std::vector<float>& positions, std::vecto
     printf("kUpdateParticleVelocity: %f\n", time_measured);
     time_measured = 0;
 
-    vel.copyDeviceToHost();
-    velocities = vel.data_h;
-
-    cudaEventDestroy(start);
-    cudaEventDestroy(stop);
+    // Only the marker velocities come back to the host; everything else
+    // (deformation gradients, plasticity, grid state) stays on the device.
+    MPM_StagePinned(vel_pinned, vel_pinned_size, vel.size());
+    cudaCheck(cudaMemcpyAsync(vel_pinned, vel.data_d, vel.size() * sizeof(float), cudaMemcpyDeviceToHost, 0));
+    cudaCheck(cudaStreamSynchronize(0));
+    velocities.resize(vel.size());
+    memcpy(velocities.data(), vel_pinned, vel.size() * sizeof(float));
 }
 
 CUDA_GLOBAL void kInitFeFp(float* marker_Fe, float* marker_Fp, float* marker_RE, float* marker_SE) {
@@ -1035,17 +1097,17 @@ CUDA_GLOBAL void kInitFeFp(float* marker_Fe, float* marker_Fp, float* marker_RE,
 void MPM_Initialize(MPM_Settings& settings, std::vector<float>& positions) {
     cudaDeviceSetCacheConfig(cudaFuncCachePreferL1);
 
-    cudaEventCreate(&start);
-    cudaEventCreate(&stop);
+    MPM_SetupCudaResources();
 
     host_settings = settings;
 
     cudaCheck(cudaMalloc(&lower_bound, sizeof(float3)));
     cudaCheck(cudaMalloc(&upper_bound, sizeof(float3)));
 
-    pos.data_h = positions;
-
-    pos.copyHostToDevice();
+    pos.resize(positions.size());
+    MPM_StagePinned(pos_pinned, pos_pinned_size, positions.size());
+    memcpy(pos_pinned, positions.data(), positions.size() * sizeof(float));
+    cudaCheck(cudaMemcpyAsync(pos.data_d, pos_pinned, positions.size() * sizeof(float), cudaMemcpyHostToDevice, 0));
 
     cudaCheck(cudaMemcpyToSymbolAsync(device_settings, &host_settings, sizeof(MPM_Settings)));
 
@@ -1096,8 +1158,5 @@ void MPM_Initialize(MPM_Settings& settings, std::vector<float>& positions) {
     time_measured = 0;
     //    cudaCheck(cudaPeekAtLastError());
     //    cudaCheck(cudaDeviceSynchronize());
-
-    cudaEventDestroy(start);
-    cudaEventDestroy(stop);
 }
 }
@@ -43,6 +43,7 @@ ChParticleContainer::ChParticleContainer() {
     start_boundary = 0;
     start_contact = 0;
     mpm_iterations = 0;
+    fused_iterations = 0;
 
     nu = .2;
     youngs_modulus = 1.4e5;
@@ -212,10 +213,14 @@ void ChParticleContainer::UpdatePosition(double ChTime) {
 
 int ChParticleContainer::GetNumConstraints() {
     int num_fluid_fluid = 0;
-    if (mu == 0) {
-        num_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2;
-    } else {
-        num_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2 * 3;
+    // In fused mode the particle-particle contacts are handled in PreSolve and do
+    // not contribute constraints to the global system.
+    if (fused_iterations == 0) {
+        if (mu == 0) {
+            num_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2;
+        } else {
+            num_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2 * 3;
+        }
     }
 
     if (contact_mu == 0) {
@@ -229,11 +234,13 @@ int ChParticleContainer::GetNumConstraints() {
 
 int ChParticleContainer::GetNumNonZeros() {
     int nnz_fluid_fluid = 0;
-    if (mu == 0) {
-        nnz_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2 * 6;
+    if (fused_iterations == 0) {
+        if (mu == 0) {
+            nnz_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2 * 6;
 
-    } else {
-        nnz_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2 * 6 * 3;
+        } else {
+            nnz_fluid_fluid = (data_manager->num_fluid_contacts - data_manager->num_fluid_bodies) / 2 * 6 * 3;
+        }
     }
 
     if (contact_mu == 0) {
@@ -331,7 +338,7 @@ void ChParticleContainer::Build_D() {
               << " " << D_T.rows() << " " << D_T.columns();
     BuildRigidFluidBoundary(contact_mu, num_fluid_bodies, body_offset, start_boundary, data_manager);
 
-    if (num_rigid_contacts > 0) {
+    if (num_rigid_contacts > 0 && fused_iterations == 0) {
         int index = 0;
         custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
 
@@ -373,7 +380,7 @@ void ChParticleContainer::Build_b() {
     CorrectionRigidFluidBoundary(contact_mu, contact_cohesion, alpha, contact_recovery_speed, num_fluid_bodies,
                                  start_boundary, data_manager);
 
-    if (num_rigid_contacts > 0) {
+    if (num_rigid_contacts > 0 && fused_iterations == 0) {
         int index = 0;  // incremented in Loop_Over_Fluid_Neighbors()
 
         custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
@@ -410,7 +417,7 @@ void ChParticleContainer::Build_E() {
     if (alpha) {
         com = inv_hhpa * compliance;
     }
-    if (num_rigid_contacts > 0) {
+    if (num_rigid_contacts > 0 && fused_iterations == 0) {
         if (mu == 0) {
 #pragma omp parallel for
             for (int index = 0; index < (signed)num_rigid_contacts; index++) {
@@ -430,6 +437,10 @@ void ChParticleContainer::Build_E() {
 void ChParticleContainer::Project(real* gamma) {
     ProjectRigidFluidBoundary(contact_mu, contact_cohesion, num_fluid_bodies, start_boundary, gamma, data_manager);
 
+    if (fused_iterations > 0) {
+        return;
+    }
+
     if (mu == 0) {
 #pragma omp parallel for
         for (int index = 0; index < (signed)num_rigid_contacts; index++) {
@@ -463,7 +474,7 @@ void ChParticleContainer::GenerateSparsity() {
     LOG(INFO) << "ChParticleContainer::GenerateSparsity";
     AppendRigidFluidBoundary(contact_mu, num_fluid_bodies, body_offset, start_boundary, data_manager);
 
-    if (num_rigid_contacts > 0) {
+    if (num_rigid_contacts > 0 && fused_iterations == 0) {
         int index_n = 0;
         int index_t = 0;
         for (int body_a = 0; body_a < (signed)num_fluid_bodies; body_a++) {
@@ -553,6 +564,66 @@ void ChParticleContainer::PreSolve() {
         }
     }
 #endif
+
+    // Fused particle-particle contact relaxation (see fused_iterations). This works
+    // directly on the neighbor lists produced by the particle grid: every sweep, each
+    // particle gathers the pushing impulses of its active contacts (all particles have
+    // the same mass, so each side takes half of the pair correction) and the
+    // accumulated corrections are averaged over the active contacts so that the Jacobi
+    // iteration remains stable for dense packings. The depth stabilization term
+    // matches the one used by Build_b for the constraint path.
+    if (fused_iterations == 0 || num_rigid_contacts == 0) {
+        return;
+    }
+
+    custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
+    DynamicVector<real>& v = data_manager->host_data.v;
+
+    real inv_hpa = 1.0 / (data_manager->settings.step_size + alpha);
+
+    fused_vel.resize(num_fluid_bodies);
+
+    for (uint sweep = 0; sweep < fused_iterations; sweep++) {
+#pragma omp parallel for
+        for (int body_a = 0; body_a < (signed)num_fluid_bodies; body_a++) {
+            real3 va(v[body_offset + body_a * 3 + 0], v[body_offset + body_a * 3 + 1],
+                     v[body_offset + body_a * 3 + 2]);
+            real3 dv(0);
+            int num_active = 0;
+            for (int i = 0; i < data_manager->host_data.c_counts_3dof_3dof[body_a]; i++) {
+                int body_b = data_manager->host_data.neighbor_3dof_3dof[body_a * max_neighbors + i];
+                if (body_a == body_b) {
+                    continue;
+                }
+                real3 xij = sorted_pos[body_a] - sorted_pos[body_b];
+                real dist = Length(xij);
+                if (dist == 0) {
+                    continue;
+                }
+                real3 U = xij / dist;
+                real depth = dist - kernel_radius;
+                if (cohesion != 0) {
+                    depth = Min(depth, 0);
+                }
+                real bi = std::max(inv_hpa * depth, -contact_recovery_speed);
+                real3 vb(v[body_offset + body_b * 3 + 0], v[body_offset + body_b * 3 + 1],
+                         v[body_offset + body_b * 3 + 2]);
+                real vn = Dot(va - vb, U) + bi;
+                if (vn < 0) {
+                    dv += (-0.5 * vn) * U;
+                    num_active++;
+                }
+            }
+            fused_vel[body_a] = (num_active > 0) ? va + dv / (real)num_active : va;
+        }
+
+#pragma omp parallel for
+        for (int body_a = 0; body_a < (signed)num_fluid_bodies; body_a++) {
+            v[body_offset + body_a * 3 + 0] = fused_vel[body_a].x;
+            v[body_offset + body_a * 3 + 1] = fused_vel[body_a].y;
+            v[body_offset + body_a * 3 + 2] = fused_vel[body_a].z;
+        }
+    }
 }
 
 void ChParticleContainer::PostSolve() {}
@@ -560,6 +631,13 @@ void ChParticleContainer::PostSolve() {}
 void ChParticleContainer::GetFluidForce(custom_vector<real3>& forc) {
     forc.resize(num_fluid_bodies);
 
+    // In fused mode the particle-particle impulses are applied directly to the
+    // velocities and no multipliers are available.
+    if (fused_iterations > 0) {
+        std::fill(forc.begin(), forc.end(), real3(0));
+        return;
+    }
+
     DynamicVector<real>& gamma = data_manager->host_data.gamma;
 
     SubVectorType gamma_n = subvector(gamma, start_contact, num_rigid_contacts);
@@ -31,6 +31,7 @@
 #include "chrono_parallel/collision/ChCollisionModelParallel.h"
 #include "chrono_parallel/collision/ChCollisionSystemBulletParallel.h"
 #include "chrono_parallel/collision/ChCollisionSystemParallel.h"
+#include "chrono_parallel/math/cpu_features.h"
 #include "chrono_parallel/math/matrix.h"  // for quaternion, real4
 #include "chrono_parallel/physics/ChSystemParallel.h"
 #include "chrono_parallel/solver/ChSolverParallel.h"
@@ -47,6 +48,9 @@ INITIALIZE_EASYLOGGINGPP
 namespace chrono {
 
 ChSystemParallel::ChSystemParallel() : ChSystem() {
+    // Check once that this CPU provides the SIMD tier the library was compiled for.
+    ChCpuFeatures::Validate();
+
     data_manager = new ChParallelDataManager();
 
     descriptor = std::make_shared<ChSystemDescriptorParallel>(data_manager);
@@ -64,6 +68,10 @@ ChSystemParallel::ChSystemParallel() : ChSystem() {
     old_timer_cd = 0;
     detect_optimal_threads = false;
     detect_optimal_bins = false;
+    bin_tuning_dir = 1;
+    bins_saved = vec3(0);
+    solver_hard_streak = 0;
+    solver_easy_streak = 0;
     current_threads = 2;
 
     data_manager->system_timer.AddTimer("step");
@@ -119,21 +127,62 @@ bool ChSystemParallel::Integrate_Y() {
     }
     data_manager->system_timer.stop("collision");
 
+    // Re-wake the bodies that cannot sleep because they are in contact with
+    // some body that is not in sleep state, and deactivate the ones at rest.
+    ManageSleepingBodies();
+
     data_manager->system_timer.start("advance");
     std::static_pointer_cast<ChIterativeSolverParallel>(solver_speed)->RunTimeStep();
     data_manager->system_timer.stop("advance");
 
     data_manager->system_timer.start("update");
 
-    // Iterate over the active bilateral constraints and store their Lagrange
-    // multiplier.
     std::vector<ChConstraint*>& mconstraints = descriptor->GetConstraintsList();
-    for (int index = 0; index < (signed)data_manager->num_bilaterals; index++) {
-        int cntr = data_manager->host_data.bilateral_mapping[index];
-        mconstraints[cntr]->Set_l_i(data_manager->host_data.gamma[data_manager->num_unilaterals + index]);
+
+    // Scatter the states to the Chrono objects (bodies and shafts) and update
+    // all physics items at the end of the step.
+    DynamicVector<real>& velocities = data_manager->host_data.v;
+    custom_vector<real3>& pos_pointer = data_manager->host_data.pos_rigid;
+    custom_vector<quaternion>& rot_pointer = data_manager->host_data.rot_rigid;
+
+    // The bilateral multiplier store and the body state scatter are independent;
+    // run both in a single parallel region so the threads fork and join only once.
+#pragma omp parallel
+    {
+        // Iterate over the active bilateral constraints and store their Lagrange
+        // multiplier (bilateral_mapping is a permutation, so each iteration
+        // touches a distinct constraint).
+#pragma omp for nowait
+        for (int index = 0; index < (signed)data_manager->num_bilaterals; index++) {
+            int cntr = data_manager->host_data.bilateral_mapping[index];
+            mconstraints[cntr]->Set_l_i(data_manager->host_data.gamma[data_manager->num_unilaterals + index]);
+        }
+
+#pragma omp for
+        for (int i = 0; i < bodylist.size(); i++) {
+            if (data_manager->host_data.active_rigid[i] != 0) {
+                bodylist[i]->Variables().Get_qb().SetElement(0, 0, velocities[i * 6 + 0]);
+                bodylist[i]->Variables().Get_qb().SetElement(1, 0, velocities[i * 6 + 1]);
+                bodylist[i]->Variables().Get_qb().SetElement(2, 0, velocities[i * 6 + 2]);
+                bodylist[i]->Variables().Get_qb().SetElement(3, 0, velocities[i * 6 + 3]);
+                bodylist[i]->Variables().Get_qb().SetElement(4, 0, velocities[i * 6 + 4]);
+                bodylist[i]->Variables().Get_qb().SetElement(5, 0, velocities[i * 6 + 5]);
+
+                bodylist[i]->VariablesQbIncrementPosition(this->GetStep());
+                bodylist[i]->VariablesQbSetSpeed(this->GetStep());
+
+                bodylist[i]->Update(ChTime);
+
+                // update the position and rotation vectors
+                pos_pointer[i] =
+                    (real3(bodylist[i]->GetPos().x(), bodylist[i]->GetPos().y(), bodylist[i]->GetPos().z()));
+                rot_pointer[i] = (quaternion(bodylist[i]->GetRot().e0(), bodylist[i]->GetRot().e1(),
+                                             bodylist[i]->GetRot().e2(), bodylist[i]->GetRot().e3()));
+            }
+        }
     }
 
-    // Update the constraint reactions.
+    // Update the constraint reactions (reads the multipliers stored above).
     double factor = 1 / this->GetStep();
     for (int ip = 0; ip < linklist.size(); ++ip) {
         linklist[ip]->ConstraintsFetch_react(factor);
@@ -143,34 +192,6 @@ bool ChSystemParallel::Integrate_Y() {
     }
     contact_container->ConstraintsFetch_react(factor);
 
-    // Scatter the states to the Chrono objects (bodies and shafts) and update
-    // all physics items at the end of the step.
-    DynamicVector<real>& velocities = data_manager->host_data.v;
-    custom_vector<real3>& pos_pointer = data_manager->host_data.pos_rigid;
-    custom_vector<quaternion>& rot_pointer = data_manager->host_data.rot_rigid;
-
-#pragma omp parallel for
-    for (int i = 0; i < bodylist.size(); i++) {
-        if (data_manager->host_data.active_rigid[i] != 0) {
-            bodylist[i]->Variables().Get_qb().SetElement(0, 0, velocities[i * 6 + 0]);
-            bodylist[i]->Variables().Get_qb().SetElement(1, 0, velocities[i * 6 + 1]);
-            bodylist[i]->Variables().Get_qb().SetElement(2, 0, velocities[i * 6 + 2]);
-            bodylist[i]->Variables().Get_qb().SetElement(3, 0, velocities[i * 6 + 3]);
-            bodylist[i]->Variables().Get_qb().SetElement(4, 0, velocities[i * 6 + 4]);
-            bodylist[i]->Variables().Get_qb().SetElement(5, 0, velocities[i * 6 + 5]);
-
-            bodylist[i]->VariablesQbIncrementPosition(this->GetStep());
-            bodylist[i]->VariablesQbSetSpeed(this->GetStep());
-
-            bodylist[i]->Update(ChTime);
-
-            // update the position and rotation vectors
-            pos_pointer[i] = (real3(bodylist[i]->GetPos().x(), bodylist[i]->GetPos().y(), bodylist[i]->GetPos().z()));
-            rot_pointer[i] = (quaternion(bodylist[i]->GetRot().e0(), bodylist[i]->GetRot().e1(),
-                                         bodylist[i]->GetRot().e2(), bodylist[i]->GetRot().e3()));
-        }
-    }
-
     ////#pragma omp parallel for
     for (int i = 0; i < (signed)data_manager->num_shafts; i++) {
         if (!data_manager->host_data.shaft_active[i])
@@ -196,6 +217,12 @@ bool ChSystemParallel::Integrate_Y() {
     if (data_manager->settings.perform_thread_tuning) {
         RecomputeThreads();
     }
+    if (data_manager->settings.solver.perform_solver_tuning) {
+        RecomputeSolverSettings();
+    }
+    if (data_manager->settings.collision.perform_bin_tuning) {
+        RecomputeBins();
+    }
 
     return true;
 }
@@ -349,14 +376,17 @@ void ChSystemParallel::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
 // Reset forces for all variables
 //
 void ChSystemParallel::ClearForceVariables() {
-#pragma omp parallel for
-    for (int i = 0; i < (signed)data_manager->num_rigid_bodies; i++) {
-        bodylist[i]->VariablesFbReset();
-    }
+#pragma omp parallel
+    {
+#pragma omp for nowait
+        for (int i = 0; i < (signed)data_manager->num_rigid_bodies; i++) {
+            bodylist[i]->VariablesFbReset();
+        }
 
-    ////#pragma omp parallel for
-    for (int i = 0; i < (signed)data_manager->num_shafts; i++) {
-        shaftlist[i]->VariablesFbReset();
+#pragma omp single
+        for (int i = 0; i < (signed)data_manager->num_shafts; i++) {
+            shaftlist[i]->VariablesFbReset();
+        }
     }
 }
 
@@ -441,6 +471,107 @@ void ChSystemParallel::UpdateRigidBodies() {
     }
 }
 
+//
+// Put to sleep bodies whose motion has almost come to a rest and wake up sleeping
+// bodies touched by a non-sleeping one. Unlike ChSystem::ManageSleepingBodies, the
+// wake-up scan runs directly on the compact contact pair list produced by the
+// collision system, instead of going through a contact container callback. This
+// must be called after collision detection and before the solver, so that bodies
+// woken by a new contact are treated as dynamic in the current step.
+//
+bool ChSystemParallel::ManageSleepingBodies() {
+    if (!GetUseSleeping())
+        return false;
+
+    custom_vector<char>& active = data_manager->host_data.active_rigid;
+    custom_vector<vec2>& bids = data_manager->host_data.bids_rigid_rigid;
+
+    // Mark as 'could sleep' the bodies that stayed under the speed thresholds
+    // long enough (each body only touches its own flags).
+#pragma omp parallel for
+    for (int i = 0; i < bodylist.size(); i++) {
+        bodylist[i]->TrySleeping();
+    }
+
+    // Scan all links and wake connected bodies.
+    bool need_setup = false;
+    for (int ip = 0; ip < linklist.size(); ++ip) {
+        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+        if (Lpointer->IsRequiringWaking()) {
+            ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
+            ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
+            if (b1 && b2) {
+                bool sleep1 = b1->GetSleeping();
+                bool sleep2 = b2->GetSleeping();
+                bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
+                bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
+                if (sleep1 && !(sleep2 || could_sleep2)) {
+                    b1->SetSleeping(false);
+                    need_setup = true;
+                }
+                if (sleep2 && !(sleep1 || could_sleep1)) {
+                    b2->SetSleeping(false);
+                    need_setup = true;
+                }
+                if (could_sleep1 && !(sleep2 || could_sleep2)) {
+                    b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+                }
+                if (could_sleep2 && !(sleep1 || could_sleep1)) {
+                    b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+                }
+            }
+        }
+    }
+
+    // Scan the contact pairs of the current step and wake sleeping (or sleep
+    // candidate) bodies that touch a non-sleeping, non-fixed one.
+    for (int index = 0; index < (signed)data_manager->num_rigid_contacts; index++) {
+        ChBody* b1 = bodylist[bids[index].x].get();
+        ChBody* b2 = bodylist[bids[index].y].get();
+        bool sleep1 = b1->GetSleeping();
+        bool sleep2 = b2->GetSleeping();
+        bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
+        bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
+        bool ground1 = b1->GetBodyFixed();
+        bool ground2 = b2->GetBodyFixed();
+        if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
+            b1->SetSleeping(false);
+            need_setup = true;
+        }
+        if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
+            b2->SetSleeping(false);
+            need_setup = true;
+        }
+        if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
+            b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+        }
+        if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
+            b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+        }
+    }
+
+    // The surviving candidates can now be put to sleep.
+    for (int i = 0; i < bodylist.size(); i++) {
+        if (bodylist[i]->BFlagGet(ChBody::BodyFlag::COULDSLEEP)) {
+            bodylist[i]->SetSleeping(true);
+            need_setup = true;
+        }
+    }
+
+    // Refresh the active flags consumed by the broadphase, narrowphase and solver:
+    // bodies put to sleep are compacted out of the pair generation and treated as
+    // static by the contact constraints, bodies woken by a contact become dynamic
+    // again in the current step.
+    if (need_setup) {
+#pragma omp parallel for
+        for (int i = 0; i < bodylist.size(); i++) {
+            active[i] = bodylist[i]->IsActive();
+        }
+    }
+
+    return need_setup;
+}
+
 //
 // Update all shaft elements in the system and populate system-wide state and
 // force vectors. Note that visualization assets are not updated.
@@ -675,6 +806,121 @@ void ChSystemParallel::RecomputeThreads() {
 #endif
 }
 
+//
+// Adapt the solver iteration caps and the tolerance to the difficulty of the
+// current phase of the simulation (see perform_solver_tuning in ChSettings.h).
+// Settings are re-read every step, so the adjustments made here take effect on
+// the next step; note that the tolerance (not tol_speed) is modified, since
+// Setup() re-derives tol_speed from the tolerance at each step.
+//
+void ChSystemParallel::RecomputeSolverSettings() {
+    solver_settings& solver = data_manager->settings.solver;
+    const std::vector<real>& hist = data_manager->measures.solver.maxd_hist;
+
+    int iterations = (int)hist.size();
+    real residual = data_manager->measures.solver.residual;
+
+    // Track consecutive steps on which the solver exhausted its iteration cap
+    // without reaching the tolerance (hard) and steps on which it converged well
+    // below the cap (easy).
+    if (iterations >= (signed)solver.max_iteration && residual > solver.tol_speed) {
+        solver_hard_streak++;
+    } else {
+        solver_hard_streak = 0;
+    }
+    if (iterations > 0 && iterations * 4 < (signed)solver.max_iteration) {
+        solver_easy_streak++;
+    } else {
+        solver_easy_streak = 0;
+    }
+
+    // Scale a single iteration cap, clamping to the user bounds. Caps set to
+    // zero (disabled solver phases) are left untouched.
+    auto ScaleCap = [&solver](uint& cap, real scale) {
+        if (cap == 0)
+            return;
+        cap = (uint)(cap * scale);
+        cap = Min(Max(cap, solver.tuning_min_iterations), solver.tuning_max_iterations);
+    };
+
+    if (solver_hard_streak >= 10) {
+        solver_hard_streak = 0;
+        // Estimate the residual decay rate per iteration over the tail of the
+        // residual history. If the solver was still making progress when it hit
+        // the cap, grant more iterations; if it had stagnated, extra iterations
+        // are wasted and the tolerance is relaxed instead.
+        real decay = 1;
+        if (hist.size() >= 10 && hist[hist.size() - 10] > 0) {
+            decay = Pow(hist.back() / hist[hist.size() - 10], real(0.1));
+        }
+        if (decay < real(0.99)) {
+            ScaleCap(solver.max_iteration, real(1.5));
+            ScaleCap(solver.max_iteration_normal, real(1.5));
+            ScaleCap(solver.max_iteration_sliding, real(1.5));
+            ScaleCap(solver.max_iteration_spinning, real(1.5));
+            ScaleCap(solver.max_iteration_bilateral, real(1.5));
+            LOG(TRACE) << "solver tuning: iteration cap increased to " << solver.max_iteration;
+        } else {
+            solver.tolerance = Min(solver.tolerance * 2, solver.tuning_max_tolerance);
+            LOG(TRACE) << "solver tuning: tolerance relaxed to " << solver.tolerance;
+        }
+    } else if (solver_easy_streak >= 50) {
+        solver_easy_streak = 0;
+        ScaleCap(solver.max_iteration, real(0.75));
+        ScaleCap(solver.max_iteration_normal, real(0.75));
+        ScaleCap(solver.max_iteration_sliding, real(0.75));
+        ScaleCap(solver.max_iteration_spinning, real(0.75));
+        ScaleCap(solver.max_iteration_bilateral, real(0.75));
+        solver.tolerance = Max(solver.tolerance / 2, solver.tuning_min_tolerance);
+        LOG(TRACE) << "solver tuning: iteration cap reduced to " << solver.max_iteration << " tolerance tightened to "
+                   << solver.tolerance;
+    }
+}
+
+//
+// Tune the broadphase grid resolution from the measured collision time, in the
+// same trial-and-revert fashion as RecomputeThreads: every 50 steps perturb
+// bins_per_axis by 25% in the current search direction, measure for 10 steps,
+// and keep the change only if the average collision time improved; otherwise
+// revert and flip the direction. Only meaningful with fixed_bins enabled, since
+// otherwise the broadphase re-derives the bin counts from the grid density.
+//
+void ChSystemParallel::RecomputeBins() {
+    cd_accumulator.insert(cd_accumulator.begin(), data_manager->system_timer.GetTime("collision"));
+    cd_accumulator.pop_back();
+
+    double sum_of_elems = std::accumulate(cd_accumulator.begin(), cd_accumulator.end(), 0.0);
+
+    vec3& bins = data_manager->settings.collision.bins_per_axis;
+
+    if (frame_bins == 50 && detect_optimal_bins == 0) {
+        frame_bins = 0;
+        detect_optimal_bins = 1;
+        old_timer_cd = sum_of_elems / 10.0;
+        bins_saved = bins;
+
+        int dx = Max(1, bins.x / 4);
+        int dy = Max(1, bins.y / 4);
+        int dz = Max(1, bins.z / 4);
+        if (bin_tuning_dir > 0) {
+            bins = vec3(bins.x + dx, bins.y + dy, bins.z + dz);
+        } else {
+            bins = vec3(Max(1, bins.x - dx), Max(1, bins.y - dy), Max(1, bins.z - dz));
+        }
+        LOG(TRACE) << "bin tuning: trying bins " << bins.x << " " << bins.y << " " << bins.z;
+    } else if (frame_bins == 10 && detect_optimal_bins == 1) {
+        double current_timer = sum_of_elems / 10.0;
+        detect_optimal_bins = 0;
+        frame_bins = 0;
+        if (old_timer_cd < current_timer) {
+            bins = bins_saved;
+            bin_tuning_dir = -bin_tuning_dir;
+            LOG(TRACE) << "bin tuning: reverted to bins " << bins.x << " " << bins.y << " " << bins.z;
+        }
+    }
+    frame_bins++;
+}
+
 void ChSystemParallel::ChangeCollisionSystem(CollisionSystemType type) {
     assert(GetNbodies() == 0);
 
@@ -734,6 +980,8 @@ void ChSystemParallel::CalculateBodyAABB() {
     //// TODO: can be done in parallel using Thrust
     for (uint is = 0; is < data_manager->num_rigid_shapes; is++) {
         uint ib = id_rigid[is];
+        if (ib == UINT_MAX)  // inactive shape slot
+            continue;
         b_min[ib] = real3(Min(b_min[ib].x, s_min[ib].x + offset.x), Min(b_min[ib].y, s_min[ib].y + offset.y),
                           Min(b_min[ib].z, s_min[ib].z + offset.z));
         b_max[ib] = real3(Max(b_max[ib].x, s_max[ib].x + offset.x), Max(b_max[ib].y, s_max[ib].y + offset.y),
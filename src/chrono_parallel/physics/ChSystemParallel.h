@@ -71,6 +71,17 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
     virtual void UpdateShafts();
     virtual void Update3DOFBodies();
     void RecomputeThreads();
+    void RecomputeSolverSettings();
+    void RecomputeBins();
+
+    /// Put to sleep the bodies whose motion has almost come to a rest and wake up
+    /// sleeping bodies touched by a non-sleeping one (parallel replacement for
+    /// ChSystem::ManageSleepingBodies, working directly on the contact pair list of
+    /// the data manager). Bodies put to sleep are flagged as inactive in the data
+    /// manager, so broadphase pair generation and the solver skip them from the next
+    /// step on. Only performed if SetUseSleeping(true) was used on the system.
+    /// Return true if some body changed its sleep state.
+    bool ManageSleepingBodies();
 
     virtual void AddMaterialSurfaceData(std::shared_ptr<ChBody> newbody) = 0;
     virtual void UpdateMaterialSurfaceData(int index, ChBody* body) = 0;
@@ -143,8 +154,11 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
     bool detect_optimal_threads;
 
     int detect_optimal_bins;
+    int bin_tuning_dir;
+    vec3 bins_saved;
     std::vector<double> timer_accumulator, cd_accumulator;
     uint frame_threads, frame_bins, counter;
+    uint solver_hard_streak, solver_easy_streak;
     std::vector<ChLink*>::iterator it;
 
     CollisionSystemType collision_system_type;
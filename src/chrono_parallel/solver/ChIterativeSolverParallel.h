@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "chrono/solver/ChIterativeSolver.h"
 
 #include "chrono_parallel/ChParallelDefines.h"
@@ -86,13 +88,28 @@ class CH_PARALLEL_API ChIterativeSolverParallelNSC : public ChIterativeSolverPar
     /// Set the RHS vector depending on the local solver mode.
     void SetR();
     /// This function computes an initial guess for each contact.
+    /// If contact warm starting is enabled (see use_contact_warm_start in
+    /// ChSettings.h), contacts are matched to those of the previous step by
+    /// shape pair id and their multipliers are seeded from the converged values
+    /// recorded by SaveContactState(), unless the contact point moved more than
+    /// the displacement threshold.
     void PreSolve();
     /// This function is used to change the solver algorithm.
     void ChangeSolverType(SolverType type);
 
   private:
+    /// Record the contact pair ids, contact points, and converged multipliers
+    /// of this step, for use by PreSolve() at the next step.
+    void SaveContactState();
+
     ChShurProduct ShurProductFull;
     ChProjectConstraints ProjectFull;
+
+    // Rigid contact state of the previous step, used for cross-step warm
+    // starting of the contact multipliers.
+    std::unordered_map<long long, int> m_last_contact_index;  ///< pair id -> slot in the arrays below
+    custom_vector<real3> m_last_points;                       ///< contact points on the first body
+    custom_vector<real> m_last_gamma;                         ///< multipliers, 6 lanes per contact
 };
 
 /// Iterative solver for SMC (penalty-based) problems.
@@ -113,6 +130,11 @@ class CH_PARALLEL_API ChIterativeSolverParallelSMC : public ChIterativeSolverPar
     void ProcessContacts();
 
   private:
+    /// Advance the frozen contact gaps by one sub-step, using the relative normal
+    /// velocity of the two bodies at each contact point (see smc_substeps in
+    /// ChSettings.h).
+    void host_ExtrapolateDepths(real h_sub);
+
     void host_CalcContactForces(custom_vector<int>& ext_body_id,
                                 custom_vector<real3>& ext_body_force,
                                 custom_vector<real3>& ext_body_torque,
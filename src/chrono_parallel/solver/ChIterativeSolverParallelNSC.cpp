@@ -107,6 +107,9 @@ void ChIterativeSolverParallelNSC::RunTimeStep() {
 
     PerformStabilization();
 
+    // Warm start the contact multipliers from the previous step, if enabled
+    PreSolve();
+
     if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL ||
         data_manager->settings.solver.solver_mode == SolverMode::SLIDING ||
         data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
@@ -115,12 +118,12 @@ void ChIterativeSolverParallelNSC::RunTimeStep() {
             SetR();
             LOG(INFO) << "ChIterativeSolverParallelNSC::RunTimeStep - Solve Normal";
             data_manager->measures.solver.total_iteration +=
-                solver->Solve(ShurProductFull,                                     //
-                              ProjectFull,                                         //
-                              data_manager->settings.solver.max_iteration_normal,  //
-                              data_manager->num_constraints,                       //
-                              data_manager->host_data.R,                           //
-                              data_manager->host_data.gamma);                      //
+                solver->SolveMixed(ShurProductFull,                                //
+                                   ProjectFull,                                    //
+                                   data_manager->settings.solver.max_iteration_normal,  //
+                                   data_manager->num_constraints,                  //
+                                   data_manager->host_data.R,                      //
+                                   data_manager->host_data.gamma);                 //
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::SLIDING ||
@@ -130,12 +133,12 @@ void ChIterativeSolverParallelNSC::RunTimeStep() {
             SetR();
             LOG(INFO) << "ChIterativeSolverParallelNSC::RunTimeStep - Solve Sliding";
             data_manager->measures.solver.total_iteration +=
-                solver->Solve(ShurProductFull,                                      //
-                              ProjectFull,                                          //
-                              data_manager->settings.solver.max_iteration_sliding,  //
-                              data_manager->num_constraints,                        //
-                              data_manager->host_data.R,                            //
-                              data_manager->host_data.gamma);                       //
+                solver->SolveMixed(ShurProductFull,                                 //
+                                   ProjectFull,                                     //
+                                   data_manager->settings.solver.max_iteration_sliding,  //
+                                   data_manager->num_constraints,                   //
+                                   data_manager->host_data.R,                       //
+                                   data_manager->host_data.gamma);                  //
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
@@ -144,12 +147,12 @@ void ChIterativeSolverParallelNSC::RunTimeStep() {
             SetR();
             LOG(INFO) << "ChIterativeSolverParallelNSC::RunTimeStep - Solve Spinning";
             data_manager->measures.solver.total_iteration +=
-                solver->Solve(ShurProductFull,                                       //
-                              ProjectFull,                                           //
-                              data_manager->settings.solver.max_iteration_spinning,  //
-                              data_manager->num_constraints,                         //
-                              data_manager->host_data.R,                             //
-                              data_manager->host_data.gamma);                        //
+                solver->SolveMixed(ShurProductFull,                                  //
+                                   ProjectFull,                                      //
+                                   data_manager->settings.solver.max_iteration_spinning,  //
+                                   data_manager->num_constraints,                    //
+                                   data_manager->host_data.R,                        //
+                                   data_manager->host_data.gamma);                   //
         }
     }
 
@@ -185,6 +188,11 @@ void ChIterativeSolverParallelNSC::RunTimeStep() {
 
     data_manager->system_timer.stop("ChIterativeSolverParallel_Solve");
 
+    // Record the contact state for cross-step warm starting
+    if (data_manager->settings.solver.use_contact_warm_start) {
+        SaveContactState();
+    }
+
     ComputeImpulses();
     for (int i = 0; i < data_manager->measures.solver.maxd_hist.size(); i++) {
         AtIterationEnd(data_manager->measures.solver.maxd_hist[i], data_manager->measures.solver.maxdeltalambda_hist[i],
@@ -421,7 +429,84 @@ void ChIterativeSolverParallelNSC::ComputeImpulses() {
 }
 
 void ChIterativeSolverParallelNSC::PreSolve() {
-    // Currently not supported, might be added back in the future
+    if (!data_manager->settings.solver.use_contact_warm_start) {
+        return;
+    }
+    uint num_rigid_contacts = data_manager->num_rigid_contacts;
+    if (num_rigid_contacts == 0 || m_last_contact_index.empty()) {
+        return;
+    }
+    LOG(INFO) << "ChIterativeSolverParallelNSC::PreSolve()";
+
+    const custom_vector<long long>& pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<real3>& cpta = data_manager->host_data.cpta_rigid_rigid;
+    DynamicVector<real>& gamma = data_manager->host_data.gamma;
+    const SolverMode mode = data_manager->settings.solver.solver_mode;
+
+    const real threshold = data_manager->settings.solver.warm_start_displacement_threshold;
+    const real dist2_max = threshold * threshold;
+
+    // Seed the multipliers of persisting contacts with the converged values of
+    // the previous step. Any seed is admissible as an APGD/BB initial iterate
+    // (the cone projection is applied before use), so contacts sharing a pair
+    // id simply reuse the recorded slot of that pair.
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_rigid_contacts; i++) {
+        auto match = m_last_contact_index.find(pairs[i]);
+        if (match == m_last_contact_index.end())
+            continue;
+        int j = match->second;
+        real3 delta = cpta[i] - m_last_points[j];
+        if (Dot(delta, delta) > dist2_max)
+            continue;
+        gamma[i] = m_last_gamma[j * 6 + 0];
+        if (mode == SolverMode::SLIDING || mode == SolverMode::SPINNING) {
+            gamma[num_rigid_contacts + 2 * i + 0] = m_last_gamma[j * 6 + 1];
+            gamma[num_rigid_contacts + 2 * i + 1] = m_last_gamma[j * 6 + 2];
+        }
+        if (mode == SolverMode::SPINNING) {
+            gamma[3 * num_rigid_contacts + 3 * i + 0] = m_last_gamma[j * 6 + 3];
+            gamma[3 * num_rigid_contacts + 3 * i + 1] = m_last_gamma[j * 6 + 4];
+            gamma[3 * num_rigid_contacts + 3 * i + 2] = m_last_gamma[j * 6 + 5];
+        }
+    }
+}
+
+void ChIterativeSolverParallelNSC::SaveContactState() {
+    uint num_rigid_contacts = data_manager->num_rigid_contacts;
+    const custom_vector<long long>& pairs = data_manager->host_data.contact_pairs;
+    const custom_vector<real3>& cpta = data_manager->host_data.cpta_rigid_rigid;
+    const DynamicVector<real>& gamma = data_manager->host_data.gamma;
+    const SolverMode mode = data_manager->settings.solver.solver_mode;
+
+    m_last_contact_index.clear();
+    m_last_contact_index.reserve(num_rigid_contacts);
+    m_last_points.resize(num_rigid_contacts);
+    // Always record all 6 lanes (zero for the lanes the current solver mode did
+    // not solve) so that a mode change across steps stays safe.
+    m_last_gamma.resize(num_rigid_contacts * 6);
+
+    for (uint i = 0; i < num_rigid_contacts; i++) {
+        m_last_contact_index[pairs[i]] = i;
+        m_last_points[i] = cpta[i];
+        m_last_gamma[i * 6 + 0] = gamma[i];
+        if (mode == SolverMode::SLIDING || mode == SolverMode::SPINNING) {
+            m_last_gamma[i * 6 + 1] = gamma[num_rigid_contacts + 2 * i + 0];
+            m_last_gamma[i * 6 + 2] = gamma[num_rigid_contacts + 2 * i + 1];
+        } else {
+            m_last_gamma[i * 6 + 1] = 0;
+            m_last_gamma[i * 6 + 2] = 0;
+        }
+        if (mode == SolverMode::SPINNING) {
+            m_last_gamma[i * 6 + 3] = gamma[3 * num_rigid_contacts + 3 * i + 0];
+            m_last_gamma[i * 6 + 4] = gamma[3 * num_rigid_contacts + 3 * i + 1];
+            m_last_gamma[i * 6 + 5] = gamma[3 * num_rigid_contacts + 3 * i + 2];
+        } else {
+            m_last_gamma[i * 6 + 3] = 0;
+            m_last_gamma[i * 6 + 4] = 0;
+            m_last_gamma[i * 6 + 5] = 0;
+        }
+    }
 }
 
 void ChIterativeSolverParallelNSC::ChangeSolverType(SolverType type) {
@@ -437,6 +522,9 @@ void ChIterativeSolverParallelNSC::ChangeSolverType(SolverType type) {
         case SolverType::APGDREF:
             solver = new ChSolverParallelAPGDREF();
             break;
+        case SolverType::APGDGPU:
+            solver = new ChSolverParallelAPGDGPU();
+            break;
         case SolverType::BB:
             solver = new ChSolverParallelBB();
             break;
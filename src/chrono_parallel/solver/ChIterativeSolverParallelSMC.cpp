@@ -33,13 +33,40 @@
 #include <thrust/system/tbb/execution_policy.h>
 #endif
 
-#if defined _WIN32
 #include <cstdint>
+
+#if defined _WIN32
+#include <intrin.h>
 #endif
 
 
 using namespace chrono;
 
+// -----------------------------------------------------------------------------
+// Hash function for a contact pair id, used to index the open-addressing table
+// over shear history slots.
+// -----------------------------------------------------------------------------
+static inline uint hash_shear_pair(int body1, int body2, int shape1, int shape2, uint mask) {
+    uint64_t h = (uint64_t)(uint)body1 * 0x9E3779B97F4A7C15ULL;
+    h ^= (uint64_t)(uint)body2 * 0xBF58476D1CE4E5B9ULL;
+    h ^= (uint64_t)(uint)shape1 * 0x94D049BB133111EBULL;
+    h ^= (uint64_t)(uint)shape2 * 0xD6E8FEB86659FD93ULL;
+    h ^= h >> 33;
+    return (uint)h & mask;
+}
+
+// -----------------------------------------------------------------------------
+// Portable compare-and-swap on int, used when inserting into the shear history
+// hash table from concurrent threads.
+// -----------------------------------------------------------------------------
+static inline bool shear_hash_CAS(int* addr, int expected, int desired) {
+#if defined _WIN32
+    return _InterlockedCompareExchange((volatile long*)addr, desired, expected) == expected;
+#else
+    return __sync_bool_compare_and_swap(addr, expected, desired);
+#endif
+}
+
 // -----------------------------------------------------------------------------
 // Main worker function for calculating contact forces. Calculates the contact
 // force and torque for the contact pair identified by 'index' and stores them
@@ -77,6 +104,9 @@ void function_CalcContactForces(
     vec3* shear_neigh,      // neighbor list of contacting bodies and shapes (max_shear per body)
     char* shear_touch,      // flag if contact in neighbor list is persistent (max_shear per body)
     real3* shear_disp,      // accumulated shear displacement for each neighbor (max_shear per body)
+    int* shear_hash,        // hash table over pair ids with indices of occupied history slots
+    uint shear_hash_mask,   // size of the hash table minus one
+
     int* ext_body_id,       // [output] body IDs (two per contact)
     real3* ext_body_force,  // [output] body force (two per contact)
     real3* ext_body_torque  // [output] body torque (two per contact)
@@ -198,16 +228,22 @@ void function_CalcContactForces(
         shear_shape1 = (int)Max(shape1, shape2);
         shear_shape2 = (int)Min(shape1, shape2);
 
-        // Check if contact history already exists.
-        // If not, initialize new contact history.
-        for (i = 0; i < max_shear; i++) {
-            int ctIdUnrolled = max_shear * shear_body1 + i;
-            if (shear_neigh[ctIdUnrolled].x == shear_body2 && shear_neigh[ctIdUnrolled].y == shear_shape1 &&
-                shear_neigh[ctIdUnrolled].z == shear_shape2) {
-                contact_id = i;
+        // Check if contact history already exists, by probing the hash table
+        // over pair ids. Entries hold indices of occupied history slots, so a
+        // candidate slot is verified against the stored pair before acceptance.
+        // If no history exists, initialize new contact history.
+        uint h = hash_shear_pair(shear_body1, shear_body2, shear_shape1, shear_shape2, shear_hash_mask);
+        for (i = 0; i <= (signed)shear_hash_mask; i++) {
+            int slot = shear_hash[h];
+            if (slot == -1)
+                break;
+            if (slot / max_shear == shear_body1 && shear_neigh[slot].x == shear_body2 &&
+                shear_neigh[slot].y == shear_shape1 && shear_neigh[slot].z == shear_shape2) {
+                contact_id = slot - max_shear * shear_body1;
                 newcontact = false;
                 break;
             }
+            h = (h + 1) & shear_hash_mask;
         }
         if (newcontact == true) {
             for (i = 0; i < max_shear; i++) {
@@ -451,7 +487,8 @@ void ChIterativeSolverParallelSMC::host_CalcContactForces(custom_vector<int>& ex
             data_manager->host_data.cptb_rigid_rigid.data(), data_manager->host_data.norm_rigid_rigid.data(),
             data_manager->host_data.dpth_rigid_rigid.data(), data_manager->host_data.erad_rigid_rigid.data(),
             data_manager->host_data.shear_neigh.data(), shear_touch.data(), data_manager->host_data.shear_disp.data(),
-            ext_body_id.data(), ext_body_force.data(), ext_body_torque.data());
+            data_manager->host_data.shear_hash.data(), data_manager->host_data.shear_hash_mask, ext_body_id.data(),
+            ext_body_force.data(), ext_body_torque.data());
     }
 }
 
@@ -490,6 +527,41 @@ void ChIterativeSolverParallelSMC::host_SetContactForcesMap(uint ct_body_count,
     }
 }
 
+// -----------------------------------------------------------------------------
+// Advance the frozen contact gaps by one sub-step, using the relative normal
+// velocity of the two bodies at each contact point (see smc_substeps).
+// -----------------------------------------------------------------------------
+void ChIterativeSolverParallelSMC::host_ExtrapolateDepths(real h_sub) {
+    const real3* pos = data_manager->host_data.pos_rigid.data();
+    const quaternion* rot = data_manager->host_data.rot_rigid.data();
+    const DynamicVector<real>& vel = data_manager->host_data.v;
+    const vec2* body_id = data_manager->host_data.bids_rigid_rigid.data();
+    const real3* pt1 = data_manager->host_data.cpta_rigid_rigid.data();
+    const real3* pt2 = data_manager->host_data.cptb_rigid_rigid.data();
+    real3* normal = data_manager->host_data.norm_rigid_rigid.data();
+    real* depth = data_manager->host_data.dpth_rigid_rigid.data();
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)data_manager->num_rigid_contacts; index++) {
+        int body1 = body_id[index].x;
+        int body2 = body_id[index].y;
+
+        real3 pt1_loc = TransformParentToLocal(pos[body1], rot[body1], pt1[index]);
+        real3 pt2_loc = TransformParentToLocal(pos[body2], rot[body2], pt2[index]);
+
+        real3 v_body1 = real3(vel[body1 * 6 + 0], vel[body1 * 6 + 1], vel[body1 * 6 + 2]);
+        real3 v_body2 = real3(vel[body2 * 6 + 0], vel[body2 * 6 + 1], vel[body2 * 6 + 2]);
+
+        real3 o_body1 = real3(vel[body1 * 6 + 3], vel[body1 * 6 + 4], vel[body1 * 6 + 5]);
+        real3 o_body2 = real3(vel[body2 * 6 + 3], vel[body2 * 6 + 4], vel[body2 * 6 + 5]);
+
+        real3 vel1 = v_body1 + Rotate(Cross(o_body1, pt1_loc), rot[body1]);
+        real3 vel2 = v_body2 + Rotate(Cross(o_body2, pt2_loc), rot[body2]);
+
+        depth[index] += Dot(vel2 - vel1, normal[index]) * h_sub;
+    }
+}
+
 // Binary operation for adding two-object tuples
 struct sum_tuples {
     thrust::tuple<real3, real3> operator()(const thrust::tuple<real3, real3>& a,
@@ -525,6 +597,40 @@ void ChIterativeSolverParallelSMC::ProcessContacts() {
                            int(data_manager->host_data.contact_pairs[i] & 0xffffffff));
             shape_pairs[i] = pair;
         }
+
+        // Rebuild the open-addressing hash table over pair ids from the occupied
+        // history slots, so that history matching in the force calculation is a
+        // O(1) probe instead of a scan over the neighbor list.
+        uint num_slots = max_shear * data_manager->num_rigid_bodies;
+        vec3* shear_neigh = data_manager->host_data.shear_neigh.data();
+
+        int num_occupied = 0;
+#pragma omp parallel for reduction(+ : num_occupied)
+        for (int slot = 0; slot < (signed)num_slots; slot++) {
+            if (shear_neigh[slot].x != -1)
+                num_occupied++;
+        }
+
+        // Size the table to a power of two with load factor at most 1/2.
+        uint capacity = 64;
+        while (capacity < (uint)(2 * num_occupied))
+            capacity <<= 1;
+
+        custom_vector<int>& shear_hash = data_manager->host_data.shear_hash;
+        shear_hash.resize(capacity);
+        Thrust_Fill(shear_hash, -1);
+        data_manager->host_data.shear_hash_mask = capacity - 1;
+
+        int* hash_table = shear_hash.data();
+#pragma omp parallel for
+        for (int slot = 0; slot < (signed)num_slots; slot++) {
+            if (shear_neigh[slot].x == -1)
+                continue;
+            uint h = hash_shear_pair(slot / max_shear, shear_neigh[slot].x, shear_neigh[slot].y, shear_neigh[slot].z,
+                                     capacity - 1);
+            while (!shear_hash_CAS(&hash_table[h], -1, slot))
+                h = (h + 1) & (capacity - 1);
+        }
     }
 
     host_CalcContactForces(ext_body_id, ext_body_force, ext_body_torque, shape_pairs, shear_touch);
@@ -544,8 +650,19 @@ void ChIterativeSolverParallelSMC::ProcessContacts() {
     //    involved in at least one contact, by reducing the contact forces and
     //    torques from all contacts these bodies are involved in. The number of
     //    bodies that experience at least one contact is 'ct_body_count'.
-    thrust::sort_by_key(THRUST_PAR ext_body_id.begin(), ext_body_id.end(),
-                        thrust::make_zip_iterator(thrust::make_tuple(ext_body_force.begin(), ext_body_torque.begin())));
+    // In deterministic mode use a stable sort so that the per-contact force and
+    // torque contributions of each body keep contact-list order; the segmented
+    // reduction below then accumulates them in the same floating point order
+    // regardless of the number of threads.
+    if (data_manager->settings.deterministic) {
+        thrust::stable_sort_by_key(
+            THRUST_PAR ext_body_id.begin(), ext_body_id.end(),
+            thrust::make_zip_iterator(thrust::make_tuple(ext_body_force.begin(), ext_body_torque.begin())));
+    } else {
+        thrust::sort_by_key(
+            THRUST_PAR ext_body_id.begin(), ext_body_id.end(),
+            thrust::make_zip_iterator(thrust::make_tuple(ext_body_force.begin(), ext_body_torque.begin())));
+    }
 
     custom_vector<int> ct_body_id(data_manager->num_rigid_bodies);
     custom_vector<real3>& ct_body_force = data_manager->host_data.ct_body_force;
@@ -652,14 +769,55 @@ void ChIterativeSolverParallelSMC::RunTimeStep() {
     data_manager->host_data.ct_body_map.resize(data_manager->num_rigid_bodies);
     Thrust_Fill(data_manager->host_data.ct_body_map, -1);
 
-    if (data_manager->num_rigid_contacts > 0) {
+    int substeps = data_manager->settings.solver.smc_substeps;
+
+    if (data_manager->num_rigid_contacts > 0 && substeps > 1) {
+        // Sub-cycling (see smc_substeps in ChSettings.h): the contact set from the
+        // last collision detection stays frozen while the contact forces are
+        // evaluated 'substeps' times at the internal step. Between evaluations the
+        // body velocities respond to the accumulated contact impulses (with the
+        // external impulses prorated over the macro step) and the contact gaps are
+        // extrapolated from the relative normal velocities.
         data_manager->system_timer.start("ChIterativeSolverParallelSMC_ProcessContact");
-        ProcessContacts();
+
+        // Generate the mass matrix and compute M_inv_k
+        ComputeInvMassMatrix();
+
+        const real h = data_manager->settings.step_size;
+        const real h_sub = h / substeps;
+        const CompressedMatrix<real>& M_inv = data_manager->host_data.M_inv;
+
+        DynamicVector<real> v_macro = data_manager->host_data.v;
+        DynamicVector<real> hf_ext = data_manager->host_data.hf;
+
+        data_manager->settings.step_size = h_sub;
+        for (int k = 0; k < substeps; k++) {
+            ProcessContacts();
+            if (k < substeps - 1) {
+                real frac = real(k + 1) / substeps;
+                data_manager->host_data.v =
+                    v_macro + M_inv * (data_manager->host_data.hf - (1 - frac) * hf_ext);
+                host_ExtrapolateDepths(h_sub);
+            }
+        }
+        data_manager->settings.step_size = h;
+
+        // Restore the macro-step velocities; the full impulse (external plus all
+        // sub-step contact contributions) is applied through M_invk below.
+        data_manager->host_data.v = v_macro;
+        data_manager->host_data.M_invk = v_macro + M_inv * data_manager->host_data.hf;
+
         data_manager->system_timer.stop("ChIterativeSolverParallelSMC_ProcessContact");
-    }
+    } else {
+        if (data_manager->num_rigid_contacts > 0) {
+            data_manager->system_timer.start("ChIterativeSolverParallelSMC_ProcessContact");
+            ProcessContacts();
+            data_manager->system_timer.stop("ChIterativeSolverParallelSMC_ProcessContact");
+        }
 
-    // Generate the mass matrix and compute M_inv_k
-    ComputeInvMassMatrix();
+        // Generate the mass matrix and compute M_inv_k
+        ComputeInvMassMatrix();
+    }
 
     // If there are (bilateral) constraints, calculate Lagrange multipliers.
     if (data_manager->num_constraints != 0) {
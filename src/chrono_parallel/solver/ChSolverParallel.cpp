@@ -50,6 +50,91 @@ void ChSolverParallel::ComputeSRhs(custom_vector<real>& gamma,
     // rigid_rigid->ComputeS(rhs, vel_data, omg_data, b);
 }
 
+uint ChSolverParallel::SolveMixed(ChShurProduct& ShurProduct,
+                                  ChProjectConstraints& Project,
+                                  const uint max_iter,
+                                  const uint size,
+                                  const DynamicVector<real>& b,
+                                  DynamicVector<real>& x) {
+    if (data_manager->settings.solver.use_mixed_precision == false || size == 0) {
+        return Solve(ShurProduct, Project, max_iter, size, b, x);
+    }
+
+    shur_mixed.Setup(data_manager);
+
+    // Same residual measure as the solvers use internally, but evaluated with
+    // the full precision operator.
+    real g_diff = 1.0 / pow(size, 2.0);
+    DynamicVector<real> N_x(size), temp(size);
+
+    uint batch = data_manager->settings.solver.mixed_precision_refine;
+    if (batch == 0 || batch > max_iter) {
+        batch = max_iter;
+    }
+
+    uint total_iterations = 0;
+    while (total_iterations < max_iter) {
+        uint inner_iter = (batch < max_iter - total_iterations) ? batch : max_iter - total_iterations;
+        uint performed = Solve(shur_mixed, Project, inner_iter, size, b, x);
+        total_iterations += performed;
+
+        // Correction step: recompute the projected gradient residual in double
+        // precision. The inner solver, warm-started from the current iterate,
+        // keeps going until this residual (not its single precision estimate)
+        // meets the tolerance, which removes the drift seen when the whole
+        // solve runs in single precision.
+        ShurProduct(x, N_x);
+        temp = x - g_diff * (N_x - b);
+        Project(temp.data());
+        temp = (1.0 / g_diff) * (x - temp);
+        real residual = Sqrt((real)(temp, temp));
+        data_manager->measures.solver.residual = residual;
+
+        if (residual < data_manager->settings.solver.tol_speed) {
+            break;
+        }
+        // The inner solver converged against its own (single precision)
+        // residual; more restarts cannot make progress.
+        if (performed < inner_iter) {
+            break;
+        }
+    }
+    return total_iterations;
+}
+
+void ChShurProductMixed::Setup(ChParallelDataManager* data_container_) {
+    ChShurProduct::Setup(data_container_);
+    // Downcast the constraint matrices once; the inner iterations then perform
+    // every product in single precision.
+    if (data_manager->settings.solver.compute_N) {
+        Nshur32 = data_manager->host_data.Nshur;
+    } else {
+        D_T32 = data_manager->host_data.D_T;
+        M_invD32 = data_manager->host_data.M_invD;
+    }
+    E32 = data_manager->host_data.E;
+}
+
+void ChShurProductMixed::operator()(const DynamicVector<real>& x, DynamicVector<real>& output) {
+    // The sub-mode solves work on submatrix views of the full precision data;
+    // defer those to the full precision product.
+    if (data_manager->settings.solver.local_solver_mode != data_manager->settings.solver.solver_mode) {
+        ChShurProduct::operator()(x, output);
+        return;
+    }
+    data_manager->system_timer.start("ShurProduct");
+
+    x32 = x;
+    if (data_manager->settings.solver.compute_N) {
+        AX32 = Nshur32 * x32 + E32 * x32;
+    } else {
+        AX32 = D_T32 * (M_invD32 * x32) + E32 * x32;
+    }
+    output = AX32;
+
+    data_manager->system_timer.stop("ShurProduct");
+}
+
 bool init_eigen_vec = 0;
 
 real ChSolverParallel::LargestEigenValue(ChShurProduct& ShurProduct, DynamicVector<real>& temp, real lambda) {
@@ -95,6 +95,25 @@ class CH_PARALLEL_API ChShurProductFEM : public ChShurProduct {
     CompressedMatrix<real> NshurB;
 };
 
+/// Functor class for performing the Shur product in single precision.
+/// Setup() downcasts the constraint matrices to float once per step; every
+/// product then reads half the memory of the full precision operator, which is
+/// where bandwidth-bound solvers spend most of their time. Intended to be used
+/// together with the double precision residual correction in
+/// ChSolverParallel::SolveMixed, never on its own.
+class CH_PARALLEL_API ChShurProductMixed : public ChShurProduct {
+  public:
+    ChShurProductMixed() {}
+    virtual ~ChShurProductMixed() {}
+    virtual void Setup(ChParallelDataManager* data_container_);
+
+    /// Perform the Shur Product.
+    virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX);
+
+    CompressedMatrix<float> Nshur32, D_T32, M_invD32;
+    DynamicVector<float> E32, x32, AX32;
+};
+
 //========================================================================================================
 
 /// Base class for all Chrono::Parallel solvers.
@@ -121,6 +140,21 @@ class CH_PARALLEL_API ChSolverParallel {
                        DynamicVector<real>& x         ///< The vector of unknowns
                        ) = 0;
 
+    /// Solve the system in mixed precision: the inner iterations run with a
+    /// single precision Shur product while convergence is measured with the
+    /// full precision operator. The inner solver is restarted, warm-started
+    /// from the current iterate, every mixed_precision_refine iterations until
+    /// the double precision residual meets the tolerance or the iteration
+    /// budget is exhausted. Falls back to a plain Solve when mixed precision
+    /// is disabled in the settings.
+    uint SolveMixed(ChShurProduct& ShurProduct,    ///< Schur product (full precision)
+                    ChProjectConstraints& Project, ///< Constraints
+                    const uint max_iter,           ///< Maximum number of iterations
+                    const uint size,               ///< Number of unknowns
+                    const DynamicVector<real>& b,  ///< Rhs vector
+                    DynamicVector<real>& x         ///< The vector of unknowns
+                    );
+
     void AtIterationEnd(real maxd, real maxdeltalambda) {
         data_manager->measures.solver.maxd_hist.push_back(maxd);
         data_manager->measures.solver.maxdeltalambda_hist.push_back(maxdeltalambda);
@@ -139,6 +173,8 @@ class CH_PARALLEL_API ChSolverParallel {
     ChParallelDataManager* data_manager;  ///< Pointer to the system's data manager
 
     DynamicVector<real> eigen_vec;
+
+    ChShurProductMixed shur_mixed;  ///< Single precision Shur product used by SolveMixed
 };
 
 //========================================================================================================
@@ -198,6 +234,34 @@ class CH_PARALLEL_API ChSolverParallelAPGD : public ChSolverParallel {
     real dot_g_temp, norm_ms;
 };
 
+/// Accelerated Projected Gradient Descent (APGD) solver, resident on the GPU.
+/// The Schur product, cone projection, vector updates and reductions all run
+/// on the device; only scalar reduction results cross the bus during the
+/// iteration and the multipliers are transferred once at convergence. Only
+/// active in CUDA builds (USE_PARALLEL_CUDA) and requires compute_N; solves
+/// the device path cannot handle (spinning friction, 3-DOF containers,
+/// sub-mode solves) fall back to the OpenMP APGD implementation.
+class CH_PARALLEL_API ChSolverParallelAPGDGPU : public ChSolverParallel {
+  public:
+    ChSolverParallelAPGDGPU() : ChSolverParallel() {}
+    ~ChSolverParallelAPGDGPU() {}
+
+    /// Solve using the APGD method on the GPU.
+    uint Solve(ChShurProduct& ShurProduct,    ///< Schur product
+               ChProjectConstraints& Project, ///< Constraints
+               const uint max_iter,           ///< Maximum number of iterations
+               const uint size,               ///< Number of unknowns
+               const DynamicVector<real>& b,  ///< Rhs vector
+               DynamicVector<real>& x         ///< The vector of unknowns
+               );
+
+    ChSolverParallelAPGD cpu_solver;  ///< fallback used when the solve cannot stay on the device
+
+    /// Host staging buffers for the CSR form of N, kept across steps.
+    std::vector<int> N_rows, N_cols;
+    std::vector<real> N_vals, E_host, r_host, coh_host, mu_host, gamma_host;
+};
+
 /// Barzilai-Borwein solver.
 class CH_PARALLEL_API ChSolverParallelBB : public ChSolverParallel {
   public:
@@ -215,6 +279,13 @@ class CH_PARALLEL_API ChSolverParallelBB : public ChSolverParallel {
 
     void UpdateR();
 
+    /// Assemble the block-diagonal preconditioner used when settings.solver.precondition
+    /// is enabled: the diagonal of the Schur complement is computed row by row from D_T
+    /// and M_inv (plus the compliance E), then inverted into a per-row scaling that is
+    /// uniform over all rows of one contact, so the friction and rolling cones are
+    /// preserved under the scaled projection.
+    void ComputeDiagonalPreconditioner(const uint size);
+
     // BB specific vectors
     DynamicVector<real> temp, ml, mg, mg_p, ml_candidate, ms, my, mdir, ml_p;
     DynamicVector<real> mD, invmD;
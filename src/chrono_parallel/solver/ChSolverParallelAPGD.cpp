@@ -12,6 +12,8 @@
 // Authors: Hammad Mazhar
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_parallel/solver/ChSolverParallel.h"
 
 using namespace chrono;
@@ -133,6 +135,16 @@ uint ChSolverParallelAPGD::Solve(ChShurProduct& ShurProduct,
         }
     }
 
+    // Interval residual checking: the full residual below costs an extra
+    // projection pass per iteration, so when skip_residual > 1 it is only
+    // computed every residual_interval iterations. The interval doubles (up to
+    // the setting) while the residual is far from the tolerance and collapses
+    // back to 1 close to it; between full checks a cheap max-delta probe on
+    // the step forces an early check when the iterate stagnates.
+    const int residual_skip = std::max(1, data_manager->settings.solver.skip_residual);
+    int residual_interval = 1;
+    int next_residual_check = 0;
+
     t = 1.0 / L;
     y = gamma;
     // If no iterations are performed or the residual is NAN (which is shouldnt be)
@@ -165,28 +177,51 @@ uint ChSolverParallelAPGD::Solve(ChShurProduct& ShurProduct,
         y = beta_new * temp + gamma_new;
         dot_g_temp = (g, temp);
 
-        // Compute the residual
-        temp = gamma_new - g_diff * (N_gamma_new - r);
-        real temp_dota = (real)(temp, temp);
-        // ಠ_ಠ THIS PROJECTION IS IMPORTANT! (╯°□°)╯︵ ┻━┻
-        // If turned off the residual will be very incorrect! Turning it off can cause the solver to effectively use the
-        // solution found in the first step because the residual never get's smaller. (You can convince yourself of this
-        // by
-        // looking at the objective function value and watch it decrease while the residual and the current solution
-        // remain
-        // the same.)
-        Project(temp.data());
-        temp = (1.0 / g_diff) * (gamma_new - temp);
-        real temp_dotb = (real)(temp, temp);
-        real res = Sqrt(temp_dotb);
-
-        if (res < residual) {
-            residual = res;
-            gamma_hat = gamma_new;
-
-            // Compute the objective value
-            temp = 0.5 * N_gamma_new - r;
-            objective_value = (gamma_new, temp);
+        bool full_residual =
+            current_iteration >= next_residual_check || current_iteration == (signed)max_iter - 1;
+        if (!full_residual) {
+            // L * max|gamma_new - gamma| bounds the gradient change of this
+            // step; when it drops below the tolerance the solver may have
+            // converged, so measure for real.
+            real max_delta = 0;
+            for (uint i = 0; i < size; i++)
+                max_delta = Max(max_delta, Abs(temp[i]));
+            if (L * max_delta <= data_manager->settings.solver.tol_speed)
+                full_residual = true;
+        }
+
+        if (full_residual) {
+            // Compute the residual
+            temp = gamma_new - g_diff * (N_gamma_new - r);
+            real temp_dota = (real)(temp, temp);
+            // ಠ_ಠ THIS PROJECTION IS IMPORTANT! (╯°□°)╯︵ ┻━┻
+            // If turned off the residual will be very incorrect! Turning it off can cause the solver to effectively use
+            // the
+            // solution found in the first step because the residual never get's smaller. (You can convince yourself of
+            // this
+            // by
+            // looking at the objective function value and watch it decrease while the residual and the current solution
+            // remain
+            // the same.)
+            Project(temp.data());
+            temp = (1.0 / g_diff) * (gamma_new - temp);
+            real temp_dotb = (real)(temp, temp);
+            real res = Sqrt(temp_dotb);
+
+            if (res < residual) {
+                residual = res;
+                gamma_hat = gamma_new;
+
+                // Compute the objective value
+                temp = 0.5 * N_gamma_new - r;
+                objective_value = (gamma_new, temp);
+            }
+
+            if (residual > 100.0 * data_manager->settings.solver.tol_speed)
+                residual_interval = std::min(2 * residual_interval, residual_skip);
+            else
+                residual_interval = 1;
+            next_residual_check = current_iteration + residual_interval;
         }
 
         AtIterationEnd(residual, objective_value);
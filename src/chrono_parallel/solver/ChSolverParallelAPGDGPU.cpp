@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Hammad Mazhar
+// =============================================================================
+
+#include "chrono_parallel/solver/ChSolverParallel.h"
+
+#ifdef CHRONO_PARALLEL_USE_CUDA
+#include "chrono_parallel/solver/ChSolverParallelAPGDGPU.cuh"
+#endif
+
+using namespace chrono;
+
+uint ChSolverParallelAPGDGPU::Solve(ChShurProduct& ShurProduct,
+                                    ChProjectConstraints& Project,
+                                    const uint max_iter,
+                                    const uint size,
+                                    const DynamicVector<real>& r,
+                                    DynamicVector<real>& gamma) {
+    if (size == 0) {
+        return 0;
+    }
+
+#ifdef CHRONO_PARALLEL_USE_CUDA
+    const solver_settings& settings = data_manager->settings.solver;
+    uint num_contacts = data_manager->num_rigid_contacts;
+
+    // The device path works on the assembled N with the rigid contact cone
+    // projection; everything else (spinning friction, 3-DOF containers,
+    // sub-mode solves) runs on the host implementation.
+    bool on_device = settings.compute_N &&                                                            //
+                     settings.local_solver_mode == settings.solver_mode &&                            //
+                     (settings.solver_mode == SolverMode::NORMAL ||                                   //
+                      settings.solver_mode == SolverMode::SLIDING) &&                                 //
+                     data_manager->num_constraints ==                                                 //
+                         data_manager->num_unilaterals + data_manager->num_bilaterals;                //
+
+    if (on_device) {
+        data_manager->system_timer.start("ChSolverParallel_Solve");
+
+        // Flatten the Schur complement into CSR form for the device.
+        const CompressedMatrix<real>& N = data_manager->host_data.Nshur;
+        N_rows.resize(size + 1);
+        N_cols.clear();
+        N_vals.clear();
+        N_cols.reserve(N.nonZeros());
+        N_vals.reserve(N.nonZeros());
+        for (uint i = 0; i < size; i++) {
+            N_rows[i] = (int)N_cols.size();
+            for (auto it = N.begin(i); it != N.end(i); ++it) {
+                N_cols.push_back((int)it->index());
+                N_vals.push_back(it->value());
+            }
+        }
+        N_rows[size] = (int)N_cols.size();
+
+        E_host.resize(size);
+        r_host.resize(size);
+        gamma_host.resize(size);
+        for (uint i = 0; i < size; i++) {
+            E_host[i] = data_manager->host_data.E[i];
+            r_host[i] = r[i];
+            gamma_host[i] = gamma[i];
+        }
+        coh_host.resize(num_contacts);
+        mu_host.resize(num_contacts);
+        for (uint i = 0; i < num_contacts; i++) {
+            coh_host[i] = data_manager->host_data.coh_rigid_rigid[i];
+            mu_host[i] = data_manager->host_data.fric_rigid_rigid[i].x;
+        }
+
+        real residual = 0, objective = 0;
+        current_iteration = APGD_SolveGPU(max_iter, size, num_contacts,                        //
+                                          settings.solver_mode == SolverMode::SLIDING,        //
+                                          settings.tol_speed,                                 //
+                                          N_rows, N_cols, N_vals, E_host, r_host,             //
+                                          coh_host, mu_host, gamma_host,                      //
+                                          residual, objective);
+
+        for (uint i = 0; i < size; i++) {
+            gamma[i] = gamma_host[i];
+        }
+        data_manager->measures.solver.residual = residual;
+        data_manager->measures.solver.objective_value = objective;
+        // The per iteration history stays on the device; record the final state.
+        AtIterationEnd(residual, objective);
+
+        data_manager->system_timer.stop("ChSolverParallel_Solve");
+        return current_iteration;
+    }
+#endif
+
+    cpu_solver.Setup(data_manager);
+    return cpu_solver.Solve(ShurProduct, Project, max_iter, size, r, gamma);
+}
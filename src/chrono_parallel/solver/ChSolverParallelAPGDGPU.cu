@@ -0,0 +1,380 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Hammad Mazhar
+// =============================================================================
+
+#include "chrono_parallel/solver/ChSolverParallelAPGDGPU.cuh"
+#include "chrono_parallel/ChCudaHelper.cuh"
+#include "chrono_parallel/ChGPUVector.cuh"
+#include "chrono_thirdparty/cub/cub.cuh"
+
+namespace chrono {
+
+// Device copies of the problem and the solver work vectors. Persistent across
+// solves so that device memory is only reallocated when the problem grows.
+gpu_vector<int> d_N_rows, d_N_cols;
+gpu_vector<real> d_N_vals, d_E, d_r, d_coh, d_mu;
+gpu_vector<real> d_gamma, d_gamma_new, d_gamma_hat, d_y, d_g, d_N_y, d_N_gamma_new, d_temp;
+
+// Accumulator for the scalar reductions.
+__device__ real apgd_dot;
+
+CUDA_DEVICE inline real AtomicAddReal(real* address, real value) {
+#if defined(CHRONO_PARALLEL_USE_DOUBLE) && defined(__CUDA_ARCH__) && __CUDA_ARCH__ < 600
+    // atomicAdd on doubles only exists on sm_60 and newer; emulate with CAS.
+    unsigned long long int* address_as_ull = (unsigned long long int*)address;
+    unsigned long long int old = *address_as_ull, assumed;
+    do {
+        assumed = old;
+        old = atomicCAS(address_as_ull, assumed, __double_as_longlong(value + __longlong_as_double(assumed)));
+    } while (assumed != old);
+    return __longlong_as_double(old);
+#else
+    return atomicAdd(address, value);
+#endif
+}
+
+CUDA_GLOBAL void kResetDot() {
+    apgd_dot = 0;
+}
+
+// Reduce data into apgd_dot, one partial sum per block.
+CUDA_DEVICE inline void BlockAccumulate(real data, int num_items, int block_start) {
+    typedef cub::BlockReduce<real, num_threads_per_block> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    const int num_valid = min(num_items - block_start, (int)blockDim.x);
+    real block_sum = BlockReduce(temp_storage).Reduce(data, cub::Sum(), num_valid);
+    if (threadIdx.x == 0) {
+        AtomicAddReal(&apgd_dot, block_sum);
+    }
+}
+
+// out = N * x + E .* x, one row per thread.
+CUDA_GLOBAL void kShurProduct(int size,
+                              const int* rows,
+                              const int* cols,
+                              const real* vals,
+                              const real* E,
+                              const real* x,
+                              real* out) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        real sum = 0;
+        const int end = rows[i + 1];
+        for (int j = rows[i]; j < end; j++) {
+            sum += vals[j] * x[cols[j]];
+        }
+        out[i] = sum + E[i] * x[i];
+    }
+}
+
+// Device version of Cone_generalized_rigid (ChConstraintUtils.cpp).
+CUDA_DEVICE inline void ConeGeneralized(real& gamma_n, real& gamma_u, real& gamma_v, real mu) {
+    real f_tang = sqrt(gamma_u * gamma_u + gamma_v * gamma_v);
+
+    // inside upper cone? keep untouched!
+    if (f_tang < (mu * gamma_n)) {
+        return;
+    }
+
+    // inside lower cone? reset normal,u,v to zero!
+    if ((f_tang) < -(1 / mu) * gamma_n || (fabs(gamma_n) < 10e-15)) {
+        gamma_n = 0;
+        gamma_u = 0;
+        gamma_v = 0;
+        return;
+    }
+
+    // remaining case: project orthogonally to generator segment of upper cone
+    gamma_n = (f_tang * mu + gamma_n) / (mu * mu + 1);
+    real tproj_div_t = (gamma_n * mu) / f_tang;
+    gamma_u *= tproj_div_t;
+    gamma_v *= tproj_div_t;
+}
+
+// Project the contact multipliers, one thread per contact; mirrors
+// ChConstraintRigidRigid::func_Project_normal/sliding. Bilateral multipliers
+// are left untouched.
+CUDA_GLOBAL void kProject(int num_contacts, bool sliding, const real* coh, const real* mu, real* gamma) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < num_contacts) {
+        real coh_i = coh[i];
+        if (!sliding) {
+            real gamma_n = gamma[i];
+            gamma[i] = (gamma_n < -coh_i) ? -coh_i : gamma_n;
+            return;
+        }
+        real gamma_n = gamma[i];
+        real gamma_u = gamma[num_contacts + i * 2 + 0];
+        real gamma_v = gamma[num_contacts + i * 2 + 1];
+        real mu_i = mu[i];
+
+        if (mu_i == 0) {
+            gamma[i] = (gamma_n < -coh_i) ? -coh_i : gamma_n;
+            gamma[num_contacts + i * 2 + 0] = 0;
+            gamma[num_contacts + i * 2 + 1] = 0;
+            return;
+        }
+
+        gamma_n += coh_i;
+        ConeGeneralized(gamma_n, gamma_u, gamma_v, mu_i);
+        gamma[i] = gamma_n - coh_i;
+        gamma[num_contacts + i * 2 + 0] = gamma_u;
+        gamma[num_contacts + i * 2 + 1] = gamma_v;
+    }
+}
+
+CUDA_GLOBAL void kCompute_g(int size, const real* N_y, const real* r, real* g) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        g[i] = N_y[i] - r[i];
+    }
+}
+
+CUDA_GLOBAL void kGammaUpdate(int size, real t, const real* y, const real* g, real* gamma_new) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        gamma_new[i] = y[i] - t * g[i];
+    }
+}
+
+CUDA_GLOBAL void kSub(int size, const real* a, const real* b, real* out) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+CUDA_GLOBAL void kMinusOne(int size, const real* a, real* out) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        out[i] = a[i] - 1;
+    }
+}
+
+// y = gamma_new + beta * (gamma_new - gamma)
+CUDA_GLOBAL void kUpdateY(int size, real beta, const real* gamma_new, const real* gamma, real* y) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        y[i] = gamma_new[i] + beta * (gamma_new[i] - gamma[i]);
+    }
+}
+
+// temp = gamma_new - g_diff * (N_gamma_new - r)
+CUDA_GLOBAL void kResidualVec(int size,
+                              real g_diff,
+                              const real* gamma_new,
+                              const real* N_gamma_new,
+                              const real* r,
+                              real* temp) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < size) {
+        temp[i] = gamma_new[i] - g_diff * (N_gamma_new[i] - r[i]);
+    }
+}
+
+CUDA_GLOBAL void kDot(int size, const real* a, const real* b) {
+    const int block_start = blockDim.x * blockIdx.x;
+    const int i = block_start + threadIdx.x;
+    if (i < size) {
+        BlockAccumulate(a[i] * b[i], size, block_start);
+    }
+}
+
+// Accumulate (x, 0.5 * N_x - r), the objective value.
+CUDA_GLOBAL void kObjDot(int size, const real* x, const real* N_x, const real* r) {
+    const int block_start = blockDim.x * blockIdx.x;
+    const int i = block_start + threadIdx.x;
+    if (i < size) {
+        BlockAccumulate(x[i] * (0.5 * N_x[i] - r[i]), size, block_start);
+    }
+}
+
+// Accumulate (g + 0.5 * L * temp, temp), the line search bound.
+CUDA_GLOBAL void kLineSearchDot(int size, real L, const real* g, const real* temp) {
+    const int block_start = blockDim.x * blockIdx.x;
+    const int i = block_start + threadIdx.x;
+    if (i < size) {
+        BlockAccumulate((g[i] + 0.5 * L * temp[i]) * temp[i], size, block_start);
+    }
+}
+
+// Accumulate the squared norm of (gamma_new - temp) / g_diff, the residual.
+CUDA_GLOBAL void kResidualNorm(int size, real inv_g_diff, const real* gamma_new, const real* temp) {
+    const int block_start = blockDim.x * blockIdx.x;
+    const int i = block_start + threadIdx.x;
+    if (i < size) {
+        real d = (gamma_new[i] - temp[i]) * inv_g_diff;
+        BlockAccumulate(d * d, size, block_start);
+    }
+}
+
+static real ReadDot() {
+    real value;
+    cudaCheck(cudaMemcpyFromSymbol(&value, apgd_dot, sizeof(real)));
+    return value;
+}
+
+static real Dot(int size, const real* a, const real* b) {
+    kResetDot<<<1, 1>>>();
+    kDot<<<CONFIG(size)>>>(size, a, b);
+    return ReadDot();
+}
+
+static real ObjDot(int size, const real* x, const real* N_x, const real* r) {
+    kResetDot<<<1, 1>>>();
+    kObjDot<<<CONFIG(size)>>>(size, x, N_x, r);
+    return ReadDot();
+}
+
+template <typename T>
+static void Upload(gpu_vector<T>& device, const std::vector<T>& host) {
+    device.getHost() = host;
+    device.copyHostToDevice();
+}
+
+uint APGD_SolveGPU(const uint max_iter,
+                   const uint num_constraints,
+                   const uint num_contacts,
+                   const bool sliding,
+                   const real tol_speed,
+                   const std::vector<int>& N_rows,
+                   const std::vector<int>& N_cols,
+                   const std::vector<real>& N_vals,
+                   const std::vector<real>& E,
+                   const std::vector<real>& r,
+                   const std::vector<real>& coh,
+                   const std::vector<real>& mu,
+                   std::vector<real>& gamma,
+                   real& residual,
+                   real& objective) {
+    const int size = (int)num_constraints;
+
+    Upload(d_N_rows, N_rows);
+    Upload(d_N_cols, N_cols);
+    Upload(d_N_vals, N_vals);
+    Upload(d_E, E);
+    Upload(d_r, r);
+    Upload(d_coh, coh);
+    Upload(d_mu, mu);
+    Upload(d_gamma, gamma);
+
+    d_gamma_new.resize(size);
+    d_gamma_hat.resize(size);
+    d_y.resize(size);
+    d_g.resize(size);
+    d_N_y.resize(size);
+    d_N_gamma_new.resize(size);
+    d_temp.resize(size);
+
+    residual = 10e30;
+    objective = 0;
+    real g_diff = 1.0 / pow(size, 2.0);
+    real L, t;
+    real theta = 1, theta_new = 1, beta_new = 0;
+
+    // Estimate the initial step length exactly as the host solver does:
+    // L = ||N * (gamma - 1)|| / ||gamma - 1||.
+    kMinusOne<<<CONFIG(size)>>>(size, d_gamma.data_d, d_temp.data_d);
+    real norm_temp = Sqrt(Dot(size, d_temp.data_d, d_temp.data_d));
+    if (norm_temp == 0) {
+        L = 1.0;
+    } else {
+        kShurProduct<<<CONFIG(size)>>>(size, d_N_rows.data_d, d_N_cols.data_d, d_N_vals.data_d, d_E.data_d,
+                                       d_temp.data_d, d_N_y.data_d);
+        L = Sqrt(Dot(size, d_N_y.data_d, d_N_y.data_d)) / norm_temp;
+    }
+    if (L == 0) {
+        L = 1.0;
+    }
+    t = 1.0 / L;
+
+    d_y = d_gamma;
+    d_gamma_hat = d_gamma;
+
+    uint current_iteration = 0;
+    for (; current_iteration < max_iter; current_iteration++) {
+        kShurProduct<<<CONFIG(size)>>>(size, d_N_rows.data_d, d_N_cols.data_d, d_N_vals.data_d, d_E.data_d,
+                                       d_y.data_d, d_N_y.data_d);
+        kCompute_g<<<CONFIG(size)>>>(size, d_N_y.data_d, d_r.data_d, d_g.data_d);
+        kGammaUpdate<<<CONFIG(size)>>>(size, t, d_y.data_d, d_g.data_d, d_gamma_new.data_d);
+        kProject<<<CONFIG(num_contacts)>>>(num_contacts, sliding, d_coh.data_d, d_mu.data_d, d_gamma_new.data_d);
+        kShurProduct<<<CONFIG(size)>>>(size, d_N_rows.data_d, d_N_cols.data_d, d_N_vals.data_d, d_E.data_d,
+                                       d_gamma_new.data_d, d_N_gamma_new.data_d);
+
+        real obj2 = ObjDot(size, d_y.data_d, d_N_y.data_d, d_r.data_d);
+        kSub<<<CONFIG(size)>>>(size, d_gamma_new.data_d, d_y.data_d, d_temp.data_d);
+
+        // Backtrack on the step length until the quadratic upper bound holds.
+        while (true) {
+            real obj1 = ObjDot(size, d_gamma_new.data_d, d_N_gamma_new.data_d, d_r.data_d);
+            kResetDot<<<1, 1>>>();
+            kLineSearchDot<<<CONFIG(size)>>>(size, L, d_g.data_d, d_temp.data_d);
+            real bound = obj2 + ReadDot();
+            if (obj1 <= bound) {
+                break;
+            }
+            L = 2.0 * L;
+            t = 1.0 / L;
+            kGammaUpdate<<<CONFIG(size)>>>(size, t, d_y.data_d, d_g.data_d, d_gamma_new.data_d);
+            kProject<<<CONFIG(num_contacts)>>>(num_contacts, sliding, d_coh.data_d, d_mu.data_d, d_gamma_new.data_d);
+            kShurProduct<<<CONFIG(size)>>>(size, d_N_rows.data_d, d_N_cols.data_d, d_N_vals.data_d, d_E.data_d,
+                                           d_gamma_new.data_d, d_N_gamma_new.data_d);
+            kSub<<<CONFIG(size)>>>(size, d_gamma_new.data_d, d_y.data_d, d_temp.data_d);
+        }
+
+        theta_new = (-pow(theta, 2.0) + theta * Sqrt(pow(theta, 2.0) + 4.0)) / 2.0;
+        beta_new = theta * (1.0 - theta) / (pow(theta, 2.0) + theta_new);
+
+        kSub<<<CONFIG(size)>>>(size, d_gamma_new.data_d, d_gamma.data_d, d_temp.data_d);
+        kUpdateY<<<CONFIG(size)>>>(size, beta_new, d_gamma_new.data_d, d_gamma.data_d, d_y.data_d);
+        real dot_g_temp = Dot(size, d_g.data_d, d_temp.data_d);
+
+        // Compute the residual; the projection of the trial point is as
+        // important here as it is in the host solver.
+        kResidualVec<<<CONFIG(size)>>>(size, g_diff, d_gamma_new.data_d, d_N_gamma_new.data_d, d_r.data_d,
+                                       d_temp.data_d);
+        kProject<<<CONFIG(num_contacts)>>>(num_contacts, sliding, d_coh.data_d, d_mu.data_d, d_temp.data_d);
+        kResetDot<<<1, 1>>>();
+        kResidualNorm<<<CONFIG(size)>>>(size, 1.0 / g_diff, d_gamma_new.data_d, d_temp.data_d);
+        real res = Sqrt(ReadDot());
+
+        if (res < residual) {
+            residual = res;
+            d_gamma_hat = d_gamma_new;
+            objective = ObjDot(size, d_gamma_new.data_d, d_N_gamma_new.data_d, d_r.data_d);
+        }
+
+        if (residual < tol_speed) {
+            current_iteration++;
+            break;
+        }
+
+        if (dot_g_temp > 0) {
+            d_y = d_gamma_new;
+            theta_new = 1.0;
+        }
+
+        L = 0.9 * L;
+        t = 1.0 / L;
+        theta = theta_new;
+        d_gamma = d_gamma_new;
+    }
+
+    // The only vector transfer of the solve: bring back the best multipliers.
+    d_gamma_hat.copyDeviceToHost();
+    gamma.assign(d_gamma_hat.data_h.begin(), d_gamma_hat.data_h.begin() + size);
+
+    return current_iteration;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,51 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Hammad Mazhar
+// =============================================================================
+//
+// Description: Device resident APGD solve. Takes the Schur complement matrix
+// N = D^T M^-1 D in CSR form together with the compliance diagonal, rhs and
+// per contact friction data; runs the complete APGD loop (Schur product, cone
+// projection, reductions and vector updates) on the GPU and returns the
+// converged multipliers. Only scalar reduction results cross the bus during
+// the iteration; the multiplier vector is transferred once at the end.
+// =============================================================================
+
+#include <vector>
+
+#include "chrono_parallel/math/real.h"
+#include "chrono_parallel/math/other_types.h"
+
+namespace chrono {
+
+/// Solve the contact problem with APGD, fully resident on the device.
+/// The multiplier layout is [normal | tangential | bilateral]: num_contacts
+/// normal components followed, when sliding is true, by 2 * num_contacts
+/// tangential components; any remaining entries are bilateral multipliers and
+/// are not projected. Returns the number of iterations performed and reports
+/// the best residual and objective value seen.
+uint APGD_SolveGPU(const uint max_iter,              ///< maximum number of iterations
+                   const uint num_constraints,       ///< total number of unknowns
+                   const uint num_contacts,          ///< number of rigid contacts
+                   const bool sliding,               ///< project on the friction cone (SLIDING) or only clamp (NORMAL)
+                   const real tol_speed,             ///< residual termination tolerance
+                   const std::vector<int>& N_rows,   ///< CSR row offsets of N, size num_constraints + 1
+                   const std::vector<int>& N_cols,   ///< CSR column indices of N
+                   const std::vector<real>& N_vals,  ///< CSR values of N
+                   const std::vector<real>& E,       ///< compliance diagonal, added to the product
+                   const std::vector<real>& r,       ///< rhs vector
+                   const std::vector<real>& coh,     ///< per contact cohesion
+                   const std::vector<real>& mu,      ///< per contact sliding friction
+                   std::vector<real>& gamma,         ///< multipliers, in/out (warm start)
+                   real& residual,                   ///< best residual found
+                   real& objective);                 ///< objective value at the best iterate
+}
@@ -12,6 +12,8 @@
 // Authors: Hammad Mazhar
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_parallel/solver/ChSolverParallel.h"
 
 using namespace chrono;
@@ -99,6 +101,13 @@ uint ChSolverParallelAPGDREF::Solve(ChShurProduct& ShurProduct,
         t = 1;
     }
 
+    // Interval residual checking, see skip_residual in ChSettings.h. Res4 and
+    // the objective each cost a Shur product, so they are only evaluated every
+    // residual_interval iterations with an early check when the step stagnates.
+    const int residual_skip = std::max(1, data_manager->settings.solver.skip_residual);
+    int residual_interval = 1;
+    int next_residual_check = 0;
+
     // (7) for k := 0 to N_max
     for (current_iteration = 0; current_iteration < (signed)max_iter; current_iteration++) {
         // (8) g = N * y_k - r
@@ -149,29 +158,49 @@ uint ChSolverParallelAPGDREF::Solve(ChShurProduct& ShurProduct,
         // (17) y_(k+1) = gamma_(k+1) + Beta_(k+1) * (gamma_(k+1) - gamma_k)
         yNew = gammaNew + Beta * (gammaNew - gamma);
 
-        // (18) r = r(gamma_(k+1))
-        real res = Res4(ShurProduct, Project, gammaNew, r, tmp);
+        bool full_residual =
+            current_iteration >= next_residual_check || current_iteration == (signed)max_iter - 1;
+        if (!full_residual) {
+            // L * max|gamma_(k+1) - gamma_k| bounds the gradient change of this
+            // step; a small value means the iterate stagnated, so measure.
+            real max_delta = 0;
+            for (uint i = 0; i < size; i++)
+                max_delta = Max(max_delta, Abs(gammaNew[i] - gamma[i]));
+            if (L * max_delta <= data_manager->settings.solver.tol_speed)
+                full_residual = true;
+        }
+
+        if (full_residual) {
+            // (18) r = r(gamma_(k+1))
+            real res = Res4(ShurProduct, Project, gammaNew, r, tmp);
 
-        // (19) if r < epsilon_min
-        if (res < residual) {
-            // (20) r_min = r
-            residual = res;
+            // (19) if r < epsilon_min
+            if (res < residual) {
+                // (20) r_min = r
+                residual = res;
 
-            // (21) gamma_hat = gamma_(k+1)
-            gamma_hat = gammaNew;
+                // (21) gamma_hat = gamma_(k+1)
+                gamma_hat = gammaNew;
 
-            // (22) endif
+                // (22) endif
+            }
+
+            DynamicVector<real> Nl(gammaNew.size());
+            ShurProduct(gammaNew, Nl);         // 1)  g_tmp = N*l_candidate
+            Nl = 0.5 * Nl - r;                 // 2) 0.5*N*l_candidate-b_shur
+            objective_value = (gammaNew, Nl);  // 3)  mf_p  = l_candidate'*(0.5*N*l_candidate-b_shur)
+
+            if (residual > 100.0 * data_manager->settings.solver.tol_speed)
+                residual_interval = std::min(2 * residual_interval, residual_skip);
+            else
+                residual_interval = 1;
+            next_residual_check = current_iteration + residual_interval;
         }
 
         // (23) if r < Tau
         if (verbose)
             std::cout << "Residual: " << residual << ", Iter: " << current_iteration << std::endl;
 
-        DynamicVector<real> Nl(gammaNew.size());
-        ShurProduct(gammaNew, Nl);         // 1)  g_tmp = N*l_candidate
-        Nl = 0.5 * Nl - r;                 // 2) 0.5*N*l_candidate-b_shur
-        objective_value = (gammaNew, Nl);  // 3)  mf_p  = l_candidate'*(0.5*N*l_candidate-b_shur)
-
         AtIterationEnd(residual, objective_value);
         if (residual < data_manager->settings.solver.tol_speed) {
             // (24) break
@@ -12,6 +12,8 @@
 // Authors: Hammad Mazhar
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_parallel/solver/ChSolverParallel.h"
 
 using namespace chrono;
@@ -39,6 +41,70 @@ void ChSolverParallelBB::UpdateR() {
     R_n = -b_n - D_n_T * M_invk + s_n;
 }
 
+void ChSolverParallelBB::ComputeDiagonalPreconditioner(const uint size) {
+    const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
+    const CompressedMatrix<real>& M_inv = data_manager->host_data.M_inv;
+    const DynamicVector<real>& E = data_manager->host_data.E;
+
+    uint num_contacts = data_manager->num_rigid_contacts;
+    uint num_unilaterals = data_manager->num_unilaterals;
+
+    mD.resize(size);
+    invmD.resize(size);
+
+    // Diagonal of the Schur complement: d_i = row_i(D_T) * M_inv * row_i(D_T)^T + E_i.
+    // M_inv is block diagonal with 3x3 blocks, so only entry pairs within the same
+    // 3-DOF block can contribute.
+#pragma omp parallel for
+    for (int i = 0; i < (signed)size; i++) {
+        real d = 0;
+        for (auto it1 = D_T.begin(i); it1 != D_T.end(i); ++it1) {
+            for (auto it2 = D_T.begin(i); it2 != D_T.end(i); ++it2) {
+                if (it1->index() / 3 != it2->index() / 3)
+                    continue;
+                const auto m = M_inv.find(it1->index(), it2->index());
+                if (m != M_inv.end(it1->index()))
+                    d += it1->value() * m->value() * it2->value();
+            }
+        }
+        mD[i] = d + E[i];
+    }
+
+    // Invert into a scaling vector. All rows of one contact get the same scale
+    // (the inverse of the average diagonal over the contact block) so that the
+    // friction and rolling cones are invariant under the scaled projection;
+    // bilateral rows get plain Jacobi scaling.
+    bool spinning = data_manager->settings.solver.solver_mode == SolverMode::SPINNING;
+    if (size >= num_unilaterals) {
+#pragma omp parallel for
+        for (int i = 0; i < (signed)num_contacts; i++) {
+            real d = mD[i] + mD[num_contacts + i * 2 + 0] + mD[num_contacts + i * 2 + 1];
+            real rows = 3;
+            if (spinning) {
+                d += mD[3 * num_contacts + i * 3 + 0] + mD[3 * num_contacts + i * 3 + 1] +
+                     mD[3 * num_contacts + i * 3 + 2];
+                rows = 6;
+            }
+            real s = d > 0 ? rows / d : 1;
+            invmD[i] = s;
+            invmD[num_contacts + i * 2 + 0] = s;
+            invmD[num_contacts + i * 2 + 1] = s;
+            invmD[3 * num_contacts + i * 3 + 0] = s;
+            invmD[3 * num_contacts + i * 3 + 1] = s;
+            invmD[3 * num_contacts + i * 3 + 2] = s;
+        }
+#pragma omp parallel for
+        for (int i = (signed)num_unilaterals; i < (signed)size; i++) {
+            invmD[i] = mD[i] > 0 ? 1 / mD[i] : 1;
+        }
+    } else {
+#pragma omp parallel for
+        for (int i = 0; i < (signed)size; i++) {
+            invmD[i] = mD[i] > 0 ? 1 / mD[i] : 1;
+        }
+    }
+}
+
 uint ChSolverParallelBB::Solve(ChShurProduct& ShurProduct,
                                ChProjectConstraints& Project,
                                const uint max_iter,
@@ -101,7 +167,10 @@ uint ChSolverParallelBB::Solve(ChShurProduct& ShurProduct,
     }
     real gmma = 1e-4;
     real gdiff = 1.0 / pow(size, 2.0);
-    bool do_preconditioning = false;
+    bool do_preconditioning = data_manager->settings.solver.precondition;
+    if (do_preconditioning) {
+        ComputeDiagonalPreconditioner(size);
+    }
     real neg_BB1_fallback = 0.11;
     real neg_BB2_fallback = 0.12;
     ml = gamma;
@@ -119,9 +188,20 @@ uint ChSolverParallelBB::Solve(ChShurProduct& ShurProduct,
     std::vector<real> f_hist;
     // t1.stop();
 
+    // Interval residual checking, see skip_residual in ChSettings.h. The
+    // projected gradient norm below costs a cone projection and two vector
+    // passes, so it is only evaluated every residual_interval iterations with
+    // an early check when the step stagnates.
+    const int residual_skip = std::max(1, data_manager->settings.solver.skip_residual);
+    int residual_interval = 1;
+    int next_residual_check = 0;
+
     for (current_iteration = 0; current_iteration < (signed)max_iter; current_iteration++) {
         // t2.start();
-        temp = (ml - alpha * mg);
+        if (do_preconditioning)
+            temp = (ml - alpha * (invmD * mg));
+        else
+            temp = (ml - alpha * mg);
         Project(temp.data());
         mdir = temp - ml;
 
@@ -184,15 +264,35 @@ uint ChSolverParallelBB::Solve(ChShurProduct& ShurProduct,
                 alpha = Min(a_max, Max(a_min, sy / yDy));
             }
         }
-        temp = ml - gdiff * mg;
-        Project(temp.data());
-        temp = (ml - temp) / (-gdiff);
+        bool full_residual =
+            current_iteration >= next_residual_check || current_iteration == (signed)max_iter - 1;
+        if (!full_residual) {
+            // max|ml_p - ml| / alpha approximates the gradient magnitude of
+            // this step; a small value means the iterate stagnated, so measure.
+            real max_delta = 0;
+            for (uint i = 0; i < size; i++)
+                max_delta = Max(max_delta, Abs(ms[i]));
+            if (max_delta <= alpha * data_manager->settings.solver.tol_speed)
+                full_residual = true;
+        }
+
+        if (full_residual) {
+            temp = ml - gdiff * mg;
+            Project(temp.data());
+            temp = (ml - temp) / (-gdiff);
+
+            real g_proj_norm = Sqrt((temp, temp));
+            if (g_proj_norm < lastgoodres) {
+                lastgoodres = g_proj_norm;
+                objective_value = mf_p;
+                ml_candidate = ml;
+            }
 
-        real g_proj_norm = Sqrt((temp, temp));
-        if (g_proj_norm < lastgoodres) {
-            lastgoodres = g_proj_norm;
-            objective_value = mf_p;
-            ml_candidate = ml;
+            if (lastgoodres > 100.0 * data_manager->settings.solver.tol_speed)
+                residual_interval = std::min(2 * residual_interval, residual_skip);
+            else
+                residual_interval = 1;
+            next_residual_check = current_iteration + residual_interval;
         }
 
         AtIterationEnd(lastgoodres, objective_value);
@@ -72,6 +72,7 @@ ChPovRay::ChPovRay(ChSystem* system) : ChPostProcessBase(system) {
     this->contacts_colormap_endscale = 10;
     this->contacts_do_colormap = true;
     this->single_asset_file = true;
+    this->static_scene_file = false;
 }
 
 void ChPovRay::Add(std::shared_ptr<ChPhysicsItem> mitem) {
@@ -154,6 +155,17 @@ void ChPovRay::SetupLists() {
             mcachedasset++;
     }
 
+    // Same for the cache of items whose static macro was already written
+    std::unordered_map<size_t, std::shared_ptr<ChPhysicsItem> >::iterator mcacheditem = pov_items.begin();
+    while (mcacheditem != pov_items.end()) {
+        if (mcacheditem->second.use_count() == 1) {
+            size_t keytodelete = mcacheditem->first;
+            mcacheditem++;
+            pov_items.erase(keytodelete);
+        } else
+            mcacheditem++;
+    }
+
     // scan all items in ChSystem to see which were marked by a ChPovAsset asset
     for (auto body : mSystem->Get_bodylist()) {
         if (IsAdded(body))
@@ -243,6 +255,7 @@ void ChPovRay::ExportScript(const std::string& filename) {
     this->out_script_filename = filename;
 
     pov_assets.clear();
+    pov_items.clear();
 
     this->SetupLists();
 
@@ -423,6 +436,9 @@ void ChPovRay::ExportScript(const std::string& filename) {
         // populate assets (note that already present
         // assets won't be appended!)
         this->ExportAssets(assets_file);
+        // same for the per-item static macros, if enabled
+        if (static_scene_file)
+            this->ExportStaticMacros(assets_file);
     }
 }
 
@@ -715,6 +731,46 @@ void ChPovRay::ExportAssets(ChStreamOutAsciiFile& assets_file) {
     }  // end loop on objects
 }
 
+// Tell if an asset tree contains a ChCamera, at any level: such items cannot be
+// baked into a static macro, since the camera must be re-evaluated at each frame.
+static bool _assetTreeHasCamera(std::vector<std::shared_ptr<ChAsset> >& assetlist) {
+    for (unsigned int k = 0; k < assetlist.size(); k++) {
+        if (std::dynamic_pointer_cast<ChCamera>(assetlist[k]))
+            return true;
+        if (auto mylevel = std::dynamic_pointer_cast<ChAssetLevel>(assetlist[k]))
+            if (_assetTreeHasCamera(mylevel->GetAssets()))
+                return true;
+    }
+    return false;
+}
+
+void ChPovRay::ExportStaticMacros(ChStreamOutAsciiFile& assets_file) {
+    // For each rendered body whose macro was not written yet, dump its whole asset
+    // tree once, as a macro parameterized on the body transform. The per-frame
+    // files will then contain only one macro call per body, instead of the full
+    // union of shapes and pigments at every timestep.
+
+    for (unsigned int i = 0; i < this->mdata.size(); i++) {
+        if (!std::dynamic_pointer_cast<ChBody>(mdata[i]))
+            continue;
+        if (pov_items.find((size_t)mdata[i].get()) != pov_items.end())
+            continue;
+        if (_assetTreeHasCamera(mdata[i]->GetAssets()))
+            continue;
+
+        pov_items.insert({(size_t)mdata[i].get(), mdata[i]});
+
+        assets_file << "#macro it_" << (size_t)mdata[i].get() << "(apx, apy, apz, aq0, aq1, aq2, aq3)\n";
+        assets_file << "union{\n";
+        ChFrame<> nullframe(CSYSNORM);
+        _recurseExportObjData(mdata[i]->GetAssets(), nullframe, assets_file);
+        assets_file << " quatRotation(<aq0,aq1,aq2,aq3>)\n";
+        assets_file << " translate  <apx,apy,apz>\n";
+        assets_file << "}\n";
+        assets_file << "#end \n";
+    }
+}
+
 void ChPovRay::_recurseExportObjData(std::vector<std::shared_ptr<ChAsset> >& assetlist,
                                      ChFrame<> parentframe,
                                      ChStreamOutAsciiFile& mfilepov) {
@@ -797,6 +853,9 @@ void ChPovRay::ExportData(const std::string& filename) {
         // populate assets (note that already present
         // assets won't be appended!)
         this->ExportAssets(assets_file);
+        // same for the per-item static macros, if enabled
+        if (static_scene_file)
+            this->ExportStaticMacros(assets_file);
     }
 
     // Generate the nnnn.dat and nnnn.pov files:
@@ -842,8 +901,18 @@ void ChPovRay::ExportData(const std::string& filename) {
                 const ChFrame<>& bodyframe = mybody->GetFrame_REF_to_abs();
                 assetcsys = bodyframe.GetCoord();
 
-                // Dump the POV macro that generates the contained asset(s) tree!!!
-                _recurseExportObjData(mdata[i]->GetAssets(), bodyframe, mfilepov);
+                if (static_scene_file && single_asset_file &&
+                    pov_items.find((size_t)mdata[i].get()) != pov_items.end()) {
+                    // The asset tree was already baked as a macro in the static asset
+                    // file: this frame only needs the transform values.
+                    mfilepov << "it_" << (size_t)mdata[i].get() << "(";
+                    mfilepov << assetcsys.pos.x() << "," << assetcsys.pos.y() << "," << assetcsys.pos.z() << ",";
+                    mfilepov << assetcsys.rot.e0() << "," << assetcsys.rot.e1() << "," << assetcsys.rot.e2() << ","
+                             << assetcsys.rot.e3() << ")\n";
+                } else {
+                    // Dump the POV macro that generates the contained asset(s) tree!!!
+                    _recurseExportObjData(mdata[i]->GetAssets(), bodyframe, mfilepov);
+                }
 
                 // Show body COG?
                 if (this->COGs_show) {
@@ -196,24 +196,38 @@ class ChApiPostProcess ChPovRay : public ChPostProcessBase {
     virtual void ExportData(const std::string& filename);
 
     /// Set if the assets for the entre scenes at all timesteps must be appended into one
-    /// single large file "rendering_frames.pov.assets". If not, assets will be written inside 
+    /// single large file "rendering_frames.pov.assets". If not, assets will be written inside
     /// each state0001.dat, state0002.dat, etc files; this would waste more disk space but would be
     /// a bit faster in POV parsing and would allow assets whose settings change during time (ex time-changing colors)
     void SetUseSingleAssetFile(bool muse) {
         this->single_asset_file = muse;
     }
 
+    /// Set if the entire asset tree of each rendered item must be written only once, as a POV
+    /// macro parameterized on the item transform, into the single asset file. The per-frame
+    /// state0001.pov, state0002.pov, etc. files then shrink to one macro call per item,
+    /// containing only its seven position/quaternion values, instead of repeating the whole
+    /// union of shapes, pigments and textures at every timestep. This cuts export time and
+    /// disk usage by an order of magnitude for scenes with many bodies, but requires
+    /// SetUseSingleAssetFile(true) and asset trees that do not change during the animation.
+    void SetUseStaticSceneFile(bool muse) {
+        this->static_scene_file = muse;
+    }
+
   protected:
     virtual void SetupLists();
     virtual void ExportAssets(ChStreamOutAsciiFile& assets_file);
     void _recurseExportAssets(std::vector<std::shared_ptr<ChAsset> >& assetlist, ChStreamOutAsciiFile& assets_file);
 
+    void ExportStaticMacros(ChStreamOutAsciiFile& assets_file);
+
     void _recurseExportObjData(std::vector<std::shared_ptr<ChAsset> >& assetlist,
                                ChFrame<> parentframe,
                                ChStreamOutAsciiFile& mfilepov);
 
     std::vector<std::shared_ptr<ChPhysicsItem> > mdata;
     std::unordered_map<size_t, std::shared_ptr<ChAsset> > pov_assets;
+    std::unordered_map<size_t, std::shared_ptr<ChPhysicsItem> > pov_items;
 
     std::string template_filename;
     std::string pic_filename;
@@ -262,6 +276,7 @@ class ChApiPostProcess ChPovRay : public ChPostProcessBase {
     std::string custom_data;
 
     bool single_asset_file;
+    bool static_scene_file;
 };
 
 }  // end namespace postprocess
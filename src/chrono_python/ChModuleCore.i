@@ -663,6 +663,149 @@ private:
 %}
 
 
+%inline %{
+
+	// Single-copy coupling channel between a ChSystem and numeric Python code
+	// (numpy etc.). Instead of converting body states one scalar at a time
+	// through the wrapper, the channel gathers all body states of the system
+	// into one contiguous double buffer (and back), reusing the bulk
+	// ChAssembly::GatherBodyStates / ScatterBodyStates sweeps; the buffer is
+	// allocated once and refreshed in place at every step, and Python reads
+	// it through the zero-copy views defined below with no per-call
+	// marshalling at all.
+namespace chrono
+{
+class ChStateBufferPython
+{
+public:
+	ChStateBufferPython(ChSystem* msystem) : system(msystem), cached_revision(0)
+		{
+			RebuildIndices();
+		}
+
+		/// Number of bodies covered by the buffers.
+	int GetNumBodies() const { return (int)indices.size(); }
+
+		/// Doubles per body in the state buffer: [pos(3), rot(4), pos_dt(3), wvel_loc(3)].
+	int GetStateStride() const { return ChAssembly::body_state_doubles; }
+
+		/// Doubles per body in the contact force buffer: [force(3), torque(3)], absolute coords.
+	int GetContactStride() const { return 6; }
+
+		/// Re-gather all body states into the state buffer, in place.
+		/// Call once after each DoStepDynamics before reading the state view.
+	void RefreshStates()
+		{
+			Revalidate();
+			system->GatherBodyStates(indices, states.data());
+		}
+
+		/// Write the (possibly modified) content of the state buffer back into the
+		/// bodies, e.g. after resetting positions/velocities from Python.
+	void ApplyStates()
+		{
+			Revalidate();
+			system->ScatterBodyStates(indices, states.data());
+		}
+
+		/// Re-gather the resultant contact force and torque of each body into the
+		/// contact force buffer, in place.
+	void RefreshContactForces()
+		{
+			Revalidate();
+			system->GetContactContainer()->ComputeContactForces();
+			const std::vector<std::shared_ptr<ChBody>>& bodies = system->Get_bodylist();
+			for (size_t k = 0; k < indices.size(); k++)
+			{
+				ChBody* body = bodies[indices[k]].get();
+				ChVector<> f = body->GetContactForce();
+				ChVector<> t = body->GetContactTorque();
+				double* slot = &contact_forces[k * 6];
+				slot[0] = f.x();  slot[1] = f.y();  slot[2] = f.z();
+				slot[3] = t.x();  slot[4] = t.y();  slot[5] = t.z();
+			}
+		}
+
+		// Raw accessors used by the zero-copy views (see %extend below).
+	double* GetStateData() { return states.data(); }
+	double* GetContactData() { return contact_forces.data(); }
+
+private:
+	void Revalidate()
+		{
+			if (system->GetTopologyRevision() != cached_revision)
+				RebuildIndices();
+		}
+	void RebuildIndices()
+		{
+			indices = system->CacheBodyIndices(system->Get_bodylist());
+			states.resize(indices.size() * ChAssembly::body_state_doubles);
+			contact_forces.resize(indices.size() * 6);
+			cached_revision = system->GetTopologyRevision();
+		}
+
+	ChSystem* system;
+	unsigned int cached_revision;
+	std::vector<int> indices;
+	std::vector<double> states;
+	std::vector<double> contact_forces;
+};
+
+	// Batched stepping of many independent systems (e.g. the parallel
+	// environments of a reinforcement learning loop). DoStepDynamics releases
+	// the Python GIL and advances the systems on the OpenMP thread pool, one
+	// system per thread (the inner OpenMP regions of each system serialize,
+	// since nested parallelism is disabled by default), so Python threads can
+	// keep running and the per-call interpreter overhead is paid once per
+	// batch instead of once per system.
+class ChSystemBatchPython
+{
+public:
+		/// Add a system to the batch. The caller keeps ownership; the system
+		/// must stay alive as long as the batch uses it.
+	void AddSystem(ChSystem* msystem) { systems.push_back(msystem); }
+
+	int GetNumSystems() const { return (int)systems.size(); }
+
+		/// Advance all systems of the batch by 'step_size', in parallel,
+		/// with the GIL released for the whole sweep.
+	void DoStepDynamics(double step_size)
+		{
+			PyThreadState* saved_state = PyEval_SaveThread();
+			#pragma omp parallel for schedule(dynamic)
+			for (int i = 0; i < (int)systems.size(); i++)
+			{
+				systems[i]->DoStepDynamics(step_size);
+			}
+			PyEval_RestoreThread(saved_state);
+		}
+
+private:
+	std::vector<ChSystem*> systems;
+};
+};
+
+%}
+
+// Zero-copy views over the channel buffers: memoryview objects sharing the
+// memory of the C++ arrays, with no copy on creation nor on access. In Python,
+// numpy.frombuffer(buf.GetStateView()).reshape(n,13) gives a live numpy array
+// over the body states (refreshed in place by RefreshStates). The views are
+// only valid while the ChStateBufferPython object is alive.
+%extend chrono::ChStateBufferPython {
+	PyObject* GetStateView()
+		{
+			Py_ssize_t nbytes = (Py_ssize_t)($self->GetNumBodies() * $self->GetStateStride() * sizeof(double));
+			return PyMemoryView_FromMemory((char*)$self->GetStateData(), nbytes, PyBUF_WRITE);
+		}
+	PyObject* GetContactForceView()
+		{
+			Py_ssize_t nbytes = (Py_ssize_t)($self->GetNumBodies() * $self->GetContactStride() * sizeof(double));
+			return PyMemoryView_FromMemory((char*)$self->GetContactData(), nbytes, PyBUF_READ);
+		}
+};
+
+
 
 
 //
@@ -26,6 +26,8 @@
 #include "chrono_vehicle/ChVehicle.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
+#include "chrono_vehicle/output/ChVehicleOutputDelta.h"
 #ifdef CHRONO_HAS_HDF5
 #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 #endif
@@ -38,7 +40,7 @@ namespace vehicle {
 // Specify default step size and solver parameters.
 // -----------------------------------------------------------------------------
 ChVehicle::ChVehicle(const std::string& name, ChMaterialSurface::ContactMethod contact_method)
-    : m_name(name), m_ownsSystem(true), m_stepsize(1e-3), m_output(false), m_output_db(nullptr), m_next_output_time(0), m_output_frame(0) {
+    : m_name(name), m_ownsSystem(true), m_stepsize(1e-3), m_output(false), m_output_db(nullptr), m_output_delta(nullptr), m_next_output_time(0), m_output_frame(0) {
     m_system = (contact_method == ChMaterialSurface::NSC) ? static_cast<ChSystem*>(new ChSystemNSC)
                                                           : static_cast<ChSystem*>(new ChSystemSMC);
 
@@ -68,6 +70,7 @@ ChVehicle::ChVehicle(const std::string& name, ChSystem* system)
       m_stepsize(1e-3),
       m_output(false),
       m_output_db(nullptr),
+      m_output_delta(nullptr),
       m_next_output_time(0),
       m_output_frame(0) {}
 
@@ -97,6 +100,9 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
         case ChVehicleOutput::JSON:
             //// TODO
             break;
+        case ChVehicleOutput::BINARY:
+            m_output_db = new ChVehicleOutputBinary(out_dir + "/" + out_name + ".chb");
+            break;
         case ChVehicleOutput::HDF5:
 #ifdef CHRONO_HAS_HDF5
             m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
@@ -105,6 +111,33 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
     }
 }
 
+// -----------------------------------------------------------------------------
+// Switch the output database to delta mode.
+// -----------------------------------------------------------------------------
+void ChVehicle::SetOutputDeltaMode(double pos_deadband,
+                                   double vel_deadband,
+                                   double acc_deadband,
+                                   double frc_deadband,
+                                   int keyframe_interval) {
+    if (!m_output_db || m_output_delta)
+        return;
+
+    m_output_delta = new ChVehicleOutputDelta(m_output_db);
+    m_output_delta->SetDeadband(ChVehicleOutputDelta::POSITION, pos_deadband);
+    m_output_delta->SetDeadband(ChVehicleOutputDelta::VELOCITY, vel_deadband);
+    m_output_delta->SetDeadband(ChVehicleOutputDelta::ACCELERATION, acc_deadband);
+    m_output_delta->SetDeadband(ChVehicleOutputDelta::FORCE, frc_deadband);
+    m_output_delta->SetKeyframeInterval(keyframe_interval);
+
+    // The filter takes ownership of the wrapped database and replaces it.
+    m_output_db = m_output_delta;
+}
+
+void ChVehicle::ForceOutputKeyframe() {
+    if (m_output_delta)
+        m_output_delta->ForceKeyframe();
+}
+
 // -----------------------------------------------------------------------------
 // Advance the state of the system, taking as many steps as needed to exactly
 // reach the specified value 'step'.
@@ -32,6 +32,8 @@
 namespace chrono {
 namespace vehicle {
 
+class ChVehicleOutputDelta;
+
 /// @addtogroup vehicle
 /// @{
 
@@ -121,6 +123,21 @@ class CH_VEHICLE_API ChVehicle {
                    double output_step            ///< [in] interval between output times
     );
 
+    /// Switch the output database (previously created with SetOutput) to delta mode.
+    /// In delta mode, only components with at least one state channel that moved by more than the
+    /// corresponding deadband since the component was last written are output; quasi-constant
+    /// channels therefore produce no data. A keyframe (all components written) can be scheduled
+    /// every 'keyframe_interval' output frames (0: never) or requested with ForceOutputKeyframe().
+    void SetOutputDeltaMode(double pos_deadband,      ///< [in] deadband on position-level channels
+                            double vel_deadband,      ///< [in] deadband on velocity-level channels
+                            double acc_deadband,      ///< [in] deadband on acceleration-level channels
+                            double frc_deadband,      ///< [in] deadband on force and torque channels
+                            int keyframe_interval = 0 ///< [in] periodic keyframe interval (in output frames)
+    );
+
+    /// Force the next output frame to be a full keyframe (effective only in delta output mode).
+    void ForceOutputKeyframe();
+
     /// Initialize this vehicle at the specified global location and orientation.
     virtual void Initialize(const ChCoordsys<>& chassisPos,  ///< [in] initial global position and orientation
                             double chassisFwdVel = 0         ///< [in] initial chassis forward velocity
@@ -190,8 +207,9 @@ class CH_VEHICLE_API ChVehicle {
     ChSystem* m_system;  ///< pointer to the Chrono system
     bool m_ownsSystem;   ///< true if system created at construction
 
-    bool m_output;                 ///< generate ouput for this vehicle system
-    ChVehicleOutput* m_output_db;  ///< vehicle output database
+    bool m_output;                        ///< generate ouput for this vehicle system
+    ChVehicleOutput* m_output_db;         ///< vehicle output database
+    ChVehicleOutputDelta* m_output_delta; ///< delta filter around the output database (delta mode only)
     double m_output_step;          ///< output time step
     double m_next_output_time;     ///< time for next output
     int m_output_frame;            ///< current output frame
@@ -0,0 +1,300 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Packed binary vehicle output database.
+//
+// File layout:
+//   magic "CHRVEHBO", version (u32), endianness marker (u32)
+//   frame 0:  frame (i32), time (f64), then tagged schema blocks:
+//             'S' + section name, or an item-kind tag + item count + per-item
+//             {identifier (i32), name, channel count (u16), channel values}
+//   'E' end-of-schema marker
+//   frame k:  frame (i32), time (f64), packed channel values (f64), in the
+//             exact order negotiated in frame 0 -- no tags, no names.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono/physics/ChLinkMasked.h"
+#include "chrono/physics/ChLinkUniversal.h"
+#include "chrono/physics/ChLinkDistance.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
+
+namespace chrono {
+
+// Section tags used in the frame-0 schema (one per ChVehicleOutput section).
+static const char tag_bodies = 'b';
+static const char tag_auxref_bodies = 'a';
+static const char tag_markers = 'm';
+static const char tag_shafts = 's';
+static const char tag_joints = 'j';
+static const char tag_couples = 'c';
+static const char tag_linsprings = 'l';
+static const char tag_rotsprings = 'r';
+static const char tag_bodyloads = 'f';
+static const char tag_section = 'S';
+static const char tag_end_schema = 'E';
+
+static void write_string(std::ostream& stream, const std::string& str) {
+    unsigned short len = (unsigned short)str.size();
+    stream.write(reinterpret_cast<const char*>(&len), sizeof(len));
+    stream.write(str.data(), len);
+}
+
+namespace vehicle {
+
+ChVehicleOutputBinary::ChVehicleOutputBinary(const std::string& filename)
+    : m_buffer(1 << 20), m_schema_done(false), m_num_frames(0) {
+    m_stream.rdbuf()->pubsetbuf(m_buffer.data(), m_buffer.size());
+    m_stream.open(filename, std::ios_base::out | std::ios_base::binary);
+
+    m_stream.write("CHRVEHBO", 8);
+    write_pod<unsigned int>(1);           // format version
+    write_pod<unsigned int>(0x01020304);  // endianness marker
+}
+
+ChVehicleOutputBinary::~ChVehicleOutputBinary() {
+    m_stream.close();
+}
+
+void ChVehicleOutputBinary::write_item_header(int id, const std::string& name, unsigned short num_channels) {
+    if (!m_schema_done) {
+        write_pod<int>(id);
+        write_string(m_stream, name);
+        write_pod<unsigned short>(num_channels);
+    }
+}
+
+void ChVehicleOutputBinary::write_section_header(char tag, unsigned int num_items) {
+    if (!m_schema_done) {
+        write_pod<char>(tag);
+        write_pod<unsigned int>(num_items);
+    }
+}
+
+void ChVehicleOutputBinary::WriteTime(int frame, double time) {
+    if (m_num_frames == 1) {
+        // The first frame wrote the channel layout alongside the values; all
+        // further frames are packed values only.
+        write_pod<char>(tag_end_schema);
+        m_schema_done = true;
+    }
+    m_num_frames++;
+
+    write_pod<int>(frame);
+    write_pod<double>(time);
+}
+
+void ChVehicleOutputBinary::WriteSection(const std::string& name) {
+    if (!m_schema_done) {
+        write_pod<char>(tag_section);
+        write_string(m_stream, name);
+    }
+}
+
+void ChVehicleOutputBinary::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    write_section_header(tag_bodies, (unsigned int)bodies.size());
+    for (auto body : bodies) {
+        write_item_header(body->GetIdentifier(), body->GetNameString(), 19);
+        write_pod(body->GetPos());
+        write_pod(body->GetRot());
+        write_pod(body->GetPos_dt());
+        write_pod(body->GetWvel_par());
+        write_pod(body->GetPos_dtdt());
+        write_pod(body->GetWacc_par());
+    }
+}
+
+void ChVehicleOutputBinary::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    write_section_header(tag_auxref_bodies, (unsigned int)bodies.size());
+    for (auto body : bodies) {
+        write_item_header(body->GetIdentifier(), body->GetNameString(), 28);
+        write_pod(body->GetPos());
+        write_pod(body->GetRot());
+        write_pod(body->GetPos_dt());
+        write_pod(body->GetWvel_par());
+        write_pod(body->GetPos_dtdt());
+        write_pod(body->GetWacc_par());
+        write_pod(body->GetFrame_REF_to_abs().GetPos());
+        write_pod(body->GetFrame_REF_to_abs().GetPos_dt());
+        write_pod(body->GetFrame_REF_to_abs().GetPos_dtdt());
+    }
+}
+
+void ChVehicleOutputBinary::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    write_section_header(tag_markers, (unsigned int)markers.size());
+    for (auto marker : markers) {
+        write_item_header(marker->GetIdentifier(), marker->GetNameString(), 9);
+        write_pod(marker->GetAbsCoord().pos);
+        write_pod(marker->GetAbsCoord_dt().pos);
+        write_pod(marker->GetAbsCoord_dtdt().pos);
+    }
+}
+
+void ChVehicleOutputBinary::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    write_section_header(tag_shafts, (unsigned int)shafts.size());
+    for (auto shaft : shafts) {
+        write_item_header(shaft->GetIdentifier(), shaft->GetNameString(), 4);
+        write_pod(shaft->GetPos());
+        write_pod(shaft->GetPos_dt());
+        write_pod(shaft->GetPos_dtdt());
+        write_pod(shaft->GetAppliedTorque());
+    }
+}
+
+void ChVehicleOutputBinary::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    write_section_header(tag_joints, (unsigned int)joints.size());
+    for (auto joint : joints) {
+        std::vector<double> violations;
+        //// TODO: Fix this mess in Chrono
+        ChMatrix<>* C = nullptr;
+        if (auto jnt = std::dynamic_pointer_cast<ChLinkMasked>(joint)) {
+            C = jnt->GetC();
+            for (int i = 0; i < C->GetRows(); i++)
+                violations.push_back(C->GetElement(i, 0));
+        } else if (auto jnt = std::dynamic_pointer_cast<ChLinkUniversal>(joint)) {
+            C = jnt->GetC();
+            for (int i = 0; i < C->GetRows(); i++)
+                violations.push_back(C->GetElement(i, 0));
+        } else if (auto jnt = std::dynamic_pointer_cast<ChLinkDistance>(joint)) {
+            violations.push_back(jnt->GetCurrentDistance() - jnt->GetImposedDistance());
+        }
+
+        write_item_header(joint->GetIdentifier(), joint->GetNameString(), (unsigned short)(6 + violations.size()));
+        write_pod(joint->Get_react_force());
+        write_pod(joint->Get_react_torque());
+        for (auto val : violations) {
+            write_pod(val);
+        }
+    }
+}
+
+void ChVehicleOutputBinary::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    write_section_header(tag_couples, (unsigned int)couples.size());
+    for (auto couple : couples) {
+        write_item_header(couple->GetIdentifier(), couple->GetNameString(), 5);
+        write_pod(couple->GetRelativeRotation());
+        write_pod(couple->GetRelativeRotation_dt());
+        write_pod(couple->GetRelativeRotation_dtdt());
+        write_pod(couple->GetTorqueReactionOn1());
+        write_pod(couple->GetTorqueReactionOn2());
+    }
+}
+
+void ChVehicleOutputBinary::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) {
+    write_section_header(tag_linsprings, (unsigned int)springs.size());
+    for (auto spring : springs) {
+        write_item_header(spring->GetIdentifier(), spring->GetNameString(), 3);
+        write_pod(spring->GetSpringLength());
+        write_pod(spring->GetSpringVelocity());
+        write_pod(spring->GetSpringReact());
+    }
+}
+
+void ChVehicleOutputBinary::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) {
+    write_section_header(tag_rotsprings, (unsigned int)springs.size());
+    for (auto spring : springs) {
+        write_item_header(spring->GetIdentifier(), spring->GetNameString(), 3);
+        write_pod(spring->GetRotSpringAngle());
+        write_pod(spring->GetRotSpringSpeed());
+        write_pod(spring->GetRotSpringTorque());
+    }
+}
+
+void ChVehicleOutputBinary::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    write_section_header(tag_bodyloads, (unsigned int)loads.size());
+    for (auto load : loads) {
+        write_item_header(load->GetIdentifier(), load->GetNameString(), 6);
+        write_pod(load->GetForce());
+        write_pod(load->GetTorque());
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static T read_pod(std::istream& stream) {
+    T val;
+    stream.read(reinterpret_cast<char*>(&val), sizeof(T));
+    return val;
+}
+
+static std::string read_string(std::istream& stream) {
+    unsigned short len = read_pod<unsigned short>(stream);
+    std::string str(len, '\0');
+    stream.read(&str[0], len);
+    return str;
+}
+
+ChVehicleOutputBinaryReader::ChVehicleOutputBinaryReader(const std::string& filename) {
+    std::ifstream stream(filename, std::ios_base::in | std::ios_base::binary);
+    if (!stream.is_open()) {
+        std::cerr << "Cannot open " << filename << std::endl;
+        return;
+    }
+
+    char magic[8];
+    stream.read(magic, 8);
+    if (std::string(magic, 8) != "CHRVEHBO") {
+        std::cerr << filename << " is not a Chrono::Vehicle binary output file" << std::endl;
+        return;
+    }
+    read_pod<unsigned int>(stream);  // format version
+    if (read_pod<unsigned int>(stream) != 0x01020304) {
+        std::cerr << filename << " was written with a different endianness" << std::endl;
+        return;
+    }
+
+    // Frame 0 carries the channel layout interleaved with the values.
+    read_pod<int>(stream);
+    m_times.push_back(read_pod<double>(stream));
+    m_data.resize(1);
+
+    std::string section;
+    while (stream) {
+        char tag = read_pod<char>(stream);
+        if (tag == 'E')
+            break;
+        if (tag == 'S') {
+            section = read_string(stream);
+            continue;
+        }
+        unsigned int num_items = read_pod<unsigned int>(stream);
+        for (unsigned int i = 0; i < num_items; i++) {
+            read_pod<int>(stream);  // item identifier
+            std::string name = read_string(stream);
+            unsigned short num_channels = read_pod<unsigned short>(stream);
+            for (unsigned short c = 0; c < num_channels; c++) {
+                m_channel_names.push_back(section + "/" + name + "/" + std::to_string(c));
+                m_data[0].push_back(read_pod<double>(stream));
+            }
+        }
+    }
+
+    // All further frames are packed values in schema order.
+    size_t num_channels = m_channel_names.size();
+    while (stream) {
+        read_pod<int>(stream);
+        double time = read_pod<double>(stream);
+        std::vector<double> values(num_channels);
+        stream.read(reinterpret_cast<char*>(values.data()), num_channels * sizeof(double));
+        if (!stream)
+            break;
+        m_times.push_back(time);
+        m_data.push_back(std::move(values));
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
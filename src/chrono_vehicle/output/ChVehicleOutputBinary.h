@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Packed binary vehicle output database.
+//
+// The channel layout is negotiated during the first output frame: every item
+// (body, shaft, joint, ...) contributes a schema entry with its identifier,
+// name, and number of scalar channels. All subsequent frames are appended as
+// raw packed doubles in the same order, with no per-frame formatting or
+// metadata, which makes this backend suitable for high-rate logging.
+// ChVehicleOutputBinaryReader reconstructs the schema and the time series
+// from such a file.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_BINARY_H
+#define CH_VEHICLE_OUTPUT_BINARY_H
+
+#include <string>
+#include <fstream>
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Packed binary vehicle output database.
+class CH_VEHICLE_API ChVehicleOutputBinary : public ChVehicleOutput {
+  public:
+    ChVehicleOutputBinary(const std::string& filename);
+    ~ChVehicleOutputBinary();
+
+  private:
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    // Write a plain-old-data value to the stream.
+    template <typename T>
+    void write_pod(const T& val) {
+        m_stream.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    }
+    // Start an item record: during the first frame, this appends a schema
+    // entry (identifier, name, channel count); in later frames it is a no-op.
+    void write_item_header(int id, const std::string& name, unsigned short num_channels);
+    void write_section_header(char tag, unsigned int num_items);
+
+    std::ofstream m_stream;
+    std::vector<char> m_buffer;  ///< stream buffer (one syscall per ~1 MB of records)
+    bool m_schema_done;          ///< layout negotiation (first frame) completed?
+    int m_num_frames;            ///< number of frames written so far
+};
+
+/// Reader for vehicle output databases written by ChVehicleOutputBinary.
+/// Loads the whole file; channel k of frame f is Data()[f][k] and its name
+/// ("section/item name/channel index") is ChannelName(k).
+class CH_VEHICLE_API ChVehicleOutputBinaryReader {
+  public:
+    ChVehicleOutputBinaryReader(const std::string& filename);
+
+    size_t GetNumFrames() const { return m_times.size(); }
+    size_t GetNumChannels() const { return m_channel_names.size(); }
+    const std::vector<double>& GetTimes() const { return m_times; }
+    const std::string& ChannelName(size_t channel) const { return m_channel_names[channel]; }
+    const std::vector<std::vector<double>>& Data() const { return m_data; }
+
+  private:
+    std::vector<double> m_times;
+    std::vector<std::string> m_channel_names;
+    std::vector<std::vector<double>> m_data;  ///< per-frame packed channel values
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,278 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Change-detection filter for a vehicle output database.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono_vehicle/output/ChVehicleOutputDelta.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleOutputDelta::ChVehicleOutputDelta(ChVehicleOutput* database)
+    : m_database(database),
+      m_force_keyframe(false),
+      m_keyframe_interval(0),
+      m_keyframe(false),
+      m_frame(0),
+      m_time(0),
+      m_time_pending(false),
+      m_section_pending(false) {
+    m_deadband[POSITION] = 0;
+    m_deadband[VELOCITY] = 0;
+    m_deadband[ACCELERATION] = 0;
+    m_deadband[FORCE] = 0;
+}
+
+ChVehicleOutputDelta::~ChVehicleOutputDelta() {
+    delete m_database;
+}
+
+void ChVehicleOutputDelta::SetDeadband(ChannelKind kind, double value) {
+    m_deadband[kind] = value;
+}
+
+bool ChVehicleOutputDelta::Changed(const void* component, const Signature& signature) {
+    auto it = m_signatures.find(component);
+    bool changed = m_keyframe || (it == m_signatures.end());
+
+    if (!changed) {
+        const Signature& previous = it->second;
+        for (size_t i = 0; i < signature.size(); i++) {
+            if (std::abs(signature[i].value - previous[i].value) > m_deadband[signature[i].kind]) {
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    // Record the signature only when the component is written, so that slow
+    // drifts accumulate against the last written state and are eventually
+    // reported.
+    if (changed)
+        m_signatures[component] = signature;
+
+    return changed;
+}
+
+void ChVehicleOutputDelta::FlushHeaders() {
+    if (m_time_pending) {
+        m_database->WriteTime(m_frame, m_time);
+        m_time_pending = false;
+    }
+    if (m_section_pending) {
+        m_database->WriteSection(m_section);
+        m_section_pending = false;
+    }
+}
+
+void ChVehicleOutputDelta::WriteTime(int frame, double time) {
+    m_frame = frame;
+    m_time = time;
+    m_time_pending = true;
+    m_section_pending = false;
+
+    m_keyframe = m_force_keyframe || (m_keyframe_interval > 0 && frame % m_keyframe_interval == 0);
+    m_force_keyframe = false;
+}
+
+void ChVehicleOutputDelta::WriteSection(const std::string& name) {
+    m_section = name;
+    m_section_pending = true;
+}
+
+// -----------------------------------------------------------------------------
+// For each component type, assemble the signature from the same state channels
+// the concrete writers output, then forward the sub-list of changed components.
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputDelta::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    std::vector<std::shared_ptr<ChBody>> changed;
+    for (auto body : bodies) {
+        Signature s;
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetPos()[i], POSITION));
+        for (int i = 0; i < 4; i++)
+            s.push_back(Channel(body->GetRot()[i], POSITION));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetPos_dt()[i], VELOCITY));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetWvel_par()[i], VELOCITY));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetPos_dtdt()[i], ACCELERATION));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetWacc_par()[i], ACCELERATION));
+        if (Changed(body.get(), s))
+            changed.push_back(body);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteBodies(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    std::vector<std::shared_ptr<ChBodyAuxRef>> changed;
+    for (auto body : bodies) {
+        Signature s;
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetPos()[i], POSITION));
+        for (int i = 0; i < 4; i++)
+            s.push_back(Channel(body->GetRot()[i], POSITION));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetPos_dt()[i], VELOCITY));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetWvel_par()[i], VELOCITY));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetPos_dtdt()[i], ACCELERATION));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetWacc_par()[i], ACCELERATION));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetFrame_REF_to_abs().GetPos()[i], POSITION));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetFrame_REF_to_abs().GetPos_dt()[i], VELOCITY));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(body->GetFrame_REF_to_abs().GetPos_dtdt()[i], ACCELERATION));
+        if (Changed(body.get(), s))
+            changed.push_back(body);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteAuxRefBodies(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    std::vector<std::shared_ptr<ChMarker>> changed;
+    for (auto marker : markers) {
+        Signature s;
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(marker->GetAbsCoord().pos[i], POSITION));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(marker->GetAbsCoord_dt().pos[i], VELOCITY));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(marker->GetAbsCoord_dtdt().pos[i], ACCELERATION));
+        if (Changed(marker.get(), s))
+            changed.push_back(marker);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteMarkers(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    std::vector<std::shared_ptr<ChShaft>> changed;
+    for (auto shaft : shafts) {
+        Signature s;
+        s.push_back(Channel(shaft->GetPos(), POSITION));
+        s.push_back(Channel(shaft->GetPos_dt(), VELOCITY));
+        s.push_back(Channel(shaft->GetPos_dtdt(), ACCELERATION));
+        s.push_back(Channel(shaft->GetAppliedTorque(), FORCE));
+        if (Changed(shaft.get(), s))
+            changed.push_back(shaft);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteShafts(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    std::vector<std::shared_ptr<ChLink>> changed;
+    for (auto joint : joints) {
+        Signature s;
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(joint->Get_react_force()[i], FORCE));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(joint->Get_react_torque()[i], FORCE));
+        if (Changed(joint.get(), s))
+            changed.push_back(joint);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteJoints(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    std::vector<std::shared_ptr<ChShaftsCouple>> changed;
+    for (auto couple : couples) {
+        Signature s;
+        s.push_back(Channel(couple->GetRelativeRotation(), POSITION));
+        s.push_back(Channel(couple->GetRelativeRotation_dt(), VELOCITY));
+        s.push_back(Channel(couple->GetRelativeRotation_dtdt(), ACCELERATION));
+        s.push_back(Channel(couple->GetTorqueReactionOn1(), FORCE));
+        s.push_back(Channel(couple->GetTorqueReactionOn2(), FORCE));
+        if (Changed(couple.get(), s))
+            changed.push_back(couple);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteCouples(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) {
+    std::vector<std::shared_ptr<ChLinkSpringCB>> changed;
+    for (auto spring : springs) {
+        Signature s;
+        s.push_back(Channel(spring->GetSpringLength(), POSITION));
+        s.push_back(Channel(spring->GetSpringVelocity(), VELOCITY));
+        s.push_back(Channel(spring->GetSpringReact(), FORCE));
+        if (Changed(spring.get(), s))
+            changed.push_back(spring);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteLinSprings(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) {
+    std::vector<std::shared_ptr<ChLinkRotSpringCB>> changed;
+    for (auto spring : springs) {
+        Signature s;
+        s.push_back(Channel(spring->GetRotSpringAngle(), POSITION));
+        s.push_back(Channel(spring->GetRotSpringSpeed(), VELOCITY));
+        s.push_back(Channel(spring->GetRotSpringTorque(), FORCE));
+        if (Changed(spring.get(), s))
+            changed.push_back(spring);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteRotSprings(changed);
+    }
+}
+
+void ChVehicleOutputDelta::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    std::vector<std::shared_ptr<ChLoadBodyBody>> changed;
+    for (auto load : loads) {
+        Signature s;
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(load->GetForce()[i], FORCE));
+        for (int i = 0; i < 3; i++)
+            s.push_back(Channel(load->GetTorque()[i], FORCE));
+        if (Changed(load.get(), s))
+            changed.push_back(load);
+    }
+    if (!changed.empty()) {
+        FlushHeaders();
+        m_database->WriteBodyLoads(changed);
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
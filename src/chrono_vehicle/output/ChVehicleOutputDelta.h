@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Change-detection filter for a vehicle output database.
+//
+// This class wraps another ChVehicleOutput object and forwards only the
+// components whose state changed by more than a configurable deadband since
+// they were last written. Components with quasi-constant channels therefore
+// produce no bytes in the underlying database. Keyframes (frames in which all
+// components are written regardless of the deadbands) can be requested
+// explicitly or scheduled at a fixed frame interval.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_DELTA_H
+#define CH_VEHICLE_OUTPUT_DELTA_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Change-detection filter for a vehicle output database.
+/// Forwards to the wrapped database only the components whose state channels
+/// changed by more than the corresponding deadband since the last write.
+class CH_VEHICLE_API ChVehicleOutputDelta : public ChVehicleOutput {
+  public:
+    /// Kind of an output channel, used to select the applicable deadband.
+    enum ChannelKind { POSITION, VELOCITY, ACCELERATION, FORCE };
+
+    /// Construct a delta filter around the specified output database.
+    /// The filter takes ownership of the wrapped database.
+    ChVehicleOutputDelta(ChVehicleOutput* database);
+    ~ChVehicleOutputDelta();
+
+    /// Set the deadband for channels of the specified kind (default: 0).
+    /// A component is written only if at least one of its channels moved by
+    /// more than the deadband since the component was last written. With a
+    /// zero deadband, only bit-identical repeats are suppressed.
+    void SetDeadband(ChannelKind kind, double value);
+
+    /// Force the next output frame to be a keyframe (all components written).
+    void ForceKeyframe() { m_force_keyframe = true; }
+
+    /// Write a keyframe every 'interval' output frames (0: never; default: 0).
+    void SetKeyframeInterval(int interval) { m_keyframe_interval = interval; }
+
+  private:
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    /// One channel of a component signature: a value and the deadband kind
+    /// against which changes of that value are measured.
+    struct Channel {
+        Channel(double v, ChannelKind k) : value(v), kind(k) {}
+        double value;
+        ChannelKind kind;
+    };
+    typedef std::vector<Channel> Signature;
+
+    /// Check the given signature against the one stored for the component and,
+    /// if any channel moved by more than its deadband (or this is a keyframe),
+    /// record the new signature and report that the component must be written.
+    bool Changed(const void* component, const Signature& signature);
+
+    /// Forward any pending time and section records to the wrapped database.
+    /// Called before forwarding a non-empty component list, so that frames and
+    /// sections with no changed components produce no bytes.
+    void FlushHeaders();
+
+    ChVehicleOutput* m_database;  ///< wrapped output database (owned)
+
+    double m_deadband[4];  ///< deadband per channel kind
+
+    bool m_force_keyframe;    ///< write all components at the next frame
+    int m_keyframe_interval;  ///< periodic keyframe interval (in output frames)
+    bool m_keyframe;          ///< current frame is a keyframe
+
+    int m_frame;             ///< pending frame number
+    double m_time;           ///< pending frame time
+    bool m_time_pending;     ///< a WriteTime record has not been forwarded yet
+    std::string m_section;   ///< pending section name
+    bool m_section_pending;  ///< a WriteSection record has not been forwarded yet
+
+    std::unordered_map<const void*, Signature> m_signatures;  ///< last written state per component
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -54,7 +54,14 @@ namespace chrono {
 namespace vehicle {
 
 CRGTerrain::CRGTerrain(ChSystem* system)
-    : m_use_vis_mesh(true), m_friction(0.8f), m_dataSetId(0), m_cpId(0), m_isClosed(false) {
+    : m_use_vis_mesh(true),
+      m_friction(0.8f),
+      m_dataSetId(0),
+      m_cpId(0),
+      m_isClosed(false),
+      m_tiled(false),
+      m_tile_length(100),
+      m_max_tiles(8) {
     m_ground = std::shared_ptr<ChBody>(system->NewBody());
     m_ground->SetName("ground");
     m_ground->SetPos(ChVector<>(0, 0, 0));
@@ -69,6 +76,13 @@ CRGTerrain::~CRGTerrain() {
     crgMemRelease();
 }
 
+void CRGTerrain::EnableTiledMesh(std::shared_ptr<ChBody> body, double tile_length, int max_cached_tiles) {
+    m_monitor_body = body;
+    m_tile_length = tile_length;
+    m_max_tiles = max_cached_tiles;
+    m_tiled = true;
+}
+
 void CRGTerrain::Initialize(const std::string& crg_file) {
     m_v.clear();
 
@@ -136,12 +150,25 @@ void CRGTerrain::Initialize(const std::string& crg_file) {
     }
 
     if (m_use_vis_mesh) {
-        SetupMeshGraphics();
+        if (m_tiled) {
+            // Lazy meshing: only create the tiles around the monitored body.
+            auto mfloorcolor = std::make_shared<ChColorAsset>();
+            mfloorcolor->SetColor(ChColor(0.6f, 0.6f, 0.8f));
+            m_ground->AddAsset(mfloorcolor);
+            UpdateTiles();
+        } else {
+            SetupMeshGraphics();
+        }
     } else {
         SetupLineGraphics();
     }
 }
 
+void CRGTerrain::Synchronize(double time) {
+    if (m_tiled && m_use_vis_mesh)
+        UpdateTiles();
+}
+
 float CRGTerrain::GetCoefficientFriction(double x, double y) const {
     return m_friction_fun ? (*m_friction_fun)(x, y) : m_friction;
 }
@@ -279,12 +306,12 @@ void CRGTerrain::SetupLineGraphics() {
     m_ground->AddAsset(bezier_asset_right);
 }
 
-void CRGTerrain::SetupMeshGraphics() {
+std::shared_ptr<ChTriangleMeshShape> CRGTerrain::BuildMesh(double ubeg, double uend, bool close) {
     auto mmesh = std::make_shared<ChTriangleMeshShape>();
     auto& coords = mmesh->GetMesh()->getCoordsVertices();
     auto& indices = mmesh->GetMesh()->getIndicesVertexes();
 
-    int nu = static_cast<int>((m_uend - m_ubeg) / m_uinc) + 1;
+    int nu = static_cast<int>((uend - ubeg) / m_uinc) + 1;
     int nv;
 
     std::vector<double> x0, y0, z0;
@@ -293,7 +320,7 @@ void CRGTerrain::SetupMeshGraphics() {
         // v is nonequidistant, we use m_v[]
         nv = static_cast<int>(m_v.size());
         for (auto i = 0; i < nu; i++) {
-            double u = m_ubeg + m_uinc * double(i);
+            double u = ubeg + m_uinc * double(i);
             for (auto j = 0; j < nv; j++) {
                 double x, y, z, v;
                 v = m_v[j];
@@ -312,7 +339,7 @@ void CRGTerrain::SetupMeshGraphics() {
                     y0.push_back(y);
                     z0.push_back(z);
                 }
-                if (i == nu - 1 && m_isClosed) {
+                if (i == nu - 1 && close) {
                     coords.push_back(ChVector<>(x0[j], y0[j], z0[j]));
                 } else {
                     coords.push_back(ChVector<>(x, y, z));
@@ -323,7 +350,7 @@ void CRGTerrain::SetupMeshGraphics() {
         // v is equidistant, we use m_vinc
         nv = static_cast<int>((m_vend - m_vbeg) / m_vinc) + 1;
         for (auto i = 0; i < nu; i++) {
-            double u = m_ubeg + m_uinc * double(i);
+            double u = ubeg + m_uinc * double(i);
             for (auto j = 0; j < nv; j++) {
                 double v = m_vbeg + m_vinc * double(j);
                 double x, y, z;
@@ -342,7 +369,7 @@ void CRGTerrain::SetupMeshGraphics() {
                     y0.push_back(y);
                     z0.push_back(z);
                 }
-                if (i == nu - 1 && m_isClosed) {
+                if (i == nu - 1 && close) {
                     coords.push_back(ChVector<>(x0[j], y0[j], z0[j]));
                 } else {
                     coords.push_back(ChVector<>(x, y, z));
@@ -360,11 +387,69 @@ void CRGTerrain::SetupMeshGraphics() {
         }
     }
 
+    return mmesh;
+}
+
+void CRGTerrain::SetupMeshGraphics() {
     auto mfloorcolor = std::make_shared<ChColorAsset>();
     mfloorcolor->SetColor(ChColor(0.6f, 0.6f, 0.8f));
 
     m_ground->AddAsset(mfloorcolor);
-    m_ground->AddAsset(mmesh);
+    m_ground->AddAsset(BuildMesh(m_ubeg, m_uend, m_isClosed));
+}
+
+std::shared_ptr<ChTriangleMeshShape> CRGTerrain::BuildMeshTile(int tile) {
+    double ubeg = m_ubeg + tile * m_tile_length;
+    double uend = ChMin(ubeg + m_tile_length, m_uend);
+    return BuildMesh(ubeg, uend, false);
+}
+
+void CRGTerrain::UpdateTiles() {
+    int num_tiles = static_cast<int>((m_uend - m_ubeg) / m_tile_length) + 1;
+
+    // Locate the monitored body along the road.
+    double u, v;
+    const ChVector<>& pos = m_monitor_body->GetPos();
+    int uv_ok = crgEvalxy2uv(m_cpId, pos.x(), pos.y(), &u, &v);
+    if (uv_ok != 1)
+        u = m_ubeg;
+    ChClampValue(u, m_ubeg, m_uend);
+
+    int tile = static_cast<int>((u - m_ubeg) / m_tile_length);
+    ChClampValue(tile, 0, num_tiles - 1);
+
+    // Request the tile under the body and its two neighbors (wrapping on closed roads).
+    for (int it = tile - 1; it <= tile + 1; it++) {
+        int t = it;
+        if (m_isClosed)
+            t = (t + num_tiles) % num_tiles;
+        if (t < 0 || t >= num_tiles)
+            continue;
+
+        auto cached = m_tile_cache.find(t);
+        if (cached != m_tile_cache.end()) {
+            // Tile already resident; mark it as most recently used.
+            m_tile_lru.remove(t);
+            m_tile_lru.push_front(t);
+            continue;
+        }
+
+        // Evaluate and mesh the tile, then add it to the cache.
+        auto tmesh = BuildMeshTile(t);
+        m_ground->AddAsset(tmesh);
+        m_tile_cache.insert(std::make_pair(t, tmesh));
+        m_tile_lru.push_front(t);
+    }
+
+    // Evict the least recently used tiles in excess of the cache capacity.
+    while (static_cast<int>(m_tile_lru.size()) > m_max_tiles) {
+        int victim = m_tile_lru.back();
+        m_tile_lru.pop_back();
+        auto entry = m_tile_cache.find(victim);
+        auto& assets = m_ground->GetAssets();
+        assets.erase(std::remove(assets.begin(), assets.end(), entry->second), assets.end());
+        m_tile_cache.erase(entry);
+    }
 }
 
 }  // end namespace vehicle
@@ -28,8 +28,12 @@
 #ifndef CRGTERRAIN_H
 #define CRGTERRAIN_H
 
+#include <list>
+#include <unordered_map>
+
 #include "chrono/assets/ChColor.h"
 #include "chrono/assets/ChColorAsset.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChSystem.h"
@@ -62,10 +66,26 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// The default value is 0.8
     void SetContactFrictionCoefficient(float friction_coefficient) { m_friction = friction_coefficient; }
 
+    /// Enable tile-based lazy evaluation of the visualization mesh (default: disabled).
+    /// Instead of meshing the entire road up front, the road is split into tiles of the
+    /// specified length along the road and only the tiles around the monitored body
+    /// (typically the vehicle chassis) are evaluated and meshed. A least-recently-used
+    /// cache keeps at most max_cached_tiles tiles resident and evicts distant ones, which
+    /// bounds memory on long road networks. Must be called before Initialize().
+    void EnableTiledMesh(std::shared_ptr<ChBody> body,  ///< [in] monitored body
+                         double tile_length = 100,      ///< [in] tile length along the road
+                         int max_cached_tiles = 8       ///< [in] capacity of the tile cache
+    );
+
     /// Initialize the CRGTerrain from the specified OpenCRG file.
     void Initialize(const std::string& crg_file  ///< [in] OpenCRG road specification file
     );
 
+    /// Update the state of the terrain system at the specified time.
+    /// With tiled meshing enabled, this loads the tiles around the monitored body and
+    /// evicts the least recently used tiles in excess of the cache capacity.
+    virtual void Synchronize(double time) override;
+
     ~CRGTerrain();
 
     /// Get the terrain height at the specified (x,y) location.
@@ -100,6 +120,15 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     void SetupLineGraphics();
     void SetupMeshGraphics();
 
+    /// Build a visualization mesh for the road section with u in [ubeg, uend].
+    std::shared_ptr<ChTriangleMeshShape> BuildMesh(double ubeg, double uend, bool close);
+
+    /// Build the visualization mesh for the specified tile.
+    std::shared_ptr<ChTriangleMeshShape> BuildMeshTile(int tile);
+
+    /// Load the tiles around the monitored body and evict excess tiles, LRU first.
+    void UpdateTiles();
+
     std::shared_ptr<ChBody> m_ground;  ///< ground body
     bool m_use_vis_mesh;               ///< mesh or boundary visual asset?
     float m_friction;                  ///< contact coefficient of friction
@@ -114,6 +143,14 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
 
 
     std::vector<double> m_v;  // vector with distinct v values, if m_vinc <= 0.01 m
+
+    // Tile-based lazy meshing
+    bool m_tiled;                            ///< tile-based lazy meshing enabled?
+    std::shared_ptr<ChBody> m_monitor_body;  ///< body whose position selects the resident tiles
+    double m_tile_length;                    ///< tile length along the road (u direction)
+    int m_max_tiles;                         ///< capacity of the tile cache
+    std::list<int> m_tile_lru;               ///< resident tile indices, most recently used first
+    std::unordered_map<int, std::shared_ptr<ChTriangleMeshShape>> m_tile_cache;  ///< resident tile assets
 };
 
 /// @} vehicle_terrain
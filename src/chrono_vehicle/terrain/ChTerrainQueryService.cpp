@@ -0,0 +1,255 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Asynchronous terrain query service for sensor simulation (see header).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+#include "chrono_vehicle/terrain/ChTerrainQueryService.h"
+
+namespace chrono {
+namespace vehicle {
+
+// Tiles not referenced by any query for this many Sync() calls are evicted.
+static const int tile_age_limit = 100;
+
+// -----------------------------------------------------------------------------
+
+ChTerrainQueryService::Batch::Batch(std::vector<ChVector2<double>>&& pts, std::function<void(const Batch&)>&& cb)
+    : points(std::move(pts)), callback(std::move(cb)), done(false) {
+    results.resize(points.size());
+}
+
+const std::vector<ChTerrainQueryService::Result>& ChTerrainQueryService::Batch::Wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return done; });
+    return results;
+}
+
+bool ChTerrainQueryService::Batch::IsReady() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return done;
+}
+
+// -----------------------------------------------------------------------------
+
+ChTerrainQueryService::ChTerrainQueryService(ChTerrain* terrain, int num_threads)
+    : m_terrain(terrain),
+      m_tile_size(4),
+      m_samples(32),
+      m_frame(0),
+      m_tiles_sampled(0),
+      m_tiles_prefetched(0),
+      m_have_centroid(false),
+      m_active(0),
+      m_shutdown(false) {
+    for (int i = 0; i < num_threads; i++)
+        m_workers.emplace_back(&ChTerrainQueryService::WorkerLoop, this);
+}
+
+ChTerrainQueryService::~ChTerrainQueryService() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+void ChTerrainQueryService::SetTileResolution(double tile_size, int samples_per_edge) {
+    m_tile_size = tile_size;
+    m_samples = samples_per_edge;
+    m_tiles.clear();
+}
+
+std::shared_ptr<ChTerrainQueryService::Batch> ChTerrainQueryService::Submit(
+    const std::vector<ChVector2<double>>& points,
+    std::function<void(const Batch&)> callback) {
+    std::shared_ptr<Batch> batch(new Batch(std::vector<ChVector2<double>>(points), std::move(callback)));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.push_back(batch);
+    return batch;
+}
+
+void ChTerrainQueryService::Sync() {
+    m_frame++;
+
+    // Take over the batches submitted since the previous Sync(), and make sure
+    // the workers are done with the previous frame before the snapshot is
+    // modified underneath them (normally instant: a sensor that consumed its
+    // results has already drained the queue).
+    std::vector<std::shared_ptr<Batch>> staged;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_idle.wait(lock, [this] { return m_work.empty() && m_active == 0; });
+        staged.swap(m_pending);
+    }
+
+    // The tiles covering this frame's queries.
+    std::set<TileKey> needed;
+    ChVector2<double> centroid(0, 0);
+    size_t num_points = 0;
+    for (auto& batch : staged) {
+        for (auto& p : batch->points) {
+            needed.insert(TileKey((int)std::floor(p.x() / m_tile_size), (int)std::floor(p.y() / m_tile_size)));
+            centroid += p;
+            num_points++;
+        }
+    }
+
+    // Prefetch: translate the footprint by its frame-to-frame motion, so the
+    // tiles a sweeping scan will enter next frame are sampled this frame.
+    m_tiles_prefetched = 0;
+    if (num_points > 0) {
+        centroid = centroid * (1.0 / (double)num_points);
+        if (m_have_centroid) {
+            ChVector2<double> delta = centroid - m_last_centroid;
+            int sx = (int)std::round(delta.x() / m_tile_size);
+            int sy = (int)std::round(delta.y() / m_tile_size);
+            if (sx == 0 && sy == 0 && (delta.x() != 0 || delta.y() != 0)) {
+                // sub-tile motion: prefetch one tile in the dominant direction
+                if (std::abs(delta.x()) > std::abs(delta.y()))
+                    sx = delta.x() > 0 ? 1 : -1;
+                else
+                    sy = delta.y() > 0 ? 1 : -1;
+            }
+            if (sx != 0 || sy != 0) {
+                std::set<TileKey> ahead;
+                for (auto& key : needed)
+                    ahead.insert(TileKey(key.first + sx, key.second + sy));
+                for (auto& key : ahead) {
+                    if (needed.count(key) == 0 && m_tiles.count(key) == 0) {
+                        SampleTile(key);
+                        m_tiles_prefetched++;
+                    }
+                }
+            }
+        }
+        m_last_centroid = centroid;
+        m_have_centroid = true;
+    }
+
+    // Sample the missing tiles and refresh the age of the used ones.
+    m_tiles_sampled = m_tiles_prefetched;
+    for (auto& key : needed) {
+        auto it = m_tiles.find(key);
+        if (it == m_tiles.end()) {
+            SampleTile(key);
+            m_tiles_sampled++;
+        } else {
+            it->second.last_used_frame = m_frame;
+        }
+    }
+
+    // Evict tiles that no recent frame touched.
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        if (m_frame - it->second.last_used_frame > tile_age_limit)
+            it = m_tiles.erase(it);
+        else
+            ++it;
+    }
+
+    // Publish the staged batches to the workers.
+    if (!staged.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& batch : staged)
+                m_work.push_back(batch);
+        }
+        m_cv.notify_all();
+    }
+}
+
+void ChTerrainQueryService::SampleTile(const TileKey& key) {
+    Tile& tile = m_tiles[key];
+    tile.x0 = key.first * m_tile_size;
+    tile.y0 = key.second * m_tile_size;
+    tile.last_used_frame = m_frame;
+    int n = m_samples;
+    double step = m_tile_size / n;
+    tile.z.resize((n + 1) * (n + 1));
+    for (int iy = 0; iy <= n; iy++)
+        for (int ix = 0; ix <= n; ix++)
+            tile.z[iy * (n + 1) + ix] = m_terrain->GetHeight(tile.x0 + ix * step, tile.y0 + iy * step);
+}
+
+void ChTerrainQueryService::ExecuteBatch(Batch& batch) const {
+    int n = m_samples;
+    double step = m_tile_size / n;
+    for (size_t i = 0; i < batch.points.size(); i++) {
+        const ChVector2<double>& p = batch.points[i];
+        Result& res = batch.results[i];
+        TileKey key((int)std::floor(p.x() / m_tile_size), (int)std::floor(p.y() / m_tile_size));
+        auto it = m_tiles.find(key);
+        if (it == m_tiles.end()) {
+            // cannot happen for points known to Sync(); defensive default
+            res.height = 0;
+            res.normal = ChVector<>(0, 0, 1);
+            continue;
+        }
+        const Tile& tile = it->second;
+        double fx = (p.x() - tile.x0) / step;
+        double fy = (p.y() - tile.y0) / step;
+        int ix = std::min((int)fx, n - 1);
+        int iy = std::min((int)fy, n - 1);
+        fx -= ix;
+        fy -= iy;
+        double z00 = tile.z[iy * (n + 1) + ix];
+        double z10 = tile.z[iy * (n + 1) + ix + 1];
+        double z01 = tile.z[(iy + 1) * (n + 1) + ix];
+        double z11 = tile.z[(iy + 1) * (n + 1) + ix + 1];
+        res.height = z00 * (1 - fx) * (1 - fy) + z10 * fx * (1 - fy) + z01 * (1 - fx) * fy + z11 * fx * fy;
+        // normal from the gradient of the bilinear patch at the query point
+        double dzdx = ((z10 - z00) * (1 - fy) + (z11 - z01) * fy) / step;
+        double dzdy = ((z01 - z00) * (1 - fx) + (z11 - z10) * fx) / step;
+        res.normal = ChVector<>(-dzdx, -dzdy, 1).GetNormalized();
+    }
+}
+
+void ChTerrainQueryService::WorkerLoop() {
+    while (true) {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_shutdown || !m_work.empty(); });
+            if (m_shutdown)
+                return;
+            batch = m_work.front();
+            m_work.pop_front();
+            m_active++;
+        }
+
+        ExecuteBatch(*batch);
+
+        {
+            std::lock_guard<std::mutex> lock(batch->mutex);
+            batch->done = true;
+        }
+        batch->cv.notify_all();
+        if (batch->callback)
+            batch->callback(*batch);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_active--;
+        }
+        m_cv_idle.notify_one();
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,177 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Asynchronous terrain query service for sensor simulation.
+//
+// Simulated range/height sensors issue tens of thousands of terrain queries
+// per frame; answered synchronously (ray casts, patch searches) they compete
+// with the dynamics for the step budget. This service moves the per-query work
+// to worker threads: queries are submitted in batches, answered by bilinear
+// interpolation on an immutable snapshot of the terrain height field, and
+// collected through a wait/callback interface one Sync() later.
+//
+// The snapshot is a set of square height tiles. Only Sync(), which the
+// simulation thread calls between steps (when the terrain is quiescent),
+// touches the live terrain: it samples the tiles covering the pending queries,
+// plus prefetched tiles ahead of the scan footprint along its frame-to-frame
+// motion, so a steadily sweeping sensor rarely has to wait for sampling.
+//
+// =============================================================================
+
+#ifndef CH_TERRAIN_QUERY_SERVICE_H
+#define CH_TERRAIN_QUERY_SERVICE_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChVector2.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChTerrain.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_terrain
+/// @{
+
+/// Asynchronous, batched terrain query service (see the file header for the
+/// execution model). Typical per-frame use from the simulation loop:
+/// <pre>
+///     auto batch = service.Submit(scan_points);   // any thread, any time
+///     system.DoStepDynamics(step);
+///     service.Sync();                             // simulation thread only
+///     ...                                         // batch completes in the background
+///     const auto& results = batch->Wait();        // or consume from the callback
+/// </pre>
+class CH_VEHICLE_API ChTerrainQueryService {
+  public:
+    /// Result of a single terrain query.
+    struct Result {
+        double height;       ///< terrain height at the query location
+        ChVector<> normal;   ///< terrain normal, from the height field gradient
+    };
+
+    /// Handle to a submitted batch of queries.
+    /// Results become available after the Sync() following the submission; the
+    /// optional completion callback runs on a worker thread.
+    class CH_VEHICLE_API Batch {
+      public:
+        /// Block until the batch is complete and return the results, in the
+        /// order of the submitted points. Do not call before the next Sync()
+        /// from the loop that must also issue that Sync(), since the batch can
+        /// only complete after it.
+        const std::vector<Result>& Wait();
+
+        /// Return true if the batch is complete (Wait() will not block).
+        bool IsReady() const;
+
+      private:
+        Batch(std::vector<ChVector2<double>>&& pts, std::function<void(const Batch&)>&& cb);
+
+        std::vector<ChVector2<double>> points;       ///< query locations
+        std::vector<Result> results;                 ///< per-point results
+        std::function<void(const Batch&)> callback;  ///< optional completion callback
+        mutable std::mutex mutex;
+        mutable std::condition_variable cv;
+        bool done;
+
+        friend class ChTerrainQueryService;
+    };
+
+    /// Construct a query service for the given terrain, with the specified
+    /// number of worker threads. The terrain must outlive the service.
+    ChTerrainQueryService(ChTerrain* terrain, int num_threads = 2);
+    ~ChTerrainQueryService();
+
+    /// Set the edge length of a snapshot tile and the number of height samples
+    /// per tile edge (default: 4m tiles with 32 samples, i.e. 12.5cm sampling).
+    /// The sample spacing bounds the interpolation error against the true
+    /// terrain; tiles unused for a number of frames are evicted. Flushes the
+    /// current snapshot; call before the first Submit() or between frames.
+    void SetTileResolution(double tile_size, int samples_per_edge);
+
+    /// Submit a batch of query locations, with an optional completion callback
+    /// invoked (on a worker thread) when the results are ready. Thread safe.
+    std::shared_ptr<Batch> Submit(const std::vector<ChVector2<double>>& points,
+                                  std::function<void(const Batch&)> callback = nullptr);
+
+    /// Advance the service by one frame. Must be called from the simulation
+    /// thread while no step is in progress: this is the only method that
+    /// queries the live terrain. Samples the tiles needed by the batches
+    /// submitted since the previous Sync() (plus the prefetch set), hands the
+    /// batches to the workers, and returns without waiting for them.
+    void Sync();
+
+    /// Get the number of tiles currently held in the snapshot.
+    size_t GetNumTiles() const { return m_tiles.size(); }
+
+    /// Get the number of tiles sampled during the last Sync().
+    size_t GetNumTilesSampled() const { return m_tiles_sampled; }
+
+    /// Get the number of tiles the last Sync() sampled ahead of the scan.
+    size_t GetNumTilesPrefetched() const { return m_tiles_prefetched; }
+
+  private:
+    /// One square tile of the height-field snapshot: (n+1)x(n+1) samples over
+    /// [x0, x0+size] x [y0, y0+size], row-major in y.
+    struct Tile {
+        double x0;
+        double y0;
+        std::vector<double> z;
+        int last_used_frame;
+    };
+
+    typedef std::pair<int, int> TileKey;
+
+    /// Sample one tile from the live terrain (simulation thread only).
+    void SampleTile(const TileKey& key);
+
+    /// Answer one batch from the snapshot (worker threads).
+    void ExecuteBatch(Batch& batch) const;
+
+    /// Worker thread body: wait for published batches and execute them.
+    void WorkerLoop();
+
+    ChTerrain* m_terrain;  ///< the queried terrain (not owned)
+    double m_tile_size;    ///< tile edge length
+    int m_samples;         ///< height samples per tile edge (grid is m_samples+1 wide)
+
+    std::map<TileKey, Tile> m_tiles;  ///< the height-field snapshot
+    int m_frame;                      ///< Sync() counter, for tile aging
+    size_t m_tiles_sampled;           ///< tiles sampled in the last Sync()
+    size_t m_tiles_prefetched;        ///< prefetched tiles in the last Sync()
+    ChVector2<double> m_last_centroid;  ///< query centroid at the previous Sync()
+    bool m_have_centroid;               ///< is m_last_centroid valid?
+
+    std::vector<std::shared_ptr<Batch>> m_pending;  ///< submitted, waiting for Sync()
+    std::deque<std::shared_ptr<Batch>> m_work;      ///< published to the workers
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;                 ///< guards m_pending, m_work, m_active, m_shutdown
+    std::condition_variable m_cv;       ///< wakes the workers
+    std::condition_variable m_cv_idle;  ///< wakes Sync() waiting for the workers to drain
+    int m_active;                       ///< batches currently being executed
+    bool m_shutdown;
+};
+
+/// @} vehicle_terrain
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -39,6 +39,8 @@
 
 #include <cstdio>
 #include <cmath>
+#include <fstream>
+#include <utility>
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/utils/ChUtilsGenerators.h"
@@ -71,7 +73,18 @@ GranularTerrain::GranularTerrain(ChSystem* system)
       m_vis_enabled(false),
       m_moving_patch(false),
       m_moved(false),
-      m_envelope(-1) {
+      m_envelope(-1),
+      m_tiled(false),
+      m_tile_index(0),
+      m_last_moved(0),
+      m_tile_top(0),
+      m_tile_ready(false),
+      m_tile_pending(false),
+      m_job_posted(false),
+      m_job_index(0),
+      m_job_count(0),
+      m_save_index(0),
+      m_worker_quit(false) {
     // Create the ground body and add it to the system.
     m_ground = std::shared_ptr<ChBody>(system->NewBody());
     m_ground->SetName("ground");
@@ -103,6 +116,17 @@ GranularTerrain::GranularTerrain(ChSystem* system)
     m_ground->AddAsset(m_color);
 }
 
+GranularTerrain::~GranularTerrain() {
+    if (m_worker.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_worker_quit = true;
+        }
+        m_cv.notify_one();
+        m_worker.join();
+    }
+}
+
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 void GranularTerrain::SetContactFrictionCoefficient(float friction_coefficient) {
@@ -165,6 +189,16 @@ void GranularTerrain::EnableMovingPatch(std::shared_ptr<ChBody> body,
     m_moving_patch = true;
 }
 
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void GranularTerrain::EnableTiledStreaming(const std::string& tile_dir) {
+    m_tile_dir = tile_dir;
+
+    // Enable tiled streaming and start the tile worker thread.
+    m_tiled = true;
+    m_worker = std::thread(&GranularTerrain::TileWorker, this);
+}
+
 // -----------------------------------------------------------------------------
 // Custom collision callback
 // -----------------------------------------------------------------------------
@@ -477,12 +511,130 @@ void GranularTerrain::Initialize(const ChVector<>& center,
     m_ground->GetSystem()->RegisterCustomCollisionCallback(cb);
 }
 
+// -----------------------------------------------------------------------------
+// Tiled streaming (tiles coincide with the shift-distance strips of the moving
+// patch feature).  The expensive part of a patch relocation -- Poisson Disk
+// sampling of the refill locations and serialization of the departed particle
+// states -- is performed by a worker thread, overlapping with simulation
+// stepping; Synchronize() only performs the (cheap) particle state updates.
+// -----------------------------------------------------------------------------
+
+// Name of the file storing the particle states of the tile with given index.
+static std::string TileFileName(const std::string& tile_dir, int index) {
+    char filename[32];
+    std::sprintf(filename, "tile_%06d.dat", index);
+    return tile_dir + "/" + filename;
+}
+
+// Request (asynchronous) preparation of the tile entering the front boundary.
+void GranularTerrain::PostTileJob(unsigned int estimate) {
+    double r = safety_factor * m_radius;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job_index = m_tile_index;
+        m_job_count = estimate;
+        m_job_center =
+            ChVector<>(m_front + m_shift_distance / 2, (m_left + m_right) / 2, m_bottom + offset_factor * r);
+        m_job_hdims = ChVector<>(m_shift_distance / 2 - r, m_width / 2 - r, 0);
+        m_job_posted = true;
+        m_tile_pending = true;
+    }
+    m_cv.notify_one();
+}
+
+// Worker thread body.  Serializes the states of departed tiles and prepares
+// incoming tiles, either by reading them back from disk (if previously
+// serialized) or by Poisson Disk sampling of fresh refill locations.
+void GranularTerrain::TileWorker() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_worker_quit || m_job_posted || !m_save_states.empty(); });
+
+        if (m_worker_quit)
+            return;
+
+        if (!m_save_states.empty()) {
+            // Serialize the states of the departed tile.
+            auto states = std::move(m_save_states);
+            m_save_states.clear();
+            int index = m_save_index;
+            lock.unlock();
+
+            std::ofstream ofile(TileFileName(m_tile_dir, index));
+            ofile << states.size() << std::endl;
+            for (const auto& state : states) {
+                ofile << state.first.x() << " " << state.first.y() << " " << state.first.z() << " ";
+                ofile << state.second.x() << " " << state.second.y() << " " << state.second.z() << std::endl;
+            }
+
+            lock.lock();
+            continue;  // re-evaluate the wait condition
+        }
+
+        // Copy the job inputs and release the lock while preparing the tile.
+        int index = m_job_index;
+        unsigned int count = m_job_count;
+        ChVector<> layer_center = m_job_center;
+        ChVector<> layer_hdims = m_job_hdims;
+        m_job_posted = false;
+        lock.unlock();
+
+        std::vector<ChVector<>> points;
+        std::vector<ChVector<>> vels;
+
+        // If this tile was serialized in a previous pass, rehydrate it.
+        if (!m_tile_dir.empty()) {
+            std::ifstream ifile(TileFileName(m_tile_dir, index));
+            if (ifile.is_open()) {
+                size_t np;
+                ifile >> np;
+                ChVector<> pos;
+                ChVector<> vel;
+                for (size_t i = 0; i < np; i++) {
+                    ifile >> pos.x() >> pos.y() >> pos.z() >> vel.x() >> vel.y() >> vel.z();
+                    points.push_back(pos);
+                    vels.push_back(vel);
+                }
+            }
+        }
+
+        // Otherwise, generate refill locations in layers within the tile volume.
+        double r = safety_factor * m_radius;
+        if (points.empty()) {
+            utils::PDSampler<> sampler(2 * r);
+            while (points.size() < count) {
+                auto layer = sampler.SampleBox(layer_center, layer_hdims);
+                points.insert(points.end(), layer.begin(), layer.end());
+                layer_center.z() += 2 * r;
+            }
+        }
+
+        // Publish the prepared tile.
+        lock.lock();
+        m_tile_points.swap(points);
+        m_tile_vels.swap(vels);
+        m_tile_top = layer_center.z();
+        m_tile_ready = true;
+        m_tile_pending = false;
+    }
+}
+
 void GranularTerrain::Synchronize(double time) {
     m_moved = false;
 
     if (!m_moving_patch)
         return;
 
+    // With tiled streaming, keep the worker one tile ahead of the vehicle.
+    // (After the first relocation, the size of the previous tile is used as
+    // estimate for the number of refill locations to prepare.)
+    if (m_tiled && !m_tile_ready && !m_tile_pending) {
+        unsigned int estimate = m_last_moved > 0
+                                    ? m_last_moved
+                                    : (unsigned int)(m_num_particles * m_shift_distance / (m_front - m_rear));
+        PostTileJob(estimate);
+    }
+
     // Check distance from monitored body to front boundary.
     double dist = m_front - m_body->GetFrame_REF_to_abs().GetPos().x();
     if (dist >= m_buffer_distance)
@@ -502,24 +654,49 @@ void GranularTerrain::Synchronize(double time) {
         }
     }
 
-    // Create a Poisson Disk sampler and generate points in layers within the relocation volume.
+    // New particle locations (and, for a rehydrated tile, velocities).
     std::vector<ChVector<>> new_points;
+    std::vector<ChVector<>> new_vels;
     double r = safety_factor * m_radius;
-    utils::PDSampler<> sampler(2 * r);
     ChVector<> layer_hdims(m_shift_distance / 2 - r, m_width / 2 - r, 0);
     ChVector<> layer_center(m_front + m_shift_distance / 2, (m_left + m_right) / 2, m_bottom + offset_factor * r);
+
+    // Consume the tile prepared by the worker, if available.
+    if (m_tiled) {
+        bool prepared = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_tile_ready) {
+                new_points.swap(m_tile_points);
+                new_vels.swap(m_tile_vels);
+                layer_center.z() = m_tile_top;  // additional layers go above the prepared ones
+                m_tile_ready = false;
+                prepared = true;
+            }
+        }
+        if (!prepared && m_verbose)
+            std::cout << "Tile not ready: falling back to synchronous sampling" << std::endl;
+    }
+
+    // Create a Poisson Disk sampler and generate points in layers within the relocation volume.
+    // (With tiled streaming, this only tops up a prepared tile which came up short.)
+    utils::PDSampler<> sampler(2 * r);
     while (new_points.size() < num_moved_particles) {
         auto points = sampler.SampleBox(layer_center, layer_hdims);
         new_points.insert(new_points.end(), points.begin(), points.end());
         layer_center.z() += 2 * r;
     }
 
-    // Relocate particles at their new locations.
+    // Relocate particles at their new locations, capturing the departed states
+    // first if they are to be serialized.
+    std::vector<std::pair<ChVector<>, ChVector<>>> departed;
     size_t ip = 0;
     for (auto body : m_ground->GetSystem()->Get_bodylist()) {
         if (body->GetIdentifier() > m_start_id && body->GetPos().x() - m_radius < m_rear) {
+            if (m_tiled && !m_tile_dir.empty())
+                departed.push_back(std::make_pair(body->GetPos(), body->GetPos_dt()));
+            body->SetPos_dt(ip < new_vels.size() ? new_vels[ip] : m_init_part_vel);
             body->SetPos(new_points[ip++]);
-            body->SetPos_dt(m_init_part_vel);
         }
     }
 
@@ -528,6 +705,18 @@ void GranularTerrain::Synchronize(double time) {
 
     m_moved = true;
 
+    if (m_tiled) {
+        // Hand the departed states over to the worker and request the next tile.
+        m_last_moved = num_moved_particles;
+        if (!departed.empty()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_save_states.swap(departed);
+            m_save_index = m_tile_index - (int)std::lround(m_length / m_shift_distance);
+        }
+        m_tile_index++;
+        PostTileJob(num_moved_particles);
+    }
+
     if (m_verbose) {
         std::cout << "Move patch at time " << time << std::endl;
         std::cout << "   moved " << num_moved_particles << " particles" << std::endl;
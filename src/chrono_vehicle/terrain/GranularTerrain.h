@@ -28,6 +28,12 @@
 #ifndef GRANULAR_TERRAIN_H
 #define GRANULAR_TERRAIN_H
 
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChMaterialSurfaceNSC.h"
@@ -53,7 +59,7 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     GranularTerrain(ChSystem* system  ///< [in] pointer to the containing multibody system
                     );
 
-    ~GranularTerrain() {}
+    ~GranularTerrain();
 
     /// Set coefficient of friction.
     /// The default value is 0.9
@@ -117,6 +123,20 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
                            const ChVector<>& init_vel = ChVector<>()  ///< initial particle velocity
                            );
 
+    /// Enable tiled streaming for the moving patch (requires EnableMovingPatch).
+    /// The terrain is treated as a sequence of tiles of length equal to the shift
+    /// distance. The refill tile entering the front is prepared asynchronously on a
+    /// worker thread, overlapping with simulation stepping: the Poisson Disk sampling
+    /// of the new particle locations (the dominant cost of a synchronous relocation)
+    /// is already done when the patch must move, and Synchronize() only performs the
+    /// cheap state writes. If 'tile_dir' is non-empty, the state of each departed
+    /// tile is serialized to 'tile_dir/tile_<index>.dat' (also asynchronously), and
+    /// an incoming tile whose file already exists (e.g. from a previous run over the
+    /// same course) is rehydrated from disk instead of being resampled.
+    /// If a relocation is triggered before the worker has finished preparing the
+    /// tile, Synchronize() falls back to the synchronous path.
+    void EnableTiledStreaming(const std::string& tile_dir = "");
+
     /// Set start value for body identifiers of generated particles (default: 1000000).
     /// It is assumed that all bodies with a larger identifier are granular material particles.
     void SetStartIdentifier(int id) { m_start_id = id; }
@@ -226,6 +246,35 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     double m_shift_distance;         ///< size (X direction) of relocated volume
     ChVector<> m_init_part_vel;      ///< initial particle velocity
 
+    // Tiled streaming (moving patch)
+    void TileWorker();        ///< worker thread body: tile preparation and serialization
+    void PostTileJob(unsigned int estimate);  ///< request preparation of the next incoming tile
+
+    bool m_tiled;             ///< tiled streaming feature enabled?
+    std::string m_tile_dir;   ///< directory for serialized tiles (empty: do not serialize)
+    int m_tile_index;         ///< index of the next tile entering the front
+    unsigned int m_last_moved;  ///< number of particles relocated at the last shift
+
+    std::vector<ChVector<>> m_tile_points;  ///< prepared refill locations
+    std::vector<ChVector<>> m_tile_vels;    ///< refill velocities (rehydrated tiles only)
+    double m_tile_top;                      ///< height above the prepared layers (for top-up)
+    bool m_tile_ready;                      ///< a prepared tile is available
+    bool m_tile_pending;                    ///< the worker is preparing a tile
+
+    bool m_job_posted;          ///< a tile preparation job is waiting
+    int m_job_index;            ///< tile index of the posted job
+    unsigned int m_job_count;   ///< number of locations to prepare
+    ChVector<> m_job_center;    ///< center of the first refill layer
+    ChVector<> m_job_hdims;     ///< half-dimensions of a refill layer
+
+    std::vector<std::pair<ChVector<>, ChVector<>>> m_save_states;  ///< departed tile states (pos, vel)
+    int m_save_index;           ///< tile index of the states to serialize
+
+    std::thread m_worker;            ///< tile worker thread
+    std::mutex m_mutex;              ///< guards the job and result data above
+    std::condition_variable m_cv;    ///< wakes up the worker
+    bool m_worker_quit;              ///< worker shutdown flag
+
     // Rough surface (ground-fixed spheres)
     bool m_rough_surface;  ///< rough surface feature enabled?
     int m_nx;              ///< number of fixed spheres in X direction
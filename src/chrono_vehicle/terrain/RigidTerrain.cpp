@@ -42,12 +42,14 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // Default constructor.
 // -----------------------------------------------------------------------------
-RigidTerrain::RigidTerrain(ChSystem* system) : m_system(system), m_num_patches(0) {}
+RigidTerrain::RigidTerrain(ChSystem* system)
+    : m_system(system), m_num_patches(0), m_grid_cell_size(0), m_grid_generation(0) {}
 
 // -----------------------------------------------------------------------------
 // Constructor from JSON file
 // -----------------------------------------------------------------------------
-RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename) : m_system(system), m_num_patches(0) {
+RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
+    : m_system(system), m_num_patches(0), m_grid_cell_size(0), m_grid_generation(0) {
     // Open the JSON file and read data
     FILE* fp = fopen(filename.c_str(), "r");
 
@@ -483,8 +485,53 @@ std::shared_ptr<ChBody> RigidTerrain::Patch::GetGroundBody() const {
 // Initialize all terrain patches
 // -----------------------------------------------------------------------------
 void RigidTerrain::Initialize() {
-    // Nothing to do here.
-    // Kept for consistency and possible future extensions.
+    BuildPatchGrid();
+}
+
+// -----------------------------------------------------------------------------
+// Build a uniform grid over the patch (x,y) bounding boxes, so that FindPoint
+// ray-tests only the patches whose bounds cover the query location instead of
+// scanning the whole patch list.
+// -----------------------------------------------------------------------------
+void RigidTerrain::BuildPatchGrid() {
+    m_patch_grid.clear();
+    m_patch_aabbs.clear();
+    m_grid_cell_size = 0;
+    m_grid_generation++;
+
+    if (m_patches.empty())
+        return;
+
+    // Cache the patch bounds and size the grid cells to the average patch
+    // extent, so that a patch overlaps O(1) cells.
+    double avg_extent = 0;
+    for (auto patch : m_patches) {
+        ChVector<> bbmin;
+        ChVector<> bbmax;
+        patch->m_body->GetCollisionModel()->GetAABB(bbmin, bbmax);
+        PatchAABB aabb;
+        aabb.xmin = bbmin.x();
+        aabb.xmax = bbmax.x();
+        aabb.ymin = bbmin.y();
+        aabb.ymax = bbmax.y();
+        m_patch_aabbs.push_back(aabb);
+        avg_extent += std::max(aabb.xmax - aabb.xmin, aabb.ymax - aabb.ymin);
+    }
+    m_grid_cell_size = std::max(avg_extent / m_patches.size(), 1e-3);
+
+    for (int i = 0; i < (int)m_patch_aabbs.size(); i++) {
+        const PatchAABB& aabb = m_patch_aabbs[i];
+        int ix_min = (int)std::floor(aabb.xmin / m_grid_cell_size);
+        int ix_max = (int)std::floor(aabb.xmax / m_grid_cell_size);
+        int iy_min = (int)std::floor(aabb.ymin / m_grid_cell_size);
+        int iy_max = (int)std::floor(aabb.ymax / m_grid_cell_size);
+        for (int ix = ix_min; ix <= ix_max; ix++) {
+            for (int iy = iy_min; iy <= iy_max; iy++) {
+                long long cell = ((long long)ix << 32) | (long long)(unsigned int)iy;
+                m_patch_grid[cell].push_back(i);
+            }
+        }
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -501,6 +548,49 @@ bool RigidTerrain::FindPoint(double x, double y, double& height, ChVector<>& nor
     ChVector<> from(x, y, 1000);
     ChVector<> to(x, y, -1000);
 
+    // Point-locate the query in the patch grid (built in Initialize). Terrain
+    // queries are strongly coherent, so as long as consecutive queries fall in
+    // the same grid cell the cached candidate list is reused without a hash
+    // lookup. The hint is thread-local (keyed on terrain instance and grid
+    // generation) since tire models may query the terrain concurrently.
+    if (m_grid_cell_size > 0 && m_patch_aabbs.size() == m_patches.size()) {
+        long long cell = ((long long)(int)std::floor(x / m_grid_cell_size) << 32) |
+                         (long long)(unsigned int)(int)std::floor(y / m_grid_cell_size);
+
+        static thread_local const RigidTerrain* last_terrain = nullptr;
+        static thread_local int last_generation = 0;
+        static thread_local long long last_cell = 0;
+        static thread_local const std::vector<int>* last_bucket = nullptr;
+
+        if (last_terrain != this || last_generation != m_grid_generation || last_cell != cell) {
+            auto it = m_patch_grid.find(cell);
+            last_terrain = this;
+            last_generation = m_grid_generation;
+            last_cell = cell;
+            last_bucket = (it != m_patch_grid.end()) ? &it->second : nullptr;
+        }
+        if (!last_bucket)
+            return false;
+
+        for (int i : *last_bucket) {
+            const PatchAABB& aabb = m_patch_aabbs[i];
+            if (x < aabb.xmin || x > aabb.xmax || y < aabb.ymin || y > aabb.ymax)
+                continue;
+            collision::ChCollisionSystem::ChRayhitResult result;
+            m_system->GetCollisionSystem()->RayHit(from, to, m_patches[i]->m_body->GetCollisionModel().get(), result);
+            if (result.hit && result.abs_hitPoint.z() > height) {
+                hit = true;
+                height = result.abs_hitPoint.z();
+                normal = result.abs_hitNormal;
+                friction = m_patches[i]->m_friction;
+            }
+        }
+
+        return hit;
+    }
+
+    // Fall back to scanning all patches (grid not built, or patches added
+    // after the last call to Initialize).
     for (auto patch : m_patches) {
         collision::ChCollisionSystem::ChRayhitResult result;
         m_system->GetCollisionSystem()->RayHit(from, to, patch->m_body->GetCollisionModel().get(), result);
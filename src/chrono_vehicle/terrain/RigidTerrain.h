@@ -20,6 +20,7 @@
 #define RIGID_TERRAIN_H
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "chrono/assets/ChColor.h"
@@ -179,6 +180,20 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     void LoadPatch(const rapidjson::Value& a);
 
     bool FindPoint(double x, double y, double& height, ChVector<>& normal, float& friction) const;
+
+    /// Build the uniform grid over the patch (x,y) bounding boxes used by FindPoint.
+    /// Called from Initialize(); until then queries fall back to scanning all patches.
+    void BuildPatchGrid();
+
+    /// Patch bounding box projected on the (x,y) plane.
+    struct PatchAABB {
+        double xmin, xmax, ymin, ymax;
+    };
+
+    std::vector<PatchAABB> m_patch_aabbs;                          ///< per-patch (x,y) bounds
+    std::unordered_map<long long, std::vector<int>> m_patch_grid;  ///< grid cell -> overlapping patches
+    double m_grid_cell_size;                                       ///< edge length of a grid cell
+    int m_grid_generation;                                         ///< bumped at each grid rebuild (invalidates hints)
 };
 
 /// @} vehicle_terrain
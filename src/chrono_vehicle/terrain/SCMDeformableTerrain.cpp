@@ -17,6 +17,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 #include <queue>
@@ -487,6 +488,7 @@ void SCMDeformableSoil::SetupAuxData() {
     for (int i=0; i< vertices.size(); ++i) {
         p_level[i] = plane.TransformParentToLocal(vertices[i]).y();
         p_level_initial[i] = p_level[i];
+        p_hit_level[i] = 1e9;
     }
 
     connected_vertexes.resize( vertices.size() );
@@ -499,7 +501,47 @@ void SCMDeformableSoil::SetupAuxData() {
         connected_vertexes[idx_vertices[iface][2]].insert(idx_vertices[iface][1]);
     }
 
+    connected_faces.clear();
+    connected_faces.resize(vertices.size());
+    for (unsigned int iface = 0; iface < idx_vertices.size(); ++iface) {
+        connected_faces[idx_vertices[iface][0]].push_back(iface);
+        connected_faces[idx_vertices[iface][1]].push_back(iface);
+        connected_faces[idx_vertices[iface][2]].push_back(iface);
+    }
+
     m_trimesh_shape->GetMesh()->ComputeNeighbouringTriangleMap(this->tri_map);
+
+    ComputeVertexAreas();
+
+    // All vertices start in the pristine reset state; the visual mesh must be
+    // rebuilt in full at the first step.
+    m_active_vertices.clear();
+    m_full_mesh_sync = true;
+}
+
+// Recompute the per-vertex (pseudo)areas from the current mesh topology.
+void SCMDeformableSoil::ComputeVertexAreas() {
+    std::vector<ChVector<int> >& idx_vertices = m_trimesh_shape->GetMesh()->getIndicesVertexes();
+    std::vector<ChVector<int> >& idx_normals = m_trimesh_shape->GetMesh()->getIndicesNormals();
+    std::vector<ChVector<> >& vertices = m_trimesh_shape->GetMesh()->getCoordsVertices();
+
+    // for a X-Z rectangular grid-like mesh it is simply area[i]= xsize/xsteps * zsize/zsteps,
+    // but the following is more general, also for generic meshes:
+    for (unsigned int iv = 0; iv < vertices.size(); ++iv) {
+        p_area[iv] = 0;
+    }
+    for (unsigned int it = 0; it < idx_vertices.size(); ++it) {
+        ChVector<> AB = vertices[idx_vertices[it][1]] - vertices[idx_vertices[it][0]];
+        ChVector<> AC = vertices[idx_vertices[it][2]] - vertices[idx_vertices[it][0]];
+        AB = plane.TransformDirectionParentToLocal(AB);
+        AC = plane.TransformDirectionParentToLocal(AC);
+        AB.y() = 0;
+        AC.y() = 0;
+        double triangle_area = 0.5 * (Vcross(AB, AC)).Length();
+        p_area[idx_normals[it][0]] += triangle_area / 3.0;
+        p_area[idx_normals[it][1]] += triangle_area / 3.0;
+        p_area[idx_normals[it][2]] += triangle_area / 3.0;
+    }
 }
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
@@ -533,23 +575,9 @@ void SCMDeformableSoil::ComputeInternalForces() {
     m_num_faces = idx_vertices.size();
     m_timer_calc_areas.start();
 
-    // for a X-Z rectangular grid-like mesh it is simply area[i]= xsize/xsteps * zsize/zsteps, 
-    // but the following is more general, also for generic meshes:
-    for (unsigned int iv = 0; iv < vertices.size(); ++iv) {
-        p_area[iv] = 0;
-    }
-    for (unsigned int it = 0; it < idx_vertices.size(); ++it) {
-        ChVector<> AB = vertices[idx_vertices[it][1]] - vertices[idx_vertices[it][0]];
-        ChVector<> AC = vertices[idx_vertices[it][2]] - vertices[idx_vertices[it][1]];
-        AB = plane.TransformDirectionParentToLocal(AB);
-        AC = plane.TransformDirectionParentToLocal(AC);
-        AB.y()=0;
-        AC.y()=0;
-        double triangle_area = 0.5*(Vcross(AB,AC)).Length();
-        p_area[idx_normals[it][0]] += triangle_area /3.0;
-        p_area[idx_normals[it][1]] += triangle_area /3.0;
-        p_area[idx_normals[it][2]] += triangle_area /3.0;
-    }
+    // The (pseudo)areas are measured as projected on the reference plane, so
+    // sinkage along the plane normal does not alter them: the values computed
+    // at initialization (and after each refinement) are reused as-is.
 
     m_timer_calc_areas.stop();
 
@@ -573,11 +601,39 @@ void SCMDeformableSoil::ComputeInternalForces() {
         patch_max.y() = center.y() + m_patch_dim.y() / 2;
     }
 
-    // Loop through all vertices.
-    // - set default SCM quantities (in case no ray-hit)
+    // Collect the AABBs of all collidable objects in the system, inflated by
+    // the ray extent. A vertex whose ray segment lies outside all of these
+    // boxes cannot produce a hit and need not be tested (active domain).
+    double test_margin = ChMax(test_high_offset, test_low_offset);
+    std::vector<ChVector<>> aabb_min;
+    std::vector<ChVector<>> aabb_max;
+    for (auto body : GetSystem()->Get_bodylist()) {
+        if (!body->GetCollide())
+            continue;
+        ChVector<> bmin;
+        ChVector<> bmax;
+        body->GetCollisionModel()->GetAABB(bmin, bmax);
+        aabb_min.push_back(bmin - ChVector<>(test_margin, test_margin, test_margin));
+        aabb_max.push_back(bmax + ChVector<>(test_margin, test_margin, test_margin));
+    }
+
+    // Reset the per-step SCM quantities. Only vertices in the active set of the
+    // previous step can hold non-pristine values (everything else was reset when
+    // it left the set), so the full-grid sweep is replaced by a sweep over that
+    // (typically small) set.
+    for (int i : m_active_vertices) {
+        p_sigma[i] = 0;
+        p_sinkage_elastic[i] = 0;
+        p_step_plastic_flow[i] = 0;
+        p_erosion[i] = false;
+        p_id_island[i] = 0;
+        p_hit_level[i] = 1e9;
+    }
+
+    // Loop through all vertices (read-only scan).
     // - skip vertices outside moving patch (if option enabled)
-    // - cast ray and record result in a map (key: vertex index)
-    // - initialize patch id to -1 (not set)
+    // - skip vertices outside the AABB of any collidable object
+    // - collect the remaining candidate vertices for ray casting
     struct HitRecord {
         ChContactable* contactable;  // pointer to hit object
         ChVector<> abs_point;        // hit point, expressed in global frame
@@ -585,15 +641,9 @@ void SCMDeformableSoil::ComputeInternalForces() {
     };
     std::unordered_map<int, HitRecord> hits;
 
-    for (int i = 0; i < vertices.size(); ++i) {
-        // Initialize SCM quantities at current vertex
-        p_sigma[i] = 0;
-        p_sinkage_elastic[i] = 0;
-        p_step_plastic_flow[i] = 0;
-        p_erosion[i] = false;
-        p_level[i] = plane.TransformParentToLocal(vertices[i]).y();
-        p_hit_level[i] = 1e9;
+    std::vector<int> candidate_vertices;
 
+    for (int i = 0; i < vertices.size(); ++i) {
         // Skip vertices outside moving patch
         if (m_moving_patch) {
             if (vertices[i].x() < patch_min.x() || vertices[i].x() > patch_max.x() || vertices[i].y() < patch_min.y() ||
@@ -602,17 +652,48 @@ void SCMDeformableSoil::ComputeInternalForces() {
             }
         }
 
-        // Perform ray casting from current vertex
+        // Skip vertices outside the inflated AABB of every collidable object
+        bool in_active_domain = false;
+        for (size_t ib = 0; ib < aabb_min.size() && !in_active_domain; ++ib) {
+            in_active_domain = vertices[i].x() >= aabb_min[ib].x() && vertices[i].x() <= aabb_max[ib].x() &&
+                               vertices[i].y() >= aabb_min[ib].y() && vertices[i].y() <= aabb_max[ib].y() &&
+                               vertices[i].z() >= aabb_min[ib].z() && vertices[i].z() <= aabb_max[ib].z();
+        }
+        if (!in_active_domain)
+            continue;
+
+        candidate_vertices.push_back(i);
+    }
+
+    // Vertices whose per-step state may be written during this call; this
+    // becomes the active set of the next step.
+    std::vector<int> active_vertices = candidate_vertices;
+
+    // Cast rays from all candidate vertices in a single batch.
+    // Ray-cast queries are read-only on the collision world, so they can be
+    // issued concurrently from multiple threads.
+    std::vector<HitRecord> hit_records(candidate_vertices.size());
+    std::vector<char> hit_flags(candidate_vertices.size(), 0);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < (int)candidate_vertices.size(); ++k) {
+        int i = candidate_vertices[k];
         collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
         ChVector<> to = vertices[i] + N * test_high_offset;
         ChVector<> from = to - N * test_low_offset;
         this->GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-        m_num_ray_casts++;
         if (mrayhit_result.hit) {
-            HitRecord record = { mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1 };
-            hits.insert(std::make_pair(i, record));
+            HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+            hit_records[k] = record;
+            hit_flags[k] = 1;
         }
     }
+    m_num_ray_casts += candidate_vertices.size();
+
+    for (size_t k = 0; k < candidate_vertices.size(); ++k) {
+        if (hit_flags[k])
+            hits.insert(std::make_pair(candidate_vertices[k], hit_records[k]));
+    }
 
     // Loop through all hit vertices and determine to which contact patch they belong.
     // We use here the connected_vertexes map (from a vertex to its adjacent vertices) which is
@@ -850,6 +931,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
         MyRefinement refinement_criterion;
         refinement_criterion.A = ChMatrix33<>(this->plane.rot);
 
+        size_t n_vertices_before = vertices.size();
+
         // perform refinement using the LEPP  algorithm, also refining the soil-specific vertex attributes
         for (int i = 0; i < 1; ++i) {
             m_trimesh_shape->GetMesh()->RefineMeshEdges(
@@ -875,22 +958,23 @@ void SCMDeformableSoil::ComputeInternalForces() {
             connected_vertexes[idx_vertices[iface][2]].insert(idx_vertices[iface][1]);
         }
 
-        // Recompute areas (could be optimized)
-        for (unsigned int iv = 0; iv < vertices.size(); ++iv) {
-            p_area[iv] = 0;
-        }
-        for (unsigned int it = 0; it < idx_vertices.size(); ++it) {
-            ChVector<> AB = vertices[idx_vertices[it][1]] - vertices[idx_vertices[it][0]];
-            ChVector<> AC = vertices[idx_vertices[it][2]] - vertices[idx_vertices[it][0]];
-            AB = plane.TransformDirectionParentToLocal(AB);
-            AC = plane.TransformDirectionParentToLocal(AC);
-            AB.y() = 0;
-            AC.y() = 0;
-            double triangle_area = 0.5 * (Vcross(AB, AC)).Length();
-            p_area[idx_normals[it][0]] += triangle_area / 3.0;
-            p_area[idx_normals[it][1]] += triangle_area / 3.0;
-            p_area[idx_normals[it][2]] += triangle_area / 3.0;
+        connected_faces.clear();
+        connected_faces.resize(vertices.size());
+        for (unsigned int iface = 0; iface < idx_vertices.size(); ++iface) {
+            connected_faces[idx_vertices[iface][0]].push_back(iface);
+            connected_faces[idx_vertices[iface][1]].push_back(iface);
+            connected_faces[idx_vertices[iface][2]].push_back(iface);
         }
+
+        // Recompute areas for the new topology
+        ComputeVertexAreas();
+
+        // Newly inserted vertices interpolate the per-step attributes of their
+        // parents, so schedule them for reset; the changed topology also
+        // requires a full visual mesh refresh.
+        for (size_t iv = n_vertices_before; iv < vertices.size(); ++iv)
+            active_vertices.push_back((int)iv);
+        m_full_mesh_sync = true;
     }
 
     m_timer_refinement.stop();
@@ -902,9 +986,11 @@ void SCMDeformableSoil::ComputeInternalForces() {
     m_timer_bulldozing.start();
 
     if (do_bulldozing) {
+        // Only candidate vertices can carry a positive pressure, and the island
+        // ids are known to be zero everywhere (they are cleared with the rest of
+        // the per-step state when a vertex leaves the active set).
         std::set<int> touched_vertexes;
-        for (int iv = 0; iv< vertices.size(); ++iv) {
-            p_id_island[iv] = 0;
+        for (int iv : candidate_vertices) {
             if (p_sigma[iv]>0)
                 touched_vertexes.insert(iv);
         }
@@ -1108,20 +1194,38 @@ void SCMDeformableSoil::ComputeInternalForces() {
             }
         }
 
-    } // end bulldozing flow 
+        // The erosion domain received island/boundary ids and erosion markers:
+        // schedule it for reset at the next step. The smoothing pass also moved
+        // some direct neighbors of the domain, but it only altered persistent
+        // state (levels, mass remainder), which needs no reset.
+        active_vertices.insert(active_vertices.end(), domain_erosion.begin(), domain_erosion.end());
+
+    } // end bulldozing flow
 
     m_timer_bulldozing.stop();
 
 
     m_timer_visualization.start();
 
+    // Sync the visual mesh lazily: unless a full refresh is required (first
+    // step, topology change), only the vertices whose plotted state or position
+    // could have changed since the previous sync - the union of the previous
+    // and current active sets - are updated.
+    std::vector<int> refresh_vertices = m_active_vertices;
+    refresh_vertices.insert(refresh_vertices.end(), active_vertices.begin(), active_vertices.end());
+    std::sort(refresh_vertices.begin(), refresh_vertices.end());
+    refresh_vertices.erase(std::unique(refresh_vertices.begin(), refresh_vertices.end()), refresh_vertices.end());
+
     //
     // Update the visualization colors
-    // 
+    //
 
     if (plot_type != SCMDeformableTerrain::PLOT_NONE) {
-        colors.resize(vertices.size());
-        for (size_t iv = 0; iv< vertices.size(); ++iv) {
+        if (colors.size() != vertices.size()) {
+            colors.resize(vertices.size());
+            m_full_mesh_sync = true;
+        }
+        auto update_color = [&](size_t iv) {
             ChColor mcolor;
             switch (plot_type) {
                 case SCMDeformableTerrain::PLOT_LEVEL:
@@ -1174,6 +1278,13 @@ void SCMDeformableSoil::ComputeInternalForces() {
                     break;
             }
             colors[iv] = {mcolor.R, mcolor.G, mcolor.B};
+        };
+        if (m_full_mesh_sync) {
+            for (size_t iv = 0; iv < vertices.size(); ++iv)
+                update_color(iv);
+        } else {
+            for (int iv : refresh_vertices)
+                update_color(iv);
         }
     } else {
         colors.clear();
@@ -1181,31 +1292,65 @@ void SCMDeformableSoil::ComputeInternalForces() {
 
     //
     // Update the visualization normals
-    // 
+    //
 
-    std::vector<int> accumulators(vertices.size(), 0);
+    if (m_full_mesh_sync) {
+        std::vector<int> accumulators(vertices.size(), 0);
 
-    // Calculate normals and then average the normals from all adjacent faces.
-    for (unsigned int it = 0; it < idx_vertices.size(); ++it) {
-        // Calculate the triangle normal as a normalized cross product.
-        ChVector<> nrm = -Vcross(vertices[idx_vertices[it][1]] - vertices[idx_vertices[it][0]],
-                                vertices[idx_vertices[it][2]] - vertices[idx_vertices[it][0]]);
-        nrm.Normalize();
-        // Increment the normals of all incident vertices by the face normal
-        normals[idx_normals[it][0]] += nrm;
-        normals[idx_normals[it][1]] += nrm;
-        normals[idx_normals[it][2]] += nrm;
-        // Increment the count of all incident vertices by 1
-        accumulators[idx_normals[it][0]] += 1;
-        accumulators[idx_normals[it][1]] += 1;
-        accumulators[idx_normals[it][2]] += 1;
-    }
+        // Calculate normals and then average the normals from all adjacent faces.
+        for (unsigned int it = 0; it < idx_vertices.size(); ++it) {
+            // Calculate the triangle normal as a normalized cross product.
+            ChVector<> nrm = -Vcross(vertices[idx_vertices[it][1]] - vertices[idx_vertices[it][0]],
+                                     vertices[idx_vertices[it][2]] - vertices[idx_vertices[it][0]]);
+            nrm.Normalize();
+            // Increment the normals of all incident vertices by the face normal
+            normals[idx_normals[it][0]] += nrm;
+            normals[idx_normals[it][1]] += nrm;
+            normals[idx_normals[it][2]] += nrm;
+            // Increment the count of all incident vertices by 1
+            accumulators[idx_normals[it][0]] += 1;
+            accumulators[idx_normals[it][1]] += 1;
+            accumulators[idx_normals[it][2]] += 1;
+        }
 
-    // Set the normals to the average values.
-    for (unsigned int in = 0; in < vertices.size(); ++in) {
-        normals[in] /= (double)accumulators[in];
+        // Set the normals to the average values.
+        for (unsigned int in = 0; in < vertices.size(); ++in) {
+            normals[in] /= (double)accumulators[in];
+        }
+    } else {
+        // Incremental update. A vertex normal depends on the one-ring of
+        // positions around it, and the bulldozing smoothing pass can move
+        // direct neighbors of the refresh set, so expand the set by two rings
+        // before recomputing the affected vertex normals from their incident
+        // faces.
+        std::set<int> verts_norm(refresh_vertices.begin(), refresh_vertices.end());
+        for (int ring = 0; ring < 2; ++ring) {
+            std::set<int> grown = verts_norm;
+            for (int v : verts_norm)
+                grown.insert(connected_vertexes[v].begin(), connected_vertexes[v].end());
+            verts_norm.swap(grown);
+        }
+        for (int v : verts_norm) {
+            if (connected_faces[v].empty())
+                continue;
+            ChVector<> nsum(0, 0, 0);
+            for (int f : connected_faces[v]) {
+                ChVector<> nrm = -Vcross(vertices[idx_vertices[f][1]] - vertices[idx_vertices[f][0]],
+                                         vertices[idx_vertices[f][2]] - vertices[idx_vertices[f][0]]);
+                nrm.Normalize();
+                nsum += nrm;
+            }
+            normals[v] = nsum / (double)connected_faces[v].size();
+        }
     }
 
+    m_full_mesh_sync = false;
+
+    // Store the active set for the next step.
+    std::sort(active_vertices.begin(), active_vertices.end());
+    active_vertices.erase(std::unique(active_vertices.begin(), active_vertices.end()), active_vertices.end());
+    m_active_vertices.swap(active_vertices);
+
     m_timer_visualization.stop();
 
     // 
@@ -1213,7 +1358,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     //
     
     // Use the SCM soil contact model as described in the paper:
-    // "Parameter Identification of a Planetary Rover Wheel�Soil
+    // "Parameter Identification of a Planetary Rover Wheel�Soil
     // Contact Model via a Bayesian Approach", A.Gallina, R. Krenn et al.
 
     // 
@@ -116,7 +116,7 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
 
     /// Set the properties of the SCM soil model.
     /// The meaning of these parameters is described in the paper:
-    // "Parameter Identification of a Planetary Rover Wheel�Soil
+    // "Parameter Identification of a Planetary Rover Wheel�Soil
     // Contact Model via a Bayesian Approach", A.Gallina, R. Krenn et al.
     void SetSoilParametersSCM(
         double mBekker_Kphi,    ///< Kphi, frictional modulus in Bekker model
@@ -283,6 +283,12 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
     // data structures for the mesh, aux. material data, etc.
     void SetupAuxData();
 
+    // Recompute the per-vertex (pseudo)areas from the current mesh topology.
+    // Areas are measured as projected on the reference plane, so they change only
+    // when the connectivity changes (initialization, refinement), not when
+    // vertices sink along the plane normal.
+    void ComputeVertexAreas();
+
     std::shared_ptr<ChColorAsset> m_color;
     std::shared_ptr<ChTriangleMeshShape> m_trimesh_shape;
     double m_height;
@@ -322,8 +328,16 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
 
     // aux. topology data
     std::vector<std::set<int>> connected_vertexes;
+    std::vector<std::vector<int>> connected_faces;  // vertex -> incident faces
     std::vector<std::array<int, 4>> tri_map;
 
+    // Active set: vertices whose per-step state (pressure, hit level, island and
+    // erosion flags, ...) was written during the last ComputeInternalForces() call.
+    // Every other vertex is known to hold the pristine reset values, so each step
+    // only this (typically small) set needs resetting and visual mesh syncing.
+    std::vector<int> m_active_vertices;
+    bool m_full_mesh_sync;  // force a full refresh of the visual colors/normals
+
     bool do_bulldozing;
     double bulldozing_flow_factor;
     double bulldozing_erosion_angle;
@@ -0,0 +1,81 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Broad-phase culling of track-internal collision candidates.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono_vehicle/tracked_vehicle/ChTrackCollisionManager.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChTrackCollisionManager::ChTrackCollisionManager() : m_band(0) {}
+
+void ChTrackCollisionManager::AddWheel(std::shared_ptr<ChBody> wheel, double radius) {
+    m_wheels[wheel->GetCollisionModel().get()] = std::make_pair(wheel.get(), radius);
+}
+
+void ChTrackCollisionManager::AddTrackAssembly(std::shared_ptr<ChTrackAssembly> track) {
+    AddWheel(track->GetSprocket()->GetGearBody(), track->GetSprocket()->GetAssemblyRadius());
+    AddWheel(track->GetIdler()->GetWheelBody(), track->GetIdler()->GetWheelRadius());
+    for (size_t i = 0; i < track->GetNumRoadWheelAssemblies(); i++) {
+        AddWheel(track->GetRoadWheel(i)->GetWheelBody(), track->GetRoadWheel(i)->GetWheelRadius());
+    }
+    for (size_t i = 0; i < track->GetNumRollers(); i++) {
+        AddWheel(track->GetRoller(i)->GetBody(), track->GetRoller(i)->GetRadius());
+    }
+
+    for (size_t i = 0; i < track->GetNumTrackShoes(); i++) {
+        auto shoe = track->GetTrackShoe(i);
+        m_shoes[shoe->GetShoeBody()->GetCollisionModel().get()] = shoe->GetShoeBody().get();
+        // A shoe within one pitch of the wheel periphery may be in contact.
+        m_band = std::max(m_band, shoe->GetPitch());
+    }
+}
+
+bool ChTrackCollisionManager::OnBroadphase(collision::ChCollisionModel* modelA, collision::ChCollisionModel* modelB) {
+    // Identify shoe-wheel pairs (in either order); let all other pairs through.
+    ChBody* shoe;
+    const std::pair<ChBody*, double>* wheel;
+
+    auto wheelB = m_wheels.find(modelB);
+    auto shoeA = m_shoes.find(modelA);
+    if (wheelB != m_wheels.end() && shoeA != m_shoes.end()) {
+        shoe = shoeA->second;
+        wheel = &wheelB->second;
+    } else {
+        auto wheelA = m_wheels.find(modelA);
+        auto shoeB = m_shoes.find(modelB);
+        if (wheelA != m_wheels.end() && shoeB != m_shoes.end()) {
+            shoe = shoeB->second;
+            wheel = &wheelA->second;
+        } else {
+            return true;
+        }
+    }
+
+    // Distance of the shoe center from the wheel spin axis (the wheel y axis).
+    // A contact is only possible while the shoe sits in the annular band around
+    // the wheel periphery; this tracks the shoe automatically as the track
+    // rotates, with no per-step bookkeeping.
+    ChVector<> d = shoe->GetPos() - wheel->first->GetPos();
+    ChVector<> axis = wheel->first->GetRot().GetYaxis();
+    ChVector<> radial = d - Vdot(d, axis) * axis;
+
+    return std::abs(radial.Length() - wheel->second) <= m_band;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,79 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Broad-phase culling of track-internal collision candidates.
+//
+// The contact topology of a track assembly is nearly circular and predictable:
+// a shoe can only touch a sprocket, idler, road wheel, or roller while it sits
+// in the annular band swept by that wheel's periphery. This callback rejects
+// shoe-wheel candidate pairs reported by the broad-phase whose shoe lies
+// outside that band, before any narrow-phase work is done for them.
+//
+// =============================================================================
+
+#ifndef CH_TRACK_COLLISION_MANAGER_H
+#define CH_TRACK_COLLISION_MANAGER_H
+
+#include <memory>
+#include <unordered_map>
+
+#include "chrono/collision/ChCCollisionSystem.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_tracked
+/// @{
+
+/// Broad-phase culling of track-internal collision candidates.
+/// When registered with the collision system, this callback suppresses
+/// narrow-phase processing for shoe-wheel pairs in which the shoe is outside
+/// the annular band around the wheel periphery where contact is possible.
+/// All pairs not involving a registered shoe and wheel are left untouched.
+class CH_VEHICLE_API ChTrackCollisionManager : public collision::ChCollisionSystem::BroadphaseCallback {
+  public:
+    ChTrackCollisionManager();
+
+    /// Register the wheels (sprocket, idler, road wheels, rollers) and shoes of
+    /// the specified track assembly. Must be called after the track assembly
+    /// was initialized. The culling band is enlarged, if needed, to cover the
+    /// pitch of this assembly's track shoes.
+    void AddTrackAssembly(std::shared_ptr<ChTrackAssembly> track);
+
+    /// Set the half-width of the annular band around a wheel periphery within
+    /// which shoe-wheel pairs are passed to the narrow-phase. By default, the
+    /// largest shoe pitch among the registered track assemblies is used.
+    void SetBand(double val) { m_band = val; }
+
+    /// Reject shoe-wheel pairs in which the shoe center is outside the culling
+    /// band of the wheel. Return true (process pair) in all other cases.
+    virtual bool OnBroadphase(collision::ChCollisionModel* modelA, collision::ChCollisionModel* modelB) override;
+
+  private:
+    /// Register a wheel-like body with the radius of its periphery.
+    void AddWheel(std::shared_ptr<ChBody> wheel, double radius);
+
+    std::unordered_map<collision::ChCollisionModel*, std::pair<ChBody*, double>> m_wheels;  ///< wheel bodies and radii
+    std::unordered_map<collision::ChCollisionModel*, ChBody*> m_shoes;                      ///< track shoe bodies
+
+    double m_band;  ///< half-width of the annular culling band
+};
+
+/// @} vehicle_tracked
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
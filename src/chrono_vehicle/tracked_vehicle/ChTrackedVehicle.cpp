@@ -32,15 +32,16 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 ChTrackedVehicle::ChTrackedVehicle(const std::string& name, ChMaterialSurface::ContactMethod contact_method)
-    : ChVehicle(name, contact_method), m_contacts(new ChTrackContactManager) {
+    : ChVehicle(name, contact_method), m_contacts(new ChTrackContactManager), m_collision_manager(nullptr) {
 }
 
 ChTrackedVehicle::ChTrackedVehicle(const std::string& name, ChSystem* system)
-    : ChVehicle(name, system), m_contacts(new ChTrackContactManager) {
+    : ChVehicle(name, system), m_contacts(new ChTrackContactManager), m_collision_manager(nullptr) {
 }
 
 ChTrackedVehicle::~ChTrackedVehicle() {
     delete m_contacts;
+    delete m_collision_manager;
 }
 
 // -----------------------------------------------------------------------------
@@ -59,6 +60,18 @@ void ChTrackedVehicle::Initialize(const ChCoordsys<>& chassisPos, double chassis
     m_chassis->GetBody()->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(TrackedCollisionFamily::ROLLERS);
 }
 
+// -----------------------------------------------------------------------------
+// Enable/disable broad-phase culling of track-internal collision candidates.
+// -----------------------------------------------------------------------------
+void ChTrackedVehicle::SetTrackCollisionCulling(bool state) {
+    if (state && !m_collision_manager) {
+        m_collision_manager = new ChTrackCollisionManager;
+        m_collision_manager->AddTrackAssembly(m_tracks[LEFT]);
+        m_collision_manager->AddTrackAssembly(m_tracks[RIGHT]);
+    }
+    m_system->GetCollisionSystem()->RegisterBroadphaseCallback(state ? m_collision_manager : nullptr);
+}
+
 // -----------------------------------------------------------------------------
 // Update the state of this vehicle at the current time.
 // The vehicle system is provided the current driver inputs (throttle between
@@ -27,6 +27,7 @@
 #include "chrono_vehicle/ChVehicle.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackDriveline.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackCollisionManager.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackContactManager.h"
 
 namespace chrono {
@@ -150,6 +151,13 @@ class CH_VEHICLE_API ChTrackedVehicle : public ChVehicle {
     /// always ignored.
     virtual void SetChassisVehicleCollide(bool state) override;
 
+    /// Enable/disable broad-phase culling of track-internal collision candidates.
+    /// When enabled, shoe-wheel candidate pairs whose shoe is outside the annular band around the
+    /// wheel periphery (sprocket, idler, road wheels, rollers) are rejected before narrow-phase
+    /// processing. This function must be called after Initialize(). Note that the culling callback
+    /// is only invoked by the Bullet-based collision system.
+    void SetTrackCollisionCulling(bool state);
+
     /// Set contacts to be monitored.
     /// Contact information will be tracked for the specified subsystems.
     void MonitorContacts(int flags) { m_contacts->MonitorContacts(flags); }
@@ -211,7 +219,8 @@ class CH_VEHICLE_API ChTrackedVehicle : public ChVehicle {
     std::shared_ptr<ChTrackAssembly> m_tracks[2];   ///< handles to the track assemblies (left/right)
     std::shared_ptr<ChTrackDriveline> m_driveline;  ///< handle to the driveline subsystem
 
-    ChTrackContactManager* m_contacts;  ///< manager for internal contacts
+    ChTrackContactManager* m_contacts;              ///< manager for internal contacts
+    ChTrackCollisionManager* m_collision_manager;   ///< broad-phase culling of track-internal candidates
 
     friend class ChTrackedVehicleIrrApp;
 };
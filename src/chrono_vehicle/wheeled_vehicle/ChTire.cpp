@@ -209,5 +209,26 @@ ChVector<> ChTire::EstimateInertia(double tire_width,    // tire width [mm]
     return ChVector<>(Itip_tread + 2 * Itip_sidewall, Irot_tread + 2 * Irot_sidewall, Itip_tread + 2 * Itip_sidewall);
 }
 
+// -----------------------------------------------------------------------------
+// Parallel evaluation of a set of independent tire subsystems.
+// -----------------------------------------------------------------------------
+void SynchronizeTires(double time,
+                      int num_tires,
+                      ChTire* const* tires,
+                      const WheelState* wheel_states,
+                      const ChTerrain& terrain) {
+#pragma omp parallel for
+    for (int i = 0; i < num_tires; i++) {
+        tires[i]->Synchronize(time, wheel_states[i], terrain);
+    }
+}
+
+void AdvanceTires(double step, int num_tires, ChTire* const* tires) {
+#pragma omp parallel for
+    for (int i = 0; i < num_tires; i++) {
+        tires[i]->Advance(step);
+    }
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
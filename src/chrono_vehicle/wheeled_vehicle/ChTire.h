@@ -176,6 +176,23 @@ class CH_VEHICLE_API ChTire : public ChPart {
 /// Vector of handles to tire subsystems.
 typedef std::vector<std::shared_ptr<ChTire>> ChTireList;
 
+/// Synchronize a set of tire subsystems in parallel, one OpenMP task per tire.
+/// Tire models are independent per wheel (each one only updates its own state
+/// from the state of its associated wheel body), so on a multi-axle vehicle
+/// their evaluation can proceed concurrently.
+CH_VEHICLE_API void SynchronizeTires(double time,                     ///< [in] current time
+                                     int num_tires,                   ///< [in] number of tires
+                                     ChTire* const* tires,            ///< [in] array of tire subsystems
+                                     const WheelState* wheel_states,  ///< [in] current associated wheel states
+                                     const ChTerrain& terrain         ///< [in] reference to the terrain system
+);
+
+/// Advance the states of a set of tire subsystems in parallel, one OpenMP task per tire.
+CH_VEHICLE_API void AdvanceTires(double step,          ///< [in] time step
+                                 int num_tires,        ///< [in] number of tires
+                                 ChTire* const* tires  ///< [in] array of tire subsystems
+);
+
 /// @} vehicle_wheeled_tire
 
 }  // end namespace vehicle
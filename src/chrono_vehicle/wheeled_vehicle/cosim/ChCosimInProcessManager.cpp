@@ -0,0 +1,242 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Manager for an in-process tire - terrain cosimulation.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+
+#include "chrono/fea/ChContactSurfaceMesh.h"
+
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimInProcessManager.h"
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChCosimInProcessManager::ChCosimInProcessManager(int num_tires)
+    : m_num_tires(num_tires),
+      m_verbose(false),
+      m_initialized(false),
+      m_terrain_system(NULL),
+      m_terrain(NULL),
+      m_terrain_stepsize(0),
+      m_generation(0),
+      m_pending(0),
+      m_step(0),
+      m_shutdown(false) {}
+
+ChCosimInProcessManager::~ChCosimInProcessManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_cv_start.notify_all();
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        if (m_workers[i].joinable())
+            m_workers[i].join();
+    }
+}
+
+bool ChCosimInProcessManager::Initialize() {
+    m_terrain_system = GetChronoSystemTerrain();
+    m_terrain = GetTerrain();
+    m_terrain_stepsize = GetTerrainStepsize();
+
+    m_tires.resize(m_num_tires);
+    for (int it = 0; it < m_num_tires; it++) {
+        WheelID id(it);
+        TireUnit& unit = m_tires[it];
+        unit.system = GetChronoSystemTire(id);
+        unit.tire = GetTire(id);
+        unit.stepsize = GetTireStepsize(id);
+
+        // Ghost wheel body, driven kinematically through GetWheelState. Added
+        // to the system as fixed (so it is not integrated, but rim connections
+        // created by the tire have a valid system to be added to).
+        unit.wheel = std::shared_ptr<ChBody>(unit.system->NewBody());
+        unit.wheel->SetMass(GetWheelMass(id));
+        unit.wheel->SetInertiaXX(GetWheelInertia(id));
+        unit.wheel->SetBodyFixed(true);
+        unit.system->AddBody(unit.wheel);
+
+        // Place the wheel at the initial rig-imposed state, so the tire mesh
+        // is built in the correct pose.
+        WheelState ws = GetWheelState(id, 0);
+        unit.wheel->SetPos(ws.pos);
+        unit.wheel->SetRot(ws.rot);
+        unit.wheel->SetPos_dt(ws.lin_vel);
+        unit.wheel->SetWvel_par(ws.ang_vel);
+
+        // Dummy terrain (needed for tire synchronization)
+        unit.terrain = std::make_shared<FlatTerrain>(0);
+
+        // Ensure that tire contact is enabled and enforce TRIANGLE_MESH contact surface type
+        unit.tire->EnableContact(true);
+        unit.tire->SetContactSurfaceType(ChDeformableTire::TRIANGLE_MESH);
+
+        // Initialize the underlying tire
+        unit.tire->Initialize(unit.wheel, id.side());
+
+        // Create a mesh load for contact forces and add it to the tire's load container.
+        auto contact_surface = std::static_pointer_cast<fea::ChContactSurfaceMesh>(unit.tire->GetContactSurface());
+        unit.contact_load = std::make_shared<fea::ChLoadContactSurfaceMesh>(contact_surface);
+        unit.tire->GetLoadContainer()->Add(unit.contact_load);
+
+        // Size the shared buffers and pass the contact specification to the terrain side
+        unsigned int num_vert = contact_surface->GetNumVertices();
+        unsigned int num_tri = contact_surface->GetNumTriangles();
+        unit.buffers.Resize(num_vert, num_tri);
+        OnTireInfo(it, num_vert, num_tri);
+        if (m_verbose) {
+            printf("In-process cosim. Tire %d: %d vertices  %d triangles\n", it, num_vert, num_tri);
+        }
+    }
+
+    // Spawn the persistent worker threads: one per tire system, one for the
+    // terrain system. They idle until DoMacroStep releases them.
+    for (int iw = 0; iw <= m_num_tires; iw++) {
+        m_workers.emplace_back(&ChCosimInProcessManager::WorkerLoop, this, iw);
+    }
+
+    m_initialized = true;
+    return true;
+}
+
+void ChCosimInProcessManager::Exchange(double time) {
+    for (int it = 0; it < m_num_tires; it++) {
+        WheelID id(it);
+        TireUnit& unit = m_tires[it];
+        ChCosimSharedBuffers& buffers = unit.buffers;
+
+        // Extract tire mesh vertex locations and velocities and publish them
+        // in the shared SoA buffers (the only gather; no packing, no send).
+        unit.contact_load->OutputSimpleMesh(unit.vert_pos, unit.vert_vel, unit.triangles);
+        unsigned int num_vert = buffers.num_vertices;
+        unsigned int num_tri = buffers.num_triangles;
+        for (unsigned int iv = 0; iv < num_vert; iv++) {
+            buffers.vert_pos_x[iv] = unit.vert_pos[iv].x();
+            buffers.vert_pos_y[iv] = unit.vert_pos[iv].y();
+            buffers.vert_pos_z[iv] = unit.vert_pos[iv].z();
+            buffers.vert_vel_x[iv] = unit.vert_vel[iv].x();
+            buffers.vert_vel_y[iv] = unit.vert_vel[iv].y();
+            buffers.vert_vel_z[iv] = unit.vert_vel[iv].z();
+        }
+        for (unsigned int itr = 0; itr < num_tri; itr++) {
+            buffers.tri_v1[itr] = unit.triangles[itr].x();
+            buffers.tri_v2[itr] = unit.triangles[itr].y();
+            buffers.tri_v3[itr] = unit.triangles[itr].z();
+        }
+
+        // Let the terrain side consume the mesh state and accumulate contact
+        // forces, in place.
+        buffers.ClearForces();
+        OnTireContact(it, buffers);
+
+        // Apply the accumulated forces to the mesh vertices (touched ones only)
+        unit.vert_forces.clear();
+        unit.vert_indices.clear();
+        for (size_t i = 0; i < buffers.touched.size(); i++) {
+            int iv = buffers.touched[i];
+            unit.vert_forces.push_back(ChVector<>(buffers.force_x[iv], buffers.force_y[iv], buffers.force_z[iv]));
+            unit.vert_indices.push_back(iv);
+        }
+        unit.contact_load->InputSimpleForces(unit.vert_forces, unit.vert_indices);
+
+        // Synchronize the ghost wheel and the tire with the rig-imposed state
+        WheelState wheel_state = GetWheelState(id, time);
+        unit.wheel->SetPos(wheel_state.pos);
+        unit.wheel->SetRot(wheel_state.rot);
+        unit.wheel->SetPos_dt(wheel_state.lin_vel);
+        unit.wheel->SetWvel_par(wheel_state.ang_vel);
+
+        unit.tire->Synchronize(time, wheel_state, *unit.terrain);
+
+        if (m_verbose) {
+            printf("In-process cosim. Tire %d: %d loaded vertices\n", it, (int)unit.vert_indices.size());
+        }
+    }
+
+    m_terrain->Synchronize(time);
+}
+
+void ChCosimInProcessManager::AdvanceTire(int which, double step) {
+    TireUnit& unit = m_tires[which];
+    double t = 0;
+    while (t < step) {
+        double h = std::min<>(unit.stepsize, step - t);
+        unit.system->DoStepDynamics(h);
+        t += h;
+    }
+    unit.tire->Advance(step);
+    OnAdvanceTire(WheelID(which));
+}
+
+void ChCosimInProcessManager::AdvanceTerrain(double step) {
+    double t = 0;
+    while (t < step) {
+        double h = std::min<>(m_terrain_stepsize, step - t);
+        m_terrain_system->DoStepDynamics(h);
+        t += h;
+    }
+    m_terrain->Advance(step);
+    OnAdvanceTerrain();
+}
+
+void ChCosimInProcessManager::WorkerLoop(int worker) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv_start.wait(lock, [&] { return m_shutdown || m_generation != seen; });
+        if (m_shutdown)
+            return;
+        seen = m_generation;
+        double step = m_step;
+        lock.unlock();
+
+        if (worker < m_num_tires)
+            AdvanceTire(worker, step);
+        else
+            AdvanceTerrain(step);
+
+        lock.lock();
+        if (--m_pending == 0)
+            m_cv_done.notify_one();
+    }
+}
+
+void ChCosimInProcessManager::DoMacroStep(double time, double step) {
+    assert(m_initialized);
+
+    // Exchange phase: the worker threads are idle, so tire and terrain read
+    // and write the shared buffers without any locking.
+    Exchange(time);
+
+    // Advance phase: release all workers and wait for them at the macro-step
+    // boundary.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_step = step;
+        m_pending = (int)m_workers.size();
+        m_generation++;
+    }
+    m_cv_start.notify_all();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_done.wait(lock, [&] { return m_pending == 0; });
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,136 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Manager for an in-process tire - terrain cosimulation.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_IN_PROCESS_MANAGER_H
+#define CH_COSIM_IN_PROCESS_MANAGER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/fea/ChLoadContactSurfaceMesh.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChSubsysDefs.h"
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimSharedBuffers.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChDeformableTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// Manager for a tire - terrain cosimulation where all systems live in one
+/// process. The fast counterpart of the MPI-based ChCosimManager for the tire
+/// development loop: instead of packing mesh states and forces into messages,
+/// tire and terrain exchange through shared SoA buffers (ChCosimSharedBuffers)
+/// and the wheel is driven kinematically by the rig through GetWheelState().
+/// Each tire system and the terrain system are stepped by their own persistent
+/// worker threads, running concurrently within a macro-step and synchronizing
+/// at its boundaries, where the (zero-copy) data exchange takes place.
+class CH_VEHICLE_API ChCosimInProcessManager {
+  public:
+    ChCosimInProcessManager(int num_tires);
+    virtual ~ChCosimInProcessManager();
+
+    // Functions invoked on the TIRE side (the rig)
+
+    virtual ChSystem* GetChronoSystemTire(WheelID which) = 0;
+    virtual ChDeformableTire* GetTire(WheelID which) = 0;
+    virtual double GetTireStepsize(WheelID which) = 0;
+    virtual double GetWheelMass(WheelID which) = 0;
+    virtual const ChVector<>& GetWheelInertia(WheelID which) = 0;
+    /// Get the current rig-imposed state of the given wheel (what the vehicle
+    /// node would have sent in the distributed cosimulation).
+    virtual WheelState GetWheelState(WheelID which, double time) = 0;
+    /// Invoked from the tire worker thread, after each macro-step.
+    virtual void OnAdvanceTire(WheelID which) {}
+
+    // Functions invoked on the TERRAIN side
+
+    virtual ChSystem* GetChronoSystemTerrain() = 0;
+    virtual ChTerrain* GetTerrain() = 0;
+    virtual double GetTerrainStepsize() = 0;
+    virtual void OnTireInfo(int which, unsigned int num_vert, unsigned int num_tri) {}
+    /// Consume the tire mesh state and accumulate the contact forces, both
+    /// directly in the shared buffers (use ChCosimSharedBuffers::AccumulateForce).
+    /// Invoked once per tire per macro-step, with the worker threads idle.
+    virtual void OnTireContact(int which, ChCosimSharedBuffers& buffers) = 0;
+    /// Invoked from the terrain worker thread, after each macro-step.
+    virtual void OnAdvanceTerrain() {}
+
+    void SetVerbose(bool val) { m_verbose = val; }
+
+    /// Initialize the tires, the shared buffers, and the worker threads.
+    bool Initialize();
+
+    /// Advance the whole cosimulation by one macro-step: exchange mesh states
+    /// and forces through the shared buffers, synchronize tires and terrain at
+    /// the given time, then step all systems concurrently by 'step'.
+    void DoMacroStep(double time, double step);
+
+    /// Access the shared buffers of the given tire (valid between macro-steps).
+    const ChCosimSharedBuffers& GetSharedBuffers(int which) const { return m_tires[which].buffers; }
+
+  private:
+    /// In-process counterpart of a tire node.
+    struct TireUnit {
+        ChSystem* system;
+        ChDeformableTire* tire;
+        double stepsize;
+        std::shared_ptr<ChBody> wheel;       ///< ghost wheel body, driven kinematically
+        std::shared_ptr<ChTerrain> terrain;  ///< dummy terrain for tire synchronization
+        std::shared_ptr<fea::ChLoadContactSurfaceMesh> contact_load;
+        ChCosimSharedBuffers buffers;
+        // persistent scratch of the mesh gather / force scatter (no per-step allocation)
+        std::vector<ChVector<>> vert_pos;
+        std::vector<ChVector<>> vert_vel;
+        std::vector<ChVector<int>> triangles;
+        std::vector<ChVector<>> vert_forces;
+        std::vector<int> vert_indices;
+    };
+
+    void Exchange(double time);
+    void AdvanceTire(int which, double step);
+    void AdvanceTerrain(double step);
+    void WorkerLoop(int worker);  ///< worker < num_tires: tire; worker == num_tires: terrain
+
+    int m_num_tires;
+    bool m_verbose;
+    bool m_initialized;
+
+    std::vector<TireUnit> m_tires;
+    ChSystem* m_terrain_system;
+    ChTerrain* m_terrain;
+    double m_terrain_stepsize;
+
+    // per-macro-step synchronization of the worker threads
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_cv_start;
+    std::condition_variable m_cv_done;
+    uint64_t m_generation;
+    int m_pending;
+    double m_step;
+    bool m_shutdown;
+};
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Shared SoA exchange buffers for an in-process tire - terrain cosimulation.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_SHARED_BUFFERS_H
+#define CH_COSIM_SHARED_BUFFERS_H
+
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// Exchange buffers of one tire in an in-process cosimulation (see
+/// ChCosimInProcessManager). When the tire and terrain systems live in the
+/// same process there is nothing to serialize: the tire side writes the mesh
+/// vertex states here and the terrain side accumulates contact forces in
+/// place, both working on the same memory. Structure-of-arrays layout, so a
+/// terrain solver can consume the coordinate streams directly (and
+/// vectorized) without repacking.
+struct CH_VEHICLE_API ChCosimSharedBuffers {
+    unsigned int num_vertices;   ///< number of mesh vertices
+    unsigned int num_triangles;  ///< number of mesh triangles
+
+    // Mesh state, written by the tire side at each exchange.
+    std::vector<double> vert_pos_x;  ///< vertex absolute positions, x
+    std::vector<double> vert_pos_y;  ///< vertex absolute positions, y
+    std::vector<double> vert_pos_z;  ///< vertex absolute positions, z
+    std::vector<double> vert_vel_x;  ///< vertex absolute velocities, x
+    std::vector<double> vert_vel_y;  ///< vertex absolute velocities, y
+    std::vector<double> vert_vel_z;  ///< vertex absolute velocities, z
+    std::vector<int> tri_v1;         ///< triangle connectivity, first vertex (ccw)
+    std::vector<int> tri_v2;         ///< triangle connectivity, second vertex
+    std::vector<int> tri_v3;         ///< triangle connectivity, third vertex
+
+    // Accumulated contact forces, written by the terrain side at each
+    // exchange (cleared by the manager beforehand). 'touched' lists the
+    // vertices with a nonzero accumulated force, so the tire side applies
+    // only those.
+    std::vector<double> force_x;  ///< accumulated vertex forces, x
+    std::vector<double> force_y;  ///< accumulated vertex forces, y
+    std::vector<double> force_z;  ///< accumulated vertex forces, z
+    std::vector<int> touched;     ///< indices of vertices with accumulated force
+
+    ChCosimSharedBuffers() : num_vertices(0), num_triangles(0) {}
+
+    /// Size all buffers for the given mesh (done once, at initialization).
+    void Resize(unsigned int nv, unsigned int nt) {
+        num_vertices = nv;
+        num_triangles = nt;
+        vert_pos_x.resize(nv);
+        vert_pos_y.resize(nv);
+        vert_pos_z.resize(nv);
+        vert_vel_x.resize(nv);
+        vert_vel_y.resize(nv);
+        vert_vel_z.resize(nv);
+        tri_v1.resize(nt);
+        tri_v2.resize(nt);
+        tri_v3.resize(nt);
+        force_x.assign(nv, 0);
+        force_y.assign(nv, 0);
+        force_z.assign(nv, 0);
+        touched.reserve(nv);
+    }
+
+    /// Clear the force accumulators of the previously touched vertices only.
+    void ClearForces() {
+        for (size_t i = 0; i < touched.size(); i++) {
+            force_x[touched[i]] = 0;
+            force_y[touched[i]] = 0;
+            force_z[touched[i]] = 0;
+        }
+        touched.clear();
+    }
+
+    /// Accumulate a force on the given vertex, tracking it as touched.
+    void AccumulateForce(int vertex, double fx, double fy, double fz) {
+        if (force_x[vertex] == 0 && force_y[vertex] == 0 && force_z[vertex] == 0)
+            touched.push_back(vertex);
+        force_x[vertex] += fx;
+        force_y[vertex] += fy;
+        force_z[vertex] += fz;
+    }
+};
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -496,6 +496,40 @@ void ChSuspensionTestRig::Initialize(const ChCoordsys<>& chassisPos, double chas
     m_tire[RIGHT]->Initialize(GetWheelBody(RIGHT), RIGHT);
 }
 
+void ChSuspensionTestRig::Reinitialize(const ChCoordsys<>& chassisPos) {
+    // Remove all physics items created by the previous initialization. The ChSystem
+    // itself stays alive, so solver settings, the collision world, and the contact
+    // container are reused across evaluations.
+    m_system->Clear();
+
+    // A snapshot taken for the previous configuration is no longer consistent.
+    m_snapshot_valid = false;
+
+    // Rebuild the mechanism from the cached subsystem objects, picking up any
+    // modification made to them since the last initialization (hardpoint locations,
+    // spring and damper curves). No JSON specification file is re-parsed.
+    Initialize(chassisPos, 0);
+}
+
+void ChSuspensionTestRig::SnapshotState() {
+    m_snapshot_x.Reset(m_system->GetNcoords_x(), m_system);
+    m_snapshot_v.Reset(m_system->GetNcoords_v(), m_system);
+    m_system->StateGather(m_snapshot_x, m_snapshot_v, m_snapshot_T);
+    m_snapshot_valid = true;
+}
+
+void ChSuspensionTestRig::ResetState() {
+    if (!m_snapshot_valid)
+        return;
+    // Guard against topology changes made after the snapshot was taken.
+    if (m_snapshot_x.GetRows() != m_system->GetNcoords_x() || m_snapshot_v.GetRows() != m_system->GetNcoords_v()) {
+        m_snapshot_valid = false;
+        return;
+    }
+    m_system->StateScatter(m_snapshot_x, m_snapshot_v, m_snapshot_T);
+    m_system->SetChTime(m_snapshot_T);
+}
+
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 
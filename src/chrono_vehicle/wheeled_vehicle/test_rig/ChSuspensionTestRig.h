@@ -156,6 +156,25 @@ class CH_VEHICLE_API ChSuspensionTestRig : public ChVehicle {
                             double chassisFwdVel = 0         ///< [in] initial forward velocity (ignored)
                             ) override;
 
+    /// Re-initialize the rig in place, for batch evaluation of many configurations.
+    /// All physics items created by the previous Initialize() are removed from the
+    /// underlying ChSystem, which itself stays alive (solver settings, collision world,
+    /// and contact container are kept), and the mechanism is rebuilt from the cached
+    /// subsystem objects. Any modification made to the subsystems in between (hardpoint
+    /// locations, spring and damper curves) is picked up here; no JSON specification
+    /// file is re-parsed. Invalidates a state snapshot taken with SnapshotState().
+    void Reinitialize(const ChCoordsys<>& chassisPos  ///< [in] initial global position and orientation
+                      );
+
+    /// Capture the current full state of the rig (positions and velocities of all
+    /// bodies), to be restored later with ResetState().
+    void SnapshotState();
+
+    /// Restore the state captured by SnapshotState(), without rebuilding anything.
+    /// This is the cheapest way to run repeated evaluations of the same geometry
+    /// with different post/steering inputs. No-op if no valid snapshot exists.
+    void ResetState();
+
     /// Set visualization type for the suspension subsystem.
     void SetSuspensionVisualizationType(VisualizationType vis);
 
@@ -236,6 +255,11 @@ class CH_VEHICLE_API ChSuspensionTestRig : public ChVehicle {
     ChQuaternion<> m_steeringRot;
     ChVector<> m_antirollbarLoc;
 
+    bool m_snapshot_valid = false;  ///< is the state snapshot usable?
+    ChState m_snapshot_x;           ///< snapshot of the system positions
+    ChStateDelta m_snapshot_v;      ///< snapshot of the system velocities
+    double m_snapshot_T = 0;        ///< snapshot of the system time
+
     static const double m_post_radius;  ///< radius of the post cylindrical platform
     static const double m_post_height;  ///< height of the post cylindrical platform
 };
@@ -59,7 +59,8 @@ ChPacejkaTire::ChPacejkaTire(const std::string& name, const std::string& pacTire
       m_params_defined(false),
       m_use_transient_slip(true),
       m_use_Fz_override(false),
-      m_driven(false) {}
+      m_driven(false),
+      m_use_lut(false) {}
 
 ChPacejkaTire::ChPacejkaTire(const std::string& name,
                              const std::string& pacTire_paramFile,
@@ -71,7 +72,8 @@ ChPacejkaTire::ChPacejkaTire(const std::string& name,
       m_use_transient_slip(use_transient_slip),
       m_use_Fz_override(Fz_override > 0),
       m_Fz_override(Fz_override),
-      m_driven(false) {}
+      m_driven(false),
+      m_use_lut(false) {}
 
 // -----------------------------------------------------------------------------
 // Destructor
@@ -375,11 +377,21 @@ void ChPacejkaTire::Advance(double step) {
         slip_kinematic();
     }
 
-    // Calculate the force and moment reaction, pure slip case
-    pureSlipReactions();
+    if (m_use_lut && m_in_contact) {
+        // Compiled lookup-table mode: interpolate the combined-slip reactions
+        // instead of evaluating the full Magic Formula (see GenerateLookupTable).
+        double reactions[3];
+        InterpolateTable(m_slip->kappaP, m_slip->alphaP, m_slip->gammaP, m_Fz, reactions);
+        m_FM_combined.force.x() = reactions[0];
+        m_FM_combined.force.y() = reactions[1];
+        m_FM_combined.moment.z() = reactions[2];
+    } else {
+        // Calculate the force and moment reaction, pure slip case
+        pureSlipReactions();
 
-    // Update m_FM_combined.forces, m_FM_combined.moment.z
-    combinedSlipReactions();
+        // Update m_FM_combined.forces, m_FM_combined.moment.z
+        combinedSlipReactions();
+    }
 
     // Update M_x, apply to both m_FM and m_FM_combined
     // gamma should already be corrected for L/R side, so need to swap Fy if on opposite side
@@ -999,6 +1011,156 @@ void ChPacejkaTire::combinedSlipReactions() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Compiled lookup-table mode: sample the combined-slip reactions over the valid
+// (kappa, alpha, gamma, Fz) ranges of the parameter file into a regular grid,
+// then evaluate by quadrilinear interpolation in Advance().
+// -----------------------------------------------------------------------------
+void ChPacejkaTire::SampleReactions(double kappa, double alpha, double gamma, double Fz, double* out) {
+    m_Fz = Fz;
+    m_dF_z = (m_Fz - m_params->vertical.fnomin) / m_params->vertical.fnomin;
+    m_slip->kappaP = kappa;
+    m_slip->alphaP = alpha;
+    m_slip->gammaP = gamma;
+
+    pureSlipReactions();
+    combinedSlipReactions();
+
+    out[0] = m_FM_combined.force.x();
+    out[1] = m_FM_combined.force.y();
+    out[2] = m_FM_combined.moment.z();
+}
+
+void ChPacejkaTire::InterpolateTable(double kappa, double alpha, double gamma, double Fz, double* out) const {
+    double coords[4] = {kappa, alpha, gamma, Fz};
+    int idx[4];
+    double frac[4];
+    for (int a = 0; a < 4; a++) {
+        // Clamp to the table range and locate the cell along this axis.
+        double u = (coords[a] - m_lut_min[a]) / m_lut_step[a];
+        if (u < 0)
+            u = 0;
+        if (u > m_lut_num[a] - 1)
+            u = m_lut_num[a] - 1;
+        int i = (int)u;
+        if (i > m_lut_num[a] - 2)
+            i = m_lut_num[a] - 2;
+        idx[a] = i;
+        frac[a] = u - i;
+    }
+
+    const size_t stride[4] = {(size_t)m_lut_num[1] * m_lut_num[2] * m_lut_num[3] * 3,
+                              (size_t)m_lut_num[2] * m_lut_num[3] * 3,  //
+                              (size_t)m_lut_num[3] * 3,                 //
+                              3};
+
+    out[0] = out[1] = out[2] = 0;
+    for (int corner = 0; corner < 16; corner++) {
+        double w = 1;
+        size_t base = 0;
+        for (int a = 0; a < 4; a++) {
+            int bit = (corner >> a) & 1;
+            w *= bit ? frac[a] : 1 - frac[a];
+            base += (idx[a] + bit) * stride[a];
+        }
+        const double* value = &m_lut[base];
+        out[0] += w * value[0];
+        out[1] += w * value[1];
+        out[2] += w * value[2];
+    }
+}
+
+void ChPacejkaTire::GenerateLookupTable(int num_kappa, int num_alpha, int num_gamma, int num_Fz) {
+    assert(m_params_defined);
+    assert(num_kappa >= 2 && num_alpha >= 2 && num_gamma >= 2 && num_Fz >= 2);
+
+    // Table ranges: the valid ranges of the loaded parameter file. A strictly
+    // positive lower bound is enforced on the vertical load, since the Magic
+    // Formula is only evaluated in contact.
+    double Fz_low = std::max(m_params->vertical_force_range.fzmin, 0.01 * m_params->vertical.fnomin);
+    double range_min[4] = {m_params->long_slip_range.kpumin, m_params->slip_angle_range.alpmin,
+                           m_params->inclination_angle_range.cammin, Fz_low};
+    double range_max[4] = {m_params->long_slip_range.kpumax, m_params->slip_angle_range.alpmax,
+                           m_params->inclination_angle_range.cammax, m_params->vertical_force_range.fzmax};
+
+    m_lut_num[0] = num_kappa;
+    m_lut_num[1] = num_alpha;
+    m_lut_num[2] = num_gamma;
+    m_lut_num[3] = num_Fz;
+    for (int a = 0; a < 4; a++) {
+        m_lut_min[a] = range_min[a];
+        m_lut_step[a] = (range_max[a] - range_min[a]) / (m_lut_num[a] - 1);
+    }
+
+    // The direct samples trample the slip and load state; save it here and
+    // restore it once the table is compiled.
+    slips slip_saved = *m_slip;
+    double Fz_saved = m_Fz;
+    double dFz_saved = m_dF_z;
+    bool contact_saved = m_in_contact;
+    TerrainForce FM_pure_saved = m_FM_pure;
+    TerrainForce FM_combined_saved = m_FM_combined;
+
+    m_use_lut = false;
+    m_in_contact = true;
+
+    // Sample the direct Magic Formula at all grid points.
+    m_lut.resize((size_t)num_kappa * num_alpha * num_gamma * num_Fz * 3);
+    size_t entry = 0;
+    for (int ik = 0; ik < num_kappa; ik++) {
+        for (int ia = 0; ia < num_alpha; ia++) {
+            for (int ig = 0; ig < num_gamma; ig++) {
+                for (int io = 0; io < num_Fz; io++) {
+                    SampleReactions(m_lut_min[0] + ik * m_lut_step[0], m_lut_min[1] + ia * m_lut_step[1],
+                                    m_lut_min[2] + ig * m_lut_step[2], m_lut_min[3] + io * m_lut_step[3],
+                                    &m_lut[entry]);
+                    entry += 3;
+                }
+            }
+        }
+    }
+
+    // Estimate the interpolation error at all cell midpoints, where the
+    // quadrilinear error is largest.
+    m_lut_max_err[0] = m_lut_max_err[1] = m_lut_max_err[2] = 0;
+    double exact[3];
+    double approx[3];
+    for (int ik = 0; ik < num_kappa - 1; ik++) {
+        for (int ia = 0; ia < num_alpha - 1; ia++) {
+            for (int ig = 0; ig < num_gamma - 1; ig++) {
+                for (int io = 0; io < num_Fz - 1; io++) {
+                    double kappa = m_lut_min[0] + (ik + 0.5) * m_lut_step[0];
+                    double alpha = m_lut_min[1] + (ia + 0.5) * m_lut_step[1];
+                    double gamma = m_lut_min[2] + (ig + 0.5) * m_lut_step[2];
+                    double Fz = m_lut_min[3] + (io + 0.5) * m_lut_step[3];
+                    SampleReactions(kappa, alpha, gamma, Fz, exact);
+                    InterpolateTable(kappa, alpha, gamma, Fz, approx);
+                    for (int c = 0; c < 3; c++)
+                        m_lut_max_err[c] = std::max(m_lut_max_err[c], std::abs(approx[c] - exact[c]));
+                }
+            }
+        }
+    }
+
+    // Restore the trampled state and enable the table.
+    *m_slip = slip_saved;
+    m_Fz = Fz_saved;
+    m_dF_z = dFz_saved;
+    m_in_contact = contact_saved;
+    m_FM_pure = FM_pure_saved;
+    m_FM_combined = FM_combined_saved;
+    m_use_lut = true;
+
+    GetLog() << " Pacejka lookup table compiled for tire " << m_name << ": " << num_kappa << "x" << num_alpha << "x"
+             << num_gamma << "x" << num_Fz << " points, est. max errors: Fx = " << m_lut_max_err[0]
+             << " N, Fy = " << m_lut_max_err[1] << " N, Mz = " << m_lut_max_err[2] << " Nm \n";
+}
+
+void ChPacejkaTire::ClearLookupTable() {
+    m_use_lut = false;
+    m_lut.clear();
+}
+
 void ChPacejkaTire::relaxationLengths() {
     double p_Ky4 = 2;  // according to Pac2002 model
     double p_Ky5 = 0;
@@ -138,6 +138,34 @@ class CH_VEHICLE_API ChPacejkaTire : public ChTire {
     /// Manually set the vertical wheel load as an input.
     void set_Fz_override(double Fz) { m_Fz_override = Fz; }
 
+    /// Compile the combined-slip Magic Formula reactions (Fx, Fy, Mz) into a
+    /// lookup table over (long. slip, slip angle, camber, vertical load),
+    /// sampled on a regular grid spanning the valid ranges of the loaded .tir
+    /// parameter file. After this call, Advance() evaluates those reactions by
+    /// quadrilinear interpolation in the table (a handful of multiply-adds,
+    /// vectorized by the compiler over the output channels) instead of the full
+    /// transcendental Magic Formula evaluation; the overturning and rolling
+    /// resistance moments, which depend on the wheel speed, remain direct.
+    /// Call it after Initialize(): the table bakes in the L/R side corrections.
+    /// The interpolation error is estimated by sampling all cell midpoints
+    /// during compilation; see GetLookupTableMaxError().
+    void GenerateLookupTable(int num_kappa = 33,  ///< [in] table points along the long. slip axis
+                             int num_alpha = 33,  ///< [in] table points along the slip angle axis
+                             int num_gamma = 5,   ///< [in] table points along the camber axis
+                             int num_Fz = 9       ///< [in] table points along the vertical load axis
+                             );
+
+    /// Discard the lookup table and return to direct Magic Formula evaluation.
+    void ClearLookupTable();
+
+    /// Return true if the tire reactions are evaluated through the compiled lookup table.
+    bool IsUsingLookupTable() const { return m_use_lut; }
+
+    /// Return the estimated maximum absolute interpolation error of the lookup
+    /// table for the given output channel (0: Fx, 1: Fy, 2: Mz), measured against
+    /// the direct Magic Formula at the midpoints of all table cells.
+    double GetLookupTableMaxError(int channel) const { return m_lut_max_err[channel]; }
+
     /// Return orientation, Vx (global) and omega/omega_y (global).
     /// Assumes the tire is going straight forward (global x-dir), and the
     /// returned state's orientation yields gamma and alpha, as x and z NASA angles
@@ -347,6 +375,15 @@ class CH_VEHICLE_API ChPacejkaTire : public ChTire {
     /// assign m_FM.moment.y and m_FM_combined.moment.y
     double calc_My(double Fx_combined);
 
+    /// Sample the combined-slip reactions of the direct Magic Formula at the
+    /// given operating point, writing {Fx, Fy, Mz} to out. Tramples the slip and
+    /// load state, so it is used only while compiling the lookup table.
+    void SampleReactions(double kappa, double alpha, double gamma, double Fz, double* out);
+
+    /// Evaluate the lookup table at the given operating point (clamped to the
+    /// table ranges) by quadrilinear interpolation, writing {Fx, Fy, Mz} to out.
+    void InterpolateTable(double kappa, double alpha, double gamma, double Fz, double* out) const;
+
     // ----- Data members
     bool m_use_transient_slip;
     bool m_driven;   // is this a driven tire?
@@ -416,6 +453,14 @@ class CH_VEHICLE_API ChPacejkaTire : public ChTire {
     relaxationL* m_relaxation;
     bessel* m_bessel;
 
+    // Compiled lookup-table mode (see GenerateLookupTable)
+    bool m_use_lut;               // evaluate reactions through the lookup table?
+    std::vector<double> m_lut;    // table data, 3 channels (Fx, Fy, Mz) per grid point
+    int m_lut_num[4];             // grid points per axis (kappa, alpha, gamma, Fz)
+    double m_lut_min[4];          // lower bound of each axis
+    double m_lut_step[4];         // grid spacing of each axis
+    double m_lut_max_err[3];      // estimated max abs interpolation error per channel
+
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
     std::shared_ptr<ChTexture> m_texture;          ///< visualization texture asset
 };
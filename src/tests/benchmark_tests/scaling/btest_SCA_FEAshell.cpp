@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Scaling benchmark for FEA: a clamped square plate of ANCF shell elements at
+// several mesh densities (NxN elements), under gravity.
+//
+// Per-phase times (Jacobian load, solver setup/solve, update) are reported as
+// benchmark counters. For regression tracking, run with
+//   --benchmark_out=results.json --benchmark_out_format=json
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+
+#include "chrono/fea/ChElementShellANCF.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+template <int N>
+class ANCFshellPlate : public utils::ChBenchmarkTest {
+  public:
+    ANCFshellPlate();
+    ~ANCFshellPlate() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(1e-4); }
+
+  private:
+    ChSystemSMC* m_system;
+};
+
+template <int N>
+ANCFshellPlate<N>::ANCFshellPlate() {
+    m_system = new ChSystemSMC();
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.8));
+
+    // Set solver parameters
+    m_system->SetSolverType(ChSolver::Type::MINRES);
+    auto minres_solver = std::static_pointer_cast<ChSolverMINRES>(m_system->GetSolver());
+    minres_solver->SetDiagonalPreconditioning(true);
+    m_system->SetMaxItersSolverSpeed(100);
+    m_system->SetTolForce(1e-10);
+
+    // Set up integrator
+    m_system->SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(m_system->GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(100);
+    integrator->SetAbsTolerances(1e-5);
+    integrator->SetMode(ChTimestepperHHT::ACCELERATION);
+    integrator->SetScaling(true);
+    integrator->SetVerbose(false);
+
+    // Mesh properties
+    double length = 1;
+    double thickness = 0.01;
+
+    double rho = 500;
+    ChVector<> E(2.1e7, 2.1e7, 2.1e7);
+    ChVector<> nu(0.3, 0.3, 0.3);
+    ChVector<> G(8.0769231e6, 8.0769231e6, 8.0769231e6);
+    auto mat = std::make_shared<ChMaterialShellANCF>(rho, E, nu, G);
+
+    // Create mesh nodes and elements: a square plate of NxN shells in the XY
+    // plane, clamped along the edge x=0.
+    auto mesh = std::make_shared<ChMesh>();
+    m_system->Add(mesh);
+
+    double dx = length / N;
+    ChVector<> dir(0, 0, 1);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes((N + 1) * (N + 1));
+    for (int j = 0; j <= N; j++) {
+        for (int i = 0; i <= N; i++) {
+            auto node = std::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dx, 0), dir);
+            if (i == 0)
+                node->SetFixed(true);
+            mesh->AddNode(node);
+            nodes[j * (N + 1) + i] = node;
+        }
+    }
+
+    for (int j = 0; j < N; j++) {
+        for (int i = 0; i < N; i++) {
+            auto element = std::make_shared<ChElementShellANCF>();
+            element->SetNodes(nodes[(j + 0) * (N + 1) + (i + 0)],  //
+                              nodes[(j + 0) * (N + 1) + (i + 1)],  //
+                              nodes[(j + 1) * (N + 1) + (i + 1)],  //
+                              nodes[(j + 1) * (N + 1) + (i + 0)]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(thickness, 0 * CH_C_DEG_TO_RAD, mat);
+            element->SetAlphaDamp(0.0);
+            element->SetGravityOn(true);
+            mesh->AddElement(element);
+        }
+    }
+
+    m_system->SetupInitial();
+}
+
+// -----------------------------------------------------------------------------
+
+#define NUM_SKIP_STEPS 10  // number of steps for hot start
+#define NUM_SIM_STEPS 100  // number of simulation steps for each benchmark
+
+typedef ANCFshellPlate<8> ShellPlate08;
+typedef ANCFshellPlate<16> ShellPlate16;
+typedef ANCFshellPlate<32> ShellPlate32;
+
+CH_BM_SIMULATION_LOOP(ShellPlate08_Test, ShellPlate08, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10)
+CH_BM_SIMULATION_LOOP(ShellPlate16_Test, ShellPlate16, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10)
+CH_BM_SIMULATION_LOOP(ShellPlate32_Test, ShellPlate32, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5)
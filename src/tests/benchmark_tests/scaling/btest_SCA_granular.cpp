@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Scaling benchmark for granular simulations: a box container filled with a
+// lattice of frictional spheres, with either the NSC or the SMC contact
+// formulation, at increasing body counts and OpenMP thread counts.
+//
+// Per-phase times (broad-phase, narrow-phase, solver setup/solve, update) are
+// reported as benchmark counters. For regression tracking, run with
+//   --benchmark_out=results.json --benchmark_out_format=json
+//
+// Note: the larger cases (100k and 1M bodies) take considerable time to set
+// up and step; use --benchmark_filter to select a subset.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/parallel/ChOpenMP.h"
+#include "chrono/physics/ChMaterialSurfaceNSC.h"
+#include "chrono/physics/ChMaterialSurfaceSMC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+using namespace chrono;
+
+template <class SYS, int N, int THREADS>
+class GranularBox : public utils::ChBenchmarkTest {
+  public:
+    GranularBox();
+    ~GranularBox() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(1e-3); }
+
+  private:
+    SYS* m_system;
+};
+
+template <class SYS, int N, int THREADS>
+GranularBox<SYS, N, THREADS>::GranularBox() {
+    CHOMPfunctions::SetNumThreads(THREADS);
+
+    m_system = new SYS();
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+    m_system->SetMaxItersSolverSpeed(50);
+
+    double radius = 0.05;
+    double rho = 2500;
+    double spacing = 2.05 * radius;
+
+    double mass = rho * (4.0 / 3.0) * CH_C_PI * radius * radius * radius;
+    double inertia = 0.4 * mass * radius * radius;
+
+    // Contact material, matching the system's contact formulation
+    std::shared_ptr<ChMaterialSurface> mat;
+    if (m_system->GetContactMethod() == ChMaterialSurface::NSC) {
+        auto matNSC = std::make_shared<ChMaterialSurfaceNSC>();
+        matNSC->SetFriction(0.4f);
+        mat = matNSC;
+    } else {
+        auto matSMC = std::make_shared<ChMaterialSurfaceSMC>();
+        matSMC->SetYoungModulus(1e7f);
+        matSMC->SetFriction(0.4f);
+        mat = matSMC;
+    }
+
+    // Roughly cubic lattice with N spheres
+    int side = (int)std::ceil(std::cbrt((double)N));
+    double half_side = 0.5 * side * spacing;
+
+    // Fixed container (5 walls, no top), large enough for the lattice
+    utils::CreateBoxContainer(m_system, 0, mat, ChVector<>(half_side + spacing, half_side + spacing, 2 * half_side),
+                              0.1);
+
+    int id = 1;
+    for (int iz = 0; iz < side && id <= N; iz++) {
+        for (int iy = 0; iy < side && id <= N; iy++) {
+            for (int ix = 0; ix < side && id <= N; ix++) {
+                auto body = std::make_shared<ChBody>(m_system->GetContactMethod());
+                body->SetIdentifier(id++);
+                body->SetMass(mass);
+                body->SetInertiaXX(ChVector<>(inertia, inertia, inertia));
+                body->SetPos(ChVector<>(-half_side + radius + ix * spacing,  //
+                                        -half_side + radius + iy * spacing,  //
+                                        radius + iz * spacing));
+                body->SetMaterialSurface(mat);
+
+                body->GetCollisionModel()->ClearModel();
+                utils::AddSphereGeometry(body.get(), radius);
+                body->GetCollisionModel()->BuildModel();
+                body->SetCollide(true);
+
+                m_system->AddBody(body);
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+#define NUM_SKIP_STEPS 10  // number of steps for hot start
+#define NUM_SIM_STEPS 20   // number of measured steps
+
+// Body-count sweep (at 4 threads)
+typedef GranularBox<ChSystemNSC, 10000, 4> GranNSC_010k;
+typedef GranularBox<ChSystemNSC, 100000, 4> GranNSC_100k;
+typedef GranularBox<ChSystemNSC, 1000000, 4> GranNSC_1M;
+typedef GranularBox<ChSystemSMC, 10000, 4> GranSMC_010k;
+typedef GranularBox<ChSystemSMC, 100000, 4> GranSMC_100k;
+typedef GranularBox<ChSystemSMC, 1000000, 4> GranSMC_1M;
+
+CH_BM_SIMULATION_ONCE(GranNSC_010k_Test, GranNSC_010k, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranNSC_100k_Test, GranNSC_100k, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranNSC_1M_Test, GranNSC_1M, NUM_SKIP_STEPS, NUM_SIM_STEPS, 1)
+CH_BM_SIMULATION_ONCE(GranSMC_010k_Test, GranSMC_010k, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranSMC_100k_Test, GranSMC_100k, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranSMC_1M_Test, GranSMC_1M, NUM_SKIP_STEPS, NUM_SIM_STEPS, 1)
+
+// Thread-count sweep (at 10k bodies)
+typedef GranularBox<ChSystemNSC, 10000, 1> GranNSC_010k_1t;
+typedef GranularBox<ChSystemNSC, 10000, 2> GranNSC_010k_2t;
+typedef GranularBox<ChSystemNSC, 10000, 8> GranNSC_010k_8t;
+typedef GranularBox<ChSystemSMC, 10000, 1> GranSMC_010k_1t;
+typedef GranularBox<ChSystemSMC, 10000, 2> GranSMC_010k_2t;
+typedef GranularBox<ChSystemSMC, 10000, 8> GranSMC_010k_8t;
+
+CH_BM_SIMULATION_ONCE(GranNSC_010k_1t_Test, GranNSC_010k_1t, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranNSC_010k_2t_Test, GranNSC_010k_2t, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranNSC_010k_8t_Test, GranNSC_010k_8t, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranSMC_010k_1t_Test, GranSMC_010k_1t, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranSMC_010k_2t_Test, GranSMC_010k_2t, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
+CH_BM_SIMULATION_ONCE(GranSMC_010k_8t_Test, GranSMC_010k_8t, NUM_SKIP_STEPS, NUM_SIM_STEPS, 3)
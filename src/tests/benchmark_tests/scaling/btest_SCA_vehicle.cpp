@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark of a full vehicle (HMMWV, reduced double wishbone, rigid tires,
+// simple powertrain) accelerating straight on rigid terrain.
+//
+// Per-phase times (collision, Jacobian load, solver setup/solve, update) are
+// reported as benchmark counters. For regression tracking, run with
+//   --benchmark_out=results.json --benchmark_out_format=json
+//
+// =============================================================================
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+class HmmwvOnRigidTerrain : public utils::ChBenchmarkTest {
+  public:
+    HmmwvOnRigidTerrain();
+    ~HmmwvOnRigidTerrain() {
+        delete m_terrain;
+        delete m_hmmwv;
+    }
+
+    ChSystem* GetSystem() override { return m_hmmwv->GetSystem(); }
+    void ExecuteStep() override {
+        double time = m_hmmwv->GetSystem()->GetChTime();
+        // Straight-line acceleration: no steering, constant throttle
+        m_hmmwv->Synchronize(time, 0.0, 0.0, 0.7, *m_terrain);
+        m_terrain->Synchronize(time);
+        m_hmmwv->Advance(m_step);
+        m_terrain->Advance(m_step);
+    }
+
+  private:
+    HMMWV_Reduced* m_hmmwv;
+    RigidTerrain* m_terrain;
+    double m_step;
+};
+
+HmmwvOnRigidTerrain::HmmwvOnRigidTerrain() : m_step(2e-3) {
+    m_hmmwv = new HMMWV_Reduced();
+    m_hmmwv->SetChassisFixed(false);
+    m_hmmwv->SetChassisCollisionType(ChassisCollisionType::NONE);
+    m_hmmwv->SetInitPosition(ChCoordsys<>(ChVector<>(0, 0, 1.0), QUNIT));
+    m_hmmwv->SetPowertrainType(PowertrainModelType::SIMPLE);
+    m_hmmwv->SetDriveType(DrivelineType::RWD);
+    m_hmmwv->SetTireType(TireModelType::RIGID);
+    m_hmmwv->SetTireStepSize(m_step);
+    m_hmmwv->SetVehicleStepSize(m_step);
+    m_hmmwv->Initialize();
+
+    m_hmmwv->SetChassisVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetSuspensionVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetSteeringVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetWheelVisualizationType(VisualizationType::NONE);
+    m_hmmwv->SetTireVisualizationType(VisualizationType::NONE);
+
+    m_terrain = new RigidTerrain(m_hmmwv->GetSystem());
+    auto patch = m_terrain->AddPatch(ChCoordsys<>(ChVector<>(0, 0, -5), QUNIT), ChVector<>(500.0, 100.0, 10));
+    patch->SetContactFrictionCoefficient(0.9f);
+    patch->SetContactRestitutionCoefficient(0.01f);
+    patch->SetContactMaterialProperties(2e7f, 0.3f);
+    m_terrain->Initialize();
+}
+
+// -----------------------------------------------------------------------------
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start (1 second)
+#define NUM_SIM_STEPS 500   // number of simulation steps for each benchmark (1 second)
+
+CH_BM_SIMULATION_LOOP(HmmwvRigid_Test, HmmwvOnRigidTerrain, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5)
@@ -12,7 +12,7 @@
 // Authors: Milad Rakhsha, Radu Serban
 // =============================================================================
 //
-// Unit test for MatrMultiplyAVX and MatrMultiplyTAVX.
+// Unit test for MatrMultiplyAVX, MatrMultiplyTAVX, MatrTMultiplyAVX, and MatrIncAVX.
 //
 // =============================================================================
 
@@ -46,7 +46,7 @@ TEST_P(MatMult, AB) {
     B.FillRandom(10, -10);
 
     ChMatrixDynamic<double> ref(M, K);
-    ref.MatrMultiply(A, B);
+    ref.MatrMultiply<double, double>(A, B);
 
     ChMatrixDynamic<double> avx(M, K);
     avx.MatrMultiplyAVX(A, B);
@@ -72,7 +72,7 @@ TEST_P(MatMult, ABt) {
     B.FillRandom(10, -10);
 
     ChMatrixDynamic<double> ref(M, K);
-    ref.MatrMultiplyT(A, B);
+    ref.MatrMultiplyT<double, double>(A, B);
 
     ChMatrixDynamic<double> avx(M, K);
     avx.MatrMultiplyTAVX(A, B);
@@ -91,8 +91,52 @@ TEST_P(MatMult, ABt) {
     }
 }
 
+TEST_P(MatMult, AtB) {
+    ChMatrixDynamic<double> A(N, M);
+    ChMatrixDynamic<double> B(N, K);
+    A.FillRandom(10, -10);
+    B.FillRandom(10, -10);
+
+    ChMatrixDynamic<double> ref(M, K);
+    ref.MatrTMultiply<double, double>(A, B);
+
+    ChMatrixDynamic<double> avx(M, K);
+    avx.MatrTMultiplyAVX(A, B);
+
+    if (!avx.Equals(ref, tolerance)) {
+        if (verbose) {
+            GetLog() << "(" << N << "x" << M << ")^T * (" << N << "x" << K << ")\n";
+            GetLog() << "\n(A'*B)_ref";
+            ref.StreamOUT(GetLog());
+            GetLog() << "\n(A'*B)_avx";
+            avx.StreamOUT(GetLog());
+            GetLog() << "\n(A'*B)_avx - (A'*B)_ref";
+            (avx - ref).StreamOUT(GetLog());
+        }
+        FAIL();
+    }
+}
+
+TEST_P(MatMult, Inc) {
+    ChMatrixDynamic<double> A(M, K);
+    A.FillRandom(10, -10);
+
+    ChMatrixDynamic<double> ref(M, K);
+    ref.FillRandom(10, -10);
+    ChMatrixDynamic<double> avx(ref);
+
+    ref.MatrInc<double>(A);
+    avx.MatrIncAVX(A);
+
+    if (!avx.Equals(ref, tolerance)) {
+        FAIL();
+    }
+}
+
+// Include sizes that are not multiples of the AVX vector width, to exercise
+// the scalar tails of the kernels.
 INSTANTIATE_TEST_CASE_P(AVX,
                         MatMult,
                         ::testing::Combine(::testing::Values(20, 21, 22, 23),
                                            ::testing::Values(8, 9, 10, 11),
-                                           ::testing::Values(24)));
+                                           ::testing::Values(24, 25, 26, 27)));
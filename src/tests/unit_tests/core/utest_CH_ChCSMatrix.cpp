@@ -315,3 +315,39 @@ TEST(ChCSMatrixTest, mat_mult_clipped) {
 
     ASSERT_TRUE(mat_out2.Equals(mat_out3));
 }
+
+TEST(ChCSMatrixTest, paste_block) {
+    const int n = 6;
+
+    ChMatrixDynamic<> block(3, 3);
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            block.SetElement(i, j, 1.0 + i * 3 + j);
+
+    // Scatter map with non-contiguous and non-ascending indexes; the second
+    // block row is skipped (as for an inactive variable).
+    std::vector<int> rows = {1, -1, 4};
+    std::vector<int> cols = {3, 0, 5};
+
+    // Reference matrix, assembled one scalar at a time
+    ChCSMatrix mat_ref(n, n, true, 15);
+    for (int i = 0; i < 3; i++) {
+        if (rows[i] < 0)
+            continue;
+        for (int j = 0; j < 3; j++)
+            mat_ref.SetElement(rows[i], cols[j], block.GetElement(i, j));
+    }
+
+    ChCSMatrix mat(n, n, true, 15);
+    mat.PasteBlock(block, rows, cols);
+    ASSERT_TRUE(CompareMatrix(mat, mat_ref));
+
+    // Summing the block on top of existing elements must double them
+    mat.PasteBlock(block, rows, cols, false);
+    for (int i = 0; i < 3; i++) {
+        if (rows[i] < 0)
+            continue;
+        for (int j = 0; j < 3; j++)
+            ASSERT_DOUBLE_EQ(mat.GetElement(rows[i], cols[j]), 2 * block.GetElement(i, j));
+    }
+}
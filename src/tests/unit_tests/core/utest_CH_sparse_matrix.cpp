@@ -21,6 +21,7 @@
 
 #include "gtest/gtest.h"
 
+#include "chrono/core/ChCSMatrix.h"
 #include "chrono/core/ChLinkedListMatrix.h"
 #include "chrono/core/ChMapMatrix.h"
 #include "chrono/core/ChMatrixDynamic.h"
@@ -139,6 +140,199 @@ TEST(ChLinkedListMatrix, LDL_singular) {
     ASSERT_DOUBLE_EQ(det, 0.0);
 }
 
+// ----------------------------------------------------
+// Same systems as the ChLinkedListMatrix tests above, solved through the
+// CSR-based factorizations of ChCSMatrix (which leave the matrix untouched).
+
+TEST(ChCSMatrix, solve_general) {
+    ChCSMatrix A(5, 5);
+    A.SetElement(1, 0, 0.130);
+    A.SetElement(3, 0, 0.012);
+    A.SetElement(2, 1, 1);
+    A.SetElement(0, 2, -1);
+    A.SetElement(3, 2, 0.337);
+    A.SetElement(1, 3, 0.569);
+    A.SetElement(4, 3, -0.1);
+    A.SetElement(2, 4, 0.469);
+    A.SetElement(4, 4, 1);
+
+    double det_ref = 0.006828;
+
+    ChMatrixDynamic<> x_ref(5, 1);
+    x_ref(0, 0) = 0.34;
+    x_ref(1, 0) = 0.58;
+    x_ref(2, 0) = 0.23;
+    x_ref(3, 0) = 0.75;
+    x_ref(4, 0) = 0.25;
+
+    ChMatrixDynamic<> b(5, 1);
+    b(0, 0) = -0.23;
+    b(1, 0) = 0.47095;
+    b(2, 0) = 0.69725;
+    b(3, 0) = 0.08159;
+    b(4, 0) = 0.1750;
+
+    ChMatrixDynamic<> x(5, 1);
+    int err = A.SolveGeneral(b, x);
+
+    ASSERT_EQ(err, 0);
+    ASSERT_TRUE(x.Equals(x_ref, 1e-10));
+
+    double det = A.GetDeterminant();
+
+    ASSERT_NEAR(det, det_ref, 1e-10);
+
+    // the factorization must not modify the matrix itself
+    ASSERT_EQ(A.GetElement(3, 2), 0.337);
+}
+
+TEST(ChCSMatrix, LU_singular) {
+    ChCSMatrix A(4, 4);
+    A.SetElement(0, 0, 0.5);
+    A.SetElement(0, 1, 0.3);
+    A.SetElement(0, 2, -0.7);
+    A.SetElement(1, 2, 0.2);
+    A.SetElement(3, 2, -0.6);
+    A.SetElement(3, 3, 0.5);
+
+    int err = A.Setup_LU();
+    double det = A.GetDeterminant();
+
+    ASSERT_EQ(err, 3);
+    ASSERT_DOUBLE_EQ(det, 0.0);
+}
+
+TEST(ChCSMatrix, solve_symmetric) {
+    ChCSMatrix A(5, 5);
+    A.SetElement(0, 0, 0.32);
+    A.SetElement(1, 1, -0.14);
+    A.SetElement(2, 2, 0.54);
+    A.SetElement(3, 3, -0.40);
+    A.SetElement(4, 4, 0.38);
+
+    A.SetElement(0, 1, 0.06);
+    A.SetElement(0, 4, -0.08);
+    A.SetElement(1, 4, -0.82);
+
+    double det_ref = 0.048555072;
+
+    ChMatrixDynamic<> x_ref(5, 1);
+    x_ref(0, 0) = 0.34;
+    x_ref(1, 0) = 0.58;
+    x_ref(2, 0) = 0.23;
+    x_ref(3, 0) = 0.75;
+    x_ref(4, 0) = 0.25;
+
+    ChMatrixDynamic<> b(5, 1);
+    b(0, 0) = 0.1236;
+    b(1, 0) = -0.2658;
+    b(2, 0) = 0.1242;
+    b(3, 0) = -0.3;
+    b(4, 0) = -0.4078;
+
+    ChMatrixDynamic<> x(5, 1);
+    int err = A.SolveSymmetric(b, x);
+
+    ASSERT_EQ(err, 0);
+    ASSERT_TRUE(x.Equals(x_ref, 1e-10));
+
+    double det = A.GetDeterminant();
+
+    ASSERT_NEAR(det, det_ref, 1e-10);
+}
+
+TEST(ChCSMatrix, solve_general_parallel) {
+    // Same system as ChCSMatrix.solve_general, solved with the level-scheduled
+    // parallel substitution; the result must match the serial one exactly.
+    ChCSMatrix A(5, 5);
+    A.SetElement(1, 0, 0.130);
+    A.SetElement(3, 0, 0.012);
+    A.SetElement(2, 1, 1);
+    A.SetElement(0, 2, -1);
+    A.SetElement(3, 2, 0.337);
+    A.SetElement(1, 3, 0.569);
+    A.SetElement(4, 3, -0.1);
+    A.SetElement(2, 4, 0.469);
+    A.SetElement(4, 4, 1);
+
+    ChMatrixDynamic<> b(5, 1);
+    b(0, 0) = -0.23;
+    b(1, 0) = 0.47095;
+    b(2, 0) = 0.69725;
+    b(3, 0) = 0.08159;
+    b(4, 0) = 0.1750;
+
+    int err = A.Setup_LU();
+    ASSERT_EQ(err, 0);
+
+    ChMatrixDynamic<> x_serial(5, 1);
+    A.Solve_LU(b, x_serial);
+
+    ChMatrixDynamic<> x_parallel(5, 1);
+    A.Solve_LU_Parallel(b, x_parallel);
+
+    ASSERT_TRUE(x_parallel.Equals(x_serial));
+
+    // the cached schedule must be reusable for a second right-hand side
+    ChMatrixDynamic<> b2(b);
+    b2.MatrScale(2.0);
+    A.Solve_LU(b2, x_serial);
+    A.Solve_LU_Parallel(b2, x_parallel);
+
+    ASSERT_TRUE(x_parallel.Equals(x_serial));
+}
+
+TEST(ChCSMatrix, solve_symmetric_parallel) {
+    // Same system as ChCSMatrix.solve_symmetric, solved with the level-scheduled
+    // parallel substitution. The row-oriented forward sweep accumulates in a
+    // different order than the serial column-oriented one, so the results match
+    // only to round-off.
+    ChCSMatrix A(5, 5);
+    A.SetElement(0, 0, 0.32);
+    A.SetElement(1, 1, -0.14);
+    A.SetElement(2, 2, 0.54);
+    A.SetElement(3, 3, -0.40);
+    A.SetElement(4, 4, 0.38);
+
+    A.SetElement(0, 1, 0.06);
+    A.SetElement(0, 4, -0.08);
+    A.SetElement(1, 4, -0.82);
+
+    ChMatrixDynamic<> b(5, 1);
+    b(0, 0) = 0.1236;
+    b(1, 0) = -0.2658;
+    b(2, 0) = 0.1242;
+    b(3, 0) = -0.3;
+    b(4, 0) = -0.4078;
+
+    int err = A.Setup_LDL();
+    ASSERT_EQ(err, 0);
+
+    ChMatrixDynamic<> x_serial(5, 1);
+    A.Solve_LDL(b, x_serial);
+
+    ChMatrixDynamic<> x_parallel(5, 1);
+    A.Solve_LDL_Parallel(b, x_parallel);
+
+    ASSERT_TRUE(x_parallel.Equals(x_serial, 1e-14));
+}
+
+TEST(ChCSMatrix, LDL_singular) {
+    ChCSMatrix A(4, 4);
+    A.SetElement(0, 0, 0.5);
+    A.SetElement(2, 2, 0.3);
+    A.SetElement(3, 3, 0.5);
+
+    A.SetElement(0, 2, -0.7);
+    A.SetElement(2, 3, -0.6);
+
+    int err = A.Setup_LDL();
+    double det = A.GetDeterminant();
+
+    ASSERT_EQ(err, 1);
+    ASSERT_DOUBLE_EQ(det, 0.0);
+}
+
 // ----------------------------------------------------
 
 TEST(ChMapMatrix, check) {
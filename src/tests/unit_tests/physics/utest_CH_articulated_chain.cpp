@@ -0,0 +1,204 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for the reduced-coordinate articulated chain.
+//
+// Chain extraction is checked on an assembly mixing an open double pendulum
+// with a body that carries a non-joint constraint. The articulated-body
+// dynamics are checked against the minimal-coordinate ODE of the rigid double
+// pendulum (the same reference model used by utest_CH_double_pend), advanced
+// with the same semi-implicit Euler scheme so that the two solutions agree to
+// integration roundoff. The base reaction wrench is checked on a chain hanging
+// at equilibrium.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChArticulatedChain.h"
+#include "chrono/physics/ChLinkDistance.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+static const double m1 = 1;
+static const double l1 = 1;
+static const double J1 = 1;
+static const double m2 = 1;
+static const double l2 = 1;
+static const double J2 = 1;
+static const double g = 10;
+
+// Build a double pendulum (two revolute joints, horizontal initial
+// configuration) and return its bodies in creation order.
+static std::vector<std::shared_ptr<ChBody>> BuildDoublePendulum(ChSystemNSC& system) {
+    system.Set_G_acc(ChVector<>(0, -g, 0));
+
+    auto ground = std::make_shared<ChBody>();
+    system.AddBody(ground);
+    ground->SetBodyFixed(true);
+
+    auto pend1 = std::make_shared<ChBody>();
+    system.AddBody(pend1);
+    pend1->SetMass(m1);
+    pend1->SetInertiaXX(ChVector<>(1, 1, J1));
+    pend1->SetPos(ChVector<>(l1 / 2, 0, 0));
+
+    auto pend2 = std::make_shared<ChBody>();
+    system.AddBody(pend2);
+    pend2->SetMass(m2);
+    pend2->SetInertiaXX(ChVector<>(1, 1, J2));
+    pend2->SetPos(ChVector<>(l1 + l2 / 2, 0, 0));
+
+    auto revolute1 = std::make_shared<ChLinkLockRevolute>();
+    revolute1->Initialize(ground, pend1, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    system.AddLink(revolute1);
+
+    auto revolute2 = std::make_shared<ChLinkLockRevolute>();
+    revolute2->Initialize(pend1, pend2, ChCoordsys<>(ChVector<>(l1, 0, 0), QUNIT));
+    system.AddLink(revolute2);
+
+    return {ground, pend1, pend2};
+}
+
+TEST(ArticulatedChain, extraction) {
+    ChSystemNSC system;
+    auto bodies = BuildDoublePendulum(system);
+
+    // A pendulum whose body carries an additional (non-joint) constraint must
+    // not be extracted.
+    auto extra = std::make_shared<ChBody>();
+    system.AddBody(extra);
+    extra->SetMass(1);
+    extra->SetPos(ChVector<>(0, 0, 2));
+
+    auto revolute = std::make_shared<ChLinkLockRevolute>();
+    revolute->Initialize(bodies[0], extra, ChCoordsys<>(ChVector<>(0, 0, 2), QUNIT));
+    system.AddLink(revolute);
+
+    auto distance = std::make_shared<ChLinkDistance>();
+    distance->Initialize(bodies[0], extra, false, ChVector<>(1, 0, 2), ChVector<>(0, 0, 2));
+    system.AddLink(distance);
+
+    auto chains = ChArticulatedChain::ExtractChains(system);
+
+    ASSERT_EQ(chains.size(), 1u);
+    EXPECT_EQ(chains[0]->GetBase(), bodies[0]);
+    ASSERT_EQ(chains[0]->GetNumJoints(), 2u);
+    EXPECT_EQ(chains[0]->GetJoint(0).body, bodies[1]);
+    EXPECT_EQ(chains[0]->GetJoint(1).body, bodies[2]);
+    EXPECT_EQ(chains[0]->GetJoint(0).type, ChArticulatedChain::JointType::REVOLUTE);
+}
+
+TEST(ArticulatedChain, double_pendulum) {
+    ChSystemNSC system;
+    auto bodies = BuildDoublePendulum(system);
+
+    auto chains = ChArticulatedChain::ExtractChains(system);
+    ASSERT_EQ(chains.size(), 1u);
+    auto chain = chains[0];
+    chain->Initialize();
+
+    double step = 1e-4;
+    int num_steps = 5000;
+
+    // Reference: minimal-coordinate ODE of the double pendulum, advanced with
+    // the same semi-implicit Euler scheme used by the chain.
+    double phi1 = 0, phi2 = 0, phi1d = 0, phi2d = 0;
+
+    for (int it = 0; it < num_steps; it++) {
+        double M11 = 0.25 * m1 * l1 * l1 + J1 + m2 * l1 * l1;
+        double M12 = 0.5 * m2 * l1 * l2 * cos(phi2 - phi1);
+        double M22 = 0.25 * m2 * l2 * l2 + J2;
+        double det = M11 * M22 - M12 * M12;
+        double f1 = -0.5 * m1 * l1 * g * cos(phi1) - m2 * l1 * g * cos(phi1) +
+                    0.5 * m2 * l1 * l2 * phi2d * phi2d * sin(phi2 - phi1);
+        double f2 = -0.5 * m2 * l2 * g * cos(phi2) - 0.5 * m2 * l1 * l2 * phi1d * phi1d * sin(phi2 - phi1);
+        phi1d += step * (M22 * f1 - M12 * f2) / det;
+        phi2d += step * (M11 * f2 - M12 * f1) / det;
+        phi1 += step * phi1d;
+        phi2 += step * phi2d;
+
+        chain->Advance(step);
+    }
+
+    // Location and velocity of the second pendulum COM.
+    double x2 = l1 * cos(phi1) + 0.5 * l2 * cos(phi2);
+    double y2 = l1 * sin(phi1) + 0.5 * l2 * sin(phi2);
+    double xd2 = -l1 * sin(phi1) * phi1d - 0.5 * l2 * sin(phi2) * phi2d;
+    double yd2 = l1 * cos(phi1) * phi1d + 0.5 * l2 * cos(phi2) * phi2d;
+
+    EXPECT_NEAR(bodies[2]->GetPos().x(), x2, 1e-6);
+    EXPECT_NEAR(bodies[2]->GetPos().y(), y2, 1e-6);
+    EXPECT_NEAR(bodies[2]->GetPos_dt().x(), xd2, 1e-5);
+    EXPECT_NEAR(bodies[2]->GetPos_dt().y(), yd2, 1e-5);
+
+    // The joint coordinates are the pendulum angles (measured from the
+    // horizontal initial configuration).
+    EXPECT_NEAR(chain->GetJointPos(0), phi1, 1e-6);
+    EXPECT_NEAR(chain->GetJointPos(1), phi2 - phi1, 1e-6);
+}
+
+TEST(ArticulatedChain, base_reaction) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -g, 0));
+
+    auto ground = std::make_shared<ChBody>();
+    system.AddBody(ground);
+    ground->SetBodyFixed(true);
+
+    // Chain hanging at rest below the support: equilibrium.
+    auto pend1 = std::make_shared<ChBody>();
+    system.AddBody(pend1);
+    pend1->SetMass(m1);
+    pend1->SetInertiaXX(ChVector<>(1, 1, J1));
+    pend1->SetPos(ChVector<>(0, -l1 / 2, 0));
+
+    auto pend2 = std::make_shared<ChBody>();
+    system.AddBody(pend2);
+    pend2->SetMass(m2);
+    pend2->SetInertiaXX(ChVector<>(1, 1, J2));
+    pend2->SetPos(ChVector<>(0, -l1 - l2 / 2, 0));
+
+    auto revolute1 = std::make_shared<ChLinkLockRevolute>();
+    revolute1->Initialize(ground, pend1, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    system.AddLink(revolute1);
+
+    auto revolute2 = std::make_shared<ChLinkLockRevolute>();
+    revolute2->Initialize(pend1, pend2, ChCoordsys<>(ChVector<>(0, -l1, 0), QUNIT));
+    system.AddLink(revolute2);
+
+    auto chains = ChArticulatedChain::ExtractChains(system);
+    ASSERT_EQ(chains.size(), 1u);
+    auto chain = chains[0];
+    chain->Initialize();
+
+    std::vector<double> qdd;
+    chain->ComputeJointAccelerations(qdd);
+
+    // No joint accelerations at equilibrium; the chain pulls on the base with
+    // its total weight, with no moment about the support.
+    ASSERT_EQ(qdd.size(), 2u);
+    EXPECT_NEAR(qdd[0], 0.0, 1e-10);
+    EXPECT_NEAR(qdd[1], 0.0, 1e-10);
+    EXPECT_NEAR(chain->GetBaseReactionForce().x(), 0.0, 1e-10);
+    EXPECT_NEAR(chain->GetBaseReactionForce().y(), -(m1 + m2) * g, 1e-10);
+    EXPECT_NEAR(chain->GetBaseReactionForce().z(), 0.0, 1e-10);
+    EXPECT_NEAR(chain->GetBaseReactionTorque().Length(), 0.0, 1e-10);
+
+    // Release() must return the bodies to the system solver.
+    EXPECT_TRUE(pend1->GetBodyFixed());
+    chain->Release();
+    EXPECT_FALSE(pend1->GetBodyFixed());
+}
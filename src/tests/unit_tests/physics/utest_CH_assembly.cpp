@@ -164,3 +164,47 @@ TEST(FullAssembly, Assemble) {
     TestVector(rfrc, rfrc_ref, 1e-2);
     TestVector(rtrq, rtrq_ref, 1e-2);
 }
+
+TEST(BulkBodyStates, GatherScatter) {
+    ChSystemNSC my_system;
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int ib = 0; ib < 3; ib++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetPos(ChVector<>(ib + 1, 2 * ib, -ib));
+        body->SetRot(Q_from_AngX(0.1 * (ib + 1)));
+        body->SetPos_dt(ChVector<>(0.5 * ib, 0, 1));
+        body->SetWvel_loc(ChVector<>(0, 0.2 * ib, 0));
+        my_system.AddBody(body);
+        bodies.push_back(body);
+    }
+
+    // Select bodies 2 and 0 (in this order); a body not in the system must be skipped.
+    std::vector<std::shared_ptr<ChBody>> selection = {bodies[2], std::make_shared<ChBody>(), bodies[0]};
+    auto indices = my_system.CacheBodyIndices(selection);
+    ASSERT_EQ(indices.size(), 2u);
+
+    // Gather states and check against the individual accessors.
+    std::vector<double> buffer(indices.size() * ChAssembly::body_state_doubles);
+    my_system.GatherBodyStates(indices, buffer.data());
+
+    std::vector<std::shared_ptr<ChBody>> selected = {bodies[2], bodies[0]};
+    for (size_t k = 0; k < selected.size(); k++) {
+        const double* state = buffer.data() + k * ChAssembly::body_state_doubles;
+        TestVector(ChVector<>(state[0], state[1], state[2]), selected[k]->GetPos(), 1e-12);
+        TestQuaternion(ChQuaternion<>(state[3], state[4], state[5], state[6]), selected[k]->GetRot(), 1e-12);
+        TestVector(ChVector<>(state[7], state[8], state[9]), selected[k]->GetPos_dt(), 1e-12);
+        TestVector(ChVector<>(state[10], state[11], state[12]), selected[k]->GetWvel_loc(), 1e-12);
+    }
+
+    // Modify the buffer and scatter it back.
+    buffer[0] = 10;
+    buffer[7] = -3;
+    buffer[ChAssembly::body_state_doubles + 2] = 7;
+    my_system.ScatterBodyStates(indices, buffer.data());
+
+    ASSERT_NEAR(bodies[2]->GetPos().x(), 10, 1e-12);
+    ASSERT_NEAR(bodies[2]->GetPos_dt().x(), -3, 1e-12);
+    ASSERT_NEAR(bodies[0]->GetPos().z(), 7, 1e-12);
+    ASSERT_NEAR(bodies[1]->GetPos().x(), 2, 1e-12);  // unselected body untouched
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the state history buffer and its interpolated sampling.
+//
+// A pendulum system is advanced with a uniform step while retaining the step
+// states; sampling at a retained instant must reproduce that state exactly,
+// and sampling between steps must agree with a run that actually fragments
+// its steps to hit the same instant.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// Create a simple pendulum system and return the pendulum body.
+static std::shared_ptr<ChBody> BuildModel(ChSystemNSC& system) {
+    system.Set_G_acc(ChVector<>(0.0, 0.0, -9.80665));
+    system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    system.SetMaxItersSolverSpeed(100);
+    system.SetSolverType(ChSolver::Type::SOR);
+
+    auto ground = std::make_shared<ChBody>();
+    system.AddBody(ground);
+    ground->SetBodyFixed(true);
+
+    auto pendulum = std::make_shared<ChBody>();
+    system.AddBody(pendulum);
+    pendulum->SetPos(ChVector<>(2, 0, 0));
+    pendulum->SetMass(1.0);
+    pendulum->SetInertiaXX(ChVector<>(0.04, 0.1, 0.1));
+
+    auto joint = std::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(pendulum, ground, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    system.AddLink(joint);
+
+    return pendulum;
+}
+
+TEST(StateHistory, window) {
+    const double step = 1e-3;
+    const int depth = 8;
+
+    ChSystemNSC system;
+    BuildModel(system);
+    system.SetStateHistoryDepth(depth);
+
+    ChState x(&system);
+    ChStateDelta v(&system);
+
+    // Nothing retained before the first step.
+    ASSERT_FALSE(system.SampleStateHistory(0.0, x, v));
+
+    for (int i = 0; i < 100; i++)
+        system.DoStepDynamics(step);
+
+    double t_end = system.GetChTime();
+
+    // Sampling at a retained step instant must reproduce that state exactly.
+    ASSERT_TRUE(system.SampleStateHistory(t_end, x, v));
+
+    ChState x_ref(&system);
+    ChStateDelta v_ref(&system);
+    double t_ref;
+    x_ref.Reset(system.GetNcoords_x(), &system);
+    v_ref.Reset(system.GetNcoords_v(), &system);
+    system.StateGather(x_ref, v_ref, t_ref);
+
+    ASSERT_TRUE(x.Equals(x_ref));
+    ASSERT_TRUE(v.Equals(v_ref));
+
+    // Instants that slid out of the retained window must be rejected.
+    ASSERT_FALSE(system.SampleStateHistory(t_end - depth * step, x, v));
+    ASSERT_FALSE(system.SampleStateHistory(t_end + step, x, v));
+}
+
+TEST(StateHistory, interpolation) {
+    const double step = 1e-3;
+
+    // Advance with uniform steps, retaining the step states.
+    ChSystemNSC system;
+    auto pendulum = BuildModel(system);
+    system.SetStateHistoryDepth(4);
+
+    for (int i = 0; i < 100; i++)
+        system.DoStepDynamics(step);
+
+    // Advance an identical model, fragmenting the last step to stop at the
+    // mid-step instant the other run will sample by interpolation.
+    ChSystemNSC fragmented;
+    auto pendulum_frag = BuildModel(fragmented);
+
+    for (int i = 0; i < 99; i++)
+        fragmented.DoStepDynamics(step);
+    fragmented.DoStepDynamics(step / 2);
+
+    ChState x(&system);
+    ChStateDelta v(&system);
+    ASSERT_TRUE(system.SampleStateHistory(fragmented.GetChTime(), x, v));
+
+    // The interpolated and the fragmented states approximate the same
+    // trajectory; they agree up to the local integration error.
+    ChVector<> pos_frag = pendulum_frag->GetPos();
+    ChVector<> vel_frag = pendulum_frag->GetPos_dt();
+
+    // The fixed ground contributes no state, so the pendulum coordinates
+    // start at offset 0.  The velocity tolerance is looser because the two
+    // runs accumulate different first-order local integration errors.
+    ASSERT_NEAR(x.GetElementN(0), pos_frag.x(), 1e-5);
+    ASSERT_NEAR(x.GetElementN(1), pos_frag.y(), 1e-5);
+    ASSERT_NEAR(x.GetElementN(2), pos_frag.z(), 1e-5);
+    ASSERT_NEAR(v.GetElementN(0), vel_frag.x(), 5e-3);
+    ASSERT_NEAR(v.GetElementN(1), vel_frag.y(), 5e-3);
+    ASSERT_NEAR(v.GetElementN(2), vel_frag.z(), 5e-3);
+}
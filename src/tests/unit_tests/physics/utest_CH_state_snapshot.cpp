@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the raw binary state snapshots.
+//
+// A pendulum system is advanced, checkpointed, advanced further, then rewound
+// from the snapshot and advanced again; the two runs must coincide.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/serialization/ChStateSnapshot.h"
+
+using namespace chrono;
+
+static void TestVector(const ChVector<>& v1, const ChVector<>& v2, double tol) {
+    ASSERT_NEAR(v1.x(), v2.x(), tol);
+    ASSERT_NEAR(v1.y(), v2.y(), tol);
+    ASSERT_NEAR(v1.z(), v2.z(), tol);
+}
+
+// Create a simple pendulum system and return the pendulum body.
+static std::shared_ptr<ChBody> BuildModel(ChSystemNSC& system) {
+    system.Set_G_acc(ChVector<>(0.0, 0.0, -9.80665));
+    system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    system.SetMaxItersSolverSpeed(100);
+    system.SetSolverType(ChSolver::Type::SOR);
+
+    auto ground = std::make_shared<ChBody>();
+    system.AddBody(ground);
+    ground->SetBodyFixed(true);
+
+    auto pendulum = std::make_shared<ChBody>();
+    system.AddBody(pendulum);
+    pendulum->SetPos(ChVector<>(2, 0, 0));
+    pendulum->SetMass(1.0);
+    pendulum->SetInertiaXX(ChVector<>(0.04, 0.1, 0.1));
+
+    auto joint = std::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(pendulum, ground, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    system.AddLink(joint);
+
+    return pendulum;
+}
+
+TEST(StateSnapshot, rewind) {
+    const std::string filename = "utest_snapshot.chsnap";
+    const double step = 1e-3;
+
+    ChSystemNSC system;
+    auto pendulum = BuildModel(system);
+
+    for (int i = 0; i < 100; i++)
+        system.DoStepDynamics(step);
+
+    // Checkpoint, then keep advancing and record the reference end state.
+    ChStateSnapshot::Write(system, filename);
+    double time_snapshot = system.GetChTime();
+
+    for (int i = 0; i < 100; i++)
+        system.DoStepDynamics(step);
+
+    ChVector<> pos_ref = pendulum->GetPos();
+    ChVector<> vel_ref = pendulum->GetPos_dt();
+
+    // Rewind to the checkpoint and repeat; the runs must coincide.
+    ChStateSnapshot::Read(system, filename);
+    ASSERT_NEAR(system.GetChTime(), time_snapshot, 1e-12);
+
+    for (int i = 0; i < 100; i++)
+        system.DoStepDynamics(step);
+
+    TestVector(pendulum->GetPos(), pos_ref, 1e-9);
+    TestVector(pendulum->GetPos_dt(), vel_ref, 1e-9);
+}
+
+TEST(StateSnapshot, mismatch) {
+    const std::string filename = "utest_snapshot.chsnap";
+
+    ChSystemNSC system;
+    BuildModel(system);
+    system.DoStepDynamics(1e-3);
+    ChStateSnapshot::Write(system, filename);
+
+    // A snapshot must be rejected by a system with a different state layout.
+    ChSystemNSC other;
+    auto body = std::make_shared<ChBody>();
+    other.AddBody(body);
+    ASSERT_THROW(ChStateSnapshot::Read(other, filename), ChException);
+}